@@ -267,78 +267,326 @@ bool FAnimAssetManager::SetStateMontage(
 	return false;
 }
 
-// ===== Asset Discovery =====
-
-TArray<FString> FAnimAssetManager::FindAnimationAssets(
-	const FString& SearchPattern,
-	const FString& AssetType,
-	USkeleton* TargetSkeleton)
+int32 FAnimAssetManager::AssignStateAnimations(
+	UAnimBlueprint* AnimBP,
+	const FString& StateMachineName,
+	const TMap<FString, FString>& StateToAssetPath,
+	TMap<FString, FString>& OutPerStateErrors)
 {
-	TArray<FString> Results;
-
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	// Determine class filter
-	TArray<FTopLevelAssetPath> ClassPaths;
-	if (AssetType.Equals(TEXT("AnimSequence"), ESearchCase::IgnoreCase))
-	{
-		ClassPaths.Add(UAnimSequence::StaticClass()->GetClassPathName());
-	}
-	else if (AssetType.Equals(TEXT("BlendSpace"), ESearchCase::IgnoreCase))
-	{
-		ClassPaths.Add(UBlendSpace::StaticClass()->GetClassPathName());
-	}
-	else if (AssetType.Equals(TEXT("BlendSpace1D"), ESearchCase::IgnoreCase))
+	if (!AnimBP)
 	{
-		ClassPaths.Add(UBlendSpace1D::StaticClass()->GetClassPathName());
+		for (const auto& Pair : StateToAssetPath)
+		{
+			OutPerStateErrors.Add(Pair.Key, TEXT("Invalid Animation Blueprint"));
+		}
+		return 0;
 	}
-	else if (AssetType.Equals(TEXT("Montage"), ESearchCase::IgnoreCase))
+
+	// Phase one: resolve and validate every distinct asset exactly once, so a
+	// batch reusing the same clip across states pays a single load
+	TMap<FString, UAnimationAsset*> LoadedAssets;
+	TMap<FString, FString> AssetErrors;
+
+	for (const auto& Pair : StateToAssetPath)
 	{
-		ClassPaths.Add(UAnimMontage::StaticClass()->GetClassPathName());
+		const FString& AssetPath = Pair.Value;
+		if (LoadedAssets.Contains(AssetPath) || AssetErrors.Contains(AssetPath))
+		{
+			continue;
+		}
+
+		FString AssetError;
+		UAnimationAsset* Asset = LoadAnimationAsset(AssetPath, AssetError);
+		if (Asset && !ValidateAnimationCompatibility(AnimBP, Asset, AssetError))
+		{
+			Asset = nullptr;
+		}
+
+		if (Asset)
+		{
+			LoadedAssets.Add(AssetPath, Asset);
+		}
+		else
+		{
+			AssetErrors.Add(AssetPath, AssetError);
+		}
 	}
-	else // All
+
+	// Phase two: apply the bindings; per-state failures are recorded and do
+	// not abort the rest of the batch
+	int32 AssignedCount = 0;
+
+	for (const auto& Pair : StateToAssetPath)
 	{
-		ClassPaths.Add(UAnimSequence::StaticClass()->GetClassPathName());
-		ClassPaths.Add(UBlendSpace::StaticClass()->GetClassPathName());
-		ClassPaths.Add(UBlendSpace1D::StaticClass()->GetClassPathName());
-		ClassPaths.Add(UAnimMontage::StaticClass()->GetClassPathName());
+		const FString& StateName = Pair.Key;
+		const FString& AssetPath = Pair.Value;
+
+		UAnimationAsset* Asset = LoadedAssets.FindRef(AssetPath);
+		if (!Asset)
+		{
+			OutPerStateErrors.Add(StateName, AssetErrors.FindRef(AssetPath));
+			continue;
+		}
+
+		FString StateError;
+		UEdGraph* StateGraph = FAnimGraphEditor::FindStateBoundGraph(AnimBP, StateMachineName, StateName, StateError);
+		if (!StateGraph)
+		{
+			OutPerStateErrors.Add(StateName, StateError);
+			continue;
+		}
+
+		if (!FAnimGraphEditor::ClearStateGraph(StateGraph, StateError))
+		{
+			OutPerStateErrors.Add(StateName, StateError);
+			continue;
+		}
+
+		// Auto-detect the player node type from the asset class
+		FString NodeId;
+		UEdGraphNode* PlayerNode = nullptr;
+		if (UBlendSpace1D* BlendSpace1D = Cast<UBlendSpace1D>(Asset))
+		{
+			PlayerNode = FAnimGraphEditor::CreateBlendSpace1DNode(StateGraph, BlendSpace1D, FVector2D(200, 100), NodeId, StateError);
+		}
+		else if (UBlendSpace* BlendSpace = Cast<UBlendSpace>(Asset))
+		{
+			PlayerNode = FAnimGraphEditor::CreateBlendSpaceNode(StateGraph, BlendSpace, FVector2D(200, 100), NodeId, StateError);
+		}
+		else if (UAnimSequence* Sequence = Cast<UAnimSequence>(Asset))
+		{
+			PlayerNode = FAnimGraphEditor::CreateAnimSequenceNode(StateGraph, Sequence, FVector2D(200, 100), NodeId, StateError);
+		}
+		else
+		{
+			StateError = FString::Printf(TEXT("Asset type '%s' cannot be bound to a state"), *Asset->GetClass()->GetName());
+		}
+
+		if (!PlayerNode)
+		{
+			OutPerStateErrors.Add(StateName, StateError);
+			continue;
+		}
+
+		if (!FAnimGraphEditor::ConnectToOutputPose(StateGraph, NodeId, StateError))
+		{
+			OutPerStateErrors.Add(StateName, StateError);
+			continue;
+		}
+
+		AssignedCount++;
 	}
 
-	// Query assets
-	FARFilter Filter;
-	Filter.ClassPaths = ClassPaths;
-	Filter.bRecursiveClasses = true;
-	Filter.bRecursivePaths = true;
-	Filter.PackagePaths.Add(FName(TEXT("/Game")));
+	return AssignedCount;
+}
 
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssets(Filter, AssetDataList);
+// ===== Asset Discovery =====
 
-	// Filter by pattern and skeleton
-	for (const FAssetData& AssetData : AssetDataList)
+namespace
+{
+	/**
+	 * In-memory index of animation assets under /Game.
+	 *
+	 * Bulk state setup calls FindAnimationAssets repeatedly while wiring
+	 * sequences into states; previously every call re-ran the registry query
+	 * and, when filtering by skeleton, synchronously loaded each candidate
+	 * asset just to compare skeleton pointers. The index runs one FARFilter
+	 * query on first use, keeps FAssetData entries keyed by object path, and
+	 * stays current through the registry's add/remove/update/rename events.
+	 * Skeleton filtering compares the registry's Skeleton tag, so queries
+	 * never trigger asset loads. Game thread only, like the editor callbacks
+	 * that feed it.
+	 */
+	class FAnimAssetIndex
 	{
-		FString AssetName = AssetData.AssetName.ToString();
+	public:
+		static FAnimAssetIndex& Get()
+		{
+			static FAnimAssetIndex Instance;
+			return Instance;
+		}
 
-		// Check pattern match
-		if (!SearchPattern.IsEmpty() && !AssetName.Contains(SearchPattern))
+		void Query(
+			const FString& SearchPattern,
+			const FString& AssetType,
+			USkeleton* TargetSkeleton,
+			TArray<FString>& OutPaths)
 		{
-			continue;
+			EnsureBuilt();
+
+			// Resolve the class filter once per query
+			UClass* FilterClass = nullptr;
+			if (AssetType.Equals(TEXT("AnimSequence"), ESearchCase::IgnoreCase))
+			{
+				FilterClass = UAnimSequence::StaticClass();
+			}
+			else if (AssetType.Equals(TEXT("BlendSpace"), ESearchCase::IgnoreCase))
+			{
+				FilterClass = UBlendSpace::StaticClass();
+			}
+			else if (AssetType.Equals(TEXT("BlendSpace1D"), ESearchCase::IgnoreCase))
+			{
+				FilterClass = UBlendSpace1D::StaticClass();
+			}
+			else if (AssetType.Equals(TEXT("Montage"), ESearchCase::IgnoreCase))
+			{
+				FilterClass = UAnimMontage::StaticClass();
+			}
+			// else: All - no class restriction beyond index membership
+
+			// The skeleton tag stores the export text name, so one conversion
+			// serves every entry comparison
+			FString SkeletonExportName;
+			if (TargetSkeleton)
+			{
+				SkeletonExportName = FAssetData(TargetSkeleton).GetExportTextName();
+			}
+
+			for (const auto& Pair : Entries)
+			{
+				const FAssetData& AssetData = Pair.Value;
+
+				if (FilterClass && !AssetData.IsInstanceOf(FilterClass))
+				{
+					continue;
+				}
+
+				if (!SearchPattern.IsEmpty() && !AssetData.AssetName.ToString().Contains(SearchPattern))
+				{
+					continue;
+				}
+
+				if (TargetSkeleton)
+				{
+					FString SkeletonTag;
+					if (!AssetData.GetTagValue(TEXT("Skeleton"), SkeletonTag) ||
+						SkeletonTag != SkeletonExportName)
+					{
+						continue;
+					}
+				}
+
+				OutPaths.Add(AssetData.GetObjectPathString());
+			}
 		}
 
-		// Check skeleton compatibility
-		if (TargetSkeleton)
+	private:
+		FAnimAssetIndex() = default;
+
+		~FAnimAssetIndex()
 		{
-			UAnimationAsset* Asset = Cast<UAnimationAsset>(AssetData.GetAsset());
-			if (Asset && Asset->GetSkeleton() != TargetSkeleton)
+			if (bDelegatesRegistered && FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
 			{
-				continue;
+				IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+				AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+				AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+				AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+				AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
 			}
 		}
 
-		Results.Add(AssetData.GetObjectPathString());
-	}
+		/** Whether an asset belongs in the index (anim asset under /Game) */
+		static bool ShouldIndex(const FAssetData& AssetData)
+		{
+			if (!AssetData.PackageName.ToString().StartsWith(TEXT("/Game")))
+			{
+				return false;
+			}
+			return AssetData.IsInstanceOf(UAnimSequence::StaticClass()) ||
+				AssetData.IsInstanceOf(UBlendSpace::StaticClass()) ||
+				AssetData.IsInstanceOf(UAnimMontage::StaticClass());
+		}
+
+		void EnsureBuilt()
+		{
+			if (bBuilt)
+			{
+				return;
+			}
+
+			FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+			IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+			// One registry walk seeds the index; BlendSpace1D is covered by
+			// the recursive BlendSpace entry
+			FARFilter Filter;
+			Filter.ClassPaths.Add(UAnimSequence::StaticClass()->GetClassPathName());
+			Filter.ClassPaths.Add(UBlendSpace::StaticClass()->GetClassPathName());
+			Filter.ClassPaths.Add(UAnimMontage::StaticClass()->GetClassPathName());
+			Filter.bRecursiveClasses = true;
+			Filter.bRecursivePaths = true;
+			Filter.PackagePaths.Add(FName(TEXT("/Game")));
+
+			TArray<FAssetData> AssetDataList;
+			AssetRegistry.GetAssets(Filter, AssetDataList);
+
+			Entries.Reset();
+			Entries.Reserve(AssetDataList.Num());
+			for (const FAssetData& AssetData : AssetDataList)
+			{
+				Entries.Add(AssetData.GetSoftObjectPath(), AssetData);
+			}
+
+			if (!bDelegatesRegistered)
+			{
+				AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FAnimAssetIndex::OnAssetAddedOrUpdated);
+				AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAnimAssetIndex::OnAssetRemoved);
+				AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FAnimAssetIndex::OnAssetAddedOrUpdated);
+				AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAnimAssetIndex::OnAssetRenamed);
+				bDelegatesRegistered = true;
+			}
+
+			bBuilt = true;
+		}
+
+		void OnAssetAddedOrUpdated(const FAssetData& AssetData)
+		{
+			if (bBuilt && ShouldIndex(AssetData))
+			{
+				Entries.Add(AssetData.GetSoftObjectPath(), AssetData);
+			}
+		}
+
+		void OnAssetRemoved(const FAssetData& AssetData)
+		{
+			if (bBuilt)
+			{
+				Entries.Remove(AssetData.GetSoftObjectPath());
+			}
+		}
 
+		void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+		{
+			if (bBuilt)
+			{
+				Entries.Remove(FSoftObjectPath(OldObjectPath));
+				if (ShouldIndex(AssetData))
+				{
+					Entries.Add(AssetData.GetSoftObjectPath(), AssetData);
+				}
+			}
+		}
+
+		/** Indexed anim assets keyed by object path */
+		TMap<FSoftObjectPath, FAssetData> Entries;
+
+		bool bBuilt = false;
+		bool bDelegatesRegistered = false;
+
+		FDelegateHandle AssetAddedHandle;
+		FDelegateHandle AssetRemovedHandle;
+		FDelegateHandle AssetUpdatedHandle;
+		FDelegateHandle AssetRenamedHandle;
+	};
+}
+
+TArray<FString> FAnimAssetManager::FindAnimationAssets(
+	const FString& SearchPattern,
+	const FString& AssetType,
+	USkeleton* TargetSkeleton)
+{
+	TArray<FString> Results;
+	FAnimAssetIndex::Get().Query(SearchPattern, AssetType, TargetSkeleton, Results);
 	return Results;
 }
 
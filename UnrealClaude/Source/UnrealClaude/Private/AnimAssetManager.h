@@ -138,6 +138,27 @@ public:
 		FString& OutError
 	);
 
+	/**
+	 * Assign animations to many states in one pass (state name -> asset path)
+	 *
+	 * Phase one resolves and validates every distinct asset once; phase two
+	 * applies the bindings, auto-detecting sequence vs blend space per asset.
+	 * The caller dirties and compiles once for the whole batch instead of
+	 * per state.
+	 *
+	 * @param AnimBP - Animation Blueprint
+	 * @param StateMachineName - State machine containing the states
+	 * @param StateToAssetPath - State name -> animation asset path
+	 * @param OutPerStateErrors - State name -> error for states that failed
+	 * @return Number of states successfully bound
+	 */
+	static int32 AssignStateAnimations(
+		UAnimBlueprint* AnimBP,
+		const FString& StateMachineName,
+		const TMap<FString, FString>& StateToAssetPath,
+		TMap<FString, FString>& OutPerStateErrors
+	);
+
 	// ===== Asset Discovery =====
 
 	/**
@@ -622,6 +622,14 @@ bool FAnimGraphEditor::SetPinDefaultValueWithValidation(
 	return FAnimNodePinUtils::SetPinDefaultValueWithValidation(Graph, NodeId, PinName, Value, OutError);
 }
 
+int32 FAnimGraphEditor::SetPinDefaultValuesWithValidation(
+	UEdGraph* Graph,
+	const TArray<FPinDefaultAssignment>& Assignments,
+	TArray<FString>& OutErrors)
+{
+	return FAnimNodePinUtils::SetPinDefaultValuesWithValidation(Graph, Assignments, OutErrors);
+}
+
 TSharedPtr<FJsonObject> FAnimGraphEditor::CreateComparisonChain(
 	UAnimBlueprint* AnimBP,
 	UEdGraph* TransitionGraph,
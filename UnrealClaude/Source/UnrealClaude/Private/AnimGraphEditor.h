@@ -298,6 +298,16 @@ public:
 		FString& OutError
 	);
 
+	/**
+	 * Apply a batch of pin defaults, reconstructing each affected node once
+	 * Returns the number applied; per-assignment failures land in OutErrors
+	 */
+	static int32 SetPinDefaultValuesWithValidation(
+		UEdGraph* Graph,
+		const TArray<FPinDefaultAssignment>& Assignments,
+		TArray<FString>& OutErrors
+	);
+
 	/**
 	 * Validate if a value is compatible with a pin type
 	 */
@@ -8,6 +8,83 @@
 #include "AnimStateTransitionNode.h"
 #include "AnimationGraph.h"
 #include "EdGraph/EdGraph.h"
+#include "UnrealClaudeConstants.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+	/** One blueprint's resolved graphs; game thread only, like the finders */
+	struct FAnimGraphIndex
+	{
+		TWeakObjectPtr<UEdGraph> AnimGraph;
+
+		/** Lowercase state machine name -> node (first match wins on duplicates,
+		 *  matching the old walk order) */
+		TMap<FString, TWeakObjectPtr<UAnimGraphNode_StateMachine>> StateMachinesByName;
+	};
+
+	TMap<FObjectKey, FAnimGraphIndex> GGraphIndices;
+
+	/** Blueprints whose OnChanged we already subscribed to; the delegate's
+	 *  lifetime is tied to the blueprint so it is registered exactly once */
+	TSet<FObjectKey> GHookedBlueprints;
+
+	FAnimGraphIndex& GetOrBuildIndex(UAnimBlueprint* AnimBP)
+	{
+		const FObjectKey Key(AnimBP);
+		if (FAnimGraphIndex* Existing = GGraphIndices.Find(Key))
+		{
+			return *Existing;
+		}
+
+		if (GGraphIndices.Num() >= UnrealClaudeConstants::AnimDiagram::MaxIndexedAnimBlueprints)
+		{
+			GGraphIndices.Empty();
+		}
+
+		// Every structural edit routed through the editor marks the blueprint
+		// changed, so OnChanged is the invalidation trigger: drop the entry
+		// and let the next lookup re-walk the hierarchy once
+		if (!GHookedBlueprints.Contains(Key))
+		{
+			GHookedBlueprints.Add(Key);
+			AnimBP->OnChanged().AddLambda([](UBlueprint* Changed)
+			{
+				GGraphIndices.Remove(FObjectKey(Changed));
+			});
+		}
+
+		FAnimGraphIndex& Index = GGraphIndices.Add(Key);
+
+		TArray<UEdGraph*> AllGraphs;
+		AnimBP->GetAllGraphs(AllGraphs);
+
+		for (UEdGraph* Graph : AllGraphs)
+		{
+			if (!Graph) continue;
+
+			if (!Index.AnimGraph.IsValid() && Graph->IsA<UAnimationGraph>())
+			{
+				Index.AnimGraph = Graph;
+			}
+
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (UAnimGraphNode_StateMachine* SMNode = Cast<UAnimGraphNode_StateMachine>(Node))
+				{
+					TWeakObjectPtr<UAnimGraphNode_StateMachine>& Slot =
+						Index.StateMachinesByName.FindOrAdd(SMNode->GetStateMachineName().ToLower());
+					if (!Slot.IsValid())
+					{
+						Slot = SMNode;
+					}
+				}
+			}
+		}
+
+		return Index;
+	}
+}
 
 UEdGraph* FAnimGraphFinder::FindAnimGraph(UAnimBlueprint* AnimBP, FString& OutError)
 {
@@ -17,19 +94,12 @@ UEdGraph* FAnimGraphFinder::FindAnimGraph(UAnimBlueprint* AnimBP, FString& OutEr
 		return nullptr;
 	}
 
-	TArray<UEdGraph*> AllGraphs;
-	AnimBP->GetAllGraphs(AllGraphs);
-
-	for (UEdGraph* Graph : AllGraphs)
+	UEdGraph* AnimGraph = GetOrBuildIndex(AnimBP).AnimGraph.Get();
+	if (!AnimGraph)
 	{
-		if (Graph->IsA<UAnimationGraph>())
-		{
-			return Graph;
-		}
+		OutError = TEXT("Animation Blueprint has no AnimGraph");
 	}
-
-	OutError = TEXT("Animation Blueprint has no AnimGraph");
-	return nullptr;
+	return AnimGraph;
 }
 
 UEdGraph* FAnimGraphFinder::FindStateBoundGraph(
@@ -96,3 +166,29 @@ UAnimGraphNode_Root* FAnimGraphFinder::FindAnimGraphRoot(UAnimBlueprint* AnimBP,
 	OutError = TEXT("AnimGraph root node (Output Pose) not found");
 	return nullptr;
 }
+
+UAnimGraphNode_StateMachine* FAnimGraphFinder::FindStateMachineNode(
+	UAnimBlueprint* AnimBP,
+	const FString& StateMachineName)
+{
+	if (!AnimBP)
+	{
+		return nullptr;
+	}
+
+	const FAnimGraphIndex& Index = GetOrBuildIndex(AnimBP);
+	if (const TWeakObjectPtr<UAnimGraphNode_StateMachine>* Found =
+		Index.StateMachinesByName.Find(StateMachineName.ToLower()))
+	{
+		return Found->Get();
+	}
+	return nullptr;
+}
+
+void FAnimGraphFinder::InvalidateIndex(UAnimBlueprint* AnimBP)
+{
+	if (AnimBP)
+	{
+		GGraphIndices.Remove(FObjectKey(AnimBP));
+	}
+}
@@ -17,6 +17,11 @@ class UEdGraph;
  * - Finding state bound graphs
  * - Finding transition graphs
  * - Finding AnimGraph root node
+ *
+ * Lookups go through a per-blueprint index (state machine name -> node weak
+ * ptr, plus the AnimGraph) built lazily on first use and dropped when the
+ * blueprint broadcasts OnChanged, so a bulk-edit batch resolves graphs with
+ * hash lookups instead of one full graph-hierarchy walk per operation.
  */
 class UNREALCLAUDE_API FAnimGraphFinder
 {
@@ -68,4 +73,25 @@ public:
 	 * @return The root node or nullptr
 	 */
 	static UAnimGraphNode_Root* FindAnimGraphRoot(UAnimBlueprint* AnimBP, FString& OutError);
+
+	/**
+	 * Indexed state machine node lookup (case-insensitive on name).
+	 * Returns nullptr without setting an error when not found, so callers
+	 * own their own "not found" reporting.
+	 * @param AnimBP Animation Blueprint
+	 * @param StateMachineName Name of the state machine
+	 * @return The state machine node or nullptr
+	 */
+	static UAnimGraphNode_StateMachine* FindStateMachineNode(
+		UAnimBlueprint* AnimBP,
+		const FString& StateMachineName
+	);
+
+	/**
+	 * Drop the cached index for a blueprint. Rarely needed directly — the
+	 * index already invalidates itself on the blueprint's OnChanged event —
+	 * but available for mutation paths that bypass it.
+	 * @param AnimBP Animation Blueprint whose index to drop
+	 */
+	static void InvalidateIndex(UAnimBlueprint* AnimBP);
 };
@@ -11,6 +11,22 @@
 // Forward declaration for node ID functions
 class FAnimGraphEditor;
 
+namespace
+{
+	/** Resolve a node by its comment-embedded ID tag */
+	UEdGraphNode* FindNodeByIdTag(UEdGraph* Graph, const FString& NodeId)
+	{
+		for (UEdGraphNode* GraphNode : Graph->Nodes)
+		{
+			if (GraphNode && GraphNode->NodeComment.Contains(NodeId))
+			{
+				return GraphNode;
+			}
+		}
+		return nullptr;
+	}
+}
+
 UEdGraphPin* FAnimNodePinUtils::FindPinByName(
 	UEdGraphNode* Node,
 	const FString& PinName,
@@ -265,15 +281,7 @@ bool FAnimNodePinUtils::SetPinDefaultValueWithValidation(
 
 	// Find node - need to use FAnimGraphEditor::FindNodeById
 	// This is implemented via delegate to avoid circular dependency
-	UEdGraphNode* Node = nullptr;
-	for (UEdGraphNode* GraphNode : Graph->Nodes)
-	{
-		if (GraphNode && GraphNode->NodeComment.Contains(NodeId))
-		{
-			Node = GraphNode;
-			break;
-		}
-	}
+	UEdGraphNode* Node = FindNodeByIdTag(Graph, NodeId);
 
 	if (!Node)
 	{
@@ -305,6 +313,12 @@ bool FAnimNodePinUtils::SetPinDefaultValueWithValidation(
 		return false;
 	}
 
+	// Already-current values succeed without touching the graph
+	if (Pin->DefaultValue.Equals(Value, ESearchCase::CaseSensitive))
+	{
+		return true;
+	}
+
 	// Set the default value
 	const UEdGraphSchema* Schema = Graph->GetSchema();
 	if (Schema)
@@ -320,3 +334,79 @@ bool FAnimNodePinUtils::SetPinDefaultValueWithValidation(
 
 	return true;
 }
+
+int32 FAnimNodePinUtils::SetPinDefaultValuesWithValidation(
+	UEdGraph* Graph,
+	const TArray<FPinDefaultAssignment>& Assignments,
+	TArray<FString>& OutErrors)
+{
+	if (!Graph)
+	{
+		OutErrors.Add(TEXT("Invalid graph"));
+		return 0;
+	}
+
+	const UEdGraphSchema* Schema = Graph->GetSchema();
+	TSet<UEdGraphNode*> ChangedNodes;
+	int32 AppliedCount = 0;
+
+	for (const FPinDefaultAssignment& Assignment : Assignments)
+	{
+		UEdGraphNode* Node = FindNodeByIdTag(Graph, Assignment.NodeId);
+		if (!Node)
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s.%s: node not found"),
+				*Assignment.NodeId, *Assignment.PinName));
+			continue;
+		}
+
+		UEdGraphPin* Pin = FindPinByName(Node, Assignment.PinName, EGPD_Input);
+		if (!Pin)
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s.%s: input pin not found"),
+				*Assignment.NodeId, *Assignment.PinName));
+			continue;
+		}
+
+		FString ValidationError;
+		if (!ValidatePinValueType(Pin, Assignment.Value, ValidationError))
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s.%s: %s"),
+				*Assignment.NodeId, *Assignment.PinName, *ValidationError));
+			continue;
+		}
+
+		// Unchanged values cost nothing: no set, no reconstruction
+		if (Pin->DefaultValue.Equals(Assignment.Value, ESearchCase::CaseSensitive))
+		{
+			AppliedCount++;
+			continue;
+		}
+
+		if (Schema)
+		{
+			Schema->TrySetDefaultValue(*Pin, Assignment.Value);
+		}
+		else
+		{
+			Pin->DefaultValue = Assignment.Value;
+		}
+
+		ChangedNodes.Add(Node);
+		AppliedCount++;
+	}
+
+	// One reconstruction per distinct changed node, after every value is in
+	// place, mirroring the FScopedBulkGraphEdit finalize pass
+	for (UEdGraphNode* Node : ChangedNodes)
+	{
+		Node->ReconstructNode();
+	}
+
+	if (ChangedNodes.Num() > 0)
+	{
+		Graph->Modify();
+	}
+
+	return AppliedCount;
+}
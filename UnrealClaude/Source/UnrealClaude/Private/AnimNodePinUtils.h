@@ -64,6 +64,21 @@ struct FPinSearchConfig
 	}
 };
 
+/**
+ * One pin default assignment in a batch
+ */
+struct FPinDefaultAssignment
+{
+	/** Node identifier (matched against the node comment tag) */
+	FString NodeId;
+
+	/** Input pin name (case-insensitive) */
+	FString PinName;
+
+	/** Value to apply */
+	FString Value;
+};
+
 /**
  * AnimNodePinUtils - Pin finding and connection utilities
  *
@@ -157,4 +172,24 @@ public:
 		const FString& Value,
 		FString& OutError
 	);
+
+	/**
+	 * Apply a batch of pin defaults with type validation
+	 *
+	 * All values are applied first, then each affected node is reconstructed
+	 * exactly once so the defaults settle into the node's properties;
+	 * assignments whose pin already holds the requested value are skipped
+	 * outright. Cost therefore scales with distinct changed nodes, not with
+	 * total assignments.
+	 *
+	 * @param Graph Graph containing the nodes
+	 * @param Assignments Pin assignments to apply
+	 * @param OutErrors One entry per failed assignment ("NodeId.PinName: reason")
+	 * @return Number of assignments applied (already-current values count)
+	 */
+	static int32 SetPinDefaultValuesWithValidation(
+		UEdGraph* Graph,
+		const TArray<FPinDefaultAssignment>& Assignments,
+		TArray<FString>& OutErrors
+	);
 };
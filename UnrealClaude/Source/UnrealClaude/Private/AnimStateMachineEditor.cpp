@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "AnimStateMachineEditor.h"
+#include "AnimGraphFinder.h"
 #include "AnimGraphNode_StateMachine.h"
 #include "AnimGraphNode_StateResult.h"
 #include "AnimGraphNode_TransitionResult.h"
@@ -20,6 +21,7 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "HAL/PlatformAtomics.h"
+#include "UnrealClaudeConstants.h"
 
 volatile int32 FAnimStateMachineEditor::NodeIdCounter = 0;
 const FString FAnimStateMachineEditor::NodeIdPrefix = TEXT("MCP_ANIM_ID:");
@@ -121,22 +123,11 @@ UAnimGraphNode_StateMachine* FAnimStateMachineEditor::FindStateMachine(
 		return nullptr;
 	}
 
-	TArray<UEdGraph*> AllGraphs;
-	AnimBP->GetAllGraphs(AllGraphs);
-
-	for (UEdGraph* Graph : AllGraphs)
+	// Indexed lookup; per-operation callers in a bulk edit batch resolve
+	// with a hash probe instead of a full graph-hierarchy walk
+	if (UAnimGraphNode_StateMachine* SMNode = FAnimGraphFinder::FindStateMachineNode(AnimBP, StateMachineName))
 	{
-		for (UEdGraphNode* Node : Graph->Nodes)
-		{
-			if (UAnimGraphNode_StateMachine* SMNode = Cast<UAnimGraphNode_StateMachine>(Node))
-			{
-				FString NodeName = SMNode->GetStateMachineName();
-				if (NodeName.Equals(StateMachineName, ESearchCase::IgnoreCase))
-				{
-					return SMNode;
-				}
-			}
-		}
+		return SMNode;
 	}
 
 	// Get available names for error message
@@ -265,6 +256,135 @@ UAnimationStateMachineGraph* FAnimStateMachineEditor::GetStateMachineGraph(
 	return SMGraph;
 }
 
+int32 FAnimStateMachineEditor::LayoutStateMachine(
+	UAnimGraphNode_StateMachine* StateMachine,
+	const TSet<FString>* OnlyStates,
+	FString& OutError)
+{
+	UAnimationStateMachineGraph* SMGraph = GetStateMachineGraph(StateMachine, OutError);
+	if (!SMGraph)
+	{
+		return -1;
+	}
+
+	// Collect states and transitions from the finished graph
+	TArray<UAnimStateNode*> StateNodes;
+	TArray<UAnimStateTransitionNode*> TransitionNodes;
+	for (UEdGraphNode* Node : SMGraph->Nodes)
+	{
+		if (UAnimStateNode* StateNode = Cast<UAnimStateNode>(Node))
+		{
+			StateNodes.Add(StateNode);
+		}
+		else if (UAnimStateTransitionNode* TransNode = Cast<UAnimStateTransitionNode>(Node))
+		{
+			TransitionNodes.Add(TransNode);
+		}
+	}
+
+	if (StateNodes.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Adjacency over state names, following transition direction
+	TMap<FString, TArray<FString>> Adjacency;
+	for (UAnimStateTransitionNode* Trans : TransitionNodes)
+	{
+		UAnimStateNodeBase* Prev = Trans ? Trans->GetPreviousState() : nullptr;
+		UAnimStateNodeBase* Next = Trans ? Trans->GetNextState() : nullptr;
+		if (Prev && Next)
+		{
+			Adjacency.FindOrAdd(Prev->GetStateName()).Add(Next->GetStateName());
+		}
+	}
+
+	// BFS from the entry state (fall back to the first state) assigns each
+	// state a layer; layer becomes the column, arrival order the row
+	FString EntryStateName = StateNodes[0]->GetStateName();
+	if (SMGraph->EntryNode)
+	{
+		for (UEdGraphPin* Pin : SMGraph->EntryNode->Pins)
+		{
+			if (Pin && Pin->Direction == EGPD_Output && Pin->LinkedTo.Num() > 0)
+			{
+				if (UAnimStateNode* EntryTarget = Cast<UAnimStateNode>(Pin->LinkedTo[0]->GetOwningNode()))
+				{
+					EntryStateName = EntryTarget->GetStateName();
+					break;
+				}
+			}
+		}
+	}
+
+	TMap<FString, int32> Layers;
+	TArray<FString> Queue;
+	Layers.Add(EntryStateName, 0);
+	Queue.Add(EntryStateName);
+	int32 MaxLayer = 0;
+
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); QueueIndex++)
+	{
+		const int32 Layer = Layers[Queue[QueueIndex]];
+		if (const TArray<FString>* Neighbors = Adjacency.Find(Queue[QueueIndex]))
+		{
+			for (const FString& Neighbor : *Neighbors)
+			{
+				if (!Layers.Contains(Neighbor))
+				{
+					Layers.Add(Neighbor, Layer + 1);
+					Queue.Add(Neighbor);
+					MaxLayer = FMath::Max(MaxLayer, Layer + 1);
+				}
+			}
+		}
+	}
+
+	// Unreachable states trail in extra columns after the reachable layers
+	for (UAnimStateNode* StateNode : StateNodes)
+	{
+		if (!Layers.Contains(StateNode->GetStateName()))
+		{
+			Layers.Add(StateNode->GetStateName(), MaxLayer + 1);
+		}
+	}
+
+	// Apply positions: one write per state, rows packed per layer
+	TMap<int32, int32> RowsPerLayer;
+	int32 RepositionedCount = 0;
+	for (UAnimStateNode* StateNode : StateNodes)
+	{
+		const FString StateName = StateNode->GetStateName();
+		const int32 Layer = Layers[StateName];
+		const int32 Row = RowsPerLayer.FindOrAdd(Layer)++;
+
+		if (OnlyStates && !OnlyStates->Contains(StateName))
+		{
+			continue;
+		}
+
+		StateNode->NodePosX = Layer * UnrealClaudeConstants::AnimDiagram::StateGridSpacingX;
+		StateNode->NodePosY = Row * UnrealClaudeConstants::AnimDiagram::StateGridSpacingY;
+		RepositionedCount++;
+	}
+
+	// Re-centre transitions between their (possibly moved) endpoints
+	for (UAnimStateTransitionNode* Trans : TransitionNodes)
+	{
+		UAnimStateNodeBase* Prev = Trans ? Trans->GetPreviousState() : nullptr;
+		UAnimStateNodeBase* Next = Trans ? Trans->GetNextState() : nullptr;
+		if (Prev && Next)
+		{
+			Trans->NodePosX = (Prev->NodePosX + Next->NodePosX) / 2;
+			Trans->NodePosY = (Prev->NodePosY + Next->NodePosY) / 2;
+		}
+	}
+
+	SMGraph->Modify();
+
+	return RepositionedCount;
+}
+
 // ===== State Management =====
 
 UAnimStateNode* FAnimStateMachineEditor::AddState(
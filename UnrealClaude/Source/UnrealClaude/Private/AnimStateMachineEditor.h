@@ -98,6 +98,27 @@ public:
 		FString& OutError
 	);
 
+	/**
+	 * Deferred layout pass over a finished state machine graph
+	 *
+	 * Generated machines create their states position-less and call this once
+	 * at the end instead of interleaving placement math with graph mutation.
+	 * States are arranged in layers by transition depth from the entry state
+	 * (unreachable states trail in extra columns) and each transition node is
+	 * re-centred between its endpoints.
+	 *
+	 * @param StateMachine - State machine to lay out
+	 * @param OnlyStates - When non-null, reposition just these states (lets
+	 *                     explicitly placed states keep their coordinates)
+	 * @param OutError - Error message if the graph could not be resolved
+	 * @return Number of state nodes repositioned, or -1 on error
+	 */
+	static int32 LayoutStateMachine(
+		UAnimGraphNode_StateMachine* StateMachine,
+		const TSet<FString>* OnlyStates,
+		FString& OutError
+	);
+
 	// ===== State Management =====
 
 	/**
@@ -18,6 +18,18 @@
 #include "EdGraphSchema_K2.h"
 #include "Kismet/KismetMathLibrary.h"
 
+namespace
+{
+	/** Template key for a condition subgraph shape: the operator and operand
+	 *  pin type decide which nodes get built, the variable does not (it is
+	 *  rebound on every stamp) */
+	FString MakeChainPatternKey(const FString& ComparisonType, EComparisonPinType PinType, bool bIsBoolean)
+	{
+		return FString::Printf(TEXT("%s|%d|%d"),
+			*ComparisonType.ToLower(), static_cast<int32>(PinType), bIsBoolean ? 1 : 0);
+	}
+}
+
 UEdGraphNode* FAnimTransitionConditionFactory::CreateTransitionConditionNode(
 	UEdGraph* TransitionGraph,
 	const FString& NodeType,
@@ -294,7 +306,8 @@ TSharedPtr<FJsonObject> FAnimTransitionConditionFactory::CreateComparisonChain(
 	const FString& ComparisonType,
 	const FString& CompareValue,
 	FVector2D Position,
-	FString& OutError)
+	FString& OutError,
+	FConditionChainCache* Cache)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 
@@ -310,65 +323,105 @@ TSharedPtr<FJsonObject> FAnimTransitionConditionFactory::CreateComparisonChain(
 		return MakeErrorResult(OutError);
 	}
 
-	// Step 1: Create GetVariable node
-	UEdGraphNode* GetVarNode = CreateVariableGetNode(TransitionGraph, AnimBP, VariableName, Position, OutError);
-	if (!GetVarNode)
+	// Check for a prior resolution of this variable within the same bulk call
+	const FConditionChainCache::FResolvedVariable* CachedVar =
+		Cache ? Cache->Variables.Find(VariableName) : nullptr;
+	if (CachedVar && !CachedVar->bFound)
 	{
+		// Fail fast without re-walking the class property list per transition
+		OutError = FString::Printf(TEXT("Variable '%s' not found in AnimBlueprint"), *VariableName);
 		return MakeErrorResult(OutError);
 	}
-	FString GetVarNodeId = FAnimGraphEditor::GenerateAnimNodeId(TEXT("GetVar"), VariableName, TransitionGraph);
-	FAnimGraphEditor::SetNodeId(GetVarNode, GetVarNodeId);
-	GetVarNode->AllocateDefaultPins();
 
-	// Find variable output pin and determine type
-	auto VarOutputConfig = FPinSearchConfig::Output({}).AcceptAny();
-	UEdGraphPin* VarOutputPin = FAnimNodePinUtils::FindPinWithFallbacks(GetVarNode, VarOutputConfig);
-
-	// Detect pin type for proper comparison node creation
-	bool bIsBooleanVariable = false;
-	EComparisonPinType PinType = EComparisonPinType::Float;
+	bool bIsBooleanVariable = CachedVar ? CachedVar->bIsBoolean : false;
+	EComparisonPinType PinType = CachedVar ? CachedVar->PinType : EComparisonPinType::Float;
 
-	if (VarOutputPin)
+	// Stamped path: the same expression shape (operator + operand type) was
+	// already built once during this bulk call, so the subgraph is cloned from
+	// the first-built chain with just the variable reference rebound, instead
+	// of re-running node construction and schema pin allocation per transition
+	UEdGraphNode* GetVarNode = nullptr;
+	UEdGraphNode* CompNode = nullptr;
+	bool bStamped = false;
+	if (Cache && CachedVar)
 	{
-		if (VarOutputPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean)
+		const FString PatternKey = MakeChainPatternKey(ComparisonType, PinType, bIsBooleanVariable);
+		if (const FConditionChainCache::FChainTemplate* Template = Cache->Templates.Find(PatternKey))
 		{
-			bIsBooleanVariable = true;
-			PinType = EComparisonPinType::Boolean;
-		}
-		else if (VarOutputPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Int)
-		{
-			PinType = EComparisonPinType::Integer;
+			bStamped = StampChainFromTemplate(TransitionGraph, *Template, VariableName, Position, GetVarNode, CompNode);
+			if (!bStamped)
+			{
+				// Prototype nodes are gone (graph rebuilt underneath the cache);
+				// drop the entry so the rebuild below re-registers the pattern
+				Cache->Templates.Remove(PatternKey);
+			}
 		}
-		else if (VarOutputPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Byte)
+	}
+
+	if (!bStamped)
+	{
+		// Step 1: Create GetVariable node
+		GetVarNode = CreateVariableGetNode(
+			TransitionGraph, AnimBP, VariableName, Position, OutError, /*bSkipPropertyLookup*/ CachedVar != nullptr);
+		if (!GetVarNode)
 		{
-			// Check if it's an enum
-			if (VarOutputPin->PinType.PinSubCategoryObject.IsValid())
+			if (Cache)
 			{
-				PinType = EComparisonPinType::Enum;
+				Cache->Variables.Add(VariableName, FConditionChainCache::FResolvedVariable());
 			}
-			else
+			return MakeErrorResult(OutError);
+		}
+		GetVarNode->AllocateDefaultPins();
+
+		// Detect pin type for proper comparison node creation
+		if (!CachedVar)
+		{
+			auto DetectConfig = FPinSearchConfig::Output({}).AcceptAny();
+			if (UEdGraphPin* DetectPin = FAnimNodePinUtils::FindPinWithFallbacks(GetVarNode, DetectConfig))
 			{
-				PinType = EComparisonPinType::Byte;
+				PinType = DetectComparisonTypeFromPin(DetectPin);
+				bIsBooleanVariable = (PinType == EComparisonPinType::Boolean);
 			}
 		}
-		else if (VarOutputPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Enum)
+
+		if (Cache && !CachedVar)
 		{
-			PinType = EComparisonPinType::Enum;
+			FConditionChainCache::FResolvedVariable Resolved;
+			Resolved.bFound = true;
+			Resolved.bIsBoolean = bIsBooleanVariable;
+			Resolved.PinType = PinType;
+			Cache->Variables.Add(VariableName, Resolved);
 		}
-		// Float/Double remains the default
-	}
 
-	// Step 2: Create Comparison node with appropriate type
-	FVector2D CompPos(Position.X + 200, Position.Y);
-	TSharedPtr<FJsonObject> CompParams = MakeShared<FJsonObject>();
-	UEdGraphNode* CompNode = CreateComparisonNode(TransitionGraph, ComparisonType, CompParams, CompPos, OutError, bIsBooleanVariable, PinType);
-	if (!CompNode)
-	{
-		return MakeErrorResult(OutError);
+		// Step 2: Create Comparison node with appropriate type
+		FVector2D CompPos(Position.X + 200, Position.Y);
+		TSharedPtr<FJsonObject> CompParams = MakeShared<FJsonObject>();
+		CompNode = CreateComparisonNode(TransitionGraph, ComparisonType, CompParams, CompPos, OutError, bIsBooleanVariable, PinType);
+		if (!CompNode)
+		{
+			return MakeErrorResult(OutError);
+		}
+
+		// The first build of this shape during the bulk call becomes the
+		// template later transitions stamp from
+		if (Cache)
+		{
+			FConditionChainCache::FChainTemplate Template;
+			Template.VarNode = GetVarNode;
+			Template.CompNode = CompNode;
+			Cache->Templates.Add(MakeChainPatternKey(ComparisonType, PinType, bIsBooleanVariable), Template);
+		}
 	}
+
+	FString GetVarNodeId = FAnimGraphEditor::GenerateAnimNodeId(TEXT("GetVar"), VariableName, TransitionGraph);
+	FAnimGraphEditor::SetNodeId(GetVarNode, GetVarNodeId);
 	FString CompNodeId = FAnimGraphEditor::GenerateAnimNodeId(TEXT("Comp"), ComparisonType, TransitionGraph);
 	FAnimGraphEditor::SetNodeId(CompNode, CompNodeId);
 
+	// Find variable output pin (needed for linking however the chain was made)
+	auto VarOutputConfig = FPinSearchConfig::Output({}).AcceptAny();
+	UEdGraphPin* VarOutputPin = FAnimNodePinUtils::FindPinWithFallbacks(GetVarNode, VarOutputConfig);
+
 	// Step 3: Connect variable to comparison input A
 	auto CompInputConfig = FPinSearchConfig::Input({ FName("A") }).AcceptAny();
 	UEdGraphPin* CompInputA = FAnimNodePinUtils::FindPinWithFallbacks(CompNode, CompInputConfig);
@@ -457,6 +510,7 @@ TSharedPtr<FJsonObject> FAnimTransitionConditionFactory::CreateComparisonChain(
 	Result->SetStringField(TEXT("variable_node_id"), GetVarNodeId);
 	Result->SetStringField(TEXT("comparison_node_id"), CompNodeId);
 	Result->SetBoolField(TEXT("chained_with_existing"), !AndNodeId.IsEmpty());
+	Result->SetBoolField(TEXT("stamped_from_template"), bStamped);
 	if (!AndNodeId.IsEmpty())
 	{
 		Result->SetStringField(TEXT("and_node_id"), AndNodeId);
@@ -470,6 +524,80 @@ TSharedPtr<FJsonObject> FAnimTransitionConditionFactory::CreateComparisonChain(
 
 // ===== Private Helpers =====
 
+bool FAnimTransitionConditionFactory::StampChainFromTemplate(
+	UEdGraph* Graph,
+	const FConditionChainCache::FChainTemplate& Template,
+	const FString& VariableName,
+	FVector2D Position,
+	UEdGraphNode*& OutVarNode,
+	UEdGraphNode*& OutCompNode)
+{
+	UEdGraphNode* VarPrototype = Template.VarNode.Get();
+	UEdGraphNode* CompPrototype = Template.CompNode.Get();
+	if (!Graph || !VarPrototype || !CompPrototype)
+	{
+		return false;
+	}
+
+	auto StampNode = [Graph](UEdGraphNode* Prototype, FVector2D Pos) -> UEdGraphNode*
+	{
+		UEdGraphNode* Clone = DuplicateObject<UEdGraphNode>(Prototype, Graph);
+		if (!Clone)
+		{
+			return nullptr;
+		}
+		Clone->CreateNewGuid();
+		Clone->NodePosX = static_cast<int32>(Pos.X);
+		Clone->NodePosY = static_cast<int32>(Pos.Y);
+		// Node IDs ride the comment; the clone gets its own from the caller
+		Clone->NodeComment.Empty();
+		// Cloned pins still reference the prototype's neighbours, and cloned
+		// defaults carry the first chain's compare value - neither may
+		// survive the stamp (the caller rewires and sets the value)
+		for (UEdGraphPin* Pin : Clone->Pins)
+		{
+			Pin->LinkedTo.Reset();
+			Pin->DefaultValue.Empty();
+		}
+		Graph->AddNode(Clone, false, false);
+		return Clone;
+	};
+
+	UEdGraphNode* VarClone = StampNode(VarPrototype, Position);
+	UEdGraphNode* CompClone = StampNode(CompPrototype, FVector2D(Position.X + 200, Position.Y));
+	if (!VarClone || !CompClone)
+	{
+		if (VarClone)
+		{
+			Graph->RemoveNode(VarClone);
+		}
+		if (CompClone)
+		{
+			Graph->RemoveNode(CompClone);
+		}
+		return false;
+	}
+
+	// Rebind the getter to this transition's variable. The value pin of a
+	// variable getter is named after the variable, so the pin renames with it.
+	if (UK2Node_VariableGet* VarGet = Cast<UK2Node_VariableGet>(VarClone))
+	{
+		const FName OldVarName = VarGet->VariableReference.GetMemberName();
+		VarGet->VariableReference.SetSelfMember(FName(*VariableName));
+		for (UEdGraphPin* Pin : VarGet->Pins)
+		{
+			if (Pin->Direction == EGPD_Output && Pin->PinName == OldVarName)
+			{
+				Pin->PinName = FName(*VariableName);
+			}
+		}
+	}
+
+	OutVarNode = VarClone;
+	OutCompNode = CompClone;
+	return true;
+}
+
 UEdGraphNode* FAnimTransitionConditionFactory::CreateTimeRemainingNode(
 	UEdGraph* Graph,
 	const TSharedPtr<FJsonObject>& Params,
@@ -732,7 +860,8 @@ UEdGraphNode* FAnimTransitionConditionFactory::CreateVariableGetNode(
 	UAnimBlueprint* AnimBP,
 	const FString& VariableName,
 	FVector2D Position,
-	FString& OutError)
+	FString& OutError,
+	bool bSkipPropertyLookup)
 {
 	if (!Graph || !AnimBP)
 	{
@@ -740,16 +869,19 @@ UEdGraphNode* FAnimTransitionConditionFactory::CreateVariableGetNode(
 		return nullptr;
 	}
 
-	FProperty* Property = FindFProperty<FProperty>(AnimBP->GeneratedClass, *VariableName);
-	if (!Property)
+	if (!bSkipPropertyLookup)
 	{
-		Property = FindFProperty<FProperty>(AnimBP->SkeletonGeneratedClass, *VariableName);
-	}
+		FProperty* Property = FindFProperty<FProperty>(AnimBP->GeneratedClass, *VariableName);
+		if (!Property)
+		{
+			Property = FindFProperty<FProperty>(AnimBP->SkeletonGeneratedClass, *VariableName);
+		}
 
-	if (!Property)
-	{
-		OutError = FString::Printf(TEXT("Variable '%s' not found in AnimBlueprint"), *VariableName);
-		return nullptr;
+		if (!Property)
+		{
+			OutError = FString::Printf(TEXT("Variable '%s' not found in AnimBlueprint"), *VariableName);
+			return nullptr;
+		}
 	}
 
 	UK2Node_VariableGet* VarNode = NewObject<UK2Node_VariableGet>(Graph);
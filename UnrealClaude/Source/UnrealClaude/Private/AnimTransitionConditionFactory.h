@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 class UAnimBlueprint;
 class UEdGraph;
@@ -39,6 +40,56 @@ enum class EComparisonPinType : uint8
 class UNREALCLAUDE_API FAnimTransitionConditionFactory
 {
 public:
+	/**
+	 * Per-bulk-operation cache of resolved condition shapes
+	 *
+	 * SetupTransitionConditions applies the same handful of condition specs
+	 * ("Speed > X", "bIsFalling == true") across every matched transition, and
+	 * resolving the variable property and its comparison pin type is identical
+	 * each time - as is the node subgraph the spec expands to, which is kept
+	 * as a stampable template per expression pattern. Callers construct one
+	 * cache per bulk call and pass it through CreateComparisonChain, so
+	 * entries can never outlive a blueprint recompile.
+	 */
+	struct FConditionChainCache
+	{
+		struct FResolvedVariable
+		{
+			/** Whether the variable exists on the blueprint at all */
+			bool bFound = false;
+
+			/** Whether the variable is boolean (changes comparison node wiring) */
+			bool bIsBoolean = false;
+
+			/** Pin type driving comparison function selection */
+			EComparisonPinType PinType = EComparisonPinType::Float;
+		};
+
+		/** Resolved variable shapes keyed by variable name */
+		TMap<FString, FResolvedVariable> Variables;
+
+		/**
+		 * One already-built condition subgraph shape, reusable across
+		 * transitions within the same bulk call. The prototype nodes live in
+		 * the first transition graph that built the pattern; later transitions
+		 * stamp duplicates of them instead of re-running node construction and
+		 * schema pin allocation, with the variable reference rebound on the
+		 * stamped getter.
+		 */
+		struct FChainTemplate
+		{
+			/** Variable getter of the first-built chain */
+			TWeakObjectPtr<UEdGraphNode> VarNode;
+
+			/** Comparison node of the first-built chain */
+			TWeakObjectPtr<UEdGraphNode> CompNode;
+		};
+
+		/** Built chain shapes keyed by expression pattern (comparison operator
+		 *  plus operand pin type - the variable itself is rebound per stamp) */
+		TMap<FString, FChainTemplate> Templates;
+	};
+
 	/**
 	 * Create a transition condition node
 	 *
@@ -106,6 +157,8 @@ public:
 	 * @param CompareValue Value to compare against
 	 * @param Position Node position
 	 * @param OutError Error message if failed
+	 * @param Cache Optional per-bulk-operation cache; skips variable lookup and
+	 *              pin type detection when the same variable was already resolved
 	 * @return JSON result with node IDs
 	 */
 	static TSharedPtr<FJsonObject> CreateComparisonChain(
@@ -115,7 +168,8 @@ public:
 		const FString& ComparisonType,
 		const FString& CompareValue,
 		FVector2D Position,
-		FString& OutError
+		FString& OutError,
+		FConditionChainCache* Cache = nullptr
 	);
 
 private:
@@ -146,13 +200,31 @@ private:
 		FString& OutError
 	);
 
-	/** Create variable getter node */
+	/**
+	 * Duplicate a cached chain template into the target graph: clone the
+	 * getter and comparison nodes, clear the cloned links and defaults (the
+	 * caller rewires and sets the compare value), and rebind the getter to
+	 * the requested variable.
+	 * @return false when the prototype nodes are gone (caller falls back to
+	 *         plain construction and re-registers the pattern)
+	 */
+	static bool StampChainFromTemplate(
+		UEdGraph* Graph,
+		const FConditionChainCache::FChainTemplate& Template,
+		const FString& VariableName,
+		FVector2D Position,
+		UEdGraphNode*& OutVarNode,
+		UEdGraphNode*& OutCompNode
+	);
+
+	/** Create variable getter node; bSkipPropertyLookup trusts a cached resolution */
 	static UEdGraphNode* CreateVariableGetNode(
 		UEdGraph* Graph,
 		UAnimBlueprint* AnimBP,
 		const FString& VariableName,
 		FVector2D Position,
-		FString& OutError
+		FString& OutError,
+		bool bSkipPropertyLookup = false
 	);
 
 	// ===== Pin Type Auto-Detection Helpers =====
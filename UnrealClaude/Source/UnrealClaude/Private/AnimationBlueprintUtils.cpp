@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "AnimationBlueprintUtils.h"
+#include "BlueprintLoader.h"
 #include "UnrealClaudeConstants.h"
 #include "AnimTransitionConditionFactory.h"
 #include "Animation/AnimBlueprint.h"
@@ -20,6 +21,7 @@
 #include "Kismet2/KismetEditorUtilities.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/SavePackage.h"
 #include "Internationalization/Regex.h"
 
@@ -33,6 +35,14 @@ UAnimBlueprint* FAnimationBlueprintUtils::LoadAnimBlueprint(const FString& Bluep
 		return nullptr;
 	}
 
+	// Go through the shared resolution cache first so anim tools reuse the
+	// same path -> weak handle entries as the generic blueprint tools
+	FString LoadError;
+	if (UAnimBlueprint* CachedAnimBP = Cast<UAnimBlueprint>(FBlueprintLoader::LoadBlueprint(BlueprintPath, LoadError)))
+	{
+		return CachedAnimBP;
+	}
+
 	// Try to load the asset
 	UObject* LoadedAsset = StaticLoadObject(UAnimBlueprint::StaticClass(), nullptr, *BlueprintPath);
 
@@ -73,6 +83,66 @@ bool FAnimationBlueprintUtils::IsAnimationBlueprint(UBlueprint* Blueprint)
 	return Blueprint && Blueprint->IsA<UAnimBlueprint>();
 }
 
+bool FAnimationBlueprintUtils::bDeferCompiles = false;
+
+namespace
+{
+	/**
+	 * Hash the structural shape of a blueprint's graphs: nodes, their classes
+	 * and how their pins are wired. Data-level values (pin defaults, blend
+	 * durations, priorities) deliberately do not contribute, so a data-only
+	 * tweak produces the same hash as the last compile.
+	 */
+	uint32 ComputeGraphStructureHash(UAnimBlueprint* AnimBP)
+	{
+		uint32 Hash = 0;
+
+		TArray<UEdGraph*> AllGraphs;
+		AnimBP->GetAllGraphs(AllGraphs);
+
+		for (UEdGraph* Graph : AllGraphs)
+		{
+			if (!Graph)
+			{
+				continue;
+			}
+			Hash = HashCombine(Hash, GetTypeHash(Graph->GetFName()));
+
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node)
+				{
+					continue;
+				}
+				Hash = HashCombine(Hash, GetTypeHash(Node->NodeGuid));
+				Hash = HashCombine(Hash, GetTypeHash(Node->GetClass()->GetFName()));
+
+				for (UEdGraphPin* Pin : Node->Pins)
+				{
+					if (!Pin)
+					{
+						continue;
+					}
+					Hash = HashCombine(Hash, GetTypeHash(Pin->PinName));
+					for (UEdGraphPin* Linked : Pin->LinkedTo)
+					{
+						if (Linked && Linked->GetOwningNode())
+						{
+							Hash = HashCombine(Hash, GetTypeHash(Linked->GetOwningNode()->NodeGuid));
+							Hash = HashCombine(Hash, GetTypeHash(Linked->PinName));
+						}
+					}
+				}
+			}
+		}
+
+		return Hash;
+	}
+
+	/** Structural hash per blueprint as of its last compile through here */
+	TMap<TWeakObjectPtr<UAnimBlueprint>, uint32> LastCompiledStructureHashes;
+}
+
 bool FAnimationBlueprintUtils::CompileAnimBlueprint(UAnimBlueprint* AnimBP, FString& OutError)
 {
 	if (!AnimBP)
@@ -81,21 +151,76 @@ bool FAnimationBlueprintUtils::CompileAnimBlueprint(UAnimBlueprint* AnimBP, FStr
 		return false;
 	}
 
-	FKismetEditorUtilities::CompileBlueprint(AnimBP);
+	// Inside a deferred-compile scope the mutation is recorded but the
+	// expensive anim compile (and save) waits for the explicit compile call
+	if (bDeferCompiles)
+	{
+		MarkAnimBlueprintModified(AnimBP);
+		return true;
+	}
+
+	// The blocking path runs the same phases the sliced path stages
+	if (!RunAnimCompilePhase(AnimBP, ComputeCompileStructureHash(AnimBP), OutError))
+	{
+		return false;
+	}
+
+	SaveCompiledAnimBlueprint(AnimBP);
+	return true;
+}
+
+uint32 FAnimationBlueprintUtils::ComputeCompileStructureHash(UAnimBlueprint* AnimBP)
+{
+	return AnimBP ? ComputeGraphStructureHash(AnimBP) : 0;
+}
+
+bool FAnimationBlueprintUtils::RunAnimCompilePhase(UAnimBlueprint* AnimBP, uint32 StructureHash, FString& OutError)
+{
+	if (!AnimBP)
+	{
+		OutError = TEXT("AnimBlueprint is null");
+		return false;
+	}
+
+	// When only data-level properties changed since the last compile the
+	// skeleton class is still valid, so downgrade to a compile that skips
+	// skeleton regeneration; structural edits get the full pipeline
+	const uint32* LastHash = LastCompiledStructureHashes.Find(AnimBP);
+	const bool bStructureUnchanged = (LastHash != nullptr && *LastHash == StructureHash);
+
+	if (bStructureUnchanged)
+	{
+		FKismetEditorUtilities::CompileBlueprint(AnimBP, EBlueprintCompileOptions::SkeletonUpToDate);
+	}
+	else
+	{
+		FKismetEditorUtilities::CompileBlueprint(AnimBP);
+	}
 
 	if (AnimBP->Status == BS_Error)
 	{
 		OutError = TEXT("Animation Blueprint compilation failed with errors");
+		LastCompiledStructureHashes.Remove(AnimBP);
+		return false;
+	}
+
+	LastCompiledStructureHashes.Add(AnimBP, StructureHash);
+	return true;
+}
+
+bool FAnimationBlueprintUtils::SaveCompiledAnimBlueprint(UAnimBlueprint* AnimBP)
+{
+	if (!AnimBP)
+	{
 		return false;
 	}
 
-	// Auto-save after successful compile
 	FString AssetPath = AnimBP->GetPathName();
 	if (!UEditorAssetLibrary::SaveAsset(AssetPath, false))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("CompileAnimBlueprint: Failed to auto-save asset %s"), *AssetPath);
+		return false;
 	}
-
 	return true;
 }
 
@@ -675,6 +800,56 @@ bool FAnimationBlueprintUtils::SetStateBlendSpace1D(
 	return bResult;
 }
 
+TSharedPtr<FJsonObject> FAnimationBlueprintUtils::AssignStateAnimations(
+	UAnimBlueprint* AnimBP,
+	const FString& StateMachineName,
+	const TMap<FString, FString>& StateToAssetPath,
+	FString& OutError)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+
+	if (!ValidateAnimBlueprintForOperation(AnimBP, OutError))
+	{
+		Result->SetBoolField(TEXT("success"), false);
+		Result->SetStringField(TEXT("error"), OutError);
+		return Result;
+	}
+
+	if (StateToAssetPath.Num() == 0)
+	{
+		OutError = TEXT("No state animations provided");
+		Result->SetBoolField(TEXT("success"), false);
+		Result->SetStringField(TEXT("error"), OutError);
+		return Result;
+	}
+
+	TMap<FString, FString> PerStateErrors;
+	const int32 AssignedCount = FAnimAssetManager::AssignStateAnimations(
+		AnimBP, StateMachineName, StateToAssetPath, PerStateErrors);
+
+	// One dirty-mark for the whole batch; the caller compiles once
+	if (AssignedCount > 0)
+	{
+		MarkAnimBlueprintModified(AnimBP);
+	}
+
+	Result->SetBoolField(TEXT("success"), PerStateErrors.Num() == 0);
+	Result->SetNumberField(TEXT("assigned"), AssignedCount);
+	Result->SetNumberField(TEXT("requested"), StateToAssetPath.Num());
+
+	if (PerStateErrors.Num() > 0)
+	{
+		TSharedPtr<FJsonObject> ErrorsObj = MakeShared<FJsonObject>();
+		for (const auto& Pair : PerStateErrors)
+		{
+			ErrorsObj->SetStringField(Pair.Key, Pair.Value);
+		}
+		Result->SetObjectField(TEXT("failed_states"), ErrorsObj);
+	}
+
+	return Result;
+}
+
 bool FAnimationBlueprintUtils::SetStateMontage(
 	UAnimBlueprint* AnimBP,
 	const FString& StateMachineName,
@@ -815,12 +990,14 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::SerializeTransitionInfo(UAnimS
 TSharedPtr<FJsonObject> FAnimationBlueprintUtils::ExecuteBatchOperations(
 	UAnimBlueprint* AnimBP,
 	const TArray<TSharedPtr<FJsonValue>>& Operations,
-	FString& OutError)
+	FString& OutError,
+	const FMCPCancellationToken& CancelToken)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 	TArray<TSharedPtr<FJsonValue>> ResultsArray;
 	int32 SuccessCount = 0;
 	int32 FailureCount = 0;
+	bool bCancelled = false;
 
 	if (!ValidateAnimBlueprintForOperation(AnimBP, OutError))
 	{
@@ -831,6 +1008,15 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::ExecuteBatchOperations(
 
 	for (const TSharedPtr<FJsonValue>& OpValue : Operations)
 	{
+		// Operation boundaries are the cancellation checkpoints: a single
+		// operation always finishes (the graph stays consistent), but a
+		// cancelled batch stops here with whatever it has already applied
+		if (CancelToken.IsCancelled())
+		{
+			bCancelled = true;
+			break;
+		}
+
 		TSharedPtr<FJsonObject> OpResult = MakeShared<FJsonObject>();
 		const TSharedPtr<FJsonObject>* OpObj;
 
@@ -1086,11 +1272,12 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::ExecuteBatchOperations(
 		ResultsArray.Add(MakeShared<FJsonValueObject>(OpResult));
 	}
 
-	// Compile after all operations
+	// Compile after all operations - including a cancelled prefix, so the
+	// operations that did apply are left in a compiled, consistent state
 	FString CompileError;
 	bool bCompiled = CompileAnimBlueprint(AnimBP, CompileError);
 
-	Result->SetBoolField(TEXT("success"), FailureCount == 0 && bCompiled);
+	Result->SetBoolField(TEXT("success"), FailureCount == 0 && bCompiled && !bCancelled);
 	Result->SetNumberField(TEXT("success_count"), SuccessCount);
 	Result->SetNumberField(TEXT("failure_count"), FailureCount);
 	Result->SetBoolField(TEXT("compiled"), bCompiled);
@@ -1098,11 +1285,241 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::ExecuteBatchOperations(
 	{
 		Result->SetStringField(TEXT("compile_error"), CompileError);
 	}
+	if (bCancelled)
+	{
+		Result->SetBoolField(TEXT("cancelled"), true);
+		Result->SetNumberField(TEXT("operations_skipped"), Operations.Num() - ResultsArray.Num());
+	}
 	Result->SetArrayField(TEXT("results"), ResultsArray);
 
 	return Result;
 }
 
+TSharedPtr<FJsonObject> FAnimationBlueprintUtils::BuildStateMachine(
+	UAnimBlueprint* AnimBP,
+	const FString& StateMachineName,
+	const TArray<TSharedPtr<FJsonValue>>& States,
+	const TArray<TSharedPtr<FJsonValue>>& Transitions,
+	const FString& EntryState,
+	FString& OutError)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+
+	if (!ValidateAnimBlueprintForOperation(AnimBP, OutError))
+	{
+		Result->SetBoolField(TEXT("success"), false);
+		Result->SetStringField(TEXT("error"), OutError);
+		return Result;
+	}
+
+	if (StateMachineName.IsEmpty())
+	{
+		OutError = TEXT("State machine name is required");
+		Result->SetBoolField(TEXT("success"), false);
+		Result->SetStringField(TEXT("error"), OutError);
+		return Result;
+	}
+
+	// Resolve the state machine node once; every state and transition below
+	// goes through the by-node editor APIs instead of re-finding it per op
+	FString FindError;
+	UAnimGraphNode_StateMachine* SM = FAnimStateMachineEditor::FindStateMachine(
+		AnimBP, StateMachineName, FindError);
+	bool bCreatedStateMachine = false;
+
+	if (!SM)
+	{
+		FString NodeId;
+		SM = FAnimStateMachineEditor::CreateStateMachine(
+			AnimBP, StateMachineName, FVector2D(0, 0), NodeId, OutError);
+		if (!SM)
+		{
+			Result->SetBoolField(TEXT("success"), false);
+			Result->SetStringField(TEXT("error"), OutError);
+			return Result;
+		}
+		bCreatedStateMachine = true;
+	}
+
+	int32 StatesAdded = 0;
+	int32 TransitionsAdded = 0;
+	int32 FailureCount = 0;
+	TArray<TSharedPtr<FJsonValue>> StateResults;
+	TArray<TSharedPtr<FJsonValue>> TransitionResults;
+
+	// Add all states; positions omitted from the description are created at
+	// the origin and arranged by one deferred layout pass after wiring, so
+	// placement math never interleaves with graph mutation
+	TSet<FString> AutoPositionedStates;
+	for (int32 StateIndex = 0; StateIndex < States.Num(); StateIndex++)
+	{
+		TSharedPtr<FJsonObject> StateResult = MakeShared<FJsonObject>();
+		const TSharedPtr<FJsonObject>* StateObjPtr;
+
+		if (!States[StateIndex]->TryGetObject(StateObjPtr) || !StateObjPtr->IsValid())
+		{
+			StateResult->SetNumberField(TEXT("index"), StateIndex);
+			StateResult->SetBoolField(TEXT("success"), false);
+			StateResult->SetStringField(TEXT("error"), TEXT("Invalid state format - expected object with 'name'"));
+			StateResults.Add(MakeShared<FJsonValueObject>(StateResult));
+			FailureCount++;
+			continue;
+		}
+
+		const TSharedPtr<FJsonObject>& StateObj = *StateObjPtr;
+		FString StateName = StateObj->GetStringField(TEXT("name"));
+		StateResult->SetStringField(TEXT("name"), StateName);
+
+		if (StateName.IsEmpty())
+		{
+			StateResult->SetBoolField(TEXT("success"), false);
+			StateResult->SetStringField(TEXT("error"), TEXT("State missing 'name'"));
+			StateResults.Add(MakeShared<FJsonValueObject>(StateResult));
+			FailureCount++;
+			continue;
+		}
+
+		FVector2D Position = FVector2D::ZeroVector;
+		if (StateObj->HasTypedField<EJson::Number>(TEXT("x")) && StateObj->HasTypedField<EJson::Number>(TEXT("y")))
+		{
+			Position.X = StateObj->GetNumberField(TEXT("x"));
+			Position.Y = StateObj->GetNumberField(TEXT("y"));
+		}
+		else
+		{
+			AutoPositionedStates.Add(StateName);
+		}
+
+		FString NodeId;
+		FString StateError;
+		UAnimStateNode* State = FAnimStateMachineEditor::AddState(SM, StateName, Position, NodeId, StateError);
+		if (State)
+		{
+			StateResult->SetBoolField(TEXT("success"), true);
+			StateResult->SetStringField(TEXT("node_id"), NodeId);
+			StatesAdded++;
+		}
+		else
+		{
+			StateResult->SetBoolField(TEXT("success"), false);
+			StateResult->SetStringField(TEXT("error"), StateError);
+			FailureCount++;
+		}
+		StateResults.Add(MakeShared<FJsonValueObject>(StateResult));
+	}
+
+	// Wire all transitions between the now-present states
+	for (int32 TransIndex = 0; TransIndex < Transitions.Num(); TransIndex++)
+	{
+		TSharedPtr<FJsonObject> TransResult = MakeShared<FJsonObject>();
+		const TSharedPtr<FJsonObject>* TransObjPtr;
+
+		if (!Transitions[TransIndex]->TryGetObject(TransObjPtr) || !TransObjPtr->IsValid())
+		{
+			TransResult->SetNumberField(TEXT("index"), TransIndex);
+			TransResult->SetBoolField(TEXT("success"), false);
+			TransResult->SetStringField(TEXT("error"), TEXT("Invalid transition format - expected object with 'from' and 'to'"));
+			TransitionResults.Add(MakeShared<FJsonValueObject>(TransResult));
+			FailureCount++;
+			continue;
+		}
+
+		const TSharedPtr<FJsonObject>& TransObj = *TransObjPtr;
+		FString FromState = TransObj->GetStringField(TEXT("from"));
+		FString ToState = TransObj->GetStringField(TEXT("to"));
+		TransResult->SetStringField(TEXT("from"), FromState);
+		TransResult->SetStringField(TEXT("to"), ToState);
+
+		if (FromState.IsEmpty() || ToState.IsEmpty())
+		{
+			TransResult->SetBoolField(TEXT("success"), false);
+			TransResult->SetStringField(TEXT("error"), TEXT("Transition missing 'from' or 'to'"));
+			TransitionResults.Add(MakeShared<FJsonValueObject>(TransResult));
+			FailureCount++;
+			continue;
+		}
+
+		FString NodeId;
+		FString TransError;
+		UAnimStateTransitionNode* Transition = FAnimStateMachineEditor::CreateTransition(
+			SM, FromState, ToState, NodeId, TransError);
+		if (!Transition)
+		{
+			TransResult->SetBoolField(TEXT("success"), false);
+			TransResult->SetStringField(TEXT("error"), TransError);
+			TransitionResults.Add(MakeShared<FJsonValueObject>(TransResult));
+			FailureCount++;
+			continue;
+		}
+
+		if (TransObj->HasTypedField<EJson::Number>(TEXT("duration")))
+		{
+			FString DurationError;
+			FAnimStateMachineEditor::SetTransitionDuration(
+				Transition, TransObj->GetNumberField(TEXT("duration")), DurationError);
+		}
+		if (TransObj->HasTypedField<EJson::Number>(TEXT("priority")))
+		{
+			FString PriorityError;
+			FAnimStateMachineEditor::SetTransitionPriority(
+				Transition, static_cast<int32>(TransObj->GetNumberField(TEXT("priority"))), PriorityError);
+		}
+
+		TransResult->SetBoolField(TEXT("success"), true);
+		TransResult->SetStringField(TEXT("node_id"), NodeId);
+		TransitionsAdded++;
+		TransitionResults.Add(MakeShared<FJsonValueObject>(TransResult));
+	}
+
+	// Entry state last so it can reference any state added above
+	if (!EntryState.IsEmpty())
+	{
+		FString EntryError;
+		if (!FAnimStateMachineEditor::SetEntryState(SM, EntryState, EntryError))
+		{
+			Result->SetStringField(TEXT("entry_state_error"), EntryError);
+			FailureCount++;
+		}
+		else
+		{
+			Result->SetStringField(TEXT("entry_state"), EntryState);
+		}
+	}
+
+	// One deferred layout pass over the finished machine arranges the
+	// position-less states by transition depth; explicitly placed states
+	// keep their coordinates
+	if (AutoPositionedStates.Num() > 0)
+	{
+		FString LayoutError;
+		if (FAnimStateMachineEditor::LayoutStateMachine(SM, &AutoPositionedStates, LayoutError) >= 0)
+		{
+			Result->SetBoolField(TEXT("auto_layout"), true);
+		}
+	}
+
+	// One dirty-mark and one compile for the whole machine
+	MarkAnimBlueprintModified(AnimBP);
+	FString CompileError;
+	bool bCompiled = CompileAnimBlueprint(AnimBP, CompileError);
+
+	Result->SetBoolField(TEXT("success"), FailureCount == 0 && bCompiled);
+	Result->SetStringField(TEXT("state_machine"), StateMachineName);
+	Result->SetBoolField(TEXT("created_state_machine"), bCreatedStateMachine);
+	Result->SetNumberField(TEXT("states_added"), StatesAdded);
+	Result->SetNumberField(TEXT("transitions_added"), TransitionsAdded);
+	Result->SetNumberField(TEXT("failure_count"), FailureCount);
+	Result->SetBoolField(TEXT("compiled"), bCompiled);
+	if (!bCompiled)
+	{
+		Result->SetStringField(TEXT("compile_error"), CompileError);
+	}
+	Result->SetArrayField(TEXT("states"), StateResults);
+	Result->SetArrayField(TEXT("transitions"), TransitionResults);
+
+	return Result;
+}
+
 // ===== New Operations for MCP Tool Enhancements =====
 
 TSharedPtr<FJsonObject> FAnimationBlueprintUtils::GetTransitionNodes(
@@ -1251,6 +1668,42 @@ bool FAnimationBlueprintUtils::SetPinDefaultValue(
 	return bResult;
 }
 
+int32 FAnimationBlueprintUtils::SetPinDefaultValues(
+	UAnimBlueprint* AnimBP,
+	const FString& StateMachineName,
+	const FString& FromState,
+	const FString& ToState,
+	const TArray<FPinDefaultAssignment>& Assignments,
+	TArray<FString>& OutErrors)
+{
+	FString ResolveError;
+	if (!ValidateAnimBlueprintForOperation(AnimBP, ResolveError))
+	{
+		OutErrors.Add(ResolveError);
+		return -1;
+	}
+
+	// Resolve the transition graph once for the whole batch
+	UEdGraph* TransitionGraph = FAnimGraphEditor::FindTransitionGraph(
+		AnimBP, StateMachineName, FromState, ToState, ResolveError);
+
+	if (!TransitionGraph)
+	{
+		OutErrors.Add(ResolveError);
+		return -1;
+	}
+
+	const int32 AppliedCount = FAnimGraphEditor::SetPinDefaultValuesWithValidation(
+		TransitionGraph, Assignments, OutErrors);
+
+	if (AppliedCount > 0)
+	{
+		MarkAnimBlueprintModified(AnimBP);
+	}
+
+	return AppliedCount;
+}
+
 TSharedPtr<FJsonObject> FAnimationBlueprintUtils::AddComparisonChain(
 	UAnimBlueprint* AnimBP,
 	const FString& StateMachineName,
@@ -1415,99 +1868,131 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::ValidateBlueprint(
 
 // ===== Bulk Transition Condition Setup =====
 
-bool FAnimationBlueprintUtils::MatchesWildcard(const FString& StateName, const FString& Pattern)
+FAnimationBlueprintUtils::FCompiledPattern FAnimationBlueprintUtils::FCompiledPattern::Compile(const FString& Pattern)
 {
-	// "*" matches anything
-	if (Pattern == TEXT("*"))
+	FCompiledPattern Compiled;
+
+	// Check if pattern looks like regex (starts with ^ or contains special chars)
+	const bool bIsRegex = Pattern.StartsWith(TEXT("^")) || Pattern.EndsWith(TEXT("$")) ||
+		Pattern.Contains(TEXT("\\d")) || Pattern.Contains(TEXT("\\w")) ||
+		Pattern.Contains(TEXT("[")) || Pattern.Contains(TEXT("+")) ||
+		Pattern.Contains(TEXT("?")) || (Pattern.Contains(TEXT(".")) && Pattern.Contains(TEXT("*")));
+	if (bIsRegex)
 	{
-		return true;
+		Compiled.Regex = MakeShared<FRegexPattern>(Pattern);
 	}
 
-	// "Attack_*" matches "Attack_1H_1", "Attack_2H_2", etc.
-	if (Pattern.EndsWith(TEXT("*")))
+	// Classify the wildcard shape; bounded-both-ends must win over the
+	// single-ended checks or "*Combat*" would degrade to a prefix test
+	if (Pattern == TEXT("*"))
 	{
-		FString Prefix = Pattern.Left(Pattern.Len() - 1);
-		return StateName.StartsWith(Prefix);
+		Compiled.WildcardKind = EWildcardKind::MatchAll;
 	}
-
-	// "*_Idle" matches "Sword_Idle", "Axe_Idle", etc.
-	if (Pattern.StartsWith(TEXT("*")))
+	else if (Pattern.StartsWith(TEXT("*")) && Pattern.EndsWith(TEXT("*")))
 	{
-		FString Suffix = Pattern.Right(Pattern.Len() - 1);
-		return StateName.EndsWith(Suffix);
+		// "*Combat*" matches "InCombatIdle", "CombatRun", etc.
+		Compiled.WildcardKind = EWildcardKind::Contains;
+		Compiled.Token = Pattern.Mid(1, Pattern.Len() - 2);
 	}
-
-	// "*Combat*" matches "InCombatIdle", "CombatRun", etc.
-	if (Pattern.StartsWith(TEXT("*")) && Pattern.EndsWith(TEXT("*")))
+	else if (Pattern.EndsWith(TEXT("*")))
+	{
+		// "Attack_*" matches "Attack_1H_1", "Attack_2H_2", etc.
+		Compiled.WildcardKind = EWildcardKind::Prefix;
+		Compiled.Token = Pattern.Left(Pattern.Len() - 1);
+	}
+	else if (Pattern.StartsWith(TEXT("*")))
 	{
-		FString Middle = Pattern.Mid(1, Pattern.Len() - 2);
-		return StateName.Contains(Middle);
+		// "*_Idle" matches "Sword_Idle", "Axe_Idle", etc.
+		Compiled.WildcardKind = EWildcardKind::Suffix;
+		Compiled.Token = Pattern.Right(Pattern.Len() - 1);
+	}
+	else
+	{
+		Compiled.WildcardKind = EWildcardKind::Exact;
+		Compiled.Token = Pattern;
 	}
 
-	// Exact match
-	return StateName.Equals(Pattern, ESearchCase::IgnoreCase);
+	return Compiled;
 }
 
-bool FAnimationBlueprintUtils::MatchesRegex(const FString& StateName, const FString& Pattern)
+bool FAnimationBlueprintUtils::FCompiledPattern::Matches(const FString& StateName) const
 {
-	// Check if pattern looks like regex (starts with ^ or contains special chars)
-	bool bIsRegex = Pattern.StartsWith(TEXT("^")) || Pattern.EndsWith(TEXT("$")) ||
-		Pattern.Contains(TEXT("\\d")) || Pattern.Contains(TEXT("\\w")) ||
-		Pattern.Contains(TEXT("[")) || Pattern.Contains(TEXT("+")) ||
-		Pattern.Contains(TEXT("?")) || (Pattern.Contains(TEXT(".")) && Pattern.Contains(TEXT("*")));
-
-	if (!bIsRegex)
+	// Regex first, falling back to the wildcard form (historical behavior)
+	if (Regex.IsValid())
 	{
-		return false;
+		FRegexMatcher Matcher(*Regex, StateName);
+		if (Matcher.FindNext())
+		{
+			return true;
+		}
 	}
 
-	FRegexPattern RegexPattern(Pattern);
-	FRegexMatcher Matcher(RegexPattern, StateName);
-	return Matcher.FindNext();
+	switch (WildcardKind)
+	{
+	case EWildcardKind::MatchAll:
+		return true;
+	case EWildcardKind::Contains:
+		return StateName.Contains(Token);
+	case EWildcardKind::Prefix:
+		return StateName.StartsWith(Token);
+	case EWildcardKind::Suffix:
+		return StateName.EndsWith(Token);
+	case EWildcardKind::Exact:
+	default:
+		return StateName.Equals(Token, ESearchCase::IgnoreCase);
+	}
 }
 
-bool FAnimationBlueprintUtils::MatchesPattern(const FString& StateName, const TSharedPtr<FJsonValue>& Pattern)
+FAnimationBlueprintUtils::FCompiledPatternSet FAnimationBlueprintUtils::FCompiledPatternSet::Compile(
+	const TSharedPtr<FJsonValue>& Pattern)
 {
+	FCompiledPatternSet Set;
+
 	if (!Pattern.IsValid())
 	{
-		return false;
+		return Set;
 	}
 
 	// String pattern (exact, wildcard, or regex)
 	if (Pattern->Type == EJson::String)
 	{
-		FString PatternStr = Pattern->AsString();
-
-		// Try regex first (if it looks like regex)
-		if (MatchesRegex(StateName, PatternStr))
-		{
-			return true;
-		}
-
-		// Try wildcard matching
-		return MatchesWildcard(StateName, PatternStr);
+		Set.Alternatives.Add(FCompiledPattern::Compile(Pattern->AsString()));
 	}
-
-	// Array pattern (list of states)
-	if (Pattern->Type == EJson::Array)
+	// Array pattern (explicit list of states, exact compares only)
+	else if (Pattern->Type == EJson::Array)
 	{
-		const TArray<TSharedPtr<FJsonValue>>& PatternList = Pattern->AsArray();
-		for (const TSharedPtr<FJsonValue>& Item : PatternList)
+		for (const TSharedPtr<FJsonValue>& Item : Pattern->AsArray())
 		{
 			if (Item.IsValid() && Item->Type == EJson::String)
 			{
-				if (StateName.Equals(Item->AsString(), ESearchCase::IgnoreCase))
-				{
-					return true;
-				}
+				FCompiledPattern Exact;
+				Exact.WildcardKind = FCompiledPattern::EWildcardKind::Exact;
+				Exact.Token = Item->AsString();
+				Set.Alternatives.Add(Exact);
 			}
 		}
-		return false;
 	}
 
+	return Set;
+}
+
+bool FAnimationBlueprintUtils::FCompiledPatternSet::Matches(const FString& StateName) const
+{
+	for (const FCompiledPattern& Pattern : Alternatives)
+	{
+		if (Pattern.Matches(StateName))
+		{
+			return true;
+		}
+	}
 	return false;
 }
 
+bool FAnimationBlueprintUtils::MatchesPattern(const FString& StateName, const TSharedPtr<FJsonValue>& Pattern)
+{
+	return FCompiledPatternSet::Compile(Pattern).Matches(StateName);
+}
+
 TSharedPtr<FJsonObject> FAnimationBlueprintUtils::SetupTransitionConditions(
 	UAnimBlueprint* AnimBP,
 	const FString& StateMachineName,
@@ -1539,6 +2024,11 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::SetupTransitionConditions(
 		return Result;
 	}
 
+	// One resolution cache for the whole bulk call: the same variables appear
+	// in condition specs across hundreds of matched transitions, so property
+	// lookup and pin type detection only run once per distinct variable
+	FAnimTransitionConditionFactory::FConditionChainCache ChainCache;
+
 	// Process each rule
 	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); RuleIndex++)
 	{
@@ -1606,6 +2096,12 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::SetupTransitionConditions(
 		// Track matched transitions for this rule
 		TArray<TSharedPtr<FJsonValue>> RuleMatchedTransitions;
 
+		// Compile the rule's patterns once; the transition loop below then
+		// pays a pre-tokenized test per state instead of rebuilding regex
+		// and wildcard machinery per (state, pattern) pair
+		const FCompiledPatternSet CompiledFrom = FCompiledPatternSet::Compile(FromPattern);
+		const FCompiledPatternSet CompiledTo = FCompiledPatternSet::Compile(ToPattern);
+
 		// Find matching transitions
 		for (UAnimStateTransitionNode* Transition : AllTransitions)
 		{
@@ -1620,8 +2116,8 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::SetupTransitionConditions(
 			FString ToStateName = NextState->GetStateName();
 
 			// Check if this transition matches the pattern
-			bool bFromMatches = MatchesPattern(FromStateName, FromPattern);
-			bool bToMatches = MatchesPattern(ToStateName, ToPattern);
+			bool bFromMatches = CompiledFrom.Matches(FromStateName);
+			bool bToMatches = CompiledTo.Matches(ToStateName);
 
 			if (!bFromMatches || !bToMatches) continue;
 
@@ -1726,7 +2222,7 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::SetupTransitionConditions(
 					FString ChainError;
 					TSharedPtr<FJsonObject> ChainResult = FAnimTransitionConditionFactory::CreateComparisonChain(
 						AnimBP, TransitionGraph, Variable, Comparison, Value,
-						FVector2D(PosX, PosY), ChainError);
+						FVector2D(PosX, PosY), ChainError, &ChainCache);
 
 					if (ChainResult.IsValid() && ChainResult->GetBoolField(TEXT("success")))
 					{
@@ -1858,6 +2354,42 @@ FString FAnimationBlueprintUtils::AbbreviateTransitionCondition(UAnimStateTransi
 		return TEXT("(none)");
 	}
 
+	// Nodes carry no change counter, so take a cheap structural fingerprint of
+	// the condition graph (node identities plus pin defaults and link counts)
+	// and cache the abbreviation per transition node against it. Listing a
+	// large machine then re-walks graphs only for transitions that actually
+	// changed. Game thread only, like the diagram helpers.
+	uint32 GraphHash = GetTypeHash(TransitionGraph->Nodes.Num());
+	for (UEdGraphNode* Node : TransitionGraph->Nodes)
+	{
+		if (!Node) continue;
+
+		GraphHash = HashCombine(GraphHash, GetTypeHash(Node->NodeGuid));
+		for (UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin) continue;
+
+			GraphHash = HashCombine(GraphHash, GetTypeHash(Pin->DefaultValue));
+			GraphHash = HashCombine(GraphHash, GetTypeHash(Pin->LinkedTo.Num()));
+		}
+	}
+
+	struct FAbbrevCacheEntry
+	{
+		uint32 GraphHash = 0;
+		FString Abbrev;
+	};
+	static TMap<FObjectKey, FAbbrevCacheEntry> AbbrevCache;
+
+	const FObjectKey NodeKey(TransitionNode);
+	if (const FAbbrevCacheEntry* Cached = AbbrevCache.Find(NodeKey))
+	{
+		if (Cached->GraphHash == GraphHash)
+		{
+			return Cached->Abbrev;
+		}
+	}
+
 	// Find what's connected to the result node
 	TArray<FString> ConditionParts;
 
@@ -1975,12 +2507,21 @@ FString FAnimationBlueprintUtils::AbbreviateTransitionCondition(UAnimStateTransi
 		}
 	}
 
-	if (ConditionParts.Num() == 0)
+	const FString Abbrev = (ConditionParts.Num() == 0)
+		? FString(TEXT("(auto)"))
+		: FString::Join(ConditionParts, TEXT(" & "));
+
+	// Dead FObjectKey entries cost nothing to look up, so a full reset when
+	// the map grows past its cap keeps bookkeeping trivial
+	if (AbbrevCache.Num() >= UnrealClaudeConstants::AnimDiagram::MaxCachedConditionAbbrevs)
 	{
-		return TEXT("(auto)");
+		AbbrevCache.Empty();
 	}
+	FAbbrevCacheEntry& Entry = AbbrevCache.FindOrAdd(NodeKey);
+	Entry.GraphHash = GraphHash;
+	Entry.Abbrev = Abbrev;
 
-	return FString::Join(ConditionParts, TEXT(" & "));
+	return Abbrev;
 }
 
 void FAnimationBlueprintUtils::CalculateStateLayout(
@@ -2351,11 +2892,69 @@ TSharedPtr<FJsonObject> FAnimationBlueprintUtils::GetStateMachineDiagram(
 		DiagramTransitions.Add(DT);
 	}
 
-	// Calculate layout
-	CalculateStateLayout(DiagramStates, DiagramTransitions);
+	// Layout and ASCII rendering are pure functions of the topology collected
+	// above, so cache them per state machine keyed on a content hash. Repeat
+	// queries against an unchanged machine (common when an agent walks a large
+	// AnimBP) skip both passes. Cached entries keep the laid-out grid positions
+	// because the enhanced JSON below reports them. Game thread only, like the
+	// rest of these helpers.
+	struct FDiagramCacheEntry
+	{
+		uint32 TopologyHash = 0;
+		TArray<FDiagramState> LaidOutStates;
+		FString Diagram;
+	};
+	static TMap<FString, FDiagramCacheEntry> DiagramCache;
+	static TArray<FString> DiagramCacheOrder;
+
+	uint32 TopologyHash = GetTypeHash(DiagramStates.Num());
+	for (const FDiagramState& DS : DiagramStates)
+	{
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DS.Name));
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DS.bIsEntry));
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DS.AnimationName));
+	}
+	for (const FDiagramTransition& DT : DiagramTransitions)
+	{
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DT.FromState));
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DT.ToState));
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DT.ConditionAbbrev));
+		TopologyHash = HashCombine(TopologyHash, GetTypeHash(DT.Duration));
+	}
+
+	const FString CacheKey = AnimBP->GetPathName() + TEXT("|") + StateMachineName;
+	FString ASCIIDiagram;
+
+	FDiagramCacheEntry* Cached = DiagramCache.Find(CacheKey);
+	if (Cached && Cached->TopologyHash == TopologyHash)
+	{
+		DiagramStates = Cached->LaidOutStates;
+		ASCIIDiagram = Cached->Diagram;
+	}
+	else
+	{
+		// Calculate layout
+		CalculateStateLayout(DiagramStates, DiagramTransitions);
+
+		// Generate ASCII diagram
+		ASCIIDiagram = GenerateASCIIDiagram(DiagramStates, DiagramTransitions);
+
+		if (!Cached && DiagramCache.Num() >= UnrealClaudeConstants::AnimDiagram::MaxCachedDiagrams
+			&& DiagramCacheOrder.Num() > 0)
+		{
+			DiagramCache.Remove(DiagramCacheOrder[0]);
+			DiagramCacheOrder.RemoveAt(0);
+		}
+		if (!Cached)
+		{
+			DiagramCacheOrder.Add(CacheKey);
+		}
 
-	// Generate ASCII diagram
-	FString ASCIIDiagram = GenerateASCIIDiagram(DiagramStates, DiagramTransitions);
+		FDiagramCacheEntry& Entry = DiagramCache.FindOrAdd(CacheKey);
+		Entry.TopologyHash = TopologyHash;
+		Entry.LaidOutStates = DiagramStates;
+		Entry.Diagram = ASCIIDiagram;
+	}
 
 	// Build enhanced JSON info
 	TSharedPtr<FJsonObject> EnhancedInfo = MakeShared<FJsonObject>();
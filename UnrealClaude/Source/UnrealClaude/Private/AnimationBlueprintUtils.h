@@ -10,9 +10,11 @@
 #include "AnimStateMachineEditor.h"
 #include "AnimGraphEditor.h"
 #include "AnimAssetManager.h"
+#include "MCP/MCPCancellation.h"
 
 // Forward declarations for ASCII diagram generation
 class UAnimStateTransitionNode;
+class FRegexPattern;
 
 /**
  * Animation Blueprint Utilities - Facade
@@ -58,9 +60,49 @@ public:
 
 	/**
 	 * Compile Animation Blueprint after modifications
+	 * While compile deferral is active (see FScopedDeferredCompile) this only
+	 * marks the blueprint modified; the caller owes one explicit compile later
+	 * When the graph structure (nodes, classes, pin wiring) is unchanged since
+	 * the last compile, the compile is downgraded to skip skeleton regeneration
+	 * so data-only tweaks (transition durations, pin defaults) stay cheap
 	 */
 	static bool CompileAnimBlueprint(UAnimBlueprint* AnimBP, FString& OutError);
 
+	// ===== Phased compile =====
+	// CompileAnimBlueprint runs hash -> compile -> save back-to-back and
+	// holds the game thread for the whole run (seconds on large characters).
+	// The phases below are the same pipeline exposed individually so a
+	// sliced task-queue execution can stage them across editor ticks: the
+	// structure-hash prep, the compiler run and the asset save each land on
+	// their own frame instead of stacking into one hitch. All game thread.
+
+	/** Phase 1: structural hash of the graphs, used to pick the compile mode */
+	static uint32 ComputeCompileStructureHash(UAnimBlueprint* AnimBP);
+
+	/**
+	 * Phase 2: the compiler run, downgraded to skip skeleton regeneration
+	 * when StructureHash matches the last compile (same rule as
+	 * CompileAnimBlueprint). Updates the hash bookkeeping; does not save.
+	 */
+	static bool RunAnimCompilePhase(UAnimBlueprint* AnimBP, uint32 StructureHash, FString& OutError);
+
+	/** Phase 3: the post-compile auto-save (false = saved nothing, logged) */
+	static bool SaveCompiledAnimBlueprint(UAnimBlueprint* AnimBP);
+
+	/**
+	 * RAII scope that defers anim blueprint compiles.
+	 * A sequence of modify operations pays for graph mutation only; the one
+	 * compile at the end replaces a full recompile per operation.
+	 */
+	struct FScopedDeferredCompile
+	{
+		FScopedDeferredCompile() { bDeferCompiles = true; }
+		~FScopedDeferredCompile() { bDeferCompiles = false; }
+	};
+
+	/** Whether a deferred-compile scope is currently active */
+	static bool AreCompilesDeferred() { return bDeferCompiles; }
+
 	/**
 	 * Mark AnimBlueprint as modified
 	 */
@@ -348,6 +390,26 @@ public:
 		FString& OutError
 	);
 
+	/**
+	 * Assign animations to many states in one pass (assign_state_animations)
+	 *
+	 * Resolves each distinct asset once, applies all bindings with the player
+	 * node type auto-detected from the asset class, and dirty-marks the
+	 * blueprint once for the whole batch.
+	 *
+	 * @param AnimBP Animation Blueprint
+	 * @param StateMachineName State machine containing the states
+	 * @param StateToAssetPath State name -> animation asset path
+	 * @param OutError Error message if the batch could not start
+	 * @return JSON result with per-state outcomes
+	 */
+	static TSharedPtr<FJsonObject> AssignStateAnimations(
+		UAnimBlueprint* AnimBP,
+		const FString& StateMachineName,
+		const TMap<FString, FString>& StateToAssetPath,
+		FString& OutError
+	);
+
 	/**
 	 * Find animation assets in project
 	 * @param SearchPattern - Name pattern
@@ -390,10 +452,40 @@ public:
 	/**
 	 * Execute batch operations
 	 * Each operation: { "type": "add_state", "params": {...} }
+	 * The cancellation token is checked between operations: a cancelled
+	 * batch stops at the boundary and reports the results it already has
+	 * (with "cancelled" set) instead of finishing work nobody wants.
 	 */
 	static TSharedPtr<FJsonObject> ExecuteBatchOperations(
 		UAnimBlueprint* AnimBP,
 		const TArray<TSharedPtr<FJsonValue>>& Operations,
+		FString& OutError,
+		const FMCPCancellationToken& CancelToken = FMCPCancellationToken()
+	);
+
+	/**
+	 * Build a complete state machine from a declarative description
+	 *
+	 * Unlike ExecuteBatchOperations, which routes every entry through the
+	 * by-name wrappers (each re-finding the state machine by walking all
+	 * graphs), this resolves the state machine node once - creating it when
+	 * absent - and drives the by-node editor APIs directly, so a 25-state
+	 * machine pays for one lookup, one dirty-mark and one compile.
+	 *
+	 * @param AnimBP Animation Blueprint
+	 * @param StateMachineName State machine to build (created if missing)
+	 * @param States Array of {name, x?, y?}; omitted positions fall into a grid
+	 * @param Transitions Array of {from, to, duration?, priority?}
+	 * @param EntryState Name of the entry state (empty leaves the default)
+	 * @param OutError Error message if the build could not start
+	 * @return JSON result with per-state/per-transition outcomes
+	 */
+	static TSharedPtr<FJsonObject> BuildStateMachine(
+		UAnimBlueprint* AnimBP,
+		const FString& StateMachineName,
+		const TArray<TSharedPtr<FJsonValue>>& States,
+		const TArray<TSharedPtr<FJsonValue>>& Transitions,
+		const FString& EntryState,
 		FString& OutError
 	);
 
@@ -437,6 +529,24 @@ public:
 		FString& OutError
 	);
 
+	/**
+	 * Apply a batch of pin defaults on one transition graph
+	 * (set_pin_default_value with pin_values)
+	 *
+	 * Resolves the graph once and reconstructs each affected node exactly
+	 * once after all values are in place; already-current values are skipped.
+	 * @return Number of assignments applied, or -1 if the graph could not be
+	 *         resolved (reason in OutErrors)
+	 */
+	static int32 SetPinDefaultValues(
+		UAnimBlueprint* AnimBP,
+		const FString& StateMachineName,
+		const FString& FromState,
+		const FString& ToState,
+		const TArray<FPinDefaultAssignment>& Assignments,
+		TArray<FString>& OutErrors
+	);
+
 	/**
 	 * Create comparison chain: GetVariable → Comparison → Result (add_comparison_chain)
 	 * Auto-chains with AND to existing logic
@@ -513,10 +623,54 @@ public:
 	);
 
 private:
-	// Pattern matching helpers for SetupTransitionConditions
+	// ===== Pattern matching for SetupTransitionConditions =====
+
+	/**
+	 * A single pattern pre-analyzed for repeated matching. Regex-looking
+	 * patterns compile their FRegexPattern once; wildcard patterns reduce to
+	 * one prefix/suffix/contains test; everything else is an exact compare.
+	 * Regex is tried first, falling back to the wildcard form, matching the
+	 * historical one-shot behavior.
+	 */
+	struct FCompiledPattern
+	{
+		enum class EWildcardKind : uint8
+		{
+			MatchAll,	// "*"
+			Contains,	// "*Combat*"
+			Prefix,		// "Attack_*"
+			Suffix,		// "*_Idle"
+			Exact		// "Idle"
+		};
+
+		/** Compiled regex when the pattern looks like one, null otherwise */
+		TSharedPtr<FRegexPattern> Regex;
+
+		/** Wildcard classification of the raw pattern */
+		EWildcardKind WildcardKind = EWildcardKind::Exact;
+
+		/** Pattern text with wildcard markers stripped */
+		FString Token;
+
+		static FCompiledPattern Compile(const FString& Pattern);
+		bool Matches(const FString& StateName) const;
+	};
+
+	/**
+	 * A rule's pattern value (single string or array of strings) compiled
+	 * once, so bulk rule application over N transitions pays compile cost
+	 * once per rule instead of once per (state, pattern) pair.
+	 */
+	struct FCompiledPatternSet
+	{
+		TArray<FCompiledPattern> Alternatives;
+
+		static FCompiledPatternSet Compile(const TSharedPtr<FJsonValue>& Pattern);
+		bool Matches(const FString& StateName) const;
+	};
+
+	/** One-shot convenience wrapper over FCompiledPatternSet */
 	static bool MatchesPattern(const FString& StateName, const TSharedPtr<FJsonValue>& Pattern);
-	static bool MatchesWildcard(const FString& StateName, const FString& Pattern);
-	static bool MatchesRegex(const FString& StateName, const FString& Pattern);
 	// Internal helpers
 	static bool ValidateAnimBlueprintForOperation(UAnimBlueprint* AnimBP, FString& OutError);
 
@@ -552,4 +706,8 @@ private:
 		TArray<FDiagramState>& States,
 		const TArray<FDiagramTransition>& Transitions
 	);
+
+private:
+	/** Set while an FScopedDeferredCompile is alive (game thread only) */
+	static bool bDeferCompiles;
 };
@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "BlueprintEditor.h"
+#include "NodeClassResolver.h"
 #include "UnrealClaudeModule.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "K2Node_FunctionEntry.h"
@@ -332,22 +333,27 @@ bool FBlueprintEditor::ParsePinType(
 		return true;
 	}
 
-	// Object references (with * suffix)
+	// Object references (with * suffix); memoized so repeated variable/pin
+	// declarations of the same class skip the object-table search ladder
 	if (CleanType.EndsWith(TEXT("*")))
 	{
 		FString ClassName = CleanType.LeftChop(1).TrimEnd();
-		UClass* Class = FindObject<UClass>(nullptr, *ClassName);
-
-		if (!Class)
-		{
-			Class = LoadClass<UObject>(nullptr,
-				*FString::Printf(TEXT("/Script/Engine.%s"), *ClassName));
-		}
-		if (!Class)
+		UClass* Class = FNodeClassResolver::ResolveClass(
+			TEXT("PinClass:") + ClassName, [&ClassName]() -> UClass*
 		{
-			Class = LoadClass<UObject>(nullptr,
-				*FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName));
-		}
+			UClass* Found = FindObject<UClass>(nullptr, *ClassName);
+			if (!Found)
+			{
+				Found = LoadClass<UObject>(nullptr,
+					*FString::Printf(TEXT("/Script/Engine.%s"), *ClassName));
+			}
+			if (!Found)
+			{
+				Found = LoadClass<UObject>(nullptr,
+					*FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName));
+			}
+			return Found;
+		});
 
 		if (Class)
 		{
@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "BlueprintGraphEditor.h"
+#include "NodeClassResolver.h"
 #include "UnrealClaudeModule.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "K2Node_FunctionEntry.h"
@@ -18,6 +19,55 @@
 // Static member initialization
 volatile int32 FBlueprintGraphEditor::NodeIdCounter = 0;
 const FString FBlueprintGraphEditor::NodeIdPrefix = TEXT("MCP_ID:");
+bool FBlueprintGraphEditor::bBulkEditActive = false;
+TArray<TWeakObjectPtr<UEdGraphNode>> FBlueprintGraphEditor::BulkCreatedNodes;
+
+// ===== Bulk Editing =====
+
+FBlueprintGraphEditor::FScopedBulkGraphEdit::FScopedBulkGraphEdit(UEdGraph* InGraph)
+	: Graph(InGraph)
+{
+	bBulkEditActive = true;
+	BulkCreatedNodes.Reset();
+}
+
+FBlueprintGraphEditor::FScopedBulkGraphEdit::~FScopedBulkGraphEdit()
+{
+	bBulkEditActive = false;
+
+	// Single finalize pass: reconstruct everything created in the scope so
+	// pins and wires settle, then notify the graph and mark the blueprint
+	// structurally modified exactly once
+	int32 ReconstructedCount = 0;
+	for (const TWeakObjectPtr<UEdGraphNode>& NodePtr : BulkCreatedNodes)
+	{
+		if (UEdGraphNode* Node = NodePtr.Get())
+		{
+			Node->ReconstructNode();
+			ReconstructedCount++;
+		}
+	}
+	BulkCreatedNodes.Reset();
+
+	if (Graph)
+	{
+		Graph->NotifyGraphChanged();
+		if (UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph))
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}
+	}
+
+	if (ReconstructedCount > 0)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Bulk graph edit finalized (%d nodes reconstructed)"), ReconstructedCount);
+	}
+}
+
+bool FBlueprintGraphEditor::IsBulkEditActive()
+{
+	return bBulkEditActive;
+}
 
 // ===== Graph Finding =====
 
@@ -161,8 +211,15 @@ UEdGraphNode* FBlueprintGraphEditor::CreateNode(
 		OutNodeId = GenerateNodeId(NodeType, Context, Graph);
 		SetNodeId(NewNode, OutNodeId);
 
-		// Mark blueprint as modified
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		// Mark blueprint as modified (deferred to scope end during bulk edits)
+		if (bBulkEditActive)
+		{
+			BulkCreatedNodes.Add(NewNode);
+		}
+		else
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}
 
 		UE_LOG(LogUnrealClaude, Log, TEXT("Created node '%s' (type: %s) at (%d, %d)"), *OutNodeId, *NodeType, PosX, PosY);
 	}
@@ -193,7 +250,7 @@ bool FBlueprintGraphEditor::DeleteNode(UEdGraph* Graph, const FString& NodeId, F
 	// Remove from graph
 	Graph->RemoveNode(Node);
 
-	if (Blueprint)
+	if (Blueprint && !bBulkEditActive)
 	{
 		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
 	}
@@ -322,7 +379,7 @@ bool FBlueprintGraphEditor::ConnectPins(
 	SourcePin->MakeLinkTo(TargetPin);
 
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
-	if (Blueprint)
+	if (Blueprint && !bBulkEditActive)
 	{
 		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
 	}
@@ -382,7 +439,7 @@ bool FBlueprintGraphEditor::DisconnectPins(
 	SourcePin->BreakLinkTo(TargetPin);
 
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
-	if (Blueprint)
+	if (Blueprint && !bBulkEditActive)
 	{
 		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
 	}
@@ -639,26 +696,32 @@ UEdGraphNode* FBlueprintGraphEditor::CreateCallFunctionNode(
 		return nullptr;
 	}
 
-	// Find the function
-	UFunction* Function = nullptr;
+	// Find the function; memoized so bulk graph construction resolves each
+	// (class, function) pair once instead of re-searching the object table
+	// per created node
 	UClass* FunctionOwner = nullptr;
 
 	// Try to find class by name
 	if (!TargetClass.IsEmpty())
 	{
-		FunctionOwner = FindObject<UClass>(nullptr, *TargetClass);
-		if (!FunctionOwner)
+		FunctionOwner = FNodeClassResolver::ResolveClass(
+			TEXT("CallFunctionOwner:") + TargetClass, [&TargetClass]() -> UClass*
 		{
-			// Try common library classes
-			if (TargetClass.Equals(TEXT("KismetSystemLibrary"), ESearchCase::IgnoreCase))
+			UClass* Found = FindObject<UClass>(nullptr, *TargetClass);
+			if (!Found)
 			{
-				FunctionOwner = UKismetSystemLibrary::StaticClass();
-			}
-			else if (TargetClass.Equals(TEXT("KismetMathLibrary"), ESearchCase::IgnoreCase))
-			{
-				FunctionOwner = UKismetMathLibrary::StaticClass();
+				// Try common library classes
+				if (TargetClass.Equals(TEXT("KismetSystemLibrary"), ESearchCase::IgnoreCase))
+				{
+					Found = UKismetSystemLibrary::StaticClass();
+				}
+				else if (TargetClass.Equals(TEXT("KismetMathLibrary"), ESearchCase::IgnoreCase))
+				{
+					Found = UKismetMathLibrary::StaticClass();
+				}
 			}
-		}
+			return Found;
+		});
 	}
 	else
 	{
@@ -666,20 +729,27 @@ UEdGraphNode* FBlueprintGraphEditor::CreateCallFunctionNode(
 		FunctionOwner = UKismetSystemLibrary::StaticClass();
 	}
 
-	if (FunctionOwner)
+	UFunction* Function = FNodeClassResolver::ResolveFunction(
+		FString::Printf(TEXT("CallFunction:%s:%s"), *TargetClass, *FunctionName),
+		[FunctionOwner, &FunctionName]() -> UFunction*
 	{
-		Function = FunctionOwner->FindFunctionByName(FName(*FunctionName));
-	}
+		UFunction* Found = nullptr;
+		if (FunctionOwner)
+		{
+			Found = FunctionOwner->FindFunctionByName(FName(*FunctionName));
+		}
 
-	// If not found in specified class, search common libraries
-	if (!Function)
-	{
-		Function = UKismetSystemLibrary::StaticClass()->FindFunctionByName(FName(*FunctionName));
-	}
-	if (!Function)
-	{
-		Function = UKismetMathLibrary::StaticClass()->FindFunctionByName(FName(*FunctionName));
-	}
+		// If not found in specified class, search common libraries
+		if (!Found)
+		{
+			Found = UKismetSystemLibrary::StaticClass()->FindFunctionByName(FName(*FunctionName));
+		}
+		if (!Found)
+		{
+			Found = UKismetMathLibrary::StaticClass()->FindFunctionByName(FName(*FunctionName));
+		}
+		return Found;
+	});
 
 	if (!Function)
 	{
@@ -48,6 +48,32 @@ public:
 		FString& OutError
 	);
 
+	// ===== Bulk Editing =====
+
+	/**
+	 * RAII scope that batches many CreateNode/ConnectPins/DeleteNode calls
+	 * into a single structural pass
+	 *
+	 * While the scope is alive the per-call MarkBlueprintAsStructurallyModified
+	 * (which recompiles the skeleton class every time) is suppressed. The
+	 * destructor reconstructs every node created inside the scope, notifies
+	 * the graph once and issues one structural modification - so building a
+	 * large graph costs one skeleton recompile instead of one per call.
+	 * Not reentrant; game thread only.
+	 */
+	class FScopedBulkGraphEdit
+	{
+	public:
+		explicit FScopedBulkGraphEdit(UEdGraph* InGraph);
+		~FScopedBulkGraphEdit();
+
+	private:
+		UEdGraph* Graph;
+	};
+
+	/** True while a FScopedBulkGraphEdit is active */
+	static bool IsBulkEditActive();
+
 	// ===== Node Management =====
 
 	/**
@@ -214,6 +240,10 @@ private:
 	// Thread-safe counter for unique IDs
 	static volatile int32 NodeIdCounter;
 
+	// Bulk edit state (see FScopedBulkGraphEdit)
+	static bool bBulkEditActive;
+	static TArray<TWeakObjectPtr<UEdGraphNode>> BulkCreatedNodes;
+
 	// Node creation helpers
 	static UEdGraphNode* CreateCallFunctionNode(UEdGraph* Graph, const FString& FunctionName, const FString& TargetClass, int32 PosX, int32 PosY, FString& OutError);
 	static UEdGraphNode* CreateBranchNode(UEdGraph* Graph, int32 PosX, int32 PosY, FString& OutError);
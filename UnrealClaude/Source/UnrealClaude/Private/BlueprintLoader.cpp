@@ -1,8 +1,10 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "BlueprintLoader.h"
+#include "MCP/MCPFactoryPool.h"
 #include "MCP/MCPParamValidator.h"
 #include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Kismet2/BlueprintEditorUtils.h"
@@ -11,7 +13,17 @@
 #include "Factories/BlueprintFactory.h"
 #include "Logging/MessageLog.h"
 #include "Misc/UObjectToken.h"
+#include "Misc/PackageName.h"
 #include "EdGraph/EdGraphNode.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "UObject/UObjectGlobals.h"
+
+TMap<FString, TWeakObjectPtr<UBlueprint>> FBlueprintLoader::ResolvedBlueprintCache;
+TMap<FString, TStrongObjectPtr<UBlueprint>> FBlueprintLoader::BurstPinnedBlueprints;
+TArray<FString> FBlueprintLoader::BurstPinOrder;
+double FBlueprintLoader::LastBurstPinTime = 0.0;
+FTSTicker::FDelegateHandle FBlueprintLoader::BurstReleaseTickerHandle;
 
 UBlueprint* FBlueprintLoader::LoadBlueprint(const FString& BlueprintPath, FString& OutError)
 {
@@ -21,6 +33,19 @@ UBlueprint* FBlueprintLoader::LoadBlueprint(const FString& BlueprintPath, FStrin
 		return nullptr;
 	}
 
+	// Cache hit: the weak handle validates in O(1), so repeat requests
+	// against the same Blueprint skip object-path resolution entirely
+	if (TWeakObjectPtr<UBlueprint>* Cached = ResolvedBlueprintCache.Find(BlueprintPath))
+	{
+		if (UBlueprint* CachedBlueprint = Cached->Get())
+		{
+			PinForBurst(BlueprintPath, CachedBlueprint);
+			return CachedBlueprint;
+		}
+		// Object was deleted or collected - fall through to a fresh resolve
+		ResolvedBlueprintCache.Remove(BlueprintPath);
+	}
+
 	// Try to load the Blueprint directly
 	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 
@@ -41,9 +66,121 @@ UBlueprint* FBlueprintLoader::LoadBlueprint(const FString& BlueprintPath, FStrin
 		return nullptr;
 	}
 
+	ResolvedBlueprintCache.Add(BlueprintPath, Blueprint);
+	PinForBurst(BlueprintPath, Blueprint);
+
 	return Blueprint;
 }
 
+void FBlueprintLoader::InvalidateResolutionCache()
+{
+	ResolvedBlueprintCache.Empty();
+	ReleaseBurstPins();
+}
+
+void FBlueprintLoader::PinForBurst(const FString& BlueprintPath, UBlueprint* Blueprint)
+{
+	using namespace UnrealClaudeConstants::BlueprintLoading;
+
+	LastBurstPinTime = FPlatformTime::Seconds();
+
+	if (!BurstPinnedBlueprints.Contains(BlueprintPath))
+	{
+		while (BurstPinOrder.Num() >= MaxBurstPinnedBlueprints)
+		{
+			BurstPinnedBlueprints.Remove(BurstPinOrder[0]);
+			BurstPinOrder.RemoveAt(0);
+		}
+		BurstPinnedBlueprints.Add(BlueprintPath, TStrongObjectPtr<UBlueprint>(Blueprint));
+		BurstPinOrder.Add(BlueprintPath);
+	}
+
+	// First pin of a burst arms the release ticker; it re-checks at the idle
+	// interval and drops everything once no load has refreshed the timestamp
+	if (!BurstReleaseTickerHandle.IsValid())
+	{
+		BurstReleaseTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda([](float /*DeltaTime*/)
+			{
+				if (FPlatformTime::Seconds() - LastBurstPinTime < BurstPinIdleReleaseSeconds)
+				{
+					return true; // burst still active - keep watching
+				}
+				BurstPinnedBlueprints.Empty();
+				BurstPinOrder.Empty();
+				// Returning false removes this ticker; just forget the handle
+				BurstReleaseTickerHandle.Reset();
+				return false;
+			}), BurstPinIdleReleaseSeconds);
+	}
+}
+
+void FBlueprintLoader::ReleaseBurstPins()
+{
+	BurstPinnedBlueprints.Empty();
+	BurstPinOrder.Empty();
+	if (BurstReleaseTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(BurstReleaseTickerHandle);
+		BurstReleaseTickerHandle.Reset();
+	}
+}
+
+bool FBlueprintLoader::PreloadBlueprintPackage(const FString& BlueprintPath, float TimeoutSeconds)
+{
+	// On the game thread there is nothing to park on - LoadBlueprint's
+	// synchronous load is the correct path there
+	if (IsInGameThread() || BlueprintPath.IsEmpty())
+	{
+		return true;
+	}
+
+	// Mirror LoadBlueprint's path normalization so both resolve the same package
+	FString AdjustedPath = BlueprintPath;
+	if (!AdjustedPath.StartsWith(TEXT("/")))
+	{
+		AdjustedPath = TEXT("/Game/") + AdjustedPath;
+	}
+
+	const FString PackageName = FPackageName::ObjectPathToPackageName(AdjustedPath);
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+	{
+		// Let LoadBlueprint produce the user-facing error for bad paths
+		return true;
+	}
+
+	// Kick the streamed load from the game thread; the completion delegate
+	// fulfils the promise this worker parks on. LoadPackageAsync dedupes
+	// in-flight requests, so concurrent tasks on the same package share one load.
+	TSharedPtr<TPromise<bool>> Promise = MakeShared<TPromise<bool>>();
+	TFuture<bool> Future = Promise->GetFuture();
+
+	AsyncTask(ENamedThreads::GameThread, [PackageName, Promise]()
+	{
+		UPackage* Existing = FindPackage(nullptr, *PackageName);
+		if (Existing && Existing->IsFullyLoaded())
+		{
+			Promise->SetValue(true);
+			return;
+		}
+
+		LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda(
+			[Promise](const FName& /*LoadedPackageName*/, UPackage* /*LoadedPackage*/, EAsyncLoadingResult::Type Result)
+			{
+				Promise->SetValue(Result == EAsyncLoadingResult::Succeeded);
+			}));
+	});
+
+	if (!Future.WaitFor(FTimespan::FromSeconds(TimeoutSeconds)))
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Timed out streaming package %s after %.0fs"),
+			*PackageName, TimeoutSeconds);
+		return false;
+	}
+
+	return Future.Get();
+}
+
 bool FBlueprintLoader::ValidateBlueprintPath(const FString& BlueprintPath, FString& OutError)
 {
 	// Delegate to MCPParamValidator for comprehensive security validation
@@ -275,8 +412,9 @@ UBlueprint* FBlueprintLoader::CreateBlueprint(
 		return nullptr;
 	}
 
-	// Create Blueprint factory
-	UBlueprintFactory* Factory = NewObject<UBlueprintFactory>();
+	// Fetch the warm factory and configure it for this creation; the pooled
+	// instance still carries the previous operation's settings
+	UBlueprintFactory* Factory = FMCPFactoryPool::Get().GetFactory<UBlueprintFactory>();
 	Factory->ParentClass = ParentClass;
 	Factory->BlueprintType = BlueprintType;
 
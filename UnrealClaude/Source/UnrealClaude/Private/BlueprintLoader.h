@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Blueprint.h"
+#include "Containers/Ticker.h"
+#include "UObject/StrongObjectPtr.h"
 
 /**
  * Individual compile message with source info
@@ -70,12 +72,43 @@ class UNREALCLAUDE_API FBlueprintLoader
 public:
 	/**
 	 * Load a Blueprint asset from path
+	 * Resolutions are cached (path -> weak handle) so agents hammering the
+	 * same Blueprints across a session skip repeated object-path resolution;
+	 * the weak handle is validated cheaply and re-resolved if the object went away
 	 * @param BlueprintPath - Asset path (e.g., "/Game/Blueprints/BP_Actor")
 	 * @param OutError - Error message if loading fails
 	 * @return Loaded Blueprint or nullptr
 	 */
 	static UBlueprint* LoadBlueprint(const FString& BlueprintPath, FString& OutError);
 
+	/**
+	 * Drop all cached path-to-Blueprint resolutions
+	 * Call after operations that invalidate paths wholesale (e.g. bulk renames);
+	 * individual deletions are handled automatically by the weak handles
+	 */
+	static void InvalidateResolutionCache();
+
+	/**
+	 * Release the strong references pinning burst-active Blueprints
+	 * Called on idle by the release ticker and at module shutdown; the
+	 * weak-handle cache stays intact, only GC protection is dropped
+	 */
+	static void ReleaseBurstPins();
+
+	/**
+	 * Stream a Blueprint's package into memory without blocking the game thread
+	 * Intended for task-queue workers: the calling (background) thread parks on
+	 * the streamed load while the game thread services the async loader, so a
+	 * cold load of a heavy Blueprint no longer freezes the editor. Packages
+	 * that are already resident return immediately, so concurrent requests
+	 * against loaded Blueprints are unaffected. Calling from the game thread
+	 * is a no-op (LoadBlueprint handles that path synchronously).
+	 * @param BlueprintPath - Asset path (e.g., "/Game/Blueprints/BP_Actor")
+	 * @param TimeoutSeconds - Max time to wait for the streamed load
+	 * @return true if the package is resident (or preloading was not applicable)
+	 */
+	static bool PreloadBlueprintPackage(const FString& BlueprintPath, float TimeoutSeconds = 60.0f);
+
 	/**
 	 * Validate Blueprint path is safe and accessible
 	 * Checks: not empty, not engine path, no traversal, safe characters
@@ -140,4 +173,35 @@ public:
 	 * @return UClass or nullptr
 	 */
 	static UClass* FindParentClass(const FString& ParentClassName, FString& OutError);
+
+private:
+	/**
+	 * Keep a resolution strongly referenced while Blueprint work is bursting.
+	 * The weak-handle cache makes repeat resolutions cheap, but between
+	 * queued tasks GC can still collect an otherwise-unreferenced Blueprint
+	 * and force the next task to redo the full package load. Every
+	 * successful LoadBlueprint pins its result; an idle ticker drops all
+	 * pins once loads stop, so a 30-blueprint scripted refactor holds its
+	 * working set resident exactly for the duration of the burst.
+	 * Game thread only, like the cache.
+	 */
+	static void PinForBurst(const FString& BlueprintPath, UBlueprint* Blueprint);
+
+	/** Path -> weak handle cache behind LoadBlueprint. Game thread only
+	 *  (tool execution is always dispatched there). Dead handles are pruned
+	 *  lazily on lookup. */
+	static TMap<FString, TWeakObjectPtr<UBlueprint>> ResolvedBlueprintCache;
+
+	/** Strong pins for the current burst, bounded LRU */
+	static TMap<FString, TStrongObjectPtr<UBlueprint>> BurstPinnedBlueprints;
+
+	/** Pin insertion order for LRU eviction */
+	static TArray<FString> BurstPinOrder;
+
+	/** FPlatformTime::Seconds() of the most recent load; the release ticker
+	 *  drops the pins once this goes stale */
+	static double LastBurstPinTime;
+
+	/** Ticker that releases the pins after an idle window */
+	static FTSTicker::FDelegateHandle BurstReleaseTickerHandle;
 };
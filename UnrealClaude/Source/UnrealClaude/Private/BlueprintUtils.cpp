@@ -236,6 +236,11 @@ TArray<TSharedPtr<FJsonValue>> FBlueprintUtils::GetBlueprintFunctions(UBlueprint
 }
 
 TSharedPtr<FJsonObject> FBlueprintUtils::GetGraphInfo(UBlueprint* Blueprint)
+{
+	return GetGraphInfo(Blueprint, EGraphDepth::Summary);
+}
+
+TSharedPtr<FJsonObject> FBlueprintUtils::GetGraphInfo(UBlueprint* Blueprint, EGraphDepth Depth)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 
@@ -247,32 +252,83 @@ TSharedPtr<FJsonObject> FBlueprintUtils::GetGraphInfo(UBlueprint* Blueprint)
 	int32 TotalNodes = 0;
 	int32 TotalEvents = 0;
 	TArray<TSharedPtr<FJsonValue>> GraphNames;
+	TArray<TSharedPtr<FJsonValue>> Graphs;
 
-	// Count nodes in all graphs
-	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	// One walk serves every depth; deeper levels just serialize more of
+	// what the walk already visits
+	const auto SerializeGraph = [Depth, &TotalNodes, &TotalEvents, &GraphNames, &Graphs](
+		UEdGraph* Graph, const TCHAR* GraphType)
 	{
-		if (Graph)
+		if (!Graph)
+		{
+			return;
+		}
+
+		int32 EventCount = 0;
+		for (UEdGraphNode* Node : Graph->Nodes)
 		{
-			TotalNodes += Graph->Nodes.Num();
-			GraphNames.Add(MakeShared<FJsonValueString>(Graph->GetName()));
+			if (Cast<UK2Node_Event>(Node))
+			{
+				EventCount++;
+			}
+		}
+
+		TotalNodes += Graph->Nodes.Num();
+		TotalEvents += EventCount;
+		GraphNames.Add(MakeShared<FJsonValueString>(Graph->GetName()));
 
+		if (Depth == EGraphDepth::Summary)
+		{
+			return;
+		}
+
+		TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+		GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+		GraphObj->SetStringField(TEXT("type"), GraphType);
+		GraphObj->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
+		GraphObj->SetNumberField(TEXT("event_count"), EventCount);
+
+		if (Depth >= EGraphDepth::Nodes)
+		{
+			TArray<TSharedPtr<FJsonValue>> Nodes;
+			Nodes.Reserve(Graph->Nodes.Num());
 			for (UEdGraphNode* Node : Graph->Nodes)
 			{
-				if (Cast<UK2Node_Event>(Node))
+				if (!Node)
 				{
-					TotalEvents++;
+					continue;
+				}
+
+				if (Depth == EGraphDepth::Pins)
+				{
+					// Full serialization including pins, types and defaults
+					Nodes.Add(MakeShared<FJsonValueObject>(FBlueprintGraphEditor::SerializeNodeInfo(Node)));
+				}
+				else
+				{
+					TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+					NodeObj->SetStringField(TEXT("node_id"), FBlueprintGraphEditor::GetNodeId(Node));
+					NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+					NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+					NodeObj->SetNumberField(TEXT("pos_x"), Node->NodePosX);
+					NodeObj->SetNumberField(TEXT("pos_y"), Node->NodePosY);
+					Nodes.Add(MakeShared<FJsonValueObject>(NodeObj));
 				}
 			}
+			GraphObj->SetArrayField(TEXT("nodes"), Nodes);
 		}
+
+		Graphs.Add(MakeShared<FJsonValueObject>(GraphObj));
+	};
+
+	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		SerializeGraph(Graph, TEXT("ubergraph"));
 	}
 
 	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
 	{
-		if (Graph)
-		{
-			TotalNodes += Graph->Nodes.Num();
-			GraphNames.Add(MakeShared<FJsonValueString>(Graph->GetName()));
-		}
+		SerializeGraph(Graph, TEXT("function"));
 	}
 
 	Result->SetNumberField(TEXT("total_nodes"), TotalNodes);
@@ -280,5 +336,10 @@ TSharedPtr<FJsonObject> FBlueprintUtils::GetGraphInfo(UBlueprint* Blueprint)
 	Result->SetNumberField(TEXT("function_count"), Blueprint->FunctionGraphs.Num());
 	Result->SetArrayField(TEXT("graph_names"), GraphNames);
 
+	if (Depth != EGraphDepth::Summary)
+	{
+		Result->SetArrayField(TEXT("graphs"), Graphs);
+	}
+
 	return Result;
 }
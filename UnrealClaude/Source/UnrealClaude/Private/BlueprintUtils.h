@@ -270,8 +270,36 @@ public:
 	 */
 	static TArray<TSharedPtr<FJsonValue>> GetBlueprintFunctions(UBlueprint* Blueprint);
 
+	/**
+	 * Serialization depth for progressive graph queries
+	 *
+	 * Agents usually want the shape of a blueprint before its contents;
+	 * each level adds one layer of detail so reconnaissance pays kilobytes
+	 * and full dumps are only built when asked for.
+	 */
+	enum class EGraphDepth : uint8
+	{
+		/** Totals and graph names only (the historical get_graph output) */
+		Summary,
+
+		/** Per-graph entries with type and node/event counts */
+		Graphs,
+
+		/** Graphs plus their nodes (id, class, title, position) without pins */
+		Nodes,
+
+		/** Full dump: nodes with pin names, types, defaults and links */
+		Pins
+	};
+
 	/**
 	 * Get graph information (node count, events)
 	 */
 	static TSharedPtr<FJsonObject> GetGraphInfo(UBlueprint* Blueprint);
+
+	/**
+	 * Get graph information at the requested depth; Summary matches the
+	 * single-argument overload
+	 */
+	static TSharedPtr<FJsonObject> GetGraphInfo(UBlueprint* Blueprint, EGraphDepth Depth);
 };
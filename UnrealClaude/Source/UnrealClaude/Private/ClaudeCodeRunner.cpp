@@ -6,6 +6,7 @@
 #include "ProjectContext.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/FileManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Misc/Paths.h"
 #include "Misc/App.h"
 #include "Misc/FileHelper.h"
@@ -31,6 +32,84 @@
 extern char **environ;
 #endif
 
+namespace
+{
+	/**
+	 * Extract the user-visible text from one stream-json assistant record.
+	 * Returns empty for records with no displayable text (system, tool use, etc.)
+	 */
+	FString ExtractStreamedAssistantText(const FString& JsonLine)
+	{
+		TSharedPtr<FJsonObject> Record;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonLine);
+		if (!FJsonSerializer::Deserialize(Reader, Record) || !Record.IsValid())
+		{
+			return FString();
+		}
+
+		FString RecordType;
+		if (!Record->TryGetStringField(TEXT("type"), RecordType) || RecordType != TEXT("assistant"))
+		{
+			return FString();
+		}
+
+		const TSharedPtr<FJsonObject>* Message;
+		if (!Record->TryGetObjectField(TEXT("message"), Message))
+		{
+			return FString();
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ContentArray;
+		if (!(*Message)->TryGetArrayField(TEXT("content"), ContentArray))
+		{
+			return FString();
+		}
+
+		FString Text;
+		for (const TSharedPtr<FJsonValue>& ContentValue : *ContentArray)
+		{
+			const TSharedPtr<FJsonObject>* ContentItem;
+			if (ContentValue->TryGetObject(ContentItem))
+			{
+				FString ItemType;
+				if ((*ContentItem)->TryGetStringField(TEXT("type"), ItemType) && ItemType == TEXT("text"))
+				{
+					Text += (*ContentItem)->GetStringField(TEXT("text"));
+				}
+			}
+		}
+		return Text;
+	}
+
+	/**
+	 * Extract the final response text from a stream-json result record.
+	 * Returns false if the line is not a result record.
+	 */
+	bool ExtractStreamResultText(const FString& JsonLine, FString& OutText)
+	{
+		TSharedPtr<FJsonObject> Record;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonLine);
+		if (!FJsonSerializer::Deserialize(Reader, Record) || !Record.IsValid())
+		{
+			return false;
+		}
+
+		FString RecordType;
+		if (!Record->TryGetStringField(TEXT("type"), RecordType) || RecordType != TEXT("result"))
+		{
+			return false;
+		}
+
+		if (!Record->TryGetStringField(TEXT("result"), OutText))
+		{
+			// Error results carry no text; fall back to the raw record so
+			// callers still see what went wrong
+			OutText = JsonLine;
+		}
+		return true;
+	}
+}
+
 FClaudeCodeRunner::FClaudeCodeRunner()
 	: Thread(nullptr)
 	, bIsExecuting(false)
@@ -55,6 +134,9 @@ FClaudeCodeRunner::~FClaudeCodeRunner()
 		Thread = nullptr;
 	}
 
+	// Shut down the warm process (if any) before releasing handles
+	ShutdownResidentProcess();
+
 	// NOW safe to cleanup handles (thread has exited)
 	CleanupHandles();
 }
@@ -489,28 +571,16 @@ static FString GetPluginDirectory()
 	return FString();
 }
 
-FString FClaudeCodeRunner::BuildCommandLine(const FClaudeRequestConfig& Config)
+FString FClaudeCodeRunner::BuildCommonArgs(const FClaudeRequestConfig& Config)
 {
 	FString CommandLine;
 
-	// Print mode (non-interactive)
-	CommandLine += TEXT("-p ");
-
-	// Verbose mode to show thinking
-	CommandLine += TEXT("--verbose ");
-
 	// Skip permissions if requested
 	if (Config.bSkipPermissions)
 	{
 		CommandLine += TEXT("--dangerously-skip-permissions ");
 	}
 
-	// JSON output if requested
-	if (Config.bUseJsonOutput)
-	{
-		CommandLine += TEXT("--output-format json ");
-	}
-
 	// MCP config for editor tools
 	FString PluginDir = GetPluginDirectory();
 	if (!PluginDir.IsEmpty())
@@ -557,30 +627,29 @@ FString FClaudeCodeRunner::BuildCommandLine(const FClaudeRequestConfig& Config)
 		CommandLine += FString::Printf(TEXT("--allowedTools \"%s\" "), *FString::Join(AllTools, TEXT(",")));
 	}
 
-	// Write prompts to files to avoid command line length limits (Error 206)
-	FString TempDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"));
-	IFileManager::Get().MakeDirectory(*TempDir, true);
+	return CommandLine;
+}
 
-	// System prompt - write to file
-	if (!Config.SystemPrompt.IsEmpty())
-	{
-		FString SystemPromptPath = FPaths::Combine(TempDir, TEXT("system-prompt.txt"));
-		if (FFileHelper::SaveStringToFile(Config.SystemPrompt, *SystemPromptPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
-		{
-			SystemPromptFilePath = SystemPromptPath;
-			UE_LOG(LogUnrealClaude, Log, TEXT("System prompt written to: %s (%d chars)"), *SystemPromptPath, Config.SystemPrompt.Len());
-		}
-	}
+FString FClaudeCodeRunner::BuildCommandLine(const FClaudeRequestConfig& Config)
+{
+	FString CommandLine;
+
+	// Print mode (non-interactive)
+	CommandLine += TEXT("-p ");
+
+	// Verbose mode to show thinking
+	CommandLine += TEXT("--verbose ");
 
-	// User prompt - write to file
-	FString PromptPath = FPaths::Combine(TempDir, TEXT("prompt.txt"));
-	if (FFileHelper::SaveStringToFile(Config.Prompt, *PromptPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	// JSON output if requested
+	if (Config.bUseJsonOutput)
 	{
-		PromptFilePath = PromptPath;
-		UE_LOG(LogUnrealClaude, Log, TEXT("Prompt written to: %s (%d chars)"), *PromptPath, Config.Prompt.Len());
+		CommandLine += TEXT("--output-format json ");
 	}
 
-	// Don't add prompts to command line - we'll pipe them via stdin
+	CommandLine += BuildCommonArgs(Config);
+
+	// Prompts never go on the command line (length limits) - they are piped
+	// straight to the CLI's stdin from CurrentConfig, no temp files involved
 	return CommandLine;
 }
 
@@ -757,50 +826,62 @@ bool FClaudeCodeRunner::LaunchProcess(const FString& FullCommand, const FString&
 
 FString FClaudeCodeRunner::ReadProcessOutput()
 {
-	FString FullOutput;
-	char Buffer[4096];
+	// Accumulate raw UTF-8 bytes and convert to TCHAR exactly once at the
+	// end. Appending converted chunks to an FString re-copies the whole
+	// accumulated text as it grows and can split a multi-byte sequence at a
+	// chunk boundary; the byte buffer (exponential TArray growth) has
+	// neither problem, so capture cost stays flat as responses grow.
+	TArray<uint8> Accumulated;
+	Accumulated.Reserve(UnrealClaudeConstants::Process::PipeReadChunkBytes);
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(UnrealClaudeConstants::Process::PipeReadChunkBytes);
 	DWORD BytesRead;
 
 	HANDLE StdOutReadPipe = static_cast<HANDLE>(ReadPipe);
 	HANDLE hProcess = static_cast<HANDLE>(ProcessHandle);
 
-	while (!StopTaskCounter.GetValue())
+	auto AppendChunk = [this, &Accumulated, &Chunk](int32 NumBytes)
 	{
-		// Check if process is done
-		DWORD WaitResult = WaitForSingleObject(hProcess, UnrealClaudeConstants::Process::WaitTimeoutMs);
+		Accumulated.Append(Chunk.GetData(), NumBytes);
 
-		// Read any available output
-		while (ReadFile(StdOutReadPipe, Buffer, sizeof(Buffer) - 1, &BytesRead, NULL) && BytesRead > 0)
+		// Progress consumers want text as it streams; convert just the new
+		// bytes (display-only - a split code point at worst renders one
+		// replacement character)
+		if (OnProgressDelegate.IsBound())
 		{
-			Buffer[BytesRead] = '\0';
-			FString OutputChunk = UTF8_TO_TCHAR(Buffer);
-			FullOutput += OutputChunk;
-
-			// Report progress
-			if (OnProgressDelegate.IsBound())
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Chunk.GetData()), NumBytes);
+			FString ProgressChunk(Converted.Length(), Converted.Get());
+			FOnClaudeProgress ProgressCopy = OnProgressDelegate;
+			AsyncTask(ENamedThreads::GameThread, [ProgressCopy, ProgressChunk]()
 			{
-				FOnClaudeProgress ProgressCopy = OnProgressDelegate;
-				FString ProgressChunk = OutputChunk;
-				AsyncTask(ENamedThreads::GameThread, [ProgressCopy, ProgressChunk]()
-				{
-					ProgressCopy.ExecuteIfBound(ProgressChunk);
-				});
-			}
+				ProgressCopy.ExecuteIfBound(ProgressChunk);
+			});
 		}
+	};
 
-		if (WaitResult == WAIT_OBJECT_0)
+	// Blocking reads on the dedicated reader thread: ReadFile wakes the
+	// moment bytes arrive and fails with ERROR_BROKEN_PIPE once the child
+	// closes its end, so there is no poll interval of chunk latency and no
+	// idle wakeups. Cancel() unblocks the read by terminating the child
+	// (which closes the pipe) and closing our handle.
+	while (!StopTaskCounter.GetValue())
+	{
+		if (!ReadFile(StdOutReadPipe, Chunk.GetData(), Chunk.Num(), &BytesRead, NULL) || BytesRead == 0)
 		{
-			// Process finished - read any remaining output
-			while (ReadFile(StdOutReadPipe, Buffer, sizeof(Buffer) - 1, &BytesRead, NULL) && BytesRead > 0)
-			{
-				Buffer[BytesRead] = '\0';
-				FullOutput += UTF8_TO_TCHAR(Buffer);
-			}
 			break;
 		}
+		AppendChunk(static_cast<int32>(BytesRead));
 	}
 
-	return FullOutput;
+	// Let the child finish winding down after its stdout closed so the
+	// caller reads a real exit code (bounded waits, still cancellable)
+	while (!StopTaskCounter.GetValue() &&
+		WaitForSingleObject(hProcess, UnrealClaudeConstants::Process::WaitTimeoutMs) == WAIT_TIMEOUT)
+	{
+	}
+
+	FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Accumulated.GetData()), Accumulated.Num());
+	return FString(Converted.Length(), Converted.Get());
 }
 
 void FClaudeCodeRunner::ReportError(const FString& ErrorMessage)
@@ -996,59 +1077,58 @@ bool FClaudeCodeRunner::LaunchProcess(const FString& FullCommand, const FString&
 
 FString FClaudeCodeRunner::ReadProcessOutput()
 {
-	FString FullOutput;
-	char Buffer[4096];
+	// Accumulate raw UTF-8 bytes and convert to TCHAR exactly once at the
+	// end. Appending converted chunks to an FString re-copies the whole
+	// accumulated text as it grows and can split a multi-byte sequence at a
+	// chunk boundary; the byte buffer (exponential TArray growth) has
+	// neither problem, so capture cost stays flat as responses grow.
+	TArray<uint8> Accumulated;
+	Accumulated.Reserve(UnrealClaudeConstants::Process::PipeReadChunkBytes);
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(UnrealClaudeConstants::Process::PipeReadChunkBytes);
 
 	int StdOutReadFd = (int)(intptr_t)ReadPipe;
-	pid_t Pid = (pid_t)(intptr_t)ProcessHandle;
 
-	// Set non-blocking mode for the read pipe
-	int Flags = fcntl(StdOutReadFd, F_GETFL, 0);
-	fcntl(StdOutReadFd, F_SETFL, Flags | O_NONBLOCK);
-
-	while (!StopTaskCounter.GetValue())
+	auto AppendChunk = [this, &Accumulated, &Chunk](int32 NumBytes)
 	{
-		// Check if process is done
-		int Status;
-		pid_t Result = waitpid(Pid, &Status, WNOHANG);
+		Accumulated.Append(Chunk.GetData(), NumBytes);
 
-		// Read any available output
-		ssize_t BytesRead;
-		while ((BytesRead = read(StdOutReadFd, Buffer, sizeof(Buffer) - 1)) > 0)
+		// Progress consumers want text as it streams; convert just the new
+		// bytes (display-only - a split code point at worst renders one
+		// replacement character)
+		if (OnProgressDelegate.IsBound())
 		{
-			Buffer[BytesRead] = '\0';
-			FString OutputChunk = UTF8_TO_TCHAR(Buffer);
-			FullOutput += OutputChunk;
-
-			// Report progress
-			if (OnProgressDelegate.IsBound())
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Chunk.GetData()), NumBytes);
+			FString ProgressChunk(Converted.Length(), Converted.Get());
+			FOnClaudeProgress ProgressCopy = OnProgressDelegate;
+			AsyncTask(ENamedThreads::GameThread, [ProgressCopy, ProgressChunk]()
 			{
-				FOnClaudeProgress ProgressCopy = OnProgressDelegate;
-				FString ProgressChunk = OutputChunk;
-				AsyncTask(ENamedThreads::GameThread, [ProgressCopy, ProgressChunk]()
-				{
-					ProgressCopy.ExecuteIfBound(ProgressChunk);
-				});
-			}
+				ProgressCopy.ExecuteIfBound(ProgressChunk);
+			});
 		}
+	};
 
-		if (Result == Pid)
+	// Blocking reads on the dedicated reader thread: read() wakes the moment
+	// bytes arrive and returns 0 at EOF once the child closes its end, so
+	// there is no poll interval of chunk latency and no idle wakeups.
+	// Cancel() unblocks the read by killing the child (which closes the
+	// pipe); the caller's blocking waitpid then reaps the exit status.
+	while (!StopTaskCounter.GetValue())
+	{
+		const ssize_t BytesRead = read(StdOutReadFd, Chunk.GetData(), Chunk.Num());
+		if (BytesRead <= 0)
 		{
-			// Process finished - read any remaining output (switch to blocking for final read)
-			fcntl(StdOutReadFd, F_SETFL, Flags); // Remove non-blocking
-			while ((BytesRead = read(StdOutReadFd, Buffer, sizeof(Buffer) - 1)) > 0)
+			if (BytesRead < 0 && errno == EINTR)
 			{
-				Buffer[BytesRead] = '\0';
-				FullOutput += UTF8_TO_TCHAR(Buffer);
+				continue;
 			}
 			break;
 		}
-
-		// Small sleep to avoid busy-waiting
-		usleep(10000); // 10ms
+		AppendChunk(static_cast<int32>(BytesRead));
 	}
 
-	return FullOutput;
+	FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Accumulated.GetData()), Accumulated.Num());
+	return FString(Converted.Length(), Converted.Get());
 }
 
 void FClaudeCodeRunner::ReportError(const FString& ErrorMessage)
@@ -1072,8 +1152,315 @@ void FClaudeCodeRunner::ReportCompletion(const FString& Output, bool bSuccess)
 }
 #endif // PLATFORM_MAC
 
+// ===== Resident process mode =====
+
+bool FClaudeCodeRunner::IsResidentProcessAlive()
+{
+	if (!bResidentProcessActive || !ProcessHandle)
+	{
+		return false;
+	}
+
+#if PLATFORM_WINDOWS
+	return WaitForSingleObject(static_cast<HANDLE>(ProcessHandle), 0) == WAIT_TIMEOUT;
+#elif PLATFORM_MAC
+	int Status;
+	pid_t Pid = (pid_t)(intptr_t)ProcessHandle;
+	return waitpid(Pid, &Status, WNOHANG) == 0;
+#else
+	return false;
+#endif
+}
+
+bool FClaudeCodeRunner::WriteToProcessStdIn(const FString& Text)
+{
+	FTCHARToUTF8 Utf8Text(*Text);
+
+#if PLATFORM_WINDOWS
+	HANDLE StdInWrite = static_cast<HANDLE>(StdInWritePipe);
+	if (!StdInWrite)
+	{
+		return false;
+	}
+	DWORD BytesWritten = 0;
+	return WriteFile(StdInWrite, Utf8Text.Get(), Utf8Text.Length(), &BytesWritten, NULL) && BytesWritten == (DWORD)Utf8Text.Length();
+#elif PLATFORM_MAC
+	if (!StdInWritePipe)
+	{
+		return false;
+	}
+	int StdInWriteFd = (int)(intptr_t)StdInWritePipe;
+	return write(StdInWriteFd, Utf8Text.Get(), Utf8Text.Length()) == Utf8Text.Length();
+#else
+	return false;
+#endif
+}
+
+bool FClaudeCodeRunner::ReadAvailableProcessOutput(FString& OutChunk)
+{
+	char Buffer[4096];
+
+#if PLATFORM_WINDOWS
+	HANDLE StdOutRead = static_cast<HANDLE>(ReadPipe);
+	if (!StdOutRead)
+	{
+		return false;
+	}
+
+	DWORD Available = 0;
+	while (PeekNamedPipe(StdOutRead, NULL, 0, NULL, &Available, NULL) && Available > 0)
+	{
+		DWORD BytesRead = 0;
+		if (!ReadFile(StdOutRead, Buffer, sizeof(Buffer) - 1, &BytesRead, NULL) || BytesRead == 0)
+		{
+			break;
+		}
+		Buffer[BytesRead] = '\0';
+		OutChunk += UTF8_TO_TCHAR(Buffer);
+	}
+#elif PLATFORM_MAC
+	if (!ReadPipe)
+	{
+		return false;
+	}
+	int StdOutReadFd = (int)(intptr_t)ReadPipe;
+
+	int Flags = fcntl(StdOutReadFd, F_GETFL, 0);
+	fcntl(StdOutReadFd, F_SETFL, Flags | O_NONBLOCK);
+
+	ssize_t BytesRead;
+	while ((BytesRead = read(StdOutReadFd, Buffer, sizeof(Buffer) - 1)) > 0)
+	{
+		Buffer[BytesRead] = '\0';
+		OutChunk += UTF8_TO_TCHAR(Buffer);
+	}
+#endif
+
+	return !OutChunk.IsEmpty();
+}
+
+FString FClaudeCodeRunner::ReadResidentResponse()
+{
+	// Carry over any partial line left from the previous turn
+	FString LineBuffer = MoveTemp(ResidentOutputBuffer);
+	ResidentOutputBuffer.Empty();
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double TimeoutSeconds = CurrentConfig.TimeoutSeconds > 0.0f ? CurrentConfig.TimeoutSeconds : 300.0;
+
+	while (!StopTaskCounter.GetValue())
+	{
+		FString Chunk;
+		if (ReadAvailableProcessOutput(Chunk))
+		{
+			LineBuffer += Chunk;
+
+			// Process complete stream-json lines as they arrive
+			int32 NewlineIndex;
+			while (LineBuffer.FindChar(TEXT('\n'), NewlineIndex))
+			{
+				FString Line = LineBuffer.Left(NewlineIndex);
+				LineBuffer = LineBuffer.Mid(NewlineIndex + 1);
+				Line.TrimStartAndEndInline();
+
+				if (Line.IsEmpty())
+				{
+					continue;
+				}
+
+				// Deliver assistant text deltas as they arrive, not the raw
+				// stream-json records
+				if (OnProgressDelegate.IsBound())
+				{
+					FString TextDelta = ExtractStreamedAssistantText(Line);
+					if (!TextDelta.IsEmpty())
+					{
+						FOnClaudeProgress ProgressCopy = OnProgressDelegate;
+						AsyncTask(ENamedThreads::GameThread, [ProgressCopy, TextDelta]()
+						{
+							ProgressCopy.ExecuteIfBound(TextDelta);
+						});
+					}
+				}
+
+				// The result record terminates this turn; any trailing bytes
+				// belong to the next one
+				FString ResultText;
+				if (ExtractStreamResultText(Line, ResultText))
+				{
+					ResidentOutputBuffer = LineBuffer;
+					return ResultText;
+				}
+			}
+			continue;
+		}
+
+		if (!IsResidentProcessAlive())
+		{
+			UE_LOG(LogUnrealClaude, Warning, TEXT("Resident Claude process exited mid-turn"));
+			bResidentProcessActive = false;
+			break;
+		}
+
+		if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+		{
+			UE_LOG(LogUnrealClaude, Warning, TEXT("Resident Claude turn timed out after %.0fs"), TimeoutSeconds);
+			break;
+		}
+
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	ResidentOutputBuffer = LineBuffer;
+	return FString();
+}
+
+void FClaudeCodeRunner::ShutdownResidentProcess()
+{
+	if (!bResidentProcessActive)
+	{
+		return;
+	}
+
+	bResidentProcessActive = false;
+	ResidentOutputBuffer.Empty();
+
+	// Closing stdin signals EOF; the CLI exits cleanly on its own
+#if PLATFORM_WINDOWS
+	if (StdInWritePipe)
+	{
+		CloseHandle(static_cast<HANDLE>(StdInWritePipe));
+		StdInWritePipe = nullptr;
+	}
+	if (ProcessHandle)
+	{
+		if (WaitForSingleObject(static_cast<HANDLE>(ProcessHandle), 2000) == WAIT_TIMEOUT)
+		{
+			TerminateProcess(static_cast<HANDLE>(ProcessHandle), 1);
+		}
+	}
+#elif PLATFORM_MAC
+	if (StdInWritePipe)
+	{
+		close((int)(intptr_t)StdInWritePipe);
+		StdInWritePipe = nullptr;
+	}
+	if (ProcessHandle)
+	{
+		pid_t Pid = (pid_t)(intptr_t)ProcessHandle;
+		usleep(100000); // 100ms grace period after stdin EOF
+		int Status;
+		if (waitpid(Pid, &Status, WNOHANG) == 0)
+		{
+			kill(Pid, SIGTERM);
+		}
+	}
+#endif
+
+	CleanupHandles();
+	UE_LOG(LogUnrealClaude, Log, TEXT("Resident Claude process shut down"));
+}
+
+void FClaudeCodeRunner::ExecuteResidentProcess()
+{
+	FString ClaudePath = GetClaudePath();
+	if (ClaudePath.IsEmpty() || !IFileManager::Get().FileExists(*ClaudePath))
+	{
+		ReportError(TEXT("Claude CLI not found. Please install with: npm install -g @anthropic-ai/claude-code"));
+		return;
+	}
+
+	FString WorkingDir = CurrentConfig.WorkingDirectory;
+	if (WorkingDir.IsEmpty())
+	{
+		WorkingDir = FPaths::ProjectDir();
+	}
+
+	// Cold start only when no warm process is available
+	if (!IsResidentProcessAlive())
+	{
+		bResidentProcessActive = false;
+		ResidentOutputBuffer.Empty();
+		CleanupHandles();
+
+		if (!CreateProcessPipes())
+		{
+			ReportError(TEXT("Failed to create pipe for Claude process"));
+			return;
+		}
+
+		// stream-json on both ends keeps the session interactive: prompts go
+		// in as user-message records, responses come out as delimited records
+		FString CommandLine = TEXT("-p --verbose --input-format stream-json --output-format stream-json ");
+		CommandLine += BuildCommonArgs(CurrentConfig);
+
+		FString FullCommand = FString::Printf(TEXT("\"%s\" %s"), *ClaudePath, *CommandLine);
+		UE_LOG(LogUnrealClaude, Log, TEXT("Starting resident Claude process: %s"), *FullCommand);
+
+		if (!LaunchProcess(FullCommand, WorkingDir))
+		{
+			CleanupHandles();
+			ReportError(FString::Printf(TEXT("Failed to start resident Claude process (error %d)"), LastProcessError));
+			return;
+		}
+
+		bResidentProcessActive = true;
+	}
+	else
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Reusing warm Claude process for request"));
+	}
+
+	// Build the turn's prompt (context + user) and send it as one
+	// stream-json user message
+	FString FullPrompt;
+	if (!CurrentConfig.SystemPrompt.IsEmpty())
+	{
+		FullPrompt = FString::Printf(TEXT("[CONTEXT]\n%s\n[/CONTEXT]\n\n"), *CurrentConfig.SystemPrompt);
+	}
+	FullPrompt += CurrentConfig.Prompt;
+
+	TSharedPtr<FJsonObject> MessageJson = MakeShared<FJsonObject>();
+	MessageJson->SetStringField(TEXT("role"), TEXT("user"));
+	MessageJson->SetStringField(TEXT("content"), FullPrompt);
+
+	TSharedPtr<FJsonObject> RecordJson = MakeShared<FJsonObject>();
+	RecordJson->SetStringField(TEXT("type"), TEXT("user"));
+	RecordJson->SetObjectField(TEXT("message"), MessageJson);
+
+	FString RecordLine;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RecordLine);
+	FJsonSerializer::Serialize(RecordJson.ToSharedRef(), Writer);
+	RecordLine += TEXT("\n");
+
+	if (!WriteToProcessStdIn(RecordLine))
+	{
+		ShutdownResidentProcess();
+		ReportError(TEXT("Failed to write prompt to resident Claude process"));
+		return;
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Sent prompt to resident Claude (%d chars)"), FullPrompt.Len());
+
+	// Read until this turn's result record arrives
+	FString ResponseText = ReadResidentResponse();
+
+	const bool bSuccess = !ResponseText.IsEmpty() && !StopTaskCounter.GetValue();
+	ReportCompletion(ResponseText, bSuccess);
+}
+
 void FClaudeCodeRunner::ExecuteProcess()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FClaudeCodeRunner::ExecuteProcess);
+
+	// Resident mode keeps a warm process between requests
+	if (CurrentConfig.bUseResidentProcess)
+	{
+		ExecuteResidentProcess();
+		return;
+	}
+
 #if PLATFORM_WINDOWS
 	FString ClaudePath = GetClaudePath();
 
@@ -1146,27 +1533,14 @@ void FClaudeCodeRunner::ExecuteProcess()
 	HANDLE StdInWrite = static_cast<HANDLE>(StdInWritePipe);
 	if (StdInWrite)
 	{
+		// Prompts come straight from the request config - no temp-file round
+		// trip through disk (and through whatever scans the temp directory)
 		FString FullPrompt;
-
-		// Include system prompt context if present
-		if (!SystemPromptFilePath.IsEmpty())
+		if (!CurrentConfig.SystemPrompt.IsEmpty())
 		{
-			FString SystemPromptContent;
-			if (FFileHelper::LoadFileToString(SystemPromptContent, *SystemPromptFilePath))
-			{
-				FullPrompt = FString::Printf(TEXT("[CONTEXT]\n%s\n[/CONTEXT]\n\n"), *SystemPromptContent);
-			}
-		}
-
-		// Add user prompt
-		if (!PromptFilePath.IsEmpty())
-		{
-			FString PromptContent;
-			if (FFileHelper::LoadFileToString(PromptContent, *PromptFilePath))
-			{
-				FullPrompt += PromptContent;
-			}
+			FullPrompt = FString::Printf(TEXT("[CONTEXT]\n%s\n[/CONTEXT]\n\n"), *CurrentConfig.SystemPrompt);
 		}
+		FullPrompt += CurrentConfig.Prompt;
 
 		// Write combined prompt to stdin
 		if (!FullPrompt.IsEmpty())
@@ -1183,10 +1557,6 @@ void FClaudeCodeRunner::ExecuteProcess()
 		StdInWritePipe = nullptr;
 	}
 
-	// Clear temp file paths
-	SystemPromptFilePath.Empty();
-	PromptFilePath.Empty();
-
 	// Read output until process completes
 	FString FullOutput = ReadProcessOutput();
 
@@ -1275,27 +1645,14 @@ void FClaudeCodeRunner::ExecuteProcess()
 	int StdInWriteFd = (int)(intptr_t)StdInWritePipe;
 	if (StdInWriteFd > 0)
 	{
+		// Prompts come straight from the request config - no temp-file round
+		// trip through disk (and through whatever scans the temp directory)
 		FString FullPrompt;
-
-		// Include system prompt context if present
-		if (!SystemPromptFilePath.IsEmpty())
+		if (!CurrentConfig.SystemPrompt.IsEmpty())
 		{
-			FString SystemPromptContent;
-			if (FFileHelper::LoadFileToString(SystemPromptContent, *SystemPromptFilePath))
-			{
-				FullPrompt = FString::Printf(TEXT("[CONTEXT]\n%s\n[/CONTEXT]\n\n"), *SystemPromptContent);
-			}
-		}
-
-		// Add user prompt
-		if (!PromptFilePath.IsEmpty())
-		{
-			FString PromptContent;
-			if (FFileHelper::LoadFileToString(PromptContent, *PromptFilePath))
-			{
-				FullPrompt += PromptContent;
-			}
+			FullPrompt = FString::Printf(TEXT("[CONTEXT]\n%s\n[/CONTEXT]\n\n"), *CurrentConfig.SystemPrompt);
 		}
+		FullPrompt += CurrentConfig.Prompt;
 
 		// Write combined prompt to stdin
 		if (!FullPrompt.IsEmpty())
@@ -1311,10 +1668,6 @@ void FClaudeCodeRunner::ExecuteProcess()
 		StdInWritePipe = nullptr;
 	}
 
-	// Clear temp file paths
-	SystemPromptFilePath.Empty();
-	PromptFilePath.Empty();
-
 	// Read output until process completes
 	FString FullOutput = ReadProcessOutput();
 
@@ -13,8 +13,8 @@
 
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
-#include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Views/STableRow.h"
 #include "Widgets/Layout/SSpacer.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Text/SMultiLineEditableText.h"
@@ -27,24 +27,52 @@
 
 #define LOCTEXT_NAMESPACE "UnrealClaude"
 
+// ============================================================================
+// FChatMessageItem
+// ============================================================================
+
+void FChatMessageItem::Append(const FString& Chunk)
+{
+	Tail += Chunk;
+
+	// Seal completed paragraphs once the tail gets expensive to re-shape.
+	// Only seal at a newline - a mid-word seal would split a wrapped line
+	// across two text blocks and visibly break the layout.
+	if (Tail.Len() > UnrealClaudeConstants::UI::StreamingSealThresholdChars)
+	{
+		int32 NewlineIndex = INDEX_NONE;
+		if (Tail.FindLastChar(TEXT('\n'), NewlineIndex) && NewlineIndex > 0)
+		{
+			SealedParagraphs.Add(Tail.Left(NewlineIndex));
+			Tail.RightChopInline(NewlineIndex + 1);
+		}
+	}
+}
+
+void FChatMessageItem::SetText(const FString& InMessage)
+{
+	SealedParagraphs.Empty();
+	Tail = InMessage;
+}
+
 // ============================================================================
 // SChatMessage
 // ============================================================================
 
 void SChatMessage::Construct(const FArguments& InArgs)
 {
-	bool bIsUser = InArgs._IsUser;
-	FString Message = InArgs._Message;
-	
+	Item = InArgs._Item;
+	check(Item.IsValid());
+	bool bIsUser = Item->bIsUser;
+
 	// Different colors for user vs assistant
-	FLinearColor BackgroundColor = bIsUser 
+	FLinearColor BackgroundColor = bIsUser
 		? FLinearColor(0.15f, 0.15f, 0.2f, 1.0f)  // Dark blue for user
 		: FLinearColor(0.1f, 0.1f, 0.1f, 1.0f);   // Dark gray for assistant
-	
-	FLinearColor TextColor = FLinearColor::White;
-	
+
 	FString RoleLabel = bIsUser ? TEXT("You") : TEXT("Claude");
-	
+
+	TSharedPtr<FChatMessageItem> LocalItem = Item;
 	ChildSlot
 	[
 		SNew(SBorder)
@@ -53,7 +81,7 @@ void SChatMessage::Construct(const FArguments& InArgs)
 		.Padding(FMargin(10.0f, 8.0f))
 		[
 			SNew(SVerticalBox)
-			
+
 			// Role label
 			+ SVerticalBox::Slot()
 			.AutoHeight()
@@ -64,19 +92,60 @@ void SChatMessage::Construct(const FArguments& InArgs)
 				.TextStyle(FAppStyle::Get(), "SmallText")
 				.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
 			]
-			
-			// Message content
+
+			// Message content: sealed paragraph blocks followed by the live
+			// tail. The tail reads through the item so streamed appends show
+			// up without a widget pointer into the list, and per-chunk
+			// re-shaping covers only the tail, never the sealed paragraphs.
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			[
-				SNew(STextBlock)
-				.Text(FText::FromString(Message))
-				.TextStyle(FAppStyle::Get(), "NormalText")
-				.ColorAndOpacity(FSlateColor(TextColor))
-				.AutoWrapText(true)
+				SAssignNew(ParagraphBox, SVerticalBox)
+
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(STextBlock)
+					.Text_Lambda([LocalItem]() { return FText::FromString(LocalItem->Tail); })
+					.TextStyle(FAppStyle::Get(), "NormalText")
+					.ColorAndOpacity(FSlateColor(FLinearColor::White))
+					.AutoWrapText(true)
+				]
 			]
 		]
 	];
+
+	// Rows regenerate as the list virtualizes; rebuild any paragraphs the
+	// item had already sealed
+	for (const FString& Paragraph : Item->SealedParagraphs)
+	{
+		InsertSealedParagraph(Paragraph, NumSealedSynced);
+		++NumSealedSynced;
+	}
+}
+
+void SChatMessage::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	while (NumSealedSynced < Item->SealedParagraphs.Num())
+	{
+		InsertSealedParagraph(Item->SealedParagraphs[NumSealedSynced], NumSealedSynced);
+		++NumSealedSynced;
+	}
+}
+
+void SChatMessage::InsertSealedParagraph(const FString& Paragraph, int32 Index)
+{
+	ParagraphBox->InsertSlot(Index)
+	.AutoHeight()
+	[
+		SNew(STextBlock)
+		.Text(FText::FromString(Paragraph))
+		.TextStyle(FAppStyle::Get(), "NormalText")
+		.ColorAndOpacity(FSlateColor(FLinearColor::White))
+		.AutoWrapText(true)
+	];
 }
 
 // ============================================================================
@@ -85,6 +154,10 @@ void SChatMessage::Construct(const FArguments& InArgs)
 
 void SClaudeEditorWidget::Construct(const FArguments& InArgs)
 {
+	// Checked once up front (and again on status events) - the PATH probe is
+	// far too expensive for a per-frame Slate attribute
+	bClaudeAvailable = FClaudeCodeRunner::IsClaudeAvailable();
+
 	ChildSlot
 	[
 		SNew(SVerticalBox)
@@ -148,20 +221,28 @@ void SClaudeEditorWidget::Construct(const FArguments& InArgs)
 		WelcomeMessage += TEXT("\nType your question below and press Enter or click Send.");
 		AddMessage(WelcomeMessage, false);
 	}
+
+	// Status display is event-driven: the subsystem broadcasts on busy/session
+	// changes and we push the new state into the child widgets
+	StatusChangedHandle = FClaudeCodeSubsystem::Get().OnStatusChanged.AddSP(
+		this, &SClaudeEditorWidget::OnSubsystemStatusChanged);
 }
 
 SClaudeEditorWidget::~SClaudeEditorWidget()
 {
+	// Unsubscribe before cancelling - cancel itself broadcasts a status change
+	FClaudeCodeSubsystem::Get().OnStatusChanged.Remove(StatusChangedHandle);
+
 	// Cancel any pending requests
 	FClaudeCodeSubsystem::Get().CancelCurrentRequest();
 }
 
 TSharedRef<SWidget> SClaudeEditorWidget::BuildToolbar()
 {
-	return SNew(SClaudeToolbar)
-		.bUE57ContextEnabled_Lambda([this]() { return bIncludeUE57Context; })
-		.bProjectContextEnabled_Lambda([this]() { return bIncludeProjectContext; })
-		.bRestoreEnabled_Lambda([this]() { return FClaudeCodeSubsystem::Get().HasSavedSession(); })
+	SAssignNew(Toolbar, SClaudeToolbar)
+		.bUE57ContextEnabled(bIncludeUE57Context)
+		.bProjectContextEnabled(bIncludeProjectContext)
+		.bRestoreEnabled(FClaudeCodeSubsystem::Get().HasSavedSession())
 		.OnUE57ContextChanged_Lambda([this](bool bEnabled) { bIncludeUE57Context = bEnabled; })
 		.OnProjectContextChanged_Lambda([this](bool bEnabled) { bIncludeProjectContext = bEnabled; })
 		.OnRefreshContext_Lambda([this]() { RefreshProjectContext(); })
@@ -169,26 +250,49 @@ TSharedRef<SWidget> SClaudeEditorWidget::BuildToolbar()
 		.OnNewSession_Lambda([this]() { NewSession(); })
 		.OnClear_Lambda([this]() { ClearChat(); })
 		.OnCopyLast_Lambda([this]() { CopyToClipboard(); });
+
+	return Toolbar.ToSharedRef();
 }
 
 TSharedRef<SWidget> SClaudeEditorWidget::BuildChatArea()
 {
+	// Virtualized: all-day sessions accumulate thousands of messages, and a
+	// widget per message made every input keystroke re-layout the whole stack
 	return SNew(SBorder)
 		.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
 		.Padding(4.0f)
 		[
-			SAssignNew(ChatScrollBox, SScrollBox)
-			+ SScrollBox::Slot()
-			[
-				SAssignNew(ChatMessagesBox, SVerticalBox)
-			]
+			SAssignNew(ChatListView, SListView<TSharedPtr<FChatMessageItem>>)
+			.ListItemsSource(&ChatMessages)
+			.OnGenerateRow(this, &SClaudeEditorWidget::OnGenerateMessageRow)
+			.SelectionMode(ESelectionMode::None)
+		];
+}
+
+TSharedRef<ITableRow> SClaudeEditorWidget::OnGenerateMessageRow(TSharedPtr<FChatMessageItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FChatMessageItem>>, OwnerTable)
+		.Padding(4.0f)
+		.ShowSelection(false)
+		[
+			SNew(SChatMessage)
+			.Item(Item)
 		];
 }
 
+void SClaudeEditorWidget::ScrollChatToBottom()
+{
+	if (ChatListView.IsValid())
+	{
+		ChatListView->RequestListRefresh();
+		ChatListView->ScrollToBottom();
+	}
+}
+
 TSharedRef<SWidget> SClaudeEditorWidget::BuildInputArea()
 {
 	SAssignNew(InputArea, SClaudeInputArea)
-		.bIsWaiting_Lambda([this]() { return bIsWaitingForResponse; })
+		.bIsWaiting(bIsWaitingForResponse)
 		.OnSend_Lambda([this]() { SendMessage(); })
 		.OnCancel_Lambda([this]() { CancelRequest(); })
 		.OnTextChanged_Lambda([this](const FString& Text) { CurrentInputText = Text; });
@@ -204,14 +308,14 @@ TSharedRef<SWidget> SClaudeEditorWidget::BuildStatusBar()
 		[
 			SNew(SHorizontalBox)
 			
-			// Status indicator
+			// Status indicator, updated from OnSubsystemStatusChanged
 			+ SHorizontalBox::Slot()
 			.AutoWidth()
 			.VAlign(VAlign_Center)
 			[
-				SNew(STextBlock)
-				.Text(this, &SClaudeEditorWidget::GetStatusText)
-				.ColorAndOpacity(this, &SClaudeEditorWidget::GetStatusColor)
+				SAssignNew(StatusTextBlock, STextBlock)
+				.Text(GetStatusText())
+				.ColorAndOpacity(GetStatusColor())
 			]
 			
 			+ SHorizontalBox::Slot()
@@ -235,23 +339,8 @@ TSharedRef<SWidget> SClaudeEditorWidget::BuildStatusBar()
 
 void SClaudeEditorWidget::AddMessage(const FString& Message, bool bIsUser)
 {
-	if (ChatMessagesBox.IsValid())
-	{
-		ChatMessagesBox->AddSlot()
-		.AutoHeight()
-		.Padding(4.0f)
-		[
-			SNew(SChatMessage)
-			.Message(Message)
-			.IsUser(bIsUser)
-		];
-		
-		// Scroll to bottom
-		if (ChatScrollBox.IsValid())
-		{
-			ChatScrollBox->ScrollToEnd();
-		}
-	}
+	ChatMessages.Add(MakeShared<FChatMessageItem>(Message, bIsUser));
+	ScrollChatToBottom();
 }
 
 void SClaudeEditorWidget::SendMessage()
@@ -278,8 +367,8 @@ void SClaudeEditorWidget::SendMessage()
 		InputArea->ClearText();
 	}
 
-	// Set waiting state
-	bIsWaitingForResponse = true;
+	// The subsystem flips to busy inside SendPrompt and broadcasts; our status
+	// handler updates bIsWaitingForResponse and the child widgets from that
 
 	// Start streaming response display
 	StartStreamingResponse();
@@ -296,8 +385,6 @@ void SClaudeEditorWidget::SendMessage()
 
 void SClaudeEditorWidget::OnClaudeResponse(const FString& Response, bool bSuccess)
 {
-	bIsWaitingForResponse = false;
-
 	// Finalize the streaming response
 	FinalizeStreamingResponse();
 
@@ -323,9 +410,11 @@ void SClaudeEditorWidget::OnClaudeResponse(const FString& Response, bool bSucces
 
 void SClaudeEditorWidget::ClearChat()
 {
-	if (ChatMessagesBox.IsValid())
+	ChatMessages.Empty();
+	StreamingItem.Reset();
+	if (ChatListView.IsValid())
 	{
-		ChatMessagesBox->ClearChildren();
+		ChatListView->RequestListRefresh();
 	}
 
 	FClaudeCodeSubsystem::Get().ClearHistory();
@@ -339,7 +428,6 @@ void SClaudeEditorWidget::ClearChat()
 void SClaudeEditorWidget::CancelRequest()
 {
 	FClaudeCodeSubsystem::Get().CancelCurrentRequest();
-	bIsWaitingForResponse = false;
 	AddMessage(TEXT("Request cancelled."), false);
 }
 
@@ -359,10 +447,8 @@ void SClaudeEditorWidget::RestoreSession()
 	if (Subsystem.LoadSession())
 	{
 		// Clear current chat display
-		if (ChatMessagesBox.IsValid())
-		{
-			ChatMessagesBox->ClearChildren();
-		}
+		ChatMessages.Empty();
+		StreamingItem.Reset();
 
 		// Restore messages to chat display
 		const TArray<TPair<FString, FString>>& History = Subsystem.GetHistory();
@@ -393,9 +479,11 @@ void SClaudeEditorWidget::RestoreSession()
 void SClaudeEditorWidget::NewSession()
 {
 	// Clear the chat display
-	if (ChatMessagesBox.IsValid())
+	ChatMessages.Empty();
+	StreamingItem.Reset();
+	if (ChatListView.IsValid())
 	{
-		ChatMessagesBox->ClearChildren();
+		ChatListView->RequestListRefresh();
 	}
 
 	// Clear the subsystem history
@@ -412,7 +500,28 @@ void SClaudeEditorWidget::NewSession()
 
 bool SClaudeEditorWidget::IsClaudeAvailable() const
 {
-	return FClaudeCodeRunner::IsClaudeAvailable();
+	return bClaudeAvailable;
+}
+
+void SClaudeEditorWidget::OnSubsystemStatusChanged()
+{
+	FClaudeCodeSubsystem& Subsystem = FClaudeCodeSubsystem::Get();
+	bIsWaitingForResponse = Subsystem.IsBusy();
+	bClaudeAvailable = FClaudeCodeRunner::IsClaudeAvailable();
+
+	if (InputArea.IsValid())
+	{
+		InputArea->SetIsWaiting(bIsWaitingForResponse);
+	}
+	if (Toolbar.IsValid())
+	{
+		Toolbar->SetRestoreEnabled(Subsystem.HasSavedSession());
+	}
+	if (StatusTextBlock.IsValid())
+	{
+		StatusTextBlock->SetText(GetStatusText());
+		StatusTextBlock->SetColorAndOpacity(GetStatusColor());
+	}
 }
 
 FText SClaudeEditorWidget::GetStatusText() const
@@ -449,82 +558,51 @@ void SClaudeEditorWidget::StartStreamingResponse()
 {
 	StreamingResponse.Empty();
 
-	if (ChatMessagesBox.IsValid())
-	{
-		// Create a streaming message container with live-updating text
-		ChatMessagesBox->AddSlot()
-		.AutoHeight()
-		.Padding(4.0f)
-		[
-			SNew(SBorder)
-			.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
-			.BorderBackgroundColor(FLinearColor(0.1f, 0.1f, 0.1f, 1.0f))
-			.Padding(FMargin(10.0f, 8.0f))
-			[
-				SNew(SVerticalBox)
-
-				// Role label
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				.Padding(0, 0, 0, 4)
-				[
-					SNew(STextBlock)
-					.Text(FText::FromString(TEXT("Claude")))
-					.TextStyle(FAppStyle::Get(), "SmallText")
-					.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
-				]
-
-				// Streaming message content
-				+ SVerticalBox::Slot()
-				.AutoHeight()
-				[
-					SAssignNew(StreamingTextBlock, STextBlock)
-					.Text(FText::FromString(TEXT("Thinking...")))
-					.TextStyle(FAppStyle::Get(), "NormalText")
-					.ColorAndOpacity(FSlateColor(FLinearColor::White))
-					.AutoWrapText(true)
-				]
-			]
-		];
-
-		// Scroll to bottom
-		if (ChatScrollBox.IsValid())
-		{
-			ChatScrollBox->ScrollToEnd();
-		}
-	}
+	// The streaming response is an ordinary transcript entry; rows read their
+	// item's text, so updating the item updates whatever row is on screen
+	StreamingItem = MakeShared<FChatMessageItem>(TEXT("Thinking..."), false);
+	ChatMessages.Add(StreamingItem);
+	ScrollChatToBottom();
 }
 
 void SClaudeEditorWidget::OnClaudeProgress(const FString& PartialOutput)
 {
 	// Append to streaming response
+	const bool bFirstChunk = StreamingResponse.IsEmpty();
 	StreamingResponse += PartialOutput;
 
-	// Update the streaming text block
-	if (StreamingTextBlock.IsValid())
+	// Update the streaming transcript entry; the first chunk replaces the
+	// "Thinking..." placeholder, later ones append to the live tail only
+	if (StreamingItem.IsValid())
 	{
-		StreamingTextBlock->SetText(FText::FromString(StreamingResponse));
+		if (bFirstChunk)
+		{
+			StreamingItem->SetText(StreamingResponse);
+		}
+		else
+		{
+			StreamingItem->Append(PartialOutput);
+		}
 	}
 
 	// Auto-scroll to bottom as content streams in
-	if (ChatScrollBox.IsValid())
+	if (ChatListView.IsValid())
 	{
-		ChatScrollBox->ScrollToEnd();
+		ChatListView->ScrollToBottom();
 	}
 }
 
 void SClaudeEditorWidget::FinalizeStreamingResponse()
 {
-	// The streaming text block remains as the final response
-	// Just update it with the complete text if we have streaming content
-	if (StreamingTextBlock.IsValid() && !StreamingResponse.IsEmpty())
+	// The streaming entry remains as the final response; its appended text is
+	// already complete, so only the copy buffer needs updating
+	if (StreamingItem.IsValid() && !StreamingResponse.IsEmpty())
 	{
-		StreamingTextBlock->SetText(FText::FromString(StreamingResponse));
 		LastResponse = StreamingResponse;
 	}
 
 	// Clear the reference (we don't need to update it anymore)
-	StreamingTextBlock.Reset();
+	StreamingItem.Reset();
 }
 
 void SClaudeEditorWidget::AppendToLastResponse(const FString& Text)
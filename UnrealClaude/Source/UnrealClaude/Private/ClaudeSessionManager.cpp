@@ -3,18 +3,85 @@
 #include "ClaudeSessionManager.h"
 #include "UnrealClaudeConstants.h"
 #include "JsonUtils.h"
+#include "MCP/MCPMemoryStats.h"
 #include "UnrealClaudeModule.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Compression.h"
 #include "HAL/FileManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Serialization/MemoryWriter.h"
+
+LLM_DECLARE_TAG(UnrealClaude);
 
 FClaudeSessionManager::FClaudeSessionManager()
 	: MaxHistorySize(UnrealClaudeConstants::Session::MaxHistorySize)
+	, JournalEntriesSinceCompaction(0)
+	, ActiveSessionName(TEXT("default"))
+{
+	// The subsystem keeps us private, so the memory gauge is registered
+	// from in here rather than by the owner
+	FMCPMemoryStats::Get().RegisterProvider(TEXT("session_history"), [this]
+	{
+		return GetEstimatedMemoryBytes();
+	});
+}
+
+FClaudeSessionManager::~FClaudeSessionManager()
 {
+	FMCPMemoryStats::Get().UnregisterProvider(TEXT("session_history"));
+}
+
+uint64 FClaudeSessionManager::GetEstimatedMemoryBytes() const
+{
+	auto HistoryBytes = [](const TArray<TPair<FString, FString>>& History)
+	{
+		uint64 Bytes = History.GetAllocatedSize();
+		for (const TPair<FString, FString>& Exchange : History)
+		{
+			Bytes += Exchange.Key.GetAllocatedSize() + Exchange.Value.GetAllocatedSize();
+		}
+		return Bytes;
+	};
+
+	uint64 Bytes = HistoryBytes(ConversationHistory);
+	Bytes += ResidentSessions.GetAllocatedSize() + ResidentSessionOrder.GetAllocatedSize();
+	for (const auto& Pair : ResidentSessions)
+	{
+		Bytes += Pair.Key.GetAllocatedSize() + HistoryBytes(Pair.Value);
+	}
+	return Bytes;
+}
+
+FString FClaudeSessionManager::SanitizeSessionName(const FString& Name)
+{
+	FString Sanitized;
+	Sanitized.Reserve(Name.Len());
+	for (TCHAR Ch : Name)
+	{
+		if (FChar::IsAlnum(Ch) || Ch == TEXT('-') || Ch == TEXT('_'))
+		{
+			Sanitized.AppendChar(Ch);
+		}
+	}
+	return Sanitized;
+}
+
+FString FClaudeSessionManager::SessionFileBase(const FString& Name)
+{
+	// The default session keeps the legacy file names so pre-existing
+	// sessions load unchanged
+	if (Name == TEXT("default"))
+	{
+		return TEXT("session");
+	}
+	return TEXT("session_") + Name;
 }
 
 void FClaudeSessionManager::AddExchange(const FString& Prompt, const FString& Response)
 {
+	LLM_SCOPE_BYTAG(UnrealClaude);
+
 	ConversationHistory.Add(TPair<FString, FString>(Prompt, Response));
 
 	// Trim old history if exceeds max size
@@ -22,6 +89,57 @@ void FClaudeSessionManager::AddExchange(const FString& Prompt, const FString& Re
 	{
 		ConversationHistory.RemoveAt(0);
 	}
+
+	// Count caps alone are blind to exchange size (50 vs 50,000 tokens);
+	// the token budget is what actually bounds prompt assembly
+	TrimHistoryToTokenBudget();
+
+	// Persist just this exchange; the full snapshot is only rewritten when
+	// the journal is compacted
+	AppendToJournal(Prompt, Response);
+}
+
+int32 FClaudeSessionManager::EstimateExchangeTokens(const TPair<FString, FString>& Exchange)
+{
+	return (Exchange.Key.Len() + Exchange.Value.Len()) / UnrealClaudeConstants::Context::ApproxCharsPerToken;
+}
+
+int32 FClaudeSessionManager::GetEstimatedHistoryTokens() const
+{
+	int32 Total = 0;
+	for (const TPair<FString, FString>& Exchange : ConversationHistory)
+	{
+		Total += EstimateExchangeTokens(Exchange);
+	}
+	return Total;
+}
+
+void FClaudeSessionManager::TrimHistoryToTokenBudget()
+{
+	int32 Total = GetEstimatedHistoryTokens();
+	while (ConversationHistory.Num() > 1 && Total > UnrealClaudeConstants::Session::MaxHistoryTokens)
+	{
+		Total -= EstimateExchangeTokens(ConversationHistory[0]);
+		ConversationHistory.RemoveAt(0);
+	}
+}
+
+bool FClaudeSessionManager::CompactOldExchanges(int32 NumToReplace, const FString& DigestText)
+{
+	if (NumToReplace <= 0 || NumToReplace > ConversationHistory.Num() || DigestText.IsEmpty())
+	{
+		return false;
+	}
+
+	ConversationHistory.RemoveAt(0, NumToReplace);
+	ConversationHistory.Insert(
+		TPair<FString, FString>(TEXT("[Earlier conversation digest]"), DigestText), 0);
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Compacted %d old exchanges into a digest (~%d tokens of history)"),
+		NumToReplace, GetEstimatedHistoryTokens());
+
+	// Snapshot and journal no longer match memory; rewrite the snapshot now
+	return CompactJournal();
 }
 
 void FClaudeSessionManager::ClearHistory()
@@ -32,124 +150,599 @@ void FClaudeSessionManager::ClearHistory()
 FString FClaudeSessionManager::GetSessionFilePath() const
 {
 	FString SaveDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"));
-	return FPaths::Combine(SaveDir, TEXT("session.json"));
+	return FPaths::Combine(SaveDir, SessionFileBase(ActiveSessionName) + TEXT(".json"));
 }
 
-bool FClaudeSessionManager::HasSavedSession() const
+FString FClaudeSessionManager::GetJournalFilePath() const
 {
-	return IFileManager::Get().FileExists(*GetSessionFilePath());
+	FString SaveDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"));
+	return FPaths::Combine(SaveDir, SessionFileBase(ActiveSessionName) + TEXT(".journal"));
 }
 
-bool FClaudeSessionManager::SaveSession()
+FString FClaudeSessionManager::GetBinarySnapshotFilePath() const
 {
-	if (ConversationHistory.Num() == 0)
+	FString SaveDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"));
+	return FPaths::Combine(SaveDir, SessionFileBase(ActiveSessionName) + TEXT(".ucsession"));
+}
+
+FString FClaudeSessionManager::GetIndexFilePath() const
+{
+	FString SaveDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"));
+	return FPaths::Combine(SaveDir, TEXT("sessions-index.json"));
+}
+
+void FClaudeSessionManager::UpdateSessionIndex() const
+{
+	// Carry forward the other sessions' entries and refresh only the active
+	// one; the index never holds message bodies, just listing metadata
+	TArray<TSharedPtr<FJsonValue>> Entries;
+
+	FString IndexContent;
+	if (FFileHelper::LoadFileToString(IndexContent, *GetIndexFilePath()))
 	{
-		return true; // Nothing to save
+		TSharedPtr<FJsonObject> Root = FJsonUtils::Parse(IndexContent);
+		TArray<TSharedPtr<FJsonValue>> Existing;
+		if (Root.IsValid() && FJsonUtils::GetArrayField(Root, TEXT("sessions"), Existing))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : Existing)
+			{
+				const TSharedPtr<FJsonObject>* Entry;
+				FString Name;
+				if (Value->TryGetObject(Entry) &&
+					FJsonUtils::GetStringField(*Entry, TEXT("name"), Name) &&
+					Name != ActiveSessionName)
+				{
+					Entries.Add(Value);
+				}
+			}
+		}
 	}
 
-	FString SessionPath = GetSessionFilePath();
-	FString SaveDir = FPaths::GetPath(SessionPath);
+	TSharedPtr<FJsonObject> ActiveEntry = MakeShared<FJsonObject>();
+	ActiveEntry->SetStringField(TEXT("name"), ActiveSessionName);
+	ActiveEntry->SetStringField(TEXT("last_updated"), FDateTime::UtcNow().ToString(TEXT("%Y-%m-%dT%H:%M:%SZ")));
+	ActiveEntry->SetNumberField(TEXT("messages"), ConversationHistory.Num());
+	Entries.Add(MakeShared<FJsonValueObject>(ActiveEntry));
 
-	// Create directory if needed
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetArrayField(TEXT("sessions"), Entries);
+
+	FString SaveDir = FPaths::GetPath(GetIndexFilePath());
 	if (!IFileManager::Get().DirectoryExists(*SaveDir))
 	{
 		IFileManager::Get().MakeDirectory(*SaveDir, true);
 	}
+	FFileHelper::SaveStringToFile(FJsonUtils::Stringify(Root, true), *GetIndexFilePath(),
+		FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
 
-	// Build JSON structure
-	TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+TArray<FClaudeSessionInfo> FClaudeSessionManager::ListSessions() const
+{
+	TArray<FClaudeSessionInfo> Sessions;
 
-	// Create messages array
-	TArray<TSharedPtr<FJsonValue>> MessagesArray;
-	for (const TPair<FString, FString>& Exchange : ConversationHistory)
+	FString IndexContent;
+	if (!FFileHelper::LoadFileToString(IndexContent, *GetIndexFilePath()))
 	{
-		TSharedPtr<FJsonObject> MessageObject = MakeShared<FJsonObject>();
-		MessageObject->SetStringField(TEXT("user"), Exchange.Key);
-		MessageObject->SetStringField(TEXT("assistant"), Exchange.Value);
-		MessagesArray.Add(MakeShared<FJsonValueObject>(MessageObject));
+		// No index yet - the active session is still the only known one
+		FClaudeSessionInfo Active;
+		Active.Name = ActiveSessionName;
+		Active.MessageCount = ConversationHistory.Num();
+		Sessions.Add(MoveTemp(Active));
+		return Sessions;
 	}
 
-	RootObject->SetArrayField(TEXT("messages"), MessagesArray);
+	TSharedPtr<FJsonObject> Root = FJsonUtils::Parse(IndexContent);
+	TArray<TSharedPtr<FJsonValue>> Entries;
+	if (Root.IsValid() && FJsonUtils::GetArrayField(Root, TEXT("sessions"), Entries))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : Entries)
+		{
+			const TSharedPtr<FJsonObject>* Entry;
+			if (Value->TryGetObject(Entry))
+			{
+				FClaudeSessionInfo Info;
+				if (FJsonUtils::GetStringField(*Entry, TEXT("name"), Info.Name))
+				{
+					FJsonUtils::GetStringField(*Entry, TEXT("last_updated"), Info.LastUpdated);
+					double Count = 0.0;
+					if ((*Entry)->TryGetNumberField(TEXT("messages"), Count))
+					{
+						Info.MessageCount = static_cast<int32>(Count);
+					}
+					Sessions.Add(MoveTemp(Info));
+				}
+			}
+		}
+	}
 
-	// Add timestamp
-	FString Timestamp = FDateTime::UtcNow().ToString(TEXT("%Y-%m-%dT%H:%M:%SZ"));
-	RootObject->SetStringField(TEXT("last_updated"), Timestamp);
+	return Sessions;
+}
+
+void FClaudeSessionManager::StashActiveSession()
+{
+	ResidentSessions.Add(ActiveSessionName, MoveTemp(ConversationHistory));
+	ConversationHistory.Empty();
+
+	ResidentSessionOrder.Remove(ActiveSessionName);
+	ResidentSessionOrder.Add(ActiveSessionName);
 
-	// Serialize and write
-	FString JsonString = FJsonUtils::Stringify(RootObject, true);
-	if (JsonString.IsEmpty())
+	// Memory bound: evict the least recently used histories; they are safe
+	// on disk and reload lazily on the next switch
+	while (ResidentSessionOrder.Num() > UnrealClaudeConstants::Session::MaxResidentSessions)
 	{
-		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to serialize session JSON"));
+		ResidentSessions.Remove(ResidentSessionOrder[0]);
+		ResidentSessionOrder.RemoveAt(0);
+	}
+}
+
+bool FClaudeSessionManager::SwitchSession(const FString& Name)
+{
+	const FString Sanitized = SanitizeSessionName(Name);
+	if (Sanitized.IsEmpty())
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Invalid session name: %s"), *Name);
 		return false;
 	}
 
-	if (!FFileHelper::SaveStringToFile(JsonString, *SessionPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	if (Sanitized == ActiveSessionName)
+	{
+		return true;
+	}
+
+	// Exchanges are already durable in the outgoing session's journal; the
+	// index entry is refreshed so listings stay current
+	UpdateSessionIndex();
+	StashActiveSession();
+
+	ActiveSessionName = Sanitized;
+	JournalEntriesSinceCompaction = 0;
+
+	if (TArray<TPair<FString, FString>>* Resident = ResidentSessions.Find(Sanitized))
+	{
+		// Warm switch: no disk read at all
+		ConversationHistory = MoveTemp(*Resident);
+		ResidentSessions.Remove(Sanitized);
+		ResidentSessionOrder.Remove(Sanitized);
+		UE_LOG(LogUnrealClaude, Log, TEXT("Switched to resident session '%s' (%d messages)"),
+			*ActiveSessionName, ConversationHistory.Num());
+	}
+	else if (HasSavedSession())
 	{
-		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to save session to: %s"), *SessionPath);
+		LoadSession();
+	}
+	else
+	{
+		ConversationHistory.Empty();
+		UE_LOG(LogUnrealClaude, Log, TEXT("Created new session '%s'"), *ActiveSessionName);
+	}
+
+	UpdateSessionIndex();
+	return true;
+}
+
+bool FClaudeSessionManager::HasSavedSession() const
+{
+	return IFileManager::Get().FileExists(*GetBinarySnapshotFilePath())
+		|| IFileManager::Get().FileExists(*GetSessionFilePath())
+		|| IFileManager::Get().FileExists(*GetJournalFilePath());
+}
+
+bool FClaudeSessionManager::WriteBinarySnapshot() const
+{
+	using namespace UnrealClaudeConstants::Session;
+
+	const FString SnapshotPath = GetBinarySnapshotFilePath();
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*SnapshotPath));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to open session snapshot for writing: %s"), *SnapshotPath);
 		return false;
 	}
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("Session saved to: %s (%d messages)"), *SessionPath, ConversationHistory.Num());
+	uint32 Magic = SnapshotMagic;
+	uint32 Version = SnapshotVersion;
+	*Writer << Magic << Version;
+
+	// Record payload: length-prefixed UTF-8 prompt then response. The record
+	// header carries stored and raw sizes so a reader can skip or decompress
+	// without understanding the payload.
+	TArray<uint64> RecordOffsets;
+	RecordOffsets.Reserve(ConversationHistory.Num());
+	TArray<uint8> Payload;
+	TArray<uint8> Compressed;
+	for (const TPair<FString, FString>& Exchange : ConversationHistory)
+	{
+		Payload.Reset();
+		FMemoryWriter PayloadWriter(Payload);
+		auto WriteString = [&PayloadWriter](const FString& Str)
+		{
+			FTCHARToUTF8 Utf8(*Str);
+			uint32 Bytes = static_cast<uint32>(Utf8.Length());
+			PayloadWriter << Bytes;
+			PayloadWriter.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Bytes);
+		};
+		WriteString(Exchange.Key);
+		WriteString(Exchange.Value);
+
+		// Compress only when it pays: small records skip the attempt, and an
+		// incompressible record falls back to raw storage
+		uint8 Flags = 0;
+		if (Payload.Num() >= SnapshotCompressMinBytes)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, Payload.Num());
+			Compressed.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+			if (FCompression::CompressMemory(NAME_LZ4, Compressed.GetData(), CompressedSize,
+					Payload.GetData(), Payload.Num()) &&
+				CompressedSize < Payload.Num())
+			{
+				Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+				Flags = 1;
+			}
+		}
+
+		RecordOffsets.Add(static_cast<uint64>(Writer->Tell()));
+		TArray<uint8>& Stored = Flags ? Compressed : Payload;
+		uint32 StoredBytes = Stored.Num();
+		uint32 RawBytes = Payload.Num();
+		*Writer << Flags << StoredBytes << RawBytes;
+		Writer->Serialize(Stored.GetData(), Stored.Num());
+	}
+
+	// Trailing offset index, then a pointer to it as the last 8 bytes: a
+	// reader seeks to the trailer, jumps to the index, and loads only the
+	// records it wants
+	uint64 IndexOffset = static_cast<uint64>(Writer->Tell());
+	uint32 RecordCount = RecordOffsets.Num();
+	*Writer << RecordCount;
+	for (uint64& Offset : RecordOffsets)
+	{
+		*Writer << Offset;
+	}
+	*Writer << IndexOffset;
+
+	Writer->Close();
+	if (Writer->IsError())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to write session snapshot: %s"), *SnapshotPath);
+		return false;
+	}
 	return true;
 }
 
-bool FClaudeSessionManager::LoadSession()
+bool FClaudeSessionManager::LoadBinarySnapshot(int32 MaxRecords)
 {
-	FString SessionPath = GetSessionFilePath();
+	using namespace UnrealClaudeConstants::Session;
 
-	if (!IFileManager::Get().FileExists(*SessionPath))
+	const FString SnapshotPath = GetBinarySnapshotFilePath();
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SnapshotPath));
+	if (!Reader.IsValid())
 	{
-		UE_LOG(LogUnrealClaude, Log, TEXT("No previous session found at: %s"), *SessionPath);
 		return false;
 	}
 
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *SessionPath))
+	const int64 FileSize = Reader->TotalSize();
+	const int64 MinimumSize = sizeof(uint32) * 3 + sizeof(uint64); // header + empty index + trailer
+	if (FileSize < MinimumSize)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot truncated, ignoring: %s"), *SnapshotPath);
+		return false;
+	}
+
+	uint32 Magic = 0, Version = 0;
+	*Reader << Magic << Version;
+	if (Magic != SnapshotMagic)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot has wrong magic, ignoring: %s"), *SnapshotPath);
+		return false;
+	}
+	if (Version > SnapshotVersion)
+	{
+		// Written by a newer plugin; refusing beats misparsing
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot version %u is newer than supported %u, ignoring: %s"),
+			Version, SnapshotVersion, *SnapshotPath);
+		return false;
+	}
+
+	// Trailer -> index -> the one offset we need. Only the loaded tail is
+	// ever read, so a year-old 40MB session restores as fast as a fresh one.
+	Reader->Seek(FileSize - sizeof(uint64));
+	uint64 IndexOffset = 0;
+	*Reader << IndexOffset;
+	if (IndexOffset < sizeof(uint32) * 2 || static_cast<int64>(IndexOffset) >= FileSize)
 	{
-		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to load session from: %s"), *SessionPath);
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot index offset invalid, ignoring: %s"), *SnapshotPath);
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> RootObject = FJsonUtils::Parse(JsonString);
-	if (!RootObject.IsValid())
+	Reader->Seek(static_cast<int64>(IndexOffset));
+	uint32 RecordCount = 0;
+	*Reader << RecordCount;
+	if (static_cast<int64>(IndexOffset) + sizeof(uint32) + static_cast<int64>(RecordCount) * sizeof(uint64) + sizeof(uint64) > FileSize)
 	{
-		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to parse session JSON"));
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot index truncated, ignoring: %s"), *SnapshotPath);
 		return false;
 	}
 
+	const uint32 FirstRecord = RecordCount > static_cast<uint32>(MaxRecords)
+		? RecordCount - static_cast<uint32>(MaxRecords)
+		: 0;
+	if (RecordCount == 0)
+	{
+		return true; // Valid, just empty
+	}
+
+	uint64 StartOffset = 0;
+	Reader->Seek(static_cast<int64>(IndexOffset) + sizeof(uint32) + static_cast<int64>(FirstRecord) * sizeof(uint64));
+	*Reader << StartOffset;
+	if (StartOffset < sizeof(uint32) * 2 || StartOffset >= IndexOffset)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot record offset invalid, ignoring: %s"), *SnapshotPath);
+		return false;
+	}
+
+	Reader->Seek(static_cast<int64>(StartOffset));
+	TArray<uint8> Stored;
+	TArray<uint8> Raw;
+	for (uint32 Index = FirstRecord; Index < RecordCount; ++Index)
+	{
+		uint8 Flags = 0;
+		uint32 StoredBytes = 0, RawBytes = 0;
+		*Reader << Flags << StoredBytes << RawBytes;
+		if (Reader->IsError() || Reader->Tell() + static_cast<int64>(StoredBytes) > static_cast<int64>(IndexOffset))
+		{
+			UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot record %u truncated, stopping replay"), Index);
+			break;
+		}
+
+		Stored.SetNumUninitialized(StoredBytes, EAllowShrinking::No);
+		Reader->Serialize(Stored.GetData(), StoredBytes);
+
+		const uint8* PayloadData = Stored.GetData();
+		uint32 PayloadBytes = StoredBytes;
+		if (Flags & 1)
+		{
+			Raw.SetNumUninitialized(RawBytes, EAllowShrinking::No);
+			if (!FCompression::UncompressMemory(NAME_LZ4, Raw.GetData(), RawBytes, Stored.GetData(), StoredBytes))
+			{
+				UE_LOG(LogUnrealClaude, Warning, TEXT("Session snapshot record %u failed to decompress, skipping"), Index);
+				continue;
+			}
+			PayloadData = Raw.GetData();
+			PayloadBytes = RawBytes;
+		}
+
+		// Payload: [len][prompt utf8][len][response utf8]
+		auto ReadString = [PayloadData, PayloadBytes](uint32& Cursor, FString& Out) -> bool
+		{
+			if (Cursor + sizeof(uint32) > PayloadBytes)
+			{
+				return false;
+			}
+			uint32 Bytes = 0;
+			FMemory::Memcpy(&Bytes, PayloadData + Cursor, sizeof(uint32));
+			Cursor += sizeof(uint32);
+			if (Cursor + Bytes > PayloadBytes)
+			{
+				return false;
+			}
+			Out = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(PayloadData + Cursor), Bytes));
+			Cursor += Bytes;
+			return true;
+		};
+
+		uint32 Cursor = 0;
+		FString Prompt, Response;
+		if (ReadString(Cursor, Prompt) && ReadString(Cursor, Response))
+		{
+			ConversationHistory.Add(TPair<FString, FString>(MoveTemp(Prompt), MoveTemp(Response)));
+		}
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Session loaded from snapshot: %s (%d of %u messages read)"),
+		*SnapshotPath, ConversationHistory.Num(), RecordCount);
+	return true;
+}
+
+bool FClaudeSessionManager::AppendToJournal(const FString& Prompt, const FString& Response)
+{
+	FString JournalPath = GetJournalFilePath();
+	FString SaveDir = FPaths::GetPath(JournalPath);
+
+	// Create directory if needed
+	if (!IFileManager::Get().DirectoryExists(*SaveDir))
+	{
+		IFileManager::Get().MakeDirectory(*SaveDir, true);
+	}
+
+	// One condensed JSON record per line so appends never touch earlier data
+	TSharedPtr<FJsonObject> RecordObject = MakeShared<FJsonObject>();
+	RecordObject->SetStringField(TEXT("user"), Prompt);
+	RecordObject->SetStringField(TEXT("assistant"), Response);
+	RecordObject->SetStringField(TEXT("ts"), FDateTime::UtcNow().ToString(TEXT("%Y-%m-%dT%H:%M:%SZ")));
+
+	FString RecordLine = FJsonUtils::Stringify(RecordObject) + LINE_TERMINATOR;
+	if (!FFileHelper::SaveStringToFile(RecordLine, *JournalPath,
+		FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to append to session journal: %s"), *JournalPath);
+		return false;
+	}
+
+	++JournalEntriesSinceCompaction;
+	return true;
+}
+
+bool FClaudeSessionManager::SaveSession()
+{
+	if (ConversationHistory.Num() == 0)
+	{
+		return true; // Nothing to save
+	}
+
+	// Exchanges are already durable in the journal; only fold them into the
+	// snapshot once enough have accumulated
+	if (JournalEntriesSinceCompaction < UnrealClaudeConstants::Session::JournalCompactionThreshold)
+	{
+		return true;
+	}
+
+	return CompactJournal();
+}
+
+bool FClaudeSessionManager::CompactJournal()
+{
+	FString SnapshotPath = GetBinarySnapshotFilePath();
+	FString SaveDir = FPaths::GetPath(SnapshotPath);
+
+	// Create directory if needed
+	if (!IFileManager::Get().DirectoryExists(*SaveDir))
+	{
+		IFileManager::Get().MakeDirectory(*SaveDir, true);
+	}
+
+	if (!WriteBinarySnapshot())
+	{
+		return false;
+	}
+
+	// Snapshot now covers everything the journal held, and supersedes any
+	// legacy JSON snapshot this session migrated from
+	IFileManager::Get().Delete(*GetJournalFilePath(), false, false, true);
+	IFileManager::Get().Delete(*GetSessionFilePath(), false, false, true);
+	JournalEntriesSinceCompaction = 0;
+
+	// Compaction is the natural point to refresh this session's index entry
+	UpdateSessionIndex();
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Session compacted to: %s (%d messages)"), *SnapshotPath, ConversationHistory.Num());
+	return true;
+}
+
+void FClaudeSessionManager::ReplayJournal()
+{
+	FString JournalPath = GetJournalFilePath();
+	if (!IFileManager::Get().FileExists(*JournalPath))
+	{
+		return;
+	}
+
+	FString JournalContent;
+	if (!FFileHelper::LoadFileToString(JournalContent, *JournalPath))
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to read session journal: %s"), *JournalPath);
+		return;
+	}
+
+	TArray<FString> Lines;
+	JournalContent.ParseIntoArrayLines(Lines);
+
+	int32 Replayed = 0;
+	for (const FString& Line : Lines)
+	{
+		TSharedPtr<FJsonObject> RecordObject = FJsonUtils::Parse(Line);
+		if (!RecordObject.IsValid())
+		{
+			// A torn final line (e.g. editor crash mid-append) is expected;
+			// everything before it is still good
+			continue;
+		}
+
+		FString UserMessage, AssistantMessage;
+		if (FJsonUtils::GetStringField(RecordObject, TEXT("user"), UserMessage) &&
+			FJsonUtils::GetStringField(RecordObject, TEXT("assistant"), AssistantMessage))
+		{
+			ConversationHistory.Add(TPair<FString, FString>(UserMessage, AssistantMessage));
+			++Replayed;
+		}
+	}
+
+	// Trim old history if exceeds max size
+	while (ConversationHistory.Num() > MaxHistorySize)
+	{
+		ConversationHistory.RemoveAt(0);
+	}
+
+	// Carry the count forward so the next save can decide about compaction
+	JournalEntriesSinceCompaction = Replayed;
+
+	if (Replayed > 0)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Replayed %d exchanges from session journal"), Replayed);
+	}
+}
+
+bool FClaudeSessionManager::LoadSession()
+{
+	FString SessionPath = GetSessionFilePath();
+
 	// Clear existing history
 	ConversationHistory.Empty();
+	JournalEntriesSinceCompaction = 0;
 
-	// Load messages array
-	TArray<TSharedPtr<FJsonValue>> MessagesArray;
-	if (FJsonUtils::GetArrayField(RootObject, TEXT("messages"), MessagesArray))
+	// Binary snapshot first: the trailing index is read, then only the last
+	// MaxHistorySize records - anything older would be trimmed right after
+	// loading anyway, so it is never deserialized at all. Legacy JSON
+	// snapshots (parsed in full) remain readable until their session's next
+	// compaction migrates them.
+	if (LoadBinarySnapshot(MaxHistorySize))
+	{
+		// Loaded (possibly empty); fall through to the journal replay below
+	}
+	else if (IFileManager::Get().FileExists(*SessionPath))
 	{
-		for (const TSharedPtr<FJsonValue>& MessageValue : MessagesArray)
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *SessionPath))
 		{
-			const TSharedPtr<FJsonObject>* MessageObject;
-			if (MessageValue->TryGetObject(MessageObject))
+			UE_LOG(LogUnrealClaude, Error, TEXT("Failed to load session from: %s"), *SessionPath);
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> RootObject = FJsonUtils::Parse(JsonString);
+		if (!RootObject.IsValid())
+		{
+			UE_LOG(LogUnrealClaude, Error, TEXT("Failed to parse session JSON"));
+			return false;
+		}
+
+		// Load messages array
+		TArray<TSharedPtr<FJsonValue>> MessagesArray;
+		if (FJsonUtils::GetArrayField(RootObject, TEXT("messages"), MessagesArray))
+		{
+			for (const TSharedPtr<FJsonValue>& MessageValue : MessagesArray)
 			{
-				FString UserMessage, AssistantMessage;
-				if (FJsonUtils::GetStringField(*MessageObject, TEXT("user"), UserMessage) &&
-					FJsonUtils::GetStringField(*MessageObject, TEXT("assistant"), AssistantMessage))
+				const TSharedPtr<FJsonObject>* MessageObject;
+				if (MessageValue->TryGetObject(MessageObject))
 				{
-					ConversationHistory.Add(TPair<FString, FString>(UserMessage, AssistantMessage));
+					FString UserMessage, AssistantMessage;
+					if (FJsonUtils::GetStringField(*MessageObject, TEXT("user"), UserMessage) &&
+						FJsonUtils::GetStringField(*MessageObject, TEXT("assistant"), AssistantMessage))
+					{
+						ConversationHistory.Add(TPair<FString, FString>(UserMessage, AssistantMessage));
+					}
 				}
 			}
 		}
-	}
 
-	FString LastUpdated;
-	if (FJsonUtils::GetStringField(RootObject, TEXT("last_updated"), LastUpdated))
-	{
-		UE_LOG(LogUnrealClaude, Log, TEXT("Session loaded from: %s (last updated: %s, %d messages)"),
-			*SessionPath, *LastUpdated, ConversationHistory.Num());
+		FString LastUpdated;
+		if (FJsonUtils::GetStringField(RootObject, TEXT("last_updated"), LastUpdated))
+		{
+			UE_LOG(LogUnrealClaude, Log, TEXT("Session loaded from: %s (last updated: %s, %d messages)"),
+				*SessionPath, *LastUpdated, ConversationHistory.Num());
+		}
+		else
+		{
+			UE_LOG(LogUnrealClaude, Log, TEXT("Session loaded from: %s (%d messages)"),
+				*SessionPath, ConversationHistory.Num());
+		}
 	}
-	else
+	else if (!IFileManager::Get().FileExists(*GetJournalFilePath()))
 	{
-		UE_LOG(LogUnrealClaude, Log, TEXT("Session loaded from: %s (%d messages)"),
-			*SessionPath, ConversationHistory.Num());
+		UE_LOG(LogUnrealClaude, Log, TEXT("No previous session found at: %s"), *SessionPath);
+		return false;
 	}
 
+	// Exchanges journaled after the last compaction sit on top of the snapshot
+	ReplayJournal();
+
 	return true;
 }
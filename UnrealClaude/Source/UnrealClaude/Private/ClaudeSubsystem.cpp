@@ -7,6 +7,26 @@
 #include "ScriptExecutionManager.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeConstants.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	FString GetResponseCacheDir()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("ResponseCache"));
+	}
+
+	FString GetResponseCachePath(const FString& CacheKey)
+	{
+		return FPaths::Combine(GetResponseCacheDir(), CacheKey + TEXT(".json"));
+	}
+}
 
 // Cached system prompt - static to avoid recreation on each call
 static const FString CachedUE57SystemPrompt = TEXT(R"(You are an expert Unreal Engine 5.7 developer assistant integrated directly into the UE Editor.
@@ -75,11 +95,161 @@ void FClaudeCodeSubsystem::SendPrompt(
 	const FString& Prompt,
 	FOnClaudeResponse OnComplete,
 	const FClaudePromptOptions& Options)
+{
+	// Idempotent queries can skip the model round-trip entirely when a fresh
+	// cached response exists; misses fall through and store on success
+	if (Options.bAllowCachedResponse)
+	{
+		const FString CacheKey = BuildResponseCacheKey(Prompt, Options);
+
+		FString CachedResponse;
+		if (TryGetCachedResponse(CacheKey, CachedResponse))
+		{
+			UE_LOG(LogUnrealClaude, Log, TEXT("Serving prompt from response cache (%s)"), *CacheKey);
+			AsyncTask(ENamedThreads::GameThread, [OnComplete, CachedResponse]()
+			{
+				OnComplete.ExecuteIfBound(CachedResponse, true);
+			});
+			return;
+		}
+
+		FOnClaudeResponse OriginalComplete = OnComplete;
+		OnComplete.BindLambda([this, OriginalComplete, CacheKey](const FString& Response, bool bSuccess)
+		{
+			if (bSuccess)
+			{
+				StoreCachedResponse(CacheKey, Response);
+			}
+			OriginalComplete.ExecuteIfBound(Response, bSuccess);
+		});
+	}
+
+	// Background requests run on their own leased process so a long
+	// summarization never blocks the user's chat prompt (or vice versa)
+	if (Options.bBackgroundPriority)
+	{
+		DispatchBackgroundPrompt(Prompt, OnComplete, Options);
+		return;
+	}
+
+	FClaudeRequestConfig Config = BuildRequestConfig(Prompt, Options);
+
+	// Conversations reuse a warm CLI process so follow-ups skip cold start
+	Config.bUseResidentProcess = true;
+
+	// Wrap completion to store history and save session
+	FOnClaudeResponse WrappedComplete;
+	WrappedComplete.BindLambda([this, Prompt, OnComplete](const FString& Response, bool bSuccess)
+	{
+		if (bSuccess && SessionManager.IsValid())
+		{
+			SessionManager->AddExchange(Prompt, Response);
+			SessionManager->SaveSession();
+			MaybeSummarizeHistory();
+		}
+		// Clear busy before the caller's completion runs so status listeners
+		// see the final state even if the callback itself re-sends
+		SetBusy(false);
+		OnComplete.ExecuteIfBound(Response, bSuccess);
+	});
+
+	SetBusy(true);
+	Runner->ExecuteAsync(Config, WrappedComplete, Options.OnProgress);
+}
+
+FString FClaudeCodeSubsystem::BuildResponseCacheKey(const FString& Prompt, const FClaudePromptOptions& Options) const
+{
+	// Hash the determinants of the response rather than the assembled system
+	// prompt - the formatted context block varies with conversation hints,
+	// which would defeat cross-session hits for identical queries. The
+	// project context version (GatheredAt) invalidates entries whenever the
+	// context is re-gathered.
+	int64 ContextVersionTicks = 0;
+	if (FProjectContextManager::Get().HasContext())
+	{
+		ContextVersionTicks = FProjectContextManager::Get().GetContext().GatheredAt.GetTicks();
+	}
+
+	const FString Combined = FString::Printf(TEXT("%s\x1%d\x1%d\x1%s\x1%lld"),
+		*Prompt,
+		Options.bIncludeEngineContext ? 1 : 0,
+		Options.bIncludeProjectContext ? 1 : 0,
+		*CustomSystemPrompt,
+		ContextVersionTicks);
+
+	FTCHARToUTF8 Utf8(*Combined);
+	FMD5 Md5;
+	Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	uint8 Digest[16];
+	Md5.Final(Digest);
+	return BytesToHex(Digest, 16);
+}
+
+bool FClaudeCodeSubsystem::TryGetCachedResponse(const FString& CacheKey, FString& OutResponse) const
+{
+	const FString CachePath = GetResponseCachePath(CacheKey);
+
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *CachePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Entry;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContent);
+	if (!FJsonSerializer::Deserialize(Reader, Entry) || !Entry.IsValid())
+	{
+		IFileManager::Get().Delete(*CachePath);
+		return false;
+	}
+
+	FString CachedAtString;
+	if (!Entry->TryGetStringField(TEXT("cached_at"), CachedAtString))
+	{
+		IFileManager::Get().Delete(*CachePath);
+		return false;
+	}
+
+	const FDateTime CachedAt(FCString::Atoi64(*CachedAtString));
+	const FTimespan Age = FDateTime::UtcNow() - CachedAt;
+	if (Age.GetTotalSeconds() > UnrealClaudeConstants::Session::ResponseCacheTTLSeconds)
+	{
+		IFileManager::Get().Delete(*CachePath);
+		return false;
+	}
+
+	return Entry->TryGetStringField(TEXT("response"), OutResponse);
+}
+
+void FClaudeCodeSubsystem::StoreCachedResponse(const FString& CacheKey, const FString& Response) const
+{
+	IFileManager::Get().MakeDirectory(*GetResponseCacheDir(), true);
+
+	TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+	Entry->SetStringField(TEXT("cached_at"), FString::Printf(TEXT("%lld"), FDateTime::UtcNow().GetTicks()));
+	Entry->SetStringField(TEXT("response"), Response);
+
+	FString FileContent;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&FileContent);
+	FJsonSerializer::Serialize(Entry.ToSharedRef(), Writer);
+
+	FFileHelper::SaveStringToFile(FileContent, *GetResponseCachePath(CacheKey),
+		FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+void FClaudeCodeSubsystem::ClearResponseCache()
+{
+	IFileManager::Get().DeleteDirectory(*GetResponseCacheDir(), false, true);
+	UE_LOG(LogUnrealClaude, Log, TEXT("Response cache cleared"));
+}
+
+FClaudeRequestConfig FClaudeCodeSubsystem::BuildRequestConfig(const FString& Prompt, const FClaudePromptOptions& Options) const
 {
 	FClaudeRequestConfig Config;
 
-	// Build prompt with conversation history context
-	Config.Prompt = BuildPromptWithHistory(Prompt);
+	// Build prompt with conversation history context (summarization requests
+	// opt out - they embed the exchanges to digest in the prompt itself)
+	Config.Prompt = Options.bIncludeHistory ? BuildPromptWithHistory(Prompt) : Prompt;
 	Config.WorkingDirectory = FPaths::ProjectDir();
 	Config.bSkipPermissions = true;
 	Config.AllowedTools = { TEXT("Read"), TEXT("Write"), TEXT("Edit"), TEXT("Grep"), TEXT("Glob"), TEXT("Bash") };
@@ -91,7 +261,7 @@ void FClaudeCodeSubsystem::SendPrompt(
 
 	if (Options.bIncludeProjectContext)
 	{
-		Config.SystemPrompt += GetProjectContextPrompt();
+		Config.SystemPrompt += GetProjectContextPrompt(Prompt);
 	}
 
 	if (!CustomSystemPrompt.IsEmpty())
@@ -99,19 +269,126 @@ void FClaudeCodeSubsystem::SendPrompt(
 		Config.SystemPrompt += TEXT("\n\n") + CustomSystemPrompt;
 	}
 
-	// Wrap completion to store history and save session
+	return Config;
+}
+
+void FClaudeCodeSubsystem::DispatchBackgroundPrompt(const FString& Prompt, FOnClaudeResponse OnComplete, const FClaudePromptOptions& Options)
+{
+	if (BackgroundRunners.Num() >= UnrealClaudeConstants::Process::MaxBackgroundRunners)
+	{
+		FQueuedBackgroundRequest Queued;
+		Queued.Prompt = Prompt;
+		Queued.OnComplete = OnComplete;
+		Queued.Options = Options;
+		PendingBackgroundRequests.Add(MoveTemp(Queued));
+		UE_LOG(LogUnrealClaude, Log, TEXT("Background lane full, queued request (%d waiting)"),
+			PendingBackgroundRequests.Num());
+		return;
+	}
+
+	FClaudeRequestConfig Config = BuildRequestConfig(Prompt, Options);
+
+	// One-shot process per lease; the warm resident session stays dedicated
+	// to the interactive lane
+	Config.bUseResidentProcess = false;
+
+	TUniquePtr<FClaudeCodeRunner> Lease = MakeUnique<FClaudeCodeRunner>();
+	FClaudeCodeRunner* RunnerPtr = Lease.Get();
+
+	// Background exchanges stay out of chat history and never toggle the
+	// busy flag; completion just frees the lease and pumps the queue
 	FOnClaudeResponse WrappedComplete;
-	WrappedComplete.BindLambda([this, Prompt, OnComplete](const FString& Response, bool bSuccess)
+	WrappedComplete.BindLambda([this, OnComplete, RunnerPtr](const FString& Response, bool bSuccess)
 	{
-		if (bSuccess && SessionManager.IsValid())
+		OnComplete.ExecuteIfBound(Response, bSuccess);
+		RetireBackgroundRunner(RunnerPtr);
+	});
+
+	if (!RunnerPtr->ExecuteAsync(Config, WrappedComplete, Options.OnProgress))
+	{
+		// ExecuteAsync already reported the failure through the callback
+		return;
+	}
+
+	BackgroundRunners.Add(MoveTemp(Lease));
+}
+
+void FClaudeCodeSubsystem::RetireBackgroundRunner(FClaudeCodeRunner* Finished)
+{
+	// Completion fires just before the worker thread winds down; the runner
+	// destructor joins it, so removal here is safe and frees the slot for
+	// the next queued request immediately
+	for (int32 Index = 0; Index < BackgroundRunners.Num(); ++Index)
+	{
+		if (BackgroundRunners[Index].Get() == Finished)
 		{
-			SessionManager->AddExchange(Prompt, Response);
-			SessionManager->SaveSession();
+			BackgroundRunners.RemoveAt(Index);
+			break;
+		}
+	}
+
+	if (PendingBackgroundRequests.Num() > 0)
+	{
+		FQueuedBackgroundRequest Next = MoveTemp(PendingBackgroundRequests[0]);
+		PendingBackgroundRequests.RemoveAt(0);
+		DispatchBackgroundPrompt(Next.Prompt, Next.OnComplete, Next.Options);
+	}
+}
+
+void FClaudeCodeSubsystem::MaybeSummarizeHistory()
+{
+	if (!bAutoSummarizeHistory || bHistorySummarizationInFlight || !SessionManager.IsValid())
+	{
+		return;
+	}
+
+	if (SessionManager->GetEstimatedHistoryTokens() < UnrealClaudeConstants::Session::SummarizeTriggerTokens)
+	{
+		return;
+	}
+
+	const TArray<TPair<FString, FString>>& History = SessionManager->GetHistory();
+	const int32 NumToSummarize = History.Num() - UnrealClaudeConstants::Session::SummarizeKeepRecentExchanges;
+	if (NumToSummarize < 2)
+	{
+		// Nothing worth digesting - the weight is all in recent exchanges,
+		// which stay verbatim; the token trim in AddExchange still bounds them
+		return;
+	}
+
+	FString DigestPrompt = TEXT(
+		"Summarize the following conversation exchanges into a compact digest. "
+		"Preserve decisions made, file and class names mentioned, and any open "
+		"questions. Respond with only the digest text, no preamble.\n\n");
+	for (int32 Index = 0; Index < NumToSummarize; ++Index)
+	{
+		DigestPrompt += FString::Printf(TEXT("Human: %s\n\nAssistant: %s\n\n"),
+			*History[Index].Key, *History[Index].Value);
+	}
+
+	// Runs on the background lane with no context or history attached - the
+	// exchanges to digest are the whole prompt
+	FClaudePromptOptions DigestOptions;
+	DigestOptions.bIncludeEngineContext = false;
+	DigestOptions.bIncludeProjectContext = false;
+	DigestOptions.bIncludeHistory = false;
+	DigestOptions.bBackgroundPriority = true;
+
+	bHistorySummarizationInFlight = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("History summarization started (%d exchanges, ~%d tokens)"),
+		NumToSummarize, SessionManager->GetEstimatedHistoryTokens());
+
+	FOnClaudeResponse OnDigestComplete;
+	OnDigestComplete.BindLambda([this, NumToSummarize](const FString& Response, bool bSuccess)
+	{
+		bHistorySummarizationInFlight = false;
+		if (bSuccess && SessionManager.IsValid() && !Response.TrimStartAndEnd().IsEmpty())
+		{
+			SessionManager->CompactOldExchanges(NumToSummarize, Response.TrimStartAndEnd());
 		}
-		OnComplete.ExecuteIfBound(Response, bSuccess);
 	});
 
-	Runner->ExecuteAsync(Config, WrappedComplete, Options.OnProgress);
+	SendPrompt(DigestPrompt, OnDigestComplete, DigestOptions);
 }
 
 void FClaudeCodeSubsystem::SendPrompt(
@@ -135,9 +412,50 @@ FString FClaudeCodeSubsystem::GetUE57SystemPrompt() const
 	return CachedUE57SystemPrompt;
 }
 
-FString FClaudeCodeSubsystem::GetProjectContextPrompt() const
+FString FClaudeCodeSubsystem::GetProjectContextPrompt(const FString& PromptForHints) const
 {
-	FString Context = FProjectContextManager::Get().FormatContextForPrompt();
+	// Mine identifier-looking words from the outgoing prompt and the last few
+	// exchanges; the budgeted context builder promotes classes they mention.
+	// Plain lowercase prose is skipped - it would match half the class list.
+	TArray<FString> Hints;
+	auto CollectHints = [&Hints](const FString& Text)
+	{
+		FString Current;
+		bool bLooksLikeIdentifier = false;
+		auto Flush = [&]()
+		{
+			if (Current.Len() >= 3 && bLooksLikeIdentifier)
+			{
+				Hints.AddUnique(Current);
+			}
+			Current.Reset();
+			bLooksLikeIdentifier = false;
+		};
+
+		for (TCHAR Ch : Text)
+		{
+			if (FChar::IsAlnum(Ch) || Ch == TEXT('_'))
+			{
+				bLooksLikeIdentifier |= FChar::IsUpper(Ch) || Ch == TEXT('_');
+				Current.AppendChar(Ch);
+			}
+			else
+			{
+				Flush();
+			}
+		}
+		Flush();
+	};
+
+	CollectHints(PromptForHints);
+	const TArray<TPair<FString, FString>>& History = GetHistory();
+	for (int32 Index = FMath::Max(0, History.Num() - 3); Index < History.Num(); ++Index)
+	{
+		CollectHints(History[Index].Key);
+	}
+
+	FString Context = FProjectContextManager::Get().FormatContextForPrompt(
+		UnrealClaudeConstants::Context::DefaultContextTokenBudget, Hints);
 
 	// Add script execution history (last 10 scripts)
 	FString ScriptHistory = FScriptExecutionManager::Get().FormatHistoryForContext(10);
@@ -178,17 +496,33 @@ void FClaudeCodeSubsystem::CancelCurrentRequest()
 	{
 		Runner->Cancel();
 	}
+	SetBusy(false);
 }
 
 bool FClaudeCodeSubsystem::SaveSession()
 {
 	if (SessionManager.IsValid())
 	{
-		return SessionManager->SaveSession();
+		const bool bSaved = SessionManager->SaveSession();
+		if (bSaved)
+		{
+			// A saved session appearing changes restore availability
+			OnStatusChanged.Broadcast();
+		}
+		return bSaved;
 	}
 	return false;
 }
 
+void FClaudeCodeSubsystem::SetBusy(bool bInBusy)
+{
+	if (bBusy != bInBusy)
+	{
+		bBusy = bInBusy;
+		OnStatusChanged.Broadcast();
+	}
+}
+
 bool FClaudeCodeSubsystem::LoadSession()
 {
 	if (SessionManager.IsValid())
@@ -231,8 +565,26 @@ FString FClaudeCodeSubsystem::BuildPromptWithHistory(const FString& NewPrompt) c
 
 	FString PromptWithHistory;
 
-	// Include recent history (limit to last N exchanges)
-	int32 StartIndex = FMath::Max(0, History.Num() - UnrealClaudeConstants::Session::MaxHistoryInPrompt);
+	// Include recent history, bounded by both exchange count and estimated
+	// tokens - count alone lets one pasted log blow the prompt budget. Walk
+	// newest-backward so the most recent exchanges always survive the cut;
+	// the newest one is included regardless so follow-ups keep their anchor.
+	const int32 CharBudget = UnrealClaudeConstants::Session::MaxPromptHistoryTokens
+		* UnrealClaudeConstants::Context::ApproxCharsPerToken;
+	int32 StartIndex = History.Num() - 1;
+	int32 CharsAccumulated = History.Last().Key.Len() + History.Last().Value.Len();
+	while (StartIndex > 0
+		&& History.Num() - StartIndex < UnrealClaudeConstants::Session::MaxHistoryInPrompt)
+	{
+		const TPair<FString, FString>& Candidate = History[StartIndex - 1];
+		const int32 CandidateChars = Candidate.Key.Len() + Candidate.Value.Len();
+		if (CharsAccumulated + CandidateChars > CharBudget)
+		{
+			break;
+		}
+		CharsAccumulated += CandidateChars;
+		--StartIndex;
+	}
 
 	for (int32 i = StartIndex; i < History.Num(); ++i)
 	{
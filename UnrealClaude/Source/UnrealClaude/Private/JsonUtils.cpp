@@ -2,6 +2,35 @@
 
 #include "JsonUtils.h"
 #include "UnrealClaudeUtils.h"
+#include "Async/Async.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/**
+	 * Per-thread high-water mark of recent Stringify output sizes
+	 *
+	 * The serialized string is returned to the caller by value, so a buffer
+	 * pool cannot keep ownership of it; what can be eliminated is the
+	 * repeated grow-reallocation while the writer appends. Reserving from
+	 * the recent high-water mark turns that O(log n) realloc churn into one
+	 * right-sized allocation per response. The mark decays so a single huge
+	 * response does not pin oversized reservations for the rest of the session.
+	 */
+	thread_local int32 GRecentStringifySize = 0;
+
+	int32 EstimateStringifyCapacity()
+	{
+		// Headroom over the recent mark so slightly larger responses still fit
+		return GRecentStringifySize + GRecentStringifySize / 4;
+	}
+
+	void RecordStringifySize(int32 Length)
+	{
+		GRecentStringifySize = FMath::Max(Length, (GRecentStringifySize * 3) / 4);
+	}
+}
 
 FString FJsonUtils::Stringify(const TSharedPtr<FJsonObject>& JsonObject, bool bPrettyPrint)
 {
@@ -15,6 +44,7 @@ FString FJsonUtils::Stringify(const TSharedPtr<FJsonObject>& JsonObject, bool bP
 FString FJsonUtils::Stringify(const TSharedRef<FJsonObject>& JsonObject, bool bPrettyPrint)
 {
 	FString OutputString;
+	OutputString.Reserve(EstimateStringifyCapacity());
 	if (bPrettyPrint)
 	{
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -26,9 +56,22 @@ FString FJsonUtils::Stringify(const TSharedRef<FJsonObject>& JsonObject, bool bP
 			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
 		FJsonSerializer::Serialize(JsonObject, Writer);
 	}
+	RecordStringifySize(OutputString.Len());
 	return OutputString;
 }
 
+void FJsonUtils::StringifyUtf8(const TSharedRef<FJsonObject>& JsonObject, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset(EstimateStringifyCapacity());
+	FMemoryWriter Archive(OutBytes);
+
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+		TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+	FJsonSerializer::Serialize(JsonObject, Writer);
+
+	RecordStringifySize(OutBytes.Num());
+}
+
 TSharedPtr<FJsonObject> FJsonUtils::Parse(const FString& JsonString)
 {
 	TSharedPtr<FJsonObject> JsonObject;
@@ -42,6 +85,105 @@ TSharedPtr<FJsonObject> FJsonUtils::Parse(const FString& JsonString)
 	return nullptr;
 }
 
+TSharedPtr<FJsonObject> FJsonUtils::ParseUtf8(TConstArrayView<uint8> Utf8Bytes)
+{
+	if (Utf8Bytes.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// Mirror of StringifyUtf8: the UTF8CHAR reader consumes the bytes through
+	// a memory archive, so the source buffer is never widened or copied
+	FMemoryReaderView Archive(MakeMemoryView(Utf8Bytes.GetData(), Utf8Bytes.Num()));
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReader<UTF8CHAR>::Create(&Archive);
+
+	TSharedPtr<FJsonObject> JsonObject;
+	if (FJsonSerializer::Deserialize(Reader, JsonObject))
+	{
+		return JsonObject;
+	}
+
+	return nullptr;
+}
+
+void FJsonUtils::ReleaseTreeAsync(TSharedPtr<FJsonObject>&& Root)
+{
+	if (!Root.IsValid())
+	{
+		return;
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Tree = MoveTemp(Root)]() mutable
+	{
+		// If another holder still references the tree this just drops our
+		// count; otherwise the full node-by-node teardown runs here
+		Tree.Reset();
+	});
+}
+
+uint64 FJsonUtils::EstimateTreeBytes(const TSharedPtr<FJsonObject>& Object)
+{
+	if (!Object.IsValid())
+	{
+		return 0;
+	}
+
+	uint64 Bytes = sizeof(FJsonObject) + Object->Values.GetAllocatedSize();
+	for (const auto& Field : Object->Values)
+	{
+		Bytes += Field.Key.GetAllocatedSize();
+		Bytes += EstimateTreeBytes(Field.Value);
+	}
+	return Bytes;
+}
+
+uint64 FJsonUtils::EstimateTreeBytes(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		return 0;
+	}
+
+	// Node size approximated by the largest concrete value type; what
+	// dominates real trees is the strings and containers counted below
+	uint64 Bytes = sizeof(FJsonValueString);
+	switch (Value->Type)
+	{
+	case EJson::String:
+	{
+		FString StringValue;
+		Value->TryGetString(StringValue);
+		Bytes += StringValue.GetAllocatedSize();
+		break;
+	}
+	case EJson::Array:
+	{
+		const TArray<TSharedPtr<FJsonValue>>* ArrayValue = nullptr;
+		if (Value->TryGetArray(ArrayValue))
+		{
+			Bytes += ArrayValue->GetAllocatedSize();
+			for (const TSharedPtr<FJsonValue>& Element : *ArrayValue)
+			{
+				Bytes += EstimateTreeBytes(Element);
+			}
+		}
+		break;
+	}
+	case EJson::Object:
+	{
+		const TSharedPtr<FJsonObject>* ObjectValue = nullptr;
+		if (Value->TryGetObject(ObjectValue))
+		{
+			Bytes += EstimateTreeBytes(*ObjectValue);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	return Bytes;
+}
+
 TSharedPtr<FJsonObject> FJsonUtils::CreateSuccessResponse(const FString& Message, TSharedPtr<FJsonObject> Data)
 {
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
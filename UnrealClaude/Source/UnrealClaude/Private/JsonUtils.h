@@ -28,6 +28,17 @@ public:
 	 */
 	static FString Stringify(const TSharedRef<FJsonObject>& JsonObject, bool bPrettyPrint = false);
 
+	/**
+	 * Serialize a JSON object straight to condensed UTF-8 bytes
+	 *
+	 * The FString path writes every response byte twice - once as UTF-16
+	 * through the TCHAR writer, then again through the UTF-8 transcode the
+	 * HTTP layer needs. Writing UTF8CHAR through a memory archive produces
+	 * the wire bytes in a single pass, so large payloads skip both the
+	 * double write and the transient wide copy.
+	 */
+	static void StringifyUtf8(const TSharedRef<FJsonObject>& JsonObject, TArray<uint8>& OutBytes);
+
 	/**
 	 * Parse a JSON string into a JSON object
 	 * @param JsonString - The JSON string to parse
@@ -35,6 +46,45 @@ public:
 	 */
 	static TSharedPtr<FJsonObject> Parse(const FString& JsonString);
 
+	/**
+	 * Parse JSON straight from UTF-8 bytes
+	 *
+	 * The FString path copies the whole body into a null-terminated scratch
+	 * buffer and transcodes it to UTF-16 before the reader sees a character.
+	 * Reading UTF8CHAR through a memory archive parses directly from the
+	 * source buffer, so only the decoded fields allocate - large script
+	 * payloads skip both whole-body transient copies.
+	 * @param Utf8Bytes - UTF-8 encoded JSON (need not be null-terminated)
+	 * @return The parsed JSON object, or nullptr on failure
+	 */
+	static TSharedPtr<FJsonObject> ParseUtf8(TConstArrayView<uint8> Utf8Bytes);
+
+	/**
+	 * Release a large JSON document tree on the thread pool
+	 *
+	 * Engine JSON nodes are individually heap-allocated behind shared
+	 * pointers with no allocator hook, so per-request trees cannot be
+	 * arena-backed without forking the FJsonObject API every tool is
+	 * written against. What the hot thread actually pays for is the
+	 * atomized destruction - thousands of small frees walking the tree
+	 * after the response is serialized. Moving the last reference into a
+	 * pool task makes release a single pointer handoff from the caller's
+	 * point of view, the same one-shot teardown an arena would give.
+	 * Only worth the dispatch for large trees; free small ones inline.
+	 */
+	static void ReleaseTreeAsync(TSharedPtr<FJsonObject>&& Root);
+
+	/**
+	 * Rough retained-size estimate of a JSON tree in bytes
+	 *
+	 * Walks the tree summing node sizes and string allocations. Used by the
+	 * memory accounting gauges to size retained parameter and result trees;
+	 * deliberately an estimate (shared subtrees count once per reference),
+	 * which is the right bias for "what is this owner keeping alive".
+	 */
+	static uint64 EstimateTreeBytes(const TSharedPtr<FJsonObject>& Object);
+	static uint64 EstimateTreeBytes(const TSharedPtr<FJsonValue>& Value);
+
 	/**
 	 * Create a success response JSON object
 	 * @param Message - The success message
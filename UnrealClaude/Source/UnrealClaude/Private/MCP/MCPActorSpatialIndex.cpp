@@ -0,0 +1,230 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPActorSpatialIndex.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+
+FMCPActorSpatialIndex& FMCPActorSpatialIndex::Get()
+{
+	static FMCPActorSpatialIndex Instance;
+	return Instance;
+}
+
+FMCPActorSpatialIndex::FMCPActorSpatialIndex()
+	: bDelegatesRegistered(false)
+{
+}
+
+FMCPActorSpatialIndex::~FMCPActorSpatialIndex()
+{
+	if (bDelegatesRegistered && GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+}
+
+void FMCPActorSpatialIndex::EnsureDelegatesRegistered()
+{
+	if (bDelegatesRegistered || !GEngine)
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPActorSpatialIndex::OnLevelActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPActorSpatialIndex::OnLevelActorDeleted);
+	ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPActorSpatialIndex::OnActorMoved);
+	bDelegatesRegistered = true;
+}
+
+void FMCPActorSpatialIndex::EnsureWorldIndexed(UWorld* World)
+{
+	EnsureDelegatesRegistered();
+
+	if (IndexedWorld.Get() == World)
+	{
+		return;
+	}
+
+	// Different world (map change or first query): rebuild from scratch
+	Cells.Empty();
+	ActorCells.Empty();
+	IndexedWorld = World;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (AActor* Actor = *It)
+		{
+			AddActor(Actor);
+		}
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Spatial index built: %d actors in %d cells (%.1f ms)"),
+		ActorCells.Num(), Cells.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FMCPActorSpatialIndex::OnLevelActorAdded(AActor* Actor)
+{
+	if (Actor && Actor->GetWorld() == IndexedWorld.Get())
+	{
+		AddActor(Actor);
+	}
+}
+
+void FMCPActorSpatialIndex::OnLevelActorDeleted(AActor* Actor)
+{
+	if (Actor && Actor->GetWorld() == IndexedWorld.Get())
+	{
+		RemoveActor(Actor);
+	}
+}
+
+void FMCPActorSpatialIndex::OnActorMoved(AActor* Actor)
+{
+	if (!Actor || Actor->GetWorld() != IndexedWorld.Get())
+	{
+		return;
+	}
+
+	const FIntVector NewCell = CellForLocation(Actor->GetActorLocation());
+	if (const FIntVector* OldCell = ActorCells.Find(FObjectKey(Actor)))
+	{
+		if (*OldCell == NewCell)
+		{
+			return;
+		}
+		RemoveActor(Actor);
+	}
+	AddActor(Actor);
+}
+
+void FMCPActorSpatialIndex::AddActor(AActor* Actor)
+{
+	const FIntVector Cell = CellForLocation(Actor->GetActorLocation());
+	Cells.FindOrAdd(Cell).Add(Actor);
+	ActorCells.Add(FObjectKey(Actor), Cell);
+}
+
+void FMCPActorSpatialIndex::RemoveActor(AActor* Actor)
+{
+	FIntVector Cell;
+	if (ActorCells.RemoveAndCopyValue(FObjectKey(Actor), Cell))
+	{
+		if (TArray<TWeakObjectPtr<AActor>>* CellActors = Cells.Find(Cell))
+		{
+			CellActors->RemoveSingleSwap(Actor);
+			if (CellActors->Num() == 0)
+			{
+				Cells.Remove(Cell);
+			}
+		}
+	}
+}
+
+FIntVector FMCPActorSpatialIndex::CellForLocation(const FVector& Location)
+{
+	const double CellSize = UnrealClaudeConstants::SpatialIndex::CellSize;
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void FMCPActorSpatialIndex::CollectCell(const FIntVector& Cell, TArray<AActor*>& OutActors)
+{
+	TArray<TWeakObjectPtr<AActor>>* CellActors = Cells.Find(Cell);
+	if (!CellActors)
+	{
+		return;
+	}
+
+	// Prune handles that died without a delete event (e.g., GC after undo)
+	for (int32 i = CellActors->Num() - 1; i >= 0; --i)
+	{
+		if (AActor* Actor = (*CellActors)[i].Get())
+		{
+			OutActors.Add(Actor);
+		}
+		else
+		{
+			CellActors->RemoveAtSwap(i);
+		}
+	}
+}
+
+void FMCPActorSpatialIndex::QueryRadius(UWorld* World, const FVector& Center, double Radius, TArray<AActor*>& OutActors)
+{
+	EnsureWorldIndexed(World);
+
+	const FIntVector MinCell = CellForLocation(Center - FVector(Radius));
+	const FIntVector MaxCell = CellForLocation(Center + FVector(Radius));
+	const double RadiusSquared = Radius * Radius;
+
+	TArray<AActor*> Candidates;
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				CollectCell(FIntVector(X, Y, Z), Candidates);
+			}
+		}
+	}
+
+	for (AActor* Actor : Candidates)
+	{
+		if (FVector::DistSquared(Actor->GetActorLocation(), Center) <= RadiusSquared)
+		{
+			OutActors.Add(Actor);
+		}
+	}
+
+	// Nearest first, so a payload limit returns the closest actors
+	OutActors.Sort([&Center](const AActor& A, const AActor& B)
+	{
+		return FVector::DistSquared(A.GetActorLocation(), Center)
+			< FVector::DistSquared(B.GetActorLocation(), Center);
+	});
+}
+
+void FMCPActorSpatialIndex::QueryBox(UWorld* World, const FBox& Box, TArray<AActor*>& OutActors)
+{
+	EnsureWorldIndexed(World);
+
+	const FIntVector MinCell = CellForLocation(Box.Min);
+	const FIntVector MaxCell = CellForLocation(Box.Max);
+
+	TArray<AActor*> Candidates;
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				CollectCell(FIntVector(X, Y, Z), Candidates);
+			}
+		}
+	}
+
+	for (AActor* Actor : Candidates)
+	{
+		if (Box.IsInsideOrOn(Actor->GetActorLocation()))
+		{
+			OutActors.Add(Actor);
+		}
+	}
+}
+
+void FMCPActorSpatialIndex::Invalidate()
+{
+	Cells.Empty();
+	ActorCells.Empty();
+	IndexedWorld.Reset();
+}
@@ -0,0 +1,104 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * In-memory spatial index over level actors for the MCP actor tools.
+ *
+ * On large open-world maps a full actor iteration per query takes seconds
+ * and serializes megabytes; spatial queries ("actors near X") should only
+ * touch actors in the neighbourhood of the query. The index buckets actors
+ * into a sparse uniform grid keyed by cell coordinates, built once per
+ * world on first query and kept current through the editor's
+ * OnLevelActorAdded/OnLevelActorDeleted/OnActorMoved events - so query
+ * cost scales with the cells a radius or box overlaps, not the level.
+ *
+ * A uniform grid is used instead of an octree: editor queries come with an
+ * explicit radius, actor density on our maps is fairly even, and a grid
+ * gives the same bounded-cost lookups with far less maintenance code.
+ *
+ * Game thread only, like the rest of the editor actor machinery.
+ */
+class FMCPActorSpatialIndex
+{
+public:
+	static FMCPActorSpatialIndex& Get();
+	~FMCPActorSpatialIndex();
+
+	/**
+	 * Find actors whose location lies within Radius of Center.
+	 * Results are sorted nearest-first so a payload limit keeps the closest.
+	 * @param World - World to query (index is rebuilt if the world changed)
+	 * @param Center - Query sphere center
+	 * @param Radius - Query sphere radius in world units
+	 * @param OutActors - Receives the matching actors, nearest first
+	 */
+	void QueryRadius(UWorld* World, const FVector& Center, double Radius, TArray<AActor*>& OutActors);
+
+	/**
+	 * Find actors whose location lies inside an axis-aligned box.
+	 * @param World - World to query (index is rebuilt if the world changed)
+	 * @param Box - Query bounds in world space
+	 * @param OutActors - Receives the matching actors
+	 */
+	void QueryBox(UWorld* World, const FBox& Box, TArray<AActor*>& OutActors);
+
+	/** Drop the index so the next query rebuilds it (e.g., after map load) */
+	void Invalidate();
+
+	/** Number of actors currently indexed (for diagnostics) */
+	int32 GetIndexedActorCount() const { return ActorCells.Num(); }
+
+private:
+	FMCPActorSpatialIndex();
+
+	/** Bind the editor actor event delegates on first use */
+	void EnsureDelegatesRegistered();
+
+	/** Build the grid for World if it is not the currently indexed world */
+	void EnsureWorldIndexed(UWorld* World);
+
+	/** Editor callback: an actor was added to the level */
+	void OnLevelActorAdded(AActor* Actor);
+
+	/** Editor callback: an actor was removed from the level */
+	void OnLevelActorDeleted(AActor* Actor);
+
+	/** Editor callback: an actor finished moving */
+	void OnActorMoved(AActor* Actor);
+
+	/** Insert one actor into its cell */
+	void AddActor(AActor* Actor);
+
+	/** Remove one actor from its cell */
+	void RemoveActor(AActor* Actor);
+
+	/** Grid cell containing a world-space location */
+	static FIntVector CellForLocation(const FVector& Location);
+
+	/** Append the live actors of one cell, pruning dead handles in place */
+	void CollectCell(const FIntVector& Cell, TArray<AActor*>& OutActors);
+
+	/** World the grid was built for; a different world triggers a rebuild */
+	TWeakObjectPtr<UWorld> IndexedWorld;
+
+	/** Sparse grid: cell coordinates -> actors whose location is in the cell */
+	TMap<FIntVector, TArray<TWeakObjectPtr<AActor>>> Cells;
+
+	/** Reverse lookup: actor -> cell it is filed under, for moves/removals */
+	TMap<FObjectKey, FIntVector> ActorCells;
+
+	/** Whether the editor actor delegates have been bound */
+	bool bDelegatesRegistered;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+};
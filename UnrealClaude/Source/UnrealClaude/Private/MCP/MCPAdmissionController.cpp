@@ -0,0 +1,84 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPAdmissionController.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeModule.h"
+#include "Misc/ScopeLock.h"
+
+FMCPAdmissionController& FMCPAdmissionController::Get()
+{
+	static FMCPAdmissionController Instance;
+	return Instance;
+}
+
+FMCPAdmissionController::FMCPAdmissionController()
+	: MaxInFlight(UnrealClaudeConstants::MCPServer::MaxInFlightToolRequests)
+	, MaxQueuedTasks(UnrealClaudeConstants::MCPServer::MaxQueuedBackgroundTasks)
+{
+}
+
+void FMCPAdmissionController::SetLimits(int32 InMaxInFlight, int32 InMaxQueuedTasks)
+{
+	MaxInFlight = FMath::Max(1, InMaxInFlight);
+	MaxQueuedTasks = FMath::Max(1, InMaxQueuedTasks);
+}
+
+bool FMCPAdmissionController::TryAdmit(int32 QueuedBackgroundTasks)
+{
+	using namespace UnrealClaudeConstants::MCPServer;
+
+	if (InFlight.Load(EMemoryOrder::Relaxed) >= MaxInFlight.Load(EMemoryOrder::Relaxed))
+	{
+		UE_LOG(LogUnrealClaude, Verbose, TEXT("Admission: shedding request, %d in flight"),
+			InFlight.Load(EMemoryOrder::Relaxed));
+		return false;
+	}
+
+	if (QueuedBackgroundTasks >= MaxQueuedTasks.Load(EMemoryOrder::Relaxed))
+	{
+		UE_LOG(LogUnrealClaude, Verbose, TEXT("Admission: shedding request, %d tasks queued"),
+			QueuedBackgroundTasks);
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&BudgetLock);
+		const double Now = FPlatformTime::Seconds();
+		if (Now - WindowStartSeconds >= 1.0)
+		{
+			WindowStartSeconds = Now;
+			WindowChargedSeconds = 0.0;
+		}
+		if (WindowChargedSeconds * 1000.0 >= GameThreadBudgetMsPerSecond)
+		{
+			UE_LOG(LogUnrealClaude, Verbose, TEXT("Admission: game thread budget exhausted (%.0f ms this window)"),
+				WindowChargedSeconds * 1000.0);
+			return false;
+		}
+	}
+
+	InFlight++;
+	return true;
+}
+
+void FMCPAdmissionController::Release()
+{
+	InFlight--;
+}
+
+void FMCPAdmissionController::ChargeGameThreadTime(double Seconds)
+{
+	if (Seconds <= 0.0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&BudgetLock);
+	const double Now = FPlatformTime::Seconds();
+	if (Now - WindowStartSeconds >= 1.0)
+	{
+		WindowStartSeconds = Now;
+		WindowChargedSeconds = 0.0;
+	}
+	WindowChargedSeconds += Seconds;
+}
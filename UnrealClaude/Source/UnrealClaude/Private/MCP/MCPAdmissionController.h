@@ -0,0 +1,64 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+/**
+ * Admission control for inbound MCP tool execution.
+ *
+ * Nothing else bounds inbound load: an agent looping on a game-thread
+ * tool can saturate the frame and make the editor unusable. This gates
+ * every execute/batch request on three soft limits - concurrent in-flight
+ * requests, background task queue depth, and game-thread time consumed by
+ * MCP work within a rolling one-second window. Requests over a limit are
+ * shed with 429 + Retry-After so a well-behaved client backs off instead
+ * of piling on; the editor always keeps frame headroom for the user.
+ *
+ * Game-thread charges are reported by FMCPToolRegistry::ExecuteTool from
+ * the measurement it already takes for metrics. Limits are soft: the
+ * in-flight check races its increment by design - shedding one request
+ * early or late is fine, a lock on the admission path is not.
+ */
+class FMCPAdmissionController
+{
+public:
+	static FMCPAdmissionController& Get();
+
+	/**
+	 * Try to admit one request for execution.
+	 * @param QueuedBackgroundTasks - Current pending depth of the task queue
+	 * @return true if admitted; the caller must pair with Release()
+	 */
+	bool TryAdmit(int32 QueuedBackgroundTasks);
+
+	/** Release an admitted request (call once per successful TryAdmit) */
+	void Release();
+
+	/** Charge game-thread time spent executing MCP work against the window */
+	void ChargeGameThreadTime(double Seconds);
+
+	/** Override the in-flight and queue-depth limits (editor settings) */
+	void SetLimits(int32 InMaxInFlight, int32 InMaxQueuedTasks);
+
+private:
+	FMCPAdmissionController();
+
+	/** Requests currently admitted and executing */
+	TAtomic<int32> InFlight{0};
+
+	/** Soft limits, seeded from constants and overridable at runtime from
+	 *  the editor settings; relaxed reads on the admission path */
+	TAtomic<int32> MaxInFlight;
+	TAtomic<int32> MaxQueuedTasks;
+
+	/** Guards the budget window below */
+	FCriticalSection BudgetLock;
+
+	/** Start of the current one-second budget window */
+	double WindowStartSeconds = 0.0;
+
+	/** Game-thread seconds charged within the current window */
+	double WindowChargedSeconds = 0.0;
+};
@@ -0,0 +1,356 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPAssetGraphCache.h"
+#include "UnrealClaudeModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Async.h"
+
+namespace
+{
+	/** Query one package's forward edges straight from the registry */
+	void QueryForwardEdges(IAssetRegistry& AssetRegistry, FName PackageName, TArray<FName>& OutAll, TArray<FName>& OutHard)
+	{
+		AssetRegistry.GetDependencies(PackageName, OutAll, UE::AssetRegistry::EDependencyCategory::Package);
+		AssetRegistry.GetDependencies(PackageName, OutHard, UE::AssetRegistry::EDependencyCategory::Package,
+			UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard));
+	}
+}
+
+FMCPAssetGraphCache& FMCPAssetGraphCache::Get()
+{
+	static FMCPAssetGraphCache Instance;
+	return Instance;
+}
+
+FMCPAssetGraphCache::FMCPAssetGraphCache()
+	: bDelegatesRegistered(false)
+	, bReferencerIndexStarted(false)
+	, bReferencerIndexReady(false)
+{
+}
+
+FMCPAssetGraphCache::~FMCPAssetGraphCache()
+{
+	if (bDelegatesRegistered)
+	{
+		if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+			AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+			AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+			if (FilesLoadedHandle.IsValid())
+			{
+				AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+			}
+		}
+	}
+}
+
+void FMCPAssetGraphCache::EnsureDelegatesRegistered()
+{
+	if (bDelegatesRegistered)
+	{
+		return;
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FMCPAssetGraphCache::OnAssetUpdated);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPAssetGraphCache::OnAssetRemoved);
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPAssetGraphCache::OnAssetAdded);
+	bDelegatesRegistered = true;
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Asset graph cache registered for registry invalidation events"));
+}
+
+void FMCPAssetGraphCache::GetDependencies(FName PackageName, bool bHardOnly, TArray<FName>& OutDependencies)
+{
+	EnsureDelegatesRegistered();
+
+	{
+		FScopeLock Lock(&CacheLock);
+		const TMap<FName, TArray<FName>>& Cache = bHardOnly ? HardDependencyCache : AllDependencyCache;
+		if (const TArray<FName>* Cached = Cache.Find(PackageName))
+		{
+			OutDependencies = *Cached;
+			return;
+		}
+	}
+
+	// Cache miss - walk the registry once for this package
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	UE::AssetRegistry::FDependencyQuery QueryFlags;
+	if (bHardOnly)
+	{
+		QueryFlags = UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard);
+	}
+
+	OutDependencies.Reset();
+	AssetRegistry.GetDependencies(
+		PackageName,
+		OutDependencies,
+		UE::AssetRegistry::EDependencyCategory::Package,
+		QueryFlags
+	);
+
+	{
+		FScopeLock Lock(&CacheLock);
+		TMap<FName, TArray<FName>>& Cache = bHardOnly ? HardDependencyCache : AllDependencyCache;
+		Cache.Add(PackageName, OutDependencies);
+	}
+}
+
+void FMCPAssetGraphCache::GetReferencers(FName PackageName, bool bHardOnly, TArray<FName>& OutReferencers)
+{
+	OutReferencers.Reset();
+
+	if (bReferencerIndexReady)
+	{
+		FScopeLock Lock(&IndexLock);
+		const TMap<FName, TSet<FName>>& Index = bHardOnly ? ReferencersHard : ReferencersAll;
+		if (const TSet<FName>* Referencers = Index.Find(PackageName))
+		{
+			OutReferencers = Referencers->Array();
+		}
+		return;
+	}
+
+	// Index still building - fall back to the on-demand registry resolve
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	UE::AssetRegistry::FDependencyQuery QueryFlags;
+	if (bHardOnly)
+	{
+		QueryFlags = UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard);
+	}
+
+	AssetRegistry.GetReferencers(
+		PackageName,
+		OutReferencers,
+		UE::AssetRegistry::EDependencyCategory::Package,
+		QueryFlags
+	);
+}
+
+void FMCPAssetGraphCache::StartReferencerIndexBuild()
+{
+	if (bReferencerIndexStarted)
+	{
+		return;
+	}
+	bReferencerIndexStarted = true;
+
+	EnsureDelegatesRegistered();
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// Wait for the initial scan; building against a half-loaded registry
+		// would miss edges
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddLambda([this]()
+		{
+			Async(EAsyncExecution::ThreadPool, [this]() { BuildReferencerIndex(); });
+		});
+	}
+	else
+	{
+		Async(EAsyncExecution::ThreadPool, [this]() { BuildReferencerIndex(); });
+	}
+}
+
+void FMCPAssetGraphCache::BuildReferencerIndex()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	// Collect every project package once (registry reads are thread-safe)
+	TSet<FName> PackageNames;
+	AssetRegistry.EnumerateAllAssets([&PackageNames](const FAssetData& Asset)
+	{
+		const FString PathStr = Asset.PackageName.ToString();
+		if (!PathStr.StartsWith(TEXT("/Script/")))
+		{
+			PackageNames.Add(Asset.PackageName);
+		}
+		return true;
+	}, true /* bIncludeOnlyOnDiskAssets */);
+
+	// Invert the forward edges into local maps, then swap in under the lock
+	TMap<FName, TSet<FName>> NewReferencersAll;
+	TMap<FName, TSet<FName>> NewReferencersHard;
+	TMap<FName, TArray<FName>> NewForwardAll;
+	TMap<FName, TArray<FName>> NewForwardHard;
+
+	for (const FName& PackageName : PackageNames)
+	{
+		TArray<FName> AllDeps, HardDeps;
+		QueryForwardEdges(AssetRegistry, PackageName, AllDeps, HardDeps);
+
+		for (const FName& Dep : AllDeps)
+		{
+			NewReferencersAll.FindOrAdd(Dep).Add(PackageName);
+		}
+		for (const FName& Dep : HardDeps)
+		{
+			NewReferencersHard.FindOrAdd(Dep).Add(PackageName);
+		}
+
+		NewForwardAll.Add(PackageName, MoveTemp(AllDeps));
+		NewForwardHard.Add(PackageName, MoveTemp(HardDeps));
+	}
+
+	{
+		FScopeLock Lock(&IndexLock);
+		ReferencersAll = MoveTemp(NewReferencersAll);
+		ReferencersHard = MoveTemp(NewReferencersHard);
+		IndexedForwardAll = MoveTemp(NewForwardAll);
+		IndexedForwardHard = MoveTemp(NewForwardHard);
+	}
+	bReferencerIndexReady = true;
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Reverse-reference index built: %d packages in %.2fs"),
+		PackageNames.Num(), FPlatformTime::Seconds() - StartTime);
+}
+
+void FMCPAssetGraphCache::ReindexPackage(FName PackageName)
+{
+	if (!bReferencerIndexReady)
+	{
+		// The in-flight build reads the registry live and will pick this up
+		return;
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	TArray<FName> AllDeps, HardDeps;
+	QueryForwardEdges(AssetRegistry, PackageName, AllDeps, HardDeps);
+
+	FScopeLock Lock(&IndexLock);
+
+	// Retract the old edges, then assert the new ones
+	if (const TArray<FName>* OldDeps = IndexedForwardAll.Find(PackageName))
+	{
+		for (const FName& Dep : *OldDeps)
+		{
+			if (TSet<FName>* Referencers = ReferencersAll.Find(Dep))
+			{
+				Referencers->Remove(PackageName);
+			}
+		}
+	}
+	if (const TArray<FName>* OldDeps = IndexedForwardHard.Find(PackageName))
+	{
+		for (const FName& Dep : *OldDeps)
+		{
+			if (TSet<FName>* Referencers = ReferencersHard.Find(Dep))
+			{
+				Referencers->Remove(PackageName);
+			}
+		}
+	}
+
+	for (const FName& Dep : AllDeps)
+	{
+		ReferencersAll.FindOrAdd(Dep).Add(PackageName);
+	}
+	for (const FName& Dep : HardDeps)
+	{
+		ReferencersHard.FindOrAdd(Dep).Add(PackageName);
+	}
+
+	IndexedForwardAll.Add(PackageName, MoveTemp(AllDeps));
+	IndexedForwardHard.Add(PackageName, MoveTemp(HardDeps));
+}
+
+void FMCPAssetGraphCache::RemovePackageEdges(FName PackageName)
+{
+	if (!bReferencerIndexReady)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&IndexLock);
+
+	if (const TArray<FName>* OldDeps = IndexedForwardAll.Find(PackageName))
+	{
+		for (const FName& Dep : *OldDeps)
+		{
+			if (TSet<FName>* Referencers = ReferencersAll.Find(Dep))
+			{
+				Referencers->Remove(PackageName);
+			}
+		}
+	}
+	if (const TArray<FName>* OldDeps = IndexedForwardHard.Find(PackageName))
+	{
+		for (const FName& Dep : *OldDeps)
+		{
+			if (TSet<FName>* Referencers = ReferencersHard.Find(Dep))
+			{
+				Referencers->Remove(PackageName);
+			}
+		}
+	}
+
+	IndexedForwardAll.Remove(PackageName);
+	IndexedForwardHard.Remove(PackageName);
+}
+
+void FMCPAssetGraphCache::OnAssetUpdated(const FAssetData& AssetData)
+{
+	// A resave can change the package's own outgoing edges; other packages'
+	// edges are unaffected until they are resaved themselves
+	InvalidatePackage(AssetData.PackageName);
+	ReindexPackage(AssetData.PackageName);
+}
+
+void FMCPAssetGraphCache::OnAssetAdded(const FAssetData& AssetData)
+{
+	ReindexPackage(AssetData.PackageName);
+}
+
+void FMCPAssetGraphCache::OnAssetRemoved(const FAssetData& AssetData)
+{
+	InvalidatePackage(AssetData.PackageName);
+	RemovePackageEdges(AssetData.PackageName);
+}
+
+void FMCPAssetGraphCache::InvalidatePackage(FName PackageName)
+{
+	FScopeLock Lock(&CacheLock);
+	AllDependencyCache.Remove(PackageName);
+	HardDependencyCache.Remove(PackageName);
+}
+
+void FMCPAssetGraphCache::InvalidateAll()
+{
+	FScopeLock Lock(&CacheLock);
+	AllDependencyCache.Empty();
+	HardDependencyCache.Empty();
+}
+
+int32 FMCPAssetGraphCache::GetCachedPackageCount() const
+{
+	FScopeLock Lock(&CacheLock);
+	TSet<FName> Packages;
+	for (const TPair<FName, TArray<FName>>& Entry : AllDependencyCache)
+	{
+		Packages.Add(Entry.Key);
+	}
+	for (const TPair<FName, TArray<FName>>& Entry : HardDependencyCache)
+	{
+		Packages.Add(Entry.Key);
+	}
+	return Packages.Num();
+}
@@ -0,0 +1,125 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+
+struct FAssetData;
+
+/**
+ * In-memory cache of asset registry dependency edges for the MCP asset tools.
+ *
+ * Agents exploring the content tree query the same packages in bursts, so
+ * repeated lookups become hash lookups instead of registry walks. Entries are
+ * invalidated through the registry's OnAssetUpdated/OnAssetRemoved events, so
+ * a package only pays for a fresh registry query after it actually changed.
+ *
+ * The cache also maintains a reverse-reference index (package -> referencing
+ * packages), built once in the background at module start and updated
+ * incrementally, so referencer queries answer from memory instead of the
+ * registry resolving reverse edges on demand.
+ */
+class FMCPAssetGraphCache
+{
+public:
+	static FMCPAssetGraphCache& Get();
+	~FMCPAssetGraphCache();
+
+	/**
+	 * Get the package dependencies of a package, from cache when possible.
+	 * @param PackageName - Package to query (e.g., '/Game/Blueprints/BP_Player')
+	 * @param bHardOnly - Restrict to hard dependencies
+	 * @param OutDependencies - Receives the dependency package names
+	 */
+	void GetDependencies(FName PackageName, bool bHardOnly, TArray<FName>& OutDependencies);
+
+	/**
+	 * Get the packages referencing a package. Served from the reverse index
+	 * when it is ready, falling back to a registry query while it builds.
+	 * @param PackageName - Package to query
+	 * @param bHardOnly - Restrict to hard references
+	 * @param OutReferencers - Receives the referencing package names
+	 */
+	void GetReferencers(FName PackageName, bool bHardOnly, TArray<FName>& OutReferencers);
+
+	/**
+	 * Kick off the background build of the reverse-reference index. Called
+	 * once at module start; waits for the registry's initial scan if needed.
+	 */
+	void StartReferencerIndexBuild();
+
+	/** Whether the reverse-reference index has finished building */
+	bool IsReferencerIndexReady() const { return bReferencerIndexReady; }
+
+	/** Drop every cached entry (e.g., after large content operations) */
+	void InvalidateAll();
+
+	/** Number of packages currently cached (for diagnostics) */
+	int32 GetCachedPackageCount() const;
+
+private:
+	FMCPAssetGraphCache();
+
+	/** Bind the registry invalidation delegates on first use */
+	void EnsureDelegatesRegistered();
+
+	/** Registry callback: an asset was saved or its tags changed */
+	void OnAssetUpdated(const FAssetData& AssetData);
+
+	/** Registry callback: an asset was deleted */
+	void OnAssetRemoved(const FAssetData& AssetData);
+
+	/** Registry callback: a new asset appeared */
+	void OnAssetAdded(const FAssetData& AssetData);
+
+	/** Drop the cached entries for one package */
+	void InvalidatePackage(FName PackageName);
+
+	/** Walk every package once and build the reverse index (thread pool) */
+	void BuildReferencerIndex();
+
+	/** Refresh one package's outgoing edges in the reverse index */
+	void ReindexPackage(FName PackageName);
+
+	/** Remove one package's outgoing edges from the reverse index */
+	void RemovePackageEdges(FName PackageName);
+
+	/** Cached dependency lists including soft references */
+	TMap<FName, TArray<FName>> AllDependencyCache;
+
+	/** Cached hard-only dependency lists */
+	TMap<FName, TArray<FName>> HardDependencyCache;
+
+	/** Reverse edges: package -> packages referencing it (all references) */
+	TMap<FName, TSet<FName>> ReferencersAll;
+
+	/** Reverse edges restricted to hard references */
+	TMap<FName, TSet<FName>> ReferencersHard;
+
+	/** Forward edges as last indexed, needed to diff on incremental updates */
+	TMap<FName, TArray<FName>> IndexedForwardAll;
+
+	/** Hard-only forward edges as last indexed */
+	TMap<FName, TArray<FName>> IndexedForwardHard;
+
+	/** Whether the registry delegates have been bound */
+	bool bDelegatesRegistered;
+
+	/** Whether StartReferencerIndexBuild has been called */
+	bool bReferencerIndexStarted;
+
+	/** Set once the background build has swapped the index in */
+	FThreadSafeBool bReferencerIndexReady;
+
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle FilesLoadedHandle;
+
+	/** Guards the cache maps */
+	mutable FCriticalSection CacheLock;
+
+	/** Guards the reverse index maps */
+	mutable FCriticalSection IndexLock;
+};
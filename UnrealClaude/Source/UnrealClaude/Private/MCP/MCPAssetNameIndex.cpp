@@ -0,0 +1,179 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPAssetNameIndex.h"
+#include "UnrealClaudeModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/ScopeLock.h"
+
+FMCPAssetNameIndex& FMCPAssetNameIndex::Get()
+{
+	static FMCPAssetNameIndex Instance;
+	return Instance;
+}
+
+uint32 FMCPAssetNameIndex::PackTrigram(const TCHAR* Chars)
+{
+	// Names are ASCII-heavy; folding to 10 bits per character keeps the
+	// rare wide character from colliding more than hashing already would
+	return ((static_cast<uint32>(Chars[0]) & 0x3FF) << 20) |
+		((static_cast<uint32>(Chars[1]) & 0x3FF) << 10) |
+		(static_cast<uint32>(Chars[2]) & 0x3FF);
+}
+
+void FMCPAssetNameIndex::BindRegistryEvents()
+{
+	check(IsInGameThread());
+	if (bEventsBound)
+	{
+		return;
+	}
+	bEventsBound = true;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.OnAssetsAdded().AddRaw(this, &FMCPAssetNameIndex::OnAssetsAdded);
+	AssetRegistry.OnAssetsRemoved().AddRaw(this, &FMCPAssetNameIndex::OnAssetsRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPAssetNameIndex::OnAssetRenamed);
+}
+
+void FMCPAssetNameIndex::BuildIndex()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.EnumerateAllAssets([this](const FAssetData& Asset)
+	{
+		AddEntry(Asset);
+		return true;
+	});
+
+	bBuilt = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Asset name index built: %d names, %d trigrams in %.1fms"),
+		Entries.Num(), Postings.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FMCPAssetNameIndex::AddEntry(const FAssetData& Asset)
+{
+	FSoftObjectPath Path = Asset.GetSoftObjectPath();
+	if (PathToEntry.Contains(Path))
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.LowerName = Asset.AssetName.ToString().ToLower();
+	Entry.Path = MoveTemp(Path);
+
+	const int32 EntryIndex = Entries.Num();
+	PathToEntry.Add(Entry.Path, EntryIndex);
+
+	const FString& Name = Entry.LowerName;
+	for (int32 Pos = 0; Pos + 3 <= Name.Len(); ++Pos)
+	{
+		TArray<int32>& Posting = Postings.FindOrAdd(PackTrigram(*Name + Pos));
+		// Repeated trigrams in one name would append duplicates back-to-back
+		if (Posting.Num() == 0 || Posting.Last() != EntryIndex)
+		{
+			Posting.Add(EntryIndex);
+		}
+	}
+
+	Entries.Add(MoveTemp(Entry));
+}
+
+void FMCPAssetNameIndex::RemoveEntry(const FAssetData& Asset)
+{
+	int32 EntryIndex;
+	if (PathToEntry.RemoveAndCopyValue(Asset.GetSoftObjectPath(), EntryIndex))
+	{
+		Entries[EntryIndex].bDead = true;
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetsAdded(TConstArrayView<FAssetData> Assets)
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		return; // The lazy build will see these
+	}
+	for (const FAssetData& Asset : Assets)
+	{
+		AddEntry(Asset);
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetsRemoved(TConstArrayView<FAssetData> Assets)
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		return;
+	}
+	for (const FAssetData& Asset : Assets)
+	{
+		RemoveEntry(Asset);
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		return;
+	}
+
+	int32 EntryIndex;
+	if (PathToEntry.RemoveAndCopyValue(FSoftObjectPath(OldObjectPath), EntryIndex))
+	{
+		Entries[EntryIndex].bDead = true;
+	}
+	AddEntry(Asset);
+}
+
+bool FMCPAssetNameIndex::QueryCandidates(const FString& Pattern, TArray<FSoftObjectPath>& OutCandidates)
+{
+	// Wildcard characters match literally under the substring semantics;
+	// their trigrams would (correctly) find nothing, but falling back keeps
+	// behavior identical to the pre-index scan for such patterns
+	if (Pattern.Len() < 3 || Pattern.Contains(TEXT("*")) || Pattern.Contains(TEXT("?")))
+	{
+		return false;
+	}
+
+	const FString Lower = Pattern.ToLower();
+
+	FScopeLock Lock(&IndexLock);
+	if (!bBuilt)
+	{
+		BuildIndex();
+	}
+
+	// The rarest trigram's posting list bounds the verification work; every
+	// true match must appear in all of the pattern's lists, so scanning the
+	// smallest one and substring-verifying is enough
+	const TArray<int32>* Smallest = nullptr;
+	for (int32 Pos = 0; Pos + 3 <= Lower.Len(); ++Pos)
+	{
+		const TArray<int32>* Posting = Postings.Find(PackTrigram(*Lower + Pos));
+		if (!Posting)
+		{
+			return true; // A trigram nothing contains: no matches at all
+		}
+		if (!Smallest || Posting->Num() < Smallest->Num())
+		{
+			Smallest = Posting;
+		}
+	}
+
+	for (int32 EntryIndex : *Smallest)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (!Entry.bDead && Entry.LowerName.Contains(Lower, ESearchCase::CaseSensitive))
+		{
+			OutCandidates.Add(Entry.Path);
+		}
+	}
+	return true;
+}
@@ -0,0 +1,210 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPAssetWatchStore.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/SoftObjectPath.h"
+
+FMCPAssetWatchStore& FMCPAssetWatchStore::Get()
+{
+	static FMCPAssetWatchStore Instance;
+	return Instance;
+}
+
+void FMCPAssetWatchStore::BindRegistryEvents()
+{
+	check(IsInGameThread());
+	if (bEventsBound)
+	{
+		return;
+	}
+	bEventsBound = true;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.OnAssetsAdded().AddRaw(this, &FMCPAssetWatchStore::OnAssetsAdded);
+	AssetRegistry.OnAssetsRemoved().AddRaw(this, &FMCPAssetWatchStore::OnAssetsRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPAssetWatchStore::OnAssetRenamed);
+}
+
+FString FMCPAssetWatchStore::CreateWatch(
+	const FString& ClassFilter,
+	const FString& PathFilter,
+	const FString& NamePattern,
+	FString& OutError)
+{
+	FWatch Watch;
+	Watch.Filter.bRecursivePaths = true;
+	Watch.Filter.bRecursiveClasses = true;
+	Watch.NamePattern = NamePattern;
+	Watch.LastPollTime = FDateTime::UtcNow();
+
+	if (!PathFilter.IsEmpty())
+	{
+		Watch.Filter.PackagePaths.Add(FName(*PathFilter));
+	}
+
+	if (!ClassFilter.IsEmpty())
+	{
+		// Same short-name resolution asset_search applies, so a watch
+		// matches exactly what the equivalent search would have returned
+		FString ClassPath = ClassFilter;
+		if (!ClassPath.StartsWith(TEXT("/")))
+		{
+			UClass* FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *ClassFilter));
+			if (!FoundClass)
+			{
+				FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassFilter));
+			}
+			if (!FoundClass)
+			{
+				FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Niagara.%s"), *ClassFilter));
+			}
+			if (!FoundClass)
+			{
+				FoundClass = FindObject<UClass>(nullptr, *ClassFilter);
+			}
+			ClassPath = FoundClass
+				? FoundClass->GetClassPathName().ToString()
+				: FString::Printf(TEXT("/Script/Engine.%s"), *ClassFilter);
+		}
+		Watch.Filter.ClassPaths.Add(FTopLevelAssetPath(ClassPath));
+	}
+
+	FScopeLock Lock(&WatchesLock);
+	PurgeExpired();
+
+	if (Watches.Num() >= UnrealClaudeConstants::MCPServer::MaxAssetWatches)
+	{
+		OutError = FString::Printf(TEXT("Watch limit reached (%d) - cancel an existing watch first"),
+			UnrealClaudeConstants::MCPServer::MaxAssetWatches);
+		return FString();
+	}
+
+	FString Token = FGuid::NewGuid().ToString();
+	Watches.Add(Token, MoveTemp(Watch));
+	return Token;
+}
+
+bool FMCPAssetWatchStore::PollWatch(
+	const FString& WatchId,
+	TArray<FWatchedAsset>& OutAdded,
+	TArray<FWatchedAsset>& OutRemoved,
+	bool& bOutOverflowed)
+{
+	FScopeLock Lock(&WatchesLock);
+	PurgeExpired();
+
+	FWatch* Watch = Watches.Find(WatchId);
+	if (!Watch)
+	{
+		return false;
+	}
+
+	OutAdded = MoveTemp(Watch->PendingAdded);
+	OutRemoved = MoveTemp(Watch->PendingRemoved);
+	bOutOverflowed = Watch->bOverflowed;
+	Watch->PendingAdded.Reset();
+	Watch->PendingRemoved.Reset();
+	Watch->bOverflowed = false;
+	Watch->LastPollTime = FDateTime::UtcNow();
+	return true;
+}
+
+bool FMCPAssetWatchStore::CancelWatch(const FString& WatchId)
+{
+	FScopeLock Lock(&WatchesLock);
+	return Watches.Remove(WatchId) > 0;
+}
+
+void FMCPAssetWatchStore::PurgeExpired()
+{
+	const FDateTime Now = FDateTime::UtcNow();
+	for (auto It = Watches.CreateIterator(); It; ++It)
+	{
+		if ((Now - It->Value.LastPollTime).GetTotalSeconds() >
+			UnrealClaudeConstants::MCPServer::AssetWatchTTLSeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FMCPAssetWatchStore::RecordDeltas(TConstArrayView<FAssetData> Assets, bool bRemoved)
+{
+	if (Assets.Num() == 0 || Watches.Num() == 0)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	for (auto& Pair : Watches)
+	{
+		FWatch& Watch = Pair.Value;
+
+		// The compiled filter evaluates class and path exactly as a search
+		// would, including recursion; only the name pattern is applied by hand
+		TArray<FAssetData> Matched(Assets.GetData(), Assets.Num());
+		AssetRegistry.RunAssetsThroughFilter(Matched, Watch.Filter);
+
+		for (const FAssetData& Asset : Matched)
+		{
+			if (!Watch.NamePattern.IsEmpty() &&
+				!Asset.AssetName.ToString().Contains(Watch.NamePattern))
+			{
+				continue;
+			}
+
+			TArray<FWatchedAsset>& Pending = bRemoved ? Watch.PendingRemoved : Watch.PendingAdded;
+			if (Watch.PendingAdded.Num() + Watch.PendingRemoved.Num() >=
+				UnrealClaudeConstants::MCPServer::MaxAssetWatchPendingDeltas)
+			{
+				// Dropped deltas are unrecoverable; flag it so the client
+				// resynchronizes with one full search instead of trusting
+				// an incomplete stream
+				Watch.bOverflowed = true;
+				break;
+			}
+
+			FWatchedAsset Delta;
+			Delta.ObjectPath = Asset.GetSoftObjectPath().ToString();
+			Delta.AssetName = Asset.AssetName.ToString();
+			Delta.ClassPath = Asset.AssetClassPath.ToString();
+			Pending.Add(MoveTemp(Delta));
+		}
+	}
+}
+
+void FMCPAssetWatchStore::OnAssetsAdded(TConstArrayView<FAssetData> Assets)
+{
+	FScopeLock Lock(&WatchesLock);
+	RecordDeltas(Assets, /*bRemoved=*/false);
+}
+
+void FMCPAssetWatchStore::OnAssetsRemoved(TConstArrayView<FAssetData> Assets)
+{
+	FScopeLock Lock(&WatchesLock);
+	RecordDeltas(Assets, /*bRemoved=*/true);
+}
+
+void FMCPAssetWatchStore::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	// A rename is a removal at the old path plus an addition at the new one.
+	// The registry no longer has data for the old path, so synthesize just
+	// enough of it for filter evaluation (the class cannot change on rename)
+	const FSoftObjectPath OldPath(OldObjectPath);
+	const FString OldPackageName = OldPath.GetLongPackageName();
+	const FAssetData OldData(
+		FName(*OldPackageName),
+		FName(*FPackageName::GetLongPackagePath(OldPackageName)),
+		FName(*OldPath.GetAssetName()),
+		Asset.AssetClassPath);
+
+	FScopeLock Lock(&WatchesLock);
+	RecordDeltas(MakeArrayView(&OldData, 1), /*bRemoved=*/true);
+	RecordDeltas(MakeArrayView(&Asset, 1), /*bRemoved=*/false);
+}
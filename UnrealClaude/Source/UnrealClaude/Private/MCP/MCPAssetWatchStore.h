@@ -0,0 +1,108 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Misc/DateTime.h"
+
+struct FAssetData;
+
+/**
+ * Registered saved-search watches fed by asset registry events
+ *
+ * Agents monitoring for new or deleted assets re-ran asset_search in a
+ * loop, paying a full registry scan per poll just to diff two result
+ * sets. A watch registers the same class/path/name filters asset_search
+ * accepts once; registry add/remove/rename events are then evaluated
+ * against the stored filter as they arrive, and polling returns only the
+ * accumulated deltas - event-cost instead of scan-cost.
+ *
+ * Events fire on the game thread (bound once at MCP server start, same
+ * as the asset name index); polls come from worker threads, so all watch
+ * state sits behind a lock. With no watches registered the handlers
+ * return before touching the registry, keeping the idle cost of the
+ * bound delegates negligible.
+ *
+ * Watches are bounded the same way search cursors are: a hard cap on
+ * live watches, lazy expiry of watches nobody has polled recently, and a
+ * per-watch cap on buffered deltas - a watch that overflows reports it
+ * so the client knows to fall back to one fresh full search.
+ */
+class FMCPAssetWatchStore
+{
+public:
+	/** One asset that entered or left a watch's match set */
+	struct FWatchedAsset
+	{
+		FString ObjectPath;
+		FString AssetName;
+		FString ClassPath;
+	};
+
+	static FMCPAssetWatchStore& Get();
+
+	/**
+	 * Subscribe to asset registry events so watches receive deltas.
+	 * Game thread, idempotent; called once at MCP server start.
+	 */
+	void BindRegistryEvents();
+
+	/**
+	 * Register a watch over the given filters (all optional, AND logic,
+	 * identical semantics to asset_search). Returns the watch token, or
+	 * empty with OutError set when the watch cap is reached.
+	 */
+	FString CreateWatch(
+		const FString& ClassFilter,
+		const FString& PathFilter,
+		const FString& NamePattern,
+		FString& OutError);
+
+	/**
+	 * Drain the deltas accumulated since the last poll. bOutOverflowed
+	 * reports that deltas were dropped since the previous poll; the
+	 * caller should re-run a full asset_search to resynchronize.
+	 * Returns false for an unknown or expired watch token.
+	 */
+	bool PollWatch(
+		const FString& WatchId,
+		TArray<FWatchedAsset>& OutAdded,
+		TArray<FWatchedAsset>& OutRemoved,
+		bool& bOutOverflowed);
+
+	/** Unregister a watch. Returns false when the token is unknown. */
+	bool CancelWatch(const FString& WatchId);
+
+private:
+	FMCPAssetWatchStore() = default;
+
+	/** One registered saved search and its undelivered deltas */
+	struct FWatch
+	{
+		FARFilter Filter;
+		FString NamePattern;
+		FDateTime LastPollTime;
+		TArray<FWatchedAsset> PendingAdded;
+		TArray<FWatchedAsset> PendingRemoved;
+		bool bOverflowed = false;
+	};
+
+	/** Evaluate one event batch against every watch; caller holds WatchesLock */
+	void RecordDeltas(TConstArrayView<FAssetData> Assets, bool bRemoved);
+
+	/** Drop watches nobody has polled within the TTL; caller holds WatchesLock */
+	void PurgeExpired();
+
+	void OnAssetsAdded(TConstArrayView<FAssetData> Assets);
+	void OnAssetsRemoved(TConstArrayView<FAssetData> Assets);
+	void OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+
+	/** Live watches keyed by token */
+	TMap<FString, FWatch> Watches;
+
+	/** Guards Watches against worker-thread polls racing game-thread events */
+	FCriticalSection WatchesLock;
+
+	bool bEventsBound = false;
+};
@@ -4,7 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "MCPToolBase.h"
+#include "JsonUtils.h"
 #include "HAL/ThreadSafeBool.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 
 /**
  * Status of an async MCP task
@@ -25,12 +29,31 @@ enum class EMCPTaskStatus : uint8
 	TimedOut
 };
 
+/**
+ * Scheduling priority of an async MCP task
+ *
+ * Interactive queries (task_status, blueprint_query) should run High so
+ * they are not stuck behind long batch work like execute_script.
+ */
+enum class EMCPTaskPriority : uint8
+{
+	/** Dispatched before Normal and Low work */
+	High,
+	/** Default priority */
+	Normal,
+	/** Only dispatched when no higher-priority work is pending */
+	Low
+};
+
 /**
  * Represents an async MCP task that can be submitted and polled for results
  */
 struct FMCPAsyncTask
 {
-	/** Unique task identifier */
+	/** Unique task identifier. Doubles as the trace id for the request: it is
+	 *  injected into the tool params as _task_id, stamped on the Insights
+	 *  bookmark at dispatch, and keys the per-hop timing fields in ToJson,
+	 *  so one id follows the work across every thread it crosses */
 	FGuid TaskId;
 
 	/** Name of the tool being executed */
@@ -54,24 +77,87 @@ struct FMCPAsyncTask
 	/** When the task was submitted */
 	FDateTime SubmittedTime;
 
-	/** When the task started executing */
+	/** When a worker dequeued the task and began executing it. The gap back
+	 *  to SubmittedTime is pure queue wait - before this existed, wall
+	 *  duration lumped the two together */
 	FDateTime StartedTime;
 
+	/** When tool code first began running on the game thread for this task
+	 *  (zero for thread-safe tools, which never touch the frame). The gap
+	 *  back to StartedTime is dispatch wait behind other game-thread work */
+	FDateTime GameThreadEnteredTime;
+
 	/** When the task completed */
 	FDateTime CompletedTime;
 
+	/** Cycle-counter time spent executing on the game thread, accumulated
+	 *  across dispatches and sliced steps. This is the frame time the task
+	 *  actually stole - the number that identifies hitch-causing tools */
+	TAtomic<uint64> GameThreadCycles;
+
+	/** Cycle-counter time spent serializing the result envelope to UTF-8
+	 *  (set once by BuildSerializedResult on the finalizing thread). The
+	 *  frozen envelope predates the measurement, so the figure surfaces on
+	 *  status polls and in Insights rather than inside the buffer itself */
+	TAtomic<uint64> SerializeCycles;
+
+	/** Parameters passed the tool's compiled checks at submission; execution
+	 *  skips revalidation so validation runs exactly once per call */
+	bool bParamsPrevalidated = false;
+
 	/** Timeout in milliseconds (0 = use default) */
 	uint32 TimeoutMs;
 
+	/** Scheduling priority (fixed at submission) */
+	EMCPTaskPriority Priority;
+
+	/** Batch work opts in at submission: garbage collection is held off while
+	 *  the task executes and one collection runs at task end, instead of
+	 *  incremental GC pauses interleaving with the batch */
+	bool bDeferGC;
+
 	/** Flag to request cancellation */
 	FThreadSafeBool bCancellationRequested;
 
+	/** Tasks that must go terminal before this one is dispatched (fixed at
+	 *  submission; only already-submitted IDs are accepted, so the
+	 *  dependency graph is acyclic by construction) */
+	TArray<FGuid> PrerequisiteIds;
+
+	/** Prerequisites not yet terminal; the task dispatches (or fails, see
+	 *  below) when this drains to zero */
+	TAtomic<int32> PendingPrerequisites;
+
+	/** Set when any prerequisite finished unsuccessfully; the task fails
+	 *  instead of dispatching once the remaining prerequisites drain */
+	FThreadSafeBool bPrerequisiteFailed;
+
+	/** The task_result response envelope, serialized to UTF-8 once when the
+	 *  task went terminal (on the worker thread). Pollers hand this buffer
+	 *  to the HTTP layer by reference instead of rebuilding and
+	 *  re-serializing the JSON on every fetch. Immutable once set. */
+	TSharedPtr<const TArray<uint8>> SerializedResult;
+
+	/** Output appended incrementally by the running tool (script stdout/log
+	 *  lines), so pollers see progress before the task finishes. Guarded by
+	 *  PartialOutputLock; read through a character cursor. */
+	FString PartialOutput;
+
+	/** Guards PartialOutput (appended by the executing thread, read by pollers) */
+	mutable FCriticalSection PartialOutputLock;
+
 	FMCPAsyncTask()
 		: Status(EMCPTaskStatus::Pending)
 		, Progress(-1)
 		, SubmittedTime(FDateTime::UtcNow())
+		, GameThreadCycles(0)
+		, SerializeCycles(0)
 		, TimeoutMs(0)
+		, Priority(EMCPTaskPriority::Normal)
+		, bDeferGC(false)
 		, bCancellationRequested(false)
+		, PendingPrerequisites(0)
+		, bPrerequisiteFailed(false)
 	{
 		TaskId = FGuid::NewGuid();
 	}
@@ -91,6 +177,93 @@ struct FMCPAsyncTask
 		}
 	}
 
+	/** Get priority as string for JSON serialization */
+	static FString PriorityToString(EMCPTaskPriority InPriority)
+	{
+		switch (InPriority)
+		{
+		case EMCPTaskPriority::High: return TEXT("high");
+		case EMCPTaskPriority::Low: return TEXT("low");
+		default: return TEXT("normal");
+		}
+	}
+
+	/** Parse priority from string (defaults to Normal on unknown values) */
+	static EMCPTaskPriority PriorityFromString(const FString& InPriority)
+	{
+		if (InPriority.Equals(TEXT("high"), ESearchCase::IgnoreCase))
+		{
+			return EMCPTaskPriority::High;
+		}
+		if (InPriority.Equals(TEXT("low"), ESearchCase::IgnoreCase))
+		{
+			return EMCPTaskPriority::Low;
+		}
+		return EMCPTaskPriority::Normal;
+	}
+
+	/** Record the first entry of tool code onto the game thread for this task.
+	 *  Game thread only (dispatch lambda or slicer), so no guard is needed. */
+	void MarkGameThreadEntered()
+	{
+		if (GameThreadEnteredTime.GetTicks() == 0)
+		{
+			GameThreadEnteredTime = FDateTime::UtcNow();
+		}
+	}
+
+	/** Attribute one span of game-thread execution (cycle-counter delta) */
+	void AddGameThreadCycles(uint64 Cycles)
+	{
+		GameThreadCycles += Cycles;
+	}
+
+	/** Append a chunk of incremental output from the executing tool */
+	void AppendPartialOutput(const FString& Chunk)
+	{
+		FScopeLock Lock(&PartialOutputLock);
+		PartialOutput += Chunk;
+	}
+
+	/** Read output produced past the cursor; OutNextCursor is the value to
+	 *  pass on the next poll (the buffer's current length) */
+	FString ReadPartialOutput(int32 Cursor, int32& OutNextCursor) const
+	{
+		FScopeLock Lock(&PartialOutputLock);
+		OutNextCursor = PartialOutput.Len();
+		if (Cursor < 0 || Cursor >= PartialOutput.Len())
+		{
+			return FString();
+		}
+		return PartialOutput.Mid(Cursor);
+	}
+
+	/**
+	 * Rough retained bytes for the memory accounting gauges: parameter and
+	 * result trees, the serialized envelope, binary payload and buffered
+	 * output. Best-effort for running tasks (fields may be mid-write);
+	 * exact enough for the terminal tasks retention actually keeps around.
+	 */
+	uint64 GetEstimatedMemoryBytes() const
+	{
+		uint64 Bytes = sizeof(FMCPAsyncTask)
+			+ ToolName.GetAllocatedSize()
+			+ ProgressMessage.GetAllocatedSize()
+			+ Result.Message.GetAllocatedSize()
+			+ Result.BinaryData.GetAllocatedSize();
+		Bytes += FJsonUtils::EstimateTreeBytes(Parameters);
+		Bytes += FJsonUtils::EstimateTreeBytes(Result.Data);
+		if (SerializedResult.IsValid())
+		{
+			Bytes += SerializedResult->GetAllocatedSize();
+		}
+		{
+			FScopeLock Lock(&PartialOutputLock);
+			Bytes += PartialOutput.GetAllocatedSize();
+		}
+		return Bytes;
+	}
+
 	/** Check if task is in a terminal state */
 	bool IsComplete() const
 	{
@@ -108,6 +281,7 @@ struct FMCPAsyncTask
 		Json->SetStringField(TEXT("task_id"), TaskId.ToString());
 		Json->SetStringField(TEXT("tool_name"), ToolName);
 		Json->SetStringField(TEXT("status"), StatusToString(Status.Load()));
+		Json->SetStringField(TEXT("priority"), PriorityToString(Priority));
 		Json->SetNumberField(TEXT("progress"), Progress.Load());
 
 		if (!ProgressMessage.IsEmpty())
@@ -117,9 +291,37 @@ struct FMCPAsyncTask
 
 		Json->SetStringField(TEXT("submitted_at"), SubmittedTime.ToIso8601());
 
+		if (PrerequisiteIds.Num() > 0)
+		{
+			TArray<TSharedPtr<FJsonValue>> DependsOn;
+			for (const FGuid& PrereqId : PrerequisiteIds)
+			{
+				DependsOn.Add(MakeShared<FJsonValueString>(PrereqId.ToString()));
+			}
+			Json->SetArrayField(TEXT("depends_on"), DependsOn);
+			if (Status.Load() == EMCPTaskStatus::Pending)
+			{
+				Json->SetNumberField(TEXT("pending_prerequisites"), PendingPrerequisites.Load());
+			}
+		}
+
 		if (Status.Load() != EMCPTaskStatus::Pending)
 		{
+			// Phase timing: queue wait, dispatch wait and frame time consumed
+			// are reported separately so pollers can see where a slow task's
+			// time actually went instead of one lumped wall duration
 			Json->SetStringField(TEXT("started_at"), StartedTime.ToIso8601());
+			Json->SetNumberField(TEXT("queue_wait_ms"), (StartedTime - SubmittedTime).GetTotalMilliseconds());
+			if (GameThreadEnteredTime.GetTicks() != 0)
+			{
+				Json->SetStringField(TEXT("game_thread_entered_at"), GameThreadEnteredTime.ToIso8601());
+				Json->SetNumberField(TEXT("game_thread_wait_ms"), (GameThreadEnteredTime - StartedTime).GetTotalMilliseconds());
+			}
+			const uint64 Cycles = GameThreadCycles.Load();
+			if (Cycles > 0)
+			{
+				Json->SetNumberField(TEXT("game_thread_ms"), FPlatformTime::ToMilliseconds64(Cycles));
+			}
 		}
 
 		if (IsComplete())
@@ -130,6 +332,12 @@ struct FMCPAsyncTask
 			FTimespan Duration = CompletedTime - StartedTime;
 			Json->SetNumberField(TEXT("duration_ms"), Duration.GetTotalMilliseconds());
 
+			const uint64 SerCycles = SerializeCycles.Load();
+			if (SerCycles > 0)
+			{
+				Json->SetNumberField(TEXT("serialize_ms"), FPlatformTime::ToMilliseconds64(SerCycles));
+			}
+
 			if (bIncludeResult)
 			{
 				Json->SetBoolField(TEXT("success"), Result.bSuccess);
@@ -138,9 +346,45 @@ struct FMCPAsyncTask
 				{
 					Json->SetObjectField(TEXT("data"), Result.Data);
 				}
+				else if (Result.HasPrebuiltBody())
+				{
+					// Streamed-row producers skip the JSON tree and carry the
+					// serialized envelope instead; the task envelope embeds
+					// objects, so parse the data field back out here (the
+					// direct HTTP route still ships the buffer untouched)
+					TSharedPtr<FJsonObject> Envelope = FJsonUtils::ParseUtf8(*Result.PrebuiltBody);
+					const TSharedPtr<FJsonObject>* DataObj;
+					if (Envelope.IsValid() && Envelope->TryGetObjectField(TEXT("data"), DataObj))
+					{
+						Json->SetObjectField(TEXT("data"), *DataObj);
+					}
+				}
 			}
 		}
 
 		return Json;
 	}
+
+	/**
+	 * Serialize the full result envelope into the shared buffer.
+	 * Call exactly once, on the thread that finalized the task, after Result
+	 * and CompletedTime are set. Matches the envelope the HTTP server builds
+	 * for a direct tool call: { success, message, data }.
+	 */
+	void BuildSerializedResult()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FMCPAsyncTask::BuildSerializedResult);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		TSharedPtr<FJsonObject> Envelope = MakeShared<FJsonObject>();
+		Envelope->SetBoolField(TEXT("success"), Result.bSuccess);
+		Envelope->SetStringField(TEXT("message"), Result.Message);
+		Envelope->SetObjectField(TEXT("data"), ToJson(true));
+
+		// Straight to UTF-8 wire bytes - no UTF-16 intermediary, no transcode
+		TSharedPtr<TArray<uint8>> Bytes = MakeShared<TArray<uint8>>();
+		FJsonUtils::StringifyUtf8(Envelope.ToSharedRef(), *Bytes);
+		SerializeCycles = FPlatformTime::Cycles64() - StartCycles;
+		SerializedResult = Bytes;
+	}
 };
@@ -13,6 +13,11 @@
  * Context helper for Blueprint load-validate-modify operations
  * Eliminates ~220 lines of duplicate boilerplate across MCP tools
  *
+ * Resolution goes through FBlueprintLoader's shared path -> weak handle
+ * cache, so all tools using this context (query, modify, anim modify)
+ * share resolutions: repeated requests against the same Blueprint skip
+ * the load/find entirely after a cheap handle validation.
+ *
  * Usage:
  *   FMCPBlueprintLoadContext Context;
  *   if (auto Error = Context.LoadAndValidate(Params))
@@ -38,6 +43,10 @@ public:
 	/** Detailed compile result (populated after CompileAndFinalize) */
 	FBlueprintCompileResult CompileResult;
 
+	/** When set (via the defer_compile parameter), CompileAndFinalize only
+	 *  marks the Blueprint dirty; the caller owes one explicit compile later */
+	bool bDeferCompile = false;
+
 	/**
 	 * Load and validate a Blueprint from JSON parameters
 	 * Handles: path extraction, path validation, loading, and editability check
@@ -76,6 +85,9 @@ public:
 			return FMCPToolResult::Error(LastError);
 		}
 
+		// Batched edit sessions skip the per-operation compile
+		Params->TryGetBoolField(TEXT("defer_compile"), bDeferCompile);
+
 		return TOptional<FMCPToolResult>();
 	}
 
@@ -129,6 +141,17 @@ public:
 			return FMCPToolResult::Error(LastError);
 		}
 
+		// Deferred mode: record the mutation, leave the compile for the
+		// explicit 'compile' operation that ends the session
+		if (bDeferCompile)
+		{
+			FBlueprintUtils::MarkBlueprintDirty(Blueprint);
+			CompileResult = FBlueprintCompileResult();
+			CompileResult.bSuccess = true;
+			CompileResult.StatusString = TEXT("Deferred");
+			return TOptional<FMCPToolResult>();
+		}
+
 		// Compile with detailed result capture
 		CompileResult = FBlueprintLoader::CompileBlueprintWithResult(Blueprint);
 
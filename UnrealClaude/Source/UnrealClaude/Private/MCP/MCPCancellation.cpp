@@ -0,0 +1,34 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPCancellation.h"
+
+FMCPCancellationRegistry& FMCPCancellationRegistry::Get()
+{
+	static FMCPCancellationRegistry Instance;
+	return Instance;
+}
+
+void FMCPCancellationRegistry::Register(const FString& TaskId, const FThreadSafeBool* Flag)
+{
+	FScopeLock ScopeLock(&Lock);
+	Flags.Add(TaskId, Flag);
+}
+
+void FMCPCancellationRegistry::Unregister(const FString& TaskId)
+{
+	FScopeLock ScopeLock(&Lock);
+	Flags.Remove(TaskId);
+}
+
+FMCPCancellationToken FMCPCancellationRegistry::TokenFor(const TSharedRef<FJsonObject>& Params) const
+{
+	FString TaskIdString;
+	if (!Params->TryGetStringField(TEXT("_task_id"), TaskIdString))
+	{
+		return FMCPCancellationToken(); // Direct call - nothing to observe
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	const FThreadSafeBool* const* Found = Flags.Find(TaskIdString);
+	return Found ? FMCPCancellationToken(*Found) : FMCPCancellationToken();
+}
@@ -0,0 +1,65 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Cooperative cancellation observer for long-running tool executions.
+ *
+ * CancelTask can only flip a flag; whether that reclaims the editor depends
+ * on the running tool noticing. A token wraps the owning task's cancellation
+ * flag so loops can check it at iteration boundaries and unwind with partial
+ * results, without every tool growing its own task-queue plumbing. Tokens
+ * constructed for a direct HTTP call (no owning task) are inert and always
+ * report not-cancelled, so checks cost one null test outside the queue.
+ *
+ * The flag pointer stays valid for the token's useful lifetime: the queue
+ * registers it just before executing the task and unregisters after, and the
+ * task object is held alive across that whole window.
+ */
+class FMCPCancellationToken
+{
+public:
+	FMCPCancellationToken() = default;
+	explicit FMCPCancellationToken(const FThreadSafeBool* InFlag)
+		: Flag(InFlag)
+	{
+	}
+
+	/** Check at iteration boundaries; true means stop and return what you have */
+	bool IsCancelled() const { return Flag && *Flag; }
+
+private:
+	const FThreadSafeBool* Flag = nullptr;
+};
+
+/**
+ * Maps running task IDs to their cancellation flags so tools can build a
+ * token from the _task_id the queue injects into their parameters. The
+ * queue registers each task for exactly the span of its execution.
+ */
+class FMCPCancellationRegistry
+{
+public:
+	static FMCPCancellationRegistry& Get();
+
+	/** Publish a running task's cancellation flag (queue-side, pre-execute) */
+	void Register(const FString& TaskId, const FThreadSafeBool* Flag);
+
+	/** Retract the flag once execution returns (queue-side, post-execute) */
+	void Unregister(const FString& TaskId);
+
+	/** Token for the task owning this execution; inert if the parameters
+	 *  carry no _task_id or the task is no longer registered */
+	FMCPCancellationToken TokenFor(const TSharedRef<FJsonObject>& Params) const;
+
+private:
+	/** Flags of currently executing tasks, keyed by task ID string */
+	TMap<FString, const FThreadSafeBool*> Flags;
+
+	/** Guards the flag map (registration races token construction) */
+	mutable FCriticalSection Lock;
+};
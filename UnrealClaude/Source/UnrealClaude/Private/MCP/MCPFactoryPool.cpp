@@ -0,0 +1,62 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPFactoryPool.h"
+#include "UnrealClaudeConstants.h"
+
+FMCPFactoryPool& FMCPFactoryPool::Get()
+{
+	static FMCPFactoryPool Instance;
+	return Instance;
+}
+
+UFactory* FMCPFactoryPool::GetFactoryInternal(UClass* FactoryClass)
+{
+	using namespace UnrealClaudeConstants::FactoryPool;
+
+	check(IsInGameThread());
+
+	LastUseTime = FPlatformTime::Seconds();
+
+	if (TStrongObjectPtr<UFactory>* Pooled = PooledFactories.Find(FactoryClass))
+	{
+		if (UFactory* Factory = Pooled->Get())
+		{
+			return Factory;
+		}
+		PooledFactories.Remove(FactoryClass);
+	}
+
+	UFactory* Factory = NewObject<UFactory>(GetTransientPackage(), FactoryClass);
+	PooledFactories.Add(FactoryClass, TStrongObjectPtr<UFactory>(Factory));
+
+	// First fetch of a burst arms the release ticker; it re-checks at the
+	// idle interval and drops the pool once no operation has refreshed the
+	// timestamp. The singleton never dies, so capturing this is safe.
+	if (!IdleReleaseTickerHandle.IsValid())
+	{
+		IdleReleaseTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda([this](float /*DeltaTime*/)
+			{
+				if (FPlatformTime::Seconds() - LastUseTime < IdleReleaseSeconds)
+				{
+					return true; // creation burst still active - keep watching
+				}
+				PooledFactories.Empty();
+				// Returning false removes this ticker; just forget the handle
+				IdleReleaseTickerHandle.Reset();
+				return false;
+			}), IdleReleaseSeconds);
+	}
+
+	return Factory;
+}
+
+void FMCPFactoryPool::ReleaseAll()
+{
+	PooledFactories.Empty();
+	if (IdleReleaseTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(IdleReleaseTickerHandle);
+		IdleReleaseTickerHandle.Reset();
+	}
+}
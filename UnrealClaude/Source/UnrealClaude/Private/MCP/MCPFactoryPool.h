@@ -0,0 +1,59 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Factories/Factory.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * Warm pool of factory objects for the asset creation tools.
+ *
+ * Every create-asset operation used to construct a fresh factory
+ * (NewObject<UBlueprintFactory> and friends) just to call FactoryCreateNew
+ * once and abandon it to GC. Agents scaffolding content in loops pay that
+ * construction plus the resulting GC churn on every call, so the pool keeps
+ * one pre-initialized instance per factory class rooted and hands it back
+ * out on subsequent operations. An idle ticker releases the pool once
+ * creation stops, the same pattern the Blueprint burst pins use.
+ *
+ * Callers must set every factory property they depend on before use - a
+ * pooled instance still carries the configuration of the previous
+ * operation. Game thread only, like the tools that use it.
+ */
+class FMCPFactoryPool
+{
+public:
+	static FMCPFactoryPool& Get();
+
+	/**
+	 * Fetch the pooled instance of a factory class, creating and rooting it
+	 * on first use. Refreshes the idle-release window.
+	 */
+	template <typename TFactory>
+	TFactory* GetFactory()
+	{
+		return CastChecked<TFactory>(GetFactoryInternal(TFactory::StaticClass()));
+	}
+
+	/**
+	 * Drop every pooled factory immediately
+	 * Called at module shutdown so no strong references outlive the UObject
+	 * system; the idle ticker handles the steady-state release
+	 */
+	void ReleaseAll();
+
+private:
+	UFactory* GetFactoryInternal(UClass* FactoryClass);
+
+	/** One rooted instance per factory class */
+	TMap<UClass*, TStrongObjectPtr<UFactory>> PooledFactories;
+
+	/** FPlatformTime::Seconds() of the most recent fetch; the release ticker
+	 *  drops the pool once this goes stale */
+	double LastUseTime = 0.0;
+
+	/** Ticker that releases the pool after an idle window */
+	FTSTicker::FDelegateHandle IdleReleaseTickerHandle;
+};
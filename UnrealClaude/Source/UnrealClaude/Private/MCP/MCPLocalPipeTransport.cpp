@@ -0,0 +1,279 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPLocalPipeTransport.h"
+#include "MCPToolRegistry.h"
+#include "MCPTaskQueue.h"
+#include "MCPAdmissionController.h"
+#include "MCPToolMetrics.h"
+#include "JsonUtils.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "HAL/Event.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeExit.h"
+
+FMCPLocalPipeTransport::FMCPLocalPipeTransport(TSharedPtr<FMCPToolRegistry> InToolRegistry)
+	: ToolRegistry(InToolRegistry)
+{
+}
+
+FMCPLocalPipeTransport::~FMCPLocalPipeTransport()
+{
+	Shutdown();
+}
+
+bool FMCPLocalPipeTransport::Start(uint32 ServerPort)
+{
+#if PLATFORM_WINDOWS
+	PipeName = FString::Printf(TEXT("%s_%u"),
+		UnrealClaudeConstants::MCPServer::LocalPipeBasePath, ServerPort);
+
+	if (!Pipe.Create(PipeName, true /*bServer*/, false /*bAsync*/))
+	{
+		UE_LOG(LogUnrealClaude, Warning,
+			TEXT("Local pipe transport could not claim %s (another editor instance?)"), *PipeName);
+		return false;
+	}
+
+	ListenerThread = FRunnableThread::Create(this, TEXT("MCPLocalPipe"), 0, TPri_BelowNormal);
+	if (!ListenerThread)
+	{
+		Pipe.Destroy();
+		return false;
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Local pipe transport listening on %s"), *PipeName);
+	return true;
+#else
+	// The engine implements named pipes only on Windows, and its socket
+	// abstraction exposes no Unix-domain bind, so non-Windows stays on TCP
+	UE_LOG(LogUnrealClaude, Log, TEXT("Local pipe transport unavailable on this platform; using TCP"));
+	return false;
+#endif
+}
+
+void FMCPLocalPipeTransport::Shutdown()
+{
+#if PLATFORM_WINDOWS
+	if (!ListenerThread)
+	{
+		return;
+	}
+
+	bStopping = true;
+
+	// The listener blocks in OpenConnection() between clients; a throwaway
+	// client connection releases it so the thread can observe the flag
+	{
+		FPlatformNamedPipe WakeClient;
+		if (WakeClient.Create(PipeName, false /*bServer*/, false /*bAsync*/))
+		{
+			WakeClient.Destroy();
+		}
+	}
+
+	ListenerThread->Kill(true);
+	delete ListenerThread;
+	ListenerThread = nullptr;
+
+	Pipe.Destroy();
+	UE_LOG(LogUnrealClaude, Log, TEXT("Local pipe transport stopped"));
+#endif
+}
+
+uint32 FMCPLocalPipeTransport::Run()
+{
+#if PLATFORM_WINDOWS
+	while (!bStopping)
+	{
+		// One client at a time: the single local agent. Blocks until a
+		// client connects or Stop() wakes us with its throwaway connection
+		if (!Pipe.OpenConnection())
+		{
+			break;
+		}
+		if (bStopping)
+		{
+			break;
+		}
+
+		// Frame loop for this client; a failed read is the disconnect signal
+		TArray<uint8> Frame;
+		while (!bStopping && ReadFrame(Frame))
+		{
+			TArray<uint8> Response;
+			ProcessFrame(Frame, Response);
+			if (!WriteFrame(Response))
+			{
+				break;
+			}
+		}
+
+		// Recycle the pipe instance for the next client
+		Pipe.Destroy();
+		if (!bStopping && !Pipe.Create(PipeName, true /*bServer*/, false /*bAsync*/))
+		{
+			UE_LOG(LogUnrealClaude, Warning, TEXT("Local pipe transport could not re-create %s"), *PipeName);
+			break;
+		}
+	}
+#endif
+	return 0;
+}
+
+bool FMCPLocalPipeTransport::ReadFrame(TArray<uint8>& OutFrame)
+{
+#if PLATFORM_WINDOWS
+	uint32 FrameLength = 0;
+	if (!Pipe.ReadBytes(sizeof(FrameLength), &FrameLength))
+	{
+		return false;
+	}
+
+	if (FrameLength == 0 ||
+		FrameLength > static_cast<uint32>(UnrealClaudeConstants::MCPServer::MaxPipeFrameBytes))
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Local pipe frame length %u rejected"), FrameLength);
+		return false;
+	}
+
+	OutFrame.SetNumUninitialized(static_cast<int32>(FrameLength));
+	return Pipe.ReadBytes(OutFrame.Num(), OutFrame.GetData());
+#else
+	return false;
+#endif
+}
+
+bool FMCPLocalPipeTransport::WriteFrame(const TArray<uint8>& Frame)
+{
+#if PLATFORM_WINDOWS
+	const uint32 FrameLength = static_cast<uint32>(Frame.Num());
+	if (!Pipe.WriteBytes(sizeof(FrameLength), &FrameLength))
+	{
+		return false;
+	}
+	return Pipe.WriteBytes(Frame.Num(), Frame.GetData());
+#else
+	return false;
+#endif
+}
+
+void FMCPLocalPipeTransport::ProcessFrame(const TArray<uint8>& Frame, TArray<uint8>& OutResponse)
+{
+	// Serialize an error envelope without touching the game thread
+	auto MakeError = [&OutResponse](const FString& Message)
+	{
+		TSharedRef<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+		ErrorJson->SetBoolField(TEXT("success"), false);
+		ErrorJson->SetStringField(TEXT("error"), Message);
+		FJsonUtils::StringifyUtf8(ErrorJson, OutResponse);
+	};
+
+	TSharedPtr<FJsonObject> RequestJson = FJsonUtils::ParseUtf8(MakeArrayView(Frame));
+	if (!RequestJson.IsValid())
+	{
+		MakeError(TEXT("Invalid JSON frame"));
+		return;
+	}
+
+	FString ToolName;
+	if (!RequestJson->TryGetStringField(TEXT("tool"), ToolName) || ToolName.IsEmpty())
+	{
+		MakeError(TEXT("Missing 'tool' field"));
+		return;
+	}
+
+	TSharedPtr<FJsonObject> ParamsJson;
+	const TSharedPtr<FJsonObject>* ParamsPtr = nullptr;
+	if (RequestJson->TryGetObjectField(TEXT("params"), ParamsPtr))
+	{
+		ParamsJson = *ParamsPtr;
+	}
+	else
+	{
+		ParamsJson = MakeShared<FJsonObject>();
+	}
+
+	TSharedPtr<FMCPToolRegistry> Registry = ToolRegistry;
+	if (!Registry.IsValid())
+	{
+		MakeError(TEXT("Tool registry not initialized"));
+		return;
+	}
+
+	// Same admission window as the HTTP path; a shed request gets the same
+	// retry semantics a 429 would carry
+	int32 Pending = 0, Running = 0, Completed = 0;
+	if (Registry->GetTaskQueue().IsValid())
+	{
+		Registry->GetTaskQueue()->GetStats(Pending, Running, Completed);
+	}
+	if (!FMCPAdmissionController::Get().TryAdmit(Pending))
+	{
+		MakeError(TEXT("Server is at capacity - retry shortly"));
+		return;
+	}
+	ON_SCOPE_EXIT { FMCPAdmissionController::Get().Release(); };
+
+	// Execute on the game thread - where every tool expects to run - while
+	// this thread blocks; the pipe is serial per client anyway. State is
+	// shared with the task so an abandoned wait (editor shutting down)
+	// leaves nothing dangling on this thread's stack
+	struct FPipeExecState
+	{
+		TArray<uint8> Response;
+		FEventRef Done{ EEventMode::ManualReset };
+	};
+	TSharedRef<FPipeExecState> State = MakeShared<FPipeExecState>();
+
+	const int32 RequestBytes = Frame.Num();
+	AsyncTask(ENamedThreads::GameThread,
+		[Registry, ToolName, ParamsJson, RequestBytes, State]()
+	{
+		FMCPToolResult Result = Registry->ExecuteTool(ToolName, ParamsJson.ToSharedRef());
+
+		if (Result.HasBinaryPayload())
+		{
+			// Binary payloads (screenshots) keep their raw-bytes HTTP path;
+			// the pipe carries JSON frames only
+			TSharedRef<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+			ErrorJson->SetBoolField(TEXT("success"), false);
+			ErrorJson->SetStringField(TEXT("error"),
+				FString::Printf(TEXT("Tool '%s' returns binary data; use the HTTP transport"), *ToolName));
+			FJsonUtils::StringifyUtf8(ErrorJson, State->Response);
+		}
+		else if (Result.HasPrebuiltBody())
+		{
+			// Already the serialized envelope; one copy onto the wire buffer
+			State->Response = *Result.PrebuiltBody;
+		}
+		else
+		{
+			TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+			ResponseJson->SetBoolField(TEXT("success"), Result.bSuccess);
+			ResponseJson->SetStringField(TEXT("message"), Result.Message);
+			if (Result.Data.IsValid())
+			{
+				ResponseJson->SetObjectField(TEXT("data"), Result.Data);
+			}
+			FJsonUtils::StringifyUtf8(ResponseJson, State->Response);
+		}
+
+		FMCPToolMetrics::Get().RecordTransfer(ToolName, RequestBytes, State->Response.Num());
+		State->Done->Trigger();
+	});
+
+	// Bounded waits so a shutdown racing an in-flight frame (the game
+	// thread joins this thread and cannot run the task) does not deadlock
+	while (!State->Done->Wait(100))
+	{
+		if (bStopping)
+		{
+			MakeError(TEXT("Server shutting down"));
+			return;
+		}
+	}
+	OutResponse = MoveTemp(State->Response);
+}
@@ -0,0 +1,83 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/PlatformNamedPipe.h"
+
+class FMCPToolRegistry;
+class FRunnableThread;
+
+/**
+ * Local named-pipe transport for tool execution
+ *
+ * Everything rides localhost TCP through the HTTP server, which means the
+ * full TCP stack plus whatever endpoint software inspects localhost HTTP
+ * sits between an agent on the same machine and the registry. The pipe
+ * transport carries the same execute-tool traffic over a kernel pipe:
+ * no TCP setup, no HTTP framing, nothing for interception layers to hook.
+ *
+ * Framing is a 4-byte little-endian length prefix followed by that many
+ * bytes of UTF-8 JSON. Requests are {"tool": "<name>", "params": {...}};
+ * responses mirror the HTTP envelope ({"success", "message", "data"}).
+ * Binary and streaming tool payloads stay on HTTP - the pipe answers
+ * those with an error directing the client there.
+ *
+ * Windows only: the engine implements FPlatformNamedPipe solely for
+ * Windows, and its socket abstraction binds no Unix domain sockets, so
+ * other platforms keep the TCP path. One client at a time - the single
+ * local agent this plugin serves - with reconnects accepted in a loop.
+ * Disabled by default; opt in via the plugin settings (Server category).
+ */
+class FMCPLocalPipeTransport : public FRunnable
+{
+public:
+	explicit FMCPLocalPipeTransport(TSharedPtr<FMCPToolRegistry> InToolRegistry);
+	virtual ~FMCPLocalPipeTransport() override;
+
+	/**
+	 * Create the pipe and start the listener thread. The port is folded
+	 * into the pipe name so side-by-side editors get distinct endpoints.
+	 * Returns false on non-Windows platforms or when the pipe cannot be
+	 * created (name already claimed by another instance).
+	 */
+	bool Start(uint32 ServerPort);
+
+	/** Destroy the pipe and join the listener thread */
+	void Shutdown();
+
+	//~ Begin FRunnable interface
+	virtual uint32 Run() override;
+	// Called by FRunnableThread::Kill(); only flags the loop - the blocking
+	// pipe calls are released by Shutdown()'s wake connection
+	virtual void Stop() override { bStopping = true; }
+	//~ End FRunnable interface
+
+private:
+	/** Read one length-prefixed frame; false on disconnect or oversize */
+	bool ReadFrame(TArray<uint8>& OutFrame);
+
+	/** Write one length-prefixed frame */
+	bool WriteFrame(const TArray<uint8>& Frame);
+
+	/**
+	 * Parse a request frame, execute the tool on the game thread (the pipe
+	 * thread blocks on completion) and serialize the response envelope.
+	 */
+	void ProcessFrame(const TArray<uint8>& Frame, TArray<uint8>& OutResponse);
+
+	TSharedPtr<FMCPToolRegistry> ToolRegistry;
+
+#if PLATFORM_WINDOWS
+	FPlatformNamedPipe Pipe;
+#endif
+
+	/** Full pipe path, kept for reconnect re-creation */
+	FString PipeName;
+
+	FRunnableThread* ListenerThread = nullptr;
+
+	/** Set by Stop(); the blocking pipe calls fail once the pipe is destroyed */
+	TAtomic<bool> bStopping{ false };
+};
@@ -0,0 +1,80 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPLogRingBuffer.h"
+#include "UnrealClaudeConstants.h"
+#include "Misc/OutputDeviceHelper.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+FMCPLogRingBuffer::FMCPLogRingBuffer()
+{
+	Buffer.SetNum(UnrealClaudeConstants::MCPServer::LogRingBufferCapacity);
+}
+
+FMCPLogRingBuffer::~FMCPLogRingBuffer()
+{
+	Unregister();
+}
+
+FMCPLogRingBuffer& FMCPLogRingBuffer::Get()
+{
+	static FMCPLogRingBuffer Instance;
+	return Instance;
+}
+
+void FMCPLogRingBuffer::Register()
+{
+	if (!bRegistered && GLog)
+	{
+		GLog->AddOutputDevice(this);
+		bRegistered = true;
+	}
+}
+
+void FMCPLogRingBuffer::Unregister()
+{
+	if (bRegistered && GLog)
+	{
+		GLog->RemoveOutputDevice(this);
+		bRegistered = false;
+	}
+}
+
+void FMCPLogRingBuffer::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	// Match the log file's line format so cursor reads and file reads agree
+	FString Formatted = FOutputDeviceHelper::FormatLogLine(Verbosity, Category, V, GPrintLogTimes);
+
+	FScopeLock Lock(&BufferLock);
+	FLogLine& Slot = Buffer[Head];
+	Slot.Sequence = NextSequence++;
+	Slot.Line = MoveTemp(Formatted);
+	Slot.Category = Category;
+	Slot.Verbosity = Verbosity;
+
+	Head = (Head + 1) % Buffer.Num();
+	Count = FMath::Min(Count + 1, Buffer.Num());
+}
+
+uint64 FMCPLogRingBuffer::GetLinesSince(uint64 FromSequence, TArray<FLogLine>& OutLines) const
+{
+	return GetLinesSince(FromSequence, FLogFilter(), OutLines);
+}
+
+uint64 FMCPLogRingBuffer::GetLinesSince(uint64 FromSequence, const FLogFilter& Filter, TArray<FLogLine>& OutLines) const
+{
+	FScopeLock Lock(&BufferLock);
+
+	const int32 Capacity = Buffer.Num();
+	const int32 OldestIndex = (Head - Count + Capacity) % Capacity;
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FLogLine& Entry = Buffer[(OldestIndex + i) % Capacity];
+		if (Entry.Sequence >= FromSequence && Filter.Passes(Entry))
+		{
+			OutLines.Add(Entry);
+		}
+	}
+
+	return NextSequence;
+}
@@ -0,0 +1,122 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/OutputDevice.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Fixed-size ring buffer of recent log output with sequence numbers
+ *
+ * Registered on GLog at module startup. The get_output_log tool serves
+ * cursor-based polls from this buffer, so each poll copies only the lines
+ * appended since the caller's cursor instead of re-reading and re-filtering
+ * the whole log file. Entries carry monotonically increasing sequence
+ * numbers; when a cursor falls behind the retention window the read simply
+ * resumes at the oldest retained line.
+ *
+ * Serialize may be called from any thread; the buffer is guarded by a
+ * single critical section and each append is a format plus a slot write.
+ */
+class FMCPLogRingBuffer : public FOutputDevice
+{
+public:
+	/** One captured log line */
+	struct FLogLine
+	{
+		/** Monotonic sequence number (cursor space) */
+		uint64 Sequence = 0;
+
+		/** Formatted line (timestamp, category, verbosity, message) */
+		FString Line;
+
+		/** Log category, kept structured so filters avoid string parsing */
+		FName Category;
+
+		/** Verbosity the line was emitted at */
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	};
+
+	/**
+	 * Structured filter applied while scanning the ring
+	 *
+	 * Compiled once per get_output_log request from the tool's parameters;
+	 * non-matching lines are skipped under the lock before any copy, so a
+	 * "new errors since cursor X?" poll copies a handful of lines out of a
+	 * burst of thousands. Both tests are trivially cheap (FName compare,
+	 * integer compare) - anything costlier, like the tool's message regex,
+	 * runs after the copy so the lock never waits on it.
+	 */
+	struct FLogFilter
+	{
+		/** Categories to keep; empty keeps every category */
+		TSet<FName> Categories;
+
+		/** Least severe verbosity to keep (Error keeps Fatal and Error);
+		 *  All keeps everything */
+		ELogVerbosity::Type MinVerbosity = ELogVerbosity::All;
+
+		bool Passes(const FLogLine& Entry) const
+		{
+			if (MinVerbosity != ELogVerbosity::All && Entry.Verbosity > MinVerbosity)
+			{
+				return false;
+			}
+			return Categories.Num() == 0 || Categories.Contains(Entry.Category);
+		}
+	};
+
+	/** Singleton accessor */
+	static FMCPLogRingBuffer& Get();
+
+	/** Attach to GLog (idempotent) */
+	void Register();
+
+	/** Detach from GLog (safe to call when not registered) */
+	void Unregister();
+
+	/**
+	 * Copy all retained lines with Sequence >= FromSequence
+	 * @param FromSequence - Cursor from the previous poll (0 for everything retained)
+	 * @param OutLines - Receives the new lines, oldest first
+	 * @return The cursor to pass on the next poll (one past the newest line)
+	 */
+	uint64 GetLinesSince(uint64 FromSequence, TArray<FLogLine>& OutLines) const;
+
+	/**
+	 * Copy retained lines with Sequence >= FromSequence that pass the filter
+	 * @param FromSequence - Cursor from the previous poll (0 for everything retained)
+	 * @param Filter - Structured filter evaluated before each copy
+	 * @param OutLines - Receives the matching lines, oldest first
+	 * @return The cursor to pass on the next poll (one past the newest line)
+	 */
+	uint64 GetLinesSince(uint64 FromSequence, const FLogFilter& Filter, TArray<FLogLine>& OutLines) const;
+
+	// FOutputDevice interface
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+private:
+	FMCPLogRingBuffer();
+	virtual ~FMCPLogRingBuffer() override;
+
+	/** Guards the ring storage and counters */
+	mutable FCriticalSection BufferLock;
+
+	/** Ring storage (fixed capacity, slots reused in place) */
+	TArray<FLogLine> Buffer;
+
+	/** Next write slot */
+	int32 Head = 0;
+
+	/** Number of valid entries (saturates at capacity) */
+	int32 Count = 0;
+
+	/** Sequence number assigned to the next line */
+	uint64 NextSequence = 0;
+
+	/** Whether we are currently attached to GLog */
+	bool bRegistered = false;
+};
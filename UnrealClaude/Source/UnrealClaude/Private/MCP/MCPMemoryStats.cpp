@@ -0,0 +1,48 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPMemoryStats.h"
+#include "Misc/ScopeLock.h"
+
+FMCPMemoryStats& FMCPMemoryStats::Get()
+{
+	static FMCPMemoryStats Instance;
+	return Instance;
+}
+
+void FMCPMemoryStats::RegisterProvider(FName Owner, TFunction<uint64()> Provider)
+{
+	FScopeLock Lock(&ProvidersLock);
+	Providers.Add(Owner, MoveTemp(Provider));
+}
+
+void FMCPMemoryStats::UnregisterProvider(FName Owner)
+{
+	FScopeLock Lock(&ProvidersLock);
+	Providers.Remove(Owner);
+}
+
+TSharedPtr<FJsonObject> FMCPMemoryStats::ToJson() const
+{
+	// Snapshot the providers, then invoke outside the lock - a provider may
+	// take its owner's lock and must not nest inside ours
+	TArray<TPair<FName, TFunction<uint64()>>> Snapshot;
+	{
+		FScopeLock Lock(&ProvidersLock);
+		Snapshot.Reserve(Providers.Num());
+		for (const auto& Pair : Providers)
+		{
+			Snapshot.Emplace(Pair.Key, Pair.Value);
+		}
+	}
+
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	uint64 TotalBytes = 0;
+	for (const auto& Pair : Snapshot)
+	{
+		const uint64 Bytes = Pair.Value();
+		TotalBytes += Bytes;
+		Json->SetNumberField(Pair.Key.ToString(), static_cast<double>(Bytes));
+	}
+	Json->SetNumberField(TEXT("total_bytes"), static_cast<double>(TotalBytes));
+	return Json;
+}
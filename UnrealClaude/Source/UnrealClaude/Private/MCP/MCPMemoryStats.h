@@ -0,0 +1,48 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Registry of per-owner retained-memory gauges for the plugin.
+ *
+ * The plugin retains memory in a handful of long-lived owners - task
+ * history, session transcripts, the cached project context - and until
+ * now confirming a suspicion about any of them meant a full heap dump.
+ * Each owner registers a provider that reports its current estimated
+ * bytes; /mcp/status polls the providers and publishes the numbers, so
+ * retention settings (FMCPTaskQueueConfig, history budgets) can be tuned
+ * against data instead of guesses.
+ *
+ * Providers are invoked from the status handler on the game thread, the
+ * same thread the owners live on; an owner whose estimate needs a lock
+ * takes its own. Estimates are deliberately rough (allocated sizes of
+ * the dominant buffers) - the point is trend and magnitude, not byte
+ * precision. The LLM tag scopes on the same owners cover the precise
+ * case when the editor runs with -llm.
+ */
+class FMCPMemoryStats
+{
+public:
+	static FMCPMemoryStats& Get();
+
+	/** Register (or replace) the gauge provider for one owner */
+	void RegisterProvider(FName Owner, TFunction<uint64()> Provider);
+
+	/** Remove an owner's provider (call before the owner dies) */
+	void UnregisterProvider(FName Owner);
+
+	/** Poll every provider and build the per-owner byte report */
+	TSharedPtr<FJsonObject> ToJson() const;
+
+private:
+	FMCPMemoryStats() = default;
+
+	/** Guards the provider map (owners register from init/shutdown paths) */
+	mutable FCriticalSection ProvidersLock;
+
+	/** Gauge provider per owner name */
+	TMap<FName, TFunction<uint64()>> Providers;
+};
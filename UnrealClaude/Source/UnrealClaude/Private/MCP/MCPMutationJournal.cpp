@@ -0,0 +1,195 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPMutationJournal.h"
+#include "JsonUtils.h"
+#include "UnrealClaudeModule.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/FileManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+FMCPMutationJournal& FMCPMutationJournal::Get()
+{
+	static FMCPMutationJournal Instance;
+	return Instance;
+}
+
+FString FMCPMutationJournal::GetJournalPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("mutation_journal.jsonl"));
+}
+
+uint64 FMCPMutationJournal::LogInvocation(const FString& ToolName, const TSharedRef<FJsonObject>& Params)
+{
+	FScopeLock Lock(&JournalLock);
+
+	// Open (and seed the sequence) before drawing this entry's number
+	EnsureOpenLocked();
+	const uint64 Sequence = NextSequence++;
+
+	TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+	Entry->SetNumberField(TEXT("seq"), static_cast<double>(Sequence));
+	Entry->SetStringField(TEXT("type"), TEXT("begin"));
+	Entry->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+	Entry->SetStringField(TEXT("tool"), ToolName);
+	Entry->SetObjectField(TEXT("params"), Params);
+	AppendEntry(Entry);
+
+	return Sequence;
+}
+
+void FMCPMutationJournal::LogCompletion(uint64 Sequence, bool bSuccess)
+{
+	FScopeLock Lock(&JournalLock);
+
+	EnsureOpenLocked();
+
+	TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+	Entry->SetNumberField(TEXT("seq"), static_cast<double>(Sequence));
+	Entry->SetStringField(TEXT("type"), TEXT("end"));
+	Entry->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+	Entry->SetBoolField(TEXT("success"), bSuccess);
+	AppendEntry(Entry);
+}
+
+void FMCPMutationJournal::EnsureOpenLocked()
+{
+	// Caller holds JournalLock
+	if (Writer.IsValid())
+	{
+		return;
+	}
+
+	const FString Path = GetJournalPath();
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), /*Tree*/ true);
+
+	// Seed the sequence past any prior session so recovery tooling sees one
+	// monotonic stream across restarts
+	TArray<FString> Lines;
+	if (FFileHelper::LoadFileToStringArray(Lines, *Path))
+	{
+		for (int32 i = Lines.Num() - 1; i >= 0; i--)
+		{
+			if (Lines[i].IsEmpty())
+			{
+				continue;
+			}
+			TSharedPtr<FJsonObject> LastEntry;
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Lines[i]);
+			double LastSeq = 0.0;
+			if (FJsonSerializer::Deserialize(Reader, LastEntry) && LastEntry.IsValid() &&
+				LastEntry->TryGetNumberField(TEXT("seq"), LastSeq))
+			{
+				NextSequence = static_cast<uint64>(LastSeq) + 1;
+			}
+			break;
+		}
+	}
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to open mutation journal at %s"), *Path);
+		return;
+	}
+
+	if (!bSessionMarkerWritten)
+	{
+		bSessionMarkerWritten = true;
+		TSharedRef<FJsonObject> Marker = MakeShared<FJsonObject>();
+		Marker->SetStringField(TEXT("type"), TEXT("session"));
+		Marker->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+		TArray<uint8> MarkerBytes;
+		FJsonUtils::StringifyUtf8(Marker, MarkerBytes);
+		MarkerBytes.Add('\n');
+		Writer->Serialize(MarkerBytes.GetData(), MarkerBytes.Num());
+	}
+}
+
+void FMCPMutationJournal::AppendEntry(const TSharedRef<FJsonObject>& Entry)
+{
+	// Caller holds JournalLock and has called EnsureOpenLocked
+	if (!Writer.IsValid())
+	{
+		return;
+	}
+
+	TArray<uint8> Bytes;
+	FJsonUtils::StringifyUtf8(Entry, Bytes);
+	Bytes.Add('\n');
+	Writer->Serialize(Bytes.GetData(), Bytes.Num());
+
+	// Durability is the point of the journal; mutating tools cost orders of
+	// magnitude more than this flush
+	Writer->Flush();
+}
+
+TArray<TSharedPtr<FJsonValue>> FMCPMutationJournal::ReadTail(int32 MaxEntries)
+{
+	FScopeLock Lock(&JournalLock);
+
+	if (Writer.IsValid())
+	{
+		Writer->Flush();
+	}
+
+	TArray<FString> Lines;
+	FFileHelper::LoadFileToStringArray(Lines, *GetJournalPath());
+
+	// Pair begin entries with their completion markers; a begin without an
+	// end is exactly what a crash leaves behind
+	TArray<TSharedPtr<FJsonObject>> Invocations;
+	TMap<uint64, int32> SequenceToIndex;
+	for (const FString& Line : Lines)
+	{
+		if (Line.IsEmpty())
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> Parsed;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+		if (!FJsonSerializer::Deserialize(Reader, Parsed) || !Parsed.IsValid())
+		{
+			continue;
+		}
+
+		FString Type;
+		Parsed->TryGetStringField(TEXT("type"), Type);
+		double Seq = 0.0;
+		Parsed->TryGetNumberField(TEXT("seq"), Seq);
+
+		if (Type == TEXT("begin"))
+		{
+			Parsed->SetBoolField(TEXT("completed"), false);
+			SequenceToIndex.Add(static_cast<uint64>(Seq), Invocations.Add(Parsed));
+		}
+		else if (Type == TEXT("end"))
+		{
+			if (const int32* Index = SequenceToIndex.Find(static_cast<uint64>(Seq)))
+			{
+				bool bSuccess = false;
+				Parsed->TryGetBoolField(TEXT("success"), bSuccess);
+				Invocations[*Index]->SetBoolField(TEXT("completed"), true);
+				Invocations[*Index]->SetBoolField(TEXT("success"), bSuccess);
+			}
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Tail;
+	const int32 First = FMath::Max(0, Invocations.Num() - MaxEntries);
+	Tail.Reserve(Invocations.Num() - First);
+	for (int32 i = First; i < Invocations.Num(); i++)
+	{
+		Tail.Add(MakeShared<FJsonValueObject>(Invocations[i]));
+	}
+	return Tail;
+}
+
+void FMCPMutationJournal::Close()
+{
+	FScopeLock Lock(&JournalLock);
+	Writer.Reset();
+}
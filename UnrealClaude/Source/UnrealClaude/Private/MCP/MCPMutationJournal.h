@@ -0,0 +1,78 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Write-ahead log of mutating MCP tool invocations.
+ *
+ * When the editor crashes mid-session (a Live Coding reload during agent
+ * work is the recurring cause), there is no record of which mutations
+ * were applied, and re-running the whole plan duplicates actors and
+ * edits. Every non-read-only invocation is appended here before it
+ * executes - tool name, params and a sequence number - and a completion
+ * marker with the outcome is appended after. The file survives the
+ * crash, so recovery reads the tail, finds the last completed entry and
+ * resumes from there instead of starting over.
+ *
+ * Format is one JSON object per line in Saved/UnrealClaude/
+ * mutation_journal.jsonl, flushed per entry (durability is the point;
+ * mutating tools are orders of magnitude slower than the flush). The
+ * writer stays open across calls and all access is lock-protected, so
+ * logging is safe from whichever thread ExecuteTool runs on.
+ */
+class FMCPMutationJournal
+{
+public:
+	static FMCPMutationJournal& Get();
+
+	/**
+	 * Append the begin entry for a mutating invocation, before it runs.
+	 * @param ToolName - Tool about to execute
+	 * @param Params - Invocation parameters (serialized into the entry)
+	 * @return Sequence number to pass to LogCompletion
+	 */
+	uint64 LogInvocation(const FString& ToolName, const TSharedRef<FJsonObject>& Params);
+
+	/** Append the completion marker for a previously logged invocation */
+	void LogCompletion(uint64 Sequence, bool bSuccess);
+
+	/**
+	 * Read the most recent entries, newest last. Begin entries whose
+	 * completion marker never arrived are flagged completed=false - those
+	 * are the invocations a crash may have half-applied.
+	 * @param MaxEntries - Upper bound on invocations returned
+	 * @return Array of invocation objects for the query tool
+	 */
+	TArray<TSharedPtr<FJsonValue>> ReadTail(int32 MaxEntries);
+
+	/** Close the writer (module shutdown) */
+	void Close();
+
+private:
+	FMCPMutationJournal() = default;
+
+	/** Open the writer, seed the sequence from the existing file and write
+	 *  the session marker. Caller holds JournalLock. */
+	void EnsureOpenLocked();
+
+	/** Serialize one entry and append it, flushing to disk */
+	void AppendEntry(const TSharedRef<FJsonObject>& Entry);
+
+	/** Full path of the journal file */
+	static FString GetJournalPath();
+
+	/** Guards the writer and sequence counter */
+	FCriticalSection JournalLock;
+
+	/** Append-mode writer, opened on first use and kept open */
+	TUniquePtr<FArchive> Writer;
+
+	/** Next sequence number; seeded past prior sessions on first open */
+	uint64 NextSequence = 1;
+
+	/** Whether the session-start marker has been written */
+	bool bSessionMarkerWritten = false;
+};
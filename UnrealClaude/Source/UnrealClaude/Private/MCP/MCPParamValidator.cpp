@@ -2,6 +2,7 @@
 
 #include "MCPParamValidator.h"
 #include "UnrealClaudeConstants.h"
+#include "String/Find.h"
 
 // Use constants from centralized header
 using namespace UnrealClaudeConstants::MCPValidation;
@@ -52,7 +53,7 @@ const TArray<FString>& FMCPParamValidator::GetBlockedConsoleCommands()
 	return BlockedCommands;
 }
 
-bool FMCPParamValidator::ValidateActorName(const FString& Name, FString& OutError)
+bool FMCPParamValidator::ValidateActorName(FStringView Name, FString& OutError)
 {
 	if (Name.IsEmpty())
 	{
@@ -67,10 +68,9 @@ bool FMCPParamValidator::ValidateActorName(const FString& Name, FString& OutErro
 	}
 
 	// Check for dangerous characters (optimized: avoid FString allocation in loop)
-	int32 FoundIndex;
 	for (const TCHAR* c = DangerousChars; *c; ++c)
 	{
-		if (Name.FindChar(*c, FoundIndex))
+		if (UE::String::FindFirstChar(Name, *c) != INDEX_NONE)
 		{
 			OutError = FString::Printf(TEXT("Actor name contains invalid character: '%c'"), *c);
 			return false;
@@ -90,7 +90,7 @@ bool FMCPParamValidator::ValidateActorName(const FString& Name, FString& OutErro
 	return true;
 }
 
-bool FMCPParamValidator::ValidatePropertyPath(const FString& PropertyPath, FString& OutError)
+bool FMCPParamValidator::ValidatePropertyPath(FStringView PropertyPath, FString& OutError)
 {
 	if (PropertyPath.IsEmpty())
 	{
@@ -115,14 +115,14 @@ bool FMCPParamValidator::ValidatePropertyPath(const FString& PropertyPath, FStri
 	}
 
 	// Check for double dots which could indicate path traversal attempts
-	if (PropertyPath.Contains(TEXT("..")))
+	if (UE::String::FindFirst(PropertyPath, TEXTVIEW("..")) != INDEX_NONE)
 	{
 		OutError = TEXT("Property path cannot contain consecutive dots");
 		return false;
 	}
 
 	// Should not start or end with a dot
-	if (PropertyPath.StartsWith(TEXT(".")) || PropertyPath.EndsWith(TEXT(".")))
+	if (PropertyPath.StartsWith(TEXT('.')) || PropertyPath.EndsWith(TEXT('.')))
 	{
 		OutError = TEXT("Property path cannot start or end with a dot");
 		return false;
@@ -131,7 +131,7 @@ bool FMCPParamValidator::ValidatePropertyPath(const FString& PropertyPath, FStri
 	return true;
 }
 
-bool FMCPParamValidator::ValidateClassPath(const FString& ClassPath, FString& OutError)
+bool FMCPParamValidator::ValidateClassPath(FStringView ClassPath, FString& OutError)
 {
 	if (ClassPath.IsEmpty())
 	{
@@ -147,10 +147,9 @@ bool FMCPParamValidator::ValidateClassPath(const FString& ClassPath, FString& Ou
 
 	// Check for dangerous characters (excluding / and . which are valid in paths)
 	// Optimized: avoid FString allocation in loop
-	int32 FoundIndex;
 	for (const TCHAR* c = DangerousChars; *c; ++c)
 	{
-		if (ClassPath.FindChar(*c, FoundIndex))
+		if (UE::String::FindFirstChar(ClassPath, *c) != INDEX_NONE)
 		{
 			OutError = FString::Printf(TEXT("Class path contains invalid character: '%c'"), *c);
 			return false;
@@ -158,7 +157,7 @@ bool FMCPParamValidator::ValidateClassPath(const FString& ClassPath, FString& Ou
 	}
 
 	// Check for path traversal
-	if (ClassPath.Contains(TEXT("..")))
+	if (UE::String::FindFirst(ClassPath, TEXTVIEW("..")) != INDEX_NONE)
 	{
 		OutError = TEXT("Class path cannot contain path traversal sequences");
 		return false;
@@ -167,7 +166,7 @@ bool FMCPParamValidator::ValidateClassPath(const FString& ClassPath, FString& Ou
 	return true;
 }
 
-bool FMCPParamValidator::ValidateConsoleCommand(const FString& Command, FString& OutError)
+bool FMCPParamValidator::ValidateConsoleCommand(FStringView Command, FString& OutError)
 {
 	if (Command.IsEmpty())
 	{
@@ -181,12 +180,13 @@ bool FMCPParamValidator::ValidateConsoleCommand(const FString& Command, FString&
 		return false;
 	}
 
-	// Check against blocklist
-	FString CommandLower = Command.ToLower().TrimStartAndEnd();
+	// Check against blocklist. Case-insensitive prefix compare against the
+	// (lowercase) blocklist - no lowered copies of either side per call
+	const FStringView Trimmed = Command.TrimStartAndEnd();
 
 	for (const FString& Blocked : GetBlockedConsoleCommands())
 	{
-		if (CommandLower.StartsWith(Blocked.ToLower()))
+		if (Trimmed.StartsWith(Blocked, ESearchCase::IgnoreCase))
 		{
 			OutError = FString::Printf(TEXT("Command '%s' is blocked for safety"), *Blocked);
 			return false;
@@ -194,14 +194,18 @@ bool FMCPParamValidator::ValidateConsoleCommand(const FString& Command, FString&
 	}
 
 	// Check for command chaining attempts
-	if (Command.Contains(TEXT(";")) || Command.Contains(TEXT("|")) || Command.Contains(TEXT("&&")))
+	if (UE::String::FindFirstChar(Command, TEXT(';')) != INDEX_NONE ||
+		UE::String::FindFirstChar(Command, TEXT('|')) != INDEX_NONE ||
+		UE::String::FindFirst(Command, TEXTVIEW("&&")) != INDEX_NONE)
 	{
 		OutError = TEXT("Command chaining is not allowed");
 		return false;
 	}
 
 	// Check for shell escape attempts
-	if (Command.Contains(TEXT("`")) || Command.Contains(TEXT("$(")) || Command.Contains(TEXT("${")))
+	if (UE::String::FindFirstChar(Command, TEXT('`')) != INDEX_NONE ||
+		UE::String::FindFirst(Command, TEXTVIEW("$(")) != INDEX_NONE ||
+		UE::String::FindFirst(Command, TEXTVIEW("${")) != INDEX_NONE)
 	{
 		OutError = TEXT("Shell escape sequences are not allowed");
 		return false;
@@ -210,43 +214,43 @@ bool FMCPParamValidator::ValidateConsoleCommand(const FString& Command, FString&
 	return true;
 }
 
-bool FMCPParamValidator::ValidateNumericValue(double Value, const FString& FieldName, FString& OutError, double MaxAbsValue)
+bool FMCPParamValidator::ValidateNumericValue(double Value, FStringView FieldName, FString& OutError, double MaxAbsValue)
 {
 	// Check for NaN
 	if (FMath::IsNaN(Value))
 	{
-		OutError = FString::Printf(TEXT("%s: NaN is not a valid value"), *FieldName);
+		OutError = FString::Printf(TEXT("%.*s: NaN is not a valid value"), FieldName.Len(), FieldName.GetData());
 		return false;
 	}
 
 	// Check for infinity
 	if (!FMath::IsFinite(Value))
 	{
-		OutError = FString::Printf(TEXT("%s: Infinite values are not allowed"), *FieldName);
+		OutError = FString::Printf(TEXT("%.*s: Infinite values are not allowed"), FieldName.Len(), FieldName.GetData());
 		return false;
 	}
 
 	// Check bounds
 	if (FMath::Abs(Value) > MaxAbsValue)
 	{
-		OutError = FString::Printf(TEXT("%s: Value %f exceeds maximum allowed magnitude of %f"), *FieldName, Value, MaxAbsValue);
+		OutError = FString::Printf(TEXT("%.*s: Value %f exceeds maximum allowed magnitude of %f"), FieldName.Len(), FieldName.GetData(), Value, MaxAbsValue);
 		return false;
 	}
 
 	return true;
 }
 
-bool FMCPParamValidator::ValidateStringLength(const FString& Value, const FString& FieldName, int32 MaxLength, FString& OutError)
+bool FMCPParamValidator::ValidateStringLength(FStringView Value, FStringView FieldName, int32 MaxLength, FString& OutError)
 {
 	if (Value.Len() > MaxLength)
 	{
-		OutError = FString::Printf(TEXT("%s: String length %d exceeds maximum of %d"), *FieldName, Value.Len(), MaxLength);
+		OutError = FString::Printf(TEXT("%.*s: String length %d exceeds maximum of %d"), FieldName.Len(), FieldName.GetData(), Value.Len(), MaxLength);
 		return false;
 	}
 	return true;
 }
 
-FString FMCPParamValidator::SanitizeString(const FString& Input)
+FString FMCPParamValidator::SanitizeString(FStringView Input)
 {
 	// Build result without dangerous characters in single pass (optimized)
 	FString Output;
@@ -275,7 +279,7 @@ FString FMCPParamValidator::SanitizeString(const FString& Input)
 	return Output;
 }
 
-bool FMCPParamValidator::ValidateBlueprintPath(const FString& BlueprintPath, FString& OutError)
+bool FMCPParamValidator::ValidateBlueprintPath(FStringView BlueprintPath, FString& OutError)
 {
 	if (BlueprintPath.IsEmpty())
 	{
@@ -290,14 +294,15 @@ bool FMCPParamValidator::ValidateBlueprintPath(const FString& BlueprintPath, FSt
 	}
 
 	// Block engine Blueprints
-	if (BlueprintPath.StartsWith(TEXT("/Engine/")) || BlueprintPath.StartsWith(TEXT("/Script/")))
+	if (BlueprintPath.StartsWith(TEXTVIEW("/Engine/"), ESearchCase::IgnoreCase) ||
+		BlueprintPath.StartsWith(TEXTVIEW("/Script/"), ESearchCase::IgnoreCase))
 	{
 		OutError = TEXT("Cannot access engine or script Blueprints");
 		return false;
 	}
 
 	// Check for path traversal
-	if (BlueprintPath.Contains(TEXT("..")))
+	if (UE::String::FindFirst(BlueprintPath, TEXTVIEW("..")) != INDEX_NONE)
 	{
 		OutError = TEXT("Blueprint path cannot contain path traversal sequences");
 		return false;
@@ -305,10 +310,9 @@ bool FMCPParamValidator::ValidateBlueprintPath(const FString& BlueprintPath, FSt
 
 	// Check for dangerous characters
 	// Optimized: avoid FString allocation in loop
-	int32 FoundIndex;
 	for (const TCHAR* c = DangerousChars; *c; ++c)
 	{
-		if (BlueprintPath.FindChar(*c, FoundIndex))
+		if (UE::String::FindFirstChar(BlueprintPath, *c) != INDEX_NONE)
 		{
 			OutError = FString::Printf(TEXT("Blueprint path contains invalid character: '%c'"), *c);
 			return false;
@@ -318,7 +322,7 @@ bool FMCPParamValidator::ValidateBlueprintPath(const FString& BlueprintPath, FSt
 	return true;
 }
 
-bool FMCPParamValidator::ValidateBlueprintVariableName(const FString& VariableName, FString& OutError)
+bool FMCPParamValidator::ValidateBlueprintVariableName(FStringView VariableName, FString& OutError)
 {
 	if (VariableName.IsEmpty())
 	{
@@ -352,7 +356,7 @@ bool FMCPParamValidator::ValidateBlueprintVariableName(const FString& VariableNa
 	return true;
 }
 
-bool FMCPParamValidator::ValidateBlueprintFunctionName(const FString& FunctionName, FString& OutError)
+bool FMCPParamValidator::ValidateBlueprintFunctionName(FStringView FunctionName, FString& OutError)
 {
 	// Same validation rules as variable names
 	if (FunctionName.IsEmpty())
@@ -3,10 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StringView.h"
 
 /**
  * Utility class for validating MCP tool parameters
  * Provides common validation functions to prevent injection attacks and invalid input
+ *
+ * Validators take FStringView so callers can pass slices of the parsed
+ * request document (or any owned string) without materializing a copy;
+ * none of them store the view past the call.
  */
 class UNREALCLAUDE_API FMCPParamValidator
 {
@@ -18,7 +23,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateActorName(const FString& Name, FString& OutError);
+	static bool ValidateActorName(FStringView Name, FString& OutError);
 
 	/**
 	 * Validate a property path (e.g., "Component.Property")
@@ -27,7 +32,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidatePropertyPath(const FString& PropertyPath, FString& OutError);
+	static bool ValidatePropertyPath(FStringView PropertyPath, FString& OutError);
 
 	/**
 	 * Validate a class path for loading UClass assets
@@ -35,7 +40,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateClassPath(const FString& ClassPath, FString& OutError);
+	static bool ValidateClassPath(FStringView ClassPath, FString& OutError);
 
 	/**
 	 * Validate a console command for safety
@@ -44,7 +49,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateConsoleCommand(const FString& Command, FString& OutError);
+	static bool ValidateConsoleCommand(FStringView Command, FString& OutError);
 
 	/**
 	 * Validate numeric value is within reasonable bounds
@@ -55,7 +60,7 @@ public:
 	 * @param MaxAbsValue Maximum absolute value allowed (default: 1e10)
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateNumericValue(double Value, const FString& FieldName, FString& OutError, double MaxAbsValue = 1e10);
+	static bool ValidateNumericValue(double Value, FStringView FieldName, FString& OutError, double MaxAbsValue = 1e10);
 
 	/**
 	 * Validate string length is within limits
@@ -65,14 +70,14 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateStringLength(const FString& Value, const FString& FieldName, int32 MaxLength, FString& OutError);
+	static bool ValidateStringLength(FStringView Value, FStringView FieldName, int32 MaxLength, FString& OutError);
 
 	/**
 	 * Sanitize a string by removing dangerous characters
 	 * @param Input The string to sanitize
 	 * @return Sanitized string
 	 */
-	static FString SanitizeString(const FString& Input);
+	static FString SanitizeString(FStringView Input);
 
 	/**
 	 * Validate a Blueprint asset path
@@ -81,7 +86,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateBlueprintPath(const FString& BlueprintPath, FString& OutError);
+	static bool ValidateBlueprintPath(FStringView BlueprintPath, FString& OutError);
 
 	/**
 	 * Validate a Blueprint variable name
@@ -90,7 +95,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateBlueprintVariableName(const FString& VariableName, FString& OutError);
+	static bool ValidateBlueprintVariableName(FStringView VariableName, FString& OutError);
 
 	/**
 	 * Validate a Blueprint function name
@@ -99,7 +104,7 @@ public:
 	 * @param OutError Error message if validation fails
 	 * @return true if valid, false otherwise
 	 */
-	static bool ValidateBlueprintFunctionName(const FString& FunctionName, FString& OutError);
+	static bool ValidateBlueprintFunctionName(FStringView FunctionName, FString& OutError);
 
 private:
 	/** Console commands that are blocked for safety */
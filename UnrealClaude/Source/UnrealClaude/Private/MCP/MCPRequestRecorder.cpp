@@ -0,0 +1,157 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPRequestRecorder.h"
+#include "UnrealClaudeModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** 'MCPR' - identifies a recording file */
+	constexpr uint32 RecordingMagic = 0x4D435052;
+
+	/** Bumped when the record layout changes */
+	constexpr uint32 RecordingVersion = 1;
+
+	/** Serialize one byte buffer with a length prefix */
+	void WriteBuffer(FArchive& Ar, TConstArrayView<uint8> Buffer)
+	{
+		int32 Num = Buffer.Num();
+		Ar << Num;
+		if (Num > 0)
+		{
+			Ar.Serialize(const_cast<uint8*>(Buffer.GetData()), Num);
+		}
+	}
+
+	bool ReadBuffer(FArchive& Ar, TArray<uint8>& OutBuffer)
+	{
+		int32 Num = 0;
+		Ar << Num;
+		if (Ar.IsError() || Num < 0)
+		{
+			return false;
+		}
+		OutBuffer.SetNumUninitialized(Num);
+		if (Num > 0)
+		{
+			Ar.Serialize(OutBuffer.GetData(), Num);
+		}
+		return !Ar.IsError();
+	}
+}
+
+FMCPRequestRecorder& FMCPRequestRecorder::Get()
+{
+	static FMCPRequestRecorder Instance;
+	return Instance;
+}
+
+FString FMCPRequestRecorder::GetRecordingsDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("UnrealClaude") / TEXT("Recordings");
+}
+
+bool FMCPRequestRecorder::StartRecording()
+{
+	if (IsRecording())
+	{
+		return true;
+	}
+
+	const FString Directory = GetRecordingsDirectory();
+	IFileManager::Get().MakeDirectory(*Directory, true);
+
+	ActivePath = Directory / FString::Printf(TEXT("traffic_%s.mcprec"),
+		*FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*ActivePath));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Could not create tool traffic recording at %s"), *ActivePath);
+		return false;
+	}
+
+	uint32 Magic = RecordingMagic;
+	uint32 Version = RecordingVersion;
+	*Writer << Magic;
+	*Writer << Version;
+
+	RecordingStartSeconds = FPlatformTime::Seconds();
+	RecordCount = 0;
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Recording tool traffic to %s"), *ActivePath);
+	return true;
+}
+
+void FMCPRequestRecorder::StopRecording()
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	Writer->Close();
+	Writer.Reset();
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Tool traffic recording closed: %d call(s) in %s"), RecordCount, *ActivePath);
+	ActivePath.Reset();
+}
+
+void FMCPRequestRecorder::Record(const FString& ToolName, TConstArrayView<uint8> RequestBody, TConstArrayView<uint8> ResponseBody)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	double TimeOffset = FPlatformTime::Seconds() - RecordingStartSeconds;
+	FString Name = ToolName;
+
+	*Writer << TimeOffset;
+	*Writer << Name;
+	WriteBuffer(*Writer, RequestBody);
+	WriteBuffer(*Writer, ResponseBody);
+
+	++RecordCount;
+}
+
+bool FMCPRequestRecorder::LoadRecording(const FString& FilePath, TArray<FMCPRecordedCall>& OutCalls)
+{
+	OutCalls.Reset();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Reader << Magic;
+	*Reader << Version;
+	if (Magic != RecordingMagic || Version != RecordingVersion)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Unrecognized recording header in %s"), *FilePath);
+		return false;
+	}
+
+	// Records run to end-of-file; a partial trailing record (editor killed
+	// mid-write) is dropped rather than failing the whole load
+	while (Reader->Tell() < Reader->TotalSize())
+	{
+		FMCPRecordedCall Call;
+		*Reader << Call.TimeOffsetSeconds;
+		*Reader << Call.ToolName;
+		if (Reader->IsError() ||
+			!ReadBuffer(*Reader, Call.RequestBody) ||
+			!ReadBuffer(*Reader, Call.ResponseBody))
+		{
+			break;
+		}
+		OutCalls.Add(MoveTemp(Call));
+	}
+
+	return true;
+}
@@ -0,0 +1,87 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FArchive;
+
+/** One captured tool invocation, as loaded back from a recording */
+struct FMCPRecordedCall
+{
+	/** Seconds since the recording started */
+	double TimeOffsetSeconds = 0.0;
+
+	FString ToolName;
+
+	/** UTF-8 JSON request body as it arrived on the wire */
+	TArray<uint8> RequestBody;
+
+	/** UTF-8 response body as it was sent (pre-compression) */
+	TArray<uint8> ResponseBody;
+};
+
+/**
+ * Request/response recorder for offline benchmarking.
+ *
+ * Performance reports from other machines cannot be reproduced without
+ * the project that generated them - but the traffic can. When recording
+ * is enabled (plugin settings, Server category), every tool invocation
+ * on the single-tool route is appended to a compact binary log:
+ * timestamp offset, tool name, request body, response body, all
+ * length-prefixed through a buffered file archive. The replay benchmark
+ * in Tests/ re-executes a recording against a registry and compares
+ * timings run-over-run, turning production traffic into a regression
+ * benchmark.
+ *
+ * Bodies are written as captured, so recordings of mutating sessions
+ * should only be replayed against a disposable copy of the project.
+ * Handlers run on the game thread; the recorder inherits that and keeps
+ * no locking of its own.
+ */
+class FMCPRequestRecorder
+{
+public:
+	static FMCPRequestRecorder& Get();
+
+	/**
+	 * Open a new timestamped recording under Saved/UnrealClaude/Recordings.
+	 * Returns false when the file cannot be created.
+	 */
+	bool StartRecording();
+
+	/** Flush and close the active recording, if any */
+	void StopRecording();
+
+	bool IsRecording() const { return Writer != nullptr; }
+
+	/**
+	 * Append one invocation. No-op (one branch) when not recording, so the
+	 * call can sit on the hot path unconditionally.
+	 */
+	void Record(const FString& ToolName, TConstArrayView<uint8> RequestBody, TConstArrayView<uint8> ResponseBody);
+
+	/**
+	 * Load a recording back into memory for replay.
+	 * Returns false on a missing file or unrecognized header.
+	 */
+	static bool LoadRecording(const FString& FilePath, TArray<FMCPRecordedCall>& OutCalls);
+
+	/** Directory recordings are written to (and replays look in) */
+	static FString GetRecordingsDirectory();
+
+private:
+	FMCPRequestRecorder() = default;
+
+	/** Buffered file writer for the active recording; null when idle */
+	TUniquePtr<FArchive> Writer;
+
+	/** Path of the active recording, kept for the close log line */
+	FString ActivePath;
+
+	/** FPlatformTime baseline the per-record offsets are taken against */
+	double RecordingStartSeconds = 0.0;
+
+	/** Records appended so far, reported when the recording closes */
+	int32 RecordCount = 0;
+};
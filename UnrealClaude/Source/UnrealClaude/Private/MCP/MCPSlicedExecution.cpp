@@ -0,0 +1,99 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPSlicedExecution.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+
+FMCPToolSlicer& FMCPToolSlicer::Get()
+{
+	static FMCPToolSlicer Instance;
+	return Instance;
+}
+
+void FMCPToolSlicer::Enqueue(
+	TSharedPtr<IMCPSlicedExecution> Slice,
+	TSharedPtr<FMCPAsyncTask> Task,
+	TFunction<void(const FMCPToolResult&)> OnComplete)
+{
+	check(IsInGameThread());
+
+	FActiveSlice Active;
+	Active.Slice = Slice;
+	Active.Task = Task;
+	Active.OnComplete = MoveTemp(OnComplete);
+	ActiveSlices.Add(MoveTemp(Active));
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FMCPToolSlicer::Tick));
+	}
+}
+
+bool FMCPToolSlicer::Tick(float DeltaTime)
+{
+	const double BudgetSeconds = UnrealClaudeConstants::MCPServer::GameThreadSliceBudgetMs / 1000.0;
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	while (ActiveSlices.Num() > 0)
+	{
+		FActiveSlice& Active = ActiveSlices[0];
+
+		// Cancellation and timeout are flagged on the task from other
+		// threads; honor them between steps, never mid-step
+		const bool bAborted = Active.Task.IsValid() &&
+			(Active.Task->bCancellationRequested ||
+			 Active.Task->Status.Load() != EMCPTaskStatus::Running);
+		if (bAborted)
+		{
+			Active.Slice->Cancel();
+			if (Active.OnComplete)
+			{
+				Active.OnComplete(FMCPToolResult::Error(TEXT("Sliced execution aborted")));
+			}
+			ActiveSlices.RemoveAt(0);
+			continue;
+		}
+
+		// Frame time spent stepping is charged to the owning task, so sliced
+		// runs attribute their game-thread cost the same way dispatched ones do
+		const uint64 StepStartCycles = FPlatformTime::Cycles64();
+		if (Active.Task.IsValid())
+		{
+			Active.Task->MarkGameThreadEntered();
+		}
+
+		bool bFinished = false;
+		do
+		{
+			bFinished = Active.Slice->Step();
+		}
+		while (!bFinished && (FPlatformTime::Seconds() - StartSeconds) < BudgetSeconds);
+
+		if (Active.Task.IsValid())
+		{
+			Active.Task->AddGameThreadCycles(FPlatformTime::Cycles64() - StepStartCycles);
+			Active.Task->Progress.Store(Active.Slice->GetProgressPercent());
+		}
+
+		if (!bFinished)
+		{
+			// Budget spent; resume next frame
+			break;
+		}
+
+		if (Active.OnComplete)
+		{
+			Active.OnComplete(Active.Slice->GetResult());
+		}
+		ActiveSlices.RemoveAt(0);
+	}
+
+	if (ActiveSlices.Num() == 0)
+	{
+		// Returning false unregisters the ticker; re-enqueue re-registers
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,87 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPAsyncTask.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Cooperative time slicing for long game-thread tool executions.
+ *
+ * Tools that must mutate engine state on the game thread normally run to
+ * completion inside one frame; a bulk spawn or blueprint compile can hitch
+ * the editor for hundreds of milliseconds. A tool opts in by returning a
+ * slice object from CreateSlicedExecution(); the task queue hands it to
+ * FMCPToolSlicer, which steps active slices once per editor frame within a
+ * shared time budget (MCPServer::GameThreadSliceBudgetMs). The editor keeps
+ * rendering while the operation grinds forward, and the owning FMCPAsyncTask
+ * reports partial progress to pollers.
+ *
+ * Only task-queue submissions slice; a direct synchronous tool call still
+ * runs blocking, since its HTTP response cannot outlive the request.
+ */
+class IMCPSlicedExecution
+{
+public:
+	virtual ~IMCPSlicedExecution() = default;
+
+	/**
+	 * Run one increment of work on the game thread. Do roughly one element
+	 * per call and let the slicer decide how many calls fit this frame.
+	 * @return true when the operation is finished
+	 */
+	virtual bool Step() = 0;
+
+	/** Completion percentage (0-100) for task progress reporting */
+	virtual int32 GetProgressPercent() const = 0;
+
+	/** Final result; only called after Step() has returned true */
+	virtual FMCPToolResult GetResult() = 0;
+
+	/** Called instead of further steps when the owning task is cancelled */
+	virtual void Cancel() {}
+};
+
+/**
+ * Game-thread scheduler for sliced executions.
+ *
+ * Slices run FIFO - one operation finishes before the next starts - so two
+ * concurrent bulk mutations never interleave their engine-state edits.
+ * The ticker registers itself while work is queued and unregisters when
+ * the last slice completes, so an idle editor pays nothing.
+ */
+class FMCPToolSlicer
+{
+public:
+	static FMCPToolSlicer& Get();
+
+	/**
+	 * Queue a slice for per-frame stepping. Game thread only.
+	 * @param Slice The incremental execution to drive
+	 * @param Task Owning async task; progress and cancellation flow through it
+	 * @param OnComplete Runs on the game thread after the final step (or cancel)
+	 */
+	void Enqueue(
+		TSharedPtr<IMCPSlicedExecution> Slice,
+		TSharedPtr<FMCPAsyncTask> Task,
+		TFunction<void(const FMCPToolResult&)> OnComplete);
+
+private:
+	/** One queued sliced operation */
+	struct FActiveSlice
+	{
+		TSharedPtr<IMCPSlicedExecution> Slice;
+		TSharedPtr<FMCPAsyncTask> Task;
+		TFunction<void(const FMCPToolResult&)> OnComplete;
+	};
+
+	/** Step the front slice within the frame budget */
+	bool Tick(float DeltaTime);
+
+	/** Queued slices, front one active */
+	TArray<FActiveSlice> ActiveSlices;
+
+	/** Ticker registration while slices are queued */
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,102 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Incremental UTF-8 JSON writer for streaming tool responses
+ *
+ * Tools that implement the streaming execution path write JSON fragments
+ * into this writer as they are produced, instead of building a full
+ * FJsonObject document and serializing it in one pass. Fragments are
+ * converted to UTF-8 immediately and appended to the response body buffer,
+ * so large payloads (e.g. blueprint_query on big AnimBPs) never exist as
+ * a single wide-character FString.
+ *
+ * The flush callback is invoked whenever the internal buffer crosses
+ * FlushThresholdBytes, which lets transports that support chunked delivery
+ * push bytes to the client before serialization completes. The default
+ * HTTP transport accumulates chunks into one response body (the engine's
+ * HttpServer module delivers a single FHttpServerResponse), but still
+ * benefits from the DOM-free, single-conversion serialization path.
+ */
+class FMCPJsonStreamWriter
+{
+public:
+	/** Callback invoked with each flushed chunk of UTF-8 bytes */
+	using FChunkCallback = TFunction<void(const uint8* Data, int32 Num)>;
+
+	/** Flush to the chunk callback once this many bytes are buffered */
+	static constexpr int32 FlushThresholdBytes = 64 * 1024;
+
+	explicit FMCPJsonStreamWriter(FChunkCallback InOnChunk)
+		: OnChunk(MoveTemp(InOnChunk))
+	{
+		Buffer.Reserve(FlushThresholdBytes);
+	}
+
+	~FMCPJsonStreamWriter()
+	{
+		Flush();
+	}
+
+	/** Append a JSON fragment (converted to UTF-8 immediately) */
+	void Write(FStringView Fragment)
+	{
+		if (Fragment.IsEmpty())
+		{
+			return;
+		}
+
+		const int32 Utf8Len = FPlatformString::ConvertedLength<UTF8CHAR>(Fragment.GetData(), Fragment.Len());
+		const int32 Offset = Buffer.AddUninitialized(Utf8Len);
+		FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Buffer.GetData() + Offset), Utf8Len, Fragment.GetData(), Fragment.Len());
+
+		if (Buffer.Num() >= FlushThresholdBytes)
+		{
+			Flush();
+		}
+	}
+
+	/** Append raw UTF-8 bytes (caller guarantees valid encoding) */
+	void WriteRaw(const uint8* Data, int32 Num)
+	{
+		if (Data && Num > 0)
+		{
+			Buffer.Append(Data, Num);
+			if (Buffer.Num() >= FlushThresholdBytes)
+			{
+				Flush();
+			}
+		}
+	}
+
+	/** Append a JSON-escaped string value, including surrounding quotes */
+	void WriteEscaped(const FString& Value)
+	{
+		const FString Escaped = Value.ReplaceCharWithEscapedChar();
+		Write(TEXT("\""));
+		Write(Escaped);
+		Write(TEXT("\""));
+	}
+
+	/** Push any buffered bytes to the chunk callback */
+	void Flush()
+	{
+		if (Buffer.Num() > 0 && OnChunk)
+		{
+			OnChunk(Buffer.GetData(), Buffer.Num());
+			BytesWritten += Buffer.Num();
+			Buffer.Reset();
+		}
+	}
+
+	/** Total bytes written so far (including flushed chunks) */
+	int64 GetBytesWritten() const { return BytesWritten + Buffer.Num(); }
+
+private:
+	FChunkCallback OnChunk;
+	TArray<uint8> Buffer;
+	int64 BytesWritten = 0;
+};
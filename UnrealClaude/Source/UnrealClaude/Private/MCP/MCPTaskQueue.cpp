@@ -1,14 +1,34 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTaskQueue.h"
+#include "MCPCancellation.h"
+#include "MCPSlicedExecution.h"
+#include "MCPTaskStore.h"
+#include "MCPMemoryStats.h"
 #include "MCPToolRegistry.h"
 #include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "BlueprintLoader.h"
+#include "Engine/Engine.h"
+#include "UObject/GarbageCollection.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/App.h"
 #include "Async/Async.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonSerializer.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "HAL/LowLevelMemTracker.h"
+
+LLM_DECLARE_TAG(UnrealClaude);
 
 FMCPTaskQueue::FMCPTaskQueue(FMCPToolRegistry* InToolRegistry)
 	: ToolRegistry(InToolRegistry)
 	, RunningTaskCount(0)
-	, WorkerThread(nullptr)
+	, ActiveTaskCount(0)
+	, LastBusyDispatchCycles(0)
 	, bShouldStop(false)
 	, WakeUpEvent(nullptr)
 	, LastCleanupTime(FDateTime::UtcNow())
@@ -32,30 +52,73 @@ FMCPTaskQueue::~FMCPTaskQueue()
 
 void FMCPTaskQueue::Start()
 {
-	if (WorkerThread)
+	if (WorkerThreads.Num() > 0)
 	{
 		return; // Already running
 	}
 
-	// Reset stop flag before creating thread
+	// Reset stop flag before creating threads
 	bShouldStop = false;
 
-	// Create the thread with default parameters for stability
-	WorkerThread = FRunnableThread::Create(
-		this,
-		TEXT("MCPTaskQueue"),
-		0,  // Default stack size
-		TPri_BelowNormal
-	);
+	// Replay the task journal: tasks submitted last session that never
+	// finished come back as failed "interrupted" entries, so task_status
+	// reports them accurately instead of losing them
+	TArray<TSharedPtr<FMCPAsyncTask>> Interrupted;
+	FMCPTaskStore::Get().RecoverInterruptedTasks(Interrupted);
+	if (Interrupted.Num() > 0)
+	{
+		FWriteScopeLock Lock(TasksLock);
+		for (const TSharedPtr<FMCPAsyncTask>& Task : Interrupted)
+		{
+			Tasks.Add(Task->TaskId, Task);
+		}
+	}
 
-	if (WorkerThread)
+	// Spin up the worker pool. Each worker independently drains the pending
+	// queue, so independent tasks (e.g. asset_search next to a long
+	// execute_script) genuinely overlap up to the pool size. With adaptive
+	// concurrency the configured count is a floor and the pool scales to
+	// the machine - thread-safe tools (asset queries, log reads, captures)
+	// run entirely on their worker, so a 32-core box drains background-safe
+	// work much wider than the fixed default; game-thread-bound tasks are
+	// bounded by the dispatch throttle in ExecuteTask, not the pool size.
+	int32 WorkerCount = FMath::Max(1, Config.MaxConcurrentTasks);
+	if (Config.bAdaptiveConcurrency)
 	{
-		UE_LOG(LogUnrealClaude, Log, TEXT("MCP Task Queue started"));
+		const int32 CoreScaled = FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 2;
+		WorkerCount = FMath::Max(WorkerCount,
+			FMath::Clamp(CoreScaled, 1, UnrealClaudeConstants::MCPServer::AdaptiveWorkerMaxCount));
 	}
-	else
+	for (int32 Index = 0; Index < WorkerCount; ++Index)
 	{
-		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to create MCP Task Queue thread"));
+		FRunnableThread* Worker = FRunnableThread::Create(
+			this,
+			*FString::Printf(TEXT("MCPTaskWorker_%d"), Index),
+			0,  // Default stack size
+			TPri_BelowNormal
+		);
+
+		if (Worker)
+		{
+			WorkerThreads.Add(Worker);
+		}
+		else
+		{
+			UE_LOG(LogUnrealClaude, Error, TEXT("Failed to create MCP task worker thread %d"), Index);
+		}
 	}
+
+	if (WorkerThreads.Num() > 0)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("MCP Task Queue started (%d workers)"), WorkerThreads.Num());
+	}
+
+	// Gauge for /mcp/status memory accounting: bytes the task map retains
+	// (mostly terminal results waiting out their retention window)
+	FMCPMemoryStats::Get().RegisterProvider(TEXT("task_queue"), [this]
+	{
+		return GetEstimatedMemoryBytes();
+	});
 }
 
 void FMCPTaskQueue::Stop()
@@ -73,74 +136,227 @@ void FMCPTaskQueue::Stop()
 
 void FMCPTaskQueue::Shutdown()
 {
-	FRunnableThread* ThreadToKill = WorkerThread;
-	if (!ThreadToKill)
+	TArray<FRunnableThread*> ThreadsToKill = MoveTemp(WorkerThreads);
+	if (ThreadsToKill.Num() == 0)
 	{
 		return;
 	}
 
-	// Clear the pointer first to prevent re-entry
-	WorkerThread = nullptr;
+	FMCPMemoryStats::Get().UnregisterProvider(TEXT("task_queue"));
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Task Queue shutting down..."));
+	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Task Queue shutting down (%d workers)..."), ThreadsToKill.Num());
 
 	// Set stop flag explicitly (in case Kill doesn't call Stop properly)
 	bShouldStop = true;
 
-	// Trigger wake event to unblock any waits
+	// Trigger wake event to unblock any waits. Workers also poll the stop
+	// flag on a short wait timeout, so a single trigger is sufficient.
 	if (WakeUpEvent)
 	{
 		WakeUpEvent->Trigger();
 	}
 
-	// Kill the thread - this calls our Stop() method then waits
-	ThreadToKill->Kill(true);
+	// Kill each thread - this calls our Stop() method then waits
+	for (FRunnableThread* Thread : ThreadsToKill)
+	{
+		Thread->Kill(true);
+		delete Thread;
+	}
 
-	delete ThreadToKill;
+	// No finalizing thread is ever going to fire these now; release parked
+	// long-poll waiters with whatever state their task ended in so the HTTP
+	// layer can complete the held responses instead of leaking them
+	TMap<FGuid, TArray<TFunction<void(TSharedPtr<FMCPAsyncTask>)>>> RemainingWaiters;
+	{
+		FScopeLock Lock(&WaitersLock);
+		RemainingWaiters = MoveTemp(CompletionWaiters);
+	}
+	for (const auto& Pair : RemainingWaiters)
+	{
+		TSharedPtr<FMCPAsyncTask> Task = GetTask(Pair.Key);
+		for (const TFunction<void(TSharedPtr<FMCPAsyncTask>)>& Waiter : Pair.Value)
+		{
+			Waiter(Task);
+		}
+	}
 
 	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Task Queue stopped"));
 }
 
-FGuid FMCPTaskQueue::SubmitTask(const FString& ToolName, TSharedPtr<FJsonObject> Parameters, uint32 TimeoutMs)
+FGuid FMCPTaskQueue::SubmitTask(const FString& ToolName, TSharedPtr<FJsonObject> Parameters, uint32 TimeoutMs, EMCPTaskPriority Priority, bool bDeferGC, const TArray<FGuid>& Prerequisites, FString* OutSubmitError)
 {
+	LLM_SCOPE_BYTAG(UnrealClaude);
+
 	// Validate tool exists
 	if (ToolRegistry && !ToolRegistry->HasTool(ToolName))
 	{
 		UE_LOG(LogUnrealClaude, Warning, TEXT("Cannot submit task: Tool '%s' not found"), *ToolName);
+		if (OutSubmitError)
+		{
+			*OutSubmitError = FString::Printf(TEXT("Tool '%s' not found"), *ToolName);
+		}
 		return FGuid();
 	}
 
+	// Validate parameters once, here. The task carries the prevalidated flag
+	// and execution skips the compiled checks, so an invalid bulk submission
+	// fails immediately with a real error instead of when the task runs -
+	// and a valid one never pays for validation twice.
+	if (ToolRegistry && Parameters.IsValid())
+	{
+		FString ValidationError;
+		if (!ToolRegistry->ValidateToolParams(ToolName, Parameters.ToSharedRef(), ValidationError))
+		{
+			UE_LOG(LogUnrealClaude, Warning, TEXT("Cannot submit task for '%s': %s"), *ToolName, *ValidationError);
+			if (OutSubmitError)
+			{
+				*OutSubmitError = ValidationError;
+			}
+			return FGuid();
+		}
+	}
+
+	// Content-hash dedup for read-only tools: agents and their retry
+	// harnesses submit identical queries back-to-back, so an in-flight task
+	// absorbs the duplicate and a freshly completed result is re-served
+	// instead of re-running the query. Mutating tools never dedup - two
+	// identical spawns are two spawns. Dependent submissions never dedup
+	// either: a query ordered after a mutation must observe it, not be
+	// absorbed by an identical query that ran before it.
+	FString TaskHash;
+	if (Prerequisites.Num() == 0)
+	{
+		// Read-only hint comes from the flag captured at registration, not a
+		// per-submit GetInfo schema rebuild
+		if (ToolRegistry && ToolRegistry->IsToolReadOnly(ToolName))
+		{
+			TaskHash = ComputeTaskHash(ToolName, Parameters);
+
+			FReadScopeLock Lock(TasksLock);
+			if (const FGuid* ExistingId = TaskHashIndex.Find(TaskHash))
+			{
+				if (const TSharedPtr<FMCPAsyncTask>* Existing = Tasks.Find(*ExistingId))
+				{
+					const EMCPTaskStatus Status = (*Existing)->Status.Load();
+					const bool bInFlight = Status == EMCPTaskStatus::Pending || Status == EMCPTaskStatus::Running;
+					const bool bFreshResult = Status == EMCPTaskStatus::Completed &&
+						(FDateTime::UtcNow() - (*Existing)->CompletedTime).GetTotalSeconds() <= Config.DedupResultTTLSeconds;
+					if (bInFlight || bFreshResult)
+					{
+						UE_LOG(LogUnrealClaude, Log, TEXT("Task deduplicated onto %s (tool: %s, %s)"),
+							*ExistingId->ToString(), *ToolName,
+							bInFlight ? TEXT("in flight") : TEXT("fresh result"));
+						return *ExistingId;
+					}
+				}
+			}
+		}
+	}
+
 	// Create new task
 	TSharedPtr<FMCPAsyncTask> Task = MakeShared<FMCPAsyncTask>();
 	Task->ToolName = ToolName;
 	Task->Parameters = Parameters;
 	Task->TimeoutMs = TimeoutMs > 0 ? TimeoutMs : Config.DefaultTimeoutMs;
+	Task->Priority = Priority;
+	Task->bDeferGC = bDeferGC;
+	Task->bParamsPrevalidated = true;
+	Task->PrerequisiteIds = Prerequisites;
 
-	// Add to task map and queue
+	// Check capacity via the atomic counter - no task map scan on the
+	// submission hot path
+	if (ActiveTaskCount.Load() >= Config.MaxHistorySize)
 	{
-		FScopeLock Lock(&TasksLock);
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Task queue at capacity (%d tasks), rejecting new task"), Config.MaxHistorySize);
+		if (OutSubmitError)
+		{
+			*OutSubmitError = FString::Printf(TEXT("Task queue at capacity (%d tasks)"), Config.MaxHistorySize);
+		}
+		return FGuid();
+	}
 
-		// Check if we're at capacity
-		int32 ActiveTasks = 0;
-		for (const auto& Pair : Tasks)
+	// Register under each unfinished prerequisite. Same protocol as the
+	// completion waiters: finalizers store terminal status before taking
+	// DependencyLock in ReleaseDependents, so a prerequisite seen
+	// non-terminal under the lock is guaranteed to drain this entry later
+	int32 UnfinishedPrereqs = 0;
+	bool bPrereqAlreadyFailed = false;
+	if (Prerequisites.Num() > 0)
+	{
+		FScopeLock DepLock(&DependencyLock);
+		for (const FGuid& PrereqId : Prerequisites)
 		{
-			if (!Pair.Value->IsComplete())
+			TSharedPtr<FMCPAsyncTask> Prereq = GetTask(PrereqId);
+			if (!Prereq.IsValid())
 			{
-				ActiveTasks++;
+				UE_LOG(LogUnrealClaude, Warning, TEXT("Cannot submit task: unknown prerequisite %s"), *PrereqId.ToString());
+				if (OutSubmitError)
+				{
+					*OutSubmitError = FString::Printf(TEXT("Unknown prerequisite task ID: %s"), *PrereqId.ToString());
+				}
+				return FGuid();
 			}
-		}
 
-		if (ActiveTasks >= Config.MaxHistorySize)
+			const EMCPTaskStatus PrereqStatus = Prereq->Status.Load();
+			if (PrereqStatus == EMCPTaskStatus::Completed)
+			{
+				continue; // Already satisfied
+			}
+			if (Prereq->IsComplete())
+			{
+				bPrereqAlreadyFailed = true;
+				continue;
+			}
+
+			DependentsByPrereq.FindOrAdd(PrereqId).Add(Task->TaskId);
+			++UnfinishedPrereqs;
+		}
+		Task->PendingPrerequisites.Store(UnfinishedPrereqs);
+		if (bPrereqAlreadyFailed)
 		{
-			UE_LOG(LogUnrealClaude, Warning, TEXT("Task queue at capacity (%d tasks), rejecting new task"), Config.MaxHistorySize);
-			return FGuid();
+			Task->bPrerequisiteFailed = true;
 		}
+	}
 
+	// Insert into the map first (write lock), then publish to the pending
+	// queue - the MPSC enqueue is lock-free, so concurrent submitters only
+	// contend for the brief map insert, never with status pollers
+	{
+		FWriteScopeLock Lock(TasksLock);
 		Tasks.Add(Task->TaskId, Task);
-		PendingQueue.Enqueue(Task->TaskId);
+		if (!TaskHash.IsEmpty())
+		{
+			// Newest task wins the hash slot; a stale or expired entry is
+			// simply overwritten
+			TaskHashIndex.Add(TaskHash, Task->TaskId);
+		}
 	}
+	ActiveTaskCount++;
+
+	// Write-ahead record: journaled before execution, so a crash mid-task
+	// is reported as interrupted on the next start instead of vanishing
+	FMCPTaskStore::Get().RecordSubmitted(*Task);
+
+	// Dispatch: ready tasks enqueue immediately; tasks with unfinished
+	// prerequisites park until ReleaseDependents drains their count. A task
+	// whose prerequisites already all failed goes terminal right away -
+	// the failure is reported through task_status like any other
+	if (UnfinishedPrereqs > 0)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Task submitted: %s (tool: %s, priority: %s, waiting on %d prerequisite(s))"),
+			*Task->TaskId.ToString(), *ToolName, *FMCPAsyncTask::PriorityToString(Priority), UnfinishedPrereqs);
+		return Task->TaskId;
+	}
+	if (bPrereqAlreadyFailed)
+	{
+		FailPendingTask(Task, TEXT("Prerequisite task did not complete successfully"));
+		return Task->TaskId;
+	}
+
+	PendingQueues[static_cast<int32>(Priority)].Enqueue(Task->TaskId);
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("Task submitted: %s (tool: %s)"), *Task->TaskId.ToString(), *ToolName);
+	UE_LOG(LogUnrealClaude, Log, TEXT("Task submitted: %s (tool: %s, priority: %s)"),
+		*Task->TaskId.ToString(), *ToolName, *FMCPAsyncTask::PriorityToString(Priority));
 
 	// Wake up worker thread
 	if (WakeUpEvent)
@@ -151,9 +367,34 @@ FGuid FMCPTaskQueue::SubmitTask(const FString& ToolName, TSharedPtr<FJsonObject>
 	return Task->TaskId;
 }
 
+FString FMCPTaskQueue::ComputeTaskHash(const FString& ToolName, const TSharedPtr<FJsonObject>& Parameters)
+{
+	// Serialize condensed and hash. FJsonObject preserves insertion order,
+	// so identical submissions from the same client hash identically; two
+	// clients ordering fields differently just miss the dedup, which is
+	// safe - a miss only costs the query it would have saved.
+	FString ParamsJson;
+	if (Parameters.IsValid())
+	{
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsJson);
+		FJsonSerializer::Serialize(Parameters.ToSharedRef(), Writer);
+	}
+
+	FMD5 Md5;
+	FTCHARToUTF8 ToolNameUtf8(*ToolName);
+	Md5.Update(reinterpret_cast<const uint8*>(ToolNameUtf8.Get()), ToolNameUtf8.Length());
+	FTCHARToUTF8 ParamsUtf8(*ParamsJson);
+	Md5.Update(reinterpret_cast<const uint8*>(ParamsUtf8.Get()), ParamsUtf8.Length());
+
+	FMD5Hash Hash;
+	Hash.Set(Md5);
+	return LexToString(Hash);
+}
+
 TSharedPtr<FMCPAsyncTask> FMCPTaskQueue::GetTask(const FGuid& TaskId) const
 {
-	FScopeLock Lock(&TasksLock);
+	FReadScopeLock Lock(TasksLock);
 	const TSharedPtr<FMCPAsyncTask>* Found = Tasks.Find(TaskId);
 	return Found ? *Found : nullptr;
 }
@@ -161,7 +402,14 @@ TSharedPtr<FMCPAsyncTask> FMCPTaskQueue::GetTask(const FGuid& TaskId) const
 bool FMCPTaskQueue::GetTaskResult(const FGuid& TaskId, FMCPToolResult& OutResult) const
 {
 	TSharedPtr<FMCPAsyncTask> Task = GetTask(TaskId);
-	if (!Task.IsValid() || !Task->IsComplete())
+	if (!Task.IsValid())
+	{
+		// Not in memory: serve a result spilled to disk by this or a
+		// previous editor session
+		return FMCPTaskStore::Get().LoadResult(TaskId, OutResult);
+	}
+
+	if (!Task->IsComplete())
 	{
 		return false;
 	}
@@ -185,6 +433,12 @@ bool FMCPTaskQueue::CancelTask(const FGuid& TaskId)
 		Task->Status.Store(EMCPTaskStatus::Cancelled);
 		Task->CompletedTime = FDateTime::UtcNow();
 		Task->Result = FMCPToolResult::Error(TEXT("Task cancelled before execution"));
+		Task->BuildSerializedResult();
+		ActiveTaskCount--;
+		FMCPTaskStore::Get().RecordTerminal(*Task);
+		ScheduleRetention(Task);
+		NotifyCompletionWaiters(Task);
+		ReleaseDependents(Task);
 		UE_LOG(LogUnrealClaude, Log, TEXT("Task cancelled (pending): %s"), *TaskId.ToString());
 		return true;
 	}
@@ -199,16 +453,127 @@ bool FMCPTaskQueue::CancelTask(const FGuid& TaskId)
 	return false; // Already complete
 }
 
+bool FMCPTaskQueue::WaitForCompletion(const FGuid& TaskId, TFunction<void(TSharedPtr<FMCPAsyncTask>)> OnTerminal)
+{
+	TSharedPtr<FMCPAsyncTask> Task = GetTask(TaskId);
+	if (!Task.IsValid())
+	{
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&WaitersLock);
+		// Check terminality under the waiter lock: the finalizing thread
+		// stores terminal status before it takes this lock to drain, so a
+		// task seen non-terminal here is guaranteed to drain this entry
+		if (!Task->IsComplete())
+		{
+			CompletionWaiters.FindOrAdd(TaskId).Add(MoveTemp(OnTerminal));
+			return true;
+		}
+	}
+
+	// Already terminal - fire straight away on the calling thread
+	OnTerminal(Task);
+	return true;
+}
+
+void FMCPTaskQueue::NotifyCompletionWaiters(const TSharedPtr<FMCPAsyncTask>& Task)
+{
+	TArray<TFunction<void(TSharedPtr<FMCPAsyncTask>)>> Waiters;
+	{
+		FScopeLock Lock(&WaitersLock);
+		CompletionWaiters.RemoveAndCopyValue(Task->TaskId, Waiters);
+	}
+
+	// Invoked outside the lock: waiters complete HTTP responses and may do
+	// real work; new registrations for this task fire immediately instead
+	for (const TFunction<void(TSharedPtr<FMCPAsyncTask>)>& Waiter : Waiters)
+	{
+		Waiter(Task);
+	}
+}
+
+void FMCPTaskQueue::ReleaseDependents(const TSharedPtr<FMCPAsyncTask>& Task)
+{
+	TArray<FGuid> DependentIds;
+	{
+		FScopeLock Lock(&DependencyLock);
+		DependentsByPrereq.RemoveAndCopyValue(Task->TaskId, DependentIds);
+	}
+	if (DependentIds.Num() == 0)
+	{
+		return;
+	}
+
+	const bool bSucceeded = Task->Status.Load() == EMCPTaskStatus::Completed;
+	for (const FGuid& DependentId : DependentIds)
+	{
+		TSharedPtr<FMCPAsyncTask> Dependent = GetTask(DependentId);
+		if (!Dependent.IsValid() || Dependent->Status.Load() != EMCPTaskStatus::Pending)
+		{
+			continue; // Cancelled (or cleaned up) while parked
+		}
+
+		if (!bSucceeded)
+		{
+			Dependent->bPrerequisiteFailed = true;
+		}
+
+		// The last prerequisite to go terminal dispatches (or fails) the
+		// dependent; earlier ones only decrement
+		if (Dependent->PendingPrerequisites.DecrementExchange() != 1)
+		{
+			continue;
+		}
+
+		if (Dependent->bPrerequisiteFailed)
+		{
+			FailPendingTask(Dependent,
+				FString::Printf(TEXT("Prerequisite task %s did not complete successfully"), *Task->TaskId.ToString()));
+		}
+		else
+		{
+			PendingQueues[static_cast<int32>(Dependent->Priority)].Enqueue(DependentId);
+			if (WakeUpEvent)
+			{
+				WakeUpEvent->Trigger();
+			}
+			UE_LOG(LogUnrealClaude, Log, TEXT("Task dispatched: %s (prerequisites satisfied)"), *DependentId.ToString());
+		}
+	}
+}
+
+void FMCPTaskQueue::FailPendingTask(const TSharedPtr<FMCPAsyncTask>& Task, const FString& Message)
+{
+	Task->Status.Store(EMCPTaskStatus::Failed);
+	Task->CompletedTime = FDateTime::UtcNow();
+	Task->Result = FMCPToolResult::Error(Message);
+	Task->BuildSerializedResult();
+	ActiveTaskCount--;
+	FMCPTaskStore::Get().RecordTerminal(*Task);
+	ScheduleRetention(Task);
+	NotifyCompletionWaiters(Task);
+
+	// Failure cascades down the graph: tasks depending on this one fail the
+	// same way instead of waiting forever
+	ReleaseDependents(Task);
+
+	UE_LOG(LogUnrealClaude, Warning, TEXT("Task failed before dispatch: %s (%s)"), *Task->TaskId.ToString(), *Message);
+}
+
 TArray<TSharedPtr<FMCPAsyncTask>> FMCPTaskQueue::GetAllTasks(bool bIncludeCompleted) const
 {
 	TArray<TSharedPtr<FMCPAsyncTask>> Result;
 
-	FScopeLock Lock(&TasksLock);
-	for (const auto& Pair : Tasks)
 	{
-		if (bIncludeCompleted || !Pair.Value->IsComplete())
+		FReadScopeLock Lock(TasksLock);
+		for (const auto& Pair : Tasks)
 		{
-			Result.Add(Pair.Value);
+			if (bIncludeCompleted || !Pair.Value->IsComplete())
+			{
+				Result.Add(Pair.Value);
+			}
 		}
 	}
 
@@ -227,7 +592,7 @@ void FMCPTaskQueue::GetStats(int32& OutPending, int32& OutRunning, int32& OutCom
 	OutRunning = 0;
 	OutCompleted = 0;
 
-	FScopeLock Lock(&TasksLock);
+	FReadScopeLock Lock(TasksLock);
 	for (const auto& Pair : Tasks)
 	{
 		switch (Pair.Value->Status.Load())
@@ -245,6 +610,18 @@ void FMCPTaskQueue::GetStats(int32& OutPending, int32& OutRunning, int32& OutCom
 	}
 }
 
+uint64 FMCPTaskQueue::GetEstimatedMemoryBytes() const
+{
+	uint64 Bytes = 0;
+	FReadScopeLock Lock(TasksLock);
+	Bytes += Tasks.GetAllocatedSize() + TaskHashIndex.GetAllocatedSize();
+	for (const auto& Pair : Tasks)
+	{
+		Bytes += Pair.Value->GetEstimatedMemoryBytes();
+	}
+	return Bytes;
+}
+
 bool FMCPTaskQueue::Init()
 {
 	return true;
@@ -252,65 +629,76 @@ bool FMCPTaskQueue::Init()
 
 uint32 FMCPTaskQueue::Run()
 {
+	// Per-worker loop: every thread in the pool runs this concurrently.
+	// Concurrency is bounded by the pool size itself, so no explicit
+	// MaxConcurrentTasks gate is needed here.
 	while (!bShouldStop)
 	{
-		// Check for pending tasks
-		FGuid TaskId;
-		bool bHasTask = false;
-
+		TSharedPtr<FMCPAsyncTask> Task = DequeueNextTask();
+		if (Task.IsValid())
 		{
-			FScopeLock Lock(&TasksLock);
-			if (RunningTaskCount.Load() < Config.MaxConcurrentTasks)
-			{
-				// Find next non-cancelled pending task
-				while (PendingQueue.Dequeue(TaskId))
-				{
-					TSharedPtr<FMCPAsyncTask>* Found = Tasks.Find(TaskId);
-					if (Found && (*Found)->Status.Load() == EMCPTaskStatus::Pending)
-					{
-						bHasTask = true;
-						break;
-					}
-				}
-			}
+			RunningTaskCount++;
+			ExecuteTask(Task);
+			RunningTaskCount--;
+			continue; // Immediately look for more work
 		}
 
-		if (bHasTask)
+		// Periodic cleanup - any idle worker may run it, guarded so only one does
+		FDateTime Now = FDateTime::UtcNow();
+		if ((Now - LastCleanupTime).GetTotalSeconds() >= Config.CleanupIntervalSeconds)
 		{
-			TSharedPtr<FMCPAsyncTask> Task = GetTask(TaskId);
-			if (Task.IsValid())
+			FScopeLock Lock(&MaintenanceLock);
+			if ((Now - LastCleanupTime).GetTotalSeconds() >= Config.CleanupIntervalSeconds)
 			{
-				RunningTaskCount++;
-
-				// Execute task asynchronously
-				AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Task]()
-				{
-					ExecuteTask(Task);
-					RunningTaskCount--;
-				});
+				CleanupOldTasks();
+				CheckTimeouts();
+				LastCleanupTime = Now;
 			}
 		}
 
-		// Periodic cleanup (only every 60 seconds)
-		FDateTime Now = FDateTime::UtcNow();
-		if ((Now - LastCleanupTime).GetTotalSeconds() >= Config.CleanupIntervalSeconds)
+		// Wait for new work; short timeout keeps shutdown and maintenance responsive
+		if (WakeUpEvent)
 		{
-			CleanupOldTasks();
-			CheckTimeouts();
-			LastCleanupTime = Now;
+			WakeUpEvent->Wait(50);
+		}
+		else
+		{
+			FPlatformProcess::Sleep(0.01f);
 		}
-
-		// Sleep to avoid consuming 100% CPU and allow responsive shutdown
-		FPlatformProcess::Sleep(0.01f);
 	}
 
 	return 0;
 }
 
+TSharedPtr<FMCPAsyncTask> FMCPTaskQueue::DequeueNextTask()
+{
+	// Workers are the only consumers of the MPSC pending queues; this lock
+	// makes the pool a single logical consumer without ever touching the
+	// map lock submitters and status pollers use
+	FScopeLock Lock(&DequeueLock);
+
+	// Drain priority levels in order: High, Normal, Low.
+	// FIFO within each level; cancelled tasks are skipped.
+	for (TQueue<FGuid, EQueueMode::Mpsc>& Queue : PendingQueues)
+	{
+		FGuid TaskId;
+		while (Queue.Dequeue(TaskId))
+		{
+			TSharedPtr<FMCPAsyncTask> Found = GetTask(TaskId);
+			if (Found.IsValid() && Found->Status.Load() == EMCPTaskStatus::Pending)
+			{
+				return Found;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
 void FMCPTaskQueue::Exit()
 {
-	// Cancel all running tasks
-	FScopeLock Lock(&TasksLock);
+	// Cancel all running tasks (task flags only - the map is not mutated)
+	FReadScopeLock Lock(TasksLock);
 	for (auto& Pair : Tasks)
 	{
 		if (!Pair.Value->IsComplete())
@@ -327,6 +715,13 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 		return;
 	}
 
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("MCPTask %s"), *Task->ToolName));
+
+	// Bookmark carries the task id so an Insights capture can be lined up
+	// against the per-hop timings the task reports over HTTP; scope names
+	// above stay id-free to keep their cardinality bounded
+	TRACE_BOOKMARK(TEXT("MCPTask %s %s"), *Task->ToolName, *Task->TaskId.ToString());
+
 	// Mark as running
 	Task->Status.Store(EMCPTaskStatus::Running);
 	Task->StartedTime = FDateTime::UtcNow();
@@ -339,21 +734,106 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 		Task->Status.Store(EMCPTaskStatus::Cancelled);
 		Task->CompletedTime = FDateTime::UtcNow();
 		Task->Result = FMCPToolResult::Error(TEXT("Task cancelled"));
+		Task->BuildSerializedResult();
+		ActiveTaskCount--;
+		FMCPTaskStore::Get().RecordTerminal(*Task);
+		ScheduleRetention(Task);
+		NotifyCompletionWaiters(Task);
+		ReleaseDependents(Task);
 		return;
 	}
 
+	// Deadline is known up front, so the timeout check can be scheduled now
+	// instead of rediscovered by scanning for running tasks later
+	ScheduleTimeoutCheck(Task);
+
 	// Prepare parameters
 	TSharedRef<FJsonObject> Params = Task->Parameters.IsValid()
 		? Task->Parameters.ToSharedRef()
 		: MakeShared<FJsonObject>();
 
-	// Execute the tool via registry.
-	// THREAD SAFETY NOTE: ExecuteTool() handles game thread dispatch internally.
-	// If called from a background thread (as we are here), it dispatches to the
-	// game thread via AsyncTask and waits with a timeout. This ensures all UObject
-	// operations happen on the game thread while allowing async task submission.
-	// See MCPToolRegistry::ExecuteTool() for implementation details.
-	FMCPToolResult Result = ToolRegistry->ExecuteTool(Task->ToolName, Params);
+	// Let the tool reach its own task, e.g. to stream incremental output
+	// that task_status pollers can read before completion
+	Params->SetStringField(TEXT("_task_id"), Task->TaskId.ToString());
+
+	// Publish the cancellation flag for the span of this execution: the tool
+	// builds a token from _task_id and checks it at iteration boundaries, so
+	// CancelTask reclaims the editor mid-loop instead of after the loop. The
+	// task shared pointer held by this frame keeps the flag alive throughout.
+	FMCPCancellationRegistry::Get().Register(Task->TaskId.ToString(), &Task->bCancellationRequested);
+	ON_SCOPE_EXIT { FMCPCancellationRegistry::Get().Unregister(Task->TaskId.ToString()); };
+
+	// Blueprint-touching tools: stream the target package in before the game
+	// thread dispatch below. This worker parks while the load streams, so the
+	// editor stays responsive during a cold load of a heavy Blueprint; tools
+	// against already-loaded Blueprints return from the preload immediately.
+	// Preload failure is non-fatal - the tool reports the real load error.
+	FString BlueprintPath;
+	if (Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath) && !BlueprintPath.IsEmpty())
+	{
+		FBlueprintLoader::PreloadBlueprintPackage(BlueprintPath);
+	}
+
+	// GC deferral window for batch work: hold garbage collection off while
+	// the batch runs so incremental GC pauses don't interleave with it, then
+	// trigger one collection at the end. Skipped when physical memory is
+	// already tight - the safety valve beats the predictable single pause.
+	TUniquePtr<FGCScopeGuard> GCDeferral;
+	if (Task->bDeferGC)
+	{
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		const uint64 MinFreeBytes = UnrealClaudeConstants::MCPServer::GCDeferralMinFreePhysicalMB * 1024ull * 1024ull;
+		if (MemoryStats.AvailablePhysical >= MinFreeBytes)
+		{
+			GCDeferral = MakeUnique<FGCScopeGuard>();
+		}
+		else
+		{
+			UE_LOG(LogUnrealClaude, Warning,
+				TEXT("Task %s requested GC deferral but only %llu MB physical memory is free - running without it"),
+				*Task->TaskId.ToString(), MemoryStats.AvailablePhysical / (1024ull * 1024ull));
+		}
+	}
+
+	// Cooperative slicing first: opted-in tools run as budgeted per-frame
+	// steps on the game thread instead of one blocking dispatch, so long
+	// mutations don't hitch the editor. The worker parks until done.
+	FMCPToolResult Result;
+	if (!TryExecuteSliced(Task, Params, Result))
+	{
+		// Sliced executions budget themselves per frame; a blocking dispatch
+		// does not, so hold it while the editor is hitching
+		ThrottleGameThreadDispatch(Task);
+
+
+		// Execute the tool via registry.
+		// THREAD SAFETY NOTE: ExecuteTool() handles game thread dispatch internally.
+		// If called from a background thread (as we are here), it dispatches to the
+		// game thread via AsyncTask and waits with a timeout. This ensures all UObject
+		// operations happen on the game thread while allowing async task submission.
+		// See MCPToolRegistry::ExecuteTool() for implementation details.
+		Result = ToolRegistry->ExecuteTool(Task->ToolName, Params, Task->bParamsPrevalidated);
+	}
+
+	// Release the deferral and pay for exactly one collection at batch end
+	if (GCDeferral.IsValid())
+	{
+		GCDeferral.Reset();
+		AsyncTask(ENamedThreads::GameThread, []()
+		{
+			if (GEngine)
+			{
+				GEngine->ForceGarbageCollection(true);
+			}
+		});
+	}
+
+	// CheckTimeouts may have already finalized (journaled and counted)
+	// this task while the tool was still running
+	if (Task->Status.Load() == EMCPTaskStatus::TimedOut)
+	{
+		return;
+	}
 
 	// Check for cancellation after execution
 	if (Task->bCancellationRequested)
@@ -370,6 +850,22 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 	Task->CompletedTime = FDateTime::UtcNow();
 	Task->Progress.Store(100);
 
+	// Serialize the result envelope once, here on the worker, so every later
+	// poll hands the same immutable buffer to the socket
+	Task->BuildSerializedResult();
+
+	ActiveTaskCount--;
+	FMCPTaskStore::Get().RecordTerminal(*Task);
+	ScheduleRetention(Task);
+
+	// Push the result to any parked long-poll waiters the instant it exists,
+	// instead of it sitting until the client's next poll tick
+	NotifyCompletionWaiters(Task);
+
+	// Dependents waiting on this task start (or fail) the instant it
+	// finalizes, so dependent plans finish in critical-path time
+	ReleaseDependents(Task);
+
 	FTimespan Duration = Task->CompletedTime - Task->StartedTime;
 	UE_LOG(LogUnrealClaude, Log, TEXT("Task completed: %s (status: %s, duration: %.2fs)"),
 		*Task->TaskId.ToString(),
@@ -377,54 +873,235 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 		Duration.GetTotalSeconds());
 }
 
-void FMCPTaskQueue::CleanupOldTasks()
+void FMCPTaskQueue::ThrottleGameThreadDispatch(const TSharedPtr<FMCPAsyncTask>& Task)
 {
-	FDateTime CutoffTime = FDateTime::UtcNow() - FTimespan::FromSeconds(Config.ResultRetentionSeconds);
+	using namespace UnrealClaudeConstants::MCPServer;
+
+	if (!Config.bAdaptiveConcurrency || IsInGameThread())
+	{
+		return;
+	}
 
-	TArray<FGuid> TasksToRemove;
+	// High priority is the interactive lane - it always dispatches straight
+	// through. Thread-safe tools run entirely on this worker and cannot
+	// hitch a frame, so they are never held either.
+	if (Task->Priority == EMCPTaskPriority::High ||
+		(ToolRegistry && ToolRegistry->IsToolThreadSafe(Task->ToolName)))
+	{
+		return;
+	}
 
+	while (!bShouldStop && !Task->bCancellationRequested &&
+		Task->Status.Load() == EMCPTaskStatus::Running)
 	{
-		FScopeLock Lock(&TasksLock);
-		for (const auto& Pair : Tasks)
+		// FApp's frame delta is written by the game thread each frame; the
+		// unsynchronized read is benign (a stale sample just shifts one
+		// pacing decision by a frame)
+		const double FrameMs = FApp::GetDeltaTime() * 1000.0;
+		if (FrameMs < GameThreadBusyFrameMs)
 		{
-			if (Pair.Value->IsComplete() && Pair.Value->CompletedTime < CutoffTime)
+			return; // headroom - dispatch now
+		}
+
+		// Busy: pace dispatches instead of starving them. The CAS elects one
+		// worker per interval, so queued agent work keeps trickling through
+		// even if the editor never recovers headroom.
+		const uint64 Now = FPlatformTime::Cycles64();
+		uint64 Last = LastBusyDispatchCycles.Load();
+		if (FPlatformTime::ToMilliseconds64(Now - Last) >= BusyGameThreadDispatchIntervalMs)
+		{
+			if (LastBusyDispatchCycles.CompareExchange(Last, Now))
 			{
-				TasksToRemove.Add(Pair.Key);
+				return;
 			}
+			continue; // lost the election - re-evaluate
 		}
 
-		for (const FGuid& Id : TasksToRemove)
+		FPlatformProcess::Sleep(0.005f);
+	}
+}
+
+bool FMCPTaskQueue::TryExecuteSliced(TSharedPtr<FMCPAsyncTask> Task, const TSharedRef<FJsonObject>& Params, FMCPToolResult& OutResult)
+{
+	if (IsInGameThread())
+	{
+		// Slicing needs a worker to park on; on the game thread it would
+		// deadlock waiting for its own frame ticks
+		return false;
+	}
+
+	IMCPTool* Tool = ToolRegistry ? ToolRegistry->FindTool(Task->ToolName) : nullptr;
+	if (!Tool || !Tool->SupportsSlicedExecution(Params))
+	{
+		return false;
+	}
+
+	// Shared state keeps everything alive if the worker outpaces the slicer
+	TSharedPtr<FMCPToolResult> SharedResult = MakeShared<FMCPToolResult>();
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> bSliced = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(true);
+	TSharedPtr<FEvent, ESPMode::ThreadSafe> CompletionEvent = MakeShareable(FPlatformProcess::GetSynchEventFromPool(),
+		[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
+
+	// Slice construction touches engine objects, so it happens on the game
+	// thread; the slicer then steps it across frames within the budget
+	AsyncTask(ENamedThreads::GameThread, [Tool, Task, Params, SharedResult, bSliced, CompletionEvent]()
+	{
+		TSharedPtr<IMCPSlicedExecution> Slice = Tool->CreateSlicedExecution(Params);
+		if (!Slice.IsValid())
 		{
-			Tasks.Remove(Id);
+			*bSliced = false;
+			CompletionEvent->Trigger();
+			return;
+		}
+
+		FMCPToolSlicer::Get().Enqueue(Slice, Task, [SharedResult, CompletionEvent](const FMCPToolResult& Result)
+		{
+			*SharedResult = Result;
+			CompletionEvent->Trigger();
+		});
+	});
+
+	// Park until the slicer finishes. Cancellation and timeout are observed
+	// by the slicer between steps and always end in a trigger. On shutdown
+	// the ticker may never fire again, so flag a cancel and stop waiting
+	// rather than hanging the worker pool forever.
+	while (!CompletionEvent->Wait(50))
+	{
+		if (bShouldStop)
+		{
+			Task->bCancellationRequested = true;
+			if (!CompletionEvent->Wait(1000))
+			{
+				OutResult = FMCPToolResult::Error(TEXT("Sliced execution abandoned at shutdown"));
+				return true;
+			}
+			break;
 		}
 	}
 
-	if (TasksToRemove.Num() > 0)
+	if (!(*bSliced))
 	{
-		UE_LOG(LogUnrealClaude, Log, TEXT("Cleaned up %d old tasks"), TasksToRemove.Num());
+		return false;
 	}
+
+	OutResult = *SharedResult;
+	return true;
 }
 
-void FMCPTaskQueue::CheckTimeouts()
+void FMCPTaskQueue::ScheduleTimeoutCheck(const TSharedPtr<FMCPAsyncTask>& Task)
 {
-	FDateTime Now = FDateTime::UtcNow();
+	FExpiryEntry Entry;
+	Entry.Due = Task->StartedTime + FTimespan::FromMilliseconds(Task->TimeoutMs);
+	Entry.TaskId = Task->TaskId;
 
-	FScopeLock Lock(&TasksLock);
-	for (auto& Pair : Tasks)
+	FScopeLock Lock(&ExpiryLock);
+	TimeoutSchedule.HeapPush(Entry);
+}
+
+void FMCPTaskQueue::ScheduleRetention(const TSharedPtr<FMCPAsyncTask>& Task)
+{
+	FExpiryEntry Entry;
+	Entry.Due = Task->CompletedTime + FTimespan::FromSeconds(Config.ResultRetentionSeconds);
+	Entry.TaskId = Task->TaskId;
+
+	FScopeLock Lock(&ExpiryLock);
+	RetentionSchedule.HeapPush(Entry);
+}
+
+void FMCPTaskQueue::CleanupOldTasks()
+{
+	const FDateTime Now = FDateTime::UtcNow();
+
+	// Pop only the retention entries that are actually due; the rest of the
+	// history is never touched, however large it is
+	TArray<FGuid> DueIds;
 	{
-		TSharedPtr<FMCPAsyncTask>& Task = Pair.Value;
-		if (Task->Status.Load() == EMCPTaskStatus::Running)
+		FScopeLock Lock(&ExpiryLock);
+		while (RetentionSchedule.Num() > 0 && RetentionSchedule.HeapTop().Due <= Now)
 		{
-			FTimespan Elapsed = Now - Task->StartedTime;
-			if (Elapsed.GetTotalMilliseconds() > Task->TimeoutMs)
+			FExpiryEntry Entry;
+			RetentionSchedule.HeapPop(Entry);
+			DueIds.Add(Entry.TaskId);
+		}
+	}
+
+	if (DueIds.Num() == 0)
+	{
+		return;
+	}
+
+	int32 RemovedCount = 0;
+	{
+		FWriteScopeLock Lock(TasksLock);
+		for (const FGuid& Id : DueIds)
+		{
+			const TSharedPtr<FMCPAsyncTask>* Found = Tasks.Find(Id);
+			// Terminal states are final, so a due entry always removes;
+			// the validity check only guards duplicate schedule entries
+			if (Found && (*Found)->IsComplete())
 			{
-				Task->bCancellationRequested = true;
-				Task->Status.Store(EMCPTaskStatus::TimedOut);
-				Task->CompletedTime = Now;
-				Task->Result = FMCPToolResult::Error(
-					FString::Printf(TEXT("Task timed out after %d ms"), Task->TimeoutMs));
-				UE_LOG(LogUnrealClaude, Warning, TEXT("Task timed out: %s"), *Task->TaskId.ToString());
+				Tasks.Remove(Id);
+				RemovedCount++;
 			}
 		}
+
+		// Drop hash index entries whose task just left the map. This walk is
+		// proportional to the dedup index (distinct live read-only
+		// submissions), not the retained history.
+		if (RemovedCount > 0)
+		{
+			for (auto It = TaskHashIndex.CreateIterator(); It; ++It)
+			{
+				if (!Tasks.Contains(It.Value()))
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+	}
+
+	if (RemovedCount > 0)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Cleaned up %d old tasks"), RemovedCount);
+	}
+}
+
+void FMCPTaskQueue::CheckTimeouts()
+{
+	const FDateTime Now = FDateTime::UtcNow();
+
+	// Pop only deadlines that have passed; tasks that finished before their
+	// deadline left a stale entry behind, discarded by the status check below
+	TArray<FGuid> DueIds;
+	{
+		FScopeLock Lock(&ExpiryLock);
+		while (TimeoutSchedule.Num() > 0 && TimeoutSchedule.HeapTop().Due <= Now)
+		{
+			FExpiryEntry Entry;
+			TimeoutSchedule.HeapPop(Entry);
+			DueIds.Add(Entry.TaskId);
+		}
+	}
+
+	for (const FGuid& Id : DueIds)
+	{
+		TSharedPtr<FMCPAsyncTask> Task = GetTask(Id);
+		if (!Task.IsValid() || Task->Status.Load() != EMCPTaskStatus::Running)
+		{
+			continue; // Finished (or was cleaned up) before its deadline
+		}
+
+		Task->bCancellationRequested = true;
+		Task->Status.Store(EMCPTaskStatus::TimedOut);
+		Task->CompletedTime = Now;
+		Task->Result = FMCPToolResult::Error(
+			FString::Printf(TEXT("Task timed out after %d ms"), Task->TimeoutMs));
+		Task->BuildSerializedResult();
+		ActiveTaskCount--;
+		FMCPTaskStore::Get().RecordTerminal(*Task);
+		ScheduleRetention(Task);
+		NotifyCompletionWaiters(Task);
+		ReleaseDependents(Task);
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Task timed out: %s"), *Task->TaskId.ToString());
 	}
 }
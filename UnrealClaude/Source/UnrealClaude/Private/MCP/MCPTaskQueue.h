@@ -16,9 +16,16 @@ class FMCPToolRegistry;
  */
 struct FMCPTaskQueueConfig
 {
-	/** Maximum number of concurrent tasks */
+	/** Maximum number of concurrent tasks (size of the worker thread pool).
+	 *  With adaptive concurrency this is the floor; the pool scales up to
+	 *  the machine's cores for background-safe work. */
 	int32 MaxConcurrentTasks = 4;
 
+	/** Scale the worker pool to available cores and pace game-thread-bound
+	 *  dispatches while the editor is hitching. Off pins the pool at exactly
+	 *  MaxConcurrentTasks with no dispatch pacing. */
+	bool bAdaptiveConcurrency = true;
+
 	/** Maximum number of tasks to keep in history */
 	int32 MaxHistorySize = 100;
 
@@ -30,6 +37,10 @@ struct FMCPTaskQueueConfig
 
 	/** How often to clean up old tasks (in seconds) */
 	int32 CleanupIntervalSeconds = 60;
+
+	/** How long a completed read-only result may be re-served to an
+	 *  identical resubmission before the work actually re-runs (seconds) */
+	int32 DedupResultTTLSeconds = 30;
 };
 
 /**
@@ -49,7 +60,7 @@ public:
 	FMCPTaskQueue(FMCPToolRegistry* InToolRegistry);
 	virtual ~FMCPTaskQueue();
 
-	/** Start the task queue worker thread */
+	/** Start the task queue worker thread pool */
 	void Start();
 
 	/** Shutdown the task queue and cancel pending tasks (call from main thread) */
@@ -60,9 +71,29 @@ public:
 	 * @param ToolName Name of the tool to execute
 	 * @param Parameters Tool parameters
 	 * @param TimeoutMs Optional timeout (0 = use default)
-	 * @return Task ID for tracking, or invalid GUID on failure
+	 * @param Priority Scheduling priority (High tasks are dispatched first)
+	 * @param bDeferGC Hold off garbage collection while the task runs and
+	 *                 collect once at the end (for batch-type work)
+	 * @param Prerequisites Task IDs that must go terminal before this task is
+	 *                 dispatched. Whole dependent plans can be submitted in
+	 *                 one burst: independent branches run concurrently and
+	 *                 dependents start the instant their prerequisites
+	 *                 complete, instead of the client polling each task to
+	 *                 completion before submitting the next. A prerequisite
+	 *                 that finishes unsuccessfully fails its dependents
+	 *                 (cascading down the graph). Only already-submitted IDs
+	 *                 are accepted, so cycles cannot be expressed.
+	 * @param OutSubmitError Optional; set to a description when submission is
+	 *                 rejected (unknown tool, invalid parameters, capacity)
+	 * @return Task ID for tracking, or invalid GUID on failure (including an
+	 *                 unknown prerequisite ID)
+	 *
+	 * Parameters are validated against the tool's compiled checks here, so
+	 * bad requests fail at submission with a real error instead of when the
+	 * task runs - and execution skips revalidation (the task carries
+	 * bParamsPrevalidated), so validation happens exactly once per call.
 	 */
-	FGuid SubmitTask(const FString& ToolName, TSharedPtr<FJsonObject> Parameters, uint32 TimeoutMs = 0);
+	FGuid SubmitTask(const FString& ToolName, TSharedPtr<FJsonObject> Parameters, uint32 TimeoutMs = 0, EMCPTaskPriority Priority = EMCPTaskPriority::Normal, bool bDeferGC = false, const TArray<FGuid>& Prerequisites = TArray<FGuid>(), FString* OutSubmitError = nullptr);
 
 	/**
 	 * Get the status of a task
@@ -86,6 +117,18 @@ public:
 	 */
 	bool CancelTask(const FGuid& TaskId);
 
+	/**
+	 * Register a callback invoked once when the task reaches a terminal
+	 * state, after its serialized result envelope is built. Fires on the
+	 * calling thread immediately if the task is already terminal, otherwise
+	 * on whichever thread finalizes the task. Backs the /mcp/task/wait
+	 * long-poll so clients get results without a polling loop.
+	 * @param TaskId Task identifier
+	 * @param OnTerminal Callback receiving the finished task
+	 * @return false if the task is unknown (callback is never invoked)
+	 */
+	bool WaitForCompletion(const FGuid& TaskId, TFunction<void(TSharedPtr<FMCPAsyncTask>)> OnTerminal);
+
 	/**
 	 * Get all tasks (for debugging/listing)
 	 * @param bIncludeCompleted Include completed tasks in the list
@@ -98,43 +141,159 @@ public:
 	 */
 	void GetStats(int32& OutPending, int32& OutRunning, int32& OutCompleted) const;
 
+	/** Estimated bytes retained by the task map (memory accounting gauge) */
+	uint64 GetEstimatedMemoryBytes() const;
+
 	/** Configuration */
 	FMCPTaskQueueConfig Config;
 
 protected:
 	// FRunnable interface
+	// Run() is the per-worker loop; the same FRunnable is shared by every
+	// thread in the pool, so everything it touches must be thread-safe.
 	virtual bool Init() override;
 	virtual uint32 Run() override;
 	virtual void Stop() override;
 	virtual void Exit() override;
 
 private:
+	/** Dequeue the next pending, non-cancelled task (nullptr if none) */
+	TSharedPtr<FMCPAsyncTask> DequeueNextTask();
+
 	/** Execute a single task */
 	void ExecuteTask(TSharedPtr<FMCPAsyncTask> Task);
 
-	/** Clean up old completed tasks */
+	/**
+	 * Hold a game-thread-bound dispatch while the editor is hitching.
+	 * Thread-safe tools and High priority tasks pass straight through; the
+	 * rest are paced to one dispatch per interval while the smoothed frame
+	 * time stays over the busy threshold, so queued agent work degrades to
+	 * a trickle instead of stacking executions behind heavy frames.
+	 * Returns when the task should dispatch (including on stop/cancel).
+	 */
+	void ThrottleGameThreadDispatch(const TSharedPtr<FMCPAsyncTask>& Task);
+
+	/**
+	 * Run the task as cooperative game-thread slices if the tool opts in.
+	 * The worker parks until the slicer finishes, so the caller handles the
+	 * returned result exactly like a blocking execution.
+	 * @return true if the task was sliced (OutResult is valid)
+	 */
+	bool TryExecuteSliced(TSharedPtr<FMCPAsyncTask> Task, const TSharedRef<FJsonObject>& Params, FMCPToolResult& OutResult);
+
+	/** Clean up completed tasks whose retention window has expired */
 	void CleanupOldTasks();
 
+	/** Schedule the timeout check for a task that just started running */
+	void ScheduleTimeoutCheck(const TSharedPtr<FMCPAsyncTask>& Task);
+
+	/** Schedule retention cleanup for a task that just went terminal */
+	void ScheduleRetention(const TSharedPtr<FMCPAsyncTask>& Task);
+
+	/** Invoke and clear any completion waiters parked on a task that just
+	 *  went terminal. Call after BuildSerializedResult. */
+	void NotifyCompletionWaiters(const TSharedPtr<FMCPAsyncTask>& Task);
+
+	/**
+	 * Drain the dependents parked on a task that just went terminal: each
+	 * one whose prerequisite count reaches zero is dispatched to the pending
+	 * queues, or failed if any of its prerequisites finished unsuccessfully.
+	 * Call at every terminal transition, after NotifyCompletionWaiters.
+	 */
+	void ReleaseDependents(const TSharedPtr<FMCPAsyncTask>& Task);
+
+	/** Finalize a still-pending task as Failed (terminal bookkeeping,
+	 *  journal, retention, waiters, dependent cascade) */
+	void FailPendingTask(const TSharedPtr<FMCPAsyncTask>& Task, const FString& Message);
+
+	/** Content hash of a submission (tool name + serialized parameters) */
+	static FString ComputeTaskHash(const FString& ToolName, const TSharedPtr<FJsonObject>& Parameters);
+
 	/** Check for timed out tasks */
 	void CheckTimeouts();
 
+	/**
+	 * One scheduled expiry check. Entries are never removed when a task
+	 * finishes early; they validate lazily against the live task when due,
+	 * so a stale entry is just a skipped pop, not a correctness hazard.
+	 */
+	struct FExpiryEntry
+	{
+		FDateTime Due;
+		FGuid TaskId;
+
+		bool operator<(const FExpiryEntry& Other) const { return Due < Other.Due; }
+	};
+
 	/** Tool registry for executing tools (raw pointer - registry outlives queue) */
 	FMCPToolRegistry* ToolRegistry;
 
 	/** All tasks indexed by ID */
 	TMap<FGuid, TSharedPtr<FMCPAsyncTask>> Tasks;
 
-	/** Queue of pending task IDs */
-	TQueue<FGuid> PendingQueue;
+	/** Read-only submissions indexed by content hash, for dedup; entries
+	 *  always point at the most recent task for that hash. Guarded by
+	 *  TasksLock alongside the map they reference. */
+	TMap<FString, FGuid> TaskHashIndex;
+
+	/** Per-priority queues of pending task IDs; FIFO within a priority level.
+	 *  Workers drain High first, then Normal, then Low, so interactive
+	 *  queries are never stuck behind long-running batch work.
+	 *  MPSC mode: submitters enqueue lock-free; DequeueLock makes the
+	 *  worker pool the single consumer. */
+	TQueue<FGuid, EQueueMode::Mpsc> PendingQueues[3];
 
 	/** Currently running task count */
 	TAtomic<int32> RunningTaskCount;
 
-	/** Lock for task map access */
-	mutable FCriticalSection TasksLock;
+	/** Tasks submitted but not yet terminal, for the O(1) capacity check */
+	TAtomic<int32> ActiveTaskCount;
+
+	/** Reader-writer lock for the task map: status polls take read access
+	 *  and never block each other, only map inserts/removals take write */
+	mutable FRWLock TasksLock;
+
+	/** Serializes workers draining the pending queues (submitters and
+	 *  pollers never touch this) */
+	FCriticalSection DequeueLock;
+
+	/** Serializes periodic cleanup/timeout maintenance across workers */
+	FCriticalSection MaintenanceLock;
+
+	/** Min-heaps of pending expiry checks, earliest due first. Maintenance
+	 *  pops only entries that are actually due instead of scanning the full
+	 *  task map, so a large audit history costs nothing per cycle.
+	 *  Guarded by ExpiryLock. */
+	TArray<FExpiryEntry> TimeoutSchedule;
+	TArray<FExpiryEntry> RetentionSchedule;
+
+	/** Guards the expiry schedules (pushed by workers and cancellers,
+	 *  drained by maintenance) */
+	FCriticalSection ExpiryLock;
+
+	/** Long-poll callbacks parked until their task goes terminal; drained by
+	 *  the finalizing thread once the serialized result exists. Guarded by
+	 *  WaitersLock. */
+	TMap<FGuid, TArray<TFunction<void(TSharedPtr<FMCPAsyncTask>)>>> CompletionWaiters;
+
+	/** Guards CompletionWaiters (registration races the finalizing thread) */
+	FCriticalSection WaitersLock;
+
+	/** Dependents parked on each unfinished prerequisite; entries drain when
+	 *  the prerequisite goes terminal. Guarded by DependencyLock. */
+	TMap<FGuid, TArray<FGuid>> DependentsByPrereq;
+
+	/** Guards DependentsByPrereq (registration races the finalizing thread,
+	 *  same protocol as the completion waiters) */
+	FCriticalSection DependencyLock;
+
+	/** Worker thread pool (sized by Config.MaxConcurrentTasks, scaled to
+	 *  cores when adaptive concurrency is on) */
+	TArray<FRunnableThread*> WorkerThreads;
 
-	/** Worker thread */
-	FRunnableThread* WorkerThread;
+	/** Cycles64 timestamp of the last game-thread-bound dispatch made while
+	 *  the game thread was busy; workers pace against it via CAS */
+	TAtomic<uint64> LastBusyDispatchCycles;
 
 	/** Flag to stop the worker */
 	FThreadSafeBool bShouldStop;
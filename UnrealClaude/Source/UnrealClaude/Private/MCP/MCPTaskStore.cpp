@@ -0,0 +1,226 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTaskStore.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "JsonUtils.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+
+FMCPTaskStore& FMCPTaskStore::Get()
+{
+	static FMCPTaskStore Instance;
+	return Instance;
+}
+
+FString FMCPTaskStore::TasksDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("Tasks"));
+}
+
+FString FMCPTaskStore::JournalPath()
+{
+	return FPaths::Combine(TasksDir(), TEXT("task_journal.jsonl"));
+}
+
+FString FMCPTaskStore::ResultPath(const FGuid& TaskId)
+{
+	return FPaths::Combine(TasksDir(), TEXT("Results"), TaskId.ToString() + TEXT(".json"));
+}
+
+void FMCPTaskStore::AppendJournalLine(const TSharedRef<FJsonObject>& Record)
+{
+	const FString Line = FJsonUtils::Stringify(Record) + LINE_TERMINATOR;
+
+	FScopeLock Lock(&StoreLock);
+	IFileManager::Get().MakeDirectory(*TasksDir(), true);
+	FFileHelper::SaveStringToFile(Line, *JournalPath(),
+		FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(),
+		FILEWRITE_Append);
+}
+
+void FMCPTaskStore::RecordSubmitted(const FMCPAsyncTask& Task)
+{
+	TSharedRef<FJsonObject> Record = MakeShared<FJsonObject>();
+	Record->SetStringField(TEXT("event"), TEXT("submitted"));
+	Record->SetStringField(TEXT("task_id"), Task.TaskId.ToString());
+	Record->SetStringField(TEXT("tool_name"), Task.ToolName);
+	Record->SetStringField(TEXT("priority"), FMCPAsyncTask::PriorityToString(Task.Priority));
+	Record->SetStringField(TEXT("submitted_at"), Task.SubmittedTime.ToIso8601());
+	if (Task.Parameters.IsValid())
+	{
+		Record->SetObjectField(TEXT("parameters"), Task.Parameters);
+	}
+
+	AppendJournalLine(Record);
+}
+
+void FMCPTaskStore::RecordTerminal(const FMCPAsyncTask& Task)
+{
+	TSharedRef<FJsonObject> Record = MakeShared<FJsonObject>();
+	Record->SetStringField(TEXT("event"), TEXT("terminal"));
+	Record->SetStringField(TEXT("task_id"), Task.TaskId.ToString());
+	Record->SetStringField(TEXT("status"), FMCPAsyncTask::StatusToString(Task.Status.Load()));
+	Record->SetStringField(TEXT("completed_at"), Task.CompletedTime.ToIso8601());
+
+	AppendJournalLine(Record);
+
+	// Spill the result so task_result can serve it after a restart
+	TSharedRef<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+	ResultJson->SetStringField(TEXT("tool_name"), Task.ToolName);
+	ResultJson->SetStringField(TEXT("status"), FMCPAsyncTask::StatusToString(Task.Status.Load()));
+	ResultJson->SetBoolField(TEXT("success"), Task.Result.bSuccess);
+	ResultJson->SetStringField(TEXT("message"), Task.Result.Message);
+	if (Task.Result.Data.IsValid())
+	{
+		ResultJson->SetObjectField(TEXT("data"), Task.Result.Data);
+	}
+
+	{
+		FScopeLock Lock(&StoreLock);
+		IFileManager::Get().MakeDirectory(*FPaths::Combine(TasksDir(), TEXT("Results")), true);
+		FFileHelper::SaveStringToFile(FJsonUtils::Stringify(ResultJson), *ResultPath(Task.TaskId),
+			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	PruneResultFiles();
+}
+
+bool FMCPTaskStore::LoadResult(const FGuid& TaskId, FMCPToolResult& OutResult) const
+{
+	FString Content;
+	{
+		FScopeLock Lock(&StoreLock);
+		if (!FFileHelper::LoadFileToString(Content, *ResultPath(TaskId)))
+		{
+			return false;
+		}
+	}
+
+	TSharedPtr<FJsonObject> ResultJson = FJsonUtils::Parse(Content);
+	if (!ResultJson.IsValid())
+	{
+		return false;
+	}
+
+	OutResult.bSuccess = false;
+	ResultJson->TryGetBoolField(TEXT("success"), OutResult.bSuccess);
+	ResultJson->TryGetStringField(TEXT("message"), OutResult.Message);
+
+	const TSharedPtr<FJsonObject>* DataObject;
+	if (ResultJson->TryGetObjectField(TEXT("data"), DataObject))
+	{
+		OutResult.Data = *DataObject;
+	}
+
+	return true;
+}
+
+void FMCPTaskStore::RecoverInterruptedTasks(TArray<TSharedPtr<FMCPAsyncTask>>& OutInterrupted)
+{
+	FString JournalContent;
+	{
+		FScopeLock Lock(&StoreLock);
+		if (!FFileHelper::LoadFileToString(JournalContent, *JournalPath()))
+		{
+			return;
+		}
+	}
+
+	TArray<FString> Lines;
+	JournalContent.ParseIntoArrayLines(Lines);
+
+	// Replay: submissions without a matching terminal record were interrupted
+	TMap<FString, TSharedPtr<FJsonObject>> Unfinished;
+	for (const FString& Line : Lines)
+	{
+		TSharedPtr<FJsonObject> Record = FJsonUtils::Parse(Line);
+		if (!Record.IsValid())
+		{
+			continue;
+		}
+
+		FString Event, TaskIdString;
+		Record->TryGetStringField(TEXT("event"), Event);
+		Record->TryGetStringField(TEXT("task_id"), TaskIdString);
+
+		if (Event == TEXT("submitted"))
+		{
+			Unfinished.Add(TaskIdString, Record);
+		}
+		else if (Event == TEXT("terminal"))
+		{
+			Unfinished.Remove(TaskIdString);
+		}
+	}
+
+	for (const auto& Pair : Unfinished)
+	{
+		FGuid TaskId;
+		if (!FGuid::Parse(Pair.Key, TaskId))
+		{
+			continue;
+		}
+
+		TSharedPtr<FMCPAsyncTask> Task = MakeShared<FMCPAsyncTask>();
+		Task->TaskId = TaskId;
+		Pair.Value->TryGetStringField(TEXT("tool_name"), Task->ToolName);
+
+		FString Priority, SubmittedAt;
+		Pair.Value->TryGetStringField(TEXT("priority"), Priority);
+		Task->Priority = FMCPAsyncTask::PriorityFromString(Priority);
+		if (Pair.Value->TryGetStringField(TEXT("submitted_at"), SubmittedAt))
+		{
+			FDateTime::ParseIso8601(*SubmittedAt, Task->SubmittedTime);
+		}
+
+		Task->Status.Store(EMCPTaskStatus::Failed);
+		Task->StartedTime = Task->SubmittedTime;
+		Task->CompletedTime = FDateTime::UtcNow();
+		Task->Result = FMCPToolResult::Error(
+			TEXT("Task was interrupted by an editor restart before completing - resubmit if the work is still needed"));
+
+		OutInterrupted.Add(Task);
+	}
+
+	// Completed results live in their own files; start this session's
+	// journal fresh so replay cost never grows unbounded
+	{
+		FScopeLock Lock(&StoreLock);
+		IFileManager::Get().Delete(*JournalPath(), false, true, true);
+	}
+
+	if (OutInterrupted.Num() > 0)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Task journal replay: %d task(s) from the previous session were interrupted"),
+			OutInterrupted.Num());
+	}
+}
+
+void FMCPTaskStore::PruneResultFiles()
+{
+	FScopeLock Lock(&StoreLock);
+
+	const FString ResultsDir = FPaths::Combine(TasksDir(), TEXT("Results"));
+	TArray<FString> ResultFiles;
+	IFileManager::Get().FindFiles(ResultFiles, *ResultsDir, TEXT("*.json"));
+
+	const int32 Excess = ResultFiles.Num() - UnrealClaudeConstants::MCPServer::MaxPersistedTaskResults;
+	if (Excess <= 0)
+	{
+		return;
+	}
+
+	// Oldest first by modification time
+	ResultFiles.Sort([&ResultsDir](const FString& A, const FString& B)
+	{
+		return IFileManager::Get().GetTimeStamp(*FPaths::Combine(ResultsDir, A))
+			< IFileManager::Get().GetTimeStamp(*FPaths::Combine(ResultsDir, B));
+	});
+
+	for (int32 i = 0; i < Excess; ++i)
+	{
+		IFileManager::Get().Delete(*FPaths::Combine(ResultsDir, ResultFiles[i]), false, true, true);
+	}
+}
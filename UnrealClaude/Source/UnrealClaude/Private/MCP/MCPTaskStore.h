@@ -0,0 +1,74 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPAsyncTask.h"
+
+/**
+ * On-disk persistence for the MCP task queue.
+ *
+ * The queue keeps tasks only in memory, so an editor crash or Live Coding
+ * reload during a long task loses every queued and completed result. The
+ * store keeps a write-ahead journal in Saved/UnrealClaude/Tasks/: every
+ * submission is appended before execution starts and every terminal state
+ * is appended when reached, while completed results spill to one JSON
+ * file per task.
+ *
+ * On queue start the journal is replayed: tasks that were submitted but
+ * never reached a terminal state are surfaced as failed "interrupted"
+ * entries, so agents get an accurate report instead of a vanished task,
+ * and results written by a previous session stay servable through
+ * task_result.
+ *
+ * Append and read paths are lock-guarded; callers may be any worker or
+ * the game thread.
+ */
+class FMCPTaskStore
+{
+public:
+	static FMCPTaskStore& Get();
+
+	/** Journal a task submission (write-ahead: called before execution) */
+	void RecordSubmitted(const FMCPAsyncTask& Task);
+
+	/** Journal a terminal state and spill the result to its own file */
+	void RecordTerminal(const FMCPAsyncTask& Task);
+
+	/**
+	 * Load a spilled result from a previous or current session.
+	 * @param TaskId - Task identifier
+	 * @param OutResult - Receives the persisted result
+	 * @return true if a persisted result exists and parsed
+	 */
+	bool LoadResult(const FGuid& TaskId, FMCPToolResult& OutResult) const;
+
+	/**
+	 * Replay the journal from the previous session. Tasks submitted but
+	 * never completed come back as Failed entries explaining the
+	 * interruption; the journal is then reset for this session.
+	 * @param OutInterrupted - Receives the interrupted task records
+	 */
+	void RecoverInterruptedTasks(TArray<TSharedPtr<FMCPAsyncTask>>& OutInterrupted);
+
+private:
+	FMCPTaskStore() = default;
+
+	/** Saved/UnrealClaude/Tasks */
+	static FString TasksDir();
+
+	/** Append-only journal of submissions and terminal states */
+	static FString JournalPath();
+
+	/** Per-task spilled result file */
+	static FString ResultPath(const FGuid& TaskId);
+
+	/** Append one record to the journal under the store lock */
+	void AppendJournalLine(const TSharedRef<FJsonObject>& Record);
+
+	/** Delete the oldest spilled results beyond the retention cap */
+	void PruneResultFiles();
+
+	/** Guards journal appends and result file pruning */
+	mutable FCriticalSection StoreLock;
+};
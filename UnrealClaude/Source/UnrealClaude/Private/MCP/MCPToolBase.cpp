@@ -62,3 +62,8 @@ void FMCPToolBase::MarkActorDirty(AActor* Actor) const
 		}
 	}
 }
+
+FMCPCancellationToken FMCPToolBase::GetCancellationToken(const TSharedRef<FJsonObject>& Params)
+{
+	return FMCPCancellationRegistry::Get().TokenFor(Params);
+}
@@ -5,11 +5,182 @@
 #include "CoreMinimal.h"
 #include "MCPToolRegistry.h"
 #include "MCPParamValidator.h"
+#include "MCPCancellation.h"
 #include "UnrealClaudeUtils.h"
+#include "Templates/Tuple.h"
 
 // Forward declarations
 class UWorld;
 
+// ===== Compile-Time Typed Tool Definitions =====
+// A tool that declares its scalar parameters as a descriptor table gets the
+// schema and the extraction derived from that single declaration: GetInfo
+// builds its FMCPToolParameter list from the table and Execute fills a typed
+// struct in one pass over the request object, so the schema, the extraction
+// code and the defaults can never drift apart. The descriptors themselves are
+// constexpr-constructible - names, key lengths, member bindings and required
+// flags resolve at compile time - and the only per-call work is the single
+// walk with typed reads straight into struct members. Array/object-valued
+// parameters keep their hand-written schema entries and extraction; the typed
+// layer covers the scalar fields, which is where the duplication (and the
+// repeated keyed lookups) lived.
+
+namespace MCPTypedParam
+{
+	/** JSON schema type name for a field's C++ type */
+	template <typename T> struct TJsonTypeName;
+	template <> struct TJsonTypeName<FString> { static constexpr const TCHAR* Name = TEXT("string"); };
+	template <> struct TJsonTypeName<bool> { static constexpr const TCHAR* Name = TEXT("boolean"); };
+	template <> struct TJsonTypeName<int32> { static constexpr const TCHAR* Name = TEXT("number"); };
+	template <> struct TJsonTypeName<float> { static constexpr const TCHAR* Name = TEXT("number"); };
+	template <> struct TJsonTypeName<double> { static constexpr const TCHAR* Name = TEXT("number"); };
+
+	/** Length of a parameter name literal, computed during constant evaluation */
+	constexpr int32 NameLen(const TCHAR* Name)
+	{
+		int32 Len = 0;
+		while (Name[Len])
+		{
+			++Len;
+		}
+		return Len;
+	}
+
+	/** Typed read of one JSON value into a field destination */
+	inline bool ReadValue(const FJsonValue& Value, FString& Out) { return Value.TryGetString(Out); }
+	inline bool ReadValue(const FJsonValue& Value, bool& Out) { return Value.TryGetBool(Out); }
+	template <typename T>
+	bool ReadValue(const FJsonValue& Value, T& Out)
+	{
+		double Number;
+		if (!Value.TryGetNumber(Number))
+		{
+			return false;
+		}
+		Out = static_cast<T>(Number);
+		return true;
+	}
+
+	/** A required FString counts as missing when empty, matching
+	 *  ExtractRequiredString; other types are satisfied by presence, which
+	 *  the registry's compiled checks (built from this same schema) already
+	 *  enforce before Execute runs */
+	inline bool IsMissingRequired(const FString& Value) { return Value.IsEmpty(); }
+	template <typename T> bool IsMissingRequired(const T&) { return false; }
+}
+
+/**
+ * One field of a typed tool parameter table: binds a JSON parameter name to a
+ * member of the tool's parameter struct, plus the schema metadata for that
+ * parameter. Construct with MCPParamField; fully constant-evaluable.
+ */
+template <typename TStruct, typename TValue>
+struct TMCPParamField
+{
+	using FValueType = TValue;
+
+	const TCHAR* Name;
+	int32 NameLen;
+	TValue TStruct::* Member;
+	const TCHAR* Description;
+	bool bRequired;
+	const TCHAR* DefaultText;
+};
+
+/** Declare one field of a typed parameter table */
+template <typename TStruct, typename TValue>
+constexpr TMCPParamField<TStruct, TValue> MCPParamField(const TCHAR* Name, TValue TStruct::* Member,
+	const TCHAR* Description, bool bRequired = false, const TCHAR* DefaultText = nullptr)
+{
+	return { Name, MCPTypedParam::NameLen(Name), Member, Description, bRequired, DefaultText };
+}
+
+/**
+ * The single declaration a typed tool makes: an ordered table of field
+ * descriptors over its parameter struct. BuildParameterList feeds GetInfo;
+ * Extract fills the struct from a request. Tools hold one as a function-local
+ * static (the table itself stores FString-free descriptors, so construction
+ * is trivial; it cannot be constexpr storage only because TTuple is not).
+ */
+template <typename TStruct, typename... TFields>
+class TMCPParamTable
+{
+public:
+	explicit TMCPParamTable(TFields... InFields)
+		: Fields(InFields...)
+	{
+	}
+
+	/** Build the schema entries for GetInfo from the table */
+	TArray<FMCPToolParameter> BuildParameterList() const
+	{
+		TArray<FMCPToolParameter> Out;
+		Out.Reserve(sizeof...(TFields));
+		VisitTupleElements([&Out](const auto& Field)
+		{
+			using FFieldType = typename TDecay<decltype(Field)>::Type;
+			Out.Emplace(Field.Name, MCPTypedParam::TJsonTypeName<typename FFieldType::FValueType>::Name,
+				Field.Description, Field.bRequired, Field.DefaultText ? Field.DefaultText : TEXT(""));
+		}, Fields);
+		return Out;
+	}
+
+	/**
+	 * Fill the parameter struct in one walk over the request object.
+	 * Same discipline as FMCPToolBase::ExtractFields: length prefilter,
+	 * case-insensitive key compare, typed read into the destination member.
+	 * Absent or wrong-typed fields leave the struct's member initializers in
+	 * place, so defaults live in exactly one spot - the struct declaration.
+	 */
+	bool Extract(const TSharedRef<FJsonObject>& Params, TStruct& Out,
+		TOptional<FMCPToolResult>& OutError) const
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : Params->Values)
+		{
+			if (!Entry.Value.IsValid() || Entry.Value->IsNull())
+			{
+				continue;
+			}
+			VisitTupleElements([&Entry, &Out](const auto& Field)
+			{
+				if (Entry.Key.Len() == Field.NameLen &&
+					FCString::Strnicmp(*Entry.Key, Field.Name, Field.NameLen) == 0)
+				{
+					MCPTypedParam::ReadValue(*Entry.Value, Out.*(Field.Member));
+				}
+			}, Fields);
+		}
+
+		bool bOk = true;
+		VisitTupleElements([&Out, &OutError, &bOk](const auto& Field)
+		{
+			if (bOk && Field.bRequired && MCPTypedParam::IsMissingRequired(Out.*(Field.Member)))
+			{
+				OutError = FMCPToolResult::Error(FString::Printf(TEXT("Missing required parameter: %s"), Field.Name));
+				bOk = false;
+			}
+		}, Fields);
+		return bOk;
+	}
+
+	/** Extract for all-optional tables (no error can occur) */
+	void Extract(const TSharedRef<FJsonObject>& Params, TStruct& Out) const
+	{
+		TOptional<FMCPToolResult> Unused;
+		Extract(Params, Out, Unused);
+	}
+
+private:
+	TTuple<TFields...> Fields;
+};
+
+/** Build a typed parameter table; the struct type is the one explicit argument */
+template <typename TStruct, typename... TFields>
+TMCPParamTable<TStruct, TFields...> MakeMCPParamTable(TFields... InFields)
+{
+	return TMCPParamTable<TStruct, TFields...>(InFields...);
+}
+
 /**
  * Base class for MCP tools that provides common functionality
  * Reduces code duplication across tool implementations
@@ -47,7 +218,21 @@ protected:
 	 */
 	void MarkActorDirty(AActor* Actor) const;
 
+	/**
+	 * Cancellation token for the async task owning this execution, resolved
+	 * from the _task_id the queue injects. Long loops check it at iteration
+	 * boundaries and unwind with partial results. Inert (never cancelled)
+	 * for direct HTTP calls.
+	 */
+	static FMCPCancellationToken GetCancellationToken(const TSharedRef<FJsonObject>& Params);
+
 	// ===== Parameter Extraction Helpers =====
+	// Parameter names are taken as FStringView: call sites pass TEXT
+	// literals without constructing a keying FString per lookup, and the
+	// view-based FJsonObject accessors index the field map directly. The
+	// extracted value itself is copied into the caller's FString exactly
+	// once - that is the storage boundary where ownership leaves the
+	// parsed request document.
 
 	/**
 	 * Extract and validate a required string parameter
@@ -57,12 +242,12 @@ protected:
 	 * @param OutError - Error result if extraction/validation fails
 	 * @return true if extraction succeeded
 	 */
-	bool ExtractRequiredString(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	bool ExtractRequiredString(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		FString& OutValue, TOptional<FMCPToolResult>& OutError) const
 	{
 		if (!Params->TryGetStringField(ParamName, OutValue) || OutValue.IsEmpty())
 		{
-			OutError = FMCPToolResult::Error(FString::Printf(TEXT("Missing required parameter: %s"), *ParamName));
+			OutError = FMCPToolResult::Error(FString::Printf(TEXT("Missing required parameter: %.*s"), ParamName.Len(), ParamName.GetData()));
 			return false;
 		}
 		return true;
@@ -76,7 +261,7 @@ protected:
 	 * @param OutError - Error result if extraction/validation fails
 	 * @return true if extraction and validation succeeded
 	 */
-	bool ExtractActorName(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	bool ExtractActorName(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		FString& OutValue, TOptional<FMCPToolResult>& OutError) const
 	{
 		if (!ExtractRequiredString(Params, ParamName, OutValue, OutError))
@@ -99,7 +284,7 @@ protected:
 	 * @param DefaultValue - Default value if not present
 	 * @return Extracted value or default
 	 */
-	FString ExtractOptionalString(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	FString ExtractOptionalString(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		const FString& DefaultValue = FString()) const
 	{
 		FString Value;
@@ -118,7 +303,7 @@ protected:
 	 * @return Extracted value or default
 	 */
 	template<typename T>
-	T ExtractOptionalNumber(const TSharedRef<FJsonObject>& Params, const FString& ParamName, T DefaultValue) const
+	T ExtractOptionalNumber(const TSharedRef<FJsonObject>& Params, FStringView ParamName, T DefaultValue) const
 	{
 		double Value;
 		if (Params->TryGetNumberField(ParamName, Value))
@@ -135,7 +320,7 @@ protected:
 	 * @param DefaultValue - Default value if not present
 	 * @return Extracted value or default
 	 */
-	bool ExtractOptionalBool(const TSharedRef<FJsonObject>& Params, const FString& ParamName, bool DefaultValue = false) const
+	bool ExtractOptionalBool(const TSharedRef<FJsonObject>& Params, FStringView ParamName, bool DefaultValue = false) const
 	{
 		bool Value;
 		if (Params->TryGetBoolField(ParamName, Value))
@@ -145,6 +330,149 @@ protected:
 		return DefaultValue;
 	}
 
+	// ===== One-Pass Multi-Field Extraction =====
+
+	/**
+	 * Typed destination slot for ExtractFields
+	 *
+	 * Binds a parameter key to an output variable. The key length is
+	 * computed once at slot construction so the match loop rejects most
+	 * non-matching keys on a length compare before touching characters.
+	 * FJsonObject's field map is FString-keyed, so precomputed FName
+	 * handles cannot index it directly; the length prefilter is the part
+	 * of that idea that applies here.
+	 */
+	struct FMCPFieldSlot
+	{
+		enum class EKind : uint8 { String, Float, Int32, Bool };
+
+		const TCHAR* Key;
+		int32 KeyLen;
+		EKind Kind;
+		void* Dest;
+		bool bRequired;
+		bool bFound;
+
+		static FMCPFieldSlot StringField(const TCHAR* InKey, FString& OutValue, bool bInRequired = false)
+		{
+			return { InKey, FCString::Strlen(InKey), EKind::String, &OutValue, bInRequired, false };
+		}
+
+		static FMCPFieldSlot FloatField(const TCHAR* InKey, float& OutValue)
+		{
+			return { InKey, FCString::Strlen(InKey), EKind::Float, &OutValue, false, false };
+		}
+
+		static FMCPFieldSlot Int32Field(const TCHAR* InKey, int32& OutValue)
+		{
+			return { InKey, FCString::Strlen(InKey), EKind::Int32, &OutValue, false, false };
+		}
+
+		static FMCPFieldSlot BoolField(const TCHAR* InKey, bool& OutValue)
+		{
+			return { InKey, FCString::Strlen(InKey), EKind::Bool, &OutValue, false, false };
+		}
+	};
+
+	/**
+	 * Fill a set of typed slots in one walk over the parameter object
+	 *
+	 * The per-field helpers each run a keyed map lookup; operation handlers
+	 * in the complex tools pull half a dozen fields from the same object,
+	 * so the repeated lookups and key hashing add up under agent load. This
+	 * walks Params->Values once and matches each entry against the slot
+	 * table - one pass no matter how many fields an operation extracts.
+	 *
+	 * Absent optional fields leave their slot untouched, so callers
+	 * pre-initialize destinations with their defaults. A required string
+	 * that is missing or empty produces the same error
+	 * ExtractRequiredString reports.
+	 */
+	bool ExtractFields(const TSharedRef<FJsonObject>& Params, TArrayView<FMCPFieldSlot> Slots,
+		TOptional<FMCPToolResult>& OutError) const
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Params->Values)
+		{
+			if (!Field.Value.IsValid())
+			{
+				continue;
+			}
+
+			for (FMCPFieldSlot& Slot : Slots)
+			{
+				if (Slot.bFound || Field.Key.Len() != Slot.KeyLen ||
+					FCString::Strnicmp(*Field.Key, Slot.Key, Slot.KeyLen) != 0)
+				{
+					continue;
+				}
+
+				switch (Slot.Kind)
+				{
+				case FMCPFieldSlot::EKind::String:
+				{
+					FString Value;
+					if (Field.Value->TryGetString(Value))
+					{
+						*static_cast<FString*>(Slot.Dest) = MoveTemp(Value);
+						Slot.bFound = true;
+					}
+					break;
+				}
+				case FMCPFieldSlot::EKind::Float:
+				{
+					double Value;
+					if (Field.Value->TryGetNumber(Value))
+					{
+						*static_cast<float*>(Slot.Dest) = static_cast<float>(Value);
+						Slot.bFound = true;
+					}
+					break;
+				}
+				case FMCPFieldSlot::EKind::Int32:
+				{
+					double Value;
+					if (Field.Value->TryGetNumber(Value))
+					{
+						*static_cast<int32*>(Slot.Dest) = static_cast<int32>(Value);
+						Slot.bFound = true;
+					}
+					break;
+				}
+				case FMCPFieldSlot::EKind::Bool:
+				{
+					bool Value;
+					if (Field.Value->TryGetBool(Value))
+					{
+						*static_cast<bool*>(Slot.Dest) = Value;
+						Slot.bFound = true;
+					}
+					break;
+				}
+				}
+				break;
+			}
+		}
+
+		for (const FMCPFieldSlot& Slot : Slots)
+		{
+			const bool bEmptyRequiredString = Slot.Kind == FMCPFieldSlot::EKind::String &&
+				static_cast<const FString*>(Slot.Dest)->IsEmpty();
+			if (Slot.bRequired && (!Slot.bFound || bEmptyRequiredString))
+			{
+				OutError = FMCPToolResult::Error(FString::Printf(TEXT("Missing required parameter: %s"), Slot.Key));
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** ExtractFields for all-optional slot tables (no error can occur) */
+	void ExtractFields(const TSharedRef<FJsonObject>& Params, TArrayView<FMCPFieldSlot> Slots) const
+	{
+		TOptional<FMCPToolResult> Unused;
+		ExtractFields(Params, Slots, Unused);
+	}
+
 	// ===== Transform Extraction Helpers =====
 	// These consolidate vector/rotator/scale extraction from JSON parameters
 	// to eliminate duplicate code across MCP tools
@@ -157,7 +485,7 @@ protected:
 	 * @param DefaultValue - Default value if not present or invalid
 	 * @return Extracted vector or default
 	 */
-	FVector ExtractVectorParam(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	FVector ExtractVectorParam(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		const FVector& DefaultValue = FVector::ZeroVector) const
 	{
 		const TSharedPtr<FJsonObject>* VectorObj;
@@ -176,7 +504,7 @@ protected:
 	 * @param DefaultValue - Default value if not present or invalid
 	 * @return Extracted rotator or default
 	 */
-	FRotator ExtractRotatorParam(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	FRotator ExtractRotatorParam(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		const FRotator& DefaultValue = FRotator::ZeroRotator) const
 	{
 		const TSharedPtr<FJsonObject>* RotatorObj;
@@ -195,7 +523,7 @@ protected:
 	 * @param DefaultValue - Default value if not present (typically 1,1,1)
 	 * @return Extracted scale or default
 	 */
-	FVector ExtractScaleParam(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	FVector ExtractScaleParam(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		const FVector& DefaultValue = FVector::OneVector) const
 	{
 		return ExtractVectorParam(Params, ParamName, DefaultValue);
@@ -207,7 +535,7 @@ protected:
 	 * @param ParamName - The parameter name to check
 	 * @return true if the parameter exists as an object
 	 */
-	bool HasVectorParam(const TSharedRef<FJsonObject>& Params, const FString& ParamName) const
+	bool HasVectorParam(const TSharedRef<FJsonObject>& Params, FStringView ParamName) const
 	{
 		const TSharedPtr<FJsonObject>* Obj;
 		return Params->TryGetObjectField(ParamName, Obj) && Obj && (*Obj).IsValid();
@@ -222,7 +550,7 @@ protected:
 	 * @param bAdditive - If true, add values to OutVector; if false, replace
 	 * @return true if any component was extracted
 	 */
-	bool ExtractVectorComponents(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	bool ExtractVectorComponents(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		FVector& OutVector, bool bAdditive = false) const
 	{
 		const TSharedPtr<FJsonObject>* VectorObj;
@@ -261,7 +589,7 @@ protected:
 	 * @param bAdditive - If true, add values to OutRotator; if false, replace
 	 * @return true if any component was extracted
 	 */
-	bool ExtractRotatorComponents(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+	bool ExtractRotatorComponents(const TSharedRef<FJsonObject>& Params, FStringView ParamName,
 		FRotator& OutRotator, bool bAdditive = false) const
 	{
 		const TSharedPtr<FJsonObject>* RotatorObj;
@@ -303,7 +631,7 @@ protected:
 	 * @return true if validation passed
 	 */
 	template<typename ValidatorT>
-	bool ValidateParam(const FString& Value, ValidatorT ValidatorFunc, TOptional<FMCPToolResult>& OutError) const
+	bool ValidateParam(FStringView Value, ValidatorT ValidatorFunc, TOptional<FMCPToolResult>& OutError) const
 	{
 		FString ValidationError;
 		if (!ValidatorFunc(Value, ValidationError))
@@ -336,7 +664,7 @@ protected:
 	template<typename ValidatorT>
 	bool ExtractAndValidate(
 		const TSharedRef<FJsonObject>& Params,
-		const FString& ParamName,
+		FStringView ParamName,
 		ValidatorT ValidatorFunc,
 		FString& OutValue,
 		TOptional<FMCPToolResult>& OutError) const
@@ -367,7 +695,7 @@ protected:
 	template<typename ValidatorT>
 	bool ExtractOptionalAndValidate(
 		const TSharedRef<FJsonObject>& Params,
-		const FString& ParamName,
+		FStringView ParamName,
 		ValidatorT ValidatorFunc,
 		const FString& DefaultValue,
 		FString& OutValue,
@@ -396,7 +724,7 @@ protected:
 	 * @param OutError - Optional error result if validation fails
 	 * @return true if valid
 	 */
-	bool ValidateActorNameParam(const FString& ActorName, TOptional<FMCPToolResult>& OutError) const
+	bool ValidateActorNameParam(FStringView ActorName, TOptional<FMCPToolResult>& OutError) const
 	{
 		return ValidateParam(ActorName, FMCPParamValidator::ValidateActorName, OutError);
 	}
@@ -407,7 +735,7 @@ protected:
 	 * @param OutError - Optional error result if validation fails
 	 * @return true if valid
 	 */
-	bool ValidateConsoleCommandParam(const FString& Command, TOptional<FMCPToolResult>& OutError) const
+	bool ValidateConsoleCommandParam(FStringView Command, TOptional<FMCPToolResult>& OutError) const
 	{
 		return ValidateParam(Command, FMCPParamValidator::ValidateConsoleCommand, OutError);
 	}
@@ -418,7 +746,7 @@ protected:
 	 * @param OutError - Optional error result if validation fails
 	 * @return true if valid
 	 */
-	bool ValidatePropertyPathParam(const FString& PropertyPath, TOptional<FMCPToolResult>& OutError) const
+	bool ValidatePropertyPathParam(FStringView PropertyPath, TOptional<FMCPToolResult>& OutError) const
 	{
 		return ValidateParam(PropertyPath, FMCPParamValidator::ValidatePropertyPath, OutError);
 	}
@@ -429,7 +757,7 @@ protected:
 	 * @param OutError - Optional error result if validation fails
 	 * @return true if valid
 	 */
-	bool ValidateBlueprintPathParam(const FString& BlueprintPath, TOptional<FMCPToolResult>& OutError) const
+	bool ValidateBlueprintPathParam(FStringView BlueprintPath, TOptional<FMCPToolResult>& OutError) const
 	{
 		return ValidateParam(BlueprintPath, FMCPParamValidator::ValidateBlueprintPath, OutError);
 	}
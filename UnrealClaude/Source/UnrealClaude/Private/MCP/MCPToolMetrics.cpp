@@ -0,0 +1,131 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPToolMetrics.h"
+
+FMCPToolMetrics& FMCPToolMetrics::Get()
+{
+	static FMCPToolMetrics Instance;
+	return Instance;
+}
+
+FMCPToolMetrics::FToolCounters& FMCPToolMetrics::CountersFor(const FString& ToolName)
+{
+	FScopeLock Lock(&CountersLock);
+	TUniquePtr<FToolCounters>& Entry = Counters.FindOrAdd(ToolName);
+	if (!Entry.IsValid())
+	{
+		Entry = MakeUnique<FToolCounters>();
+	}
+	return *Entry;
+}
+
+void FMCPToolMetrics::RecordExecution(const FString& ToolName, double TotalSeconds, double GameThreadSeconds, bool bSuccess)
+{
+	FToolCounters& ToolCounters = CountersFor(ToolName);
+
+	ToolCounters.Invocations++;
+	if (!bSuccess)
+	{
+		ToolCounters.Failures++;
+	}
+
+	const double TotalMs = TotalSeconds * 1000.0;
+	ToolCounters.TotalMicroseconds += static_cast<uint64>(TotalSeconds * 1000000.0);
+	ToolCounters.GameThreadMicroseconds += static_cast<uint64>(GameThreadSeconds * 1000000.0);
+
+	int32 Bucket = BucketCount - 1;
+	for (int32 i = 0; i < BucketCount - 1; ++i)
+	{
+		if (TotalMs <= BucketBoundsMs[i])
+		{
+			Bucket = i;
+			break;
+		}
+	}
+	ToolCounters.LatencyBuckets[Bucket]++;
+}
+
+void FMCPToolMetrics::RecordTransfer(const FString& ToolName, int64 BytesIn, int64 BytesOut)
+{
+	FToolCounters& ToolCounters = CountersFor(ToolName);
+	ToolCounters.BytesIn += static_cast<uint64>(FMath::Max<int64>(0, BytesIn));
+	ToolCounters.BytesOut += static_cast<uint64>(FMath::Max<int64>(0, BytesOut));
+}
+
+double FMCPToolMetrics::EstimatePercentileMs(const uint64 (&Buckets)[BucketCount], uint64 Total, double Percentile)
+{
+	if (Total == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Total * Percentile)));
+	uint64 Cumulative = 0;
+	for (int32 i = 0; i < BucketCount; ++i)
+	{
+		Cumulative += Buckets[i];
+		if (Cumulative >= Rank)
+		{
+			// Report the bucket's upper bound; the open-ended last bucket
+			// reports its lower bound as a floor
+			return (i < BucketCount - 1) ? BucketBoundsMs[i] : BucketBoundsMs[BucketCount - 2];
+		}
+	}
+	return BucketBoundsMs[BucketCount - 2];
+}
+
+TSharedPtr<FJsonObject> FMCPToolMetrics::ToJson() const
+{
+	TSharedPtr<FJsonObject> ToolsJson = MakeShared<FJsonObject>();
+
+	FScopeLock Lock(&CountersLock);
+	for (const auto& Pair : Counters)
+	{
+		const FToolCounters& ToolCounters = *Pair.Value;
+
+		// Snapshot the buckets once so percentiles and the histogram agree
+		uint64 Buckets[BucketCount];
+		uint64 Total = 0;
+		for (int32 i = 0; i < BucketCount; ++i)
+		{
+			Buckets[i] = ToolCounters.LatencyBuckets[i].Load();
+			Total += Buckets[i];
+		}
+
+		TSharedPtr<FJsonObject> ToolJson = MakeShared<FJsonObject>();
+		ToolJson->SetNumberField(TEXT("invocations"), static_cast<double>(ToolCounters.Invocations.Load()));
+		ToolJson->SetNumberField(TEXT("failures"), static_cast<double>(ToolCounters.Failures.Load()));
+		ToolJson->SetNumberField(TEXT("p50_ms"), EstimatePercentileMs(Buckets, Total, 0.50));
+		ToolJson->SetNumberField(TEXT("p95_ms"), EstimatePercentileMs(Buckets, Total, 0.95));
+		ToolJson->SetNumberField(TEXT("p99_ms"), EstimatePercentileMs(Buckets, Total, 0.99));
+		if (Total > 0)
+		{
+			ToolJson->SetNumberField(TEXT("avg_ms"), ToolCounters.TotalMicroseconds.Load() / 1000.0 / Total);
+		}
+		ToolJson->SetNumberField(TEXT("game_thread_ms_total"), ToolCounters.GameThreadMicroseconds.Load() / 1000.0);
+		ToolJson->SetNumberField(TEXT("bytes_in"), static_cast<double>(ToolCounters.BytesIn.Load()));
+		ToolJson->SetNumberField(TEXT("bytes_out"), static_cast<double>(ToolCounters.BytesOut.Load()));
+
+		TSharedPtr<FJsonObject> HistogramJson = MakeShared<FJsonObject>();
+		for (int32 i = 0; i < BucketCount; ++i)
+		{
+			const FString Key = (i < BucketCount - 1)
+				? FString::Printf(TEXT("le_%g"), BucketBoundsMs[i])
+				: FString(TEXT("le_inf"));
+			HistogramJson->SetNumberField(Key, static_cast<double>(Buckets[i]));
+		}
+		ToolJson->SetObjectField(TEXT("latency_histogram_ms"), HistogramJson);
+
+		ToolsJson->SetObjectField(Pair.Key, ToolJson);
+	}
+
+	TSharedPtr<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetObjectField(TEXT("tools"), ToolsJson);
+	return Report;
+}
+
+void FMCPToolMetrics::Reset()
+{
+	FScopeLock Lock(&CountersLock);
+	Counters.Empty();
+}
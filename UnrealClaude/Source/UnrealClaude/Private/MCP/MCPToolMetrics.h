@@ -0,0 +1,79 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Per-tool execution metrics for the MCP server.
+ *
+ * Operating the plugin across a team needs more than coarse server state:
+ * this accumulates invocation counts, fixed-bucket latency histograms
+ * (from which p50/p95/p99 are derived at report time), game-thread time
+ * consumed, and bytes in/out per tool. Updates are atomic counter bumps
+ * after a one-time per-tool entry lookup, so the recording cost on the
+ * execution hot path is a few uncontended increments.
+ *
+ * Exposed over HTTP via GET /mcp/metrics.
+ */
+class FMCPToolMetrics
+{
+public:
+	/** Upper bounds (ms) of the fixed latency histogram buckets; last is open-ended */
+	static constexpr double BucketBoundsMs[] = { 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000 };
+	static constexpr int32 BucketCount = UE_ARRAY_COUNT(BucketBoundsMs) + 1;
+
+	static FMCPToolMetrics& Get();
+
+	/**
+	 * Record one tool execution.
+	 * @param ToolName - Tool that ran
+	 * @param TotalSeconds - End-to-end latency including dispatch wait
+	 * @param GameThreadSeconds - Time spent executing on the game thread
+	 * @param bSuccess - Whether the tool reported success
+	 */
+	void RecordExecution(const FString& ToolName, double TotalSeconds, double GameThreadSeconds, bool bSuccess);
+
+	/**
+	 * Record request/response payload sizes for one invocation.
+	 * @param ToolName - Tool that ran
+	 * @param BytesIn - Request body size
+	 * @param BytesOut - Response body size
+	 */
+	void RecordTransfer(const FString& ToolName, int64 BytesIn, int64 BytesOut);
+
+	/** Build the full metrics report for the /mcp/metrics route */
+	TSharedPtr<FJsonObject> ToJson() const;
+
+	/** Reset all counters (diagnostics) */
+	void Reset();
+
+private:
+	FMCPToolMetrics() = default;
+
+	/** Atomic counters for one tool; bumped lock-free after entry lookup */
+	struct FToolCounters
+	{
+		TAtomic<uint64> Invocations{0};
+		TAtomic<uint64> Failures{0};
+		TAtomic<uint64> TotalMicroseconds{0};
+		TAtomic<uint64> GameThreadMicroseconds{0};
+		TAtomic<uint64> BytesIn{0};
+		TAtomic<uint64> BytesOut{0};
+		TAtomic<uint64> LatencyBuckets[BucketCount]{};
+	};
+
+	/** Find or create the counter block for a tool */
+	FToolCounters& CountersFor(const FString& ToolName);
+
+	/** Estimate a percentile from the histogram (bucket upper bound) */
+	static double EstimatePercentileMs(const uint64 (&Buckets)[BucketCount], uint64 Total, double Percentile);
+
+	/** Counter blocks per tool; heap-allocated so atomics never relocate */
+	TMap<FString, TUniquePtr<FToolCounters>> Counters;
+
+	/** Guards the map only - counter updates happen outside it */
+	mutable FCriticalSection CountersLock;
+};
@@ -2,8 +2,18 @@
 
 #include "MCPToolRegistry.h"
 #include "MCPTaskQueue.h"
+#include "MCPToolMetrics.h"
+#include "MCPAdmissionController.h"
+#include "MCPMutationJournal.h"
+#include "Editor.h"
+#include "UnrealEdGlobals.h"
+#include "Editor/UnrealEdEngine.h"
+#include "IPackageAutoSaver.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/GarbageCollection.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeConstants.h"
+#include "Misc/CommandLine.h"
 
 // Include all tool implementations
 #include "Tools/MCPTool_SpawnActor.h"
@@ -16,18 +26,25 @@
 #include "Tools/MCPTool_ExecuteScript.h"
 #include "Tools/MCPTool_CleanupScripts.h"
 #include "Tools/MCPTool_GetScriptHistory.h"
+#include "Tools/MCPTool_MutationJournal.h"
 #include "Tools/MCPTool_CaptureViewport.h"
 #include "Tools/MCPTool_BlueprintQuery.h"
 #include "Tools/MCPTool_BlueprintModify.h"
+#include "Tools/MCPTool_BlueprintDiff.h"
 #include "Tools/MCPTool_AnimBlueprintModify.h"
 #include "Tools/MCPTool_AssetSearch.h"
+#include "Tools/MCPTool_AssetWatch.h"
 #include "Tools/MCPTool_AssetDependencies.h"
+#include "Tools/MCPTool_AssetsMetadata.h"
 #include "Tools/MCPTool_AssetReferencers.h"
+#include "Tools/MCPTool_ProjectSymbols.h"
 #include "Tools/MCPTool_EnhancedInput.h"
 #include "Tools/MCPTool_Character.h"
 #include "Tools/MCPTool_CharacterData.h"
 #include "Tools/MCPTool_Material.h"
 #include "Tools/MCPTool_Asset.h"
+#include "Tools/MCPTool_EditSession.h"
+#include "Tools/MCPTool_StressTest.h"
 
 // Task queue tools
 #include "Tools/MCPTool_TaskSubmit.h"
@@ -36,6 +53,65 @@
 #include "Tools/MCPTool_TaskList.h"
 #include "Tools/MCPTool_TaskCancel.h"
 
+namespace
+{
+	/** Map a schema type string to the JSON type it must arrive as */
+	EJson ParamTypeToJsonType(const FString& TypeString)
+	{
+		if (TypeString == TEXT("string"))
+		{
+			return EJson::String;
+		}
+		if (TypeString == TEXT("number") || TypeString == TEXT("integer"))
+		{
+			return EJson::Number;
+		}
+		if (TypeString == TEXT("boolean"))
+		{
+			return EJson::Boolean;
+		}
+		if (TypeString == TEXT("array"))
+		{
+			return EJson::Array;
+		}
+		if (TypeString == TEXT("object"))
+		{
+			return EJson::Object;
+		}
+		// "any" and unknown types accept whatever the client sends
+		return EJson::None;
+	}
+
+	/**
+	 * Push editor autosave out while an edit session is open. Autosave
+	 * serializing dozens of agent-dirtied packages mid-session freezes the
+	 * editor; deferring lets save_modified flush them in one batched pass.
+	 * Game thread only.
+	 */
+	void DeferAutoSaveForEditSession()
+	{
+		if (GUnrealEd)
+		{
+			GUnrealEd->GetPackageAutoSaver().ForceMinimumTimeTillAutoSave(
+				UnrealClaudeConstants::MCPServer::EditSessionAutoSaveDeferSeconds);
+		}
+	}
+
+	/** Human-readable JSON type name for error messages */
+	const TCHAR* JsonTypeToString(EJson Type)
+	{
+		switch (Type)
+		{
+		case EJson::String:  return TEXT("string");
+		case EJson::Number:  return TEXT("number");
+		case EJson::Boolean: return TEXT("boolean");
+		case EJson::Array:   return TEXT("array");
+		case EJson::Object:  return TEXT("object");
+		default:             return TEXT("any");
+		}
+	}
+}
+
 FMCPToolRegistry::FMCPToolRegistry()
 {
 	RegisterBuiltinTools();
@@ -45,6 +121,7 @@ FMCPToolRegistry::~FMCPToolRegistry()
 {
 	StopTaskQueue();
 	Tools.Empty();
+	ToolFactories.Empty();
 }
 
 void FMCPToolRegistry::StartTaskQueue()
@@ -57,76 +134,341 @@ void FMCPToolRegistry::StartTaskQueue()
 
 void FMCPToolRegistry::StopTaskQueue()
 {
+	// A session left open by a disconnected agent must not outlive the server:
+	// an open transaction would swallow every subsequent editor action into it.
+	if (bEditSessionActive)
+	{
+		UE_LOG(LogUnrealClaude, Warning,
+			TEXT("Edit session '%s' still open at shutdown - committing it"), *EditSessionDescription);
+		FString DiscardedError;
+		EndEditSession(DiscardedError);
+	}
+
 	if (TaskQueue.IsValid())
 	{
 		TaskQueue->Shutdown();
 	}
 }
 
+bool FMCPToolRegistry::BeginEditSession(const FString& Description, FString& OutError)
+{
+	if (!IsInGameThread())
+	{
+		OutError = TEXT("Edit sessions can only be opened on the game thread");
+		return false;
+	}
+	if (bEditSessionActive)
+	{
+		OutError = FString::Printf(
+			TEXT("An edit session is already open ('%s'). End or cancel it first."),
+			*EditSessionDescription);
+		return false;
+	}
+	if (!GEditor)
+	{
+		OutError = TEXT("Editor is not available");
+		return false;
+	}
+
+	EditSessionIndex = GEditor->BeginTransaction(
+		TEXT("UnrealClaude"), FText::FromString(Description), nullptr);
+	if (EditSessionIndex == INDEX_NONE)
+	{
+		OutError = TEXT("Failed to open editor transaction");
+		return false;
+	}
+
+	bEditSessionActive = true;
+	EditSessionDescription = Description;
+	EditSessionStartTime = FDateTime::UtcNow();
+	EditSessionCheckpoints.Reset();
+	EditSessionCommittedSegments = 0;
+	NextEditSessionCheckpointId = 1;
+	DeferAutoSaveForEditSession();
+	UE_LOG(LogUnrealClaude, Log, TEXT("Edit session opened: %s"), *Description);
+	return true;
+}
+
+bool FMCPToolRegistry::EndEditSession(FString& OutError)
+{
+	if (!bEditSessionActive)
+	{
+		OutError = TEXT("No edit session is open");
+		return false;
+	}
+	if (!IsInGameThread())
+	{
+		OutError = TEXT("Edit sessions can only be closed on the game thread");
+		return false;
+	}
+
+	if (GEditor)
+	{
+		GEditor->EndTransaction();
+	}
+	UE_LOG(LogUnrealClaude, Log, TEXT("Edit session committed: %s (%d segments)"),
+		*EditSessionDescription, EditSessionCommittedSegments + 1);
+
+	bEditSessionActive = false;
+	EditSessionIndex = INDEX_NONE;
+	EditSessionDescription.Empty();
+	EditSessionCheckpoints.Reset();
+	EditSessionCommittedSegments = 0;
+	return true;
+}
+
+bool FMCPToolRegistry::CancelEditSession(FString& OutError)
+{
+	if (!bEditSessionActive)
+	{
+		OutError = TEXT("No edit session is open");
+		return false;
+	}
+	if (!IsInGameThread())
+	{
+		OutError = TEXT("Edit sessions can only be closed on the game thread");
+		return false;
+	}
+
+	if (GEditor)
+	{
+		GEditor->CancelTransaction(EditSessionIndex);
+
+		// Segments sealed by checkpoints were already committed to the undo
+		// buffer; unwind them too so cancel still rolls back the whole session
+		for (int32 i = 0; i < EditSessionCommittedSegments; ++i)
+		{
+			GEditor->UndoTransaction(/*bCanRedo*/ false);
+		}
+	}
+	UE_LOG(LogUnrealClaude, Log, TEXT("Edit session cancelled: %s (%d segments unwound)"),
+		*EditSessionDescription, EditSessionCommittedSegments + 1);
+
+	bEditSessionActive = false;
+	EditSessionIndex = INDEX_NONE;
+	EditSessionDescription.Empty();
+	EditSessionCheckpoints.Reset();
+	EditSessionCommittedSegments = 0;
+	return true;
+}
+
+bool FMCPToolRegistry::CheckpointEditSession(const FString& Label, int32& OutCheckpointId, FString& OutError)
+{
+	OutCheckpointId = INDEX_NONE;
+	if (!bEditSessionActive)
+	{
+		OutError = TEXT("No edit session is open. Checkpoints only exist inside an open session.");
+		return false;
+	}
+	if (!IsInGameThread())
+	{
+		OutError = TEXT("Checkpoints can only be taken on the game thread");
+		return false;
+	}
+	if (EditSessionCheckpoints.Num() >= UnrealClaudeConstants::MCPServer::MaxEditSessionCheckpoints)
+	{
+		OutError = FString::Printf(TEXT("Checkpoint limit reached (%d). Roll back or end the session."),
+			UnrealClaudeConstants::MCPServer::MaxEditSessionCheckpoints);
+		return false;
+	}
+	if (!GEditor)
+	{
+		OutError = TEXT("Editor is not available");
+		return false;
+	}
+
+	// Seal the current segment and open the next one. The transaction system
+	// already snapshotted every object the sealed segment touched, so the
+	// checkpoint costs two transaction calls and no extra serialization.
+	GEditor->EndTransaction();
+	EditSessionCommittedSegments++;
+
+	EditSessionIndex = GEditor->BeginTransaction(
+		TEXT("UnrealClaude"), FText::FromString(EditSessionDescription), nullptr);
+	if (EditSessionIndex == INDEX_NONE)
+	{
+		// The sealed segments stand as ordinary undo entries; the session
+		// cannot continue without an open transaction to record into.
+		bEditSessionActive = false;
+		EditSessionDescription.Empty();
+		EditSessionCheckpoints.Reset();
+		EditSessionCommittedSegments = 0;
+		OutError = TEXT("Failed to reopen the session transaction; the session has been closed");
+		return false;
+	}
+
+	FMCPEditSessionCheckpoint& Checkpoint = EditSessionCheckpoints.AddDefaulted_GetRef();
+	Checkpoint.Id = NextEditSessionCheckpointId++;
+	Checkpoint.Label = Label;
+	Checkpoint.CreatedAt = FDateTime::UtcNow();
+	Checkpoint.CommittedSegments = EditSessionCommittedSegments;
+
+	OutCheckpointId = Checkpoint.Id;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Edit session checkpoint %d taken: %s"),
+		Checkpoint.Id, Label.IsEmpty() ? TEXT("(unlabelled)") : *Label);
+	return true;
+}
+
+bool FMCPToolRegistry::RollbackEditSession(int32 CheckpointId, FString& OutError)
+{
+	if (!bEditSessionActive)
+	{
+		OutError = TEXT("No edit session is open");
+		return false;
+	}
+	if (!IsInGameThread())
+	{
+		OutError = TEXT("Rollback can only run on the game thread");
+		return false;
+	}
+	if (EditSessionCheckpoints.Num() == 0)
+	{
+		OutError = TEXT("No checkpoints have been taken in this session. Use 'cancel' to roll back the whole session.");
+		return false;
+	}
+	if (!GEditor)
+	{
+		OutError = TEXT("Editor is not available");
+		return false;
+	}
+
+	// INDEX_NONE means the most recent checkpoint
+	int32 TargetIndex = EditSessionCheckpoints.Num() - 1;
+	if (CheckpointId != INDEX_NONE)
+	{
+		TargetIndex = EditSessionCheckpoints.IndexOfByPredicate(
+			[CheckpointId](const FMCPEditSessionCheckpoint& Checkpoint)
+			{
+				return Checkpoint.Id == CheckpointId;
+			});
+		if (TargetIndex == INDEX_NONE)
+		{
+			OutError = FString::Printf(TEXT("Unknown checkpoint id %d"), CheckpointId);
+			return false;
+		}
+	}
+	const FMCPEditSessionCheckpoint Target = EditSessionCheckpoints[TargetIndex];
+
+	// One pass: discard the uncommitted segment, then undo every segment
+	// sealed after the checkpoint. The session stays open on a fresh segment.
+	GEditor->CancelTransaction(EditSessionIndex);
+
+	const int32 SegmentsToUndo = EditSessionCommittedSegments - Target.CommittedSegments;
+	for (int32 i = 0; i < SegmentsToUndo; ++i)
+	{
+		GEditor->UndoTransaction(/*bCanRedo*/ false);
+	}
+	EditSessionCommittedSegments = Target.CommittedSegments;
+
+	// The target survives for repeated rollback; anything after it is gone
+	EditSessionCheckpoints.SetNum(TargetIndex + 1);
+
+	EditSessionIndex = GEditor->BeginTransaction(
+		TEXT("UnrealClaude"), FText::FromString(EditSessionDescription), nullptr);
+	if (EditSessionIndex == INDEX_NONE)
+	{
+		bEditSessionActive = false;
+		EditSessionDescription.Empty();
+		EditSessionCheckpoints.Reset();
+		EditSessionCommittedSegments = 0;
+		OutError = TEXT("Rolled back, but failed to reopen the session transaction; the session has been closed");
+		return false;
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Edit session rolled back to checkpoint %d (%d segments undone)"),
+		Target.Id, SegmentsToUndo);
+	return true;
+}
+
 void FMCPToolRegistry::RegisterBuiltinTools()
 {
-	UE_LOG(LogUnrealClaude, Log, TEXT("Registering MCP tools..."));
+	UE_LOG(LogUnrealClaude, Log, TEXT("Registering MCP tool descriptors..."));
 
-	// Register all built-in tools
-	RegisterTool(MakeShared<FMCPTool_SpawnActor>());
-	RegisterTool(MakeShared<FMCPTool_GetLevelActors>());
-	RegisterTool(MakeShared<FMCPTool_SetProperty>());
-	RegisterTool(MakeShared<FMCPTool_RunConsoleCommand>());
-	RegisterTool(MakeShared<FMCPTool_DeleteActors>());
-	RegisterTool(MakeShared<FMCPTool_MoveActor>());
-	RegisterTool(MakeShared<FMCPTool_GetOutputLog>());
+	// Create the async task queue up front - tool factories capture the
+	// registry and read it at construction time.
+	// Task queue takes a raw pointer since the registry always outlives it
+	TaskQueue = MakeShared<FMCPTaskQueue>(this);
 
-	// Script execution tools
-	RegisterTool(MakeShared<FMCPTool_ExecuteScript>());
-	RegisterTool(MakeShared<FMCPTool_CleanupScripts>());
-	RegisterTool(MakeShared<FMCPTool_GetScriptHistory>());
+	// Tools register as name + factory and are constructed on first use, so
+	// module startup pays for no tool constructions or schema compiles. The
+	// server pre-warms the hot set once the editor is interactive; the long
+	// tail of rarely-used tools may never be constructed at all.
+	RegisterToolFactory(TEXT("spawn_actor"), [] { return MakeShared<FMCPTool_SpawnActor>(); });
+	RegisterToolFactory(TEXT("get_level_actors"), [] { return MakeShared<FMCPTool_GetLevelActors>(); });
+	RegisterToolFactory(TEXT("set_property"), [] { return MakeShared<FMCPTool_SetProperty>(); });
+	RegisterToolFactory(TEXT("run_console_command"), [] { return MakeShared<FMCPTool_RunConsoleCommand>(); });
+	RegisterToolFactory(TEXT("delete_actors"), [] { return MakeShared<FMCPTool_DeleteActors>(); });
+	RegisterToolFactory(TEXT("move_actor"), [] { return MakeShared<FMCPTool_MoveActor>(); });
+	RegisterToolFactory(TEXT("get_output_log"), [] { return MakeShared<FMCPTool_GetOutputLog>(); });
+
+	// Script execution tools. execute_script is wired to the task queue so
+	// script execution can go async and handle permission dialogs without
+	// timing out.
+	RegisterToolFactory(TEXT("execute_script"), [this]
+	{
+		TSharedRef<FMCPTool_ExecuteScript> Tool = MakeShared<FMCPTool_ExecuteScript>();
+		Tool->SetTaskQueue(TaskQueue);
+		return Tool;
+	});
+	RegisterToolFactory(TEXT("cleanup_scripts"), [] { return MakeShared<FMCPTool_CleanupScripts>(); });
+	RegisterToolFactory(TEXT("get_script_history"), [] { return MakeShared<FMCPTool_GetScriptHistory>(); });
+	RegisterToolFactory(TEXT("get_mutation_journal"), [] { return MakeShared<FMCPTool_MutationJournal>(); });
 
 	// Viewport capture
-	RegisterTool(MakeShared<FMCPTool_CaptureViewport>());
+	RegisterToolFactory(TEXT("capture_viewport"), [] { return MakeShared<FMCPTool_CaptureViewport>(); });
 
 	// Blueprint tools
-	RegisterTool(MakeShared<FMCPTool_BlueprintQuery>());
-	RegisterTool(MakeShared<FMCPTool_BlueprintModify>());
-	RegisterTool(MakeShared<FMCPTool_AnimBlueprintModify>());
+	RegisterToolFactory(TEXT("blueprint_query"), [] { return MakeShared<FMCPTool_BlueprintQuery>(); });
+	RegisterToolFactory(TEXT("blueprint_modify"), [] { return MakeShared<FMCPTool_BlueprintModify>(); });
+	RegisterToolFactory(TEXT("blueprint_diff"), [] { return MakeShared<FMCPTool_BlueprintDiff>(); });
+	RegisterToolFactory(TEXT("anim_blueprint_modify"), [] { return MakeShared<FMCPTool_AnimBlueprintModify>(); });
 
 	// Asset tools
-	RegisterTool(MakeShared<FMCPTool_AssetSearch>());
-	RegisterTool(MakeShared<FMCPTool_AssetDependencies>());
-	RegisterTool(MakeShared<FMCPTool_AssetReferencers>());
+	RegisterToolFactory(TEXT("asset_search"), [] { return MakeShared<FMCPTool_AssetSearch>(); });
+	RegisterToolFactory(TEXT("asset_watch"), [] { return MakeShared<FMCPTool_AssetWatch>(); });
+	// Wired to the task queue so transitive walks can stream edges into the
+	// owning task and observe its cancellation
+	RegisterToolFactory(TEXT("asset_dependencies"), [this]
+	{
+		TSharedRef<FMCPTool_AssetDependencies> Tool = MakeShared<FMCPTool_AssetDependencies>();
+		Tool->SetTaskQueue(TaskQueue);
+		return Tool;
+	});
+	RegisterToolFactory(TEXT("asset_referencers"), [] { return MakeShared<FMCPTool_AssetReferencers>(); });
+	RegisterToolFactory(TEXT("get_assets_metadata"), [] { return MakeShared<FMCPTool_AssetsMetadata>(); });
+
+	// Project index tools
+	RegisterToolFactory(TEXT("project_symbols"), [] { return MakeShared<FMCPTool_ProjectSymbols>(); });
 
 	// Enhanced Input tools
-	RegisterTool(MakeShared<FMCPTool_EnhancedInput>());
+	RegisterToolFactory(TEXT("enhanced_input"), [] { return MakeShared<FMCPTool_EnhancedInput>(); });
 
 	// Character tools
-	RegisterTool(MakeShared<FMCPTool_Character>());
-	RegisterTool(MakeShared<FMCPTool_CharacterData>());
+	RegisterToolFactory(TEXT("character"), [] { return MakeShared<FMCPTool_Character>(); });
+	RegisterToolFactory(TEXT("character_data"), [] { return MakeShared<FMCPTool_CharacterData>(); });
 
 	// Material and Asset tools
-	RegisterTool(MakeShared<FMCPTool_Material>());
-	RegisterTool(MakeShared<FMCPTool_Asset>());
-
-	// Create and register async task queue tools
-	// Task queue takes a raw pointer since the registry always outlives it
-	TaskQueue = MakeShared<FMCPTaskQueue>(this);
-
-	// Wire up execute_script to use the task queue for async execution
-	// This allows script execution to handle permission dialogs without timing out
-	if (TSharedPtr<IMCPTool>* ExecuteScriptToolPtr = Tools.Find(TEXT("execute_script")))
+	RegisterToolFactory(TEXT("material"), [] { return MakeShared<FMCPTool_Material>(); });
+	RegisterToolFactory(TEXT("asset"), [] { return MakeShared<FMCPTool_Asset>(); });
+
+	// Session-scoped transactions
+	RegisterToolFactory(TEXT("edit_session"), [this] { return MakeShared<FMCPTool_EditSession>(this); });
+
+	// Async task queue tools
+	RegisterToolFactory(TEXT("task_submit"), [this] { return MakeShared<FMCPTool_TaskSubmit>(TaskQueue); });
+	RegisterToolFactory(TEXT("task_status"), [this] { return MakeShared<FMCPTool_TaskStatus>(TaskQueue); });
+	RegisterToolFactory(TEXT("task_result"), [this] { return MakeShared<FMCPTool_TaskResult>(TaskQueue); });
+	RegisterToolFactory(TEXT("task_list"), [this] { return MakeShared<FMCPTool_TaskList>(TaskQueue); });
+	RegisterToolFactory(TEXT("task_cancel"), [this] { return MakeShared<FMCPTool_TaskCancel>(TaskQueue); });
+
+	// Capacity-testing load generator: opt-in via launch flag so a
+	// production editor never exposes a way to saturate itself
+	if (FParse::Param(FCommandLine::Get(), TEXT("UnrealClaudeStressTool")))
 	{
-		if (FMCPTool_ExecuteScript* ExecuteScriptTool = static_cast<FMCPTool_ExecuteScript*>(ExecuteScriptToolPtr->Get()))
-		{
-			ExecuteScriptTool->SetTaskQueue(TaskQueue);
-			UE_LOG(LogUnrealClaude, Log, TEXT("  Wired up execute_script to task queue for async execution"));
-		}
+		RegisterToolFactory(TEXT("stress_test"), [this] { return MakeShared<FMCPTool_StressTest>(this); });
 	}
 
-	RegisterTool(MakeShared<FMCPTool_TaskSubmit>(TaskQueue));
-	RegisterTool(MakeShared<FMCPTool_TaskStatus>(TaskQueue));
-	RegisterTool(MakeShared<FMCPTool_TaskResult>(TaskQueue));
-	RegisterTool(MakeShared<FMCPTool_TaskList>(TaskQueue));
-	RegisterTool(MakeShared<FMCPTool_TaskCancel>(TaskQueue));
-
-	UE_LOG(LogUnrealClaude, Log, TEXT("Registered %d MCP tools"), Tools.Num());
+	UE_LOG(LogUnrealClaude, Log, TEXT("Registered %d MCP tool descriptors"), ToolFactories.Num());
 }
 
 void FMCPToolRegistry::RegisterTool(TSharedPtr<IMCPTool> Tool)
@@ -143,24 +485,185 @@ void FMCPToolRegistry::RegisterTool(TSharedPtr<IMCPTool> Tool)
 		return;
 	}
 
-	if (Tools.Contains(Info.Name))
+	FScopeLock Lock(&LazyToolsLock);
+
+	if (Tools.Contains(Info.Name) || ToolFactories.Contains(Info.Name))
 	{
 		UE_LOG(LogUnrealClaude, Warning, TEXT("Tool '%s' is already registered, replacing"), *Info.Name);
+		ToolFactories.Remove(Info.Name);
 	}
 
+	// Compile the schema into a flat check list once; ExecuteTool runs it
+	// per request without touching the schema again
+	TArray<FMCPCompiledParamCheck>& Checks = CompiledParamChecks.FindOrAdd(Info.Name);
+	Checks.Reset();
+	Checks.Reserve(Info.Parameters.Num());
+	for (const FMCPToolParameter& Param : Info.Parameters)
+	{
+		FMCPCompiledParamCheck Check;
+		Check.Name = Param.Name;
+		Check.ExpectedType = ParamTypeToJsonType(Param.Type);
+		Check.bRequired = Param.bRequired;
+		Checks.Add(MoveTemp(Check));
+	}
+
+	ToolReadOnlyHints.Add(Info.Name, Info.Annotations.bReadOnlyHint);
+
 	Tools.Add(Info.Name, Tool);
 	UE_LOG(LogUnrealClaude, Log, TEXT("  Registered tool: %s"), *Info.Name);
 }
 
+void FMCPToolRegistry::RegisterToolFactory(const FString& ToolName, TFunction<TSharedPtr<IMCPTool>()> Factory)
+{
+	if (ToolName.IsEmpty() || !Factory)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Cannot register tool descriptor without name and factory"));
+		return;
+	}
+
+	FScopeLock Lock(&LazyToolsLock);
+
+	if (Tools.Contains(ToolName) || ToolFactories.Contains(ToolName))
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Tool '%s' is already registered, replacing"), *ToolName);
+		Tools.Remove(ToolName);
+		CompiledParamChecks.Remove(ToolName);
+	}
+
+	ToolFactories.Add(ToolName, MoveTemp(Factory));
+}
+
+TSharedPtr<IMCPTool> FMCPToolRegistry::MaterializeTool(const FString& ToolName) const
+{
+	FScopeLock Lock(&LazyToolsLock);
+
+	if (const TSharedPtr<IMCPTool>* Found = Tools.Find(ToolName))
+	{
+		return *Found;
+	}
+
+	TFunction<TSharedPtr<IMCPTool>()> Factory;
+	if (!ToolFactories.RemoveAndCopyValue(ToolName, Factory))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<IMCPTool> Tool = Factory();
+	if (!Tool.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Tool factory for '%s' returned null"), *ToolName);
+		return nullptr;
+	}
+
+	const FMCPToolInfo Info = Tool->GetInfo();
+	if (Info.Name != ToolName)
+	{
+		// The descriptor name is what clients dispatch on - a mismatch means
+		// the registration line is wrong, not the tool
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Tool descriptor '%s' constructed a tool named '%s'"),
+			*ToolName, *Info.Name);
+	}
+
+	// Compile the schema into a flat check list once; ExecuteTool runs it
+	// per request without touching the schema again
+	TArray<FMCPCompiledParamCheck>& Checks = CompiledParamChecks.FindOrAdd(ToolName);
+	Checks.Reset();
+	Checks.Reserve(Info.Parameters.Num());
+	for (const FMCPToolParameter& Param : Info.Parameters)
+	{
+		FMCPCompiledParamCheck Check;
+		Check.Name = Param.Name;
+		Check.ExpectedType = ParamTypeToJsonType(Param.Type);
+		Check.bRequired = Param.bRequired;
+		Checks.Add(MoveTemp(Check));
+	}
+
+	ToolReadOnlyHints.Add(ToolName, Info.Annotations.bReadOnlyHint);
+
+	Tools.Add(ToolName, Tool);
+	UE_LOG(LogUnrealClaude, Verbose, TEXT("  Constructed tool on first use: %s"), *ToolName);
+	return Tool;
+}
+
+IMCPTool* FMCPToolRegistry::FindTool(const FString& ToolName) const
+{
+	// Raw pointer stays valid: the materialized instance is owned by the
+	// Tools map and tools are never removed at runtime
+	return MaterializeTool(ToolName).Get();
+}
+
+IMCPTool* FMCPToolRegistry::FindToolByPathSegment(FStringView ToolName) const
+{
+	{
+		FScopeLock Lock(&LazyToolsLock);
+		// GetTypeHash(FStringView) hashes the same characters the same way as
+		// GetTypeHash(FString), so the view probes the FString-keyed map
+		// directly without constructing a key
+		if (const TSharedPtr<IMCPTool>* Found = Tools.FindByHash(GetTypeHash(ToolName), ToolName))
+		{
+			return Found->Get();
+		}
+	}
+
+	// Cold path: the first use of a descriptor-registered tool pays for the
+	// key string once; every later request resolves through the probe above
+	return MaterializeTool(FString(ToolName)).Get();
+}
+
+void FMCPToolRegistry::PreWarmTools(const TArray<FString>& ToolNames)
+{
+	int32 WarmedCount = 0;
+	for (const FString& ToolName : ToolNames)
+	{
+		if (MaterializeTool(ToolName).IsValid())
+		{
+			WarmedCount++;
+		}
+	}
+	UE_LOG(LogUnrealClaude, Log, TEXT("Pre-warmed %d MCP tools"), WarmedCount);
+}
+
 void FMCPToolRegistry::UnregisterTool(const FString& ToolName)
 {
-	if (Tools.Remove(ToolName) > 0)
+	FScopeLock Lock(&LazyToolsLock);
+	if (Tools.Remove(ToolName) + ToolFactories.Remove(ToolName) > 0)
 	{
+		CompiledParamChecks.Remove(ToolName);
+		ToolReadOnlyHints.Remove(ToolName);
 		InvalidateToolCache();
 		UE_LOG(LogUnrealClaude, Log, TEXT("Unregistered tool: %s"), *ToolName);
 	}
 }
 
+bool FMCPToolRegistry::ValidateAgainstCompiledChecks(
+	const TArray<FMCPCompiledParamCheck>& Checks,
+	const TSharedRef<FJsonObject>& Params,
+	FString& OutError)
+{
+	for (const FMCPCompiledParamCheck& Check : Checks)
+	{
+		const TSharedPtr<FJsonValue> Value = Params->TryGetField(Check.Name);
+		if (!Value.IsValid() || Value->IsNull())
+		{
+			if (Check.bRequired)
+			{
+				OutError = FString::Printf(TEXT("Missing required parameter: %s"), *Check.Name);
+				return false;
+			}
+			continue;
+		}
+
+		if (Check.ExpectedType != EJson::None && Value->Type != Check.ExpectedType)
+		{
+			OutError = FString::Printf(TEXT("Parameter '%s' must be a %s (got %s)"),
+				*Check.Name, JsonTypeToString(Check.ExpectedType), JsonTypeToString(Value->Type));
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void FMCPToolRegistry::InvalidateToolCache()
 {
 	bCacheValid = false;
@@ -175,7 +678,22 @@ TArray<FMCPToolInfo> FMCPToolRegistry::GetAllTools() const
 		return CachedToolInfo;
 	}
 
+	// The full manifest needs every schema, so any remaining descriptors are
+	// materialized here - this is the one path that forces the long tail,
+	// and it runs deferred (first /mcp/tools request or the pre-warm tick),
+	// never during module startup
+	TArray<FString> PendingNames;
+	{
+		FScopeLock Lock(&LazyToolsLock);
+		ToolFactories.GetKeys(PendingNames);
+	}
+	for (const FString& PendingName : PendingNames)
+	{
+		MaterializeTool(PendingName);
+	}
+
 	// Rebuild cache
+	FScopeLock Lock(&LazyToolsLock);
 	CachedToolInfo.Empty(Tools.Num());
 	for (const auto& Pair : Tools)
 	{
@@ -189,22 +707,147 @@ TArray<FMCPToolInfo> FMCPToolRegistry::GetAllTools() const
 	return CachedToolInfo;
 }
 
-FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSharedRef<FJsonObject>& Params)
+bool FMCPToolRegistry::ValidateToolParams(const FString& ToolName, const TSharedRef<FJsonObject>& Params,
+	FString& OutError) const
+{
+	// Materialize first so descriptor-registered tools have compiled checks
+	if (!MaterializeTool(ToolName).IsValid())
+	{
+		OutError = FString::Printf(TEXT("Tool '%s' not found"), *ToolName);
+		return false;
+	}
+
+	FScopeLock Lock(&LazyToolsLock);
+	if (const TArray<FMCPCompiledParamCheck>* Checks = CompiledParamChecks.Find(ToolName))
+	{
+		return ValidateAgainstCompiledChecks(*Checks, Params, OutError);
+	}
+	return true;
+}
+
+bool FMCPToolRegistry::IsToolReadOnly(const FString& ToolName) const
 {
-	TSharedPtr<IMCPTool>* FoundTool = Tools.Find(ToolName);
-	if (!FoundTool || !FoundTool->IsValid())
+	if (!MaterializeTool(ToolName).IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&LazyToolsLock);
+	const bool* bReadOnly = ToolReadOnlyHints.Find(ToolName);
+	return bReadOnly && *bReadOnly;
+}
+
+bool FMCPToolRegistry::IsToolThreadSafe(const FString& ToolName) const
+{
+	TSharedPtr<IMCPTool> Tool = MaterializeTool(ToolName);
+	return Tool.IsValid() && Tool->IsThreadSafe();
+}
+
+FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSharedRef<FJsonObject>& Params,
+	bool bParamsPrevalidated)
+{
+	// Dispatch + validation overhead shows up under this scope in Insights;
+	// the tool's own work is tagged separately with its name below
+	TRACE_CPUPROFILER_EVENT_SCOPE(FMCPToolRegistry::ExecuteTool);
+
+	// Materializes the tool from its descriptor on first use; holding the
+	// shared pointer (not a map-interior pointer) keeps it valid across any
+	// concurrent materialization rehashing the map
+	TSharedPtr<IMCPTool> FoundTool = MaterializeTool(ToolName);
+	if (!FoundTool.IsValid())
 	{
 		return FMCPToolResult::Error(FString::Printf(TEXT("Tool '%s' not found"), *ToolName));
 	}
 
+	// Flat pass over the checks compiled at construction - bad requests are
+	// rejected here without paying the game thread dispatch below. Under the
+	// lock because a concurrent materialization can reallocate the map.
+	// Skipped for async tasks that validated at submission.
+	if (!bParamsPrevalidated)
+	{
+		FScopeLock Lock(&LazyToolsLock);
+		if (const TArray<FMCPCompiledParamCheck>* Checks = CompiledParamChecks.Find(ToolName))
+		{
+			FString ValidationError;
+			if (!ValidateAgainstCompiledChecks(*Checks, Params, ValidationError))
+			{
+				return FMCPToolResult::Error(ValidationError);
+			}
+		}
+	}
+
 	UE_LOG(LogUnrealClaude, Log, TEXT("Executing MCP tool: %s"), *ToolName);
 
+	// Write-ahead journal: record mutating invocations to disk before they
+	// run, and mark them on completion. After a crash the journal tail tells
+	// a restarted agent which operations were applied. An entry that never
+	// gets its completion marker (crash, timeout below) is exactly the
+	// "possibly half-applied" case recovery has to inspect.
+	uint64 JournalSequence = 0;
+	{
+		FScopeLock Lock(&LazyToolsLock);
+		const bool* bReadOnly = ToolReadOnlyHints.Find(ToolName);
+		if (!bReadOnly || !*bReadOnly)
+		{
+			JournalSequence = FMCPMutationJournal::Get().LogInvocation(ToolName, Params);
+		}
+	}
+
+	// Metrics: end-to-end latency includes any dispatch wait below;
+	// game-thread time is measured around the Execute call itself
+	const double ExecStartSeconds = FPlatformTime::Seconds();
+	TSharedPtr<double> GameThreadSeconds = MakeShared<double>(0.0);
+
+	// When this call runs on behalf of an async task, the game-thread span is
+	// also charged to that task (cycle counters, accumulated on the task), so
+	// task_status can show which tools actually steal frame time instead of
+	// one wall duration that lumps queue wait with execution
+	TSharedPtr<FMCPAsyncTask> OwnerTask;
+	{
+		FString TaskIdString;
+		FGuid OwnerTaskId;
+		if (TaskQueue.IsValid() &&
+			Params->TryGetStringField(TEXT("_task_id"), TaskIdString) &&
+			FGuid::Parse(TaskIdString, OwnerTaskId))
+		{
+			OwnerTask = TaskQueue->GetTask(OwnerTaskId);
+		}
+	}
+
 	// Execute on game thread to ensure safe access to engine objects
 	FMCPToolResult Result;
 
+	// Captured by value: the deferred lambda below must not touch the registry
+	const bool bDeferAutoSave = bEditSessionActive;
+
 	if (IsInGameThread())
 	{
-		Result = (*FoundTool)->Execute(Params);
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("MCPTool %s (%d params)"), *ToolName, Params->Values.Num()));
+		if (bDeferAutoSave)
+		{
+			DeferAutoSaveForEditSession();
+		}
+		if (OwnerTask.IsValid())
+		{
+			OwnerTask->MarkGameThreadEntered();
+		}
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Result = FoundTool->Execute(Params);
+		*GameThreadSeconds = FPlatformTime::Seconds() - ExecStartSeconds;
+		if (OwnerTask.IsValid())
+		{
+			OwnerTask->AddGameThreadCycles(FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+	else if (FoundTool->IsThreadSafe())
+	{
+		// Thread-safe tools run right here on the HTTP thread; under burst
+		// read loads this keeps query traffic off the frame entirely. The GC
+		// guard keeps garbage collection from tearing down objects (classes
+		// resolved via FindObject, asset data) mid-query.
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("MCPTool %s (%d params)"), *ToolName, Params->Values.Num()));
+		FGCScopeGuard GCGuard;
+		Result = FoundTool->Execute(Params);
 	}
 	else
 	{
@@ -216,20 +859,44 @@ FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSha
 		TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> bTaskCompleted = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
 
 		// Capture shared pointers by value so lambda keeps them alive
-		AsyncTask(ENamedThreads::GameThread, [SharedResult, FoundTool, Params, CompletionEvent, bTaskCompleted]()
+		AsyncTask(ENamedThreads::GameThread, [SharedResult, FoundTool, Params, CompletionEvent, bTaskCompleted, GameThreadSeconds, ToolName, bDeferAutoSave, OwnerTask]()
 		{
-			*SharedResult = (*FoundTool)->Execute(Params);
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("MCPTool %s (%d params)"), *ToolName, Params->Values.Num()));
+			if (bDeferAutoSave)
+			{
+				DeferAutoSaveForEditSession();
+			}
+			if (OwnerTask.IsValid())
+			{
+				OwnerTask->MarkGameThreadEntered();
+			}
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const double GameThreadStart = FPlatformTime::Seconds();
+			*SharedResult = FoundTool->Execute(Params);
+			*GameThreadSeconds = FPlatformTime::Seconds() - GameThreadStart;
+			if (OwnerTask.IsValid())
+			{
+				OwnerTask->AddGameThreadCycles(FPlatformTime::Cycles64() - StartCycles);
+			}
 			*bTaskCompleted = true;
 			CompletionEvent->Trigger();
 		});
 
-		// Wait with timeout to prevent indefinite hangs
+		// Wait with timeout to prevent indefinite hangs. The scope makes the
+		// dispatch wait its own span in Insights, so a capture separates time
+		// spent queued behind other game-thread work from the tool's own
+		// execution span above
 		const uint32 TimeoutMs = UnrealClaudeConstants::MCPServer::GameThreadTimeoutMs;
-		const bool bSignaled = CompletionEvent->Wait(TimeoutMs);
+		bool bSignaled;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString::Printf(TEXT("MCPGameThreadWait %s"), *ToolName));
+			bSignaled = CompletionEvent->Wait(TimeoutMs);
+		}
 
 		if (!bSignaled || !(*bTaskCompleted))
 		{
 			UE_LOG(LogUnrealClaude, Error, TEXT("Tool '%s' execution timed out after %d ms"), *ToolName, TimeoutMs);
+			FMCPToolMetrics::Get().RecordExecution(ToolName, FPlatformTime::Seconds() - ExecStartSeconds, 0.0, false);
 			return FMCPToolResult::Error(FString::Printf(TEXT("Tool execution timed out after %d seconds"), TimeoutMs / 1000));
 		}
 
@@ -237,6 +904,17 @@ FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSha
 		Result = *SharedResult;
 	}
 
+	if (JournalSequence != 0)
+	{
+		FMCPMutationJournal::Get().LogCompletion(JournalSequence, Result.bSuccess);
+	}
+
+	FMCPToolMetrics::Get().RecordExecution(ToolName, FPlatformTime::Seconds() - ExecStartSeconds, *GameThreadSeconds, Result.bSuccess);
+
+	// Charge the measured game-thread time against the admission window so
+	// backpressure kicks in before MCP work can saturate the frame
+	FMCPAdmissionController::Get().ChargeGameThreadTime(*GameThreadSeconds);
+
 	UE_LOG(LogUnrealClaude, Log, TEXT("Tool '%s' execution %s: %s"),
 		*ToolName,
 		Result.bSuccess ? TEXT("succeeded") : TEXT("failed"),
@@ -247,5 +925,7 @@ FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSha
 
 bool FMCPToolRegistry::HasTool(const FString& ToolName) const
 {
-	return Tools.Contains(ToolName);
+	// Existence does not require construction - a pending descriptor counts
+	FScopeLock Lock(&LazyToolsLock);
+	return Tools.Contains(ToolName) || ToolFactories.Contains(ToolName);
 }
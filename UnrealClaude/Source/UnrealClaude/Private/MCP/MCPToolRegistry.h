@@ -7,6 +7,8 @@
 
 // Forward declarations
 class FMCPTaskQueue;
+class FMCPJsonStreamWriter;
+class IMCPSlicedExecution;
 
 /**
  * Tool behavior annotations (hints for LLM clients)
@@ -102,6 +104,25 @@ struct FMCPToolParameter
 	{}
 };
 
+/**
+ * Precompiled parameter check for a registered tool
+ *
+ * Built once at registration from the tool's schema so per-request
+ * validation is a flat loop over an array instead of re-interpreting
+ * the schema with string-keyed field lookups on every call.
+ */
+struct FMCPCompiledParamCheck
+{
+	/** Parameter name */
+	FString Name;
+
+	/** Expected JSON type (EJson::None means any type is accepted) */
+	EJson ExpectedType = EJson::None;
+
+	/** Whether the parameter must be present */
+	bool bRequired = false;
+};
+
 /**
  * Information about an MCP tool
  */
@@ -134,10 +155,37 @@ struct FMCPToolResult
 	/** Optional structured data result */
 	TSharedPtr<FJsonObject> Data;
 
+	/** Optional raw binary payload; when set, the HTTP server sends these
+	 *  bytes as the response body with BinaryContentType instead of the
+	 *  JSON envelope (avoids base64 inflation and the UTF-16 round trip) */
+	TArray<uint8> BinaryData;
+
+	/** Content type for BinaryData (e.g. image/jpeg) */
+	FString BinaryContentType;
+
+	/** Pre-serialized UTF-8 JSON envelope shared with the producer. When set,
+	 *  the HTTP server sends these bytes as the response body instead of
+	 *  rebuilding and re-serializing the envelope from Message/Data - the
+	 *  producer serialized once and every consumer hands the buffer off by
+	 *  reference. Immutable after creation. */
+	TSharedPtr<const TArray<uint8>> PrebuiltBody;
+
 	FMCPToolResult()
 		: bSuccess(false)
 	{}
 
+	/** Whether this result carries a raw binary body */
+	bool HasBinaryPayload() const
+	{
+		return bSuccess && BinaryData.Num() > 0 && !BinaryContentType.IsEmpty();
+	}
+
+	/** Whether this result carries a pre-serialized JSON envelope */
+	bool HasPrebuiltBody() const
+	{
+		return PrebuiltBody.IsValid() && PrebuiltBody->Num() > 0;
+	}
+
 	static FMCPToolResult Success(const FString& InMessage, TSharedPtr<FJsonObject> InData = nullptr)
 	{
 		FMCPToolResult Result;
@@ -169,6 +217,60 @@ public:
 
 	/** Execute the tool with given parameters */
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) = 0;
+
+	/** Whether this tool implements the streaming execution path */
+	virtual bool SupportsStreaming() const { return false; }
+
+	/**
+	 * Whether Execute may run directly on the calling (HTTP/worker) thread.
+	 * Return true only for tools that touch no mutable engine state - e.g.
+	 * asset registry queries or lock-protected buffers. Everything else is
+	 * marshalled to the game thread and costs a slice of frame time.
+	 */
+	virtual bool IsThreadSafe() const { return false; }
+
+	/**
+	 * Whether this invocation can run as cooperative per-frame slices when
+	 * submitted through the task queue. Pure parameter inspection - may be
+	 * called from worker threads.
+	 */
+	virtual bool SupportsSlicedExecution(const TSharedRef<FJsonObject>& Params) const { return false; }
+
+	/**
+	 * Create the incremental execution for a sliced run. Game thread only;
+	 * only called when SupportsSlicedExecution() returned true. Returning
+	 * null falls back to normal blocking execution.
+	 */
+	virtual TSharedPtr<IMCPSlicedExecution> CreateSlicedExecution(const TSharedRef<FJsonObject>& Params) { return nullptr; }
+
+	/**
+	 * Execute the tool, writing the response body incrementally into the writer
+	 * Only called when SupportsStreaming() returns true. The tool owns the full
+	 * JSON envelope it writes (including success/message fields).
+	 * @return true if execution succeeded (sets the HTTP status code)
+	 */
+	virtual bool ExecuteStreaming(const TSharedRef<FJsonObject>& Params, FMCPJsonStreamWriter& Writer) { return false; }
+};
+
+/**
+ * Checkpoint inside an open edit session
+ *
+ * Created by CheckpointEditSession; rolling back to one discards every
+ * change made after it while keeping the session open.
+ */
+struct FMCPEditSessionCheckpoint
+{
+	/** Stable identifier handed back to the client */
+	int32 Id = INDEX_NONE;
+
+	/** Optional client-supplied label for reporting */
+	FString Label;
+
+	/** When the checkpoint was taken */
+	FDateTime CreatedAt;
+
+	/** Session segments committed when the checkpoint was taken (internal) */
+	int32 CommittedSegments = 0;
 };
 
 /**
@@ -180,27 +282,70 @@ public:
 	FMCPToolRegistry();
 	~FMCPToolRegistry();
 
-	/** Register a tool */
+	/** Register a tool (immediately constructed) */
 	void RegisterTool(TSharedPtr<IMCPTool> Tool);
 
-	/** Unregister a tool by name */
-	void UnregisterTool(const FString& ToolName);
-
-	/** Get all registered tools */
+	/**
+	 * Register a tool as a lightweight descriptor: name plus factory, with
+	 * the instance constructed on first use. Keeps module startup from
+	 * paying ~30 tool constructions and schema builds up front; the long
+	 * tail of rarely-used tools may never be constructed at all.
+	 */
+	void RegisterToolFactory(const FString& ToolName, TFunction<TSharedPtr<IMCPTool>()> Factory);
+
+	/**
+	 * Construct a set of tools ahead of first use. Called from a deferred
+	 * ticker once the editor is interactive, so the hot set pays neither a
+	 * boot-time cost nor a first-call penalty.
+	 */
+	void PreWarmTools(const TArray<FString>& ToolNames);
+
+	/** Get all registered tools (materializes any remaining descriptors) */
 	TArray<FMCPToolInfo> GetAllTools() const;
 
-	/** Execute a tool by name */
-	FMCPToolResult ExecuteTool(const FString& ToolName, const TSharedRef<FJsonObject>& Params);
-
-	/** Check if a tool exists */
+	/**
+	 * Execute a tool by name.
+	 *
+	 * bParamsPrevalidated skips the compiled parameter checks: the task queue
+	 * passes it for async tasks whose parameters were already validated at
+	 * submission, so validation runs exactly once per call, not once at
+	 * submit and again at execution.
+	 */
+	FMCPToolResult ExecuteTool(const FString& ToolName, const TSharedRef<FJsonObject>& Params,
+		bool bParamsPrevalidated = false);
+
+	/**
+	 * Run the compiled parameter checks for a tool without executing it.
+	 * Used at task submission so invalid parameters are rejected immediately
+	 * instead of surfacing when the task finally runs.
+	 */
+	bool ValidateToolParams(const FString& ToolName, const TSharedRef<FJsonObject>& Params,
+		FString& OutError) const;
+
+	/** Whether a tool is annotated read-only, from the hint captured at
+	 *  registration - no GetInfo schema rebuild */
+	bool IsToolReadOnly(const FString& ToolName) const;
+
+	/** Whether a tool executes on the calling thread (IsThreadSafe) instead
+	 *  of being dispatched to the game thread */
+	bool IsToolThreadSafe(const FString& ToolName) const;
+
+	/** Check if a tool exists (registered or still a descriptor) */
 	bool HasTool(const FString& ToolName) const;
 
-	/** Find a tool by name (returns nullptr if not found) */
-	IMCPTool* FindTool(const FString& ToolName) const
-	{
-		const TSharedPtr<IMCPTool>* Found = Tools.Find(ToolName);
-		return Found && Found->IsValid() ? Found->Get() : nullptr;
-	}
+	/** Find a tool by name, constructing it from its descriptor on first use
+	 *  (returns nullptr if not found) */
+	IMCPTool* FindTool(const FString& ToolName) const;
+
+	/**
+	 * Find a tool by the raw path segment the HTTP router hands the server,
+	 * without constructing an FString key on the hot path. Constructed tools
+	 * resolve with a single hashed probe of the live map; only the first use
+	 * of a descriptor-registered tool falls back through materialization.
+	 * (Named rather than overloaded: a TCHAR* literal converts to both
+	 * FString and FStringView, so an overload would be ambiguous.)
+	 */
+	IMCPTool* FindToolByPathSegment(FStringView ToolName) const;
 
 	/** Get the async task queue */
 	TSharedPtr<FMCPTaskQueue> GetTaskQueue() const { return TaskQueue; }
@@ -211,15 +356,94 @@ public:
 	/** Stop the async task queue (call before destruction) */
 	void StopTaskQueue();
 
+	/**
+	 * Open a session-scoped editor transaction.
+	 *
+	 * While a session is open, the per-tool FScopedTransactions in mutating
+	 * tools nest inside it instead of creating their own undo entries, so a
+	 * multi-call agent workflow snapshots each object once and collapses to a
+	 * single undo entry. Fails if a session is already open. Game thread only.
+	 */
+	bool BeginEditSession(const FString& Description, FString& OutError);
+
+	/** Commit the open edit session as one undo entry. Fails if none is open. */
+	bool EndEditSession(FString& OutError);
+
+	/** Abort the open edit session, rolling back every change made inside it */
+	bool CancelEditSession(FString& OutError);
+
+	/**
+	 * Take a checkpoint inside the open edit session.
+	 *
+	 * Seals the work since the last checkpoint (or session begin) into its own
+	 * transaction segment and opens a fresh one, so the transaction system's
+	 * existing per-object snapshots double as the checkpoint state - nothing
+	 * is serialized beyond what the open transaction already recorded. Work
+	 * before a checkpoint becomes its own undo entry on session end.
+	 * Fails if no session is open. Game thread only.
+	 */
+	bool CheckpointEditSession(const FString& Label, int32& OutCheckpointId, FString& OutError);
+
+	/**
+	 * Roll the open session back to a checkpoint in one pass: the uncommitted
+	 * segment is cancelled and every segment committed after the checkpoint is
+	 * undone, then a fresh segment opens so the agent can retry immediately.
+	 * The target checkpoint survives and can be rolled back to again; later
+	 * checkpoints are discarded. Game thread only.
+	 */
+	bool RollbackEditSession(int32 CheckpointId, FString& OutError);
+
+	/** Checkpoints taken in the open session, oldest first (empty when inactive) */
+	const TArray<FMCPEditSessionCheckpoint>& GetEditSessionCheckpoints() const { return EditSessionCheckpoints; }
+
+	/** Whether an edit session transaction is currently open */
+	bool IsEditSessionActive() const { return bEditSessionActive; }
+
+	/** Label the open session was started with (empty when inactive) */
+	const FString& GetEditSessionDescription() const { return EditSessionDescription; }
+
+	/** When the open session was started (only meaningful while active) */
+	FDateTime GetEditSessionStartTime() const { return EditSessionStartTime; }
+
 private:
 	/** Register all built-in tools */
 	void RegisterBuiltinTools();
 
+	/**
+	 * Construct a tool from its pending descriptor, compile its schema and
+	 * move it into the live map. Returns the instance, existing or new.
+	 * Caller-agnostic: task workers may race the game thread here, so the
+	 * whole check-construct-publish sequence runs under LazyToolsLock.
+	 */
+	TSharedPtr<IMCPTool> MaterializeTool(const FString& ToolName) const;
+
 	/** Invalidate cached tool list */
 	void InvalidateToolCache();
 
-	/** Map of tool name to tool instance */
-	TMap<FString, TSharedPtr<IMCPTool>> Tools;
+	/** Run the precompiled checks for a tool against incoming parameters */
+	static bool ValidateAgainstCompiledChecks(
+		const TArray<FMCPCompiledParamCheck>& Checks,
+		const TSharedRef<FJsonObject>& Params,
+		FString& OutError);
+
+	/** Map of tool name to constructed tool instance. Mutable: first use
+	 *  materializes descriptors through const lookup paths. */
+	mutable TMap<FString, TSharedPtr<IMCPTool>> Tools;
+
+	/** Pending descriptors: factories for tools not yet constructed.
+	 *  Entries move into Tools on first use. */
+	mutable TMap<FString, TFunction<TSharedPtr<IMCPTool>()>> ToolFactories;
+
+	/** Guards Tools/ToolFactories/CompiledParamChecks against a task worker
+	 *  and the game thread materializing tools concurrently */
+	mutable FCriticalSection LazyToolsLock;
+
+	/** Per-tool parameter checks, compiled once at construction */
+	mutable TMap<FString, TArray<FMCPCompiledParamCheck>> CompiledParamChecks;
+
+	/** Per-tool read-only hint captured at registration; ExecuteTool keys
+	 *  the mutation write-ahead journal on it without rebuilding GetInfo */
+	mutable TMap<FString, bool> ToolReadOnlyHints;
 
 	/** Cached tool info list for performance */
 	mutable TArray<FMCPToolInfo> CachedToolInfo;
@@ -229,4 +453,25 @@ private:
 
 	/** Async task queue for long-running operations */
 	TSharedPtr<FMCPTaskQueue> TaskQueue;
+
+	/** Whether a session-scoped transaction is currently open */
+	bool bEditSessionActive = false;
+
+	/** Transaction index returned by BeginTransaction, for cancellation */
+	int32 EditSessionIndex = INDEX_NONE;
+
+	/** Label the open session was started with */
+	FString EditSessionDescription;
+
+	/** When the open session was started */
+	FDateTime EditSessionStartTime;
+
+	/** Checkpoints taken in the open session, oldest first */
+	TArray<FMCPEditSessionCheckpoint> EditSessionCheckpoints;
+
+	/** Session segments committed so far (one per checkpoint taken) */
+	int32 EditSessionCommittedSegments = 0;
+
+	/** Next checkpoint id to hand out; reset when a session opens */
+	int32 NextEditSessionCheckpointId = 1;
 };
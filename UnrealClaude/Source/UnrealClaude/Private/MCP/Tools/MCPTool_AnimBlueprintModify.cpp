@@ -3,6 +3,7 @@
 #include "MCPTool_AnimBlueprintModify.h"
 #include "AnimationBlueprintUtils.h"
 #include "AnimGraphEditor.h"
+#include "MCP/MCPSlicedExecution.h"
 #include "Serialization/JsonSerializer.h"
 
 FMCPToolResult FMCPTool_AnimBlueprintModify::Execute(const TSharedRef<FJsonObject>& Params)
@@ -27,6 +28,20 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::Execute(const TSharedRef<FJsonObjec
 		return Error.GetValue();
 	}
 
+	// Explicit compile closes a deferred edit session
+	if (Operation == TEXT("compile"))
+	{
+		return HandleCompile(BlueprintPath);
+	}
+
+	// With defer_compile set, every handler's CompileAnimBlueprint call only
+	// marks the blueprint modified; the guard covers the routing below
+	TUniquePtr<FAnimationBlueprintUtils::FScopedDeferredCompile> DeferGuard;
+	if (ExtractOptionalBool(Params, TEXT("defer_compile"), false))
+	{
+		DeferGuard = MakeUnique<FAnimationBlueprintUtils::FScopedDeferredCompile>();
+	}
+
 	// Route to appropriate handler
 	if (Operation == TEXT("get_info"))
 	{
@@ -92,6 +107,10 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::Execute(const TSharedRef<FJsonObjec
 	{
 		return HandleSetStateAnimation(BlueprintPath, Params);
 	}
+	else if (Operation == TEXT("assign_state_animations"))
+	{
+		return HandleAssignStateAnimations(BlueprintPath, Params);
+	}
 	else if (Operation == TEXT("find_animations"))
 	{
 		return HandleFindAnimations(BlueprintPath, Params);
@@ -130,6 +149,11 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::Execute(const TSharedRef<FJsonObjec
 	{
 		return HandleSetupTransitionConditions(BlueprintPath, Params);
 	}
+	// Declarative whole-machine construction with a single compile
+	else if (Operation == TEXT("build_state_machine"))
+	{
+		return HandleBuildStateMachine(BlueprintPath, Params);
+	}
 
 	return FMCPToolResult::Error(FString::Printf(TEXT("Unknown operation: %s"), *Operation));
 }
@@ -421,10 +445,15 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleSetTransitionDuration(const F
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	float Duration = ExtractOptionalNumber<float>(Params, TEXT("duration"), 0.2f);
+	FString StateMachineName, FromState, ToState;
+	float Duration = 0.2f;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::FloatField(TEXT("duration"), Duration)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty())
 	{
@@ -455,10 +484,15 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleSetTransitionPriority(const F
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	int32 Priority = ExtractOptionalNumber<int32>(Params, TEXT("priority"), 1);
+	FString StateMachineName, FromState, ToState;
+	int32 Priority = 1;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::Int32Field(TEXT("priority"), Priority)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty())
 	{
@@ -489,10 +523,14 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleAddConditionNode(const FStrin
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString NodeType = ExtractOptionalString(Params, TEXT("node_type"));
+	FString StateMachineName, FromState, ToState, NodeType;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("node_type"), NodeType)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() || NodeType.IsEmpty())
 	{
@@ -538,10 +576,14 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleDeleteConditionNode(const FSt
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString NodeId = ExtractOptionalString(Params, TEXT("node_id"));
+	FString StateMachineName, FromState, ToState, NodeId;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("node_id"), NodeId)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() || NodeId.IsEmpty())
 	{
@@ -573,13 +615,17 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleConnectConditionNodes(const F
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString SourceNodeId = ExtractOptionalString(Params, TEXT("source_node_id"));
-	FString SourcePin = ExtractOptionalString(Params, TEXT("source_pin"));
-	FString TargetNodeId = ExtractOptionalString(Params, TEXT("target_node_id"));
-	FString TargetPin = ExtractOptionalString(Params, TEXT("target_pin"));
+	FString StateMachineName, FromState, ToState, SourceNodeId, SourcePin, TargetNodeId, TargetPin;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("source_node_id"), SourceNodeId),
+		FMCPFieldSlot::StringField(TEXT("source_pin"), SourcePin),
+		FMCPFieldSlot::StringField(TEXT("target_node_id"), TargetNodeId),
+		FMCPFieldSlot::StringField(TEXT("target_pin"), TargetPin)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() ||
 		SourceNodeId.IsEmpty() || TargetNodeId.IsEmpty())
@@ -612,11 +658,16 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleConnectToResult(const FString
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString ConditionNodeId = ExtractOptionalString(Params, TEXT("source_node_id"));
-	FString ConditionPin = ExtractOptionalString(Params, TEXT("source_pin"), TEXT("Result"));
+	FString StateMachineName, FromState, ToState, ConditionNodeId;
+	FString ConditionPin = TEXT("Result");
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("source_node_id"), ConditionNodeId),
+		FMCPFieldSlot::StringField(TEXT("source_pin"), ConditionPin)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() || ConditionNodeId.IsEmpty())
 	{
@@ -678,10 +729,15 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleSetStateAnimation(const FStri
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString StateName = ExtractOptionalString(Params, TEXT("state_name"));
-	FString AnimType = ExtractOptionalString(Params, TEXT("animation_type"), TEXT("sequence"));
-	FString AnimPath = ExtractOptionalString(Params, TEXT("animation_path"));
+	FString StateMachineName, StateName, AnimPath;
+	FString AnimType = TEXT("sequence");
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("state_name"), StateName),
+		FMCPFieldSlot::StringField(TEXT("animation_type"), AnimType),
+		FMCPFieldSlot::StringField(TEXT("animation_path"), AnimPath)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || StateName.IsEmpty() || AnimPath.IsEmpty())
 	{
@@ -757,6 +813,55 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleSetStateAnimation(const FStri
 	return FMCPToolResult::Success(TEXT("Operation completed"), Result);
 }
 
+FMCPToolResult FMCPTool_AnimBlueprintModify::HandleAssignStateAnimations(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params)
+{
+	UAnimBlueprint* AnimBP = nullptr;
+	if (auto ErrorResult = LoadAnimBlueprintOrError(BlueprintPath, AnimBP))
+	{
+		return ErrorResult.GetValue();
+	}
+
+	FString StateMachineName;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName)
+	};
+	ExtractFields(Params, Slots);
+
+	const TSharedPtr<FJsonObject>* AnimationsObj = nullptr;
+	if (StateMachineName.IsEmpty() || !Params->TryGetObjectField(TEXT("animations"), AnimationsObj))
+	{
+		return FMCPToolResult::Error(TEXT("state_machine and animations (state name -> asset path) parameters required"));
+	}
+
+	TMap<FString, FString> StateToAssetPath;
+	for (const auto& Pair : (*AnimationsObj)->Values)
+	{
+		FString AssetPath;
+		if (Pair.Value->TryGetString(AssetPath) && !AssetPath.IsEmpty())
+		{
+			StateToAssetPath.Add(Pair.Key, AssetPath);
+		}
+	}
+
+	FString Error;
+	TSharedPtr<FJsonObject> Result = FAnimationBlueprintUtils::AssignStateAnimations(
+		AnimBP, StateMachineName, StateToAssetPath, Error);
+
+	if (!Error.IsEmpty())
+	{
+		return FMCPToolResult::Error(Error);
+	}
+
+	// One compile for the whole batch
+	FString CompileError;
+	FAnimationBlueprintUtils::CompileAnimBlueprint(AnimBP, CompileError);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Assigned %d state animation(s)"),
+			static_cast<int32>(Result->GetNumberField(TEXT("assigned")))),
+		Result);
+}
+
 FMCPToolResult FMCPTool_AnimBlueprintModify::HandleFindAnimations(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params)
 {
 	FString Error;
@@ -803,7 +908,13 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleBatch(const FString& Blueprin
 
 	FString Error;
 	TSharedPtr<FJsonObject> Result = FAnimationBlueprintUtils::ExecuteBatchOperations(
-		AnimBP, *Operations, Error);
+		AnimBP, *Operations, Error, GetCancellationToken(Params));
+
+	if (Result->HasField(TEXT("cancelled")))
+	{
+		// The applied prefix is compiled and reported; the rest never ran
+		return FMCPToolResult::Success(TEXT("Batch operation cancelled; partial results returned"), Result);
+	}
 
 	if (!Result->GetBoolField(TEXT("success")))
 	{
@@ -853,10 +964,14 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleInspectNodePins(const FString
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString NodeId = ExtractOptionalString(Params, TEXT("node_id"));
+	FString StateMachineName, FromState, ToState, NodeId;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("node_id"), NodeId)
+	};
+	ExtractFields(Params, Slots);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() || NodeId.IsEmpty())
 	{
@@ -883,12 +998,66 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleSetPinDefaultValue(const FStr
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString NodeId = ExtractOptionalString(Params, TEXT("node_id"));
-	FString PinName = ExtractOptionalString(Params, TEXT("pin_name"));
-	FString PinValue = ExtractOptionalString(Params, TEXT("pin_value"));
+	FString StateMachineName, FromState, ToState, NodeId, PinName, PinValue;
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("node_id"), NodeId),
+		FMCPFieldSlot::StringField(TEXT("pin_name"), PinName),
+		FMCPFieldSlot::StringField(TEXT("pin_value"), PinValue)
+	};
+	ExtractFields(Params, Slots);
+
+	// Batched form: pin_values maps pin name -> value for node_id, applied in
+	// one pass with a single reconstruction of each affected node
+	const TSharedPtr<FJsonObject>* PinValuesPtr = nullptr;
+	if (Params->TryGetObjectField(TEXT("pin_values"), PinValuesPtr))
+	{
+		if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() || NodeId.IsEmpty())
+		{
+			return FMCPToolResult::Error(TEXT("state_machine, from_state, to_state, and node_id parameters required"));
+		}
+
+		TArray<FPinDefaultAssignment> Assignments;
+		for (const auto& PinValuePair : (*PinValuesPtr)->Values)
+		{
+			FString ValueStr;
+			if (PinValuePair.Value->TryGetString(ValueStr))
+			{
+				Assignments.Add({ NodeId, PinValuePair.Key, ValueStr });
+			}
+		}
+
+		TArray<FString> BatchErrors;
+		const int32 AppliedCount = FAnimationBlueprintUtils::SetPinDefaultValues(
+			AnimBP, StateMachineName, FromState, ToState, Assignments, BatchErrors);
+
+		if (AppliedCount < 0)
+		{
+			return FMCPToolResult::Error(BatchErrors.Num() > 0 ? BatchErrors[0] : TEXT("Batch pin update failed"));
+		}
+
+		FString CompileError;
+		FAnimationBlueprintUtils::CompileAnimBlueprint(AnimBP, CompileError);
+
+		TSharedPtr<FJsonObject> BatchResult = MakeShared<FJsonObject>();
+		BatchResult->SetBoolField(TEXT("success"), BatchErrors.Num() == 0);
+		BatchResult->SetStringField(TEXT("node_id"), NodeId);
+		BatchResult->SetNumberField(TEXT("applied"), AppliedCount);
+		if (BatchErrors.Num() > 0)
+		{
+			TArray<TSharedPtr<FJsonValue>> ErrorValues;
+			for (const FString& BatchError : BatchErrors)
+			{
+				ErrorValues.Add(MakeShared<FJsonValueString>(BatchError));
+			}
+			BatchResult->SetArrayField(TEXT("errors"), ErrorValues);
+		}
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Applied %d pin default(s)"), AppliedCount), BatchResult);
+	}
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() ||
 		NodeId.IsEmpty() || PinName.IsEmpty())
@@ -923,12 +1092,17 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleAddComparisonChain(const FStr
 		return ErrorResult.GetValue();
 	}
 
-	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
-	FString FromState = ExtractOptionalString(Params, TEXT("from_state"));
-	FString ToState = ExtractOptionalString(Params, TEXT("to_state"));
-	FString VariableName = ExtractOptionalString(Params, TEXT("variable_name"));
-	FString ComparisonType = ExtractOptionalString(Params, TEXT("comparison_type"), TEXT("Less"));
-	FString CompareValue = ExtractOptionalString(Params, TEXT("compare_value"));
+	FString StateMachineName, FromState, ToState, VariableName, CompareValue;
+	FString ComparisonType = TEXT("Less");
+	FMCPFieldSlot Slots[] = {
+		FMCPFieldSlot::StringField(TEXT("state_machine"), StateMachineName),
+		FMCPFieldSlot::StringField(TEXT("from_state"), FromState),
+		FMCPFieldSlot::StringField(TEXT("to_state"), ToState),
+		FMCPFieldSlot::StringField(TEXT("variable_name"), VariableName),
+		FMCPFieldSlot::StringField(TEXT("comparison_type"), ComparisonType),
+		FMCPFieldSlot::StringField(TEXT("compare_value"), CompareValue)
+	};
+	ExtractFields(Params, Slots);
 	FVector2D Position = ExtractPosition(Params);
 
 	if (StateMachineName.IsEmpty() || FromState.IsEmpty() || ToState.IsEmpty() || VariableName.IsEmpty())
@@ -951,6 +1125,27 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleAddComparisonChain(const FStr
 	return FMCPToolResult::Success(TEXT("Comparison chain created successfully"), Result);
 }
 
+FMCPToolResult FMCPTool_AnimBlueprintModify::HandleCompile(const FString& BlueprintPath)
+{
+	UAnimBlueprint* AnimBP = nullptr;
+	if (auto ErrorResult = LoadAnimBlueprintOrError(BlueprintPath, AnimBP))
+	{
+		return ErrorResult.GetValue();
+	}
+
+	FString Error;
+	if (!FAnimationBlueprintUtils::CompileAnimBlueprint(AnimBP, Error))
+	{
+		return FMCPToolResult::Error(Error);
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("blueprint_path"), BlueprintPath);
+
+	return FMCPToolResult::Success(TEXT("Animation Blueprint compiled"), Result);
+}
+
 FMCPToolResult FMCPTool_AnimBlueprintModify::HandleValidateBlueprint(const FString& BlueprintPath)
 {
 	UAnimBlueprint* AnimBP = nullptr;
@@ -1057,3 +1252,181 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::HandleSetupTransitionConditions(
 
 	return FMCPToolResult::Success(Message, Result);
 }
+
+FMCPToolResult FMCPTool_AnimBlueprintModify::HandleBuildStateMachine(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params)
+{
+	UAnimBlueprint* AnimBP = nullptr;
+	if (auto ErrorResult = LoadAnimBlueprintOrError(BlueprintPath, AnimBP))
+	{
+		return ErrorResult.GetValue();
+	}
+
+	FString StateMachineName = ExtractOptionalString(Params, TEXT("state_machine"));
+	if (StateMachineName.IsEmpty())
+	{
+		return FMCPToolResult::Error(TEXT("state_machine parameter required"));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* StatesArray;
+	if (!Params->TryGetArrayField(TEXT("states"), StatesArray))
+	{
+		return FMCPToolResult::Error(TEXT("states array required for build_state_machine"));
+	}
+
+	// Transitions are optional - a machine of disconnected states is valid
+	const TArray<TSharedPtr<FJsonValue>>* TransitionsArray = nullptr;
+	TArray<TSharedPtr<FJsonValue>> EmptyTransitions;
+	if (!Params->TryGetArrayField(TEXT("transitions"), TransitionsArray))
+	{
+		TransitionsArray = &EmptyTransitions;
+	}
+
+	FString EntryState = ExtractOptionalString(Params, TEXT("entry_state"));
+
+	FString Error;
+	TSharedPtr<FJsonObject> Result = FAnimationBlueprintUtils::BuildStateMachine(
+		AnimBP, StateMachineName, *StatesArray, *TransitionsArray, EntryState, Error);
+
+	if (!Result.IsValid())
+	{
+		return FMCPToolResult::Error(Error.IsEmpty() ? TEXT("Failed to build state machine") : Error);
+	}
+
+	if (!Result->GetBoolField(TEXT("success")))
+	{
+		FString ErrorMsg = Result->HasField(TEXT("error"))
+			? Result->GetStringField(TEXT("error"))
+			: TEXT("State machine built with errors");
+		// Return partial results with error
+		return FMCPToolResult::Success(ErrorMsg, Result);
+	}
+
+	int32 StatesAdded = static_cast<int32>(Result->GetNumberField(TEXT("states_added")));
+	int32 TransitionsAdded = static_cast<int32>(Result->GetNumberField(TEXT("transitions_added")));
+
+	FString Message = FString::Printf(
+		TEXT("Built state machine '%s': %d states, %d transitions"),
+		*StateMachineName, StatesAdded, TransitionsAdded);
+
+	return FMCPToolResult::Success(Message, Result);
+}
+
+/**
+ * Staged anim blueprint compile: one pipeline phase per Step() call, driven
+ * by FMCPToolSlicer. Asset load, structure-hash prep, the compiler run and
+ * the post-compile save each take their own editor tick, so the unavoidable
+ * compiler hitch is the only long frame and the save lands on the next one
+ * instead of stacking onto it. The anim compiler itself is monolithic
+ * game-thread work and cannot be split further; staging around it is what
+ * keeps the surrounding frames responsive, and the submitting client holds
+ * a task future instead of a blocked worker.
+ */
+class FSlicedAnimCompile : public IMCPSlicedExecution
+{
+public:
+	explicit FSlicedAnimCompile(const FString& InBlueprintPath)
+		: BlueprintPath(InBlueprintPath)
+	{
+	}
+
+	virtual bool Step() override
+	{
+		switch (Phase)
+		{
+		case EPhase::Load:
+		{
+			FString LoadError;
+			UAnimBlueprint* Loaded = FAnimationBlueprintUtils::LoadAnimBlueprint(BlueprintPath, LoadError);
+			if (!Loaded)
+			{
+				return Finish(FMCPToolResult::Error(LoadError));
+			}
+			AnimBP = Loaded;
+			Phase = EPhase::Hash;
+			return false;
+		}
+		case EPhase::Hash:
+		{
+			if (!AnimBP.IsValid())
+			{
+				return Finish(FMCPToolResult::Error(TEXT("Animation Blueprint was collected between compile phases")));
+			}
+			StructureHash = FAnimationBlueprintUtils::ComputeCompileStructureHash(AnimBP.Get());
+			Phase = EPhase::Compile;
+			return false;
+		}
+		case EPhase::Compile:
+		{
+			FString CompileError;
+			if (!AnimBP.IsValid())
+			{
+				return Finish(FMCPToolResult::Error(TEXT("Animation Blueprint was collected between compile phases")));
+			}
+			if (!FAnimationBlueprintUtils::RunAnimCompilePhase(AnimBP.Get(), StructureHash, CompileError))
+			{
+				return Finish(FMCPToolResult::Error(CompileError));
+			}
+			Phase = EPhase::Save;
+			return false;
+		}
+		case EPhase::Save:
+		{
+			FAnimationBlueprintUtils::SaveCompiledAnimBlueprint(AnimBP.Get());
+
+			TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+			Data->SetBoolField(TEXT("success"), true);
+			Data->SetStringField(TEXT("blueprint_path"), BlueprintPath);
+			return Finish(FMCPToolResult::Success(TEXT("Animation Blueprint compiled"), Data));
+		}
+		default:
+			return true;
+		}
+	}
+
+	virtual int32 GetProgressPercent() const override
+	{
+		switch (Phase)
+		{
+		case EPhase::Load: return 0;
+		case EPhase::Hash: return 25;
+		case EPhase::Compile: return 50;
+		case EPhase::Save: return 75;
+		default: return 100;
+		}
+	}
+
+	virtual FMCPToolResult GetResult() override
+	{
+		return Result;
+	}
+
+private:
+	enum class EPhase : uint8 { Load, Hash, Compile, Save, Done };
+
+	bool Finish(FMCPToolResult&& InResult)
+	{
+		Result = MoveTemp(InResult);
+		Phase = EPhase::Done;
+		return true;
+	}
+
+	FString BlueprintPath;
+	TWeakObjectPtr<UAnimBlueprint> AnimBP;
+	uint32 StructureHash = 0;
+	EPhase Phase = EPhase::Load;
+	FMCPToolResult Result;
+};
+
+TSharedPtr<IMCPSlicedExecution> FMCPTool_AnimBlueprintModify::CreateSlicedExecution(const TSharedRef<FJsonObject>& Params)
+{
+	FString BlueprintPath;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("blueprint_path"), BlueprintPath, Error) ||
+		!ValidateBlueprintPathParam(BlueprintPath, Error))
+	{
+		// Parameter error - fall back to blocking execution, which reports it
+		return nullptr;
+	}
+
+	return MakeShared<FSlicedAnimCompile>(BlueprintPath);
+}
@@ -34,6 +34,8 @@
  * - set_state_animation: Assign animation to state
  * - find_animations: Search for compatible animation assets
  * - batch: Execute multiple operations atomically
+ * - build_state_machine: Construct a full machine (states, transitions, entry) in one call
+ * - compile: Explicitly compile (pairs with defer_compile for batched edit sessions)
  *
  * NEW Operations (Enhanced Pin/Node Introspection):
  * - get_transition_nodes: List all nodes in transition graph(s) with their pins
@@ -86,17 +88,27 @@ public:
 			"Visualization (NEW):\n"
 			"- 'get_state_machine_diagram': Generate ASCII diagram and enhanced JSON for state machine\n\n"
 			"Bulk Operations:\n"
-			"- 'setup_transition_conditions': Setup conditions for multiple transitions using pattern matching\n\n"
+			"- 'setup_transition_conditions': Setup conditions for multiple transitions using pattern matching\n"
+			"- 'build_state_machine': Construct a complete machine from 'states', 'transitions' and "
+			"'entry_state' in one call with a single compile - far faster than per-state operations\n\n"
 			"AnimGraph Connection:\n"
 			"- 'connect_state_machine_to_output': Connect State Machine to AnimGraph Output Pose\n\n"
 			"Animation Assignment:\n"
 			"- 'set_state_animation': Assign AnimSequence, BlendSpace, BlendSpace1D, or Montage\n"
+			"- 'assign_state_animations': Bulk-assign from an 'animations' map (state -> asset path); "
+			"each distinct asset resolved once, one compile for the whole batch\n"
 			"- 'find_animations': Search compatible animation assets\n\n"
-			"- 'batch': Execute multiple operations atomically"
+			"- 'batch': Execute multiple operations atomically\n\n"
+			"Deferred compilation: pass defer_compile=true on successive edits to skip the "
+			"per-operation compile, then finish with the 'compile' operation. Cuts long "
+			"edit sessions on one AnimBP from one full compile per edit to a single compile.\n\n"
+			"Submitted through task_submit, 'compile' runs staged across editor ticks "
+			"(load, analysis, compile, save on separate frames) and completes as a task "
+			"future - poll task_status or long-poll task/wait instead of blocking."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("blueprint_path"), TEXT("string"), TEXT("Path to the Animation Blueprint (e.g., '/Game/Characters/ABP_Character')"), true),
-			FMCPToolParameter(TEXT("operation"), TEXT("string"), TEXT("Operation: get_info, get_state_machine, get_state_machine_diagram, create_state_machine, add_state, remove_state, set_entry_state, add_transition, remove_transition, set_transition_duration, set_transition_priority, add_condition_node, delete_condition_node, connect_condition_nodes, connect_to_result, connect_state_machine_to_output, set_state_animation, find_animations, batch, get_transition_nodes, inspect_node_pins, set_pin_default_value, add_comparison_chain, validate_blueprint"), true),
+			FMCPToolParameter(TEXT("operation"), TEXT("string"), TEXT("Operation: get_info, get_state_machine, get_state_machine_diagram, create_state_machine, add_state, remove_state, set_entry_state, add_transition, remove_transition, set_transition_duration, set_transition_priority, add_condition_node, delete_condition_node, connect_condition_nodes, connect_to_result, connect_state_machine_to_output, set_state_animation, assign_state_animations, find_animations, batch, get_transition_nodes, inspect_node_pins, set_pin_default_value, add_comparison_chain, validate_blueprint, build_state_machine, compile"), true),
 			FMCPToolParameter(TEXT("state_machine"), TEXT("string"), TEXT("State machine name (for state/transition operations)"), false),
 			FMCPToolParameter(TEXT("state_name"), TEXT("string"), TEXT("State name (for state operations)"), false),
 			FMCPToolParameter(TEXT("from_state"), TEXT("string"), TEXT("Source state name (for transitions)"), false),
@@ -115,6 +127,7 @@ public:
 			FMCPToolParameter(TEXT("animation_type"), TEXT("string"), TEXT("Animation type: sequence, blendspace, blendspace1d, montage"), false),
 			FMCPToolParameter(TEXT("animation_path"), TEXT("string"), TEXT("Path to animation asset"), false),
 			FMCPToolParameter(TEXT("parameter_bindings"), TEXT("object"), TEXT("BlendSpace parameter bindings {\"X\": \"Speed\", \"Y\": \"Direction\"}"), false),
+			FMCPToolParameter(TEXT("animations"), TEXT("object"), TEXT("State name -> asset path map for assign_state_animations"), false),
 			FMCPToolParameter(TEXT("search_pattern"), TEXT("string"), TEXT("Animation search pattern (for find_animations)"), false),
 			FMCPToolParameter(TEXT("asset_type"), TEXT("string"), TEXT("Asset type filter: AnimSequence, BlendSpace, BlendSpace1D, Montage, All"), false, TEXT("All")),
 			FMCPToolParameter(TEXT("operations"), TEXT("array"), TEXT("Array of operations for batch mode"), false),
@@ -124,8 +137,14 @@ public:
 			FMCPToolParameter(TEXT("compare_value"), TEXT("string"), TEXT("Value to compare against (for add_comparison_chain)"), false),
 			FMCPToolParameter(TEXT("pin_value"), TEXT("string"), TEXT("Default value for the pin (for set_pin_default_value)"), false),
 			FMCPToolParameter(TEXT("pin_name"), TEXT("string"), TEXT("Pin name to set value (for set_pin_default_value)"), false),
+			FMCPToolParameter(TEXT("pin_values"), TEXT("object"), TEXT("Pin name -> value map for batched set_pin_default_value; all values applied, each node reconstructed once"), false),
 			// Bulk operation parameters
-			FMCPToolParameter(TEXT("rules"), TEXT("array"), TEXT("Array of condition rules for setup_transition_conditions. Each rule: {match: {from, to}, conditions: [...], logic: 'AND'|'OR'}"), false)
+			FMCPToolParameter(TEXT("rules"), TEXT("array"), TEXT("Array of condition rules for setup_transition_conditions. Each rule: {match: {from, to}, conditions: [...], logic: 'AND'|'OR'}"), false),
+			FMCPToolParameter(TEXT("states"), TEXT("array"), TEXT("States for build_state_machine. Each: {name, x?, y?}; omitted positions auto-grid"), false),
+			FMCPToolParameter(TEXT("transitions"), TEXT("array"), TEXT("Transitions for build_state_machine. Each: {from, to, duration?, priority?}"), false),
+			FMCPToolParameter(TEXT("entry_state"), TEXT("string"), TEXT("Entry state name for build_state_machine"), false),
+			// Deferred compilation
+			FMCPToolParameter(TEXT("defer_compile"), TEXT("boolean"), TEXT("Skip the post-operation compile; finish the edit session with the 'compile' operation (default: false)"), false, TEXT("false"))
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
@@ -133,6 +152,18 @@ public:
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
 
+	/** The 'compile' operation stages as load -> hash -> compile -> save
+	 *  across editor ticks when run through the task queue, so the compiler
+	 *  run and the asset save hitch separate frames and the submitting
+	 *  client polls the task future instead of blocking */
+	virtual bool SupportsSlicedExecution(const TSharedRef<FJsonObject>& Params) const override
+	{
+		FString Operation;
+		return Params->TryGetStringField(TEXT("operation"), Operation) && Operation == TEXT("compile");
+	}
+
+	virtual TSharedPtr<IMCPSlicedExecution> CreateSlicedExecution(const TSharedRef<FJsonObject>& Params) override;
+
 private:
 	// Operation handlers
 	FMCPToolResult HandleGetInfo(const FString& BlueprintPath);
@@ -151,6 +182,7 @@ private:
 	FMCPToolResult HandleConnectToResult(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult HandleConnectStateMachineToOutput(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult HandleSetStateAnimation(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult HandleAssignStateAnimations(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult HandleFindAnimations(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult HandleBatch(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 
@@ -160,10 +192,12 @@ private:
 	FMCPToolResult HandleSetPinDefaultValue(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult HandleAddComparisonChain(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult HandleValidateBlueprint(const FString& BlueprintPath);
+	FMCPToolResult HandleCompile(const FString& BlueprintPath);
 	FMCPToolResult HandleGetStateMachineDiagram(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 
-	// Bulk operation handler
+	// Bulk operation handlers
 	FMCPToolResult HandleSetupTransitionConditions(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult HandleBuildStateMachine(const FString& BlueprintPath, const TSharedRef<FJsonObject>& Params);
 
 	// Helper to extract position
 	FVector2D ExtractPosition(const TSharedRef<FJsonObject>& Params);
@@ -1,6 +1,8 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_AssetDependencies.h"
+#include "../MCPAssetGraphCache.h"
+#include "UnrealClaudeConstants.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 
@@ -43,24 +45,16 @@ FMCPToolResult FMCPTool_AssetDependencies::Execute(const TSharedRef<FJsonObject>
 		AssetData = AssetsInPackage[0];
 	}
 
-	// Query dependencies
-	TArray<FName> Dependencies;
-
-	// Build dependency query flags - construct FDependencyQuery from EDependencyQuery enum
-	UE::AssetRegistry::FDependencyQuery QueryFlags;
-	if (!bIncludeSoft)
+	// Budgeted closure walk with streamed edges
+	if (ExtractOptionalBool(Params, TEXT("transitive"), false))
 	{
-		// Only hard dependencies
-		QueryFlags = UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard);
+		return ExecuteTransitive(Params, AssetPath, FName(*PackagePath), bIncludeSoft);
 	}
-	// else: default FDependencyQuery() returns all dependencies (no requirements)
 
-	AssetRegistry.GetDependencies(
-		FName(*PackagePath),
-		Dependencies,
-		UE::AssetRegistry::EDependencyCategory::Package,
-		QueryFlags
-	);
+	// Query dependencies through the graph cache; repeated queries for the
+	// same package are hash lookups until the registry invalidates the entry
+	TArray<FName> Dependencies;
+	FMCPAssetGraphCache::Get().GetDependencies(FName(*PackagePath), !bIncludeSoft, Dependencies);
 
 	// Build result array
 	TArray<TSharedPtr<FJsonValue>> DependencyArray;
@@ -103,3 +97,150 @@ FMCPToolResult FMCPTool_AssetDependencies::Execute(const TSharedRef<FJsonObject>
 
 	return FMCPToolResult::Success(Message, ResultData);
 }
+
+FMCPToolResult FMCPTool_AssetDependencies::ExecuteTransitive(const TSharedRef<FJsonObject>& Params,
+	const FString& AssetPath, FName RootPackage, bool bIncludeSoft)
+{
+	const int32 MaxDepth = FMath::Max(0, ExtractOptionalNumber<int32>(Params, TEXT("max_depth"), 0));
+	const int32 MaxNodes = FMath::Clamp(
+		ExtractOptionalNumber<int32>(Params, TEXT("max_nodes"), MCPServer::DefaultTransitiveDependencyNodes),
+		1, MCPServer::MaxTransitiveDependencyNodes);
+
+	// Resolve the owning task when running through the queue so discovered
+	// edges stream into its partial output; cancellation is observed
+	// through the shared token below
+	TSharedPtr<FMCPAsyncTask> OwnerTask;
+	FString TaskIdString;
+	if (TaskQueue.IsValid() && Params->TryGetStringField(TEXT("_task_id"), TaskIdString))
+	{
+		FGuid OwnerTaskId;
+		if (FGuid::Parse(TaskIdString, OwnerTaskId))
+		{
+			OwnerTask = TaskQueue->GetTask(OwnerTaskId);
+		}
+	}
+
+	FMCPAssetGraphCache& Graph = FMCPAssetGraphCache::Get();
+
+	// Cancellation checkpoint per frontier entry; the token is inert for
+	// direct calls, where the walk is bounded by the node budget anyway
+	const FMCPCancellationToken CancelToken = GetCancellationToken(Params);
+
+	// Iterative breadth-first walk, frontier index-walked in place so the
+	// whole closure never recurses and depth comes for free per entry
+	TSet<FName> Visited;
+	Visited.Add(RootPackage);
+	TArray<TPair<FName, int32>> Frontier;
+	Frontier.Emplace(RootPackage, 0);
+
+	TArray<TSharedPtr<FJsonValue>> EdgeArray;
+	TArray<FName> Dependencies;
+	FString StreamChunk;
+	int32 EdgesInChunk = 0;
+	bool bNodeBudgetHit = false;
+	bool bDepthLimited = false;
+	bool bCancelled = false;
+	int32 DeepestDepth = 0;
+
+	for (int32 Head = 0; Head < Frontier.Num(); ++Head)
+	{
+		if (CancelToken.IsCancelled())
+		{
+			bCancelled = true;
+			break;
+		}
+
+		const FName FromPackage = Frontier[Head].Key;
+		const int32 Depth = Frontier[Head].Value;
+		if (MaxDepth > 0 && Depth >= MaxDepth)
+		{
+			// This node may have dependencies we are not expanding
+			bDepthLimited = true;
+			continue;
+		}
+
+		Dependencies.Reset();
+		Graph.GetDependencies(FromPackage, !bIncludeSoft, Dependencies);
+
+		const FString FromStr = FromPackage.ToString();
+		for (const FName& Dep : Dependencies)
+		{
+			const FString DepStr = Dep.ToString();
+			if (DepStr.StartsWith(TEXT("/Script/")) || DepStr.StartsWith(TEXT("/Engine/")))
+			{
+				continue;
+			}
+
+			const int32 DepDepth = Depth + 1;
+			DeepestDepth = FMath::Max(DeepestDepth, DepDepth);
+
+			// Every edge of the budgeted closure is reported; a package only
+			// joins the frontier once, and only while the node budget holds
+			TSharedPtr<FJsonObject> EdgeJson = MakeShared<FJsonObject>();
+			EdgeJson->SetStringField(TEXT("from"), FromStr);
+			EdgeJson->SetStringField(TEXT("to"), DepStr);
+			EdgeJson->SetNumberField(TEXT("depth"), DepDepth);
+			EdgeArray.Add(MakeShared<FJsonValueObject>(EdgeJson));
+
+			if (OwnerTask.IsValid())
+			{
+				// NDJSON into the partial-output channel, flushed in batches
+				// so pollers see progress without per-edge lock traffic
+				StreamChunk += FString::Printf(TEXT("{\"from\":\"%s\",\"to\":\"%s\",\"depth\":%d}\n"),
+					*FromStr, *DepStr, DepDepth);
+				if (++EdgesInChunk >= 64)
+				{
+					OwnerTask->AppendPartialOutput(StreamChunk);
+					StreamChunk.Reset();
+					EdgesInChunk = 0;
+				}
+			}
+
+			if (!Visited.Contains(Dep))
+			{
+				if (Visited.Num() >= MaxNodes)
+				{
+					bNodeBudgetHit = true;
+					continue;
+				}
+				Visited.Add(Dep);
+				Frontier.Emplace(Dep, DepDepth);
+			}
+		}
+	}
+
+	if (OwnerTask.IsValid() && EdgesInChunk > 0)
+	{
+		OwnerTask->AppendPartialOutput(StreamChunk);
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("asset_path"), AssetPath);
+	ResultData->SetBoolField(TEXT("transitive"), true);
+	ResultData->SetArrayField(TEXT("edges"), EdgeArray);
+	ResultData->SetNumberField(TEXT("edge_count"), EdgeArray.Num());
+	ResultData->SetNumberField(TEXT("package_count"), Visited.Num() - 1);
+	ResultData->SetNumberField(TEXT("deepest_depth"), DeepestDepth);
+	ResultData->SetBoolField(TEXT("include_soft"), bIncludeSoft);
+	ResultData->SetBoolField(TEXT("truncated"), bNodeBudgetHit || bCancelled);
+	if (bNodeBudgetHit)
+	{
+		ResultData->SetNumberField(TEXT("max_nodes"), MaxNodes);
+	}
+	if (bDepthLimited)
+	{
+		ResultData->SetNumberField(TEXT("max_depth"), MaxDepth);
+	}
+	if (bCancelled)
+	{
+		ResultData->SetBoolField(TEXT("cancelled"), true);
+	}
+
+	FString Message = FString::Printf(TEXT("Transitive closure of '%s': %d packages, %d edges%s"),
+		*AssetPath, Visited.Num() - 1, EdgeArray.Num(),
+		bCancelled ? TEXT(" (stopped by cancellation)")
+			: bNodeBudgetHit ? TEXT(" (node budget reached)")
+			: bDepthLimited ? TEXT(" (depth limited)") : TEXT(""));
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
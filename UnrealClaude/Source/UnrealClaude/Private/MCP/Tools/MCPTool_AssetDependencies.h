@@ -4,12 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "../MCPToolBase.h"
+#include "../MCPTaskQueue.h"
 
 /**
  * MCP Tool: Get assets that a specific asset depends on
  *
  * Returns all dependencies (hard and soft) that would need to be loaded
- * when loading the specified asset.
+ * when loading the specified asset. Transitive mode walks the closure
+ * iteratively under depth and node budgets, streaming discovered edges
+ * through the owning task's partial-output channel so large graphs can be
+ * consumed (and abandoned) before the walk finishes.
  */
 class FMCPTool_AssetDependencies : public FMCPToolBase
 {
@@ -29,17 +33,44 @@ public:
 			"- '/Game/Blueprints/BP_Player'\n"
 			"- '/Game/Characters/Meshes/SK_Character'\n"
 			"- '/Game/Materials/M_Ground'\n\n"
-			"Returns: Array of dependency asset paths with their dependency type."
+			"Transitive mode: pass transitive=true to walk the whole dependency "
+			"closure breadth-first. The walk is budgeted (max_depth, max_nodes) and "
+			"iterative, and edges are returned as {from, to, depth}. Submitted "
+			"through task_submit, discovered edges also stream into the task's "
+			"partial output as they are found (one JSON edge per line) - poll "
+			"task_status to consume the graph immediately and task_cancel when you "
+			"have enough instead of waiting for the full closure.\n\n"
+			"Returns: Array of dependency asset paths with their dependency type, "
+			"or the edge list in transitive mode."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("asset_path"), TEXT("string"),
 				TEXT("Full asset path (e.g., '/Game/Blueprints/BP_Player')"), true),
 			FMCPToolParameter(TEXT("include_soft"), TEXT("boolean"),
-				TEXT("Include soft references in addition to hard dependencies (default: true)"), false, TEXT("true"))
+				TEXT("Include soft references in addition to hard dependencies (default: true)"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("transitive"), TEXT("boolean"),
+				TEXT("Walk the full transitive closure instead of direct dependencies only (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("max_depth"), TEXT("number"),
+				TEXT("Transitive only: stop expanding past this depth (0 = bounded by max_nodes alone)"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("max_nodes"), TEXT("number"),
+				TEXT("Transitive only: stop discovering new packages after this many (default: 5000, capped at 50000)"), false, TEXT("5000"))
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
+	/** Dependency queries go through the internally locked asset registry */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+	/** Wire the task queue so transitive walks can stream edges into their
+	 *  owning task and observe its cancellation flag */
+	void SetTaskQueue(TSharedPtr<FMCPTaskQueue> InTaskQueue) { TaskQueue = InTaskQueue; }
+
+private:
+	/** Budgeted breadth-first closure walk behind transitive=true */
+	FMCPToolResult ExecuteTransitive(const TSharedRef<FJsonObject>& Params, const FString& AssetPath,
+		FName RootPackage, bool bIncludeSoft);
+
+	TSharedPtr<FMCPTaskQueue> TaskQueue;
 };
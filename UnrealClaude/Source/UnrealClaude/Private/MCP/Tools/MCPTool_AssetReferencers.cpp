@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_AssetReferencers.h"
+#include "../MCPAssetGraphCache.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 
@@ -43,24 +44,11 @@ FMCPToolResult FMCPTool_AssetReferencers::Execute(const TSharedRef<FJsonObject>&
 		AssetData = AssetsInPackage[0];
 	}
 
-	// Query referencers
+	// Query referencers through the reverse-reference index; once the
+	// background build finishes this is a hash lookup instead of the
+	// registry resolving reverse edges on demand
 	TArray<FName> Referencers;
-
-	// Build dependency query flags - construct FDependencyQuery from EDependencyQuery enum
-	UE::AssetRegistry::FDependencyQuery QueryFlags;
-	if (!bIncludeSoft)
-	{
-		// Only hard references
-		QueryFlags = UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard);
-	}
-	// else: default FDependencyQuery() returns all references (no requirements)
-
-	AssetRegistry.GetReferencers(
-		FName(*PackagePath),
-		Referencers,
-		UE::AssetRegistry::EDependencyCategory::Package,
-		QueryFlags
-	);
+	FMCPAssetGraphCache::Get().GetReferencers(FName(*PackagePath), !bIncludeSoft, Referencers);
 
 	// Build result array
 	TArray<TSharedPtr<FJsonValue>> ReferencerArray;
@@ -43,5 +43,7 @@ public:
 		return Info;
 	}
 
+	/** Referencer queries go through the internally locked asset registry */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
 };
@@ -1,8 +1,118 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_AssetSearch.h"
+#include "../MCPAssetNameIndex.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeSettings.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** Materialized id list from one filtered search, kept for cursor paging */
+	struct FAssetSearchCursor
+	{
+		/** Object paths of every asset that matched the filters, in registry order */
+		TArray<FSoftObjectPath> AssetPaths;
+
+		/** FPlatformTime::Seconds() after which this cursor is dead */
+		double ExpiresAt = 0.0;
+	};
+
+	/**
+	 * TTL-bound store of cursor result sets
+	 *
+	 * Offset paging re-ran the whole registry enumeration per page, so
+	 * walking ten pages cost ten full scans. The first query materializes
+	 * the filtered id list once; later pages index into it and only resolve
+	 * the requested slice back to FAssetData. Ids rather than FAssetData
+	 * keep a 180k-asset set at tens of bytes per entry, and resolving at
+	 * page time means deleted assets simply drop out of the page.
+	 *
+	 * asset_search executes on worker threads (IsThreadSafe), so the store
+	 * is lock-protected. Bounded LRU plus TTL: agents abandon cursors
+	 * mid-walk all the time, and a stale set should not outlive the result
+	 * lists it describes for long.
+	 */
+	class FAssetSearchCursorStore
+	{
+	public:
+		static FAssetSearchCursorStore& Get()
+		{
+			static FAssetSearchCursorStore Instance;
+			return Instance;
+		}
+
+		/** Store a result set and hand back its cursor token */
+		FString Store(TArray<FSoftObjectPath>&& AssetPaths)
+		{
+			FScopeLock Lock(&CursorsLock);
+			PurgeExpired();
+
+			while (InsertionOrder.Num() >= UnrealClaudeConstants::MCPServer::MaxAssetSearchCursors)
+			{
+				Cursors.Remove(InsertionOrder[0]);
+				InsertionOrder.RemoveAt(0);
+			}
+
+			FAssetSearchCursor Cursor;
+			Cursor.AssetPaths = MoveTemp(AssetPaths);
+			Cursor.ExpiresAt = FPlatformTime::Seconds() +
+				UUnrealClaudeSettings::Get().AssetSearchCursorTTLSeconds;
+
+			FString Token = FGuid::NewGuid().ToString();
+			Cursors.Add(Token, MoveTemp(Cursor));
+			InsertionOrder.Add(Token);
+			return Token;
+		}
+
+		/** Copy one page out of a cached set; false if unknown or expired */
+		bool GetPage(const FString& Token, int32 Offset, int32 Limit,
+			TArray<FSoftObjectPath>& OutPage, int32& OutTotal)
+		{
+			FScopeLock Lock(&CursorsLock);
+
+			FAssetSearchCursor* Cursor = Cursors.Find(Token);
+			if (!Cursor || FPlatformTime::Seconds() > Cursor->ExpiresAt)
+			{
+				return false;
+			}
+
+			OutTotal = Cursor->AssetPaths.Num();
+			const int32 Start = FMath::Min(Offset, OutTotal);
+			const int32 Count = FMath::Min(Limit, OutTotal - Start);
+			OutPage.Reset(Count);
+			for (int32 Index = Start; Index < Start + Count; ++Index)
+			{
+				OutPage.Add(Cursor->AssetPaths[Index]);
+			}
+			return true;
+		}
+
+	private:
+		void PurgeExpired()
+		{
+			const double Now = FPlatformTime::Seconds();
+			for (int32 Index = InsertionOrder.Num() - 1; Index >= 0; --Index)
+			{
+				const FAssetSearchCursor* Cursor = Cursors.Find(InsertionOrder[Index]);
+				if (!Cursor || Now > Cursor->ExpiresAt)
+				{
+					Cursors.Remove(InsertionOrder[Index]);
+					InsertionOrder.RemoveAt(Index);
+				}
+			}
+		}
+
+		TMap<FString, FAssetSearchCursor> Cursors;
+
+		/** Token insertion order for LRU eviction */
+		TArray<FString> InsertionOrder;
+
+		FCriticalSection CursorsLock;
+	};
+}
 
 FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -10,12 +120,60 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	// Extract parameters
-	FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
-	FString PathFilter = ExtractOptionalString(Params, TEXT("path_filter"), TEXT("/Game/"));
-	FString NamePattern = ExtractOptionalString(Params, TEXT("name_pattern"));
-	int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), 100), 1, 1000);
-	int32 Offset = FMath::Max(0, ExtractOptionalNumber<int32>(Params, TEXT("offset"), 0));
+	// Extract parameters in one typed pass over the table the schema in
+	// GetInfo is generated from
+	FSearchParams Search;
+	ParamTable().Extract(Params, Search);
+	const FString& ClassFilter = Search.ClassFilter;
+	const FString& PathFilter = Search.PathFilter;
+	const FString& NamePattern = Search.NamePattern;
+	const int32 Limit = FMath::Clamp(Search.Limit, 1, 1000);
+	const int32 Offset = FMath::Max(0, Search.Offset);
+
+	// Cursor path: page straight out of the cached id list, no registry scan.
+	// Filters are ignored here - the cursor pins the set they produced.
+	const FString& CursorToken = Search.Cursor;
+	if (!CursorToken.IsEmpty())
+	{
+		TArray<FSoftObjectPath> PagePaths;
+		int32 CachedTotal = 0;
+		if (!FAssetSearchCursorStore::Get().GetPage(CursorToken, Offset, Limit, PagePaths, CachedTotal))
+		{
+			return FMCPToolResult::Error(TEXT("Unknown or expired cursor - re-run the search to get a fresh one"));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> AssetsArray;
+		AssetsArray.Reserve(PagePaths.Num());
+		for (const FSoftObjectPath& Path : PagePaths)
+		{
+			// Assets deleted since the set was cached just drop out of the page
+			FAssetData Asset = AssetRegistry.GetAssetByObjectPath(Path);
+			if (Asset.IsValid())
+			{
+				AssetsArray.Add(MakeShared<FJsonValueObject>(AssetDataToJson(Asset)));
+			}
+		}
+
+		const int32 StartIndex = FMath::Min(Offset, CachedTotal);
+		const int32 EndIndex = StartIndex + PagePaths.Num();
+		const bool bHasMore = EndIndex < CachedTotal;
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetArrayField(TEXT("assets"), AssetsArray);
+		ResultData->SetNumberField(TEXT("count"), AssetsArray.Num());
+		ResultData->SetNumberField(TEXT("total"), CachedTotal);
+		ResultData->SetNumberField(TEXT("offset"), StartIndex);
+		ResultData->SetNumberField(TEXT("limit"), Limit);
+		ResultData->SetBoolField(TEXT("hasMore"), bHasMore);
+		ResultData->SetStringField(TEXT("cursor"), CursorToken);
+		if (bHasMore)
+		{
+			ResultData->SetNumberField(TEXT("nextOffset"), EndIndex);
+		}
+
+		return FMCPToolResult::Success(FString::Printf(TEXT("Found %d assets (showing %d-%d of %d total)"),
+			AssetsArray.Num(), StartIndex + 1, EndIndex, CachedTotal), ResultData);
+	}
 
 	// Build FARFilter
 	FARFilter Filter;
@@ -72,39 +230,79 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 		Filter.ClassPaths.Add(FTopLevelAssetPath(ClassPath));
 	}
 
-	// Query assets
-	TArray<FAssetData> AllAssets;
-	AssetRegistry.GetAssets(Filter, AllAssets);
+	// Enumerate matching assets instead of materializing the full registry
+	// snapshot. The class/path filter is evaluated inside the registry, the
+	// name pattern is applied inline, and only the requested page is ever
+	// copied into FAssetData - on large projects this avoids copying
+	// hundreds of thousands of entries per call.
+	TArray<FAssetData> PageAssets;
+	PageAssets.Reserve(Limit);
+	TArray<FSoftObjectPath> MatchedPaths;
+	int32 Total = 0;
 
-	// Apply name pattern filter (post-query, case-insensitive)
-	TArray<FAssetData> FilteredAssets;
-	if (!NamePattern.IsEmpty())
+	// Pattern queries resolve against the trigram name index first, so only
+	// candidate names are verified instead of substring-matching the whole
+	// registry; the class/path filter then runs over just the candidates.
+	// Patterns the index cannot serve fall through to the full enumeration.
+	TArray<FSoftObjectPath> Candidates;
+	if (!NamePattern.IsEmpty() && FMCPAssetNameIndex::Get().QueryCandidates(NamePattern, Candidates))
 	{
-		for (const FAssetData& Asset : AllAssets)
+		TArray<FAssetData> Matched;
+		Matched.Reserve(Candidates.Num());
+		for (const FSoftObjectPath& CandidatePath : Candidates)
+		{
+			FAssetData Asset = AssetRegistry.GetAssetByObjectPath(CandidatePath);
+			if (Asset.IsValid())
+			{
+				Matched.Add(MoveTemp(Asset));
+			}
+		}
+		AssetRegistry.RunAssetsThroughFilter(Matched, Filter);
+
+		for (const FAssetData& Asset : Matched)
 		{
-			if (Asset.AssetName.ToString().Contains(NamePattern, ESearchCase::IgnoreCase))
+			if (Total >= Offset && PageAssets.Num() < Limit)
 			{
-				FilteredAssets.Add(Asset);
+				PageAssets.Add(Asset);
 			}
+			MatchedPaths.Add(Asset.GetSoftObjectPath());
+			Total++;
 		}
 	}
 	else
 	{
-		FilteredAssets = MoveTemp(AllAssets);
+		AssetRegistry.EnumerateAssets(Filter, [&](const FAssetData& Asset)
+		{
+			if (!NamePattern.IsEmpty() &&
+				!Asset.AssetName.ToString().Contains(NamePattern, ESearchCase::IgnoreCase))
+			{
+				return true; // Not a match, keep enumerating
+			}
+
+			if (Total >= Offset && PageAssets.Num() < Limit)
+			{
+				PageAssets.Add(Asset);
+			}
+
+			// The full id list feeds the cursor so later pages skip this scan
+			MatchedPaths.Add(Asset.GetSoftObjectPath());
+			Total++;
+			return true; // Keep counting for the 'total' field
+		});
 	}
 
 	// Calculate pagination
-	int32 Total = FilteredAssets.Num();
 	int32 StartIndex = FMath::Min(Offset, Total);
-	int32 EndIndex = FMath::Min(StartIndex + Limit, Total);
-	int32 Count = EndIndex - StartIndex;
+	int32 Count = PageAssets.Num();
+	int32 EndIndex = StartIndex + Count;
 	bool bHasMore = EndIndex < Total;
 
 	// Build result array
 	TArray<TSharedPtr<FJsonValue>> AssetsArray;
-	for (int32 i = StartIndex; i < EndIndex; ++i)
+	AssetsArray.Reserve(Count);
+	for (const FAssetData& Asset : PageAssets)
 	{
-		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetDataToJson(FilteredAssets[i])));
+		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetDataToJson(Asset)));
 	}
 
 	// Build result data
@@ -118,6 +316,11 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	if (bHasMore)
 	{
 		ResultData->SetNumberField(TEXT("nextOffset"), EndIndex);
+
+		// Cache the materialized set so page 2+ indexes into it instead of
+		// re-running the enumeration
+		ResultData->SetStringField(TEXT("cursor"),
+			FAssetSearchCursorStore::Get().Store(MoveTemp(MatchedPaths)));
 	}
 
 	// Build message
@@ -30,26 +30,50 @@ public:
 			"Common class types: Blueprint, StaticMesh, SkeletalMesh, Texture2D, Material, "
 			"MaterialInstance, AnimSequence, AnimBlueprint, SoundWave, ParticleSystem, NiagaraSystem\n\n"
 			"Returns: Array of assets with path, name, class, and package_path. "
-			"Use limit/offset for pagination on large result sets."
+			"Use limit/offset for pagination on large result sets. When more results "
+			"exist the response includes a 'cursor' token - pass it back with offset "
+			"to page through the cached result set without re-running the search."
 		);
-		Info.Parameters = {
-			FMCPToolParameter(TEXT("class_filter"), TEXT("string"),
-				TEXT("Asset class to filter by (e.g., 'Blueprint', 'StaticMesh', 'Texture2D')"), false),
-			FMCPToolParameter(TEXT("path_filter"), TEXT("string"),
-				TEXT("Path prefix to search within (e.g., '/Game/Characters/'). Searches recursively. Default: '/Game/'"), false, TEXT("/Game/")),
-			FMCPToolParameter(TEXT("name_pattern"), TEXT("string"),
-				TEXT("Substring to match in asset names (case-insensitive)"), false),
-			FMCPToolParameter(TEXT("limit"), TEXT("number"),
-				TEXT("Maximum results to return (1-1000, default: 100)"), false, TEXT("100")),
-			FMCPToolParameter(TEXT("offset"), TEXT("number"),
-				TEXT("Number of results to skip for pagination (default: 0)"), false, TEXT("0"))
-		};
+		Info.Parameters = ParamTable().BuildParameterList();
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
+	/** Asset registry queries are internally locked; no mutable engine state touched */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
 
+	/** Typed parameter block; defaults live in the member initializers */
+	struct FSearchParams
+	{
+		FString ClassFilter;
+		FString PathFilter = TEXT("/Game/");
+		FString NamePattern;
+		int32 Limit = 100;
+		int32 Offset = 0;
+		FString Cursor;
+	};
+
+	/** Single declaration of the parameter surface: the schema entries in
+	 *  GetInfo and the extraction in Execute both derive from this table */
+	static const auto& ParamTable()
+	{
+		static const auto Table = MakeMCPParamTable<FSearchParams>(
+			MCPParamField(TEXT("class_filter"), &FSearchParams::ClassFilter,
+				TEXT("Asset class to filter by (e.g., 'Blueprint', 'StaticMesh', 'Texture2D')")),
+			MCPParamField(TEXT("path_filter"), &FSearchParams::PathFilter,
+				TEXT("Path prefix to search within (e.g., '/Game/Characters/'). Searches recursively. Default: '/Game/'"), false, TEXT("/Game/")),
+			MCPParamField(TEXT("name_pattern"), &FSearchParams::NamePattern,
+				TEXT("Substring to match in asset names (case-insensitive)")),
+			MCPParamField(TEXT("limit"), &FSearchParams::Limit,
+				TEXT("Maximum results to return (1-1000, default: 100)"), false, TEXT("100")),
+			MCPParamField(TEXT("offset"), &FSearchParams::Offset,
+				TEXT("Number of results to skip for pagination (default: 0)"), false, TEXT("0")),
+			MCPParamField(TEXT("cursor"), &FSearchParams::Cursor,
+				TEXT("Cursor token from a previous response. Pages index into the cached result set; filters are ignored while paging")));
+		return Table;
+	}
+
 private:
 	/** Convert FAssetData to JSON object with full path information */
 	TSharedPtr<FJsonObject> AssetDataToJson(const FAssetData& AssetData) const;
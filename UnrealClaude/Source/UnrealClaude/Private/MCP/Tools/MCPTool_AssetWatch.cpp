@@ -0,0 +1,102 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_AssetWatch.h"
+#include "../MCPAssetWatchStore.h"
+
+namespace
+{
+	TSharedPtr<FJsonObject> WatchedAssetToJson(const FMCPAssetWatchStore::FWatchedAsset& Asset)
+	{
+		TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetStringField(TEXT("path"), Asset.ObjectPath);
+		Json->SetStringField(TEXT("name"), Asset.AssetName);
+		Json->SetStringField(TEXT("class"), Asset.ClassPath);
+		return Json;
+	}
+}
+
+FMCPToolResult FMCPTool_AssetWatch::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	FString Action;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("action"), Action, Error))
+	{
+		return Error.GetValue();
+	}
+
+	if (Action == TEXT("create"))
+	{
+		const FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
+		const FString PathFilter = ExtractOptionalString(Params, TEXT("path_filter"), TEXT("/Game/"));
+		const FString NamePattern = ExtractOptionalString(Params, TEXT("name_pattern"));
+
+		FString CreateError;
+		const FString WatchId = FMCPAssetWatchStore::Get().CreateWatch(
+			ClassFilter, PathFilter, NamePattern, CreateError);
+		if (WatchId.IsEmpty())
+		{
+			return FMCPToolResult::Error(CreateError);
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("watch_id"), WatchId);
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Watch registered: %s"), *WatchId), ResultData);
+	}
+
+	if (Action == TEXT("poll") || Action == TEXT("cancel"))
+	{
+		FString WatchId;
+		if (!ExtractRequiredString(Params, TEXT("watch_id"), WatchId, Error))
+		{
+			return Error.GetValue();
+		}
+
+		if (Action == TEXT("cancel"))
+		{
+			if (!FMCPAssetWatchStore::Get().CancelWatch(WatchId))
+			{
+				return FMCPToolResult::Error(
+					FString::Printf(TEXT("Unknown watch: %s"), *WatchId));
+			}
+			return FMCPToolResult::Success(
+				FString::Printf(TEXT("Watch cancelled: %s"), *WatchId));
+		}
+
+		TArray<FMCPAssetWatchStore::FWatchedAsset> Added;
+		TArray<FMCPAssetWatchStore::FWatchedAsset> Removed;
+		bool bOverflowed = false;
+		if (!FMCPAssetWatchStore::Get().PollWatch(WatchId, Added, Removed, bOverflowed))
+		{
+			return FMCPToolResult::Error(FString::Printf(
+				TEXT("Unknown or expired watch: %s - re-create it"), *WatchId));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> AddedArray;
+		AddedArray.Reserve(Added.Num());
+		for (const FMCPAssetWatchStore::FWatchedAsset& Asset : Added)
+		{
+			AddedArray.Add(MakeShared<FJsonValueObject>(WatchedAssetToJson(Asset)));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> RemovedArray;
+		RemovedArray.Reserve(Removed.Num());
+		for (const FMCPAssetWatchStore::FWatchedAsset& Asset : Removed)
+		{
+			RemovedArray.Add(MakeShared<FJsonValueObject>(WatchedAssetToJson(Asset)));
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("watch_id"), WatchId);
+		ResultData->SetArrayField(TEXT("added"), AddedArray);
+		ResultData->SetArrayField(TEXT("removed"), RemovedArray);
+		ResultData->SetBoolField(TEXT("overflowed"), bOverflowed);
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("%d added, %d removed since last poll"),
+				Added.Num(), Removed.Num()),
+			ResultData);
+	}
+
+	return FMCPToolResult::Error(FString::Printf(
+		TEXT("Unknown action '%s'. Valid actions: create, poll, cancel"), *Action));
+}
@@ -0,0 +1,58 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+/**
+ * MCP Tool: Watch for asset changes matching a saved search
+ *
+ * Registers a persistent query with asset_search's filters; asset
+ * registry events feed it deltas, so polling returns only what changed
+ * instead of re-running a full search.
+ */
+class FMCPTool_AssetWatch : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("asset_watch");
+		Info.Description = TEXT(
+			"Watch for assets being created, deleted, or renamed that match a saved search.\n\n"
+			"Use this instead of re-running asset_search in a loop when monitoring for "
+			"changes: a watch evaluates registry events as they happen, and polling it "
+			"returns only the assets that entered or left the match set since the last "
+			"poll - no scan cost.\n\n"
+			"Actions:\n"
+			"- 'create': Register a watch. Takes the same class_filter/path_filter/"
+			"name_pattern as asset_search (all optional, AND logic). Returns watch_id.\n"
+			"- 'poll': Return and clear deltas accumulated since the last poll: 'added' "
+			"and 'removed' arrays of assets. If 'overflowed' is true, deltas were dropped - "
+			"re-run a full asset_search to resynchronize.\n"
+			"- 'cancel': Unregister a watch.\n\n"
+			"Watches expire when not polled for a while; poll at least occasionally or "
+			"re-create on an unknown-watch error. Renames appear as a removal at the old "
+			"path plus an addition at the new one."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("action"), TEXT("string"),
+				TEXT("Operation: 'create', 'poll', or 'cancel'"), true),
+			FMCPToolParameter(TEXT("watch_id"), TEXT("string"),
+				TEXT("Watch token from 'create' (required for 'poll' and 'cancel')"), false),
+			FMCPToolParameter(TEXT("class_filter"), TEXT("string"),
+				TEXT("Asset class to filter by (e.g., 'Blueprint', 'StaticMesh')"), false),
+			FMCPToolParameter(TEXT("path_filter"), TEXT("string"),
+				TEXT("Path prefix to watch within (e.g., '/Game/Characters/'). Recursive. Default: '/Game/'"), false, TEXT("/Game/")),
+			FMCPToolParameter(TEXT("name_pattern"), TEXT("string"),
+				TEXT("Substring to match in asset names (case-insensitive)"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	/** Watch store state is lock-protected; no engine state touched */
+	virtual bool IsThreadSafe() const override { return true; }
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
@@ -0,0 +1,110 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_AssetsMetadata.h"
+#include "../MCPAssetGraphCache.h"
+#include "UnrealClaudeConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+
+FMCPToolResult FMCPTool_AssetsMetadata::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	const TArray<TSharedPtr<FJsonValue>>* PathValues;
+	if (!Params->TryGetArrayField(TEXT("asset_paths"), PathValues) || PathValues->Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("Missing required parameter: asset_paths (non-empty array of object paths)"));
+	}
+
+	if (PathValues->Num() > UnrealClaudeConstants::MCPServer::MaxAssetsMetadataBatch)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("asset_paths exceeds the batch limit of %d - split the request"),
+			UnrealClaudeConstants::MCPServer::MaxAssetsMetadataBatch));
+	}
+
+	const bool bIncludeTags = ExtractOptionalBool(Params, TEXT("include_tags"), true);
+	const bool bIncludeDependencies = ExtractOptionalBool(Params, TEXT("include_dependencies"), true);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<TSharedPtr<FJsonValue>> AssetsArray;
+	AssetsArray.Reserve(PathValues->Num());
+	int32 FoundCount = 0;
+
+	for (const TSharedPtr<FJsonValue>& PathValue : *PathValues)
+	{
+		FString AssetPath;
+		if (!PathValue.IsValid() || !PathValue->TryGetString(AssetPath) || AssetPath.IsEmpty())
+		{
+			continue;
+		}
+
+		FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+		if (!Asset.IsValid())
+		{
+			// Report the miss in place so the caller can align results to its
+			// request order without failing the rest of the batch
+			TSharedPtr<FJsonObject> Missing = MakeShared<FJsonObject>();
+			Missing->SetStringField(TEXT("path"), AssetPath);
+			Missing->SetBoolField(TEXT("found"), false);
+			AssetsArray.Add(MakeShared<FJsonValueObject>(Missing));
+			continue;
+		}
+
+		AssetsArray.Add(MakeShared<FJsonValueObject>(
+			BuildMetadataJson(Asset, AssetRegistry, bIncludeTags, bIncludeDependencies)));
+		FoundCount++;
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("assets"), AssetsArray);
+	ResultData->SetNumberField(TEXT("requested"), PathValues->Num());
+	ResultData->SetNumberField(TEXT("found"), FoundCount);
+
+	return FMCPToolResult::Success(FString::Printf(TEXT("Resolved %d of %d assets"),
+		FoundCount, PathValues->Num()), ResultData);
+}
+
+TSharedPtr<FJsonObject> FMCPTool_AssetsMetadata::BuildMetadataJson(const FAssetData& Asset,
+	IAssetRegistry& AssetRegistry, bool bIncludeTags, bool bIncludeDependencies) const
+{
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetStringField(TEXT("path"), Asset.GetObjectPathString());
+	Json->SetBoolField(TEXT("found"), true);
+	Json->SetStringField(TEXT("name"), Asset.AssetName.ToString());
+	Json->SetStringField(TEXT("class"), Asset.AssetClassPath.GetAssetName().ToString());
+	Json->SetStringField(TEXT("package_path"), Asset.PackagePath.ToString());
+
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Asset.PackageName);
+	if (PackageData.IsSet())
+	{
+		Json->SetNumberField(TEXT("disk_size"), static_cast<double>(PackageData->DiskSize));
+	}
+
+	if (bIncludeTags)
+	{
+		TSharedPtr<FJsonObject> TagsJson = MakeShared<FJsonObject>();
+		for (const auto& Tag : Asset.TagsAndValues)
+		{
+			TagsJson->SetStringField(Tag.Key.ToString(), Tag.Value.AsString());
+		}
+		Json->SetObjectField(TEXT("tags"), TagsJson);
+	}
+
+	if (bIncludeDependencies)
+	{
+		// Served from the shared dependency cache the asset_dependencies
+		// tool uses, so repeated batches stay cheap
+		TArray<FName> Dependencies;
+		FMCPAssetGraphCache::Get().GetDependencies(Asset.PackageName, /*bHardOnly*/ false, Dependencies);
+
+		TArray<TSharedPtr<FJsonValue>> DepsArray;
+		DepsArray.Reserve(Dependencies.Num());
+		for (const FName& Dependency : Dependencies)
+		{
+			DepsArray.Add(MakeShared<FJsonValueString>(Dependency.ToString()));
+		}
+		Json->SetArrayField(TEXT("dependencies"), DepsArray);
+	}
+
+	return Json;
+}
@@ -0,0 +1,53 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+/**
+ * MCP Tool: Fetch metadata for many assets in one call
+ *
+ * Agents follow asset_search with per-asset queries to inspect each
+ * result, turning one logical operation into dozens of HTTP round-trips.
+ * This accepts an array of object paths and returns class, registry tags,
+ * disk size and package dependencies for all of them in a single hop
+ * against the asset registry.
+ */
+class FMCPTool_AssetsMetadata : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("get_assets_metadata");
+		Info.Description = TEXT(
+			"Fetch metadata for a batch of assets in one call.\n\n"
+			"Pass the object paths returned by asset_search (up to 200 per call) "
+			"instead of querying each asset individually. For every path the "
+			"response carries name, class, package_path, disk_size, the asset "
+			"registry tags, and package dependencies.\n\n"
+			"Paths that do not resolve are reported with found=false rather than "
+			"failing the whole batch."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("asset_paths"), TEXT("array"),
+				TEXT("Object paths to look up (e.g., '/Game/Characters/BP_Player.BP_Player')"), true),
+			FMCPToolParameter(TEXT("include_tags"), TEXT("boolean"),
+				TEXT("Include asset registry tag/value pairs (default: true)"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("include_dependencies"), TEXT("boolean"),
+				TEXT("Include package dependency lists (default: true)"), false, TEXT("true"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	/** Registry and dependency-cache queries only; no mutable engine state */
+	virtual bool IsThreadSafe() const override { return true; }
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Build the metadata object for one resolved asset */
+	TSharedPtr<FJsonObject> BuildMetadataJson(const struct FAssetData& Asset,
+		class IAssetRegistry& AssetRegistry, bool bIncludeTags, bool bIncludeDependencies) const;
+};
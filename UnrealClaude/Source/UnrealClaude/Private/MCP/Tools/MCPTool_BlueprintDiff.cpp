@@ -0,0 +1,387 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_BlueprintDiff.h"
+#include "BlueprintUtils.h"
+#include "MCP/MCPParamValidator.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+
+namespace
+{
+	/**
+	 * Compact structural fingerprint of one graph node. Strings only - the
+	 * snapshot must stay valid across edits that delete the node it describes,
+	 * so it never holds object pointers.
+	 */
+	struct FNodeFingerprint
+	{
+		/** Node class name (K2Node_CallFunction, ...) */
+		FString NodeClass;
+
+		/** Display title, which captures the bound function/variable/event */
+		FString Title;
+
+		/** Graph the node lives in */
+		FString GraphName;
+
+		/** MCP node id if one was assigned by blueprint_modify */
+		FString McpNodeId;
+
+		int32 PosX = 0;
+		int32 PosY = 0;
+
+		/** One signature per pin, keyed by "direction:name" */
+		TMap<FString, FString> PinSignatures;
+	};
+
+	/** Fingerprints for a whole blueprint, keyed by node GUID */
+	struct FBlueprintSnapshot
+	{
+		FString BlueprintPath;
+		FDateTime TakenAt;
+		TMap<FString, FNodeFingerprint> Nodes;
+	};
+
+	/**
+	 * Snapshot store for blueprint_diff. Bounded LRU - an agent session keeps
+	 * one live snapshot per blueprint it is editing, so a small cap covers
+	 * real use while a leaked id can never grow memory unbounded.
+	 *
+	 * Game thread only, like all tool execution.
+	 */
+	class FBlueprintDiffSnapshotStore
+	{
+	public:
+		static FBlueprintDiffSnapshotStore& Get()
+		{
+			static FBlueprintDiffSnapshotStore Instance;
+			return Instance;
+		}
+
+		FString Store(FBlueprintSnapshot&& Snapshot)
+		{
+			while (InsertionOrder.Num() >= UnrealClaudeConstants::MCPServer::MaxBlueprintDiffSnapshots)
+			{
+				Snapshots.Remove(InsertionOrder[0]);
+				InsertionOrder.RemoveAt(0);
+			}
+
+			FString SnapshotId = FGuid::NewGuid().ToString();
+			Snapshots.Add(SnapshotId, MoveTemp(Snapshot));
+			InsertionOrder.Add(SnapshotId);
+			return SnapshotId;
+		}
+
+		FBlueprintSnapshot* Find(const FString& SnapshotId)
+		{
+			return Snapshots.Find(SnapshotId);
+		}
+
+	private:
+		TMap<FString, FBlueprintSnapshot> Snapshots;
+		TArray<FString> InsertionOrder;
+	};
+
+	/** Signature capturing everything about a pin the diff should notice:
+	 *  type, default value and the set of pins it links to */
+	FString MakePinSignature(const UEdGraphPin* Pin)
+	{
+		TArray<FString> Links;
+		for (const UEdGraphPin* Linked : Pin->LinkedTo)
+		{
+			if (Linked && Linked->GetOwningNode())
+			{
+				Links.Add(Linked->GetOwningNode()->NodeGuid.ToString() + TEXT(".") + Linked->PinName.ToString());
+			}
+		}
+		// Link order is not structural - sort so reorderings don't diff
+		Links.Sort();
+
+		return FString::Printf(TEXT("%s|%s|%s"),
+			*FBlueprintEditor::PinTypeToString(Pin->PinType),
+			*Pin->GetDefaultAsString(),
+			*FString::Join(Links, TEXT(",")));
+	}
+
+	void FingerprintGraph(UEdGraph* Graph, TMap<FString, FNodeFingerprint>& OutNodes)
+	{
+		if (!Graph)
+		{
+			return;
+		}
+
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			FNodeFingerprint& Fingerprint = OutNodes.Add(Node->NodeGuid.ToString());
+			Fingerprint.NodeClass = Node->GetClass()->GetName();
+			Fingerprint.Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+			Fingerprint.GraphName = Graph->GetName();
+			Fingerprint.McpNodeId = FBlueprintGraphEditor::GetNodeId(Node);
+			Fingerprint.PosX = Node->NodePosX;
+			Fingerprint.PosY = Node->NodePosY;
+
+			for (const UEdGraphPin* Pin : Node->Pins)
+			{
+				if (Pin)
+				{
+					const FString PinKey = FString::Printf(TEXT("%s:%s"),
+						Pin->Direction == EGPD_Input ? TEXT("in") : TEXT("out"),
+						*Pin->PinName.ToString());
+					Fingerprint.PinSignatures.Add(PinKey, MakePinSignature(Pin));
+				}
+			}
+		}
+	}
+
+	/** Fingerprint every graph blueprint_modify can touch */
+	void CaptureSnapshot(UBlueprint* Blueprint, FBlueprintSnapshot& OutSnapshot)
+	{
+		OutSnapshot.BlueprintPath = Blueprint->GetPathName();
+		OutSnapshot.TakenAt = FDateTime::UtcNow();
+
+		for (UEdGraph* Graph : Blueprint->UbergraphPages)
+		{
+			FingerprintGraph(Graph, OutSnapshot.Nodes);
+		}
+		for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+		{
+			FingerprintGraph(Graph, OutSnapshot.Nodes);
+		}
+		for (UEdGraph* Graph : Blueprint->MacroGraphs)
+		{
+			FingerprintGraph(Graph, OutSnapshot.Nodes);
+		}
+	}
+
+	/** Shared shape for node entries in the diff arrays */
+	TSharedPtr<FJsonObject> MakeNodeEntry(const FString& NodeGuid, const FNodeFingerprint& Fingerprint)
+	{
+		TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("node_guid"), NodeGuid);
+		Entry->SetStringField(TEXT("class"), Fingerprint.NodeClass);
+		Entry->SetStringField(TEXT("title"), Fingerprint.Title);
+		Entry->SetStringField(TEXT("graph"), Fingerprint.GraphName);
+		if (!Fingerprint.McpNodeId.IsEmpty())
+		{
+			Entry->SetStringField(TEXT("node_id"), Fingerprint.McpNodeId);
+		}
+		return Entry;
+	}
+}
+
+FMCPToolResult FMCPTool_BlueprintDiff::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	FString Operation;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("operation"), Operation, Error))
+	{
+		return Error.GetValue();
+	}
+
+	Operation = Operation.ToLower();
+
+	if (Operation == TEXT("snapshot"))
+	{
+		return ExecuteSnapshot(Params);
+	}
+	else if (Operation == TEXT("diff"))
+	{
+		return ExecuteDiff(Params);
+	}
+
+	return FMCPToolResult::Error(FString::Printf(
+		TEXT("Unknown operation: '%s'. Valid operations: 'snapshot', 'diff'"), *Operation));
+}
+
+FMCPToolResult FMCPTool_BlueprintDiff::ExecuteSnapshot(const TSharedRef<FJsonObject>& Params)
+{
+	FString BlueprintPath;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("blueprint_path"), BlueprintPath, Error))
+	{
+		return Error.GetValue();
+	}
+
+	FString ValidationError;
+	if (!FMCPParamValidator::ValidateBlueprintPath(BlueprintPath, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	FString LoadError;
+	UBlueprint* Blueprint = FBlueprintUtils::LoadBlueprint(BlueprintPath, LoadError);
+	if (!Blueprint)
+	{
+		return FMCPToolResult::Error(LoadError);
+	}
+
+	FBlueprintSnapshot Snapshot;
+	CaptureSnapshot(Blueprint, Snapshot);
+	const int32 NodeCount = Snapshot.Nodes.Num();
+
+	const FString SnapshotId = FBlueprintDiffSnapshotStore::Get().Store(MoveTemp(Snapshot));
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("snapshot_id"), SnapshotId);
+	ResultData->SetStringField(TEXT("blueprint_path"), BlueprintPath);
+	ResultData->SetNumberField(TEXT("node_count"), NodeCount);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Snapshot of %s (%d nodes)"), *Blueprint->GetName(), NodeCount),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_BlueprintDiff::ExecuteDiff(const TSharedRef<FJsonObject>& Params)
+{
+	FString SnapshotId;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("snapshot_id"), SnapshotId, Error))
+	{
+		return Error.GetValue();
+	}
+
+	FBlueprintSnapshot* Snapshot = FBlueprintDiffSnapshotStore::Get().Find(SnapshotId);
+	if (!Snapshot)
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Snapshot not found: %s (snapshots are in-memory and bounded - take a fresh one)"), *SnapshotId));
+	}
+
+	FString LoadError;
+	UBlueprint* Blueprint = FBlueprintUtils::LoadBlueprint(Snapshot->BlueprintPath, LoadError);
+	if (!Blueprint)
+	{
+		return FMCPToolResult::Error(LoadError);
+	}
+
+	FBlueprintSnapshot Current;
+	CaptureSnapshot(Blueprint, Current);
+
+	TArray<TSharedPtr<FJsonValue>> Added;
+	TArray<TSharedPtr<FJsonValue>> Removed;
+	TArray<TSharedPtr<FJsonValue>> Changed;
+	int32 UnchangedCount = 0;
+
+	// Removed: in the snapshot, gone now
+	for (const auto& Pair : Snapshot->Nodes)
+	{
+		if (!Current.Nodes.Contains(Pair.Key))
+		{
+			Removed.Add(MakeShared<FJsonValueObject>(MakeNodeEntry(Pair.Key, Pair.Value)));
+		}
+	}
+
+	// Added and changed: walk the current state against the snapshot
+	for (const auto& Pair : Current.Nodes)
+	{
+		const FNodeFingerprint* Old = Snapshot->Nodes.Find(Pair.Key);
+		if (!Old)
+		{
+			Added.Add(MakeShared<FJsonValueObject>(MakeNodeEntry(Pair.Key, Pair.Value)));
+			continue;
+		}
+
+		const FNodeFingerprint& New = Pair.Value;
+
+		TArray<TSharedPtr<FJsonValue>> Changes;
+		if (Old->Title != New.Title)
+		{
+			Changes.Add(MakeShared<FJsonValueString>(TEXT("title")));
+		}
+		if (Old->PosX != New.PosX || Old->PosY != New.PosY)
+		{
+			Changes.Add(MakeShared<FJsonValueString>(TEXT("position")));
+		}
+
+		// Pin-level diff: signatures fold type, default value and link set,
+		// so one comparison per pin catches rewires and value edits alike
+		TArray<TSharedPtr<FJsonValue>> AddedPins;
+		TArray<TSharedPtr<FJsonValue>> RemovedPins;
+		TArray<TSharedPtr<FJsonValue>> ChangedPins;
+
+		for (const auto& PinPair : Old->PinSignatures)
+		{
+			if (!New.PinSignatures.Contains(PinPair.Key))
+			{
+				RemovedPins.Add(MakeShared<FJsonValueString>(PinPair.Key));
+			}
+		}
+		for (const auto& PinPair : New.PinSignatures)
+		{
+			const FString* OldSignature = Old->PinSignatures.Find(PinPair.Key);
+			if (!OldSignature)
+			{
+				AddedPins.Add(MakeShared<FJsonValueString>(PinPair.Key));
+			}
+			else if (*OldSignature != PinPair.Value)
+			{
+				TSharedPtr<FJsonObject> PinChange = MakeShared<FJsonObject>();
+				PinChange->SetStringField(TEXT("pin"), PinPair.Key);
+				PinChange->SetStringField(TEXT("was"), *OldSignature);
+				PinChange->SetStringField(TEXT("now"), PinPair.Value);
+				ChangedPins.Add(MakeShared<FJsonValueObject>(PinChange));
+			}
+		}
+
+		if (AddedPins.Num() + RemovedPins.Num() + ChangedPins.Num() > 0)
+		{
+			Changes.Add(MakeShared<FJsonValueString>(TEXT("pins")));
+		}
+
+		if (Changes.Num() == 0)
+		{
+			UnchangedCount++;
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> Entry = MakeNodeEntry(Pair.Key, New);
+		Entry->SetArrayField(TEXT("changes"), Changes);
+		if (AddedPins.Num() > 0)
+		{
+			Entry->SetArrayField(TEXT("added_pins"), AddedPins);
+		}
+		if (RemovedPins.Num() > 0)
+		{
+			Entry->SetArrayField(TEXT("removed_pins"), RemovedPins);
+		}
+		if (ChangedPins.Num() > 0)
+		{
+			Entry->SetArrayField(TEXT("changed_pins"), ChangedPins);
+		}
+		Changed.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+
+	const int32 AddedCount = Added.Num();
+	const int32 RemovedCount = Removed.Num();
+	const int32 ChangedCount = Changed.Num();
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("snapshot_id"), SnapshotId);
+	ResultData->SetStringField(TEXT("blueprint_path"), Snapshot->BlueprintPath);
+	ResultData->SetArrayField(TEXT("added"), Added);
+	ResultData->SetArrayField(TEXT("removed"), Removed);
+	ResultData->SetArrayField(TEXT("changed"), Changed);
+	ResultData->SetNumberField(TEXT("unchanged_count"), UnchangedCount);
+
+	// Roll the snapshot forward so the next diff reports only new changes
+	const bool bUpdateSnapshot = ExtractOptionalBool(Params, TEXT("update_snapshot"), true);
+	if (bUpdateSnapshot)
+	{
+		*Snapshot = MoveTemp(Current);
+		ResultData->SetBoolField(TEXT("snapshot_updated"), true);
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Diff for %s: %d added, %d removed, %d changed, %d unchanged"),
+			*Blueprint->GetName(), AddedCount, RemovedCount, ChangedCount, UnchangedCount),
+		ResultData);
+}
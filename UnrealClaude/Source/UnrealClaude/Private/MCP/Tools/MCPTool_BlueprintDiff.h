@@ -0,0 +1,66 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+/**
+ * MCP Tool: Structural Blueprint diff against a prior snapshot
+ *
+ * Verifying an edit by re-running blueprint_query means re-serializing and
+ * shipping the whole graph to diff it client-side. This tool keeps a compact
+ * per-node fingerprint (class, title, position, pin signatures) server-side
+ * and returns only what actually changed, so verification cost is
+ * proportional to the edit, not the blueprint.
+ *
+ * Operations:
+ *   - snapshot: Fingerprint the blueprint's graphs, returns a snapshot_id
+ *   - diff: Compare the current graphs against a snapshot_id, returns
+ *           added/removed/changed nodes with per-pin detail
+ */
+class FMCPTool_BlueprintDiff : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("blueprint_diff");
+		Info.Description = TEXT(
+			"Structural Blueprint diff against a prior snapshot (read-only).\n\n"
+			"Operations:\n"
+			"- 'snapshot': Fingerprint the blueprint's graphs and return a snapshot_id\n"
+			"- 'diff': Compare current graphs against a snapshot_id; returns only "
+			"added/removed/changed nodes and their pin-level changes\n\n"
+			"Workflow for cheap edit verification:\n"
+			"1. blueprint_diff(operation='snapshot', blueprint_path=...) -> snapshot_id\n"
+			"2. Make edits with blueprint_modify\n"
+			"3. blueprint_diff(operation='diff', snapshot_id=...) -> just the delta\n\n"
+			"By default 'diff' also updates the snapshot in place, so each diff "
+			"reports the changes since the previous one.\n\n"
+			"Returns: added / removed / changed node arrays, each entry carrying "
+			"node id, class, graph and (for changes) which pins differ."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("operation"), TEXT("string"),
+				TEXT("Operation: 'snapshot' or 'diff'"), true),
+			FMCPToolParameter(TEXT("blueprint_path"), TEXT("string"),
+				TEXT("Full Blueprint asset path (required for snapshot; diff uses the path stored with the snapshot)"), false),
+			FMCPToolParameter(TEXT("snapshot_id"), TEXT("string"),
+				TEXT("Snapshot to diff against (required for diff)"), false),
+			FMCPToolParameter(TEXT("update_snapshot"), TEXT("boolean"),
+				TEXT("After a diff, replace the stored snapshot with the current state so the next diff is incremental"), false, TEXT("true"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Capture a snapshot and return its id */
+	FMCPToolResult ExecuteSnapshot(const TSharedRef<FJsonObject>& Params);
+
+	/** Diff the current graphs against a stored snapshot */
+	FMCPToolResult ExecuteDiff(const TSharedRef<FJsonObject>& Params);
+};
@@ -21,6 +21,7 @@ namespace BlueprintModifyOps
 	static const FString ConnectPins = TEXT("connect_pins");
 	static const FString DisconnectPins = TEXT("disconnect_pins");
 	static const FString SetPinValue = TEXT("set_pin_value");
+	static const FString Compile = TEXT("compile");
 }
 
 FMCPToolResult FMCPTool_BlueprintModify::Execute(const TSharedRef<FJsonObject>& Params)
@@ -82,12 +83,36 @@ FMCPToolResult FMCPTool_BlueprintModify::Execute(const TSharedRef<FJsonObject>&
 	{
 		return ExecuteSetPinValue(Params);
 	}
+	// Explicit compile (closes a defer_compile edit session)
+	if (Operation == BlueprintModifyOps::Compile)
+	{
+		return ExecuteCompile(Params);
+	}
 
 	return FMCPToolResult::Error(FString::Printf(
-		TEXT("Unknown operation: '%s'. Valid: create, add_variable, remove_variable, add_function, remove_function, add_node, add_nodes, delete_node, connect_pins, disconnect_pins, set_pin_value"),
+		TEXT("Unknown operation: '%s'. Valid: create, add_variable, remove_variable, add_function, remove_function, add_node, add_nodes, delete_node, connect_pins, disconnect_pins, set_pin_value, compile"),
 		*Operation));
 }
 
+FMCPToolResult FMCPTool_BlueprintModify::ExecuteCompile(const TSharedRef<FJsonObject>& Params)
+{
+	FMCPBlueprintLoadContext Context;
+	if (auto Error = Context.LoadAndValidate(Params))
+	{
+		return Error.GetValue();
+	}
+
+	// This is the compile that a deferred session has been postponing
+	Context.bDeferCompile = false;
+
+	if (auto CompileError = Context.CompileAndFinalize(TEXT("Compile")))
+	{
+		return CompileError.GetValue();
+	}
+
+	return FMCPToolResult::Success(TEXT("Blueprint compiled"), Context.BuildResultJson());
+}
+
 FMCPToolResult FMCPTool_BlueprintModify::ExecuteCreate(const TSharedRef<FJsonObject>& Params)
 {
 	// Extract parameters
@@ -491,20 +516,26 @@ FMCPToolResult FMCPTool_BlueprintModify::ExecuteAddNodes(const TSharedRef<FJsonO
 		return FMCPToolResult::Error(GraphError);
 	}
 
-	// Create all nodes using helper
+	// Create all nodes and connections inside one bulk-edit scope: per-call
+	// skeleton recompiles are suppressed and a single reconstruct/notify
+	// pass runs when the scope closes
 	TArray<FString> CreatedNodeIds;
 	TArray<TSharedPtr<FJsonValue>> CreatedNodes;
-	FString CreateError;
-	if (!CreateNodesFromSpec(Graph, *NodesArray, CreatedNodeIds, CreatedNodes, CreateError))
 	{
-		return FMCPToolResult::Error(CreateError);
-	}
+		FBlueprintGraphEditor::FScopedBulkGraphEdit BulkEdit(Graph);
 
-	// Process connections using helper
-	const TArray<TSharedPtr<FJsonValue>>* ConnectionsArray;
-	if (Params->TryGetArrayField(TEXT("connections"), ConnectionsArray))
-	{
-		ProcessNodeConnections(Graph, *ConnectionsArray, CreatedNodeIds);
+		FString CreateError;
+		if (!CreateNodesFromSpec(Graph, *NodesArray, CreatedNodeIds, CreatedNodes, CreateError))
+		{
+			return FMCPToolResult::Error(CreateError);
+		}
+
+		// Process connections using helper
+		const TArray<TSharedPtr<FJsonValue>>* ConnectionsArray;
+		if (Params->TryGetArrayField(TEXT("connections"), ConnectionsArray))
+		{
+			ProcessNodeConnections(Graph, *ConnectionsArray, CreatedNodeIds);
+		}
 	}
 
 	// Compile and finalize
@@ -44,6 +44,8 @@ public:
 			"Node types: CallFunction, Branch, Event, VariableGet, VariableSet, Sequence, "
 			"PrintString, Add, Subtract, Multiply, Divide\n\n"
 			"Variable types: bool, int32, float, FString, FVector, FRotator, AActor*, UObject*, etc.\n\n"
+			"Deferred compilation: pass defer_compile=true on successive edits to skip the "
+			"per-operation compile, then finish with the 'compile' operation.\n\n"
 			"Returns: Operation result with created node IDs (for subsequent connections)."
 		);
 		Info.Parameters = {
@@ -111,7 +113,11 @@ public:
 			FMCPToolParameter(TEXT("pin_name"), TEXT("string"),
 				TEXT("Pin name to set value"), false),
 			FMCPToolParameter(TEXT("pin_value"), TEXT("string"),
-				TEXT("Default value to set"), false)
+				TEXT("Default value to set"), false),
+
+			// Deferred compilation
+			FMCPToolParameter(TEXT("defer_compile"), TEXT("boolean"),
+				TEXT("Skip the post-operation compile; finish the edit session with the 'compile' operation (default: false)"), false, TEXT("false"))
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
@@ -137,6 +143,9 @@ private:
 	FMCPToolResult ExecuteDisconnectPins(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteSetPinValue(const TSharedRef<FJsonObject>& Params);
 
+	// Explicit compile (closes a defer_compile edit session)
+	FMCPToolResult ExecuteCompile(const TSharedRef<FJsonObject>& Params);
+
 	// Helpers
 	EBlueprintType ParseBlueprintType(const FString& TypeString);
 
@@ -6,6 +6,81 @@
 #include "UnrealClaudeModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Blueprint.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+	/**
+	 * Snapshot cache for inspect/get_graph responses
+	 *
+	 * Walking every graph, node and pin costs hundreds of milliseconds on
+	 * large blueprints, and agents re-query the same blueprint after every
+	 * small edit. Snapshots are invalidated through UBlueprint::OnChanged
+	 * (broadcast on any modification, including edits made outside MCP), so
+	 * a cache hit means the blueprint is unchanged since serialization and
+	 * the stored JSON can be returned as-is.
+	 *
+	 * Game thread only, like all tool execution.
+	 */
+	class FBlueprintSnapshotCache
+	{
+	public:
+		static FBlueprintSnapshotCache& Get()
+		{
+			static FBlueprintSnapshotCache Instance;
+			return Instance;
+		}
+
+		TSharedPtr<FJsonObject> Find(UBlueprint* Blueprint, const FString& SnapshotKey) const
+		{
+			if (const FCachedBlueprint* Entry = Entries.Find(FObjectKey(Blueprint)))
+			{
+				if (const TSharedPtr<FJsonObject>* Snapshot = Entry->Snapshots.Find(SnapshotKey))
+				{
+					return *Snapshot;
+				}
+			}
+			return nullptr;
+		}
+
+		void Store(UBlueprint* Blueprint, const FString& SnapshotKey, const TSharedPtr<FJsonObject>& Snapshot)
+		{
+			FCachedBlueprint& Entry = Entries.FindOrAdd(FObjectKey(Blueprint));
+			if (!Entry.OnChangedHandle.IsValid())
+			{
+				Entry.OnChangedHandle = Blueprint->OnChanged().AddLambda([](UBlueprint* Changed)
+				{
+					Get().Invalidate(Changed);
+				});
+			}
+			Entry.Snapshots.Add(SnapshotKey, Snapshot);
+		}
+
+		void Invalidate(UBlueprint* Blueprint)
+		{
+			FCachedBlueprint Entry;
+			if (Entries.RemoveAndCopyValue(FObjectKey(Blueprint), Entry))
+			{
+				if (Blueprint && Entry.OnChangedHandle.IsValid())
+				{
+					Blueprint->OnChanged().Remove(Entry.OnChangedHandle);
+				}
+			}
+		}
+
+	private:
+		struct FCachedBlueprint
+		{
+			/** Serialized responses keyed by operation + option flags */
+			TMap<FString, TSharedPtr<FJsonObject>> Snapshots;
+
+			/** Invalidation hook on the source blueprint */
+			FDelegateHandle OnChangedHandle;
+		};
+
+		TMap<FObjectKey, FCachedBlueprint> Entries;
+	};
+}
 
 FMCPToolResult FMCPTool_BlueprintQuery::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -196,13 +271,22 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteInspect(const TSharedRef<FJsonObj
 	bool bIncludeFunctions = ExtractOptionalBool(Params, TEXT("include_functions"), true);
 	bool bIncludeGraphs = ExtractOptionalBool(Params, TEXT("include_graphs"), false);
 
-	// Serialize Blueprint info
-	TSharedPtr<FJsonObject> BlueprintInfo = FBlueprintUtils::SerializeBlueprintInfo(
-		Blueprint,
-		bIncludeVariables,
-		bIncludeFunctions,
-		bIncludeGraphs
-	);
+	// Return the cached snapshot when the blueprint is unchanged
+	const FString SnapshotKey = FString::Printf(TEXT("inspect:%d%d%d"),
+		bIncludeVariables, bIncludeFunctions, bIncludeGraphs);
+	TSharedPtr<FJsonObject> BlueprintInfo = FBlueprintSnapshotCache::Get().Find(Blueprint, SnapshotKey);
+
+	if (!BlueprintInfo.IsValid())
+	{
+		// Serialize Blueprint info
+		BlueprintInfo = FBlueprintUtils::SerializeBlueprintInfo(
+			Blueprint,
+			bIncludeVariables,
+			bIncludeFunctions,
+			bIncludeGraphs
+		);
+		FBlueprintSnapshotCache::Get().Store(Blueprint, SnapshotKey, BlueprintInfo);
+	}
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Blueprint info for: %s"), *Blueprint->GetName()),
@@ -227,6 +311,32 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteGetGraph(const TSharedRef<FJsonOb
 		return FMCPToolResult::Error(ValidationError);
 	}
 
+	// Progressive depth: reconnaissance stays at the cheap summary and
+	// agents only pay for the node/pin dump when they ask for it
+	const FString DepthParam = ExtractOptionalString(Params, TEXT("depth"), TEXT("summary")).ToLower();
+	FBlueprintUtils::EGraphDepth Depth;
+	if (DepthParam == TEXT("summary"))
+	{
+		Depth = FBlueprintUtils::EGraphDepth::Summary;
+	}
+	else if (DepthParam == TEXT("graphs"))
+	{
+		Depth = FBlueprintUtils::EGraphDepth::Graphs;
+	}
+	else if (DepthParam == TEXT("nodes"))
+	{
+		Depth = FBlueprintUtils::EGraphDepth::Nodes;
+	}
+	else if (DepthParam == TEXT("pins"))
+	{
+		Depth = FBlueprintUtils::EGraphDepth::Pins;
+	}
+	else
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Unknown depth: '%s'. Valid depths: 'summary', 'graphs', 'nodes', 'pins'"), *DepthParam));
+	}
+
 	// Load Blueprint
 	FString LoadError;
 	UBlueprint* Blueprint = FBlueprintUtils::LoadBlueprint(BlueprintPath, LoadError);
@@ -235,12 +345,24 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteGetGraph(const TSharedRef<FJsonOb
 		return FMCPToolResult::Error(LoadError);
 	}
 
-	// Get graph info
-	TSharedPtr<FJsonObject> GraphInfo = FBlueprintUtils::GetGraphInfo(Blueprint);
+	// Return the cached snapshot when the blueprint is unchanged; each
+	// depth caches independently, so drilling in never rebuilds the
+	// levels already served
+	const FString SnapshotKey = FString::Printf(TEXT("get_graph:%s"), *DepthParam);
+	TSharedPtr<FJsonObject> GraphInfo = FBlueprintSnapshotCache::Get().Find(Blueprint, SnapshotKey);
+
+	if (!GraphInfo.IsValid())
+	{
+		// Get graph info
+		GraphInfo = FBlueprintUtils::GetGraphInfo(Blueprint, Depth);
+		GraphInfo->SetStringField(TEXT("depth"), DepthParam);
 
-	// Add Blueprint name for context
-	GraphInfo->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
-	GraphInfo->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+		// Add Blueprint name for context
+		GraphInfo->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+		GraphInfo->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+
+		FBlueprintSnapshotCache::Get().Store(Blueprint, SnapshotKey, GraphInfo);
+	}
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Graph info for: %s"), *Blueprint->GetName()),
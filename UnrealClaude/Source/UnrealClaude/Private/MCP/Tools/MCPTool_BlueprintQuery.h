@@ -27,6 +27,13 @@ public:
 			"- 'inspect': Get detailed Blueprint info (variables, functions, parent class)\n"
 			"- 'get_graph': Get graph structure (node count, events, connections)\n\n"
 			"Use 'list' first to discover Blueprints, then 'inspect' or 'get_graph' for details.\n\n"
+			"get_graph depth levels (each adds one layer of detail):\n"
+			"- 'summary' (default): totals and graph names - cheap reconnaissance\n"
+			"- 'graphs': per-graph type and node/event counts\n"
+			"- 'nodes': plus every node's id, class, title and position\n"
+			"- 'pins': full dump including pin names, types, defaults and links\n"
+			"Start at 'summary' and drill in; the full dump on a large Blueprint "
+			"costs orders of magnitude more to build and ship.\n\n"
 			"Example paths:\n"
 			"- '/Game/Blueprints/BP_Character'\n"
 			"- '/Game/UI/WBP_MainMenu'\n"
@@ -51,7 +58,9 @@ public:
 			FMCPToolParameter(TEXT("include_functions"), TEXT("boolean"),
 				TEXT("Include function list in inspect result"), false, TEXT("true")),
 			FMCPToolParameter(TEXT("include_graphs"), TEXT("boolean"),
-				TEXT("Include graph info in inspect result"), false, TEXT("false"))
+				TEXT("Include graph info in inspect result"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("depth"), TEXT("string"),
+				TEXT("get_graph detail level: 'summary', 'graphs', 'nodes', or 'pins'"), false, TEXT("summary"))
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
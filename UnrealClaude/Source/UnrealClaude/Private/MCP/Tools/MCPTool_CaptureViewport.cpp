@@ -10,13 +10,17 @@
 #include "Misc/Base64.h"
 #include "UnrealClient.h"
 #include "Slate/SceneViewport.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "Async/Async.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeSettings.h"
 
 namespace
 {
-	// Target resolution
-	constexpr int32 TargetWidth = 1024;
-	constexpr int32 TargetHeight = 576;
-	constexpr int32 JPEGQuality = 70;
+	// Output width cap when the client does not pass max_width
+	constexpr int32 DefaultMaxWidth = 1024;
+	constexpr int32 MinOutputWidth = 16;
 
 	// Simple bilinear resize
 	void ResizePixels(const TArray<FColor>& InPixels, int32 InWidth, int32 InHeight,
@@ -37,98 +41,820 @@ namespace
 			}
 		}
 	}
+
+	// Downscale to the output resolution and compress to JPEG
+	bool CompressToJpeg(const TArray<FColor>& Pixels, int32 Width, int32 Height,
+		const FIntPoint& OutputSize, TArray64<uint8>& OutJpeg, FString& OutError)
+	{
+		// Skip the resize pass entirely when the source already fits
+		TArray<FColor> ResizedPixels;
+		const TArray<FColor>* EncodePixels = &Pixels;
+		if (OutputSize.X != Width || OutputSize.Y != Height)
+		{
+			ResizePixels(Pixels, Width, Height, ResizedPixels, OutputSize.X, OutputSize.Y);
+			EncodePixels = &ResizedPixels;
+		}
+
+		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
+		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::JPEG);
+
+		if (!ImageWrapper.IsValid())
+		{
+			OutError = TEXT("Failed to create image wrapper.");
+			return false;
+		}
+
+		// Set raw pixel data (BGRA format from FColor)
+		if (!ImageWrapper->SetRaw(EncodePixels->GetData(), EncodePixels->Num() * sizeof(FColor),
+			OutputSize.X, OutputSize.Y, ERGBFormat::BGRA, 8))
+		{
+			OutError = TEXT("Failed to set image data.");
+			return false;
+		}
+
+		// Get compressed JPEG data (UE 5.7 API returns TArray64 directly)
+		OutJpeg = ImageWrapper->GetCompressed(UUnrealClaudeSettings::Get().ViewportJpegQuality);
+		if (OutJpeg.Num() == 0)
+		{
+			OutError = TEXT("Failed to compress image to JPEG.");
+			return false;
+		}
+
+		return true;
+	}
+
+	// Locate the capture source: PIE viewport first, then active editor viewport
+	FViewport* ResolveViewport(FString& OutViewportType, FMCPToolResult& OutError)
+	{
+		if (!GEditor)
+		{
+			OutError = FMCPToolResult::Error(TEXT("Editor is not available."));
+			return nullptr;
+		}
+
+		FViewport* Viewport = GEditor->GetPIEViewport();
+		OutViewportType = TEXT("PIE");
+
+		if (!Viewport)
+		{
+			Viewport = GEditor->GetActiveViewport();
+			OutViewportType = TEXT("Editor");
+		}
+
+		if (!Viewport)
+		{
+			OutError = FMCPToolResult::Error(TEXT("No viewport available. Open a level or start PIE."));
+			return nullptr;
+		}
+
+		const FIntPoint ViewportSize = Viewport->GetSizeXY();
+		if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
+		{
+			OutError = FMCPToolResult::Error(TEXT("Viewport has invalid size."));
+			return nullptr;
+		}
+
+		return Viewport;
+	}
+
+	// Clamp the requested crop/downscale against the actual viewport.
+	// The crop is intersected with the surface and the output size capped at
+	// the source so the image is never upscaled.
+	bool ResolveCaptureWindow(const FViewportCaptureRequest& Request, const FIntPoint& ViewportSize,
+		FIntRect& OutSourceRect, FIntPoint& OutOutputSize, FString& OutError)
+	{
+		OutSourceRect = FIntRect(0, 0, ViewportSize.X, ViewportSize.Y);
+		if (Request.HasRegion())
+		{
+			OutSourceRect = Request.Region;
+			OutSourceRect.Clip(FIntRect(0, 0, ViewportSize.X, ViewportSize.Y));
+			if (OutSourceRect.Width() <= 0 || OutSourceRect.Height() <= 0)
+			{
+				OutError = TEXT("Region lies outside the viewport.");
+				return false;
+			}
+		}
+
+		const int32 SourceWidth = OutSourceRect.Width();
+		const int32 SourceHeight = OutSourceRect.Height();
+		const int32 MaxWidth = Request.MaxWidth > 0 ? Request.MaxWidth : DefaultMaxWidth;
+		const int32 OutWidth = FMath::Min(MaxWidth, SourceWidth);
+		const int32 OutHeight = FMath::Max(1,
+			FMath::RoundToInt(static_cast<float>(SourceHeight) * OutWidth / SourceWidth));
+		OutOutputSize = FIntPoint(OutWidth, OutHeight);
+		return true;
+	}
+
+	// Build the common JPEG result payload
+	TSharedPtr<FJsonObject> BuildImageResult(const TArray64<uint8>& JpegData,
+		const FString& ViewportType, const FIntPoint& OriginalSize, const FIntPoint& OutputSize)
+	{
+		const FString Base64Image = FBase64::Encode(JpegData.GetData(), JpegData.Num());
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("image_base64"), Base64Image);
+		ResultData->SetNumberField(TEXT("width"), OutputSize.X);
+		ResultData->SetNumberField(TEXT("height"), OutputSize.Y);
+		ResultData->SetStringField(TEXT("format"), TEXT("jpeg"));
+		ResultData->SetNumberField(TEXT("quality"), UUnrealClaudeSettings::Get().ViewportJpegQuality);
+		ResultData->SetStringField(TEXT("viewport_type"), ViewportType);
+		ResultData->SetNumberField(TEXT("original_width"), OriginalSize.X);
+		ResultData->SetNumberField(TEXT("original_height"), OriginalSize.Y);
+		return ResultData;
+	}
+
+	// Build a result that carries the JPEG as a raw binary response body
+	FMCPToolResult BuildBinaryImageResult(const TArray64<uint8>& JpegData, const FString& ViewportType,
+		const FIntPoint& OutputSize)
+	{
+		FMCPToolResult Result = FMCPToolResult::Success(
+			FString::Printf(TEXT("Captured %s viewport: %dx%d JPEG"), *ViewportType, OutputSize.X, OutputSize.Y));
+		Result.BinaryData.Append(JpegData.GetData(), JpegData.Num());
+		Result.BinaryContentType = TEXT("image/jpeg");
+		return Result;
+	}
+
+	/**
+	 * Dispatch one frame of a sequence capture: pick a free ring slot and
+	 * enqueue its readback. Game thread (runs from the schedule ticker).
+	 * Returns false once every frame is scheduled or the sequence aborts,
+	 * which also unregisters the ticker.
+	 */
+	bool ScheduleSequenceFrame(const TSharedPtr<FPendingViewportSequence>& Sequence)
+	{
+		const int32 Attempted = Sequence->FramesScheduled.GetValue() + Sequence->FramesDropped.GetValue();
+
+		FString ViewportType;
+		FMCPToolResult ViewportError;
+		FViewport* Viewport = ResolveViewport(ViewportType, ViewportError);
+		const FIntPoint ViewportSize = Viewport ? Viewport->GetSizeXY() : FIntPoint::ZeroValue;
+		if (!Viewport ||
+			Sequence->SourceRect.Max.X > ViewportSize.X || Sequence->SourceRect.Max.Y > ViewportSize.Y)
+		{
+			// Frames already captured still ship; the error only surfaces if
+			// the sequence ends up empty
+			Sequence->ErrorMessage = Viewport
+				? TEXT("Viewport changed size mid-sequence.")
+				: TEXT("Viewport went away mid-sequence.");
+			Sequence->bScheduleDone = true;
+			Sequence->EncoderWake->Trigger();
+			return false;
+		}
+
+		int32 FreeSlot = INDEX_NONE;
+		for (int32 i = 0; i < Sequence->Slots.Num(); ++i)
+		{
+			if (!Sequence->Slots[i].bInUse)
+			{
+				FreeSlot = i;
+				break;
+			}
+		}
+
+		if (FreeSlot == INDEX_NONE)
+		{
+			// Encoder is behind; dropping keeps the schedule honest instead of
+			// stalling the ring and skewing frame pacing
+			Sequence->FramesDropped.Increment();
+		}
+		else
+		{
+			FSequenceFrameSlot& Slot = Sequence->Slots[FreeSlot];
+			Slot.bInUse = true;
+			Slot.FrameIndex = Attempted;
+			Sequence->FramesScheduled.Increment();
+
+			FRenderTarget* RenderTarget = Viewport;
+			const FIntRect SourceRect = Sequence->SourceRect;
+			ENQUEUE_RENDER_COMMAND(UnrealClaudeSequenceFrameReadback)(
+				[Sequence, RenderTarget, FreeSlot, SourceRect](FRHICommandListImmediate& RHICmdList)
+				{
+					FSequenceFrameSlot& Slot = Sequence->Slots[FreeSlot];
+					FTextureRHIRef Texture = RenderTarget->GetRenderTargetTexture();
+					bool bRead = false;
+					if (Texture.IsValid())
+					{
+						// The slot's buffer keeps its allocation frame to frame
+						FReadSurfaceDataFlags ReadFlags(RCM_UNorm);
+						ReadFlags.SetLinearToGamma(false);
+						RHICmdList.ReadSurfaceData(Texture, SourceRect, Slot.Pixels, ReadFlags);
+						bRead = Slot.Pixels.Num() == SourceRect.Width() * SourceRect.Height();
+					}
+
+					if (bRead)
+					{
+						Sequence->ReadySlots.Enqueue(FreeSlot);
+					}
+					else
+					{
+						Sequence->FramesFailed.Increment();
+						Slot.bInUse = false;
+					}
+					Sequence->EncoderWake->Trigger();
+				});
+		}
+
+		const bool bAllScheduled =
+			Sequence->FramesScheduled.GetValue() + Sequence->FramesDropped.GetValue() >= Sequence->FrameCount;
+		if (bAllScheduled)
+		{
+			Sequence->bScheduleDone = true;
+			Sequence->EncoderWake->Trigger();
+		}
+		return !bAllScheduled;
+	}
+
+	/**
+	 * Dedicated encoder thread for a sequence capture: drains the ring in
+	 * capture order, compresses each frame and releases the slot. Runs until
+	 * every scheduled frame is accounted for, then finalizes the sequence.
+	 */
+	void RunSequenceEncoder(const TSharedPtr<FPendingViewportSequence>& Sequence)
+	{
+		while (true)
+		{
+			int32 SlotIndex = INDEX_NONE;
+			while (Sequence->ReadySlots.Dequeue(SlotIndex))
+			{
+				FSequenceFrameSlot& Slot = Sequence->Slots[SlotIndex];
+
+				FString CompressError;
+				TArray64<uint8> Jpeg;
+				if (CompressToJpeg(Slot.Pixels, Sequence->SourceRect.Width(), Sequence->SourceRect.Height(),
+					Sequence->OutputSize, Jpeg, CompressError))
+				{
+					Sequence->EncodedFrames[Slot.FrameIndex] = MoveTemp(Jpeg);
+					Sequence->FramesEncoded.Increment();
+				}
+				else
+				{
+					Sequence->FramesFailed.Increment();
+				}
+				Slot.bInUse = false;
+			}
+
+			if (Sequence->bScheduleDone &&
+				Sequence->FramesEncoded.GetValue() + Sequence->FramesFailed.GetValue()
+					>= Sequence->FramesScheduled.GetValue())
+			{
+				break;
+			}
+
+			// Short timeout instead of pure event wait: the final trigger can
+			// race the exit-condition check, and 50ms of slack costs nothing
+			// on a thread that exists only for this sequence
+			Sequence->EncoderWake->Wait(50);
+		}
+
+		// Compact out gaps left by dropped/failed frames, preserving order
+		TArray<TArray64<uint8>> Frames;
+		Frames.Reserve(Sequence->FramesEncoded.GetValue());
+		for (TArray64<uint8>& Frame : Sequence->EncodedFrames)
+		{
+			if (Frame.Num() > 0)
+			{
+				Frames.Add(MoveTemp(Frame));
+			}
+		}
+		Sequence->EncodedFrames = MoveTemp(Frames);
+
+		Sequence->bSuccess = Sequence->EncodedFrames.Num() > 0;
+		if (!Sequence->bSuccess && Sequence->ErrorMessage.IsEmpty())
+		{
+			Sequence->ErrorMessage = TEXT("No frames were captured.");
+		}
+		Sequence->bComplete = true;
+	}
+
+	// Enqueue the surface readback on the render thread. The viewport's
+	// render target texture is only valid there; the game thread never
+	// waits on the copy. Resize + JPEG encode then move to the thread pool
+	// so the render thread is held only for the readback itself.
+	// Game thread only (the viewport pointer is resolved there).
+	void EnqueueReadbackAndEncode(const TSharedPtr<FPendingViewportCapture>& Capture, FViewport* Viewport)
+	{
+		const FIntRect SourceRect = Capture->SourceRect;
+		FRenderTarget* RenderTarget = Viewport;
+		ENQUEUE_RENDER_COMMAND(UnrealClaudeAsyncViewportCapture)(
+			[Capture, RenderTarget, SourceRect](FRHICommandListImmediate& RHICmdList)
+			{
+				FTextureRHIRef Texture = RenderTarget->GetRenderTargetTexture();
+				if (!Texture.IsValid())
+				{
+					Capture->ErrorMessage = TEXT("Viewport render target is not available.");
+					Capture->MarkComplete();
+					return;
+				}
+
+				// Only the requested sub-rect leaves the GPU; a region capture
+				// of a 4K viewport reads back just the region
+				TArray<FColor> Pixels;
+				FReadSurfaceDataFlags ReadFlags(RCM_UNorm);
+				ReadFlags.SetLinearToGamma(false);
+				RHICmdList.ReadSurfaceData(Texture, SourceRect, Pixels, ReadFlags);
+
+				if (Pixels.Num() != SourceRect.Width() * SourceRect.Height())
+				{
+					Capture->ErrorMessage = TEXT("Surface readback returned unexpected pixel count.");
+					Capture->MarkComplete();
+					return;
+				}
+
+				// Hand off to the thread pool for resize + compression
+				Async(EAsyncExecution::ThreadPool, [Capture, Pixels = MoveTemp(Pixels), SourceRect]()
+				{
+					FString CompressError;
+					if (CompressToJpeg(Pixels, SourceRect.Width(), SourceRect.Height(),
+						Capture->OutputSize, Capture->JpegData, CompressError))
+					{
+						Capture->bSuccess = true;
+					}
+					else
+					{
+						Capture->ErrorMessage = CompressError;
+					}
+					Capture->MarkComplete();
+				});
+			});
+	}
 }
 
 FMCPToolResult FMCPTool_CaptureViewport::Execute(const TSharedRef<FJsonObject>& Params)
 {
-	// Validate editor is available
-	if (!GEditor)
+	const bool bBinaryEncoding = ExtractOptionalString(Params, TEXT("encoding"), TEXT("base64"))
+		.Equals(TEXT("binary"), ESearchCase::IgnoreCase);
+
+	// Poll path for a previously started async capture
+	FString CaptureIdString = ExtractOptionalString(Params, TEXT("capture_id"));
+	if (!CaptureIdString.IsEmpty())
 	{
-		return FMCPToolResult::Error(TEXT("Editor is not available."));
+		return PollCapture(CaptureIdString, bBinaryEncoding);
 	}
 
-	// Get viewport - PIE first, then editor
-	FViewport* Viewport = GEditor->GetPIEViewport();
-	FString ViewportType = TEXT("PIE");
+	const bool bAsyncRequested = ExtractOptionalBool(Params, TEXT("async"));
 
-	if (!Viewport)
+	// Crop/downscale parameters; validated against the live viewport later
+	FViewportCaptureRequest CaptureRequest;
+	CaptureRequest.MaxWidth = ExtractOptionalNumber<int32>(Params, TEXT("max_width"), 0);
+	if (Params->HasField(TEXT("max_width")) && CaptureRequest.MaxWidth < MinOutputWidth)
+	{
+		return FMCPToolResult::Error(
+			FString::Printf(TEXT("max_width must be at least %d."), MinOutputWidth));
+	}
+
+	const TSharedPtr<FJsonObject>* RegionObj;
+	if (Params->TryGetObjectField(TEXT("region"), RegionObj))
 	{
-		Viewport = GEditor->GetActiveViewport();
-		ViewportType = TEXT("Editor");
+		int32 X = 0, Y = 0, W = 0, H = 0;
+		(*RegionObj)->TryGetNumberField(TEXT("x"), X);
+		(*RegionObj)->TryGetNumberField(TEXT("y"), Y);
+		(*RegionObj)->TryGetNumberField(TEXT("width"), W);
+		(*RegionObj)->TryGetNumberField(TEXT("height"), H);
+		if (W <= 0 || H <= 0)
+		{
+			return FMCPToolResult::Error(TEXT("Region must have positive width and height."));
+		}
+		CaptureRequest.Region = FIntRect(X, Y, X + W, Y + H);
 	}
 
+	// Sequence mode: capture a batch of frames at a fixed interval and hand
+	// back a capture_id for polling. Inherently async - a 10-frame sequence
+	// at 100ms spans a second of wall time.
+	const int32 FrameCount = ExtractOptionalNumber<int32>(Params, TEXT("frame_count"), 1);
+	if (FrameCount > 1)
+	{
+		if (FrameCount > UnrealClaudeConstants::MCPServer::MaxViewportSequenceFrames)
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("frame_count must be at most %d."),
+				UnrealClaudeConstants::MCPServer::MaxViewportSequenceFrames));
+		}
+		const int32 IntervalMs = ExtractOptionalNumber<int32>(Params, TEXT("interval_ms"), 100);
+		if (IntervalMs < UnrealClaudeConstants::MCPServer::MinViewportSequenceIntervalMs)
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("interval_ms must be at least %d."),
+				UnrealClaudeConstants::MCPServer::MinViewportSequenceIntervalMs));
+		}
+
+		if (IsInGameThread())
+		{
+			return StartSequenceCapture(CaptureRequest, FrameCount, IntervalMs);
+		}
+
+		// Worker thread: starting the sequence (viewport resolve + ticker
+		// registration) is the only part that needs the game thread
+		TSharedPtr<FEvent> StartDone(FPlatformProcess::GetSynchEventFromPool(),
+			[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
+		TSharedPtr<FMCPToolResult> StartResult = MakeShared<FMCPToolResult>();
+		AsyncTask(ENamedThreads::GameThread,
+			[this, StartDone, StartResult, CaptureRequest, FrameCount, IntervalMs]()
+			{
+				*StartResult = StartSequenceCapture(CaptureRequest, FrameCount, IntervalMs);
+				StartDone->Trigger();
+			});
+		if (!StartDone->Wait(static_cast<uint32>(UnrealClaudeConstants::MCPServer::GameThreadTimeoutMs)))
+		{
+			return FMCPToolResult::Error(TEXT("Sequence capture start timed out."));
+		}
+		return *StartResult;
+	}
+
+	// Worker-thread path (task queue submissions): resolve + enqueue on the
+	// game thread, readback on the render thread, encode on the thread pool,
+	// and park this worker until the image is ready. The editor frame never
+	// runs the encode.
+	if (!IsInGameThread())
+	{
+		return ExecuteOffGameThread(CaptureRequest, bAsyncRequested, bBinaryEncoding);
+	}
+
+	// Async path: enqueue the readback and return immediately
+	if (bAsyncRequested)
+	{
+		return StartAsyncCapture(CaptureRequest);
+	}
+
+	// Synchronous path: blocking ReadPixels (flushes rendering)
+	FString ViewportType;
+	FMCPToolResult ViewportError;
+	FViewport* Viewport = ResolveViewport(ViewportType, ViewportError);
 	if (!Viewport)
 	{
-		return FMCPToolResult::Error(TEXT("No viewport available. Open a level or start PIE."));
+		return ViewportError;
 	}
 
-	// Get viewport size
 	const FIntPoint ViewportSize = Viewport->GetSizeXY();
-	if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
+
+	FIntRect SourceRect;
+	FIntPoint OutputSize;
+	FString WindowError;
+	if (!ResolveCaptureWindow(CaptureRequest, ViewportSize, SourceRect, OutputSize, WindowError))
 	{
-		return FMCPToolResult::Error(TEXT("Viewport has invalid size."));
+		return FMCPToolResult::Error(WindowError);
 	}
 
-	// Read pixels from viewport
+	// Read pixels from the viewport; a region capture reads only the crop
 	TArray<FColor> Pixels;
-	if (!Viewport->ReadPixels(Pixels))
+	if (!Viewport->ReadPixels(Pixels, FReadSurfaceDataFlags(), SourceRect))
 	{
 		return FMCPToolResult::Error(TEXT("Failed to read viewport pixels."));
 	}
 
 	// Validate pixel array size
-	const int32 ExpectedPixels = ViewportSize.X * ViewportSize.Y;
+	const int32 ExpectedPixels = SourceRect.Width() * SourceRect.Height();
 	if (Pixels.Num() != ExpectedPixels)
 	{
 		return FMCPToolResult::Error(TEXT("Pixel array size mismatch."));
 	}
 
-	// Resize to target resolution
-	TArray<FColor> ResizedPixels;
-	ResizePixels(Pixels, ViewportSize.X, ViewportSize.Y, ResizedPixels, TargetWidth, TargetHeight);
+	TArray64<uint8> JpegData;
+	FString CompressError;
+	if (!CompressToJpeg(Pixels, SourceRect.Width(), SourceRect.Height(), OutputSize, JpegData, CompressError))
+	{
+		return FMCPToolResult::Error(CompressError);
+	}
 
-	// Compress to JPEG
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::JPEG);
+	UE_LOG(LogUnrealClaude, Log, TEXT("Captured %s viewport: %dx%d -> %dx%d JPEG (%lld bytes)"),
+		*ViewportType, SourceRect.Width(), SourceRect.Height(), OutputSize.X, OutputSize.Y, JpegData.Num());
 
-	if (!ImageWrapper.IsValid())
+	if (bBinaryEncoding)
 	{
-		return FMCPToolResult::Error(TEXT("Failed to create image wrapper."));
+		return BuildBinaryImageResult(JpegData, ViewportType, OutputSize);
 	}
 
-	// Set raw pixel data (BGRA format from FColor)
-	if (!ImageWrapper->SetRaw(ResizedPixels.GetData(), ResizedPixels.Num() * sizeof(FColor),
-		TargetWidth, TargetHeight, ERGBFormat::BGRA, 8))
+	TSharedPtr<FJsonObject> ResultData = BuildImageResult(JpegData, ViewportType, ViewportSize, OutputSize);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Captured %s viewport: %dx%d JPEG"), *ViewportType, OutputSize.X, OutputSize.Y),
+		ResultData
+	);
+}
+
+FMCPToolResult FMCPTool_CaptureViewport::StartAsyncCapture(const FViewportCaptureRequest& CaptureRequest)
+{
+	FString ViewportType;
+	FMCPToolResult ViewportError;
+	FViewport* Viewport = ResolveViewport(ViewportType, ViewportError);
+	if (!Viewport)
+	{
+		return ViewportError;
+	}
+
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+
+	FIntRect SourceRect;
+	FIntPoint OutputSize;
+	FString WindowError;
+	if (!ResolveCaptureWindow(CaptureRequest, ViewportSize, SourceRect, OutputSize, WindowError))
 	{
-		return FMCPToolResult::Error(TEXT("Failed to set image data."));
+		return FMCPToolResult::Error(WindowError);
 	}
 
-	// Get compressed JPEG data (UE 5.7 API returns TArray64 directly)
-	TArray64<uint8> CompressedData = ImageWrapper->GetCompressed(JPEGQuality);
-	if (CompressedData.Num() == 0)
+	TSharedPtr<FPendingViewportCapture> Capture = MakeShared<FPendingViewportCapture>();
+	Capture->ViewportType = ViewportType;
+	Capture->OriginalSize = ViewportSize;
+	Capture->SourceRect = SourceRect;
+	Capture->OutputSize = OutputSize;
+
 	{
-		return FMCPToolResult::Error(TEXT("Failed to compress image to JPEG."));
+		FScopeLock Lock(&PendingCapturesLock);
+		PendingCaptures.Add(Capture->CaptureId, Capture);
 	}
 
-	// Encode to base64
-	const FString Base64Image = FBase64::Encode(CompressedData.GetData(), CompressedData.Num());
+	EnqueueReadbackAndEncode(Capture, Viewport);
 
-	// Build result JSON
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
-	ResultData->SetStringField(TEXT("image_base64"), Base64Image);
-	ResultData->SetNumberField(TEXT("width"), TargetWidth);
-	ResultData->SetNumberField(TEXT("height"), TargetHeight);
-	ResultData->SetStringField(TEXT("format"), TEXT("jpeg"));
-	ResultData->SetNumberField(TEXT("quality"), JPEGQuality);
+	ResultData->SetStringField(TEXT("capture_id"), Capture->CaptureId.ToString());
+	ResultData->SetStringField(TEXT("status"), TEXT("pending"));
+	ResultData->SetStringField(TEXT("viewport_type"), ViewportType);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Async capture started: %s"), *Capture->CaptureId.ToString()),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_CaptureViewport::ExecuteOffGameThread(const FViewportCaptureRequest& CaptureRequest,
+	bool bReturnCaptureId, bool bBinaryEncoding)
+{
+	// Pooled event with a deleter so it is returned even on the timeout paths;
+	// the capture holds a reference too, so a late Trigger never hits a
+	// recycled event
+	TSharedPtr<FEvent> CompletionEvent(FPlatformProcess::GetSynchEventFromPool(),
+		[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
+
+	struct FStartState
+	{
+		FMCPToolResult StartResult;
+		TSharedPtr<FPendingViewportCapture> Capture;
+	};
+	TSharedPtr<FStartState> State = MakeShared<FStartState>();
+
+	// The game thread only resolves the viewport and enqueues the render
+	// command - everything heavy happens on the render thread and thread pool
+	AsyncTask(ENamedThreads::GameThread, [this, State, CompletionEvent, CaptureRequest, bReturnCaptureId]()
+	{
+		if (bReturnCaptureId)
+		{
+			// Client asked for a poll handle; starting the capture is all
+			// that needs the game thread
+			State->StartResult = StartAsyncCapture(CaptureRequest);
+			CompletionEvent->Trigger();
+			return;
+		}
+
+		FString ViewportType;
+		FMCPToolResult ViewportError;
+		FViewport* Viewport = ResolveViewport(ViewportType, ViewportError);
+		if (!Viewport)
+		{
+			State->StartResult = ViewportError;
+			CompletionEvent->Trigger();
+			return;
+		}
+
+		FIntRect SourceRect;
+		FIntPoint OutputSize;
+		FString WindowError;
+		if (!ResolveCaptureWindow(CaptureRequest, Viewport->GetSizeXY(), SourceRect, OutputSize, WindowError))
+		{
+			State->StartResult = FMCPToolResult::Error(WindowError);
+			CompletionEvent->Trigger();
+			return;
+		}
+
+		TSharedPtr<FPendingViewportCapture> Capture = MakeShared<FPendingViewportCapture>();
+		Capture->ViewportType = ViewportType;
+		Capture->OriginalSize = Viewport->GetSizeXY();
+		Capture->SourceRect = SourceRect;
+		Capture->OutputSize = OutputSize;
+		Capture->CompletionEvent = CompletionEvent;
+
+		{
+			FScopeLock Lock(&PendingCapturesLock);
+			PendingCaptures.Add(Capture->CaptureId, Capture);
+		}
+
+		State->Capture = Capture;
+		EnqueueReadbackAndEncode(Capture, Viewport);
+	});
+
+	// Park this worker until the pipeline signals; the frame budget constant
+	// that bounds game-thread dispatches bounds the whole pipeline here too
+	if (!CompletionEvent->Wait(static_cast<uint32>(UnrealClaudeConstants::MCPServer::GameThreadTimeoutMs)))
+	{
+		return FMCPToolResult::Error(TEXT("Viewport capture timed out."));
+	}
+
+	if (!State->Capture.IsValid())
+	{
+		// Either the start failed or the client only wanted the capture_id
+		return State->StartResult;
+	}
+
+	// Terminal: PollCapture collects the image and drops the pending entry
+	return PollCapture(State->Capture->CaptureId.ToString(), bBinaryEncoding);
+}
+
+FMCPToolResult FMCPTool_CaptureViewport::PollCapture(const FString& CaptureIdString, bool bBinaryEncoding)
+{
+	FGuid CaptureId;
+	if (!FGuid::Parse(CaptureIdString, CaptureId))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Invalid capture_id: %s"), *CaptureIdString));
+	}
+
+	TSharedPtr<FPendingViewportCapture> Capture;
+	bool bIsSequence = false;
+	{
+		FScopeLock Lock(&PendingCapturesLock);
+		if (const TSharedPtr<FPendingViewportCapture>* Found = PendingCaptures.Find(CaptureId))
+		{
+			Capture = *Found;
+		}
+		else if (PendingSequences.Contains(CaptureId))
+		{
+			bIsSequence = true;
+		}
+		else
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Unknown capture_id: %s"), *CaptureIdString));
+		}
+	}
+
+	if (bIsSequence)
+	{
+		return PollSequence(CaptureId);
+	}
+
+	if (!Capture->bComplete)
+	{
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("capture_id"), CaptureIdString);
+		ResultData->SetStringField(TEXT("status"), TEXT("pending"));
+		return FMCPToolResult::Success(TEXT("Capture still in progress"), ResultData);
+	}
+
+	// Terminal state: remove from the pending map before returning
+	{
+		FScopeLock Lock(&PendingCapturesLock);
+		PendingCaptures.Remove(CaptureId);
+	}
+
+	if (!Capture->bSuccess)
+	{
+		return FMCPToolResult::Error(Capture->ErrorMessage);
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Async capture ready: %s (%s viewport, %lld bytes JPEG)"),
+		*CaptureIdString, *Capture->ViewportType, Capture->JpegData.Num());
+
+	if (bBinaryEncoding)
+	{
+		return BuildBinaryImageResult(Capture->JpegData, Capture->ViewportType, Capture->OutputSize);
+	}
+
+	TSharedPtr<FJsonObject> ResultData = BuildImageResult(Capture->JpegData, Capture->ViewportType,
+		Capture->OriginalSize, Capture->OutputSize);
+	ResultData->SetStringField(TEXT("capture_id"), CaptureIdString);
+	ResultData->SetStringField(TEXT("status"), TEXT("ready"));
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Captured %s viewport: %dx%d JPEG"), *Capture->ViewportType,
+			Capture->OutputSize.X, Capture->OutputSize.Y),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_CaptureViewport::StartSequenceCapture(const FViewportCaptureRequest& CaptureRequest,
+	int32 FrameCount, int32 IntervalMs)
+{
+	FString ViewportType;
+	FMCPToolResult ViewportError;
+	FViewport* Viewport = ResolveViewport(ViewportType, ViewportError);
+	if (!Viewport)
+	{
+		return ViewportError;
+	}
+
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+
+	FIntRect SourceRect;
+	FIntPoint OutputSize;
+	FString WindowError;
+	if (!ResolveCaptureWindow(CaptureRequest, ViewportSize, SourceRect, OutputSize, WindowError))
+	{
+		return FMCPToolResult::Error(WindowError);
+	}
+
+	TSharedPtr<FPendingViewportSequence> Sequence = MakeShared<FPendingViewportSequence>();
+	Sequence->FrameCount = FrameCount;
+	Sequence->IntervalSeconds = IntervalMs / 1000.0f;
+	Sequence->ViewportType = ViewportType;
+	Sequence->OriginalSize = ViewportSize;
+	Sequence->SourceRect = SourceRect;
+	Sequence->OutputSize = OutputSize;
+	Sequence->Slots.SetNum(FMath::Min(
+		UnrealClaudeConstants::MCPServer::ViewportSequenceRingSlots, FrameCount));
+	Sequence->EncodedFrames.SetNum(FrameCount);
+	Sequence->EncoderWake = TSharedPtr<FEvent>(FPlatformProcess::GetSynchEventFromPool(),
+		[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
+
+	{
+		FScopeLock Lock(&PendingCapturesLock);
+		PendingSequences.Add(Sequence->CaptureId, Sequence);
+	}
+
+	// The encoder thread lives for exactly this sequence; frames never queue
+	// behind unrelated thread-pool work
+	Async(EAsyncExecution::Thread, [Sequence]()
+	{
+		RunSequenceEncoder(Sequence);
+	});
+
+	// First frame now; the ticker paces the rest
+	if (ScheduleSequenceFrame(Sequence))
+	{
+		Sequence->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda([Sequence](float)
+			{
+				return ScheduleSequenceFrame(Sequence);
+			}),
+			Sequence->IntervalSeconds);
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Sequence capture started: %s (%d frames @ %dms, %s viewport)"),
+		*Sequence->CaptureId.ToString(), FrameCount, IntervalMs, *ViewportType);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("capture_id"), Sequence->CaptureId.ToString());
+	ResultData->SetStringField(TEXT("status"), TEXT("pending"));
+	ResultData->SetNumberField(TEXT("frame_count"), FrameCount);
+	ResultData->SetNumberField(TEXT("interval_ms"), IntervalMs);
 	ResultData->SetStringField(TEXT("viewport_type"), ViewportType);
-	ResultData->SetNumberField(TEXT("original_width"), ViewportSize.X);
-	ResultData->SetNumberField(TEXT("original_height"), ViewportSize.Y);
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("Captured %s viewport: %dx%d -> %dx%d JPEG (%d bytes base64)"),
-		*ViewportType, ViewportSize.X, ViewportSize.Y, TargetWidth, TargetHeight, Base64Image.Len());
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Sequence capture started: %d frames at %dms intervals"), FrameCount, IntervalMs),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_CaptureViewport::PollSequence(const FGuid& CaptureId)
+{
+	TSharedPtr<FPendingViewportSequence> Sequence;
+	{
+		FScopeLock Lock(&PendingCapturesLock);
+		const TSharedPtr<FPendingViewportSequence>* Found = PendingSequences.Find(CaptureId);
+		if (!Found)
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Unknown capture_id: %s"), *CaptureId.ToString()));
+		}
+		Sequence = *Found;
+	}
+
+	if (!Sequence->bComplete)
+	{
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("capture_id"), CaptureId.ToString());
+		ResultData->SetStringField(TEXT("status"), TEXT("pending"));
+		ResultData->SetNumberField(TEXT("frames_encoded"), Sequence->FramesEncoded.GetValue());
+		ResultData->SetNumberField(TEXT("frame_count"), Sequence->FrameCount);
+		return FMCPToolResult::Success(TEXT("Sequence capture still in progress"), ResultData);
+	}
+
+	// Terminal state: remove from the pending map before returning
+	{
+		FScopeLock Lock(&PendingCapturesLock);
+		PendingSequences.Remove(CaptureId);
+	}
+
+	if (!Sequence->bSuccess)
+	{
+		return FMCPToolResult::Error(Sequence->ErrorMessage);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> FrameValues;
+	FrameValues.Reserve(Sequence->EncodedFrames.Num());
+	for (const TArray64<uint8>& Frame : Sequence->EncodedFrames)
+	{
+		FrameValues.Add(MakeShared<FJsonValueString>(FBase64::Encode(Frame.GetData(), Frame.Num())));
+	}
+
+	const int32 LostFrames = Sequence->FramesDropped.GetValue() + Sequence->FramesFailed.GetValue();
+	UE_LOG(LogUnrealClaude, Log, TEXT("Sequence capture ready: %s (%d/%d frames, %d lost)"),
+		*CaptureId.ToString(), FrameValues.Num(), Sequence->FrameCount, LostFrames);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("capture_id"), CaptureId.ToString());
+	ResultData->SetStringField(TEXT("status"), TEXT("ready"));
+	ResultData->SetArrayField(TEXT("frames"), FrameValues);
+	ResultData->SetNumberField(TEXT("frame_count"), FrameValues.Num());
+	ResultData->SetNumberField(TEXT("frames_lost"), LostFrames);
+	ResultData->SetNumberField(TEXT("interval_ms"), FMath::RoundToInt(Sequence->IntervalSeconds * 1000.0f));
+	ResultData->SetNumberField(TEXT("width"), Sequence->OutputSize.X);
+	ResultData->SetNumberField(TEXT("height"), Sequence->OutputSize.Y);
+	ResultData->SetStringField(TEXT("format"), TEXT("jpeg"));
+	ResultData->SetNumberField(TEXT("quality"), UUnrealClaudeSettings::Get().ViewportJpegQuality);
+	ResultData->SetStringField(TEXT("viewport_type"), Sequence->ViewportType);
 
 	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Captured %s viewport: %dx%d JPEG"), *ViewportType, TargetWidth, TargetHeight),
-		ResultData
-	);
+		FString::Printf(TEXT("Captured %d-frame sequence (%s viewport, %dx%d JPEG)"),
+			FrameValues.Num(), *Sequence->ViewportType, Sequence->OutputSize.X, Sequence->OutputSize.Y),
+		ResultData);
 }
@@ -4,11 +4,182 @@
 
 #include "CoreMinimal.h"
 #include "../MCPToolBase.h"
+#include "HAL/Event.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+
+/** Parsed capture parameters (validated against the viewport at capture time) */
+struct FViewportCaptureRequest
+{
+	/** Output image width cap in pixels; 0 uses the default. Height follows
+	 *  the source aspect; the image is never upscaled. */
+	int32 MaxWidth = 0;
+
+	/** Optional crop in viewport pixels; zero-sized means the full viewport */
+	FIntRect Region = FIntRect(0, 0, 0, 0);
+
+	bool HasRegion() const { return Region.Width() > 0 && Region.Height() > 0; }
+};
+
+/** In-flight async viewport capture (readback + encode off the game thread) */
+struct FPendingViewportCapture
+{
+	/** Identifier handed back to the client for polling */
+	FGuid CaptureId;
+
+	/** Set once the JPEG is ready (or the capture failed) */
+	FThreadSafeBool bComplete;
+
+	/** Whether the capture succeeded */
+	bool bSuccess = false;
+
+	/** Error description when bSuccess is false */
+	FString ErrorMessage;
+
+	/** Compressed JPEG bytes */
+	TArray64<uint8> JpegData;
+
+	/** Which viewport was captured (PIE or Editor) */
+	FString ViewportType;
+
+	/** Source viewport size */
+	FIntPoint OriginalSize = FIntPoint::ZeroValue;
+
+	/** Sub-rect of the surface actually read back (the crop happens at
+	 *  readback, not after - a region capture never copies the full frame) */
+	FIntRect SourceRect = FIntRect(0, 0, 0, 0);
+
+	/** Encoded image size after the downscale */
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+
+	/** Optional event a parked worker waits on; the shared pointer keeps the
+	 *  pooled event alive until the pipeline has signalled it */
+	TSharedPtr<FEvent> CompletionEvent;
+
+	FPendingViewportCapture()
+		: CaptureId(FGuid::NewGuid())
+		, bComplete(false)
+	{
+	}
+
+	/** Mark the capture terminal and wake any parked waiter */
+	void MarkComplete()
+	{
+		bComplete = true;
+		if (CompletionEvent.IsValid())
+		{
+			CompletionEvent->Trigger();
+		}
+	}
+};
+
+/** One reusable pixel buffer in a sequence capture's ring */
+struct FSequenceFrameSlot
+{
+	/** Readback target; keeps its allocation across frames */
+	TArray<FColor> Pixels;
+
+	/** Sequence position of the frame currently in the buffer */
+	int32 FrameIndex = INDEX_NONE;
+
+	/** Set while the slot holds pixels the encoder has not consumed yet */
+	FThreadSafeBool bInUse;
+};
+
+/**
+ * In-flight viewport sequence capture
+ *
+ * A ticker schedules one readback per interval into a small ring of
+ * reusable buffers; a dedicated encoder thread drains the ring so frame
+ * pacing never waits on JPEG compression. If the encoder falls behind
+ * (every slot busy) the frame is dropped rather than stalling the ring.
+ */
+struct FPendingViewportSequence
+{
+	/** Identifier handed back to the client for polling */
+	FGuid CaptureId;
+
+	/** Frames requested */
+	int32 FrameCount = 0;
+
+	/** Seconds between scheduled frames */
+	float IntervalSeconds = 0.1f;
+
+	/** Which viewport is being captured (PIE or Editor) */
+	FString ViewportType;
+
+	/** Source viewport size */
+	FIntPoint OriginalSize = FIntPoint::ZeroValue;
+
+	/** Sub-rect read back each frame */
+	FIntRect SourceRect = FIntRect(0, 0, 0, 0);
+
+	/** Encoded image size per frame */
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+
+	/** Reusable readback buffers; allocation happens once, not per frame */
+	TArray<FSequenceFrameSlot> Slots;
+
+	/** Slot indices with pixels awaiting encode (render thread -> encoder) */
+	TQueue<int32, EQueueMode::Mpsc> ReadySlots;
+
+	/** Wakes the encoder thread when a slot is ready or capture ends */
+	TSharedPtr<FEvent> EncoderWake;
+
+	/** Encoded frames in capture order; encoder thread only until complete */
+	TArray<TArray64<uint8>> EncodedFrames;
+
+	/** Frames handed to the render thread so far */
+	FThreadSafeCounter FramesScheduled;
+
+	/** Frames the encoder has finished */
+	FThreadSafeCounter FramesEncoded;
+
+	/** Frames skipped because every ring slot was still busy */
+	FThreadSafeCounter FramesDropped;
+
+	/** Frames lost to readback or encode failures after being scheduled */
+	FThreadSafeCounter FramesFailed;
+
+	/** Set when the ticker has scheduled (or abandoned) every frame */
+	FThreadSafeBool bScheduleDone;
+
+	/** Set once the encoder has drained the ring after bScheduleDone */
+	FThreadSafeBool bComplete;
+
+	/** Whether at least one frame was captured and encoded */
+	bool bSuccess = false;
+
+	/** Error description when bSuccess is false */
+	FString ErrorMessage;
+
+	/** Per-interval schedule callback; removed when the sequence ends */
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FPendingViewportSequence()
+		: CaptureId(FGuid::NewGuid())
+	{
+	}
+};
 
 /**
  * MCP Tool: Capture a screenshot of the active viewport
- * Returns base64-encoded JPEG (1024x576, quality 70)
+ * Returns base64-encoded JPEG (max_width wide, default 1024, quality 70)
  * Captures PIE viewport if running, otherwise active editor viewport
+ *
+ * Supports two capture modes:
+ * - Synchronous (default): blocks on Viewport->ReadPixels, which flushes
+ *   rendering and stalls the game thread for the readback
+ * - Async: enqueues a render-thread surface readback and moves resize +
+ *   JPEG encode to the thread pool; returns a capture_id immediately and
+ *   the client polls with capture_id until the image is ready, so the
+ *   editor frame never hitches
+ *
+ * Sequence mode (frame_count > 1) captures N frames at a fixed interval
+ * through the same readback pipeline, reusing a small ring of pixel
+ * buffers and encoding on a dedicated thread, so the game thread pays
+ * only one readback enqueue per frame and the behavior under observation
+ * (animation, physics) is not perturbed by per-call overhead.
  */
 class FMCPTool_CaptureViewport : public FMCPToolBase
 {
@@ -21,7 +192,18 @@ public:
 			"Capture a screenshot of the active viewport.\n\n"
 			"Captures the current view from either Play-In-Editor (if running) or the active editor viewport. "
 			"Useful for visual verification of scene changes.\n\n"
-			"Output: 1024x576 JPEG image encoded as base64 string.\n\n"
+			"Output: JPEG downscaled to max_width (default 1024, aspect preserved), encoded as base64 string. "
+			"Pass 'region' to crop to a sub-rect of the viewport before the downscale.\n\n"
+			"Modes:\n"
+			"- Default: synchronous capture, image returned directly\n"
+			"- async=true: returns a capture_id immediately without stalling the editor frame; "
+			"poll by calling capture_viewport again with capture_id until status is 'ready'\n"
+			"- frame_count > 1: sequence mode. Captures frame_count frames every interval_ms "
+			"milliseconds into reusable buffers with encoding on a dedicated thread, and "
+			"returns a capture_id; poll until status is 'ready' to receive the whole batch "
+			"as a 'frames' array. One call and one result for a steady multi-second "
+			"recording - use this to verify animation or physics instead of calling "
+			"capture_viewport in a loop\n\n"
 			"Use cases:\n"
 			"- Verify actor placement after spawning/moving\n"
 			"- Check lighting changes\n"
@@ -29,10 +211,67 @@ public:
 			"- Debug visual issues\n\n"
 			"Returns: Base64-encoded JPEG image data."
 		);
-		Info.Parameters = {};
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("async"), TEXT("boolean"),
+				TEXT("Start a non-blocking capture and return a capture_id for polling"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("capture_id"), TEXT("string"),
+				TEXT("Poll a previously started async capture for its result"), false),
+			FMCPToolParameter(TEXT("encoding"), TEXT("string"),
+				TEXT("Response encoding: 'base64' (JSON field, default) or 'binary' "
+					"(raw image/jpeg response body, ~25% smaller on the wire)"), false, TEXT("base64")),
+			FMCPToolParameter(TEXT("max_width"), TEXT("number"),
+				TEXT("Output image width cap in pixels; height follows the source aspect. "
+					"Never upscales"), false, TEXT("1024")),
+			FMCPToolParameter(TEXT("region"), TEXT("object"),
+				TEXT("Crop rect in viewport pixels {x, y, width, height}; only that "
+					"sub-rect is read back and encoded"), false),
+			FMCPToolParameter(TEXT("frame_count"), TEXT("number"),
+				TEXT("Number of frames to capture; values above 1 start a sequence "
+					"capture returning a capture_id"), false, TEXT("1")),
+			FMCPToolParameter(TEXT("interval_ms"), TEXT("number"),
+				TEXT("Milliseconds between sequence frames (e.g. 100 for 10fps)"), false, TEXT("100"))
+		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
+	/**
+	 * Safe off the game thread: on a task-queue worker, Execute hops to the
+	 * game thread only to resolve the viewport and enqueue the render-thread
+	 * readback, then parks while resize + JPEG encode run on the thread pool.
+	 * The editor frame pays for the enqueue and nothing else.
+	 */
+	virtual bool IsThreadSafe() const override { return true; }
+
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Enqueue a render-thread readback and return the capture_id */
+	FMCPToolResult StartAsyncCapture(const FViewportCaptureRequest& CaptureRequest);
+
+	/** Worker-thread path: start the pipeline via a game-thread hop, then
+	 *  park until the encoded image (or capture_id) is ready */
+	FMCPToolResult ExecuteOffGameThread(const FViewportCaptureRequest& CaptureRequest,
+		bool bReturnCaptureId, bool bBinaryEncoding);
+
+	/** Check an in-flight capture; returns the image once ready */
+	FMCPToolResult PollCapture(const FString& CaptureIdString, bool bBinaryEncoding);
+
+	/** Start a sequence capture: register the schedule ticker and spin up the
+	 *  encoder thread. Game thread only; returns the capture_id immediately */
+	FMCPToolResult StartSequenceCapture(const FViewportCaptureRequest& CaptureRequest,
+		int32 FrameCount, int32 IntervalMs);
+
+	/** Check an in-flight sequence; returns the frame batch once ready */
+	FMCPToolResult PollSequence(const FGuid& CaptureId);
+
+	/** Captures started but not yet collected, keyed by capture id */
+	TMap<FGuid, TSharedPtr<FPendingViewportCapture>> PendingCaptures;
+
+	/** Sequence captures started but not yet collected */
+	TMap<FGuid, TSharedPtr<FPendingViewportSequence>> PendingSequences;
+
+	/** Guards PendingCaptures/PendingSequences (completion callbacks run off
+	 *  the game thread) */
+	FCriticalSection PendingCapturesLock;
 };
@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_Character.h"
+#include "JsonUtils.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -34,13 +35,17 @@ FMCPToolResult FMCPTool_Character::Execute(const TSharedRef<FJsonObject>& Params
 	{
 		return ExecuteSetMovementParams(Params);
 	}
+	else if (Operation == TEXT("setup_character"))
+	{
+		return ExecuteSetupCharacter(Params);
+	}
 	else if (Operation == TEXT("get_components"))
 	{
 		return ExecuteGetComponents(Params);
 	}
 
 	return FMCPToolResult::Error(FString::Printf(
-		TEXT("Unknown operation: '%s'. Valid: list_characters, get_character_info, get_movement_params, set_movement_params, get_components"),
+		TEXT("Unknown operation: '%s'. Valid: list_characters, get_character_info, get_movement_params, set_movement_params, setup_character, get_components"),
 		*Operation));
 }
 
@@ -242,84 +247,199 @@ FMCPToolResult FMCPTool_Character::ExecuteSetMovementParams(const TSharedRef<FJs
 
 	// Track what was modified
 	TArray<FString> ModifiedParams;
+	ApplyMovementParams(Movement, Params, ModifiedParams);
 
-	// Apply movement parameter modifications
-	double Value;
-
-	if (Params->TryGetNumberField(TEXT("max_walk_speed"), Value))
+	if (ModifiedParams.Num() == 0)
 	{
-		Movement->MaxWalkSpeed = static_cast<float>(FMath::Clamp(Value, 0.0, 10000.0));
-		ModifiedParams.Add(TEXT("max_walk_speed"));
+		return FMCPToolResult::Error(TEXT("No movement parameters specified to modify"));
 	}
 
-	if (Params->TryGetNumberField(TEXT("max_acceleration"), Value))
-	{
-		Movement->MaxAcceleration = static_cast<float>(FMath::Clamp(Value, 0.0, 100000.0));
-		ModifiedParams.Add(TEXT("max_acceleration"));
-	}
+	MarkActorDirty(Character);
 
-	if (Params->TryGetNumberField(TEXT("ground_friction"), Value))
-	{
-		Movement->GroundFriction = static_cast<float>(FMath::Clamp(Value, 0.0, 100.0));
-		ModifiedParams.Add(TEXT("ground_friction"));
-	}
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("character_name"), CharacterName);
+	ResultData->SetArrayField(TEXT("modified_params"), StringArrayToJsonArray(ModifiedParams));
+	ResultData->SetObjectField(TEXT("movement"), MovementComponentToJson(Movement));
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Modified %d movement params on: %s"), ModifiedParams.Num(), *CharacterName),
+		ResultData);
+}
 
-	if (Params->TryGetNumberField(TEXT("jump_z_velocity"), Value))
+FMCPToolResult FMCPTool_Character::ExecuteSetupCharacter(const TSharedRef<FJsonObject>& Params)
+{
+	UWorld* World;
+	TOptional<FMCPToolResult> Error;
+	if (ValidateEditorContext(World).IsSet())
 	{
-		Movement->JumpZVelocity = static_cast<float>(FMath::Clamp(Value, 0.0, 10000.0));
-		ModifiedParams.Add(TEXT("jump_z_velocity"));
+		return ValidateEditorContext(World).GetValue();
 	}
 
-	if (Params->TryGetNumberField(TEXT("air_control"), Value))
+	FString CharacterName;
+	if (!ExtractActorName(Params, TEXT("character_name"), CharacterName, Error))
 	{
-		Movement->AirControl = static_cast<float>(FMath::Clamp(Value, 0.0, 1.0));
-		ModifiedParams.Add(TEXT("air_control"));
+		return Error.GetValue();
 	}
 
-	if (Params->TryGetNumberField(TEXT("gravity_scale"), Value))
+	const TSharedPtr<FJsonObject>* MovementSpec = nullptr;
+	Params->TryGetObjectField(TEXT("movement"), MovementSpec);
+	const TSharedPtr<FJsonObject>* MeshSpec = nullptr;
+	Params->TryGetObjectField(TEXT("mesh"), MeshSpec);
+	const TSharedPtr<FJsonObject>* CapsuleSpec = nullptr;
+	Params->TryGetObjectField(TEXT("capsule"), CapsuleSpec);
+
+	if (!MovementSpec && !MeshSpec && !CapsuleSpec)
 	{
-		Movement->GravityScale = static_cast<float>(FMath::Clamp(Value, -10.0, 10.0));
-		ModifiedParams.Add(TEXT("gravity_scale"));
+		return FMCPToolResult::Error(TEXT("setup_character requires at least one of 'movement', 'mesh', 'capsule'"));
 	}
 
-	if (Params->TryGetNumberField(TEXT("max_step_height"), Value))
+	// The character is resolved once for the entire spec
+	FString FindError;
+	ACharacter* Character = FindCharacterByName(World, CharacterName, FindError);
+	if (!Character)
 	{
-		Movement->MaxStepHeight = static_cast<float>(FMath::Clamp(Value, 0.0, 500.0));
-		ModifiedParams.Add(TEXT("max_step_height"));
+		return FMCPToolResult::Error(FindError);
 	}
 
-	if (Params->TryGetNumberField(TEXT("walkable_floor_angle"), Value))
+	TArray<FString> Applied;
+	TArray<FString> Problems;
+
+	// Movement block (same keys and clamps as set_movement_params)
+	if (MovementSpec)
 	{
-		Movement->SetWalkableFloorAngle(static_cast<float>(FMath::Clamp(Value, 0.0, 90.0)));
-		ModifiedParams.Add(TEXT("walkable_floor_angle"));
+		if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+		{
+			TArray<FString> MovementModified;
+			ApplyMovementParams(Movement, (*MovementSpec).ToSharedRef(), MovementModified);
+			for (const FString& Name : MovementModified)
+			{
+				Applied.Add(TEXT("movement.") + Name);
+			}
+		}
+		else
+		{
+			Problems.Add(TEXT("movement: character has no CharacterMovementComponent"));
+		}
 	}
 
-	if (Params->TryGetNumberField(TEXT("braking_deceleration_walking"), Value))
+	// Mesh block: asset, anim blueprint, relative transform
+	if (MeshSpec)
 	{
-		Movement->BrakingDecelerationWalking = static_cast<float>(FMath::Clamp(Value, 0.0, 100000.0));
-		ModifiedParams.Add(TEXT("braking_deceleration_walking"));
+		if (USkeletalMeshComponent* MeshComp = Character->GetMesh())
+		{
+			FString MeshAssetPath;
+			if ((*MeshSpec)->TryGetStringField(TEXT("asset"), MeshAssetPath))
+			{
+				if (USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshAssetPath))
+				{
+					MeshComp->SetSkeletalMeshAsset(Mesh);
+					Applied.Add(TEXT("mesh.asset"));
+				}
+				else
+				{
+					Problems.Add(FString::Printf(TEXT("mesh: failed to load skeletal mesh: %s"), *MeshAssetPath));
+				}
+			}
+
+			FString AnimBlueprintPath;
+			if ((*MeshSpec)->TryGetStringField(TEXT("anim_blueprint"), AnimBlueprintPath))
+			{
+				UClass* AnimClass = LoadClass<UAnimInstance>(nullptr, *AnimBlueprintPath);
+				if (!AnimClass && !AnimBlueprintPath.EndsWith(TEXT("_C")))
+				{
+					// Try with _C suffix for Blueprint classes
+					AnimClass = LoadClass<UAnimInstance>(nullptr, *(AnimBlueprintPath + TEXT("_C")));
+				}
+				if (AnimClass)
+				{
+					MeshComp->SetAnimInstanceClass(AnimClass);
+					Applied.Add(TEXT("mesh.anim_blueprint"));
+				}
+				else
+				{
+					Problems.Add(FString::Printf(TEXT("mesh: failed to load anim blueprint class: %s"), *AnimBlueprintPath));
+				}
+			}
+
+			const TSharedPtr<FJsonObject>* LocationObj = nullptr;
+			FVector RelativeLocation;
+			if ((*MeshSpec)->TryGetObjectField(TEXT("relative_location"), LocationObj) &&
+				FJsonUtils::JsonToVector(*LocationObj, RelativeLocation))
+			{
+				MeshComp->SetRelativeLocation(RelativeLocation);
+				Applied.Add(TEXT("mesh.relative_location"));
+			}
+
+			const TSharedPtr<FJsonObject>* RotationObj = nullptr;
+			FRotator RelativeRotation;
+			if ((*MeshSpec)->TryGetObjectField(TEXT("relative_rotation"), RotationObj) &&
+				FJsonUtils::JsonToRotator(*RotationObj, RelativeRotation))
+			{
+				MeshComp->SetRelativeRotation(RelativeRotation);
+				Applied.Add(TEXT("mesh.relative_rotation"));
+			}
+		}
+		else
+		{
+			Problems.Add(TEXT("mesh: character has no SkeletalMeshComponent"));
+		}
 	}
 
-	if (Params->TryGetNumberField(TEXT("braking_friction"), Value))
+	// Capsule block
+	if (CapsuleSpec)
 	{
-		Movement->BrakingFriction = static_cast<float>(FMath::Clamp(Value, 0.0, 100.0));
-		ModifiedParams.Add(TEXT("braking_friction"));
+		if (UCapsuleComponent* Capsule = Character->GetCapsuleComponent())
+		{
+			double Radius = Capsule->GetUnscaledCapsuleRadius();
+			double HalfHeight = Capsule->GetUnscaledCapsuleHalfHeight();
+			bool bHasRadius = (*CapsuleSpec)->TryGetNumberField(TEXT("radius"), Radius);
+			bool bHasHalfHeight = (*CapsuleSpec)->TryGetNumberField(TEXT("half_height"), HalfHeight);
+			if (bHasRadius || bHasHalfHeight)
+			{
+				Capsule->SetCapsuleSize(
+					static_cast<float>(FMath::Clamp(Radius, 1.0, 1000.0)),
+					static_cast<float>(FMath::Clamp(HalfHeight, 1.0, 1000.0)));
+				if (bHasRadius)
+				{
+					Applied.Add(TEXT("capsule.radius"));
+				}
+				if (bHasHalfHeight)
+				{
+					Applied.Add(TEXT("capsule.half_height"));
+				}
+			}
+		}
+		else
+		{
+			Problems.Add(TEXT("capsule: character has no CapsuleComponent"));
+		}
 	}
 
-	if (ModifiedParams.Num() == 0)
+	if (Applied.Num() == 0)
 	{
-		return FMCPToolResult::Error(TEXT("No movement parameters specified to modify"));
+		FString FirstProblem = Problems.Num() > 0 ? Problems[0] : TEXT("spec contained no recognized settings");
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("setup_character applied nothing (%d problems, first: %s)"), Problems.Num(), *FirstProblem));
 	}
 
+	// One dirty-mark for the whole spec
 	MarkActorDirty(Character);
 
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetStringField(TEXT("character_name"), CharacterName);
-	ResultData->SetArrayField(TEXT("modified_params"), StringArrayToJsonArray(ModifiedParams));
-	ResultData->SetObjectField(TEXT("movement"), MovementComponentToJson(Movement));
+	ResultData->SetArrayField(TEXT("applied"), StringArrayToJsonArray(Applied));
+	if (Problems.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("problems"), StringArrayToJsonArray(Problems));
+	}
+	if (Character->GetCharacterMovement())
+	{
+		ResultData->SetObjectField(TEXT("movement"), MovementComponentToJson(Character->GetCharacterMovement()));
+	}
 
 	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Modified %d movement params on: %s"), ModifiedParams.Num(), *CharacterName),
+		FString::Printf(TEXT("Applied %d settings to %s%s"), Applied.Num(), *CharacterName,
+			Problems.Num() > 0 ? *FString::Printf(TEXT(" (%d problems)"), Problems.Num()) : TEXT("")),
 		ResultData);
 }
 
@@ -405,6 +525,76 @@ ACharacter* FMCPTool_Character::FindCharacterByName(UWorld* World, const FString
 	return nullptr;
 }
 
+void FMCPTool_Character::ApplyMovementParams(UCharacterMovementComponent* Movement, const TSharedRef<FJsonObject>& Source, TArray<FString>& OutModified)
+{
+	if (!Movement)
+	{
+		return;
+	}
+
+	double Value;
+
+	if (Source->TryGetNumberField(TEXT("max_walk_speed"), Value))
+	{
+		Movement->MaxWalkSpeed = static_cast<float>(FMath::Clamp(Value, 0.0, 10000.0));
+		OutModified.Add(TEXT("max_walk_speed"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("max_acceleration"), Value))
+	{
+		Movement->MaxAcceleration = static_cast<float>(FMath::Clamp(Value, 0.0, 100000.0));
+		OutModified.Add(TEXT("max_acceleration"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("ground_friction"), Value))
+	{
+		Movement->GroundFriction = static_cast<float>(FMath::Clamp(Value, 0.0, 100.0));
+		OutModified.Add(TEXT("ground_friction"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("jump_z_velocity"), Value))
+	{
+		Movement->JumpZVelocity = static_cast<float>(FMath::Clamp(Value, 0.0, 10000.0));
+		OutModified.Add(TEXT("jump_z_velocity"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("air_control"), Value))
+	{
+		Movement->AirControl = static_cast<float>(FMath::Clamp(Value, 0.0, 1.0));
+		OutModified.Add(TEXT("air_control"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("gravity_scale"), Value))
+	{
+		Movement->GravityScale = static_cast<float>(FMath::Clamp(Value, -10.0, 10.0));
+		OutModified.Add(TEXT("gravity_scale"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("max_step_height"), Value))
+	{
+		Movement->MaxStepHeight = static_cast<float>(FMath::Clamp(Value, 0.0, 500.0));
+		OutModified.Add(TEXT("max_step_height"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("walkable_floor_angle"), Value))
+	{
+		Movement->SetWalkableFloorAngle(static_cast<float>(FMath::Clamp(Value, 0.0, 90.0)));
+		OutModified.Add(TEXT("walkable_floor_angle"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("braking_deceleration_walking"), Value))
+	{
+		Movement->BrakingDecelerationWalking = static_cast<float>(FMath::Clamp(Value, 0.0, 100000.0));
+		OutModified.Add(TEXT("braking_deceleration_walking"));
+	}
+
+	if (Source->TryGetNumberField(TEXT("braking_friction"), Value))
+	{
+		Movement->BrakingFriction = static_cast<float>(FMath::Clamp(Value, 0.0, 100.0));
+		OutModified.Add(TEXT("braking_friction"));
+	}
+}
+
 TSharedPtr<FJsonObject> FMCPTool_Character::CharacterToJson(ACharacter* Character, bool bIncludeMovement)
 {
 	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
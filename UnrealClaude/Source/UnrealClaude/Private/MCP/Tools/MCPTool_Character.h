@@ -23,6 +23,8 @@ class UCharacterMovementComponent;
  *
  * Modify Operations:
  *   - set_movement_params: Modify movement values (speed, jump, friction, etc.)
+ *   - setup_character: Apply a full component spec (movement, mesh, anim,
+ *     capsule) in one pass with a single character resolution and dirty-mark
  *
  * All character actors are identified by name or label.
  */
@@ -40,6 +42,10 @@ public:
 			"- 'get_character_info': Get mesh, animation, transform details\n"
 			"- 'get_movement_params': Query movement component properties\n"
 			"- 'set_movement_params': Modify movement values (speeds, jump, friction)\n"
+			"- 'setup_character': Apply a full component spec in one call: 'movement' "
+			"(same keys as set_movement_params), 'mesh' ({asset, anim_blueprint, "
+			"relative_location, relative_rotation}), 'capsule' ({radius, half_height}). "
+			"The character is resolved and dirtied once for the whole spec\n"
 			"- 'get_components': List all components on a character\n\n"
 			"Characters are identified by actor name or label.\n\n"
 			"Movement properties include:\n"
@@ -87,6 +93,14 @@ public:
 			FMCPToolParameter(TEXT("braking_friction"), TEXT("number"),
 				TEXT("Braking friction coefficient"), false),
 
+			// For setup_character
+			FMCPToolParameter(TEXT("movement"), TEXT("object"),
+				TEXT("For setup_character: movement params object (same keys as set_movement_params)"), false),
+			FMCPToolParameter(TEXT("mesh"), TEXT("object"),
+				TEXT("For setup_character: {asset, anim_blueprint, relative_location, relative_rotation}"), false),
+			FMCPToolParameter(TEXT("capsule"), TEXT("object"),
+				TEXT("For setup_character: {radius, half_height}"), false),
+
 			// For get_components filtering
 			FMCPToolParameter(TEXT("component_class"), TEXT("string"),
 				TEXT("Filter components by class name"), false)
@@ -104,10 +118,14 @@ private:
 	FMCPToolResult ExecuteGetCharacterInfo(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteGetMovementParams(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteSetMovementParams(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteSetupCharacter(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteGetComponents(const TSharedRef<FJsonObject>& Params);
 
 	// Helper methods
 	ACharacter* FindCharacterByName(UWorld* World, const FString& NameOrLabel, FString& OutError);
+	// Applies whichever movement keys are present on Source, clamped to the
+	// same ranges as set_movement_params; appends applied names to OutModified
+	void ApplyMovementParams(UCharacterMovementComponent* Movement, const TSharedRef<FJsonObject>& Source, TArray<FString>& OutModified);
 	TSharedPtr<FJsonObject> CharacterToJson(ACharacter* Character, bool bIncludeMovement = false);
 	TSharedPtr<FJsonObject> MovementComponentToJson(UCharacterMovementComponent* Movement);
 	TSharedPtr<FJsonObject> ComponentToJson(UActorComponent* Component);
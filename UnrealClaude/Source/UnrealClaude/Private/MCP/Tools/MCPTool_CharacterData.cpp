@@ -59,6 +59,10 @@ FMCPToolResult FMCPTool_CharacterData::Execute(const TSharedRef<FJsonObject>& Pa
 	{
 		return ExecuteRemoveStatsRow(Params);
 	}
+	else if (Operation == TEXT("bulk_stats_rows"))
+	{
+		return ExecuteBulkStatsRows(Params);
+	}
 	// Application
 	else if (Operation == TEXT("apply_character_data"))
 	{
@@ -68,7 +72,7 @@ FMCPToolResult FMCPTool_CharacterData::Execute(const TSharedRef<FJsonObject>& Pa
 	return FMCPToolResult::Error(FString::Printf(
 		TEXT("Unknown operation: '%s'. Valid operations: create_character_data, query_character_data, get_character_data, ")
 		TEXT("update_character_data, create_stats_table, query_stats_table, add_stats_row, update_stats_row, ")
-		TEXT("remove_stats_row, apply_character_data"),
+		TEXT("remove_stats_row, bulk_stats_rows, apply_character_data"),
 		*Operation));
 }
 
@@ -574,6 +578,118 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteRemoveStatsRow(const TSharedRef<FJ
 		ResultData);
 }
 
+FMCPToolResult FMCPTool_CharacterData::ExecuteBulkStatsRows(const TSharedRef<FJsonObject>& Params)
+{
+	FString TablePath;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("table_path"), TablePath, Error))
+	{
+		return Error.GetValue();
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* RowsArray;
+	if (!Params->TryGetArrayField(TEXT("rows"), RowsArray) || RowsArray->Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("bulk_stats_rows requires a non-empty 'rows' array"));
+	}
+
+	// The table is resolved once for the whole batch; each mutation below is
+	// an in-memory row edit, and the dirty-mark/save rebuild happens once at
+	// the end instead of once per row
+	FString LoadError;
+	UDataTable* Table = LoadStatsTable(TablePath, LoadError);
+	if (!Table)
+	{
+		return FMCPToolResult::Error(LoadError);
+	}
+
+	int32 AddedCount = 0;
+	int32 UpdatedCount = 0;
+	int32 RemovedCount = 0;
+	TArray<TSharedPtr<FJsonValue>> RowErrors;
+
+	for (int32 Index = 0; Index < RowsArray->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* RowObject = nullptr;
+		if (!(*RowsArray)[Index]->TryGetObject(RowObject) || !RowObject->IsValid())
+		{
+			RowErrors.Add(MakeShared<FJsonValueString>(
+				FString::Printf(TEXT("rows[%d]: not an object"), Index)));
+			continue;
+		}
+
+		FString RowNameStr;
+		if (!(*RowObject)->TryGetStringField(TEXT("row_name"), RowNameStr) || RowNameStr.IsEmpty())
+		{
+			RowErrors.Add(MakeShared<FJsonValueString>(
+				FString::Printf(TEXT("rows[%d]: missing 'row_name'"), Index)));
+			continue;
+		}
+		const FName RowName(*RowNameStr);
+
+		bool bDelete = false;
+		(*RowObject)->TryGetBoolField(TEXT("delete"), bDelete);
+
+		FCharacterStatsRow* ExistingRow = Table->FindRow<FCharacterStatsRow>(RowName, TEXT(""));
+
+		if (bDelete)
+		{
+			if (!ExistingRow)
+			{
+				RowErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("rows[%d]: row '%s' not found for delete"), Index, *RowNameStr)));
+				continue;
+			}
+			Table->RemoveRow(RowName);
+			RemovedCount++;
+		}
+		else if (ExistingRow)
+		{
+			PopulateStatsRowFromParams(*ExistingRow, RowObject->ToSharedRef());
+			UpdatedCount++;
+		}
+		else
+		{
+			FCharacterStatsRow NewRow;
+			PopulateStatsRowFromParams(NewRow, RowObject->ToSharedRef());
+			Table->AddRow(RowName, NewRow);
+			AddedCount++;
+		}
+	}
+
+	const int32 MutationCount = AddedCount + UpdatedCount + RemovedCount;
+	if (MutationCount > 0)
+	{
+		Table->MarkPackageDirty();
+		FString SaveError;
+		if (!SaveAsset(Table, SaveError))
+		{
+			return FMCPToolResult::Error(SaveError);
+		}
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("table_path"), TablePath);
+	ResultData->SetNumberField(TEXT("added"), AddedCount);
+	ResultData->SetNumberField(TEXT("updated"), UpdatedCount);
+	ResultData->SetNumberField(TEXT("removed"), RemovedCount);
+	if (RowErrors.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("row_errors"), RowErrors);
+	}
+
+	if (MutationCount == 0)
+	{
+		return FMCPToolResult::Error(
+			FString::Printf(TEXT("No rows applied (%d errors)"), RowErrors.Num()));
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Bulk stats update: %d added, %d updated, %d removed (%d errors)"),
+			AddedCount, UpdatedCount, RemovedCount, RowErrors.Num()),
+		ResultData);
+}
+
 FMCPToolResult FMCPTool_CharacterData::ExecuteApplyCharacterData(const TSharedRef<FJsonObject>& Params)
 {
 	UWorld* World;
@@ -29,6 +29,7 @@ class ACharacter;
  *   - add_stats_row: Add row to stats table
  *   - update_stats_row: Modify existing row
  *   - remove_stats_row: Delete row from table
+ *   - bulk_stats_rows: Upsert/delete many rows in one call (one load, one save)
  *
  * Application:
  *   - apply_character_data: Apply config to a runtime character
@@ -54,7 +55,10 @@ public:
 			"- 'query_stats_table': Get rows from stats table\n"
 			"- 'add_stats_row': Add new row to table\n"
 			"- 'update_stats_row': Modify existing row\n"
-			"- 'remove_stats_row': Delete row from table\n\n"
+			"- 'remove_stats_row': Delete row from table\n"
+			"- 'bulk_stats_rows': Apply an array of row upserts/deletes in one call. "
+			"The table is resolved once and saved once, so importing hundreds of rows "
+			"costs one rebuild instead of one per row\n\n"
 			"Application:\n"
 			"- 'apply_character_data': Apply config to runtime character\n\n"
 			"Default asset path: /Game/Characters/"
@@ -149,6 +153,9 @@ public:
 				TEXT("Character level"), false),
 			FMCPToolParameter(TEXT("tags"), TEXT("array"),
 				TEXT("Array of tag names for stats row"), false),
+			FMCPToolParameter(TEXT("rows"), TEXT("array"),
+				TEXT("For bulk_stats_rows: array of row objects, each with 'row_name', "
+					"the stats fields to set, and optionally 'delete': true to remove the row"), false),
 
 			// Query options
 			FMCPToolParameter(TEXT("search_name"), TEXT("string"),
@@ -189,6 +196,7 @@ private:
 	FMCPToolResult ExecuteAddStatsRow(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteUpdateStatsRow(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteRemoveStatsRow(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteBulkStatsRows(const TSharedRef<FJsonObject>& Params);
 
 	// Application
 	FMCPToolResult ExecuteApplyCharacterData(const TSharedRef<FJsonObject>& Params);
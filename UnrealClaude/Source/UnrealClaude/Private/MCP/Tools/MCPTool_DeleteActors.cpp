@@ -7,6 +7,8 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
+#include "ScopedTransaction.h"
+#include "UObject/UObjectGlobals.h"
 
 FMCPToolResult FMCPTool_DeleteActors::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -103,22 +105,62 @@ FMCPToolResult FMCPTool_DeleteActors::Execute(const TSharedRef<FJsonObject>& Par
 		return FMCPToolResult::Error(TEXT("No actors specified or found to delete. Provide actor_name, actor_names array, or class_filter."));
 	}
 
-	// Delete actors
-	for (AActor* Actor : ActorsToDelete)
+	const bool bBulk = ExtractOptionalBool(Params, TEXT("bulk"), false);
+
+	if (bBulk)
 	{
-		if (Actor && IsValid(Actor))
+		// Bulk teardown: deselect first so per-actor selection/notification
+		// work is skipped, destroy inside one transaction, then pay for GC
+		// once instead of leaving pressure for a later hitch
+		if (GEditor)
+		{
+			GEditor->SelectNone(false, true, false);
+		}
+
+		{
+			FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "BulkDeleteActors", "Claude: Bulk Delete Actors"));
+
+			for (AActor* Actor : ActorsToDelete)
+			{
+				if (Actor && IsValid(Actor))
+				{
+					World->EditorDestroyActor(Actor, false);
+				}
+			}
+		}
+
+		MarkWorldDirty(World);
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+		if (GEditor)
 		{
-			World->EditorDestroyActor(Actor, false);
+			GEditor->RedrawLevelEditingViewports();
 		}
 	}
+	else
+	{
+		// Delete actors
+		for (AActor* Actor : ActorsToDelete)
+		{
+			if (Actor && IsValid(Actor))
+			{
+				World->EditorDestroyActor(Actor, false);
+			}
+		}
 
-	// Mark dirty using base class helper
-	MarkWorldDirty(World);
+		// Mark dirty using base class helper
+		MarkWorldDirty(World);
+	}
 
 	// Build result using base class helpers for JSON array construction
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetArrayField(TEXT("deleted"), StringArrayToJsonArray(DeletedNames));
 	ResultData->SetNumberField(TEXT("count"), DeletedNames.Num());
+	if (bBulk)
+	{
+		ResultData->SetBoolField(TEXT("bulk"), true);
+	}
 
 	if (NotFoundNames.Num() > 0)
 	{
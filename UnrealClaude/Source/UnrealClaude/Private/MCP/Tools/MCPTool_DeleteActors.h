@@ -22,12 +22,17 @@ public:
 			"- actor_names: Delete multiple actors by name array\n"
 			"- class_filter: Delete ALL actors of a specific class (use with caution!)\n\n"
 			"Best practice: Use get_level_actors first to verify which actors will be deleted.\n\n"
+			"For tearing down large amounts of generated content, set 'bulk' to true: "
+			"destruction runs in one transaction without per-actor editor notifications "
+			"and ends with a single garbage collection pass.\n\n"
 			"Returns: List of deleted actor names and count."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("actor_names"), TEXT("array"), TEXT("Array of actor names to delete"), false),
 			FMCPToolParameter(TEXT("actor_name"), TEXT("string"), TEXT("Single actor name to delete (alternative to actor_names)"), false),
-			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Delete all actors matching this class name"), false)
+			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Delete all actors matching this class name"), false),
+			FMCPToolParameter(TEXT("bulk"), TEXT("boolean"),
+				TEXT("Bulk teardown: one transaction, no per-actor notifications, one explicit GC pass at the end (default: false)"), false, TEXT("false"))
 		};
 		Info.Annotations = FMCPToolAnnotations::Destructive();
 		return Info;
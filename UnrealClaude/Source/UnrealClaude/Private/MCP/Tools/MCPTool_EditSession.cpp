@@ -0,0 +1,194 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_EditSession.h"
+#include "MCP/MCPToolRegistry.h"
+#include "UnrealClaudeModule.h"
+#include "FileHelpers.h"
+#include "UObject/Package.h"
+
+FMCPToolResult FMCPTool_EditSession::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	FString Operation;
+	TOptional<FMCPToolResult> ParamError;
+	if (!ExtractRequiredString(Params, TEXT("operation"), Operation, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
+	if (!Registry)
+	{
+		return FMCPToolResult::Error(TEXT("Tool registry is not available"));
+	}
+
+	if (Operation == TEXT("begin"))
+	{
+		FString Description = TEXT("Claude Edit Session");
+		Params->TryGetStringField(TEXT("description"), Description);
+
+		FString ErrorMsg;
+		if (!Registry->BeginEditSession(Description, ErrorMsg))
+		{
+			return FMCPToolResult::Error(ErrorMsg);
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("description"), Description);
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Edit session opened: %s"), *Description), ResultData);
+	}
+
+	if (Operation == TEXT("end"))
+	{
+		const FString Description = Registry->GetEditSessionDescription();
+		FString ErrorMsg;
+		if (!Registry->EndEditSession(ErrorMsg))
+		{
+			return FMCPToolResult::Error(ErrorMsg);
+		}
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Edit session committed as one undo entry: %s"), *Description));
+	}
+
+	if (Operation == TEXT("cancel"))
+	{
+		const FString Description = Registry->GetEditSessionDescription();
+		FString ErrorMsg;
+		if (!Registry->CancelEditSession(ErrorMsg))
+		{
+			return FMCPToolResult::Error(ErrorMsg);
+		}
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Edit session cancelled, changes rolled back: %s"), *Description));
+	}
+
+	if (Operation == TEXT("checkpoint"))
+	{
+		const FString Label = ExtractOptionalString(Params, TEXT("label"));
+
+		int32 CheckpointId = INDEX_NONE;
+		FString ErrorMsg;
+		if (!Registry->CheckpointEditSession(Label, CheckpointId, ErrorMsg))
+		{
+			return FMCPToolResult::Error(ErrorMsg);
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetNumberField(TEXT("checkpoint_id"), CheckpointId);
+		if (!Label.IsEmpty())
+		{
+			ResultData->SetStringField(TEXT("label"), Label);
+		}
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Checkpoint %d taken"), CheckpointId), ResultData);
+	}
+
+	if (Operation == TEXT("rollback"))
+	{
+		const int32 CheckpointId = ExtractOptionalNumber<int32>(Params, TEXT("checkpoint_id"), INDEX_NONE);
+
+		FString ErrorMsg;
+		if (!Registry->RollbackEditSession(CheckpointId, ErrorMsg))
+		{
+			return FMCPToolResult::Error(ErrorMsg);
+		}
+
+		const TArray<FMCPEditSessionCheckpoint>& Checkpoints = Registry->GetEditSessionCheckpoints();
+		const int32 RestoredId = Checkpoints.Num() > 0 ? Checkpoints.Last().Id : INDEX_NONE;
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetNumberField(TEXT("checkpoint_id"), RestoredId);
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Rolled back to checkpoint %d; session still open"), RestoredId),
+			ResultData);
+	}
+
+	if (Operation == TEXT("status"))
+	{
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		const bool bActive = Registry->IsEditSessionActive();
+		ResultData->SetBoolField(TEXT("active"), bActive);
+		if (bActive)
+		{
+			ResultData->SetStringField(TEXT("description"), Registry->GetEditSessionDescription());
+			const FTimespan Elapsed = FDateTime::UtcNow() - Registry->GetEditSessionStartTime();
+			ResultData->SetNumberField(TEXT("elapsed_seconds"), Elapsed.GetTotalSeconds());
+
+			TArray<TSharedPtr<FJsonValue>> CheckpointValues;
+			for (const FMCPEditSessionCheckpoint& Checkpoint : Registry->GetEditSessionCheckpoints())
+			{
+				TSharedPtr<FJsonObject> CheckpointJson = MakeShared<FJsonObject>();
+				CheckpointJson->SetNumberField(TEXT("checkpoint_id"), Checkpoint.Id);
+				if (!Checkpoint.Label.IsEmpty())
+				{
+					CheckpointJson->SetStringField(TEXT("label"), Checkpoint.Label);
+				}
+				CheckpointJson->SetStringField(TEXT("created_at"), Checkpoint.CreatedAt.ToIso8601());
+				CheckpointValues.Add(MakeShared<FJsonValueObject>(CheckpointJson));
+			}
+			ResultData->SetArrayField(TEXT("checkpoints"), CheckpointValues);
+		}
+		return FMCPToolResult::Success(
+			bActive ? TEXT("An edit session is open") : TEXT("No edit session is open"),
+			ResultData);
+	}
+
+	if (Operation == TEXT("save_modified"))
+	{
+		if (Registry->IsEditSessionActive())
+		{
+			return FMCPToolResult::Error(
+				TEXT("An edit session is still open. End it first so the save is not recorded into the transaction."));
+		}
+
+		// Enumerate what is dirty so the result can name it
+		TArray<UPackage*> DirtyPackages;
+		FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+		const int32 DirtyMapCount = DirtyPackages.Num();
+		FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+
+		if (DirtyPackages.Num() == 0)
+		{
+			return FMCPToolResult::Success(TEXT("No modified packages to save"));
+		}
+
+		TArray<FString> PackageNames;
+		PackageNames.Reserve(DirtyPackages.Num());
+		for (UPackage* Package : DirtyPackages)
+		{
+			PackageNames.Add(Package->GetName());
+		}
+		PackageNames.Sort();
+
+		// One batched pass over everything: a single checkout round and no
+		// per-package prompting, instead of autosave trickling them out
+		const bool bSaved = FEditorFileUtils::SaveDirtyPackages(
+			/*bPromptUserToSave*/ false,
+			/*bSaveMapPackages*/ true,
+			/*bSaveContentPackages*/ true);
+
+		UE_LOG(LogUnrealClaude, Log, TEXT("Batched save of %d dirty packages (%d maps): %s"),
+			PackageNames.Num(), DirtyMapCount, bSaved ? TEXT("ok") : TEXT("incomplete"));
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> NameValues;
+		for (const FString& Name : PackageNames)
+		{
+			NameValues.Add(MakeShared<FJsonValueString>(Name));
+		}
+		ResultData->SetArrayField(TEXT("packages"), NameValues);
+		ResultData->SetNumberField(TEXT("count"), PackageNames.Num());
+		ResultData->SetNumberField(TEXT("map_count"), DirtyMapCount);
+		ResultData->SetBoolField(TEXT("all_saved"), bSaved);
+
+		if (!bSaved)
+		{
+			return FMCPToolResult::Error(FString::Printf(
+				TEXT("Batched save completed with failures (%d packages attempted)"), PackageNames.Num()));
+		}
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Saved %d modified packages in one pass"), PackageNames.Num()),
+			ResultData);
+	}
+
+	return FMCPToolResult::Error(FString::Printf(
+		TEXT("Unknown operation '%s'. Valid: begin, end, cancel, checkpoint, rollback, status, save_modified"), *Operation));
+}
@@ -0,0 +1,89 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+class FMCPToolRegistry;
+
+/**
+ * MCP Tool: Session-scoped editor transactions
+ *
+ * Opens and closes a single editor transaction spanning many tool calls.
+ * Mutating tools each wrap their work in a transaction; with a session open
+ * those nest inside it, so a long agent workflow snapshots each object once
+ * and collapses to one undo entry instead of one per call.
+ *
+ * While a session is open, editor autosave is pushed out on every tool call
+ * so dirtied packages accumulate instead of triggering mid-session save
+ * storms; save_modified then flushes everything in one batched save pass.
+ *
+ * Checkpoints divide a session into transaction segments: rollback discards
+ * everything after a checkpoint in one pass and keeps the session open, so
+ * a plan that fails at step 7 of 10 recovers without hunting through undo
+ * entries mixed with human edits.
+ */
+class FMCPTool_EditSession : public FMCPToolBase
+{
+public:
+	/** Raw pointer: the registry owns every tool and always outlives them */
+	FMCPTool_EditSession(FMCPToolRegistry* InRegistry)
+		: Registry(InRegistry)
+	{
+	}
+
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("edit_session");
+		Info.Description = TEXT(
+			"Group many mutating tool calls into one editor transaction.\n\n"
+			"While a session is open, every change made by tools like set_property, "
+			"blueprint_modify, spawn_actor and move_actor is recorded into a single "
+			"undo entry, and each object is snapshotted once instead of once per call. "
+			"Use this around multi-step workflows so the user can undo the whole "
+			"thing in one step.\n\n"
+			"Operations:\n"
+			"- 'begin' - Open a session (fails if one is already open)\n"
+			"- 'end' - Commit the open session as one undo entry\n"
+			"- 'cancel' - Abort the open session, rolling back every change in it\n"
+			"- 'checkpoint' - Mark a recovery point inside the open session. "
+			"Take one before each risky step of a multi-step plan\n"
+			"- 'rollback' - Discard every change made after a checkpoint in one "
+			"pass, keeping the session open so the plan can retry from there. "
+			"Defaults to the most recent checkpoint; pass 'checkpoint_id' to "
+			"target an earlier one\n"
+			"- 'status' - Report whether a session is open, for how long, and "
+			"its checkpoints\n"
+			"- 'save_modified' - Save every dirty package in one batched pass "
+			"(maps and content, single source-control checkout round). While a "
+			"session is open, autosave is deferred on each tool call, so run this "
+			"after ending a bulk edit session instead of waiting for save storms\n\n"
+			"Only one session can be open at a time. Sessions left open are "
+			"committed automatically when the MCP server shuts down.\n\n"
+			"Checkpoints cost two transaction calls, not a serialization pass: "
+			"the open transaction already snapshotted every touched object. A "
+			"session with checkpoints commits as one undo entry per sealed "
+			"segment instead of a single entry.\n\n"
+			"Returns: Session state confirmation."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("operation"), TEXT("string"),
+				TEXT("One of: 'begin', 'end', 'cancel', 'checkpoint', 'rollback', 'status', 'save_modified'"), true),
+			FMCPToolParameter(TEXT("description"), TEXT("string"),
+				TEXT("Label for the undo entry (begin only, default: 'Claude Edit Session')"), false),
+			FMCPToolParameter(TEXT("label"), TEXT("string"),
+				TEXT("Label for the checkpoint (checkpoint only, e.g. 'before step 7')"), false),
+			FMCPToolParameter(TEXT("checkpoint_id"), TEXT("number"),
+				TEXT("Checkpoint to roll back to (rollback only, default: most recent)"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	FMCPToolRegistry* Registry;
+};
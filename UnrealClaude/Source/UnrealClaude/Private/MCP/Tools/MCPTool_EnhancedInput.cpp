@@ -52,6 +52,10 @@ FMCPToolResult FMCPTool_EnhancedInput::Execute(const TSharedRef<FJsonObject>& Pa
 	{
 		return ExecuteAddModifier(Params);
 	}
+	if (Operation == TEXT("build_scheme"))
+	{
+		return ExecuteBuildScheme(Params);
+	}
 	if (Operation == TEXT("query_context"))
 	{
 		return ExecuteQueryContext(Params);
@@ -63,7 +67,7 @@ FMCPToolResult FMCPTool_EnhancedInput::Execute(const TSharedRef<FJsonObject>& Pa
 
 	return FMCPToolResult::Error(FString::Printf(
 		TEXT("Unknown operation: %s. Valid operations: create_input_action, create_mapping_context, "
-			"add_mapping, remove_mapping, add_trigger, add_modifier, query_context, query_action"),
+			"add_mapping, remove_mapping, add_trigger, add_modifier, build_scheme, query_context, query_action"),
 		*Operation));
 }
 
@@ -93,26 +97,10 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteCreateInputAction(const TSharedRef
 
 	// Parse value type
 	EInputActionValueType ValueType = EInputActionValueType::Boolean;
-	if (ValueTypeStr == TEXT("Digital") || ValueTypeStr == TEXT("Boolean") || ValueTypeStr == TEXT("Bool"))
-	{
-		ValueType = EInputActionValueType::Boolean;
-	}
-	else if (ValueTypeStr == TEXT("Axis1D") || ValueTypeStr == TEXT("Float"))
-	{
-		ValueType = EInputActionValueType::Axis1D;
-	}
-	else if (ValueTypeStr == TEXT("Axis2D") || ValueTypeStr == TEXT("Vector2D"))
-	{
-		ValueType = EInputActionValueType::Axis2D;
-	}
-	else if (ValueTypeStr == TEXT("Axis3D") || ValueTypeStr == TEXT("Vector"))
-	{
-		ValueType = EInputActionValueType::Axis3D;
-	}
-	else
+	FString TypeError;
+	if (!ParseValueType(ValueTypeStr, ValueType, TypeError))
 	{
-		return FMCPToolResult::Error(FString::Printf(
-			TEXT("Invalid value_type: %s. Valid types: Digital, Axis1D, Axis2D, Axis3D"), *ValueTypeStr));
+		return FMCPToolResult::Error(TypeError);
 	}
 
 	// Create package
@@ -504,6 +492,335 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteAddModifier(const TSharedRef<FJson
 		ResultData);
 }
 
+// ============================================================================
+// Batch Construction
+// ============================================================================
+
+FMCPToolResult FMCPTool_EnhancedInput::ExecuteBuildScheme(const TSharedRef<FJsonObject>& Params)
+{
+	FString PackagePath = ExtractOptionalString(Params, TEXT("package_path"), TEXT("/Game/Input"));
+
+	// Validate path
+	FString ValidationError;
+	if (!FMCPParamValidator::ValidateBlueprintPath(PackagePath, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ActionSpecs = nullptr;
+	Params->TryGetArrayField(TEXT("actions"), ActionSpecs);
+	const TArray<TSharedPtr<FJsonValue>>* ContextSpecs = nullptr;
+	Params->TryGetArrayField(TEXT("contexts"), ContextSpecs);
+
+	if ((!ActionSpecs || ActionSpecs->Num() == 0) && (!ContextSpecs || ContextSpecs->Num() == 0))
+	{
+		return FMCPToolResult::Error(TEXT("build_scheme requires a non-empty 'actions' and/or 'contexts' array"));
+	}
+
+	// Actions available to mappings by bare name (created, reused, or loaded)
+	TMap<FString, UInputAction*> ActionsByName;
+	TArray<TSharedPtr<FJsonValue>> Problems;
+	int32 ActionsCreated = 0;
+	int32 ActionsReused = 0;
+	int32 ContextsBuilt = 0;
+	int32 MappingsAdded = 0;
+
+	auto AddProblem = [&Problems](const FString& Problem)
+	{
+		Problems.Add(MakeShared<FJsonValueString>(Problem));
+	};
+
+	// Phase 1: create all InputActions, each saved exactly once. Existing
+	// assets with the same name are reused so re-running a scheme is safe.
+	if (ActionSpecs)
+	{
+		for (const TSharedPtr<FJsonValue>& SpecValue : *ActionSpecs)
+		{
+			const TSharedPtr<FJsonObject>* SpecObject = nullptr;
+			if (!SpecValue.IsValid() || !SpecValue->TryGetObject(SpecObject))
+			{
+				AddProblem(TEXT("actions: entry is not an object"));
+				continue;
+			}
+
+			FString Name;
+			if (!(*SpecObject)->TryGetStringField(TEXT("name"), Name) || Name.IsEmpty())
+			{
+				AddProblem(TEXT("actions: entry missing 'name'"));
+				continue;
+			}
+
+			FString FullPath = PackagePath / Name;
+			if (UInputAction* Existing = LoadObject<UInputAction>(nullptr, *(FullPath + TEXT(".") + Name)))
+			{
+				ActionsByName.Add(Name, Existing);
+				ActionsReused++;
+				continue;
+			}
+
+			FString ValueTypeStr;
+			(*SpecObject)->TryGetStringField(TEXT("value_type"), ValueTypeStr);
+			if (ValueTypeStr.IsEmpty())
+			{
+				ValueTypeStr = TEXT("Digital");
+			}
+
+			EInputActionValueType ValueType = EInputActionValueType::Boolean;
+			FString TypeError;
+			if (!ParseValueType(ValueTypeStr, ValueType, TypeError))
+			{
+				AddProblem(FString::Printf(TEXT("action '%s': %s"), *Name, *TypeError));
+				continue;
+			}
+
+			UPackage* Package = CreatePackage(*FullPath);
+			if (!Package)
+			{
+				AddProblem(FString::Printf(TEXT("action '%s': failed to create package %s"), *Name, *FullPath));
+				continue;
+			}
+
+			UInputAction* NewAction = NewObject<UInputAction>(Package, FName(*Name), RF_Public | RF_Standalone);
+			if (!NewAction)
+			{
+				AddProblem(FString::Printf(TEXT("action '%s': failed to create InputAction"), *Name));
+				continue;
+			}
+			NewAction->ValueType = ValueType;
+
+			Package->MarkPackageDirty();
+			FString SaveError;
+			if (!SaveAsset(NewAction, SaveError))
+			{
+				AddProblem(FString::Printf(TEXT("action '%s': %s"), *Name, *SaveError));
+				continue;
+			}
+			FAssetRegistryModule::AssetCreated(NewAction);
+
+			ActionsByName.Add(Name, NewAction);
+			ActionsCreated++;
+		}
+	}
+
+	// Resolves a mapping's action reference: batch name first, then asset path.
+	// Loaded actions are cached so each asset is resolved at most once.
+	auto ResolveAction = [this, &ActionsByName, &PackagePath](const FString& Reference, FString& OutError) -> UInputAction*
+	{
+		if (UInputAction** Found = ActionsByName.Find(Reference))
+		{
+			return *Found;
+		}
+		const FString Path = Reference.Contains(TEXT("/")) ? Reference : PackagePath / Reference;
+		UInputAction* Loaded = LoadInputAction(Path, OutError);
+		if (Loaded)
+		{
+			ActionsByName.Add(Reference, Loaded);
+		}
+		return Loaded;
+	};
+
+	// Phase 2: build each context with its full mapping/trigger/modifier chain,
+	// dirtying and saving the context once no matter how many mappings it holds
+	if (ContextSpecs)
+	{
+		for (const TSharedPtr<FJsonValue>& SpecValue : *ContextSpecs)
+		{
+			const TSharedPtr<FJsonObject>* SpecObject = nullptr;
+			if (!SpecValue.IsValid() || !SpecValue->TryGetObject(SpecObject))
+			{
+				AddProblem(TEXT("contexts: entry is not an object"));
+				continue;
+			}
+
+			UInputMappingContext* Context = nullptr;
+			bool bNewContext = false;
+			FString ContextLabel;
+
+			FString ContextPath, ContextName;
+			if ((*SpecObject)->TryGetStringField(TEXT("path"), ContextPath) && !ContextPath.IsEmpty())
+			{
+				FString LoadError;
+				Context = LoadMappingContext(ContextPath, LoadError);
+				if (!Context)
+				{
+					AddProblem(LoadError);
+					continue;
+				}
+				ContextLabel = Context->GetName();
+			}
+			else if ((*SpecObject)->TryGetStringField(TEXT("name"), ContextName) && !ContextName.IsEmpty())
+			{
+				ContextLabel = ContextName;
+				FString FullPath = PackagePath / ContextName;
+				Context = LoadObject<UInputMappingContext>(nullptr, *(FullPath + TEXT(".") + ContextName));
+				if (!Context)
+				{
+					UPackage* Package = CreatePackage(*FullPath);
+					if (!Package)
+					{
+						AddProblem(FString::Printf(TEXT("context '%s': failed to create package %s"), *ContextName, *FullPath));
+						continue;
+					}
+					Context = NewObject<UInputMappingContext>(Package, FName(*ContextName), RF_Public | RF_Standalone);
+					if (!Context)
+					{
+						AddProblem(FString::Printf(TEXT("context '%s': failed to create InputMappingContext"), *ContextName));
+						continue;
+					}
+					bNewContext = true;
+				}
+			}
+			else
+			{
+				AddProblem(TEXT("contexts: entry needs 'name' (create) or 'path' (existing)"));
+				continue;
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* MappingSpecs = nullptr;
+			(*SpecObject)->TryGetArrayField(TEXT("mappings"), MappingSpecs);
+			if (MappingSpecs)
+			{
+				for (const TSharedPtr<FJsonValue>& MappingValue : *MappingSpecs)
+				{
+					const TSharedPtr<FJsonObject>* MappingObject = nullptr;
+					if (!MappingValue.IsValid() || !MappingValue->TryGetObject(MappingObject))
+					{
+						AddProblem(FString::Printf(TEXT("context '%s': mapping is not an object"), *ContextLabel));
+						continue;
+					}
+
+					FString ActionRef, KeyName;
+					if (!(*MappingObject)->TryGetStringField(TEXT("action"), ActionRef) ||
+						!(*MappingObject)->TryGetStringField(TEXT("key"), KeyName))
+					{
+						AddProblem(FString::Printf(TEXT("context '%s': mapping needs 'action' and 'key'"), *ContextLabel));
+						continue;
+					}
+
+					FString ResolveError;
+					UInputAction* Action = ResolveAction(ActionRef, ResolveError);
+					if (!Action)
+					{
+						AddProblem(FString::Printf(TEXT("context '%s': %s"), *ContextLabel, *ResolveError));
+						continue;
+					}
+
+					FString KeyError;
+					FKey Key = ParseKey(KeyName, KeyError);
+					if (!Key.IsValid())
+					{
+						AddProblem(FString::Printf(TEXT("context '%s': %s"), *ContextLabel, *KeyError));
+						continue;
+					}
+
+					// The reference is consumed before the next MapKey call can
+					// reallocate the mappings array
+					FEnhancedActionKeyMapping& NewMapping = Context->MapKey(Action, Key);
+
+					const TArray<TSharedPtr<FJsonValue>>* TriggerSpecs = nullptr;
+					(*MappingObject)->TryGetArrayField(TEXT("triggers"), TriggerSpecs);
+					if (TriggerSpecs)
+					{
+						for (const TSharedPtr<FJsonValue>& TriggerValue : *TriggerSpecs)
+						{
+							const TSharedPtr<FJsonObject>* TriggerObject = nullptr;
+							FString TriggerType;
+							if (!TriggerValue.IsValid() || !TriggerValue->TryGetObject(TriggerObject) ||
+								!(*TriggerObject)->TryGetStringField(TEXT("type"), TriggerType))
+							{
+								AddProblem(FString::Printf(TEXT("context '%s': %s -> %s: trigger needs 'type'"),
+									*ContextLabel, *KeyName, *ActionRef));
+								continue;
+							}
+
+							FString TriggerError;
+							UInputTrigger* Trigger = CreateTrigger(TriggerType, (*TriggerObject).ToSharedRef(), TriggerError);
+							if (!Trigger)
+							{
+								AddProblem(FString::Printf(TEXT("context '%s': %s -> %s: %s"),
+									*ContextLabel, *KeyName, *ActionRef, *TriggerError));
+								continue;
+							}
+							NewMapping.Triggers.Add(Trigger);
+						}
+					}
+
+					const TArray<TSharedPtr<FJsonValue>>* ModifierSpecs = nullptr;
+					(*MappingObject)->TryGetArrayField(TEXT("modifiers"), ModifierSpecs);
+					if (ModifierSpecs)
+					{
+						for (const TSharedPtr<FJsonValue>& ModifierValue : *ModifierSpecs)
+						{
+							const TSharedPtr<FJsonObject>* ModifierObject = nullptr;
+							FString ModifierType;
+							if (!ModifierValue.IsValid() || !ModifierValue->TryGetObject(ModifierObject) ||
+								!(*ModifierObject)->TryGetStringField(TEXT("type"), ModifierType))
+							{
+								AddProblem(FString::Printf(TEXT("context '%s': %s -> %s: modifier needs 'type'"),
+									*ContextLabel, *KeyName, *ActionRef));
+								continue;
+							}
+
+							FString ModifierError;
+							UInputModifier* Modifier = CreateModifier(ModifierType, (*ModifierObject).ToSharedRef(), ModifierError);
+							if (!Modifier)
+							{
+								AddProblem(FString::Printf(TEXT("context '%s': %s -> %s: %s"),
+									*ContextLabel, *KeyName, *ActionRef, *ModifierError));
+								continue;
+							}
+							NewMapping.Modifiers.Add(Modifier);
+						}
+					}
+
+					MappingsAdded++;
+				}
+			}
+
+			// One dirty-mark and save per context for the whole batch
+			Context->MarkPackageDirty();
+			FString SaveError;
+			if (!SaveAsset(Context, SaveError))
+			{
+				AddProblem(FString::Printf(TEXT("context '%s': %s"), *ContextLabel, *SaveError));
+				continue;
+			}
+			if (bNewContext)
+			{
+				FAssetRegistryModule::AssetCreated(Context);
+			}
+			ContextsBuilt++;
+		}
+	}
+
+	if (ActionsCreated == 0 && ActionsReused == 0 && ContextsBuilt == 0)
+	{
+		FString FirstProblem = Problems.Num() > 0 ? Problems[0]->AsString() : TEXT("empty spec");
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("build_scheme produced nothing (%d problems, first: %s)"), Problems.Num(), *FirstProblem));
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Built input scheme: %d actions created, %d reused, %d contexts, %d mappings, %d problems"),
+		ActionsCreated, ActionsReused, ContextsBuilt, MappingsAdded, Problems.Num());
+
+	// Build result
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("actions_created"), ActionsCreated);
+	ResultData->SetNumberField(TEXT("actions_reused"), ActionsReused);
+	ResultData->SetNumberField(TEXT("contexts_built"), ContextsBuilt);
+	ResultData->SetNumberField(TEXT("mappings_added"), MappingsAdded);
+	if (Problems.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("problems"), Problems);
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Built input scheme: %d actions created, %d reused, %d contexts, %d mappings%s"),
+			ActionsCreated, ActionsReused, ContextsBuilt, MappingsAdded,
+			Problems.Num() > 0 ? *FString::Printf(TEXT(" (%d problems)"), Problems.Num()) : TEXT("")),
+		ResultData);
+}
+
 // ============================================================================
 // Query Operations
 // ============================================================================
@@ -670,6 +987,34 @@ FKey FMCPTool_EnhancedInput::ParseKey(const FString& KeyName, FString& OutError)
 	return ParsedKey;
 }
 
+bool FMCPTool_EnhancedInput::ParseValueType(const FString& ValueTypeStr, EInputActionValueType& OutValueType, FString& OutError)
+{
+	if (ValueTypeStr == TEXT("Digital") || ValueTypeStr == TEXT("Boolean") || ValueTypeStr == TEXT("Bool"))
+	{
+		OutValueType = EInputActionValueType::Boolean;
+	}
+	else if (ValueTypeStr == TEXT("Axis1D") || ValueTypeStr == TEXT("Float"))
+	{
+		OutValueType = EInputActionValueType::Axis1D;
+	}
+	else if (ValueTypeStr == TEXT("Axis2D") || ValueTypeStr == TEXT("Vector2D"))
+	{
+		OutValueType = EInputActionValueType::Axis2D;
+	}
+	else if (ValueTypeStr == TEXT("Axis3D") || ValueTypeStr == TEXT("Vector"))
+	{
+		OutValueType = EInputActionValueType::Axis3D;
+	}
+	else
+	{
+		OutError = FString::Printf(
+			TEXT("Invalid value_type: %s. Valid types: Digital, Axis1D, Axis2D, Axis3D"), *ValueTypeStr);
+		return false;
+	}
+
+	return true;
+}
+
 int32 FMCPTool_EnhancedInput::FindMappingIndex(
 	UInputMappingContext* Context,
 	UInputAction* Action,
@@ -11,6 +11,7 @@ class UInputMappingContext;
 class UInputTrigger;
 class UInputModifier;
 struct FEnhancedActionKeyMapping;
+enum class EInputActionValueType : uint8;
 
 /**
  * MCP Tool: Enhanced Input System
@@ -28,6 +29,11 @@ struct FEnhancedActionKeyMapping;
  *   - add_trigger: Add trigger to existing mapping
  *   - add_modifier: Add modifier to existing mapping
  *
+ * Batch Construction:
+ *   - build_scheme: Build a whole control scheme (actions, contexts, mappings
+ *     with trigger/modifier chains) from one declarative spec, saving each
+ *     asset once
+ *
  * Query Operations:
  *   - query_context: List all mappings in a context
  *   - query_action: Get InputAction details
@@ -50,6 +56,12 @@ public:
 			"- 'remove_mapping': Remove key binding from context\n"
 			"- 'add_trigger': Add trigger (Hold, Tap, etc.) to mapping\n"
 			"- 'add_modifier': Add modifier (Negate, Scale, etc.) to mapping\n"
+			"- 'build_scheme': Build a whole control scheme in one call from a "
+			"declarative spec: 'actions' (array of {name, value_type}) and 'contexts' "
+			"(array of {name or path, mappings: [{action, key, triggers, modifiers}]}). "
+			"Actions are referenced by name or path; each trigger/modifier object has "
+			"'type' plus the same fields as add_trigger/add_modifier. Every asset is "
+			"created/loaded once and saved once, so a 60-action scheme is one round-trip\n"
 			"- 'query_context': List all mappings in a context\n"
 			"- 'query_action': Get InputAction details\n\n"
 			"Value Types: 'Digital' (bool), 'Axis1D' (float), 'Axis2D' (Vector2D), 'Axis3D' (Vector)\n\n"
@@ -114,7 +126,15 @@ public:
 
 			// For remove_mapping - index based
 			FMCPToolParameter(TEXT("mapping_index"), TEXT("number"),
-				TEXT("Index of mapping to remove (from query_context)"), false)
+				TEXT("Index of mapping to remove (from query_context)"), false),
+
+			// For build_scheme
+			FMCPToolParameter(TEXT("actions"), TEXT("array"),
+				TEXT("For build_scheme: array of {name, value_type} InputActions to create "
+					"(existing assets with the same name are reused)"), false),
+			FMCPToolParameter(TEXT("contexts"), TEXT("array"),
+				TEXT("For build_scheme: array of {name or path, mappings} context specs; each "
+					"mapping is {action, key, triggers?, modifiers?}"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
@@ -133,6 +153,9 @@ private:
 	FMCPToolResult ExecuteAddTrigger(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteAddModifier(const TSharedRef<FJsonObject>& Params);
 
+	// Batch Construction
+	FMCPToolResult ExecuteBuildScheme(const TSharedRef<FJsonObject>& Params);
+
 	// Query Operations
 	FMCPToolResult ExecuteQueryContext(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteQueryAction(const TSharedRef<FJsonObject>& Params);
@@ -142,6 +165,7 @@ private:
 	UInputMappingContext* LoadMappingContext(const FString& Path, FString& OutError);
 	bool SaveAsset(UObject* Asset, FString& OutError);
 	FKey ParseKey(const FString& KeyName, FString& OutError);
+	bool ParseValueType(const FString& ValueTypeStr, EInputActionValueType& OutValueType, FString& OutError);
 
 	// Trigger creation helpers
 	UInputTrigger* CreateTrigger(const FString& TriggerType, const TSharedRef<FJsonObject>& Params, FString& OutError);
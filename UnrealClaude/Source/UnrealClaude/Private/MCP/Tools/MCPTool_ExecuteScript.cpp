@@ -109,13 +109,42 @@ FMCPToolResult FMCPTool_ExecuteScript::ExecuteSync(const TSharedRef<FJsonObject>
 		Description = HeaderDescription;
 	}
 
+	// Optional escape hatch from the persistent Python context
+	bool bResetPythonContext = false;
+	if (Params->TryGetBoolField(TEXT("reset_python_context"), bResetPythonContext) && bResetPythonContext)
+	{
+		FScriptExecutionManager::Get().ResetPythonContext();
+	}
+
 	UE_LOG(LogUnrealClaude, Log, TEXT("Executing %s script: %s"), *ScriptTypeStr, *Description);
 
+	// When running through the task queue, stream output into the owning
+	// task so task_status pollers see partial progress (and can cancel a
+	// wrong-track script instead of waiting out the timeout)
+	FScriptExecutionManager::FScriptOutputSink OutputSink;
+	FString TaskIdString;
+	if (TaskQueue.IsValid() && Params->TryGetStringField(TEXT("_task_id"), TaskIdString))
+	{
+		FGuid OwnerTaskId;
+		if (FGuid::Parse(TaskIdString, OwnerTaskId))
+		{
+			TSharedPtr<FMCPAsyncTask> OwnerTask = TaskQueue->GetTask(OwnerTaskId);
+			if (OwnerTask.IsValid())
+			{
+				OutputSink = [OwnerTask](const FString& Chunk)
+				{
+					OwnerTask->AppendPartialOutput(Chunk);
+				};
+			}
+		}
+	}
+
 	// Execute script via manager
 	FScriptExecutionResult Result = FScriptExecutionManager::Get().ExecuteScript(
 		ScriptType,
 		ScriptContent,
-		Description
+		Description,
+		OutputSink
 	);
 
 	// Build result data
@@ -125,6 +154,19 @@ FMCPToolResult FMCPTool_ExecuteScript::ExecuteSync(const TSharedRef<FJsonObject>
 	ResultData->SetStringField(TEXT("output"), Result.Output);
 	ResultData->SetNumberField(TEXT("retry_count"), Result.RetryCount);
 
+	// Log lines captured while the script ran, already scoped to exactly this
+	// execution - no get_output_log timestamp-matching needed afterwards.
+	// Tagged with the owning task GUID when running through the queue so
+	// overlapping tasks stay unambiguous.
+	if (!Result.LogOutput.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("log"), Result.LogOutput);
+	}
+	if (!TaskIdString.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("task_id"), TaskIdString);
+	}
+
 	if (Result.bSuccess)
 	{
 		return FMCPToolResult::Success(Result.Message, ResultData);
@@ -72,6 +72,13 @@ public:
 				TEXT("string"),
 				TEXT("Brief description (optional if @Description in header)"),
 				false
+			),
+			FMCPToolParameter(
+				TEXT("reset_python_context"),
+				TEXT("boolean"),
+				TEXT("Python scripts run in a persistent context that keeps imports and "
+					"helpers across calls. Set true to discard it before this run."),
+				false
 			)
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
@@ -2,12 +2,105 @@
 
 #include "MCPTool_GetLevelActors.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPActorSpatialIndex.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeUtils.h"
 #include "Editor.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
+#include "Misc/Guid.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** Per-actor state captured for snapshot diffing */
+	struct FActorSnapshotEntry
+	{
+		FString Label;
+		FString ClassName;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		FVector Scale = FVector::OneVector;
+		bool bHidden = false;
+
+		bool Matches(const FActorSnapshotEntry& Other) const
+		{
+			return Label == Other.Label
+				&& ClassName == Other.ClassName
+				&& bHidden == Other.bHidden
+				&& Location.Equals(Other.Location)
+				&& Rotation.Equals(Other.Rotation)
+				&& Scale.Equals(Other.Scale);
+		}
+	};
+
+	/**
+	 * Retained level snapshots keyed by token, so repeated get_level_actors
+	 * polls can return deltas instead of re-listing the level. A handful of
+	 * snapshots are kept FIFO; agents always hold the freshest token.
+	 */
+	class FLevelSnapshotStore
+	{
+	public:
+		static FLevelSnapshotStore& Get()
+		{
+			static FLevelSnapshotStore Instance;
+			return Instance;
+		}
+
+		FString Store(TMap<FName, FActorSnapshotEntry>&& Snapshot)
+		{
+			while (TokenOrder.Num() >= MaxSnapshots)
+			{
+				Snapshots.Remove(TokenOrder[0]);
+				TokenOrder.RemoveAt(0);
+			}
+
+			FString Token = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+			Snapshots.Add(Token, MoveTemp(Snapshot));
+			TokenOrder.Add(Token);
+			return Token;
+		}
+
+		const TMap<FName, FActorSnapshotEntry>* Find(const FString& Token) const
+		{
+			return Snapshots.Find(Token);
+		}
+
+	private:
+		static constexpr int32 MaxSnapshots = 8;
+
+		TMap<FString, TMap<FName, FActorSnapshotEntry>> Snapshots;
+		TArray<FString> TokenOrder;
+	};
+
+	/** Capture the current state of every level actor, keeping live pointers for serialization */
+	void CaptureLevelSnapshot(UWorld* World, TMap<FName, FActorSnapshotEntry>& OutSnapshot, TMap<FName, AActor*>& OutLiveActors)
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			AActor* Actor = *It;
+			if (!Actor)
+			{
+				continue;
+			}
+
+			FActorSnapshotEntry Entry;
+			Entry.Label = Actor->GetActorLabel();
+			Entry.ClassName = Actor->GetClass()->GetName();
+			Entry.Location = Actor->GetActorLocation();
+			Entry.Rotation = Actor->GetActorRotation();
+			Entry.Scale = Actor->GetActorScale3D();
+			Entry.bHidden = Actor->IsHidden();
+
+			OutSnapshot.Add(Actor->GetFName(), MoveTemp(Entry));
+			OutLiveActors.Add(Actor->GetFName(), Actor);
+		}
+	}
+}
 
 FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -18,6 +111,68 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 		return Error.GetValue();
 	}
 
+	// Diff mode: compare the level against a stored snapshot and return only
+	// what changed - polling after mutations costs the changes, not the level
+	FString SnapshotToken;
+	Params->TryGetStringField(TEXT("snapshot_token"), SnapshotToken);
+	if (!SnapshotToken.IsEmpty())
+	{
+		const TMap<FName, FActorSnapshotEntry>* Previous = FLevelSnapshotStore::Get().Find(SnapshotToken);
+		if (!Previous)
+		{
+			return FMCPToolResult::Error(TEXT("Unknown or expired snapshot token - request a fresh listing with snapshot=true"));
+		}
+
+		TMap<FName, FActorSnapshotEntry> Current;
+		TMap<FName, AActor*> LiveActors;
+		CaptureLevelSnapshot(World, Current, LiveActors);
+
+		TArray<TSharedPtr<FJsonValue>> AddedArray;
+		TArray<TSharedPtr<FJsonValue>> ModifiedArray;
+		TArray<TSharedPtr<FJsonValue>> RemovedArray;
+
+		for (const auto& Pair : Current)
+		{
+			const FActorSnapshotEntry* PreviousEntry = Previous->Find(Pair.Key);
+			if (PreviousEntry && PreviousEntry->Matches(Pair.Value))
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> ActorJson = BuildActorInfoWithTransformJson(LiveActors[Pair.Key]);
+			ActorJson->SetBoolField(TEXT("hidden"), Pair.Value.bHidden);
+			(PreviousEntry ? ModifiedArray : AddedArray).Add(MakeShared<FJsonValueObject>(ActorJson));
+		}
+
+		for (const auto& Pair : *Previous)
+		{
+			if (!Current.Contains(Pair.Key))
+			{
+				TSharedPtr<FJsonObject> RemovedJson = MakeShared<FJsonObject>();
+				RemovedJson->SetStringField(TEXT("name"), Pair.Key.ToString());
+				RemovedJson->SetStringField(TEXT("label"), Pair.Value.Label);
+				RemovedJson->SetStringField(TEXT("class"), Pair.Value.ClassName);
+				RemovedArray.Add(MakeShared<FJsonValueObject>(RemovedJson));
+			}
+		}
+
+		const int32 ChangeCount = AddedArray.Num() + ModifiedArray.Num() + RemovedArray.Num();
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetArrayField(TEXT("added"), AddedArray);
+		ResultData->SetArrayField(TEXT("modified"), ModifiedArray);
+		ResultData->SetArrayField(TEXT("removed"), RemovedArray);
+		ResultData->SetNumberField(TEXT("changes"), ChangeCount);
+		ResultData->SetStringField(TEXT("snapshot_token"), FLevelSnapshotStore::Get().Store(MoveTemp(Current)));
+		ResultData->SetStringField(TEXT("levelName"), World->GetMapName());
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("%d actor(s) changed since snapshot (%d added, %d modified, %d removed)"),
+				ChangeCount, AddedArray.Num(), ModifiedArray.Num(), RemovedArray.Num()),
+			ResultData
+		);
+	}
+
 	// Parse parameters
 	FString ClassFilter;
 	Params->TryGetStringField(TEXT("class_filter"), ClassFilter);
@@ -48,34 +203,111 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 	Params->TryGetNumberField(TEXT("offset"), Offset);
 	if (Offset < 0) Offset = 0;
 
-	// Collect actors
-	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	// Spatial query: resolve candidates through the grid index so the cost
+	// scales with the queried region instead of the whole level
+	const bool bHasNear = Params->HasField(TEXT("near"));
+	const bool bHasRadius = Params->HasField(TEXT("radius"));
+	const bool bHasBoxMin = Params->HasField(TEXT("box_min"));
+	const bool bHasBoxMax = Params->HasField(TEXT("box_max"));
+
+	bool bSpatialQuery = false;
+	bool bRadiusQuery = false;
+	FVector QueryCenter = FVector::ZeroVector;
+	TArray<AActor*> SpatialCandidates;
+
+	if (bHasNear || bHasRadius)
+	{
+		if (!bHasNear || !bHasRadius)
+		{
+			return FMCPToolResult::Error(TEXT("'near' and 'radius' must be provided together"));
+		}
+
+		const double Radius = Params->GetNumberField(TEXT("radius"));
+		if (Radius <= 0.0)
+		{
+			return FMCPToolResult::Error(TEXT("'radius' must be a positive number"));
+		}
+
+		QueryCenter = ExtractVectorParam(Params, TEXT("near"));
+		FMCPActorSpatialIndex::Get().QueryRadius(World, QueryCenter, Radius, SpatialCandidates);
+		bSpatialQuery = true;
+		bRadiusQuery = true;
+	}
+	else if (bHasBoxMin || bHasBoxMax)
+	{
+		if (!bHasBoxMin || !bHasBoxMax)
+		{
+			return FMCPToolResult::Error(TEXT("'box_min' and 'box_max' must be provided together"));
+		}
+
+		const FVector BoxMin = ExtractVectorParam(Params, TEXT("box_min"));
+		const FVector BoxMax = ExtractVectorParam(Params, TEXT("box_max"));
+		if (BoxMin.X > BoxMax.X || BoxMin.Y > BoxMax.Y || BoxMin.Z > BoxMax.Z)
+		{
+			return FMCPToolResult::Error(TEXT("'box_min' must not exceed 'box_max' on any axis"));
+		}
+
+		FMCPActorSpatialIndex::Get().QueryBox(World, FBox(BoxMin, BoxMax), SpatialCandidates);
+		bSpatialQuery = true;
+	}
+
+	// Stream rows straight into the UTF-8 response body. Building one
+	// FJsonObject tree per actor (name/label/class plus three transform
+	// objects) meant 200k+ node allocations on a 50k-actor dump; a single
+	// condensed writer over a memory archive serializes each row in place
+	// and the finished envelope ships as the prebuilt body, so the HTTP
+	// layer never rebuilds or transcodes it.
+	TArray<uint8> Body;
+	Body.Reserve(64 * 1024);
+	FMemoryWriter Archive(Body);
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+		TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("success"), true);
+	Writer->WriteObjectStart(TEXT("data"));
+	if (bSpatialQuery)
+	{
+		Writer->WriteValue(TEXT("query"), bRadiusQuery ? TEXT("radius") : TEXT("box"));
+	}
+	Writer->WriteArrayStart(TEXT("actors"));
+
+	// Levels repeat a handful of classes across thousands of actors; intern
+	// the converted name once per class per response instead of paying a
+	// GetName allocation per row (the filter match reuses it too)
+	TMap<const UClass*, FString> ClassNames;
+	auto InternedClassName = [&ClassNames](const UClass* Class) -> const FString&
+	{
+		FString* Found = ClassNames.Find(Class);
+		if (!Found)
+		{
+			Found = &ClassNames.Add(Class, Class->GetName());
+		}
+		return *Found;
+	};
+
 	int32 MatchIndex = 0;  // Index among matching actors
 	int32 AddedCount = 0;  // Count of actors added to result
 	int32 TotalMatching = 0;
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+	auto ProcessActor = [&](AActor* Actor)
 	{
-		AActor* Actor = *It;
 		if (!Actor)
 		{
-			continue;
+			return;
 		}
 
 		// Skip hidden actors if not requested
 		if (!bIncludeHidden && Actor->IsHidden())
 		{
-			continue;
+			return;
 		}
 
 		// Apply class filter
-		if (!ClassFilter.IsEmpty())
+		const FString& ActorClassName = InternedClassName(Actor->GetClass());
+		if (!ClassFilter.IsEmpty() && !ActorClassName.Contains(ClassFilter, ESearchCase::IgnoreCase))
 		{
-			FString ActorClassName = Actor->GetClass()->GetName();
-			if (!ActorClassName.Contains(ClassFilter, ESearchCase::IgnoreCase))
-			{
-				continue;
-			}
+			return;
 		}
 
 		// Apply name filter
@@ -86,7 +318,7 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 			if (!ActorName.Contains(NameFilter, ESearchCase::IgnoreCase) &&
 				!ActorLabel.Contains(NameFilter, ESearchCase::IgnoreCase))
 			{
-				continue;
+				return;
 			}
 		}
 
@@ -96,55 +328,121 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 		if (MatchIndex < Offset)
 		{
 			MatchIndex++;
-			continue;
+			return;
 		}
 
 		// Apply limit - stop adding after limit reached
 		if (AddedCount >= Limit)
 		{
 			MatchIndex++;
-			continue; // Keep counting total but don't add more
+			return; // Keep counting total but don't add more
 		}
 
-		// Build actor info using base class helper
-		TSharedPtr<FJsonObject> ActorJson = BuildActorInfoWithTransformJson(Actor);
-		ActorJson->SetBoolField(TEXT("hidden"), Actor->IsHidden());
+		// One row, written in place (same shape the JSON-tree path produced)
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Actor->GetName());
+		Writer->WriteValue(TEXT("label"), Actor->GetActorLabel());
+		Writer->WriteValue(TEXT("class"), ActorClassName);
+
+		const FVector Location = Actor->GetActorLocation();
+		Writer->WriteObjectStart(TEXT("location"));
+		Writer->WriteValue(TEXT("x"), Location.X);
+		Writer->WriteValue(TEXT("y"), Location.Y);
+		Writer->WriteValue(TEXT("z"), Location.Z);
+		Writer->WriteObjectEnd();
+
+		const FRotator Rotation = Actor->GetActorRotation();
+		Writer->WriteObjectStart(TEXT("rotation"));
+		Writer->WriteValue(TEXT("pitch"), Rotation.Pitch);
+		Writer->WriteValue(TEXT("yaw"), Rotation.Yaw);
+		Writer->WriteValue(TEXT("roll"), Rotation.Roll);
+		Writer->WriteObjectEnd();
+
+		const FVector Scale = Actor->GetActorScale3D();
+		Writer->WriteObjectStart(TEXT("scale"));
+		Writer->WriteValue(TEXT("x"), Scale.X);
+		Writer->WriteValue(TEXT("y"), Scale.Y);
+		Writer->WriteValue(TEXT("z"), Scale.Z);
+		Writer->WriteObjectEnd();
+
+		Writer->WriteValue(TEXT("hidden"), Actor->IsHidden());
+
+		// Radius results arrive nearest-first; surface the distance
+		if (bRadiusQuery)
+		{
+			Writer->WriteValue(TEXT("distance"), FVector::Dist(Location, QueryCenter));
+		}
 
 		// Add tags if any
 		if (Actor->Tags.Num() > 0)
 		{
-			TArray<FString> TagStrings;
+			Writer->WriteArrayStart(TEXT("tags"));
 			for (const FName& Tag : Actor->Tags)
 			{
-				TagStrings.Add(Tag.ToString());
+				Writer->WriteValue(Tag.ToString());
 			}
-			ActorJson->SetArrayField(TEXT("tags"), StringArrayToJsonArray(TagStrings));
+			Writer->WriteArrayEnd();
 		}
 
-		ActorsArray.Add(MakeShared<FJsonValueObject>(ActorJson));
+		Writer->WriteObjectEnd();
 		AddedCount++;
 		MatchIndex++;
+	};
+
+	if (bSpatialQuery)
+	{
+		for (AActor* Actor : SpatialCandidates)
+		{
+			ProcessActor(Actor);
+		}
 	}
+	else
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			ProcessActor(*It);
+		}
+	}
+
+	Writer->WriteArrayEnd();
 
-	// Build result with pagination metadata
-	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
-	ResultData->SetArrayField(TEXT("actors"), ActorsArray);
-	ResultData->SetNumberField(TEXT("count"), AddedCount);
-	ResultData->SetNumberField(TEXT("total"), TotalMatching);
-	ResultData->SetNumberField(TEXT("offset"), Offset);
-	ResultData->SetNumberField(TEXT("limit"), Limit);
-	ResultData->SetBoolField(TEXT("hasMore"), (Offset + AddedCount) < TotalMatching);
+	// Pagination metadata, known now that the pass is complete
+	Writer->WriteValue(TEXT("count"), AddedCount);
+	Writer->WriteValue(TEXT("total"), TotalMatching);
+	Writer->WriteValue(TEXT("offset"), Offset);
+	Writer->WriteValue(TEXT("limit"), Limit);
+	Writer->WriteValue(TEXT("hasMore"), (Offset + AddedCount) < TotalMatching);
 	if ((Offset + AddedCount) < TotalMatching)
 	{
-		ResultData->SetNumberField(TEXT("nextOffset"), Offset + AddedCount);
+		Writer->WriteValue(TEXT("nextOffset"), Offset + AddedCount);
+	}
+	Writer->WriteValue(TEXT("levelName"), World->GetMapName());
+
+	// Capture a baseline for later diff calls when requested
+	bool bSnapshot = false;
+	Params->TryGetBoolField(TEXT("snapshot"), bSnapshot);
+	if (bSnapshot)
+	{
+		TMap<FName, FActorSnapshotEntry> Snapshot;
+		TMap<FName, AActor*> LiveActors;
+		CaptureLevelSnapshot(World, Snapshot, LiveActors);
+		Writer->WriteValue(TEXT("snapshot_token"), FLevelSnapshotStore::Get().Store(MoveTemp(Snapshot)));
 	}
-	ResultData->SetStringField(TEXT("levelName"), World->GetMapName());
+
+	Writer->WriteObjectEnd(); // data
 
 	FString Message = FString::Printf(TEXT("Found %d actors"), AddedCount);
 	if (TotalMatching > AddedCount)
 	{
 		Message += FString::Printf(TEXT(" (showing %d-%d of %d total)"), Offset + 1, Offset + AddedCount, TotalMatching);
 	}
+	Writer->WriteValue(TEXT("message"), Message);
+	Writer->WriteObjectEnd();
+	Writer->Close();
 
-	return FMCPToolResult::Success(Message, ResultData);
+	FMCPToolResult Result;
+	Result.bSuccess = true;
+	Result.Message = MoveTemp(Message); // For non-HTTP consumers (logs, batch route)
+	Result.PrebuiltBody = MakeShared<TArray<uint8>>(MoveTemp(Body));
+	return Result;
 }
@@ -23,6 +23,16 @@ public:
 			"- class_filter='PointLight' - Find all point lights\n"
 			"- class_filter='StaticMeshActor' - Find all static meshes\n"
 			"- name_filter='Player' - Find actors with 'Player' in name\n\n"
+			"Spatial queries: pass 'near' {x, y, z} with 'radius' to get the actors "
+			"around a point (nearest first, with a 'distance' field), or 'box_min' and "
+			"'box_max' for an axis-aligned region. Spatial queries are served from an "
+			"incrementally maintained grid index, so they stay fast on huge levels - "
+			"prefer them over full iteration on open-world maps.\n\n"
+			"Change detection: pass snapshot=true to receive a 'snapshot_token' with "
+			"the listing; later calls with 'snapshot_token' return only the actors "
+			"added, removed, or modified since that snapshot (plus a fresh token), so "
+			"polling after mutations costs the changes, not the level. Filters and "
+			"pagination do not apply to diff results.\n\n"
 			"Returns: Array of actors with name, label, class, location, rotation, scale. "
 			"Use offset/limit for pagination on large levels."
 		);
@@ -31,7 +41,13 @@ public:
 			FMCPToolParameter(TEXT("name_filter"), TEXT("string"), TEXT("Optional substring to filter actors by name"), false),
 			FMCPToolParameter(TEXT("include_hidden"), TEXT("boolean"), TEXT("Include hidden actors in results"), false, TEXT("false")),
 			FMCPToolParameter(TEXT("limit"), TEXT("number"), TEXT("Maximum number of actors to return (default: 100)"), false, TEXT("100")),
-			FMCPToolParameter(TEXT("offset"), TEXT("number"), TEXT("Number of actors to skip for pagination"), false, TEXT("0"))
+			FMCPToolParameter(TEXT("offset"), TEXT("number"), TEXT("Number of actors to skip for pagination"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("near"), TEXT("object"), TEXT("Center point {x, y, z} for a radius query; requires 'radius'"), false),
+			FMCPToolParameter(TEXT("radius"), TEXT("number"), TEXT("Radius in world units around 'near'; results come back nearest first"), false),
+			FMCPToolParameter(TEXT("box_min"), TEXT("object"), TEXT("Minimum corner {x, y, z} of an axis-aligned query box; requires 'box_max'"), false),
+			FMCPToolParameter(TEXT("box_max"), TEXT("object"), TEXT("Maximum corner {x, y, z} of an axis-aligned query box; requires 'box_min'"), false),
+			FMCPToolParameter(TEXT("snapshot"), TEXT("boolean"), TEXT("Include a snapshot_token with the listing for later diff calls"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("snapshot_token"), TEXT("string"), TEXT("Token from a previous snapshot; returns only added/removed/modified actors since then"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
@@ -3,10 +3,47 @@
 #include "MCPTool_GetOutputLog.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeConstants.h"
+#include "MCP/MCPLogRingBuffer.h"
+#include "Internationalization/Regex.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
 
+namespace
+{
+	bool ParseVerbosityName(const FString& Name, ELogVerbosity::Type& OutVerbosity)
+	{
+		static const TPair<const TCHAR*, ELogVerbosity::Type> Names[] = {
+			{ TEXT("Fatal"), ELogVerbosity::Fatal },
+			{ TEXT("Error"), ELogVerbosity::Error },
+			{ TEXT("Warning"), ELogVerbosity::Warning },
+			{ TEXT("Display"), ELogVerbosity::Display },
+			{ TEXT("Log"), ELogVerbosity::Log },
+			{ TEXT("Verbose"), ELogVerbosity::Verbose },
+			{ TEXT("VeryVerbose"), ELogVerbosity::VeryVerbose },
+		};
+		for (const auto& Pair : Names)
+		{
+			if (Name.Equals(Pair.Key, ESearchCase::IgnoreCase))
+			{
+				OutVerbosity = Pair.Value;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool MatchesMessageRegex(const TOptional<FRegexPattern>& Pattern, const FString& Line)
+	{
+		if (!Pattern.IsSet())
+		{
+			return true;
+		}
+		FRegexMatcher Matcher(Pattern.GetValue(), Line);
+		return Matcher.FindNext();
+	}
+}
+
 FMCPToolResult FMCPTool_GetOutputLog::Execute(const TSharedRef<FJsonObject>& Params)
 {
 	// Get parameters using centralized constants
@@ -19,6 +56,93 @@ FMCPToolResult FMCPTool_GetOutputLog::Execute(const TSharedRef<FJsonObject>& Par
 	FString Filter;
 	Params->TryGetStringField(TEXT("filter"), Filter);
 
+	// Structured filters, compiled once per request. Category and verbosity
+	// push down into the ring scan on cursor polls; the message regex runs
+	// over whatever survives, so a typical "any errors since cursor X?"
+	// poll ships a few matching lines instead of the whole burst.
+	const FString CategoriesParam = ExtractOptionalString(Params, TEXT("categories"));
+	const FString MinVerbosityParam = ExtractOptionalString(Params, TEXT("min_verbosity"));
+	const FString MessagePattern = ExtractOptionalString(Params, TEXT("message_pattern"));
+
+	FMCPLogRingBuffer::FLogFilter StructuredFilter;
+	if (!CategoriesParam.IsEmpty())
+	{
+		TArray<FString> CategoryNames;
+		CategoriesParam.ParseIntoArray(CategoryNames, TEXT(","));
+		for (FString& CategoryName : CategoryNames)
+		{
+			StructuredFilter.Categories.Add(FName(*CategoryName.TrimStartAndEnd()));
+		}
+	}
+	if (!MinVerbosityParam.IsEmpty() &&
+		!ParseVerbosityName(MinVerbosityParam, StructuredFilter.MinVerbosity))
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Unknown min_verbosity '%s'. Valid: Fatal, Error, Warning, Display, Log, Verbose, VeryVerbose"),
+			*MinVerbosityParam));
+	}
+
+	TOptional<FRegexPattern> MessageRegex;
+	if (!MessagePattern.IsEmpty())
+	{
+		MessageRegex.Emplace(MessagePattern);
+	}
+
+	// Cursor polling: serve only the lines appended since the caller's
+	// cursor from the in-memory ring buffer - cost scales with new output,
+	// not total log size
+	if (Params->HasField(TEXT("cursor")))
+	{
+		const uint64 Cursor = static_cast<uint64>(Params->GetNumberField(TEXT("cursor")));
+
+		TArray<FMCPLogRingBuffer::FLogLine> NewLines;
+		const uint64 NextCursor = FMCPLogRingBuffer::Get().GetLinesSince(Cursor, StructuredFilter, NewLines);
+
+		TArray<FString> ResultLines;
+		ResultLines.Reserve(NewLines.Num());
+		for (FMCPLogRingBuffer::FLogLine& Entry : NewLines)
+		{
+			if ((Filter.IsEmpty() || Entry.Line.Contains(Filter, ESearchCase::IgnoreCase)) &&
+				MatchesMessageRegex(MessageRegex, Entry.Line))
+			{
+				ResultLines.Add(MoveTemp(Entry.Line));
+			}
+		}
+
+		// Keep only the last N when a burst exceeded the requested line count
+		if (ResultLines.Num() > NumLines)
+		{
+			ResultLines.RemoveAt(0, ResultLines.Num() - NumLines);
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("source"), TEXT("ring_buffer"));
+		ResultData->SetNumberField(TEXT("next_cursor"), static_cast<double>(NextCursor));
+		ResultData->SetNumberField(TEXT("returned_lines"), ResultLines.Num());
+		if (!Filter.IsEmpty())
+		{
+			ResultData->SetStringField(TEXT("filter"), Filter);
+		}
+		if (!CategoriesParam.IsEmpty())
+		{
+			ResultData->SetStringField(TEXT("categories"), CategoriesParam);
+		}
+		if (!MinVerbosityParam.IsEmpty())
+		{
+			ResultData->SetStringField(TEXT("min_verbosity"), MinVerbosityParam);
+		}
+		if (!MessagePattern.IsEmpty())
+		{
+			ResultData->SetStringField(TEXT("message_pattern"), MessagePattern);
+		}
+		ResultData->SetStringField(TEXT("content"), FString::Join(ResultLines, TEXT("\n")));
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Retrieved %d new log lines"), ResultLines.Num()),
+			ResultData
+		);
+	}
+
 	// Get the current log file path
 	FString LogFilePath = FPaths::ProjectLogDir() / FApp::GetProjectName() + TEXT(".log");
 
@@ -71,20 +195,77 @@ FMCPToolResult FMCPTool_GetOutputLog::Execute(const TSharedRef<FJsonObject>& Par
 	TArray<FString> AllLines;
 	LogContent.ParseIntoArrayLines(AllLines);
 
-	// Filter lines if a filter is specified
+	// File lines are unstructured, so category and verbosity fall back to
+	// token matching on the formatted line - the same heuristic clients ran
+	// on their side, now applied before the content ships. Exact structured
+	// filtering is available on cursor polls, which read the ring buffer.
+	TArray<FString> CategoryTokens;
+	for (const FName& Category : StructuredFilter.Categories)
+	{
+		CategoryTokens.Add(Category.ToString() + TEXT(":"));
+	}
+
+	TArray<FString> VerbosityTokens;
+	if (!MinVerbosityParam.IsEmpty() && StructuredFilter.MinVerbosity <= ELogVerbosity::Display)
+	{
+		// Lines at Log verbosity carry no token, so a severity floor can
+		// only be enforced on the file path down to Display
+		static const TPair<ELogVerbosity::Type, const TCHAR*> Tokens[] = {
+			{ ELogVerbosity::Fatal, TEXT("Fatal:") },
+			{ ELogVerbosity::Error, TEXT("Error:") },
+			{ ELogVerbosity::Warning, TEXT("Warning:") },
+			{ ELogVerbosity::Display, TEXT("Display:") },
+		};
+		for (const auto& Pair : Tokens)
+		{
+			if (Pair.Key <= StructuredFilter.MinVerbosity)
+			{
+				VerbosityTokens.Add(Pair.Value);
+			}
+		}
+	}
+
+	const bool bAnyFilter = !Filter.IsEmpty() || CategoryTokens.Num() > 0 ||
+		VerbosityTokens.Num() > 0 || MessageRegex.IsSet();
+
 	TArray<FString> FilteredLines;
-	if (Filter.IsEmpty())
+	if (!bAnyFilter)
 	{
 		FilteredLines = AllLines;
 	}
 	else
 	{
+		const auto ContainsAnyToken = [](const FString& Line, const TArray<FString>& Tokens)
+		{
+			for (const FString& Token : Tokens)
+			{
+				if (Line.Contains(Token))
+				{
+					return true;
+				}
+			}
+			return false;
+		};
+
 		for (const FString& Line : AllLines)
 		{
-			if (Line.Contains(Filter, ESearchCase::IgnoreCase))
+			if (!Filter.IsEmpty() && !Line.Contains(Filter, ESearchCase::IgnoreCase))
 			{
-				FilteredLines.Add(Line);
+				continue;
 			}
+			if (CategoryTokens.Num() > 0 && !ContainsAnyToken(Line, CategoryTokens))
+			{
+				continue;
+			}
+			if (VerbosityTokens.Num() > 0 && !ContainsAnyToken(Line, VerbosityTokens))
+			{
+				continue;
+			}
+			if (!MatchesMessageRegex(MessageRegex, Line))
+			{
+				continue;
+			}
+			FilteredLines.Add(Line);
 		}
 	}
 
@@ -106,8 +287,23 @@ FMCPToolResult FMCPTool_GetOutputLog::Execute(const TSharedRef<FJsonObject>& Par
 	if (!Filter.IsEmpty())
 	{
 		ResultData->SetStringField(TEXT("filter"), Filter);
+	}
+	if (bAnyFilter)
+	{
 		ResultData->SetNumberField(TEXT("filtered_lines"), FilteredLines.Num());
 	}
+	if (!CategoriesParam.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("categories"), CategoriesParam);
+	}
+	if (!MinVerbosityParam.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("min_verbosity"), MinVerbosityParam);
+	}
+	if (!MessagePattern.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("message_pattern"), MessagePattern);
+	}
 	ResultData->SetStringField(TEXT("content"), LogOutput);
 
 	return FMCPToolResult::Success(
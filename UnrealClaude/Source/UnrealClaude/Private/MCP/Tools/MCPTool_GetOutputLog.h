@@ -25,15 +25,30 @@ public:
 			"- 'LogBlueprint' - Blueprint-related messages\n"
 			"- 'LogScript' - Script compilation messages\n"
 			"- 'LogActor' - Actor lifecycle messages\n\n"
+			"Polling: pass 'cursor' (0 on the first call) to receive only lines logged "
+			"since the previous poll, plus 'next_cursor' to pass next time. Cursor polls "
+			"are served from an in-memory ring buffer and cost only the new output.\n\n"
+			"Server-side filtering: combine 'categories', 'min_verbosity', and "
+			"'message_pattern' to get exactly the lines you care about instead of "
+			"filtering client-side - a typical \"any errors since cursor X?\" poll with "
+			"min_verbosity='Error' returns a few lines, not the whole burst. On cursor "
+			"polls category/verbosity match the structured log data exactly; without a "
+			"cursor they fall back to token matching on the formatted file lines.\n\n"
 			"Returns: Array of log entries with timestamp, category, verbosity, and message."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("lines"), TEXT("number"), TEXT("Number of recent lines to return (default: 100, max: 1000)"), false, TEXT("100")),
-			FMCPToolParameter(TEXT("filter"), TEXT("string"), TEXT("Optional category or text filter (e.g., 'Warning', 'Error', 'LogTemp')"), false)
+			FMCPToolParameter(TEXT("filter"), TEXT("string"), TEXT("Optional category or text filter (e.g., 'Warning', 'Error', 'LogTemp')"), false),
+			FMCPToolParameter(TEXT("cursor"), TEXT("number"), TEXT("Sequence cursor from the previous poll's next_cursor; only newer lines are returned (0 = everything retained)"), false),
+			FMCPToolParameter(TEXT("categories"), TEXT("string"), TEXT("Comma-separated log categories to keep (e.g., 'LogBlueprint,LogScript')"), false),
+			FMCPToolParameter(TEXT("min_verbosity"), TEXT("string"), TEXT("Least severe verbosity to keep: Fatal, Error, Warning, Display, Log, Verbose, VeryVerbose (e.g., 'Warning' keeps Fatal/Error/Warning)"), false),
+			FMCPToolParameter(TEXT("message_pattern"), TEXT("string"), TEXT("Regular expression applied to each line; only matching lines are returned"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
+	/** Reads only the lock-protected log ring buffer */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
 };
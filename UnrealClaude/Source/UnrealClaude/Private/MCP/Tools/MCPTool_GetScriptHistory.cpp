@@ -36,6 +36,7 @@ FMCPToolResult FMCPTool_GetScriptHistory::Execute(const TSharedRef<FJsonObject>&
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetArrayField(TEXT("scripts"), ScriptsArray);
 	ResultData->SetNumberField(TEXT("count"), RecentScripts.Num());
+	ResultData->SetNumberField(TEXT("total"), FScriptExecutionManager::Get().GetTotalHistoryCount());
 
 	// Also include formatted context string
 	FString FormattedContext = FScriptExecutionManager::Get().FormatHistoryForContext(Count);
@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_Material.h"
+#include "MCP/MCPFactoryPool.h"
 #include "MCP/MCPParamValidator.h"
 #include "UnrealClaudeModule.h"
 #include "Editor.h"
@@ -29,7 +30,7 @@ FMCPToolInfo FMCPTool_Material::GetInfo() const
 
 	// Parameters
 	Info.Parameters.Add(FMCPToolParameter(TEXT("operation"), TEXT("string"),
-		TEXT("Operation: create_material_instance, set_material_parameters, set_skeletal_mesh_material, get_material_info"), true));
+		TEXT("Operation: create_material_instance, set_material_parameters, set_skeletal_mesh_material, batch_edit, get_material_info"), true));
 
 	// create_material_instance params
 	Info.Parameters.Add(FMCPToolParameter(TEXT("asset_name"), TEXT("string"),
@@ -53,6 +54,15 @@ FMCPToolInfo FMCPTool_Material::GetInfo() const
 	Info.Parameters.Add(FMCPToolParameter(TEXT("material_path"), TEXT("string"),
 		TEXT("Asset path to material to assign (for set_skeletal_mesh_material)")));
 
+	// batch_edit params
+	Info.Parameters.Add(FMCPToolParameter(TEXT("edits"), TEXT("array"),
+		TEXT("For batch_edit: array of edit objects, each {operation: 'set_parameters'|'set_mesh_material', ...} "
+			"with the same fields as the standalone operation. All edits apply before any recompile, "
+			"so each touched asset recompiles at most once")));
+	Info.Parameters.Add(FMCPToolParameter(TEXT("defer_compile"), TEXT("boolean"),
+		TEXT("Skip PostEditChange (shader recompile) after parameter edits; changes accumulate and "
+			"compile on the next non-deferred edit (default: false)"), false, TEXT("false")));
+
 	// get_material_info params
 	Info.Parameters.Add(FMCPToolParameter(TEXT("asset_path"), TEXT("string"),
 		TEXT("Asset path to material (for get_material_info)")));
@@ -85,13 +95,17 @@ FMCPToolResult FMCPTool_Material::Execute(const TSharedRef<FJsonObject>& Params)
 	{
 		return ExecuteSetSkeletalMeshMaterial(Params);
 	}
+	else if (Operation == TEXT("batch_edit"))
+	{
+		return ExecuteBatchEdit(Params);
+	}
 	else if (Operation == TEXT("get_material_info"))
 	{
 		return ExecuteGetMaterialInfo(Params);
 	}
 
 	return FMCPToolResult::Error(FString::Printf(
-		TEXT("Unknown operation: %s. Valid: create_material_instance, set_material_parameters, set_skeletal_mesh_material, get_material_info"),
+		TEXT("Unknown operation: %s. Valid: create_material_instance, set_material_parameters, set_skeletal_mesh_material, batch_edit, get_material_info"),
 		*Operation));
 }
 
@@ -148,8 +162,9 @@ FMCPToolResult FMCPTool_Material::ExecuteCreateMaterialInstance(const TSharedRef
 		return FMCPToolResult::Error(FString::Printf(TEXT("Failed to create package: %s"), *FullPackagePath));
 	}
 
-	// Create material instance using factory
-	UMaterialInstanceConstantFactoryNew* Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
+	// Create material instance using the warm factory; InitialParent is set
+	// fresh each call since the pooled instance keeps its last configuration
+	UMaterialInstanceConstantFactoryNew* Factory = FMCPFactoryPool::Get().GetFactory<UMaterialInstanceConstantFactoryNew>();
 	Factory->InitialParent = ParentMaterial;
 
 	UMaterialInstanceConstant* MatInst = Cast<UMaterialInstanceConstant>(
@@ -246,14 +261,21 @@ FMCPToolResult FMCPTool_Material::ExecuteSetMaterialParameters(const TSharedRef<
 		return FMCPToolResult::Error(ParamError);
 	}
 
-	// Mark dirty and post edit
-	MatInst->PostEditChange();
+	// Mark dirty; PostEditChange triggers the shader recompile, which callers
+	// stacking several edits can defer to the last one
+	bool bDeferCompile = false;
+	Params->TryGetBoolField(TEXT("defer_compile"), bDeferCompile);
+	if (!bDeferCompile)
+	{
+		MatInst->PostEditChange();
+	}
 	MatInst->MarkPackageDirty();
 
 	// Build result
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetStringField(TEXT("material_instance"), MaterialInstancePath);
 	ResultData->SetBoolField(TEXT("modified"), true);
+	ResultData->SetBoolField(TEXT("compile_deferred"), bDeferCompile);
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Updated parameters on material instance: %s"), *MaterialInstancePath),
@@ -343,6 +365,191 @@ FMCPToolResult FMCPTool_Material::ExecuteSetSkeletalMeshMaterial(const TSharedRe
 	);
 }
 
+FMCPToolResult FMCPTool_Material::ExecuteBatchEdit(const TSharedRef<FJsonObject>& Params)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Edits = nullptr;
+	if (!Params->TryGetArrayField(TEXT("edits"), Edits) || Edits->Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("batch_edit requires a non-empty 'edits' array"));
+	}
+
+	bool bDeferCompile = false;
+	Params->TryGetBoolField(TEXT("defer_compile"), bDeferCompile);
+
+	// Each touched asset is resolved once and recompiled at most once at the
+	// end, no matter how many edits target it
+	TMap<FString, UMaterialInstanceConstant*> TouchedInstances;
+	TMap<FString, USkeletalMesh*> TouchedMeshes;
+	TArray<TSharedPtr<FJsonValue>> EditErrors;
+	int32 AppliedCount = 0;
+
+	for (int32 EditIndex = 0; EditIndex < Edits->Num(); ++EditIndex)
+	{
+		const TSharedPtr<FJsonObject>* EditObject = nullptr;
+		if (!(*Edits)[EditIndex].IsValid() || !(*Edits)[EditIndex]->TryGetObject(EditObject))
+		{
+			EditErrors.Add(MakeShared<FJsonValueString>(
+				FString::Printf(TEXT("edit %d: not an object"), EditIndex)));
+			continue;
+		}
+
+		FString EditOperation;
+		(*EditObject)->TryGetStringField(TEXT("operation"), EditOperation);
+		EditOperation = EditOperation.ToLower();
+
+		if (EditOperation == TEXT("set_parameters"))
+		{
+			FString MaterialInstancePath;
+			if (!(*EditObject)->TryGetStringField(TEXT("material_instance_path"), MaterialInstancePath))
+			{
+				EditErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("edit %d: missing material_instance_path"), EditIndex)));
+				continue;
+			}
+
+			UMaterialInstanceConstant* MatInst = nullptr;
+			if (UMaterialInstanceConstant** Found = TouchedInstances.Find(MaterialInstancePath))
+			{
+				MatInst = *Found;
+			}
+			else
+			{
+				MatInst = LoadObject<UMaterialInstanceConstant>(nullptr, *MaterialInstancePath);
+				if (!MatInst)
+				{
+					EditErrors.Add(MakeShared<FJsonValueString>(
+						FString::Printf(TEXT("edit %d: failed to load material instance: %s"), EditIndex, *MaterialInstancePath)));
+					continue;
+				}
+				TouchedInstances.Add(MaterialInstancePath, MatInst);
+			}
+
+			const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+			if (!(*EditObject)->TryGetObjectField(TEXT("parameters"), ParamsObj))
+			{
+				EditErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("edit %d: missing parameters"), EditIndex)));
+				continue;
+			}
+
+			FString ParamError;
+			if (!ApplyParametersFromJson(MatInst, *ParamsObj, ParamError))
+			{
+				EditErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("edit %d: %s"), EditIndex, *ParamError)));
+				continue;
+			}
+
+			AppliedCount++;
+		}
+		else if (EditOperation == TEXT("set_mesh_material"))
+		{
+			FString SkeletalMeshPath, MaterialPath;
+			if (!(*EditObject)->TryGetStringField(TEXT("skeletal_mesh_path"), SkeletalMeshPath) ||
+				!(*EditObject)->TryGetStringField(TEXT("material_path"), MaterialPath))
+			{
+				EditErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("edit %d: missing skeletal_mesh_path or material_path"), EditIndex)));
+				continue;
+			}
+
+			USkeletalMesh* SkeletalMesh = nullptr;
+			if (USkeletalMesh** Found = TouchedMeshes.Find(SkeletalMeshPath))
+			{
+				SkeletalMesh = *Found;
+			}
+			else
+			{
+				SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, *SkeletalMeshPath);
+				if (!SkeletalMesh)
+				{
+					EditErrors.Add(MakeShared<FJsonValueString>(
+						FString::Printf(TEXT("edit %d: failed to load skeletal mesh: %s"), EditIndex, *SkeletalMeshPath)));
+					continue;
+				}
+				TouchedMeshes.Add(SkeletalMeshPath, SkeletalMesh);
+			}
+
+			UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+			if (!Material)
+			{
+				EditErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("edit %d: failed to load material: %s"), EditIndex, *MaterialPath)));
+				continue;
+			}
+
+			int32 MaterialSlot = 0;
+			(*EditObject)->TryGetNumberField(TEXT("material_slot"), MaterialSlot);
+
+			TArray<FSkeletalMaterial>& Materials = SkeletalMesh->GetMaterials();
+			if (MaterialSlot < 0 || MaterialSlot >= Materials.Num())
+			{
+				EditErrors.Add(MakeShared<FJsonValueString>(
+					FString::Printf(TEXT("edit %d: material slot %d out of range (mesh has %d slots)"),
+						EditIndex, MaterialSlot, Materials.Num())));
+				continue;
+			}
+
+			Materials[MaterialSlot].MaterialInterface = Material;
+			AppliedCount++;
+		}
+		else
+		{
+			EditErrors.Add(MakeShared<FJsonValueString>(
+				FString::Printf(TEXT("edit %d: unknown operation '%s'. Valid: set_parameters, set_mesh_material"),
+					EditIndex, *EditOperation)));
+		}
+	}
+
+	// One PostEditChange per touched asset; deferred entirely when requested
+	int32 RecompileCount = 0;
+	for (const auto& Pair : TouchedInstances)
+	{
+		if (!bDeferCompile)
+		{
+			Pair.Value->PostEditChange();
+			RecompileCount++;
+		}
+		Pair.Value->MarkPackageDirty();
+	}
+	for (const auto& Pair : TouchedMeshes)
+	{
+		if (!bDeferCompile)
+		{
+			Pair.Value->PostEditChange();
+		}
+		Pair.Value->MarkPackageDirty();
+	}
+
+	if (AppliedCount == 0)
+	{
+		FString FirstError = EditErrors.Num() > 0 ? EditErrors[0]->AsString() : TEXT("empty edits");
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("batch_edit applied nothing (%d errors, first: %s)"), EditErrors.Num(), *FirstError));
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Batch material edit: %d edits applied, %d instances, %d meshes, %d recompiles, %d errors"),
+		AppliedCount, TouchedInstances.Num(), TouchedMeshes.Num(), RecompileCount, EditErrors.Num());
+
+	// Build result
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("applied"), AppliedCount);
+	ResultData->SetNumberField(TEXT("instances_touched"), TouchedInstances.Num());
+	ResultData->SetNumberField(TEXT("meshes_touched"), TouchedMeshes.Num());
+	ResultData->SetBoolField(TEXT("compile_deferred"), bDeferCompile);
+	if (EditErrors.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("edit_errors"), EditErrors);
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Applied %d/%d material edits across %d assets%s"),
+			AppliedCount, Edits->Num(), TouchedInstances.Num() + TouchedMeshes.Num(),
+			bDeferCompile ? TEXT(" (compile deferred)") : TEXT("")),
+		ResultData
+	);
+}
+
 FMCPToolResult FMCPTool_Material::ExecuteGetMaterialInfo(const TSharedRef<FJsonObject>& Params)
 {
 	FString AssetPath;
@@ -19,7 +19,12 @@
  * - create_material_instance: Create a new UMaterialInstanceConstant asset
  * - set_material_parameters: Set parameters on an existing material instance
  * - set_skeletal_mesh_material: Set a material slot on a USkeletalMesh asset
+ * - batch_edit: Apply an array of parameter/assignment edits in one call with
+ *   at most one PostEditChange (shader recompile) per touched asset
  * - get_material_info: Get information about a material or material instance
+ *
+ * Parameter edits accept a defer_compile flag that skips PostEditChange, so a
+ * tuning series can stack edits and pay for a single recompile at the end.
  */
 class FMCPTool_Material : public FMCPToolBase
 {
@@ -32,6 +37,7 @@ private:
 	FMCPToolResult ExecuteCreateMaterialInstance(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteSetMaterialParameters(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteSetSkeletalMeshMaterial(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteBatchEdit(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteGetMaterialInfo(const TSharedRef<FJsonObject>& Params);
 
 	// Helper methods
@@ -8,6 +8,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
+#include "ScopedTransaction.h"
 
 FMCPToolResult FMCPTool_MoveActor::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -18,6 +19,20 @@ FMCPToolResult FMCPTool_MoveActor::Execute(const TSharedRef<FJsonObject>& Params
 		return Error.GetValue();
 	}
 
+	// Check if relative mode using base class helper; in batch mode this is
+	// the default each entry can override
+	const bool bRelative = ExtractOptionalBool(Params, TEXT("relative"), false);
+	const bool bSkipPhysicsUpdate = ExtractOptionalBool(Params, TEXT("skip_physics_update"), false);
+
+	// Batch mode: apply every transform inside one transaction with a single
+	// viewport refresh at the end, so a layout pass over hundreds of actors
+	// pays undo tracking and redraw once instead of per move
+	const TArray<TSharedPtr<FJsonValue>>* MovesArray;
+	if (Params->TryGetArrayField(TEXT("moves"), MovesArray))
+	{
+		return ExecuteBatch(World, *MovesArray, bRelative, bSkipPhysicsUpdate);
+	}
+
 	// Extract and validate actor name using base class helper
 	FString ActorName;
 	TOptional<FMCPToolResult> ParamError;
@@ -33,76 +48,169 @@ FMCPToolResult FMCPTool_MoveActor::Execute(const TSharedRef<FJsonObject>& Params
 		return ActorNotFoundError(ActorName);
 	}
 
-	// Get current transform
-	FVector CurrentLocation = Actor->GetActorLocation();
-	FRotator CurrentRotation = Actor->GetActorRotation();
-	FVector CurrentScale = Actor->GetActorScale3D();
+	TArray<FString> Changes = ApplyMove(Actor, Params, bRelative, bSkipPhysicsUpdate);
+	if (Changes.Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("No transform changes specified. Provide location, rotation, or scale."));
+	}
+
+	// Mark dirty using base class helper
+	Actor->MarkPackageDirty();
+	MarkWorldDirty(World);
+
+	// Build result with new transform using shared utilities
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("actor"), Actor->GetName());
+	ResultData->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorLocation()));
+	ResultData->SetObjectField(TEXT("rotation"), UnrealClaudeJsonUtils::RotatorToJson(Actor->GetActorRotation()));
+	ResultData->SetObjectField(TEXT("scale"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorScale3D()));
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Updated %s for actor '%s'"), *FString::Join(Changes, TEXT(", ")), *Actor->GetName()),
+		ResultData
+	);
+}
+
+FMCPToolResult FMCPTool_MoveActor::ExecuteBatch(UWorld* World, const TArray<TSharedPtr<FJsonValue>>& Moves,
+	bool bRelativeDefault, bool bSkipPhysicsUpdate)
+{
+	if (Moves.Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("'moves' array is empty"));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> MovedArray;
+	TArray<TSharedPtr<FJsonValue>> FailedArray;
+
+	{
+		FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "BulkMoveActors", "Claude: Bulk Move Actors"));
+
+		for (int32 MoveIndex = 0; MoveIndex < Moves.Num(); ++MoveIndex)
+		{
+			const TSharedPtr<FJsonObject>* MoveObj;
+			if (!Moves[MoveIndex]->TryGetObject(MoveObj))
+			{
+				TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+				FailJson->SetNumberField(TEXT("index"), MoveIndex);
+				FailJson->SetStringField(TEXT("error"), TEXT("Entry must be an object with actor_name and transform fields"));
+				FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+				continue;
+			}
+			const TSharedRef<FJsonObject> MoveParams = (*MoveObj).ToSharedRef();
+
+			FString ActorName;
+			TOptional<FMCPToolResult> ParamError;
+			if (!ExtractActorName(MoveParams, TEXT("actor_name"), ActorName, ParamError))
+			{
+				TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+				FailJson->SetNumberField(TEXT("index"), MoveIndex);
+				FailJson->SetStringField(TEXT("error"), ParamError.GetValue().Message);
+				FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+				continue;
+			}
+
+			AActor* Actor = FindActorByNameOrLabel(World, ActorName);
+			if (!Actor)
+			{
+				TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+				FailJson->SetNumberField(TEXT("index"), MoveIndex);
+				FailJson->SetStringField(TEXT("actor"), ActorName);
+				FailJson->SetStringField(TEXT("error"), TEXT("Actor not found"));
+				FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+				continue;
+			}
+
+			const bool bRelative = ExtractOptionalBool(MoveParams, TEXT("relative"), bRelativeDefault);
+
+			// Snapshot into the shared transaction before touching the transform
+			Actor->Modify();
+			TArray<FString> Changes = ApplyMove(Actor, MoveParams, bRelative, bSkipPhysicsUpdate);
+			if (Changes.Num() == 0)
+			{
+				TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+				FailJson->SetNumberField(TEXT("index"), MoveIndex);
+				FailJson->SetStringField(TEXT("actor"), ActorName);
+				FailJson->SetStringField(TEXT("error"), TEXT("No transform changes specified"));
+				FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+				continue;
+			}
+
+			Actor->MarkPackageDirty();
+			MovedArray.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+		}
+	}
+
+	// One dirty-mark and one viewport refresh for the whole batch
+	MarkWorldDirty(World);
+	if (GEditor)
+	{
+		GEditor->RedrawLevelEditingViewports();
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("moved"), MovedArray);
+	ResultData->SetNumberField(TEXT("count"), MovedArray.Num());
+	if (FailedArray.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("failed"), FailedArray);
+	}
+
+	if (MovedArray.Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("Failed to move any of the requested actors"));
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Moved %d actor(s)%s"), MovedArray.Num(),
+			FailedArray.Num() > 0 ? *FString::Printf(TEXT(", %d failed"), FailedArray.Num()) : TEXT("")),
+		ResultData
+	);
+}
+
+TArray<FString> FMCPTool_MoveActor::ApplyMove(AActor* Actor, const TSharedRef<FJsonObject>& MoveParams,
+	bool bRelative, bool bSkipPhysicsUpdate)
+{
+	// TeleportPhysics writes the new transform straight into the physics
+	// state instead of resolving velocity/penetration per move - the right
+	// semantics for layout passes, and much cheaper on physics-heavy actors
+	const ETeleportType Teleport = bSkipPhysicsUpdate ? ETeleportType::TeleportPhysics : ETeleportType::None;
 
-	// Check if relative mode using base class helper
-	bool bRelative = ExtractOptionalBool(Params, TEXT("relative"), false);
+	TArray<FString> Changes;
 
 	// Apply new location if provided (using base class transform helpers)
-	FVector NewLocation = CurrentLocation;
-	bool bLocationChanged = ExtractVectorComponents(Params, TEXT("location"), NewLocation, bRelative);
-	if (bLocationChanged)
+	FVector NewLocation = Actor->GetActorLocation();
+	if (ExtractVectorComponents(MoveParams, TEXT("location"), NewLocation, bRelative))
 	{
-		Actor->SetActorLocation(NewLocation);
+		Actor->SetActorLocation(NewLocation, /*bSweep*/ false, nullptr, Teleport);
+		Changes.Add(TEXT("location"));
 	}
 
 	// Apply new rotation if provided (using base class transform helpers)
-	FRotator NewRotation = CurrentRotation;
-	bool bRotationChanged = ExtractRotatorComponents(Params, TEXT("rotation"), NewRotation, bRelative);
-	if (bRotationChanged)
+	FRotator NewRotation = Actor->GetActorRotation();
+	if (ExtractRotatorComponents(MoveParams, TEXT("rotation"), NewRotation, bRelative))
 	{
-		Actor->SetActorRotation(NewRotation);
+		Actor->SetActorRotation(NewRotation, Teleport);
+		Changes.Add(TEXT("rotation"));
 	}
 
 	// Apply new scale if provided
 	// Note: Scale uses multiplicative relative mode, handled specially
-	FVector NewScale = CurrentScale;
-	bool bScaleChanged = false;
-	if (HasVectorParam(Params, TEXT("scale")))
+	if (HasVectorParam(MoveParams, TEXT("scale")))
 	{
+		FVector NewScale = Actor->GetActorScale3D();
 		if (bRelative)
 		{
 			// Multiplicative scale for relative mode
-			FVector ScaleMultiplier = ExtractVectorParam(Params, TEXT("scale"), FVector::OneVector);
-			NewScale = CurrentScale * ScaleMultiplier;
+			NewScale *= ExtractVectorParam(MoveParams, TEXT("scale"), FVector::OneVector);
 		}
 		else
 		{
 			// Absolute scale replacement
-			ExtractVectorComponents(Params, TEXT("scale"), NewScale, false);
+			ExtractVectorComponents(MoveParams, TEXT("scale"), NewScale, false);
 		}
 		Actor->SetActorScale3D(NewScale);
-		bScaleChanged = true;
-	}
-
-	// Check if anything changed
-	if (!bLocationChanged && !bRotationChanged && !bScaleChanged)
-	{
-		return FMCPToolResult::Error(TEXT("No transform changes specified. Provide location, rotation, or scale."));
+		Changes.Add(TEXT("scale"));
 	}
 
-	// Mark dirty using base class helper
-	Actor->MarkPackageDirty();
-	MarkWorldDirty(World);
-
-	// Build result with new transform using shared utilities
-	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
-	ResultData->SetStringField(TEXT("actor"), Actor->GetName());
-	ResultData->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorLocation()));
-	ResultData->SetObjectField(TEXT("rotation"), UnrealClaudeJsonUtils::RotatorToJson(Actor->GetActorRotation()));
-	ResultData->SetObjectField(TEXT("scale"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorScale3D()));
-
-	// Build change description
-	TArray<FString> Changes;
-	if (bLocationChanged) Changes.Add(TEXT("location"));
-	if (bRotationChanged) Changes.Add(TEXT("rotation"));
-	if (bScaleChanged) Changes.Add(TEXT("scale"));
-
-	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Updated %s for actor '%s'"), *FString::Join(Changes, TEXT(", ")), *Actor->GetName()),
-		ResultData
-	);
+	return Changes;
 }
@@ -7,6 +7,10 @@
 
 /**
  * MCP Tool: Move/transform an actor
+ *
+ * Batch mode applies an array of transforms under a single transaction
+ * with one viewport refresh at the end, so a layout pass over hundreds
+ * of actors pays undo tracking and redraw once instead of per move.
  */
 class FMCPTool_MoveActor : public FMCPToolBase
 {
@@ -24,18 +28,36 @@ public:
 			"- Rotate 90 degrees: rotation={yaw:90}, relative=true\n"
 			"- Scale up 2x: scale={x:2, y:2, z:2}\n"
 			"- Move forward 50 units: location={x:50}, relative=true\n\n"
-			"Returns: Actor's new transform (location, rotation, scale)."
+			"Batch mode: pass 'moves' as an array of {actor_name, location, rotation, "
+			"scale, relative} objects to apply every transform inside one transaction "
+			"with a single viewport refresh at the end - use this for layout passes "
+			"that reposition many actors instead of one call per actor. Set "
+			"skip_physics_update=true to teleport physics state instead of resolving "
+			"it per move (fastest for static layout work).\n\n"
+			"Returns: Actor's new transform (location, rotation, scale), or per-actor "
+			"results in batch mode."
 		);
 		Info.Parameters = {
-			FMCPToolParameter(TEXT("actor_name"), TEXT("string"), TEXT("The name of the actor to transform"), true),
+			FMCPToolParameter(TEXT("actor_name"), TEXT("string"), TEXT("The name of the actor to transform (single mode)"), false),
 			FMCPToolParameter(TEXT("location"), TEXT("object"), TEXT("New location {x, y, z}. Omit to keep current."), false),
 			FMCPToolParameter(TEXT("rotation"), TEXT("object"), TEXT("New rotation {pitch, yaw, roll}. Omit to keep current."), false),
 			FMCPToolParameter(TEXT("scale"), TEXT("object"), TEXT("New scale {x, y, z}. Omit to keep current."), false),
-			FMCPToolParameter(TEXT("relative"), TEXT("boolean"), TEXT("If true, values are added to current transform instead of replacing"), false, TEXT("false"))
+			FMCPToolParameter(TEXT("relative"), TEXT("boolean"), TEXT("If true, values are added to current transform instead of replacing"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("moves"), TEXT("array"), TEXT("Batch mode: array of {actor_name, location, rotation, scale, relative} objects"), false),
+			FMCPToolParameter(TEXT("skip_physics_update"), TEXT("boolean"), TEXT("Teleport physics state instead of resolving collisions/velocity per move (batch fast path)"), false, TEXT("false"))
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Apply every entry of the 'moves' array inside one transaction */
+	FMCPToolResult ExecuteBatch(UWorld* World, const TArray<TSharedPtr<FJsonValue>>& Moves,
+		bool bRelativeDefault, bool bSkipPhysicsUpdate);
+
+	/** Apply one move to a found actor; returns the list of changed components */
+	TArray<FString> ApplyMove(AActor* Actor, const TSharedRef<FJsonObject>& MoveParams,
+		bool bRelative, bool bSkipPhysicsUpdate);
 };
@@ -0,0 +1,23 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_MutationJournal.h"
+#include "../MCPMutationJournal.h"
+#include "UnrealClaudeConstants.h"
+
+FMCPToolResult FMCPTool_MutationJournal::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::MCPServer;
+
+	const int32 Count = FMath::Clamp(
+		ExtractOptionalNumber<int32>(Params, TEXT("count"), DefaultMutationJournalEntries),
+		1, MaxMutationJournalEntries);
+
+	TArray<TSharedPtr<FJsonValue>> Entries = FMCPMutationJournal::Get().ReadTail(Count);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("count"), Entries.Num());
+	ResultData->SetArrayField(TEXT("entries"), Entries);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Returned %d journal entries"), Entries.Num()), ResultData);
+}
@@ -0,0 +1,43 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+/**
+ * MCP Tool: Read the tail of the mutation write-ahead journal
+ *
+ * After an editor crash mid-session, the journal in Saved/UnrealClaude is
+ * the record of which mutating invocations ran and which completed. This
+ * exposes its tail over MCP so a restarted agent can find the last
+ * completed operation and resume its plan incrementally instead of
+ * re-running everything and duplicating edits.
+ */
+class FMCPTool_MutationJournal : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("get_mutation_journal");
+		Info.Description = TEXT(
+			"Read the tail of the mutating-operation journal.\n\n"
+			"Every mutating tool invocation is logged before it runs and marked "
+			"on completion. Entries carry seq, time, tool, params, completed and "
+			"(when completed) success - an entry with completed=false is one the "
+			"editor may have half-applied before a crash. Use this after a "
+			"restart to resume a plan from the last completed operation."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("count"), TEXT("number"),
+				TEXT("Most recent invocations to return (default: 50, max: 500)"), false, TEXT("50"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	/** Reads the lock-protected journal only; no engine state */
+	virtual bool IsThreadSafe() const override { return true; }
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
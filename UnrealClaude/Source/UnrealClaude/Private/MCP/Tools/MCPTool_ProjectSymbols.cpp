@@ -0,0 +1,94 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_ProjectSymbols.h"
+#include "ProjectContext.h"
+
+FMCPToolResult FMCPTool_ProjectSymbols::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	TOptional<FMCPToolResult> ParamError;
+	FString ClassName;
+	if (!ExtractRequiredString(Params, TEXT("class"), ClassName, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
+	FString Kind = ExtractOptionalString(Params, TEXT("kind"), TEXT("all"));
+	if (Kind != TEXT("all") && Kind != TEXT("functions") && Kind != TEXT("properties"))
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Invalid kind '%s'. Must be 'functions', 'properties', or 'all'"), *Kind));
+	}
+	FString NameFilter = ExtractOptionalString(Params, TEXT("name_filter"));
+
+	// Ensure the index exists (no-op when already gathered)
+	FProjectContextManager::Get().GetContext();
+
+	FUClassInfo ClassInfo;
+	if (!FProjectContextManager::Get().FindClassInfo(ClassName, ClassInfo))
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Class not found in project index: %s (only project headers are indexed)"), *ClassName));
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("class"), ClassInfo.ClassName);
+	ResultData->SetStringField(TEXT("parent"), ClassInfo.ParentClass);
+	ResultData->SetStringField(TEXT("file"), ClassInfo.FilePath);
+	ResultData->SetNumberField(TEXT("line"), ClassInfo.LineNumber);
+	if (!ClassInfo.Specifiers.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("specifiers"), ClassInfo.Specifiers);
+	}
+
+	auto MembersToJson = [&NameFilter](const TArray<FUMemberInfo>& Members)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		Array.Reserve(Members.Num());
+		for (const FUMemberInfo& Member : Members)
+		{
+			if (!NameFilter.IsEmpty() &&
+				!Member.Name.Contains(NameFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			Array.Add(MakeShared<FJsonValueObject>(MemberToJson(Member)));
+		}
+		return Array;
+	};
+
+	int32 FunctionCount = 0;
+	int32 PropertyCount = 0;
+	if (Kind != TEXT("properties"))
+	{
+		TArray<TSharedPtr<FJsonValue>> Functions = MembersToJson(ClassInfo.Functions);
+		FunctionCount = Functions.Num();
+		ResultData->SetArrayField(TEXT("functions"), Functions);
+	}
+	if (Kind != TEXT("functions"))
+	{
+		TArray<TSharedPtr<FJsonValue>> Properties = MembersToJson(ClassInfo.Properties);
+		PropertyCount = Properties.Num();
+		ResultData->SetArrayField(TEXT("properties"), Properties);
+	}
+
+	return FMCPToolResult::Success(FString::Printf(
+		TEXT("%s : %s - %d function%s, %d propert%s"),
+		*ClassInfo.ClassName,
+		ClassInfo.ParentClass.IsEmpty() ? TEXT("(no parent)") : *ClassInfo.ParentClass,
+		FunctionCount, FunctionCount == 1 ? TEXT("") : TEXT("s"),
+		PropertyCount, PropertyCount == 1 ? TEXT("y") : TEXT("ies")),
+		ResultData);
+}
+
+TSharedPtr<FJsonObject> FMCPTool_ProjectSymbols::MemberToJson(const FUMemberInfo& Member)
+{
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetStringField(TEXT("name"), Member.Name);
+	Json->SetStringField(TEXT("type"), Member.Type);
+	if (!Member.Specifiers.IsEmpty())
+	{
+		Json->SetStringField(TEXT("specifiers"), Member.Specifiers);
+	}
+	Json->SetNumberField(TEXT("line"), Member.LineNumber);
+	return Json;
+}
@@ -0,0 +1,54 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+struct FUClassInfo;
+struct FUMemberInfo;
+
+/**
+ * MCP Tool: Query the project header index for a class's reflected members
+ *
+ * Answers "what functions/properties does this class expose" from the
+ * in-memory symbol index instead of a file-reading round-trip through the
+ * CLI. The index covers UCLASS declarations in project headers, with
+ * UFUNCTION/UPROPERTY names, types, specifiers and line numbers.
+ */
+class FMCPTool_ProjectSymbols : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("project_symbols");
+		Info.Description = TEXT(
+			"Look up a project C++ class in the header symbol index.\n\n"
+			"Returns the class's parent, file, line number, UCLASS specifiers, "
+			"and its UFUNCTION/UPROPERTY declarations (name, type, specifiers, "
+			"line number) without reading any files. Use this before asking to "
+			"read a header - it answers 'what members does AMyCharacter have' "
+			"from the local index.\n\n"
+			"Only project source headers are indexed, not engine classes. "
+			"Class name matching is case-insensitive and includes the prefix "
+			"(e.g. 'AMyCharacter', not 'MyCharacter')."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("class"), TEXT("string"),
+				TEXT("Class name to look up (e.g., 'AMyCharacter', 'UMyComponent')"), true),
+			FMCPToolParameter(TEXT("kind"), TEXT("string"),
+				TEXT("Which members to return: 'functions', 'properties', or 'all' (default: 'all')"), false, TEXT("all")),
+			FMCPToolParameter(TEXT("name_filter"), TEXT("string"),
+				TEXT("Substring to match in member names (case-insensitive)"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Convert one indexed member to its JSON form */
+	static TSharedPtr<FJsonObject> MemberToJson(const FUMemberInfo& Member);
+};
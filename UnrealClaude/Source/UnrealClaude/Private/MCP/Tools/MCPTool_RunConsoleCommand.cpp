@@ -16,6 +16,80 @@ FMCPToolResult FMCPTool_RunConsoleCommand::Execute(const TSharedRef<FJsonObject>
 		return Error.GetValue();
 	}
 
+	// When running through the task queue, the injected task ID tags the
+	// captured output so overlapping executions stay attributable
+	FString TaskIdString;
+	Params->TryGetStringField(TEXT("_task_id"), TaskIdString);
+
+	// Batch form: run a command sequence back-to-back in this one game-thread
+	// hop, returning each command's captured output inline
+	const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+	if (Params->TryGetArrayField(TEXT("commands"), Commands))
+	{
+		if (Commands->Num() == 0)
+		{
+			return FMCPToolResult::Error(TEXT("'commands' array must not be empty"));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> CommandResults;
+		int32 ExecutedCount = 0;
+
+		for (const TSharedPtr<FJsonValue>& CommandValue : *Commands)
+		{
+			TSharedPtr<FJsonObject> CommandResult = MakeShared<FJsonObject>();
+
+			FString BatchCommand;
+			if (!CommandValue.IsValid() || !CommandValue->TryGetString(BatchCommand))
+			{
+				CommandResult->SetStringField(TEXT("error"), TEXT("entry is not a string"));
+				CommandResults.Add(MakeShared<FJsonValueObject>(CommandResult));
+				continue;
+			}
+			CommandResult->SetStringField(TEXT("command"), BatchCommand);
+
+			TOptional<FMCPToolResult> CommandError;
+			if (!ValidateConsoleCommandParam(BatchCommand, CommandError))
+			{
+				CommandResult->SetStringField(TEXT("error"), CommandError.GetValue().Message);
+				CommandResults.Add(MakeShared<FJsonValueObject>(CommandResult));
+				continue;
+			}
+
+			UE_LOG(LogUnrealClaude, Log, TEXT("Executing console command: %s"), *BatchCommand);
+
+			// Scoped per command: the log lines land on the command that
+			// actually emitted them, not pooled across the batch
+			FUnrealClaudeOutputDevice BatchOutputDevice;
+			FString BatchLogOutput;
+			{
+				FUnrealClaudeScopedLogCapture LogCapture;
+				GEditor->Exec(World, *BatchCommand, BatchOutputDevice);
+				BatchLogOutput = LogCapture.GetCaptured();
+			}
+
+			CommandResult->SetStringField(TEXT("output"), BatchOutputDevice.GetTrimmedOutput());
+			if (!BatchLogOutput.IsEmpty())
+			{
+				CommandResult->SetStringField(TEXT("log"), BatchLogOutput);
+			}
+			CommandResults.Add(MakeShared<FJsonValueObject>(CommandResult));
+			ExecutedCount++;
+		}
+
+		TSharedPtr<FJsonObject> BatchResultData = MakeShared<FJsonObject>();
+		BatchResultData->SetArrayField(TEXT("results"), CommandResults);
+		BatchResultData->SetNumberField(TEXT("executed"), ExecutedCount);
+		if (!TaskIdString.IsEmpty())
+		{
+			BatchResultData->SetStringField(TEXT("task_id"), TaskIdString);
+		}
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Executed %d/%d console commands"), ExecutedCount, Commands->Num()),
+			BatchResultData
+		);
+	}
+
 	// Extract and validate command using base class helpers
 	FString Command;
 	TOptional<FMCPToolResult> ParamError;
@@ -30,16 +104,30 @@ FMCPToolResult FMCPTool_RunConsoleCommand::Execute(const TSharedRef<FJsonObject>
 
 	UE_LOG(LogUnrealClaude, Log, TEXT("Executing console command: %s"), *Command);
 
-	// Create output capture device
+	// Create output capture device; the scoped log device catches side
+	// effects that commands log instead of writing to their archive
 	FUnrealClaudeOutputDevice OutputDevice;
+	FString LogOutput;
 
 	// Execute the command
-	GEditor->Exec(World, *Command, OutputDevice);
+	{
+		FUnrealClaudeScopedLogCapture LogCapture;
+		GEditor->Exec(World, *Command, OutputDevice);
+		LogOutput = LogCapture.GetCaptured();
+	}
 
 	// Build result
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetStringField(TEXT("command"), Command);
 	ResultData->SetStringField(TEXT("output"), OutputDevice.GetTrimmedOutput());
+	if (!LogOutput.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("log"), LogOutput);
+	}
+	if (!TaskIdString.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("task_id"), TaskIdString);
+	}
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Executed command: %s"), *Command),
@@ -6,7 +6,8 @@
 #include "../MCPToolBase.h"
 
 /**
- * MCP Tool: Run an Unreal console command
+ * MCP Tool: Run one Unreal console command, or a batch of them back-to-back
+ * in a single game-thread hop with per-command captured output
  */
 class FMCPTool_RunConsoleCommand : public FMCPToolBase
 {
@@ -27,10 +28,17 @@ public:
 			"- 'slomo 0.5' - Slow motion (PIE only)\n"
 			"- 'ce MyEvent' - Call custom event\n\n"
 			"Note: Some commands only work in Play-In-Editor (PIE) mode.\n\n"
-			"Returns: Command execution confirmation."
+			"Pass 'commands' (array) instead of 'command' to run a fixed sequence "
+			"back-to-back in one call; each command's captured output is returned "
+			"inline, so no follow-up log reads are needed.\n\n"
+			"Returns: Command execution confirmation with captured output. Log "
+			"lines emitted while the command ran (side effects that do not go "
+			"to the command's own output) are returned in 'log' - there is no "
+			"need to call get_output_log afterwards to see what a command did."
 		);
 		Info.Parameters = {
-			FMCPToolParameter(TEXT("command"), TEXT("string"), TEXT("The console command to execute (e.g., 'stat fps', 'show collision')"), true)
+			FMCPToolParameter(TEXT("command"), TEXT("string"), TEXT("The console command to execute (e.g., 'stat fps', 'show collision')"), false),
+			FMCPToolParameter(TEXT("commands"), TEXT("array"), TEXT("Array of console commands to execute back-to-back in one call (alternative to 'command')"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
@@ -8,6 +8,7 @@
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
 #include "UObject/PropertyAccessUtil.h"
+#include "ScopedTransaction.h"
 
 FMCPToolResult FMCPTool_SetProperty::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -18,16 +19,9 @@ FMCPToolResult FMCPTool_SetProperty::Execute(const TSharedRef<FJsonObject>& Para
 		return Error.GetValue();
 	}
 
-	// Extract and validate actor name using base class helper
-	FString ActorName;
-	TOptional<FMCPToolResult> ParamError;
-	if (!ExtractActorName(Params, TEXT("actor_name"), ActorName, ParamError))
-	{
-		return ParamError.GetValue();
-	}
-
 	// Extract and validate property path using base class helpers
 	FString PropertyPath;
+	TOptional<FMCPToolResult> ParamError;
 	if (!ExtractRequiredString(Params, TEXT("property"), PropertyPath, ParamError))
 	{
 		return ParamError.GetValue();
@@ -37,13 +31,108 @@ FMCPToolResult FMCPTool_SetProperty::Execute(const TSharedRef<FJsonObject>& Para
 		return ParamError.GetValue();
 	}
 
-	const TSharedPtr<FJsonValue>* ValuePtr = nullptr;
 	if (!Params->HasField(TEXT("value")))
 	{
 		return FMCPToolResult::Error(TEXT("Missing required parameter: value"));
 	}
 	TSharedPtr<FJsonValue> Value = Params->TryGetField(TEXT("value"));
 
+	// Bulk mode: apply the same property/value to every named actor inside
+	// one transaction so the editor pays for undo tracking and world
+	// dirty-marking once, not per target
+	const TArray<TSharedPtr<FJsonValue>>* TargetsArray;
+	if (Params->TryGetArrayField(TEXT("actors"), TargetsArray))
+	{
+		if (TargetsArray->Num() == 0)
+		{
+			return FMCPToolResult::Error(TEXT("'actors' array is empty"));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> UpdatedArray;
+		TArray<TSharedPtr<FJsonValue>> FailedArray;
+
+		{
+			FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "BulkSetProperty", "Claude: Bulk Set Property"));
+
+			for (int32 TargetIndex = 0; TargetIndex < TargetsArray->Num(); ++TargetIndex)
+			{
+				FString TargetName;
+				if (!(*TargetsArray)[TargetIndex]->TryGetString(TargetName)
+					|| !ValidateActorNameParam(TargetName, ParamError))
+				{
+					TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+					FailJson->SetNumberField(TEXT("index"), TargetIndex);
+					FailJson->SetStringField(TEXT("error"), TEXT("Target must be a valid actor name string"));
+					FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+					continue;
+				}
+
+				AActor* TargetActor = FindActorByNameOrLabel(World, TargetName);
+				if (!TargetActor)
+				{
+					TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+					FailJson->SetNumberField(TEXT("index"), TargetIndex);
+					FailJson->SetStringField(TEXT("actor"), TargetName);
+					FailJson->SetStringField(TEXT("error"), TEXT("Actor not found"));
+					FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+					continue;
+				}
+
+				// The path is re-navigated per actor: targets may differ in
+				// class or component layout, so a property offset resolved on
+				// one actor is not safe to reuse on the next
+				FString TargetError;
+				if (SetPropertyFromJson(TargetActor, PropertyPath, Value, TargetError))
+				{
+					TargetActor->MarkPackageDirty();
+					UpdatedArray.Add(MakeShared<FJsonValueString>(TargetActor->GetName()));
+				}
+				else
+				{
+					TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+					FailJson->SetNumberField(TEXT("index"), TargetIndex);
+					FailJson->SetStringField(TEXT("actor"), TargetName);
+					FailJson->SetStringField(TEXT("error"), TargetError);
+					FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+				}
+			}
+		}
+
+		// One dirty-mark and one viewport refresh for the whole batch
+		MarkWorldDirty(World);
+		if (GEditor)
+		{
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetStringField(TEXT("property"), PropertyPath);
+		ResultData->SetArrayField(TEXT("updated"), UpdatedArray);
+		ResultData->SetNumberField(TEXT("count"), UpdatedArray.Num());
+		if (FailedArray.Num() > 0)
+		{
+			ResultData->SetArrayField(TEXT("failed"), FailedArray);
+		}
+
+		if (UpdatedArray.Num() == 0)
+		{
+			return FMCPToolResult::Error(TEXT("Failed to set property on any of the requested actors"));
+		}
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Set property '%s' on %d actor(s)%s"), *PropertyPath, UpdatedArray.Num(),
+				FailedArray.Num() > 0 ? *FString::Printf(TEXT(", %d failed"), FailedArray.Num()) : TEXT("")),
+			ResultData
+		);
+	}
+
+	// Extract and validate actor name using base class helper
+	FString ActorName;
+	if (!ExtractActorName(Params, TEXT("actor_name"), ActorName, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
 	// Find the actor using base class helper
 	AActor* Actor = FindActorByNameOrLabel(World, ActorName);
 	if (!Actor)
@@ -27,12 +27,20 @@ public:
 			"- 'StaticMeshComponent.RelativeScale3D' - Mesh scale\n"
 			"- 'RootComponent.RelativeLocation' - Root position\n\n"
 			"Value types: strings, numbers, booleans, objects (FVector, FRotator, FLinearColor), arrays.\n\n"
+			"To apply the same property and value to many actors at once, pass an "
+			"'actors' array of actor names instead of 'actor_name'. All targets are "
+			"updated inside one transaction with a single world dirty-mark - use this "
+			"when tuning a property across a whole level.\n\n"
 			"Returns: Confirmation of property change."
 		);
 		Info.Parameters = {
-			FMCPToolParameter(TEXT("actor_name"), TEXT("string"), TEXT("The name of the actor to modify"), true),
+			FMCPToolParameter(TEXT("actor_name"), TEXT("string"), TEXT("The name of the actor to modify. Required unless 'actors' is given"), false),
 			FMCPToolParameter(TEXT("property"), TEXT("string"), TEXT("The property path to set (e.g., 'RelativeLocation', 'LightComponent.Intensity')"), true),
-			FMCPToolParameter(TEXT("value"), TEXT("any"), TEXT("The value to set (type depends on property)"), true)
+			FMCPToolParameter(TEXT("value"), TEXT("any"), TEXT("The value to set (type depends on property)"), true),
+			FMCPToolParameter(TEXT("actors"), TEXT("array"),
+				TEXT("Array of actor names to apply the same property and value to. "
+					"All updates happen inside one transaction - use this when setting "
+					"one property across many actors"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
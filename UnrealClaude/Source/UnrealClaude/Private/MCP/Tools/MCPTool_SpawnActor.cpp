@@ -2,6 +2,7 @@
 
 #include "MCPTool_SpawnActor.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPSlicedExecution.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeUtils.h"
 #include "Editor.h"
@@ -10,52 +11,50 @@
 #include "UObject/UObjectGlobals.h"
 #include "Engine/Blueprint.h"
 #include "Kismet/GameplayStatics.h"
+#include "ScopedTransaction.h"
 
-FMCPToolResult FMCPTool_SpawnActor::Execute(const TSharedRef<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FMCPTool_SpawnActor::SpawnOneActor(UWorld* World, const TSharedRef<FJsonObject>& Spec, FString& OutError)
 {
-	// Validate editor context using base class
-	UWorld* World = nullptr;
-	if (auto Error = ValidateEditorContext(World))
-	{
-		return Error.GetValue();
-	}
-
 	// Extract and validate class path using base class helper
 	FString ClassPath;
 	TOptional<FMCPToolResult> ParamError;
-	if (!ExtractRequiredString(Params, TEXT("class"), ClassPath, ParamError))
+	if (!ExtractRequiredString(Spec, TEXT("class"), ClassPath, ParamError))
 	{
-		return ParamError.GetValue();
+		OutError = ParamError.GetValue().Message;
+		return nullptr;
 	}
 
 	// Validate class path
 	FString ValidationError;
 	if (!FMCPParamValidator::ValidateClassPath(ClassPath, ValidationError))
 	{
-		return FMCPToolResult::Error(ValidationError);
+		OutError = ValidationError;
+		return nullptr;
 	}
 
 	// Load the actor class using base class helper (handles fallback prefixes)
 	UClass* ActorClass = LoadActorClass(ClassPath, ParamError);
 	if (!ActorClass)
 	{
-		return ParamError.GetValue();
+		OutError = ParamError.GetValue().Message;
+		return nullptr;
 	}
 
 	// Parse transform using base class helpers (consolidated transform extraction)
-	FVector Location = ExtractVectorParam(Params, TEXT("location"));
-	FRotator Rotation = ExtractRotatorParam(Params, TEXT("rotation"));
-	FVector Scale = ExtractScaleParam(Params, TEXT("scale"));
+	FVector Location = ExtractVectorParam(Spec, TEXT("location"));
+	FRotator Rotation = ExtractRotatorParam(Spec, TEXT("rotation"));
+	FVector Scale = ExtractScaleParam(Spec, TEXT("scale"));
 
 	// Get optional name using base class helper
-	FString ActorName = ExtractOptionalString(Params, TEXT("name"));
+	FString ActorName = ExtractOptionalString(Spec, TEXT("name"));
 
 	// Validate actor name if provided
 	if (!ActorName.IsEmpty())
 	{
 		if (!FMCPParamValidator::ValidateActorName(ActorName, ValidationError))
 		{
-			return FMCPToolResult::Error(ValidationError);
+			OutError = ValidationError;
+			return nullptr;
 		}
 	}
 
@@ -73,21 +72,266 @@ FMCPToolResult FMCPTool_SpawnActor::Execute(const TSharedRef<FJsonObject>& Param
 
 	if (!SpawnedActor)
 	{
-		return FMCPToolResult::Error(FString::Printf(TEXT("Failed to spawn actor of class: %s"), *ClassPath));
+		OutError = FString::Printf(TEXT("Failed to spawn actor of class: %s"), *ClassPath);
+		return nullptr;
+	}
+
+	// Build result using shared JSON utilities
+	TSharedPtr<FJsonObject> ActorJson = MakeShared<FJsonObject>();
+	ActorJson->SetStringField(TEXT("actorName"), SpawnedActor->GetName());
+	ActorJson->SetStringField(TEXT("actorClass"), ActorClass->GetName());
+	ActorJson->SetStringField(TEXT("actorLabel"), SpawnedActor->GetActorLabel());
+	ActorJson->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Location));
+	return ActorJson;
+}
+
+FMCPToolResult FMCPTool_SpawnActor::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	// Validate editor context using base class
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	// Bulk mode: spawn every spec inside one transaction so the editor pays
+	// for undo tracking and viewport invalidation once, not per actor
+	const TArray<TSharedPtr<FJsonValue>>* SpecsArray;
+	if (Params->TryGetArrayField(TEXT("actors"), SpecsArray))
+	{
+		if (SpecsArray->Num() == 0)
+		{
+			return FMCPToolResult::Error(TEXT("'actors' array is empty"));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> SpawnedArray;
+		TArray<TSharedPtr<FJsonValue>> FailedArray;
+
+		{
+			FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "BulkSpawnActors", "Claude: Bulk Spawn Actors"));
+
+			for (int32 SpecIndex = 0; SpecIndex < SpecsArray->Num(); ++SpecIndex)
+			{
+				const TSharedPtr<FJsonObject>* SpecObject;
+				if (!(*SpecsArray)[SpecIndex]->TryGetObject(SpecObject))
+				{
+					TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+					FailJson->SetNumberField(TEXT("index"), SpecIndex);
+					FailJson->SetStringField(TEXT("error"), TEXT("Spawn spec must be an object"));
+					FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+					continue;
+				}
+
+				FString SpawnError;
+				TSharedPtr<FJsonObject> ActorJson = SpawnOneActor(World, SpecObject->ToSharedRef(), SpawnError);
+				if (ActorJson.IsValid())
+				{
+					SpawnedArray.Add(MakeShared<FJsonValueObject>(ActorJson));
+				}
+				else
+				{
+					TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+					FailJson->SetNumberField(TEXT("index"), SpecIndex);
+					FailJson->SetStringField(TEXT("error"), SpawnError);
+					FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+				}
+			}
+		}
+
+		// One dirty-mark and one viewport refresh for the whole batch
+		MarkWorldDirty(World);
+		if (GEditor)
+		{
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetArrayField(TEXT("spawned"), SpawnedArray);
+		ResultData->SetNumberField(TEXT("count"), SpawnedArray.Num());
+		if (FailedArray.Num() > 0)
+		{
+			ResultData->SetArrayField(TEXT("failed"), FailedArray);
+		}
+
+		if (SpawnedArray.Num() == 0)
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Failed to spawn any of %d actor(s)"), SpecsArray->Num()));
+		}
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Spawned %d actor(s)%s"), SpawnedArray.Num(),
+				FailedArray.Num() > 0 ? *FString::Printf(TEXT(", %d failed"), FailedArray.Num()) : TEXT("")),
+			ResultData
+		);
+	}
+
+	// Single-actor mode
+	FString SpawnError;
+	TSharedPtr<FJsonObject> ActorJson = SpawnOneActor(World, Params, SpawnError);
+	if (!ActorJson.IsValid())
+	{
+		return FMCPToolResult::Error(SpawnError);
 	}
 
 	// Mark the level as dirty using base class helper
 	MarkWorldDirty(World);
 
-	// Build result using shared JSON utilities
-	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
-	ResultData->SetStringField(TEXT("actorName"), SpawnedActor->GetName());
-	ResultData->SetStringField(TEXT("actorClass"), ActorClass->GetName());
-	ResultData->SetStringField(TEXT("actorLabel"), SpawnedActor->GetActorLabel());
-	ResultData->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Location));
-
 	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Spawned actor '%s' of class '%s'"), *SpawnedActor->GetName(), *ActorClass->GetName()),
-		ResultData
+		FString::Printf(TEXT("Spawned actor '%s' of class '%s'"),
+			*ActorJson->GetStringField(TEXT("actorName")),
+			*ActorJson->GetStringField(TEXT("actorClass"))),
+		ActorJson
 	);
 }
+
+/**
+ * Sliced bulk spawn: one actor per Step() call, driven by FMCPToolSlicer
+ * within the per-frame budget. The editor transaction stays open across
+ * frames so the whole batch still collapses to a single undo entry; while
+ * it is open, unrelated editor edits would record into it, but sliced runs
+ * only happen during agent-driven task-queue work where that window is
+ * acceptable.
+ */
+class FSlicedBulkSpawn : public IMCPSlicedExecution
+{
+public:
+	FSlicedBulkSpawn(FMCPTool_SpawnActor& InTool, UWorld* InWorld, const TArray<TSharedPtr<FJsonValue>>& InSpecs)
+		: Tool(InTool)
+		, World(InWorld)
+		, Specs(InSpecs)
+	{
+		if (GEditor)
+		{
+			TransactionIndex = GEditor->BeginTransaction(
+				TEXT("UnrealClaude"),
+				NSLOCTEXT("UnrealClaude", "BulkSpawnActors", "Claude: Bulk Spawn Actors"),
+				nullptr);
+		}
+	}
+
+	virtual bool Step() override
+	{
+		if (NextIndex >= Specs.Num())
+		{
+			return true;
+		}
+
+		const int32 SpecIndex = NextIndex++;
+		const TSharedPtr<FJsonObject>* SpecObject;
+		if (!Specs[SpecIndex]->TryGetObject(SpecObject))
+		{
+			AddFailure(SpecIndex, TEXT("Spawn spec must be an object"));
+			return NextIndex >= Specs.Num();
+		}
+
+		FString SpawnError;
+		TSharedPtr<FJsonObject> ActorJson = Tool.SpawnOneActor(World.Get(), SpecObject->ToSharedRef(), SpawnError);
+		if (ActorJson.IsValid())
+		{
+			SpawnedArray.Add(MakeShared<FJsonValueObject>(ActorJson));
+		}
+		else
+		{
+			AddFailure(SpecIndex, SpawnError);
+		}
+		return NextIndex >= Specs.Num();
+	}
+
+	virtual int32 GetProgressPercent() const override
+	{
+		return Specs.Num() > 0 ? (NextIndex * 100) / Specs.Num() : 100;
+	}
+
+	virtual FMCPToolResult GetResult() override
+	{
+		CloseTransaction();
+
+		// One dirty-mark and one viewport refresh for the whole batch
+		if (World.IsValid())
+		{
+			World->MarkPackageDirty();
+		}
+		if (GEditor)
+		{
+			GEditor->RedrawLevelEditingViewports();
+		}
+
+		TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+		ResultData->SetArrayField(TEXT("spawned"), SpawnedArray);
+		ResultData->SetNumberField(TEXT("count"), SpawnedArray.Num());
+		if (FailedArray.Num() > 0)
+		{
+			ResultData->SetArrayField(TEXT("failed"), FailedArray);
+		}
+
+		if (SpawnedArray.Num() == 0)
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Failed to spawn any of %d actor(s)"), Specs.Num()));
+		}
+
+		return FMCPToolResult::Success(
+			FString::Printf(TEXT("Spawned %d actor(s)%s"), SpawnedArray.Num(),
+				FailedArray.Num() > 0 ? *FString::Printf(TEXT(", %d failed"), FailedArray.Num()) : TEXT("")),
+			ResultData
+		);
+	}
+
+	virtual void Cancel() override
+	{
+		// Roll back the partial batch so a cancelled spawn leaves no half-built level
+		if (GEditor && TransactionIndex != INDEX_NONE)
+		{
+			GEditor->CancelTransaction(TransactionIndex);
+			TransactionIndex = INDEX_NONE;
+		}
+	}
+
+	virtual ~FSlicedBulkSpawn() override
+	{
+		CloseTransaction();
+	}
+
+private:
+	void AddFailure(int32 SpecIndex, const FString& Error)
+	{
+		TSharedPtr<FJsonObject> FailJson = MakeShared<FJsonObject>();
+		FailJson->SetNumberField(TEXT("index"), SpecIndex);
+		FailJson->SetStringField(TEXT("error"), Error);
+		FailedArray.Add(MakeShared<FJsonValueObject>(FailJson));
+	}
+
+	void CloseTransaction()
+	{
+		if (GEditor && TransactionIndex != INDEX_NONE)
+		{
+			GEditor->EndTransaction();
+			TransactionIndex = INDEX_NONE;
+		}
+	}
+
+	FMCPTool_SpawnActor& Tool;
+	TWeakObjectPtr<UWorld> World;
+	TArray<TSharedPtr<FJsonValue>> Specs;
+	TArray<TSharedPtr<FJsonValue>> SpawnedArray;
+	TArray<TSharedPtr<FJsonValue>> FailedArray;
+	int32 NextIndex = 0;
+	int32 TransactionIndex = INDEX_NONE;
+};
+
+TSharedPtr<IMCPSlicedExecution> FMCPTool_SpawnActor::CreateSlicedExecution(const TSharedRef<FJsonObject>& Params)
+{
+	UWorld* World = nullptr;
+	if (ValidateEditorContext(World))
+	{
+		// Context error - fall back to blocking execution, which reports it
+		return nullptr;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* SpecsArray;
+	if (!Params->TryGetArrayField(TEXT("actors"), SpecsArray) || SpecsArray->Num() == 0)
+	{
+		return nullptr;
+	}
+
+	return MakeShared<FSlicedBulkSpawn>(*this, World, *SpecsArray);
+}
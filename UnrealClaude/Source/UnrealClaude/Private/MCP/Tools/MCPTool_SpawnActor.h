@@ -26,18 +26,38 @@ public:
 			"- 'CameraActor' - Camera\n"
 			"- 'PlayerStart' - Player spawn point\n"
 			"- '/Game/Blueprints/BP_MyActor' - Custom Blueprint actors\n\n"
-			"Returns: Actor name, class, label, and spawn location."
+			"For placing many actors at once, pass an 'actors' array instead of the "
+			"top-level class/transform parameters.\n\n"
+			"Returns: Actor name, class, label, and spawn location (or an array of these in bulk mode)."
 		);
 		Info.Parameters = {
-			FMCPToolParameter(TEXT("class"), TEXT("string"), TEXT("The class path to spawn (e.g., '/Script/Engine.PointLight' or 'StaticMeshActor')"), true),
+			FMCPToolParameter(TEXT("class"), TEXT("string"), TEXT("The class path to spawn (e.g., '/Script/Engine.PointLight' or 'StaticMeshActor'). Required unless 'actors' is given"), false),
 			FMCPToolParameter(TEXT("name"), TEXT("string"), TEXT("Optional name for the spawned actor"), false),
 			FMCPToolParameter(TEXT("location"), TEXT("object"), TEXT("Spawn location {x, y, z}"), false, TEXT("{\"x\":0,\"y\":0,\"z\":0}")),
 			FMCPToolParameter(TEXT("rotation"), TEXT("object"), TEXT("Spawn rotation {pitch, yaw, roll}"), false, TEXT("{\"pitch\":0,\"yaw\":0,\"roll\":0}")),
-			FMCPToolParameter(TEXT("scale"), TEXT("object"), TEXT("Spawn scale {x, y, z}"), false, TEXT("{\"x\":1,\"y\":1,\"z\":1}"))
+			FMCPToolParameter(TEXT("scale"), TEXT("object"), TEXT("Spawn scale {x, y, z}"), false, TEXT("{\"x\":1,\"y\":1,\"z\":1}")),
+			FMCPToolParameter(TEXT("actors"), TEXT("array"),
+				TEXT("Bulk mode: array of spawn specs, each {class, name?, location?, rotation?, scale?}. "
+					"All actors spawn inside one transaction with a single viewport refresh - "
+					"use this when placing many actors"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::Modifying();
 		return Info;
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+	/** Bulk spawns submitted through the task queue run as per-frame slices */
+	virtual bool SupportsSlicedExecution(const TSharedRef<FJsonObject>& Params) const override
+	{
+		return Params->HasField(TEXT("actors"));
+	}
+
+	virtual TSharedPtr<IMCPSlicedExecution> CreateSlicedExecution(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Spawn one actor from a spec object; returns its result JSON or sets OutError */
+	TSharedPtr<FJsonObject> SpawnOneActor(UWorld* World, const TSharedRef<FJsonObject>& Spec, FString& OutError);
+
+	friend class FSlicedBulkSpawn;
 };
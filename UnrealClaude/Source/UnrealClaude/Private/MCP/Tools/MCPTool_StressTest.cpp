@@ -0,0 +1,272 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_StressTest.h"
+#include "../MCPToolRegistry.h"
+#include "../MCPTaskQueue.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeModule.h"
+#include "Async/Async.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	/** One entry of the replay mix after validation */
+	struct FStressMixEntry
+	{
+		FString ToolName;
+		TSharedPtr<FJsonObject> Params;
+
+		/** Upper bound of this entry's slice of [0, TotalWeight) */
+		double CumulativeWeight = 0.0;
+	};
+
+	/**
+	 * Counters shared with completion callbacks and game-thread probes,
+	 * which outlive the pacing loop's stack frames
+	 */
+	struct FStressCounters
+	{
+		TAtomic<int32> Completed{0};
+		TAtomic<int32> Failed{0};
+
+		/** Probe latency accumulators; written only on the game thread
+		 *  (probes execute serially there), read after the run */
+		TAtomic<uint64> ProbeTotalMicros{0};
+		TAtomic<uint64> ProbeMaxMicros{0};
+		TAtomic<int32> ProbeCount{0};
+	};
+}
+
+FMCPToolResult FMCPTool_StressTest::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::MCPServer;
+
+	// The pacing loop sleeps for the whole run; inline on the game thread it
+	// would freeze the editor for duration_seconds
+	if (IsInGameThread())
+	{
+		return FMCPToolResult::Error(
+			TEXT("stress_test must run asynchronously - submit it via task_submit"));
+	}
+
+	if (!Registry)
+	{
+		return FMCPToolResult::Error(TEXT("Tool registry not available"));
+	}
+
+	TSharedPtr<FMCPTaskQueue> TaskQueue = Registry->GetTaskQueue();
+	if (!TaskQueue.IsValid())
+	{
+		return FMCPToolResult::Error(TEXT("Task queue not initialized"));
+	}
+
+	const double TargetRate = FMath::Clamp(
+		ExtractOptionalNumber<double>(Params, TEXT("target_rate"), StressDefaultTargetRate),
+		1.0, StressMaxTargetRate);
+	const int32 DurationSeconds = FMath::Clamp(
+		ExtractOptionalNumber<int32>(Params, TEXT("duration_seconds"), StressDefaultDurationSeconds),
+		1, StressMaxDurationSeconds);
+
+	// Validate the mix up front: unknown or non-read-only tools fail the
+	// whole run before any load is generated
+	const TArray<TSharedPtr<FJsonValue>>* MixArray = nullptr;
+	if (!Params->TryGetArrayField(TEXT("mix"), MixArray) || MixArray->Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("Missing required parameter: mix (non-empty array)"));
+	}
+
+	TArray<FStressMixEntry> Mix;
+	Mix.Reserve(MixArray->Num());
+	double TotalWeight = 0.0;
+	for (const TSharedPtr<FJsonValue>& Value : *MixArray)
+	{
+		const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(EntryObj))
+		{
+			return FMCPToolResult::Error(TEXT("Each mix entry must be an object"));
+		}
+
+		FStressMixEntry Entry;
+		if (!(*EntryObj)->TryGetStringField(TEXT("tool"), Entry.ToolName) || Entry.ToolName.IsEmpty())
+		{
+			return FMCPToolResult::Error(TEXT("Each mix entry requires a 'tool' field"));
+		}
+
+		IMCPTool* Tool = Registry->FindTool(Entry.ToolName);
+		if (!Tool)
+		{
+			return FMCPToolResult::Error(
+				FString::Printf(TEXT("Unknown tool in mix: '%s'"), *Entry.ToolName));
+		}
+		if (!Tool->GetInfo().Annotations.bReadOnlyHint)
+		{
+			return FMCPToolResult::Error(FString::Printf(
+				TEXT("Tool '%s' is not read-only; the stress mix may not mutate project state"),
+				*Entry.ToolName));
+		}
+
+		const TSharedPtr<FJsonObject>* EntryParams = nullptr;
+		if ((*EntryObj)->TryGetObjectField(TEXT("params"), EntryParams))
+		{
+			Entry.Params = *EntryParams;
+		}
+
+		double Weight = 1.0;
+		(*EntryObj)->TryGetNumberField(TEXT("weight"), Weight);
+		if (Weight <= 0.0)
+		{
+			return FMCPToolResult::Error(TEXT("Mix weights must be positive"));
+		}
+		TotalWeight += Weight;
+		Entry.CumulativeWeight = TotalWeight;
+		Mix.Add(MoveTemp(Entry));
+	}
+
+	TSharedRef<FStressCounters> Counters = MakeShared<FStressCounters>();
+	FRandomStream Random(static_cast<int32>(FPlatformTime::Cycles()));
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const double EndSeconds = StartSeconds + DurationSeconds;
+	const double SubmitInterval = 1.0 / TargetRate;
+
+	int32 Submitted = 0;
+	int32 SubmitRejected = 0;
+	int32 StatSamples = 0;
+	int64 PendingSum = 0;
+	int32 PendingMax = 0;
+	int32 RunningMax = 0;
+	double NextDueSeconds = StartSeconds;
+	double NextSampleSeconds = StartSeconds;
+	uint64 StressSequence = 0;
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("stress_test: %d tool(s) in mix, %.0f req/s for %ds"),
+		Mix.Num(), TargetRate, DurationSeconds);
+
+	while (true)
+	{
+		const double NowSeconds = FPlatformTime::Seconds();
+		if (NowSeconds >= EndSeconds)
+		{
+			break;
+		}
+
+		// Submit everything due by now; a slow iteration catches up in a
+		// burst rather than silently lowering the rate
+		while (NextDueSeconds <= NowSeconds)
+		{
+			const double Pick = Random.FRand() * TotalWeight;
+			const FStressMixEntry* Chosen = &Mix.Last();
+			for (const FStressMixEntry& Entry : Mix)
+			{
+				if (Pick < Entry.CumulativeWeight)
+				{
+					Chosen = &Entry;
+					break;
+				}
+			}
+
+			// Shallow-clone the params and salt them with a sequence number
+			// so the read-only dedup cache sees every submission as distinct
+			// work (tools ignore the extra field)
+			TSharedPtr<FJsonObject> CallParams = MakeShared<FJsonObject>();
+			if (Chosen->Params.IsValid())
+			{
+				CallParams->Values = Chosen->Params->Values;
+			}
+			CallParams->SetNumberField(TEXT("stress_seq"), static_cast<double>(++StressSequence));
+
+			const FGuid TaskId = TaskQueue->SubmitTask(Chosen->ToolName, CallParams, 0, EMCPTaskPriority::Normal);
+			if (TaskId.IsValid())
+			{
+				Submitted++;
+				TaskQueue->WaitForCompletion(TaskId, [Counters](TSharedPtr<FMCPAsyncTask> Task)
+				{
+					const bool bSucceeded = Task.IsValid() &&
+						Task->Status.Load() == EMCPTaskStatus::Completed && Task->Result.bSuccess;
+					(bSucceeded ? Counters->Completed : Counters->Failed)++;
+				});
+			}
+			else
+			{
+				SubmitRejected++;
+			}
+
+			NextDueSeconds += SubmitInterval;
+		}
+
+		// Once a second: sample queue depth and probe game-thread latency
+		// with a no-op round-trip - the time until the game thread services
+		// it is what an interactive editor operation would also wait
+		if (NowSeconds >= NextSampleSeconds)
+		{
+			int32 Pending = 0, Running = 0, CompletedStat = 0;
+			TaskQueue->GetStats(Pending, Running, CompletedStat);
+			StatSamples++;
+			PendingSum += Pending;
+			PendingMax = FMath::Max(PendingMax, Pending);
+			RunningMax = FMath::Max(RunningMax, Running);
+
+			const double ProbeSentSeconds = FPlatformTime::Seconds();
+			AsyncTask(ENamedThreads::GameThread, [Counters, ProbeSentSeconds]
+			{
+				const uint64 Micros = static_cast<uint64>(
+					(FPlatformTime::Seconds() - ProbeSentSeconds) * 1000000.0);
+				Counters->ProbeTotalMicros += Micros;
+				Counters->ProbeCount++;
+				if (Micros > Counters->ProbeMaxMicros.Load())
+				{
+					Counters->ProbeMaxMicros = Micros;
+				}
+			});
+
+			NextSampleSeconds += 1.0;
+		}
+
+		FPlatformProcess::SleepNoStats(0.002f);
+	}
+
+	// Drain: give in-flight work a bounded window to finish so the report
+	// reflects completions, not just submissions
+	const double DrainDeadline = FPlatformTime::Seconds() + StressDrainTimeoutSeconds;
+	while (Counters->Completed.Load() + Counters->Failed.Load() < Submitted &&
+		FPlatformTime::Seconds() < DrainDeadline)
+	{
+		FPlatformProcess::SleepNoStats(0.01f);
+	}
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+	const int32 Completed = Counters->Completed.Load();
+	const int32 Failed = Counters->Failed.Load();
+	const int32 ProbeCount = Counters->ProbeCount.Load();
+
+	TSharedPtr<FJsonObject> QueueJson = MakeShared<FJsonObject>();
+	QueueJson->SetNumberField(TEXT("max_pending"), PendingMax);
+	QueueJson->SetNumberField(TEXT("avg_pending"),
+		StatSamples > 0 ? static_cast<double>(PendingSum) / StatSamples : 0.0);
+	QueueJson->SetNumberField(TEXT("max_running"), RunningMax);
+
+	TSharedPtr<FJsonObject> GameThreadJson = MakeShared<FJsonObject>();
+	GameThreadJson->SetNumberField(TEXT("probe_count"), ProbeCount);
+	GameThreadJson->SetNumberField(TEXT("avg_probe_ms"),
+		ProbeCount > 0 ? Counters->ProbeTotalMicros.Load() / 1000.0 / ProbeCount : 0.0);
+	GameThreadJson->SetNumberField(TEXT("max_probe_ms"), Counters->ProbeMaxMicros.Load() / 1000.0);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("target_rate"), TargetRate);
+	ResultData->SetNumberField(TEXT("duration_seconds"), DurationSeconds);
+	ResultData->SetNumberField(TEXT("submitted"), Submitted);
+	ResultData->SetNumberField(TEXT("submit_rejected"), SubmitRejected);
+	ResultData->SetNumberField(TEXT("completed"), Completed);
+	ResultData->SetNumberField(TEXT("failed"), Failed);
+	ResultData->SetNumberField(TEXT("still_in_flight"), Submitted - Completed - Failed);
+	ResultData->SetNumberField(TEXT("achieved_rate"),
+		ElapsedSeconds > 0.0 ? Completed / ElapsedSeconds : 0.0);
+	ResultData->SetObjectField(TEXT("queue"), QueueJson);
+	ResultData->SetObjectField(TEXT("game_thread"), GameThreadJson);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Stress run complete: %d/%d completed at %.1f req/s (target %.1f)"),
+			Completed, Submitted,
+			ElapsedSeconds > 0.0 ? Completed / ElapsedSeconds : 0.0, TargetRate),
+		ResultData);
+}
@@ -0,0 +1,77 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../MCPToolBase.h"
+
+class FMCPToolRegistry;
+
+/**
+ * MCP Tool: Synthetic load generation for capacity testing
+ *
+ * Replays a caller-supplied request mix through the task queue at a target
+ * rate and reports achieved throughput, queue depth over the run, and
+ * game-thread responsiveness (measured by timing no-op round-trips to the
+ * game thread once a second). Used to validate plugin updates against real
+ * project data before rollout - a regression like new lock contention in
+ * the task queue shows up as achieved rate falling short of target or as
+ * probe latency climbing.
+ *
+ * Only registered when the editor runs with -UnrealClaudeStressTool; a
+ * production editor never exposes a load generator. The mix is restricted
+ * to read-only tools, and a per-submission sequence field is injected into
+ * each parameter set so the read-only dedup cache cannot collapse the run
+ * into a single task.
+ */
+class FMCPTool_StressTest : public FMCPToolBase
+{
+public:
+	FMCPTool_StressTest(FMCPToolRegistry* InRegistry)
+		: Registry(InRegistry)
+	{
+	}
+
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("stress_test");
+		Info.Description = TEXT(
+			"Generate synthetic load against the MCP tool pipeline (capacity testing).\n\n"
+			"Submits a weighted mix of read-only tool invocations through the task "
+			"queue at a target rate for a fixed duration, then reports achieved "
+			"throughput, queue depths sampled over the run, and game-thread probe "
+			"latency. Only available when the editor was launched with "
+			"-UnrealClaudeStressTool.\n\n"
+			"Must be run asynchronously (via task_submit) - the run itself occupies "
+			"one worker for its whole duration, so the effective pool for the "
+			"generated load is MaxConcurrentTasks minus one.\n\n"
+			"Example:\n"
+			"  task_submit(tool_name='stress_test', params={\n"
+			"    duration_seconds: 10, target_rate: 20,\n"
+			"    mix: [{tool: 'asset_search', params: {class_filter: 'Blueprint'}, weight: 3},\n"
+			"          {tool: 'get_level_actors', weight: 1}]})"
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("mix"), TEXT("array"),
+				TEXT("Request mix to replay: array of {tool, params (optional), weight "
+					"(optional, default 1)}. Every tool must be read-only."), true),
+			FMCPToolParameter(TEXT("target_rate"), TEXT("number"),
+				TEXT("Submissions per second to attempt (default: 20, max: 200)"), false, TEXT("20")),
+			FMCPToolParameter(TEXT("duration_seconds"), TEXT("number"),
+				TEXT("Seconds to generate load for (default: 10, max: 60)"), false, TEXT("10"))
+		};
+		// Modifying, not read-only: a load run is never deduplicated onto a
+		// previous run's result, and the journal records that it happened
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	/** Paces and sleeps on a worker; refuses to run on the game thread */
+	virtual bool IsThreadSafe() const override { return true; }
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Registry executing the replayed mix (raw pointer - registry outlives tools) */
+	FMCPToolRegistry* Registry;
+};
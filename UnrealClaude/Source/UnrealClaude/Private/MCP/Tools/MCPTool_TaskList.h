@@ -42,6 +42,8 @@ public:
 		return Info;
 	}
 
+	/** Task queue state is lock-protected */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override
 	{
 		if (!TaskQueue.IsValid())
@@ -38,6 +38,8 @@ public:
 		return Info;
 	}
 
+	/** Task queue state is lock-protected */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override
 	{
 		if (!TaskQueue.IsValid())
@@ -77,7 +79,20 @@ public:
 					*FMCPAsyncTask::StatusToString(Status)));
 		}
 
-		// Build response with full result
+		// Completed results were serialized once, at completion, on the worker
+		// thread; hand the shared buffer through instead of rebuilding and
+		// re-serializing the envelope on every poll
+		if (Task->SerializedResult.IsValid())
+		{
+			FMCPToolResult Result;
+			Result.bSuccess = Task->Result.bSuccess;
+			Result.Message = Task->Result.Message;
+			Result.PrebuiltBody = Task->SerializedResult;
+			return Result;
+		}
+
+		// Fallback for tasks finalized without a serialized buffer
+		// (e.g. cancelled during queue shutdown)
 		TSharedPtr<FJsonObject> ResultData = Task->ToJson(true); // Include full result
 
 		FMCPToolResult Result;
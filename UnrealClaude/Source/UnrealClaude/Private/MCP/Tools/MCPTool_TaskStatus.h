@@ -33,16 +33,28 @@ public:
 			"- 'failed': Task encountered an error\n"
 			"- 'cancelled': Task was cancelled\n"
 			"- 'timed_out': Task exceeded its timeout\n\n"
-			"For completed tasks, use task_result to get the full output."
+			"For completed tasks, use task_result to get the full output.\n\n"
+			"Phase timing: queue_wait_ms is time spent queued before a worker "
+			"picked the task up, game_thread_entered_at marks when tool code "
+			"first reached the game thread, and game_thread_ms is the frame "
+			"time the task actually consumed (cycle-counter measured) - the "
+			"number to watch when editor responsiveness matters.\n\n"
+			"Streaming tools (execute_script) append output incrementally while "
+			"running; pass the output_cursor from the previous poll to receive "
+			"only what was produced since."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("task_id"), TEXT("string"),
-				TEXT("Task ID returned from task_submit"), true)
+				TEXT("Task ID returned from task_submit"), true),
+			FMCPToolParameter(TEXT("output_cursor"), TEXT("number"),
+				TEXT("Character cursor into the task's incremental output; 0 reads from the start"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
+	/** Task queue state is lock-protected */
+	virtual bool IsThreadSafe() const override { return true; }
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override
 	{
 		if (!TaskQueue.IsValid())
@@ -76,6 +88,17 @@ public:
 		// Build response
 		TSharedPtr<FJsonObject> ResultData = Task->ToJson(false); // Don't include full result
 
+		// Incremental output past the caller's cursor (empty when none yet)
+		double CursorDouble = 0.0;
+		Params->TryGetNumberField(TEXT("output_cursor"), CursorDouble);
+		int32 NextCursor = 0;
+		const FString NewOutput = Task->ReadPartialOutput(static_cast<int32>(CursorDouble), NextCursor);
+		if (!NewOutput.IsEmpty() || NextCursor > 0)
+		{
+			ResultData->SetStringField(TEXT("output"), NewOutput);
+		}
+		ResultData->SetNumberField(TEXT("output_cursor"), NextCursor);
+
 		FString StatusStr = FMCPAsyncTask::StatusToString(Task->Status.Load());
 		return FMCPToolResult::Success(
 			FString::Printf(TEXT("Task %s: %s"), *TaskIdString, *StatusStr),
@@ -33,6 +33,15 @@ public:
 			"1. Call task_submit with tool name and parameters\n"
 			"2. Poll task_status with the returned task_id\n"
 			"3. When status is 'completed', call task_result to get output\n\n"
+			"Instead of polling, HTTP clients can long-poll "
+			"GET /mcp/task/wait?task_id=...&timeout_ms=... - the response is held "
+			"open and completes with the full result the moment the task finishes.\n\n"
+			"Dependent plans: pass depends_on with previously returned task_ids to "
+			"submit a whole plan in one burst (load -> modify -> compile -> query). "
+			"Independent branches run concurrently; each dependent starts the instant "
+			"its prerequisites complete, so the plan finishes in critical-path time "
+			"instead of one round-trip per step. If a prerequisite fails, its "
+			"dependents fail with it.\n\n"
 			"Example:\n"
 			"  task_submit(tool_name='asset_search', params={class_filter: 'Blueprint'})\n"
 			"  -> Returns: {task_id: '...'}\n"
@@ -47,7 +56,18 @@ public:
 			FMCPToolParameter(TEXT("params"), TEXT("object"),
 				TEXT("Parameters to pass to the tool (same as calling the tool directly)"), false),
 			FMCPToolParameter(TEXT("timeout_ms"), TEXT("number"),
-				TEXT("Custom timeout in milliseconds (default: 120000 = 2 minutes)"), false, TEXT("120000"))
+				TEXT("Custom timeout in milliseconds (default: 120000 = 2 minutes)"), false, TEXT("120000")),
+			FMCPToolParameter(TEXT("priority"), TEXT("string"),
+				TEXT("Scheduling priority: 'high', 'normal', or 'low' (default: normal). "
+					"High priority tasks are dispatched before queued normal/low work."), false, TEXT("normal")),
+			FMCPToolParameter(TEXT("defer_gc"), TEXT("boolean"),
+				TEXT("Defer garbage collection while this task runs - for batch work like mass "
+					"spawns, deletes or bulk loads, one collection runs at task end instead of "
+					"GC pauses interleaving with the batch. Skipped when memory is tight."), false, TEXT("false")),
+			FMCPToolParameter(TEXT("depends_on"), TEXT("array"),
+				TEXT("Task IDs (from earlier task_submit calls) that must complete before this "
+					"task runs. The task is parked until all prerequisites finish and fails if "
+					"any of them do."), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
@@ -83,12 +103,42 @@ public:
 		// Extract timeout
 		uint32 TimeoutMs = static_cast<uint32>(ExtractOptionalNumber<int32>(Params, TEXT("timeout_ms"), 120000));
 
-		// Submit the task
-		FGuid TaskId = TaskQueue->SubmitTask(ToolName, ToolParams, TimeoutMs);
+		// Extract priority
+		EMCPTaskPriority Priority = FMCPAsyncTask::PriorityFromString(
+			ExtractOptionalString(Params, TEXT("priority"), TEXT("normal")));
+
+		// Extract GC deferral opt-in for batch work
+		bool bDeferGC = false;
+		Params->TryGetBoolField(TEXT("defer_gc"), bDeferGC);
+
+		// Extract prerequisite task IDs for dependent plans
+		TArray<FGuid> Prerequisites;
+		const TArray<TSharedPtr<FJsonValue>>* DependsOn = nullptr;
+		if (Params->TryGetArrayField(TEXT("depends_on"), DependsOn))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *DependsOn)
+			{
+				FGuid PrereqId;
+				if (!Value.IsValid() || !FGuid::Parse(Value->AsString(), PrereqId))
+				{
+					return FMCPToolResult::Error(
+						FString::Printf(TEXT("Invalid task ID in depends_on: '%s'"),
+							Value.IsValid() ? *Value->AsString() : TEXT("")));
+				}
+				Prerequisites.Add(PrereqId);
+			}
+		}
+
+		// Submit the task; parameters are validated here, once, and the task
+		// skips revalidation when it runs
+		FString SubmitError;
+		FGuid TaskId = TaskQueue->SubmitTask(ToolName, ToolParams, TimeoutMs, Priority, bDeferGC, Prerequisites, &SubmitError);
 
 		if (!TaskId.IsValid())
 		{
-			return FMCPToolResult::Error(TEXT("Failed to submit task - queue may be at capacity or tool not found"));
+			return FMCPToolResult::Error(SubmitError.IsEmpty()
+				? FString(TEXT("Failed to submit task - queue may be at capacity, tool not found, or a depends_on task ID is unknown"))
+				: SubmitError);
 		}
 
 		// Return task ID
@@ -96,6 +146,7 @@ public:
 		ResultData->SetStringField(TEXT("task_id"), TaskId.ToString());
 		ResultData->SetStringField(TEXT("tool_name"), ToolName);
 		ResultData->SetStringField(TEXT("status"), TEXT("pending"));
+		ResultData->SetStringField(TEXT("priority"), FMCPAsyncTask::PriorityToString(Priority));
 		ResultData->SetNumberField(TEXT("timeout_ms"), TimeoutMs);
 
 		return FMCPToolResult::Success(
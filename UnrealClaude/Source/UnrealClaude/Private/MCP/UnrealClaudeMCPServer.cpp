@@ -2,8 +2,19 @@
 
 #include "UnrealClaudeMCPServer.h"
 #include "MCPToolRegistry.h"
+#include "MCPToolMetrics.h"
+#include "MCPTaskQueue.h"
+#include "MCPStreamWriter.h"
+#include "MCPAssetNameIndex.h"
+#include "MCPAssetWatchStore.h"
+#include "MCPAdmissionController.h"
+#include "MCPMemoryStats.h"
+#include "MCPLocalPipeTransport.h"
+#include "MCPRequestRecorder.h"
+#include "JsonUtils.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeConstants.h"
+#include "UnrealClaudeSettings.h"
 #include "HttpServerModule.h"
 #include "IHttpRouter.h"
 #include "HttpServerRequest.h"
@@ -11,10 +22,18 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Misc/Compression.h"
+#include "Misc/SecureHash.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeExit.h"
 
 FUnrealClaudeMCPServer::FUnrealClaudeMCPServer()
 	: bIsRunning(false)
 	, ServerPort(UnrealClaudeConstants::MCPServer::DefaultPort)
+	, RequestsServed(0)
+	, ClientCloseRequests(0)
 {
 	ToolRegistry = MakeShared<FMCPToolRegistry>();
 }
@@ -59,10 +78,54 @@ bool FUnrealClaudeMCPServer::Start(uint32 Port)
 		ToolRegistry->StartTaskQueue();
 	}
 
+	// Subscribe the asset name index to registry events now (cheap); its
+	// full build is deferred to the first pattern search
+	FMCPAssetNameIndex::Get().BindRegistryEvents();
+
+	// Asset watches (asset_watch tool) consume the same events; the
+	// handlers are no-ops until a watch is registered
+	FMCPAssetWatchStore::Get().BindRegistryEvents();
+
+	// Optional local pipe transport: same tool execution, no TCP stack.
+	// Start() refuses on platforms without named pipe support
+	if (UUnrealClaudeSettings::Get().bEnableLocalPipeTransport)
+	{
+		PipeTransport = MakeUnique<FMCPLocalPipeTransport>(ToolRegistry);
+		if (!PipeTransport->Start(ServerPort))
+		{
+			PipeTransport.Reset();
+		}
+	}
+
+	// Diagnostic traffic capture for the offline replay benchmark
+	if (UUnrealClaudeSettings::Get().bRecordToolTraffic)
+	{
+		FMCPRequestRecorder::Get().StartRecording();
+	}
+
+	// Tool construction is lazy; warm the hot set and freeze the manifest on
+	// a deferred tick so neither editor boot nor an agent's first call pays
+	// for it. A /mcp/tools request racing this builds the manifest on demand
+	// (which itself materializes every descriptor).
+	PreWarmTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[this](float)
+	{
+		if (ToolRegistry.IsValid())
+		{
+			ToolRegistry->PreWarmTools(UnrealClaudeConstants::MCPServer::HotTools);
+		}
+		BuildToolManifestCache();
+		PreWarmTickerHandle.Reset();
+		return false;
+	}), UnrealClaudeConstants::MCPServer::ToolPreWarmDelaySeconds);
+
 	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Server started on http://localhost:%d"), ServerPort);
 	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/tools      - List available tools"));
 	UE_LOG(LogUnrealClaude, Log, TEXT("  POST /mcp/tool/{name} - Execute a tool"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  POST /mcp/batch      - Execute a batch of tool invocations"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/task/wait  - Long-poll for an async task result"));
 	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/status     - Server status"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/metrics    - Per-tool latency/throughput metrics"));
 
 	return true;
 }
@@ -74,6 +137,21 @@ void FUnrealClaudeMCPServer::Stop()
 		return;
 	}
 
+	// Drop a pre-warm that has not fired yet; it captures this
+	if (PreWarmTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PreWarmTickerHandle);
+		PreWarmTickerHandle.Reset();
+	}
+
+	// The pipe transport dispatches into the registry; stop it before the
+	// task queue so no frame is mid-execution while the queue drains
+	if (PipeTransport.IsValid())
+	{
+		PipeTransport->Shutdown();
+		PipeTransport.Reset();
+	}
+
 	// Stop the async task queue first
 	if (ToolRegistry.IsValid())
 	{
@@ -91,12 +169,26 @@ void FUnrealClaudeMCPServer::Stop()
 		{
 			HttpRouter->UnbindRoute(ExecuteToolHandle);
 		}
+		if (BatchExecuteHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(BatchExecuteHandle);
+		}
+		if (WaitTaskHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(WaitTaskHandle);
+		}
 		if (StatusHandle.IsValid())
 		{
 			HttpRouter->UnbindRoute(StatusHandle);
 		}
+		if (MetricsHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(MetricsHandle);
+		}
 	}
 
+	FMCPRequestRecorder::Get().StopRecording();
+
 	bIsRunning = false;
 	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Server stopped"));
 }
@@ -122,15 +214,36 @@ void FUnrealClaudeMCPServer::SetupRoutes()
 		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleExecuteTool)
 	);
 
+	// POST /mcp/batch - Execute an ordered array of tool invocations
+	BatchExecuteHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/batch")),
+		EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleBatchExecute)
+	);
+
+	// GET /mcp/task/wait - Long-poll for a task result
+	WaitTaskHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/task/wait")),
+		EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleWaitTask)
+	);
+
 	// GET /mcp/status - Server status
 	StatusHandle = HttpRouter->BindRoute(
 		FHttpPath(TEXT("/mcp/status")),
 		EHttpServerRequestVerbs::VERB_GET,
 		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleStatus)
 	);
+
+	// GET /mcp/metrics - Per-tool latency/throughput metrics
+	MetricsHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/metrics")),
+		EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleMetrics)
+	);
 }
 
-bool FUnrealClaudeMCPServer::HandleListTools(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+void FUnrealClaudeMCPServer::BuildToolManifestCache()
 {
 	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
 
@@ -176,53 +289,105 @@ bool FUnrealClaudeMCPServer::HandleListTools(const FHttpServerRequest& Request,
 
 	ResponseJson->SetArrayField(TEXT("tools"), ToolsArray);
 
-	FString JsonString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+	FJsonUtils::StringifyUtf8(ResponseJson.ToSharedRef(), CachedToolManifest);
 
-	OnComplete(CreateJsonResponse(JsonString));
+	FMD5 Md5;
+	Md5.Update(CachedToolManifest.GetData(), CachedToolManifest.Num());
+	FMD5Hash Hash;
+	Hash.Set(Md5);
+	ToolManifestETag = FString::Printf(TEXT("\"%s\""), *LexToString(Hash));
+}
+
+bool FUnrealClaudeMCPServer::HandleListTools(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	RecordHttpRequest(Request);
+
+	// Requests beating the deferred pre-warm tick build the manifest here
+	if (CachedToolManifest.Num() == 0)
+	{
+		BuildToolManifestCache();
+	}
+
+	// Header keys arrive in varying case depending on the client
+	for (const auto& HeaderPair : Request.Headers)
+	{
+		if (HeaderPair.Key.Equals(TEXT("If-None-Match"), ESearchCase::IgnoreCase))
+		{
+			if (HeaderPair.Value.Contains(ToolManifestETag))
+			{
+				TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(TArray<uint8>(), TEXT("application/json"));
+				Response->Code = EHttpServerResponseCodes::NotModified;
+				Response->Headers.Add(TEXT("ETag"), { ToolManifestETag });
+				Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+				OnComplete(MoveTemp(Response));
+				return true;
+			}
+			break;
+		}
+	}
+
+	// The router takes ownership of the body, so hand it a copy of the cache
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(TArray<uint8>(CachedToolManifest), TEXT("application/json"));
+	Response->Code = EHttpServerResponseCodes::Ok;
+	Response->Headers.Add(TEXT("ETag"), { ToolManifestETag });
+	Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+	OnComplete(MoveTemp(Response));
 	return true;
 }
 
 bool FUnrealClaudeMCPServer::HandleExecuteTool(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	// Extract tool name from path: /mcp/tool/{name}
-	FString RelativePath = Request.RelativePath.GetPath();
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealClaudeMCPServer::HandleExecuteTool);
+	RecordHttpRequest(Request);
 
-	// Parse tool name from path
-	FString ToolName;
-	if (RelativePath.StartsWith(TEXT("/mcp/tool/")))
+	// Backpressure: shed the request before any parsing when the server is
+	// over its in-flight window, the task queue is deep, or MCP work has
+	// exhausted its game-thread budget for this second
+	if (!TryAdmitRequest())
 	{
-		ToolName = RelativePath.RightChop(10); // Remove "/mcp/tool/"
+		OnComplete(CreateBackpressureResponse());
+		return true;
 	}
-	else if (RelativePath.StartsWith(TEXT("/")))
+	ON_SCOPE_EXIT { FMCPAdmissionController::Get().Release(); };
+
+	// Slice the tool name from /mcp/tool/{name} in place: fixed-prefix
+	// comparisons on a view of the router's path instead of allocating
+	// substring copies on every request
+	const FString RelativePath = Request.RelativePath.GetPath();
+	FStringView ToolNameView(RelativePath);
+	if (ToolNameView.StartsWith(TEXTVIEW("/mcp/tool/")))
 	{
-		ToolName = RelativePath.RightChop(1);
+		ToolNameView.RightChopInline(10);
 	}
-	else
+	else if (ToolNameView.StartsWith(TEXT('/')))
 	{
-		ToolName = RelativePath;
+		ToolNameView.RightChopInline(1);
 	}
 
-	if (ToolName.IsEmpty())
+	if (ToolNameView.IsEmpty())
 	{
 		OnComplete(CreateErrorResponse(TEXT("Tool name not specified. Use POST /mcp/tool/{toolname}"), EHttpServerResponseCodes::BadRequest));
 		return true;
 	}
 
-	// Parse JSON body for parameters
+	// Per-hop trace for this request: parse, execute and serialize are timed
+	// below and ride back on X-MCP-Trace-Id / Server-Timing headers, so a
+	// slow direct call self-reports which hop ate the time (queued tasks
+	// report the same breakdown through their task JSON, keyed by task id)
+	FMCPRequestTrace Trace;
+	Trace.TraceId = FGuid::NewGuid();
+	const uint64 ParseStartCycles = FPlatformTime::Cycles64();
+
+	// Parse JSON body for parameters. UTF-8 is consumed in place from the
+	// request buffer, so megabyte script payloads never exist as a
+	// null-terminated scratch copy or a transient wide string
 	TSharedPtr<FJsonObject> ParamsJson;
 	if (Request.Body.Num() > 0)
 	{
-		// Ensure null-termination for safe string conversion
-		TArray<uint8> NullTerminatedBody = Request.Body;
-		NullTerminatedBody.Add(0);
-		FString BodyString = UTF8_TO_TCHAR(reinterpret_cast<const char*>(NullTerminatedBody.GetData()));
-
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyString);
-		if (!FJsonSerializer::Deserialize(Reader, ParamsJson) || !ParamsJson.IsValid())
+		ParamsJson = FJsonUtils::ParseUtf8(Request.Body);
+		if (!ParamsJson.IsValid())
 		{
-			UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to parse JSON body: %s"), *BodyString);
+			UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to parse JSON body (%d bytes)"), Request.Body.Num());
 			OnComplete(CreateErrorResponse(TEXT("Invalid JSON body"), EHttpServerResponseCodes::BadRequest));
 			return true;
 		}
@@ -232,6 +397,12 @@ bool FUnrealClaudeMCPServer::HandleExecuteTool(const FHttpServerRequest& Request
 		ParamsJson = MakeShared<FJsonObject>();
 	}
 
+	Trace.ParseMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ParseStartCycles);
+
+	// The id travels with the params the same way _task_id does for queued
+	// work, so tool-side logging can stamp it
+	ParamsJson->SetStringField(TEXT("_trace_id"), Trace.TraceId.ToString());
+
 	// Execute tool
 	if (!ToolRegistry.IsValid())
 	{
@@ -239,7 +410,80 @@ bool FUnrealClaudeMCPServer::HandleExecuteTool(const FHttpServerRequest& Request
 		return true;
 	}
 
+	// Dispatch resolves on the view alone (hashed probe of the registry's
+	// live map); the name is materialized once here for the execution,
+	// metrics and logging paths that key on FString
+	IMCPTool* Tool = ToolRegistry->FindToolByPathSegment(ToolNameView);
+	const FString ToolName(ToolNameView);
+
+	// Streaming path: tools that opt in serialize their response body
+	// incrementally through FMCPJsonStreamWriter instead of building a full
+	// JSON document. Chunks are flushed into the response body as they are
+	// produced, so multi-megabyte payloads never exist as one wide string.
+	if (Tool && Tool->SupportsStreaming())
+	{
+		TArray<uint8> ResponseBody;
+		bool bStreamSuccess = false;
+		{
+			// Serialization is interleaved with execution on this path, so
+			// the exec hop covers both and the serialize hop reads zero
+			const uint64 ExecStartCycles = FPlatformTime::Cycles64();
+			FMCPJsonStreamWriter Writer([&ResponseBody](const uint8* Data, int32 Num)
+			{
+				ResponseBody.Append(Data, Num);
+			});
+			bStreamSuccess = Tool->ExecuteStreaming(ParamsJson.ToSharedRef(), Writer);
+			Trace.ExecuteMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ExecStartCycles);
+		}
+
+		FMCPToolMetrics::Get().RecordTransfer(ToolName, Request.Body.Num(), ResponseBody.Num());
+		FMCPRequestRecorder::Get().Record(ToolName, Request.Body, ResponseBody);
+
+		CompleteMaybeCompressed(Request, OnComplete, MoveTemp(ResponseBody), TEXT("application/json"),
+			bStreamSuccess ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::BadRequest, Trace);
+		return true;
+	}
+
+	const uint64 ExecStartCycles = FPlatformTime::Cycles64();
 	FMCPToolResult Result = ToolRegistry->ExecuteTool(ToolName, ParamsJson.ToSharedRef());
+	Trace.ExecuteMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ExecStartCycles);
+
+	// Binary path: tools may return raw bytes (e.g. JPEG screenshots) that
+	// go over the wire as-is, skipping base64 encoding and the JSON envelope
+	if (Result.HasBinaryPayload())
+	{
+		FMCPToolMetrics::Get().RecordTransfer(ToolName, Request.Body.Num(), Result.BinaryData.Num());
+		FMCPRequestRecorder::Get().Record(ToolName, Request.Body, Result.BinaryData);
+
+		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Result.BinaryData), Result.BinaryContentType);
+		Response->Code = EHttpServerResponseCodes::Ok;
+		Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+		Response->Headers.Add(TEXT("X-MCP-Trace-Id"), { Trace.TraceId.ToString() });
+		Response->Headers.Add(TEXT("Server-Timing"), { Trace.ToServerTimingValue() });
+		if (!Result.Message.IsEmpty())
+		{
+			Response->Headers.Add(TEXT("X-MCP-Message"), { Result.Message });
+		}
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	// Pre-serialized path: some results (completed task fetches) carry their
+	// envelope as an immutable shared buffer serialized once by the producer.
+	// The single copy below is the ownership handoff the router requires, the
+	// same deal the cached tool manifest gets - no JSON rebuild, no UTF-16
+	// round trip.
+	if (Result.HasPrebuiltBody())
+	{
+		FMCPToolMetrics::Get().RecordTransfer(ToolName, Request.Body.Num(), Result.PrebuiltBody->Num());
+		FMCPRequestRecorder::Get().Record(ToolName, Request.Body, *Result.PrebuiltBody);
+
+		// Serialize reads zero here: the producer paid it when the buffer
+		// was built, and that cost shows in the exec hop
+		CompleteMaybeCompressed(Request, OnComplete, TArray<uint8>(*Result.PrebuiltBody), TEXT("application/json"),
+			Result.bSuccess ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::BadRequest, Trace);
+		return true;
+	}
 
 	// Build response
 	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
@@ -251,20 +495,305 @@ bool FUnrealClaudeMCPServer::HandleExecuteTool(const FHttpServerRequest& Request
 		ResponseJson->SetObjectField(TEXT("data"), Result.Data);
 	}
 
-	FString JsonString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+	// UTF-8 written in one pass straight into the wire buffer - no UTF-16
+	// intermediary, no transcode
+	TArray<uint8> BodyBytes;
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealClaudeMCPServer::SerializeResponse);
+		const uint64 SerializeStartCycles = FPlatformTime::Cycles64();
+		FJsonUtils::StringifyUtf8(ResponseJson.ToSharedRef(), BodyBytes);
+		Trace.SerializeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SerializeStartCycles);
+	}
+
+	// Big document trees die right here once serialized. Dropping the last
+	// reference on the thread pool frees the whole tree in one release from
+	// this thread's point of view instead of thousands of inline node frees
+	if (BodyBytes.Num() >= UnrealClaudeConstants::MCPServer::AsyncJsonReleaseMinBytes)
+	{
+		Result.Data.Reset(); // the response tree holds the surviving reference
+		FJsonUtils::ReleaseTreeAsync(MoveTemp(ResponseJson));
+	}
+	if (Request.Body.Num() >= UnrealClaudeConstants::MCPServer::AsyncJsonReleaseMinBytes)
+	{
+		FJsonUtils::ReleaseTreeAsync(MoveTemp(ParamsJson));
+	}
+
+	FMCPToolMetrics::Get().RecordTransfer(ToolName, Request.Body.Num(), BodyBytes.Num());
+	FMCPRequestRecorder::Get().Record(ToolName, Request.Body, BodyBytes);
 
 	EHttpServerResponseCodes Code = Result.bSuccess ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::BadRequest;
-	OnComplete(CreateJsonResponse(JsonString, Code));
+	CompleteMaybeCompressed(Request, OnComplete, MoveTemp(BodyBytes), TEXT("application/json"), Code, Trace);
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::HandleBatchExecute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealClaudeMCPServer::HandleBatchExecute);
+	RecordHttpRequest(Request);
+
+	// One admission covers the whole batch - the invocations inside run
+	// sequentially, so the batch occupies a single in-flight slot
+	if (!TryAdmitRequest())
+	{
+		OnComplete(CreateBackpressureResponse());
+		return true;
+	}
+	ON_SCOPE_EXIT { FMCPAdmissionController::Get().Release(); };
+
+	// Parse JSON body: { "invocations": [ { "tool": "name", "params": { ... } }, ... ],
+	//                    "stop_on_error": false }
+	if (Request.Body.Num() == 0)
+	{
+		OnComplete(CreateErrorResponse(TEXT("Missing request body"), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	// Batch bodies carry every invocation's params, so the in-place UTF-8
+	// parse matters here as much as on the single-tool path
+	TSharedPtr<FJsonObject> BatchJson = FJsonUtils::ParseUtf8(Request.Body);
+	if (!BatchJson.IsValid())
+	{
+		OnComplete(CreateErrorResponse(TEXT("Invalid JSON body"), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Invocations;
+	if (!BatchJson->TryGetArrayField(TEXT("invocations"), Invocations) || Invocations->Num() == 0)
+	{
+		OnComplete(CreateErrorResponse(TEXT("Missing or empty 'invocations' array"), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	bool bStopOnError = false;
+	BatchJson->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+	if (!ToolRegistry.IsValid())
+	{
+		OnComplete(CreateErrorResponse(TEXT("Tool registry not initialized"), EHttpServerResponseCodes::ServerError));
+		return true;
+	}
+
+	// Execute invocations in order. HTTP request handlers run on the game
+	// thread, so the whole batch happens in one game-thread hop without
+	// per-call marshaling through the task queue.
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	ResultsArray.Reserve(Invocations->Num());
+	int32 SucceededCount = 0;
+
+	for (int32 Index = 0; Index < Invocations->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* InvocationObj;
+		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+		ResultJson->SetNumberField(TEXT("index"), Index);
+
+		FString ToolName;
+		if (!(*Invocations)[Index]->TryGetObject(InvocationObj) ||
+			!(*InvocationObj)->TryGetStringField(TEXT("tool"), ToolName) || ToolName.IsEmpty())
+		{
+			ResultJson->SetBoolField(TEXT("success"), false);
+			ResultJson->SetStringField(TEXT("message"), TEXT("Invocation must be an object with a 'tool' field"));
+			ResultsArray.Add(MakeShared<FJsonValueObject>(ResultJson));
+			if (bStopOnError)
+			{
+				break;
+			}
+			continue;
+		}
+
+		const TSharedPtr<FJsonObject>* ParamsObj;
+		TSharedRef<FJsonObject> Params = (*InvocationObj)->TryGetObjectField(TEXT("params"), ParamsObj)
+			? (*ParamsObj).ToSharedRef()
+			: MakeShared<FJsonObject>();
+
+		FMCPToolResult Result = ToolRegistry->ExecuteTool(ToolName, Params);
+
+		// The batch envelope embeds result objects, so a pre-serialized body
+		// has to be parsed back into JSON here; only the direct tool route
+		// hands the buffer to the socket untouched
+		if (Result.HasPrebuiltBody() && !Result.Data.IsValid())
+		{
+			FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Result.PrebuiltBody->GetData()), Result.PrebuiltBody->Num());
+			TSharedPtr<FJsonObject> Envelope;
+			TSharedRef<TJsonReader<>> EnvelopeReader = TJsonReaderFactory<>::Create(FString(Converter.Length(), Converter.Get()));
+			if (FJsonSerializer::Deserialize(EnvelopeReader, Envelope) && Envelope.IsValid())
+			{
+				const TSharedPtr<FJsonObject>* DataObj;
+				if (Envelope->TryGetObjectField(TEXT("data"), DataObj))
+				{
+					Result.Data = *DataObj;
+				}
+			}
+		}
+
+		ResultJson->SetStringField(TEXT("tool"), ToolName);
+		ResultJson->SetBoolField(TEXT("success"), Result.bSuccess);
+		ResultJson->SetStringField(TEXT("message"), Result.Message);
+		if (Result.Data.IsValid())
+		{
+			ResultJson->SetObjectField(TEXT("data"), Result.Data);
+		}
+		ResultsArray.Add(MakeShared<FJsonValueObject>(ResultJson));
+
+		if (Result.bSuccess)
+		{
+			SucceededCount++;
+		}
+		else if (bStopOnError)
+		{
+			break;
+		}
+	}
+
+	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+	ResponseJson->SetBoolField(TEXT("success"), SucceededCount == Invocations->Num());
+	ResponseJson->SetNumberField(TEXT("total"), Invocations->Num());
+	ResponseJson->SetNumberField(TEXT("succeeded"), SucceededCount);
+	ResponseJson->SetArrayField(TEXT("results"), ResultsArray);
+
+	// UTF-8 written in one pass straight into the wire buffer
+	TArray<uint8> BodyBytes;
+	FJsonUtils::StringifyUtf8(ResponseJson.ToSharedRef(), BodyBytes);
+
+	// Batch envelopes embed every per-call result, so the tree that dies
+	// here can be the sum of several large tool responses
+	if (BodyBytes.Num() >= UnrealClaudeConstants::MCPServer::AsyncJsonReleaseMinBytes)
+	{
+		ResultsArray.Reset(); // inner results stay alive through the envelope
+		FJsonUtils::ReleaseTreeAsync(MoveTemp(ResponseJson));
+		FJsonUtils::ReleaseTreeAsync(MoveTemp(BatchJson));
+	}
+
+	CompleteMaybeCompressed(Request, OnComplete, MoveTemp(BodyBytes), TEXT("application/json"),
+		EHttpServerResponseCodes::Ok);
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::HandleWaitTask(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealClaudeMCPServer::HandleWaitTask);
+	RecordHttpRequest(Request);
+
+	const FString* TaskIdParam = Request.QueryParams.Find(TEXT("task_id"));
+	FGuid TaskId;
+	if (!TaskIdParam || !FGuid::Parse(*TaskIdParam, TaskId))
+	{
+		OnComplete(CreateErrorResponse(TEXT("Missing or invalid 'task_id' query parameter"), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	if (!ToolRegistry.IsValid() || !ToolRegistry->GetTaskQueue())
+	{
+		OnComplete(CreateErrorResponse(TEXT("Task queue not initialized"), EHttpServerResponseCodes::ServerError));
+		return true;
+	}
+	TSharedPtr<FMCPTaskQueue> TaskQueue = ToolRegistry->GetTaskQueue();
+
+	uint32 WaitTimeoutMs = UnrealClaudeConstants::MCPServer::TaskWaitDefaultTimeoutMs;
+	if (const FString* TimeoutParam = Request.QueryParams.Find(TEXT("timeout_ms")))
+	{
+		WaitTimeoutMs = FMath::Clamp<uint32>(FCString::Atoi(**TimeoutParam), 1,
+			UnrealClaudeConstants::MCPServer::TaskWaitMaxTimeoutMs);
+	}
+
+	// The completion waiter and the wait deadline race to finish the held
+	// response; this flag makes whichever fires second a no-op
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> bResponded = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+
+	// Runs on the game thread. A finished task replies with the same
+	// immutable pre-serialized envelope task_result serves (the single copy
+	// is the router's ownership handoff); a wait that hit its deadline
+	// replies with the current status so the client just re-issues the wait -
+	// worst case degrades to one slow poll, never a 250ms spin.
+	auto Respond = [OnComplete, bResponded](TSharedPtr<FMCPAsyncTask> Task, bool bWaitTimedOut)
+	{
+		if (bResponded->Exchange(true))
+		{
+			return;
+		}
+
+		TUniquePtr<FHttpServerResponse> Response;
+		if (Task.IsValid() && Task->IsComplete() && Task->SerializedResult.IsValid())
+		{
+			Response = FHttpServerResponse::Create(TArray<uint8>(*Task->SerializedResult), TEXT("application/json"));
+			Response->Code = Task->Result.bSuccess ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::BadRequest;
+		}
+		else
+		{
+			TSharedPtr<FJsonObject> Envelope = MakeShared<FJsonObject>();
+			Envelope->SetBoolField(TEXT("success"), true);
+			Envelope->SetStringField(TEXT("message"), bWaitTimedOut
+				? TEXT("Wait window elapsed before the task completed - re-issue the wait")
+				: TEXT("Task is not complete"));
+			Envelope->SetBoolField(TEXT("wait_timed_out"), bWaitTimedOut);
+			if (Task.IsValid())
+			{
+				Envelope->SetObjectField(TEXT("data"), Task->ToJson(false));
+			}
+
+			FString JsonString;
+			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+			FJsonSerializer::Serialize(Envelope.ToSharedRef(), Writer);
+			Response = FHttpServerResponse::Create(JsonString, TEXT("application/json"));
+			Response->Code = EHttpServerResponseCodes::Ok;
+		}
+
+		Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+		OnComplete(MoveTemp(Response));
+	};
+
+	// Park the response on the task's completion waiter. The callback fires
+	// on the worker that finalized the task, so completion hops to the game
+	// thread like every other response path; an already-terminal task fires
+	// synchronously right here on the game thread.
+	const bool bKnown = TaskQueue->WaitForCompletion(TaskId, [Respond](TSharedPtr<FMCPAsyncTask> Task)
+	{
+		if (IsInGameThread())
+		{
+			Respond(Task, false);
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, [Respond, Task]()
+			{
+				Respond(Task, false);
+			});
+		}
+	});
+
+	if (!bKnown)
+	{
+		// The waiter was never registered, so the response flag is untouched
+		OnComplete(CreateErrorResponse(FString::Printf(TEXT("Task not found: %s"), *TaskId.ToString()),
+			EHttpServerResponseCodes::NotFound));
+		return true;
+	}
+
+	// Bound the hold with a one-shot game-thread ticker. A stale ticker after
+	// an early completion just loses the responded-flag race.
+	if (!bResponded->Load())
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[Respond, TaskQueue, TaskId](float)
+		{
+			Respond(TaskQueue->GetTask(TaskId), true);
+			return false;
+		}), WaitTimeoutMs / 1000.0f);
+	}
+
 	return true;
 }
 
 bool FUnrealClaudeMCPServer::HandleStatus(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
+	RecordHttpRequest(Request);
+
 	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
 
 	ResponseJson->SetStringField(TEXT("status"), TEXT("running"));
+	// Explicit readiness flag for clients polling across the deferred module
+	// startup: before the deferred pass runs, this port refuses connections;
+	// once it answers, the server is fully routed and ready
+	ResponseJson->SetBoolField(TEXT("ready"), true);
 	ResponseJson->SetNumberField(TEXT("port"), ServerPort);
 	ResponseJson->SetStringField(TEXT("version"), TEXT("1.0.0"));
 	ResponseJson->SetNumberField(TEXT("toolCount"), ToolRegistry.IsValid() ? ToolRegistry->GetAllTools().Num() : 0);
@@ -287,6 +816,21 @@ bool FUnrealClaudeMCPServer::HandleStatus(const FHttpServerRequest& Request, con
 	ResponseJson->SetStringField(TEXT("projectName"), FApp::GetProjectName());
 	ResponseJson->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
 
+	// Per-owner retained-byte gauges; handlers run on the game thread, where
+	// the registered owners live, so the gauges read their structures safely
+	ResponseJson->SetObjectField(TEXT("memory"), FMCPMemoryStats::Get().ToJson());
+
+	// Connection-reuse gauge. The router exposes no live socket handles, so
+	// reuse is inferred from negotiation: every request counted under
+	// client_close_requests paid a fresh TCP setup; the rest rode warm
+	// keep-alive connections held open for the advertised idle timeout
+	TSharedPtr<FJsonObject> HttpJson = MakeShared<FJsonObject>();
+	HttpJson->SetBoolField(TEXT("keep_alive"), true);
+	HttpJson->SetNumberField(TEXT("keep_alive_timeout_seconds"), UUnrealClaudeSettings::Get().KeepAliveIdleTimeoutSeconds);
+	HttpJson->SetNumberField(TEXT("requests_served"), static_cast<double>(RequestsServed));
+	HttpJson->SetNumberField(TEXT("client_close_requests"), static_cast<double>(ClientCloseRequests));
+	ResponseJson->SetObjectField(TEXT("http"), HttpJson);
+
 	FString JsonString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
@@ -295,6 +839,139 @@ bool FUnrealClaudeMCPServer::HandleStatus(const FHttpServerRequest& Request, con
 	return true;
 }
 
+bool FUnrealClaudeMCPServer::HandleMetrics(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	RecordHttpRequest(Request);
+
+	TSharedPtr<FJsonObject> ResponseJson = FMCPToolMetrics::Get().ToJson();
+
+	// Queue depth alongside the per-tool counters for a one-stop health view
+	if (ToolRegistry.IsValid() && ToolRegistry->GetTaskQueue())
+	{
+		int32 Pending = 0, Running = 0, Completed = 0;
+		ToolRegistry->GetTaskQueue()->GetStats(Pending, Running, Completed);
+
+		TSharedPtr<FJsonObject> QueueJson = MakeShared<FJsonObject>();
+		QueueJson->SetNumberField(TEXT("pending"), Pending);
+		QueueJson->SetNumberField(TEXT("running"), Running);
+		QueueJson->SetNumberField(TEXT("completed"), Completed);
+		ResponseJson->SetObjectField(TEXT("task_queue"), QueueJson);
+	}
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+
+	OnComplete(CreateJsonResponse(JsonString));
+	return true;
+}
+
+void FUnrealClaudeMCPServer::AddKeepAliveHeaders(FHttpServerResponse& Response) const
+{
+	Response.Headers.Add(TEXT("Connection"), { TEXT("keep-alive") });
+	Response.Headers.Add(TEXT("Keep-Alive"),
+		{ FString::Printf(TEXT("timeout=%d"), UUnrealClaudeSettings::Get().KeepAliveIdleTimeoutSeconds) });
+}
+
+void FUnrealClaudeMCPServer::RecordHttpRequest(const FHttpServerRequest& Request)
+{
+	++RequestsServed;
+
+	// Header keys arrive in varying case depending on the client
+	for (const auto& HeaderPair : Request.Headers)
+	{
+		if (HeaderPair.Key.Equals(TEXT("Connection"), ESearchCase::IgnoreCase))
+		{
+			for (const FString& Value : HeaderPair.Value)
+			{
+				if (Value.Contains(TEXT("close"), ESearchCase::IgnoreCase))
+				{
+					++ClientCloseRequests;
+					break;
+				}
+			}
+			break;
+		}
+	}
+}
+
+void FUnrealClaudeMCPServer::CompleteMaybeCompressed(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete,
+	TArray<uint8>&& Body, const FString& ContentType, EHttpServerResponseCodes Code,
+	const FMCPRequestTrace& Trace)
+{
+	// Header keys arrive in varying case depending on the client
+	bool bAcceptsGzip = false;
+	for (const auto& HeaderPair : Request.Headers)
+	{
+		if (HeaderPair.Key.Equals(TEXT("Accept-Encoding"), ESearchCase::IgnoreCase))
+		{
+			for (const FString& Value : HeaderPair.Value)
+			{
+				if (Value.Contains(TEXT("gzip"), ESearchCase::IgnoreCase))
+				{
+					bAcceptsGzip = true;
+					break;
+				}
+			}
+			break;
+		}
+	}
+
+	if (!bAcceptsGzip || Body.Num() < UnrealClaudeConstants::MCPServer::MinCompressedResponseBytes)
+	{
+		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Body), ContentType);
+		Response->Code = Code;
+		Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+		AddKeepAliveHeaders(*Response);
+		if (Trace.TraceId.IsValid())
+		{
+			Response->Headers.Add(TEXT("X-MCP-Trace-Id"), { Trace.TraceId.ToString() });
+			Response->Headers.Add(TEXT("Server-Timing"), { Trace.ToServerTimingValue() });
+		}
+		OnComplete(MoveTemp(Response));
+		return;
+	}
+
+	// Read before the dispatch so the deferred completion stays free of this
+	const int32 KeepAliveTimeout = UUnrealClaudeSettings::Get().KeepAliveIdleTimeoutSeconds;
+
+	// Compress off-thread; the router supports deferred completion, so the
+	// handler thread is free while a multi-megabyte body deflates
+	Async(EAsyncExecution::ThreadPool, [Body = MoveTemp(Body), ContentType, Code, OnComplete, KeepAliveTimeout, Trace]() mutable
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Body.Num());
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+
+		const bool bCompressed = FCompression::CompressMemory(
+			NAME_Gzip, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num());
+		if (bCompressed)
+		{
+			Compressed.SetNum(CompressedSize);
+		}
+
+		AsyncTask(ENamedThreads::GameThread,
+			[Body = bCompressed ? MoveTemp(Compressed) : MoveTemp(Body), bCompressed, ContentType, Code, OnComplete, KeepAliveTimeout, Trace]() mutable
+		{
+			TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Body), ContentType);
+			Response->Code = Code;
+			Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+			Response->Headers.Add(TEXT("Connection"), { TEXT("keep-alive") });
+			Response->Headers.Add(TEXT("Keep-Alive"), { FString::Printf(TEXT("timeout=%d"), KeepAliveTimeout) });
+			if (bCompressed)
+			{
+				Response->Headers.Add(TEXT("Content-Encoding"), { TEXT("gzip") });
+			}
+			if (Trace.TraceId.IsValid())
+			{
+				Response->Headers.Add(TEXT("X-MCP-Trace-Id"), { Trace.TraceId.ToString() });
+				Response->Headers.Add(TEXT("Server-Timing"), { Trace.ToServerTimingValue() });
+			}
+			OnComplete(MoveTemp(Response));
+		});
+	});
+}
+
 TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateJsonResponse(const FString& JsonContent, EHttpServerResponseCodes Code)
 {
 	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(JsonContent, TEXT("application/json"));
@@ -305,9 +982,33 @@ TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateJsonResponse(const
 	Response->Headers.Add(TEXT("Access-Control-Allow-Methods"), { TEXT("GET, POST, OPTIONS") });
 	Response->Headers.Add(TEXT("Access-Control-Allow-Headers"), { TEXT("Content-Type") });
 
+	AddKeepAliveHeaders(*Response);
+
+	return Response;
+}
+
+TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateBackpressureResponse()
+{
+	TUniquePtr<FHttpServerResponse> Response = CreateErrorResponse(
+		TEXT("Server is at capacity - retry after the indicated delay"),
+		EHttpServerResponseCodes::TooManyRequests);
+	Response->Headers.Add(TEXT("Retry-After"),
+		{ FString::FromInt(UnrealClaudeConstants::MCPServer::BackpressureRetryAfterSeconds) });
 	return Response;
 }
 
+bool FUnrealClaudeMCPServer::TryAdmitRequest()
+{
+	int32 PendingTasks = 0;
+	int32 RunningTasks = 0;
+	int32 CompletedTasks = 0;
+	if (ToolRegistry.IsValid() && ToolRegistry->GetTaskQueue().IsValid())
+	{
+		ToolRegistry->GetTaskQueue()->GetStats(PendingTasks, RunningTasks, CompletedTasks);
+	}
+	return FMCPAdmissionController::Get().TryAdmit(PendingTasks);
+}
+
 TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateErrorResponse(const FString& Message, EHttpServerResponseCodes Code)
 {
 	TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
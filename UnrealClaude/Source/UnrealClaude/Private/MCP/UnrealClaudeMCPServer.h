@@ -5,9 +5,43 @@
 #include "CoreMinimal.h"
 #include "HttpServerModule.h"
 #include "IHttpRouter.h"
+#include "Containers/Ticker.h"
 #include "UnrealClaudeConstants.h"
 
 class FMCPToolRegistry;
+class FMCPLocalPipeTransport;
+
+/**
+ * Per-hop timing for one direct tool request, stamped onto the response as
+ * an X-MCP-Trace-Id header plus a standard Server-Timing header. Queued
+ * tasks report the same breakdown through the task JSON (queue_wait_ms,
+ * game_thread_wait_ms, game_thread_ms, serialize_ms) keyed by their task id;
+ * this struct covers the synchronous route, which previously reported
+ * nothing, so a slow direct call could not say which hop ate the time.
+ */
+struct FMCPRequestTrace
+{
+	/** Correlation id for this request (also injected into the tool params
+	 *  as _trace_id, so tool-side logs can carry it) */
+	FGuid TraceId;
+
+	/** Time spent parsing the request body into a JSON tree */
+	double ParseMs = 0.0;
+
+	/** Time spent inside the tool, including any game-thread marshaling */
+	double ExecuteMs = 0.0;
+
+	/** Time spent serializing the response envelope to UTF-8 wire bytes
+	 *  (zero for pre-serialized and binary results) */
+	double SerializeMs = 0.0;
+
+	/** Render the hop durations in Server-Timing metric syntax */
+	FString ToServerTimingValue() const
+	{
+		return FString::Printf(TEXT("parse;dur=%.2f, exec;dur=%.2f, serialize;dur=%.2f"),
+			ParseMs, ExecuteMs, SerializeMs);
+	}
+};
 
 /**
  * MCP HTTP Server for editor control
@@ -38,21 +72,83 @@ private:
 	/** Setup HTTP routes */
 	void SetupRoutes();
 
+	/**
+	 * Serialize the tool manifest once into a cached UTF-8 buffer with an ETag.
+	 * The tool set is fixed after registration, so /mcp/tools never needs to
+	 * re-walk the registry; clients that send If-None-Match get a 304 back.
+	 */
+	void BuildToolManifestCache();
+
 	/** Handle GET /mcp/tools - List all available tools */
 	bool HandleListTools(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
 	/** Handle POST /mcp/tool/{name} - Execute a tool */
 	bool HandleExecuteTool(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Handle POST /mcp/batch - Execute an ordered array of tool invocations */
+	bool HandleBatchExecute(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/**
+	 * Handle GET /mcp/task/wait?task_id=...&timeout_ms=... - Long-poll for a
+	 * task result. The response is parked on a completion waiter and finished
+	 * the moment the task goes terminal, replacing the fixed-interval
+	 * task_status polling loop. The router does not support upgraded
+	 * (WebSocket/SSE) connections, but it does support deferred completion,
+	 * which buys the same latency: one held request per task instead of
+	 * thousands of no-op polls.
+	 */
+	bool HandleWaitTask(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
 	/** Handle GET /mcp/status - Get server status */
 	bool HandleStatus(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Handle GET /mcp/metrics - Per-tool latency/throughput metrics */
+	bool HandleMetrics(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
 	/** Helper to create JSON response */
 	TUniquePtr<FHttpServerResponse> CreateJsonResponse(const FString& JsonContent, EHttpServerResponseCodes Code = EHttpServerResponseCodes::Ok);
 
+	/**
+	 * Complete a response, gzip-compressing the body first when the client
+	 * sent Accept-Encoding: gzip and the payload clears the size threshold.
+	 * Compression runs on the thread pool and completes asynchronously, so
+	 * multi-megabyte graph dumps never stall the handler thread. When the
+	 * caller measured a request trace, its id and hop durations ride along
+	 * as X-MCP-Trace-Id / Server-Timing headers.
+	 */
+	void CompleteMaybeCompressed(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete,
+		TArray<uint8>&& Body, const FString& ContentType, EHttpServerResponseCodes Code,
+		const FMCPRequestTrace& Trace = FMCPRequestTrace());
+
+	/**
+	 * Advertise keep-alive on a response. The engine's HTTP listener already
+	 * holds HTTP/1.1 connections open between requests, but it never says so;
+	 * conservative clients tear the connection down after every call and pay
+	 * TCP setup again. The explicit Connection/Keep-Alive headers (timeout
+	 * from settings) tell them the warm connection is safe to reuse.
+	 */
+	void AddKeepAliveHeaders(FHttpServerResponse& Response) const;
+
+	/**
+	 * Count a request for the /mcp/status connection-reuse gauge. The router
+	 * exposes no live socket handles, so reuse is inferred from negotiation:
+	 * requests arriving with Connection: close each paid a fresh TCP setup.
+	 */
+	void RecordHttpRequest(const FHttpServerRequest& Request);
+
 	/** Helper to create error response */
 	TUniquePtr<FHttpServerResponse> CreateErrorResponse(const FString& Message, EHttpServerResponseCodes Code = EHttpServerResponseCodes::BadRequest);
 
+	/** Build the 429 response sent when admission control sheds a request */
+	TUniquePtr<FHttpServerResponse> CreateBackpressureResponse();
+
+	/**
+	 * Gate one execute/batch request through admission control, folding in
+	 * the task queue's current pending depth. Pair a true return with
+	 * FMCPAdmissionController::Get().Release().
+	 */
+	bool TryAdmitRequest();
+
 private:
 	/** HTTP router handle */
 	TSharedPtr<IHttpRouter> HttpRouter;
@@ -60,12 +156,36 @@ private:
 	/** Route handles for cleanup */
 	FHttpRouteHandle ListToolsHandle;
 	FHttpRouteHandle ExecuteToolHandle;
+	FHttpRouteHandle BatchExecuteHandle;
+	FHttpRouteHandle WaitTaskHandle;
 	FHttpRouteHandle StatusHandle;
+	FHttpRouteHandle MetricsHandle;
 
 	/** Tool registry */
 	TSharedPtr<FMCPToolRegistry> ToolRegistry;
 
+	/** Optional named-pipe transport (Windows, settings opt-in); carries
+	 *  the same tool execution the HTTP routes do without the TCP stack */
+	TUniquePtr<FMCPLocalPipeTransport> PipeTransport;
+
+	/** Pre-serialized /mcp/tools response body (UTF-8) */
+	TArray<uint8> CachedToolManifest;
+
+	/** Strong ETag for the cached manifest (MD5 of the body) */
+	FString ToolManifestETag;
+
+	/** One-shot deferred tick that pre-warms the hot tool set and freezes
+	 *  the manifest once the editor is interactive */
+	FTSTicker::FDelegateHandle PreWarmTickerHandle;
+
 	/** Server state */
 	bool bIsRunning;
 	uint32 ServerPort;
+
+	/** Requests handled since start (handlers run on the game thread) */
+	uint64 RequestsServed;
+
+	/** Requests that arrived with Connection: close - each one paid a
+	 *  fresh TCP setup instead of riding a warm connection */
+	uint64 ClientCloseRequests;
 };
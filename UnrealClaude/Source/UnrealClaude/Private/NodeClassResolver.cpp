@@ -0,0 +1,40 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "NodeClassResolver.h"
+
+TMap<FString, TWeakObjectPtr<UObject>> FNodeClassResolver::ResolvedObjects;
+
+UObject* FNodeClassResolver::ResolveInternal(const FString& Key, TFunctionRef<UObject*()> ResolveFn)
+{
+	if (const TWeakObjectPtr<UObject>* Cached = ResolvedObjects.Find(Key))
+	{
+		if (UObject* Resolved = Cached->Get())
+		{
+			return Resolved;
+		}
+		// Stale (GC'd or reloaded) - fall through and re-run the ladder
+		ResolvedObjects.Remove(Key);
+	}
+
+	UObject* Resolved = ResolveFn();
+	if (Resolved)
+	{
+		ResolvedObjects.Add(Key, Resolved);
+	}
+	return Resolved;
+}
+
+UClass* FNodeClassResolver::ResolveClass(const FString& Key, TFunctionRef<UClass*()> ResolveFn)
+{
+	return Cast<UClass>(ResolveInternal(Key, [&ResolveFn]() -> UObject* { return ResolveFn(); }));
+}
+
+UFunction* FNodeClassResolver::ResolveFunction(const FString& Key, TFunctionRef<UFunction*()> ResolveFn)
+{
+	return Cast<UFunction>(ResolveInternal(Key, [&ResolveFn]() -> UObject* { return ResolveFn(); }));
+}
+
+void FNodeClassResolver::Reset()
+{
+	ResolvedObjects.Empty();
+}
@@ -0,0 +1,39 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Shared memoization table for string-based UClass/UFunction resolution.
+ *
+ * Graph construction resolves node targets from names ("KismetMathLibrary",
+ * "Actor*") through FindObject/LoadClass fallback ladders; during bulk graph
+ * building the same handful of targets resolve thousands of times, and each
+ * FindObject with a null outer is a global object-table search. Callers wrap
+ * their ladder in a callable and pass a stable key; hits revalidate a weak
+ * pointer and skip the ladder entirely. Stale entries (GC'd or hot-reloaded
+ * classes) re-run the ladder transparently. Failures are not cached - a class
+ * absent now may be loaded later.
+ *
+ * Keys are a flat namespace shared by all call sites, so prefix them with the
+ * site (e.g. "CallFunctionOwner:", "PinClass:"). Game thread only.
+ */
+class FNodeClassResolver
+{
+public:
+	/** Memoized class resolution; ResolveFn runs only on miss or stale entry */
+	static UClass* ResolveClass(const FString& Key, TFunctionRef<UClass*()> ResolveFn);
+
+	/** Memoized function resolution; ResolveFn runs only on miss or stale entry */
+	static UFunction* ResolveFunction(const FString& Key, TFunctionRef<UFunction*()> ResolveFn);
+
+	/** Drop every memoized entry (e.g. between automation runs) */
+	static void Reset();
+
+private:
+	/** Resolved objects keyed by caller-supplied name */
+	static TMap<FString, TWeakObjectPtr<UObject>> ResolvedObjects;
+
+	static UObject* ResolveInternal(const FString& Key, TFunctionRef<UObject*()> ResolveFn);
+};
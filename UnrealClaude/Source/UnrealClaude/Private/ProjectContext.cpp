@@ -1,6 +1,7 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "ProjectContext.h"
+#include "MCP/MCPMemoryStats.h"
 #include "UnrealClaudeConstants.h"
 #include "UnrealClaudeModule.h"
 #include "Editor.h"
@@ -13,6 +14,192 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Blueprint.h"
 #include "Misc/App.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/Archive.h"
+#include "HAL/LowLevelMemTracker.h"
+
+LLM_DECLARE_TAG(UnrealClaude);
+
+namespace
+{
+	/** One cached header: parse-time file stamp plus the classes found */
+	struct FCachedHeaderEntry
+	{
+		FDateTime Timestamp;
+		TArray<FUClassInfo> Classes;
+	};
+
+	FString GetContextCachePath()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("ProjectContextCache.bin"));
+	}
+
+	/**
+	 * Read the header-index cache written by a previous session.
+	 * A wrong magic/version or a short read just means a cold boot - the
+	 * cache is advisory, never authoritative.
+	 */
+	bool LoadHeaderCache(TMap<FString, FCachedHeaderEntry>& OutEntries)
+	{
+		TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*GetContextCachePath()));
+		if (!Ar.IsValid())
+		{
+			return false;
+		}
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		*Ar << Magic;
+		*Ar << Version;
+		if (Magic != UnrealClaudeConstants::Context::ContextCacheMagic ||
+			Version != UnrealClaudeConstants::Context::ContextCacheVersion)
+		{
+			return false;
+		}
+
+		int32 NumEntries = 0;
+		*Ar << NumEntries;
+		if (NumEntries < 0)
+		{
+			return false;
+		}
+
+		for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Ar->IsError(); ++EntryIndex)
+		{
+			FString RelativePath;
+			int64 TimestampTicks = 0;
+			int32 NumClasses = 0;
+			*Ar << RelativePath;
+			*Ar << TimestampTicks;
+			*Ar << NumClasses;
+			if (NumClasses < 0)
+			{
+				break;
+			}
+
+			FCachedHeaderEntry Entry;
+			Entry.Timestamp = FDateTime(TimestampTicks);
+			Entry.Classes.Reserve(NumClasses);
+			for (int32 ClassIndex = 0; ClassIndex < NumClasses && !Ar->IsError(); ++ClassIndex)
+			{
+				FUClassInfo Info;
+				*Ar << Info.ClassName;
+				*Ar << Info.ParentClass;
+				*Ar << Info.bIsBlueprint;
+				*Ar << Info.Specifiers;
+				*Ar << Info.LineNumber;
+
+				int32 NumFunctions = 0;
+				int32 NumProperties = 0;
+				*Ar << NumFunctions;
+				*Ar << NumProperties;
+				if (NumFunctions < 0 || NumProperties < 0)
+				{
+					OutEntries.Empty();
+					return false;
+				}
+
+				auto ReadMembers = [&Ar](TArray<FUMemberInfo>& Members, int32 Count)
+				{
+					Members.Reserve(Count);
+					for (int32 MemberIndex = 0; MemberIndex < Count && !Ar->IsError(); ++MemberIndex)
+					{
+						FUMemberInfo Member;
+						*Ar << Member.Name;
+						*Ar << Member.Type;
+						*Ar << Member.Specifiers;
+						*Ar << Member.LineNumber;
+						Members.Add(MoveTemp(Member));
+					}
+				};
+				ReadMembers(Info.Functions, NumFunctions);
+				ReadMembers(Info.Properties, NumProperties);
+
+				Info.FilePath = RelativePath;
+				Entry.Classes.Add(MoveTemp(Info));
+			}
+
+			OutEntries.Add(MoveTemp(RelativePath), MoveTemp(Entry));
+		}
+
+		if (Ar->IsError())
+		{
+			OutEntries.Empty();
+			return false;
+		}
+
+		return true;
+	}
+
+	/** Write the header index + timestamps back out for the next session */
+	void SaveHeaderCache(const TMap<FString, FDateTime>& Timestamps,
+		const TMap<FString, TArray<FUClassInfo>>& ClassesByFile)
+	{
+		TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*GetContextCachePath()));
+		if (!Ar.IsValid())
+		{
+			return;
+		}
+
+		uint32 Magic = UnrealClaudeConstants::Context::ContextCacheMagic;
+		int32 Version = UnrealClaudeConstants::Context::ContextCacheVersion;
+		*Ar << Magic;
+		*Ar << Version;
+
+		int32 NumEntries = Timestamps.Num();
+		*Ar << NumEntries;
+
+		static const TArray<FUClassInfo> NoClasses;
+		for (const auto& Pair : Timestamps)
+		{
+			FString RelativePath = Pair.Key;
+			int64 TimestampTicks = Pair.Value.GetTicks();
+			const TArray<FUClassInfo>* Classes = ClassesByFile.Find(Pair.Key);
+			int32 NumClasses = Classes ? Classes->Num() : 0;
+
+			*Ar << RelativePath;
+			*Ar << TimestampTicks;
+			*Ar << NumClasses;
+			for (const FUClassInfo& Info : (Classes ? *Classes : NoClasses))
+			{
+				FString ClassName = Info.ClassName;
+				FString ParentClass = Info.ParentClass;
+				bool bIsBlueprint = Info.bIsBlueprint;
+				FString Specifiers = Info.Specifiers;
+				int32 LineNumber = Info.LineNumber;
+				*Ar << ClassName;
+				*Ar << ParentClass;
+				*Ar << bIsBlueprint;
+				*Ar << Specifiers;
+				*Ar << LineNumber;
+
+				int32 NumFunctions = Info.Functions.Num();
+				int32 NumProperties = Info.Properties.Num();
+				*Ar << NumFunctions;
+				*Ar << NumProperties;
+
+				auto WriteMembers = [&Ar](const TArray<FUMemberInfo>& Members)
+				{
+					for (const FUMemberInfo& Member : Members)
+					{
+						FString Name = Member.Name;
+						FString Type = Member.Type;
+						FString MemberSpecifiers = Member.Specifiers;
+						int32 MemberLine = Member.LineNumber;
+						*Ar << Name;
+						*Ar << Type;
+						*Ar << MemberSpecifiers;
+						*Ar << MemberLine;
+					}
+				};
+				WriteMembers(Info.Functions);
+				WriteMembers(Info.Properties);
+			}
+		}
+	}
+}
 
 FProjectContextManager& FProjectContextManager::Get()
 {
@@ -23,6 +210,67 @@ FProjectContextManager& FProjectContextManager::Get()
 FProjectContextManager::FProjectContextManager()
 	: bHasContext(false)
 {
+	FMCPMemoryStats::Get().RegisterProvider(TEXT("project_context"), [this]
+	{
+		return GetEstimatedMemoryBytes();
+	});
+}
+
+FProjectContextManager::~FProjectContextManager()
+{
+	FMCPMemoryStats::Get().UnregisterProvider(TEXT("project_context"));
+	StopWatching();
+}
+
+uint64 FProjectContextManager::GetEstimatedMemoryBytes() const
+{
+	auto ClassBytes = [](const FUClassInfo& ClassInfo)
+	{
+		uint64 Bytes = ClassInfo.ClassName.GetAllocatedSize()
+			+ ClassInfo.ParentClass.GetAllocatedSize()
+			+ ClassInfo.FilePath.GetAllocatedSize()
+			+ ClassInfo.Specifiers.GetAllocatedSize()
+			+ ClassInfo.Functions.GetAllocatedSize()
+			+ ClassInfo.Properties.GetAllocatedSize();
+		for (const FUMemberInfo& Member : ClassInfo.Functions)
+		{
+			Bytes += Member.Name.GetAllocatedSize() + Member.Type.GetAllocatedSize() + Member.Specifiers.GetAllocatedSize();
+		}
+		for (const FUMemberInfo& Member : ClassInfo.Properties)
+		{
+			Bytes += Member.Name.GetAllocatedSize() + Member.Type.GetAllocatedSize() + Member.Specifiers.GetAllocatedSize();
+		}
+		return Bytes;
+	};
+
+	FScopeLock Lock(&ContextLock);
+
+	uint64 Bytes = CachedContext.SourceFiles.GetAllocatedSize()
+		+ CachedContext.UClasses.GetAllocatedSize()
+		+ CachedContext.LevelActors.GetAllocatedSize();
+	for (const FString& File : CachedContext.SourceFiles)
+	{
+		Bytes += File.GetAllocatedSize();
+	}
+	for (const FUClassInfo& ClassInfo : CachedContext.UClasses)
+	{
+		Bytes += ClassBytes(ClassInfo);
+	}
+	for (const FLevelActorInfo& Actor : CachedContext.LevelActors)
+	{
+		Bytes += Actor.Name.GetAllocatedSize() + Actor.Label.GetAllocatedSize() + Actor.ClassName.GetAllocatedSize();
+	}
+
+	Bytes += UClassesByFile.GetAllocatedSize() + HeaderTimestamps.GetAllocatedSize();
+	for (const auto& Pair : UClassesByFile)
+	{
+		Bytes += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedSize();
+		for (const FUClassInfo& ClassInfo : Pair.Value)
+		{
+			Bytes += ClassBytes(ClassInfo);
+		}
+	}
+	return Bytes;
 }
 
 const FProjectContext& FProjectContextManager::GetContext(bool bForceRefresh)
@@ -39,6 +287,8 @@ const FProjectContext& FProjectContextManager::GetContext(bool bForceRefresh)
 
 void FProjectContextManager::RefreshContext()
 {
+	LLM_SCOPE_BYTAG(UnrealClaude);
+
 	FScopeLock Lock(&ContextLock);
 
 	UE_LOG(LogUnrealClaude, Log, TEXT("Refreshing project context..."));
@@ -63,6 +313,10 @@ void FProjectContextManager::RefreshContext()
 
 	bHasContext = true;
 
+	// After the initial seed, keep the header index fresh via the directory
+	// watcher instead of re-scanning the whole Source tree on each gather
+	StartWatching();
+
 	UE_LOG(LogUnrealClaude, Log, TEXT("Project context gathered:"));
 	UE_LOG(LogUnrealClaude, Log, TEXT("  - Source files: %d"), CachedContext.SourceFiles.Num());
 	UE_LOG(LogUnrealClaude, Log, TEXT("  - UCLASS types: %d"), CachedContext.UClasses.Num());
@@ -131,7 +385,7 @@ FString FProjectContextManager::ParseIdentifier(const FString& Content, int32 St
 	return Content.Mid(StartPos, EndPos - StartPos);
 }
 
-bool FProjectContextManager::ParseSingleUClass(const FString& FileContent, const FString& RelativePath, int32 UClassPos, int32& OutNextSearchPos)
+bool FProjectContextManager::ParseSingleUClass(const FString& FileContent, const FString& RelativePath, int32 UClassPos, int32& OutNextSearchPos, TArray<FUClassInfo>& OutClasses)
 {
 	// Find the class keyword after UCLASS(...)
 	int32 ClassPos = FileContent.Find(TEXT("class "), ESearchCase::CaseSensitive, ESearchDir::FromStart, UClassPos);
@@ -187,42 +441,399 @@ bool FProjectContextManager::ParseSingleUClass(const FString& FileContent, const
 	ClassInfo.ParentClass = ParentClass;
 	ClassInfo.FilePath = RelativePath;
 	ClassInfo.bIsBlueprint = false;
-	CachedContext.UClasses.Add(ClassInfo);
-	CachedContext.CppClassCount++;
+	OutClasses.Add(ClassInfo);
 
 	return true;
 }
 
+FString FProjectContextManager::ExtractMacroSpecifiers(const FString& Content, int32 Pos, int32& OutAfterParenPos)
+{
+	OutAfterParenPos = Pos;
+	const int32 OpenPos = SkipWhitespace(Content, Pos);
+	if (OpenPos >= Content.Len() || Content[OpenPos] != TEXT('('))
+	{
+		return FString();
+	}
+
+	int32 Depth = 0;
+	for (int32 Index = OpenPos; Index < Content.Len(); ++Index)
+	{
+		if (Content[Index] == TEXT('('))
+		{
+			Depth++;
+		}
+		else if (Content[Index] == TEXT(')'))
+		{
+			Depth--;
+			if (Depth == 0)
+			{
+				OutAfterParenPos = Index + 1;
+				return Content.Mid(OpenPos + 1, Index - OpenPos - 1).TrimStartAndEnd();
+			}
+		}
+	}
+
+	// Unbalanced parentheses - treat as no specifiers
+	return FString();
+}
+
+void FProjectContextManager::ParseReflectedMember(const FString& FileContent, int32 MacroPos, int32 MacroLen,
+	bool bFunction, int32 LineNumber, FUClassInfo& OutClass)
+{
+	FUMemberInfo Member;
+	Member.LineNumber = LineNumber;
+
+	int32 DeclStart = MacroPos + MacroLen;
+	Member.Specifiers = ExtractMacroSpecifiers(FileContent, DeclStart, DeclStart);
+
+	// Declaration head: everything from after the macro up to the
+	// terminator - '(' for functions; ';', '=', '{' or '[' for
+	// properties. Bounded so a malformed header cannot run away.
+	DeclStart = SkipWhitespace(FileContent, DeclStart);
+	const int32 ScanLimit = FMath::Min(FileContent.Len(),
+		DeclStart + UnrealClaudeConstants::Context::MaxUClassToClassKeywordDistance);
+	int32 DeclEnd = DeclStart;
+	while (DeclEnd < ScanLimit)
+	{
+		const TCHAR Ch = FileContent[DeclEnd];
+		if (bFunction ? (Ch == TEXT('('))
+			: (Ch == TEXT(';') || Ch == TEXT('=') || Ch == TEXT('{') || Ch == TEXT('[')))
+		{
+			break;
+		}
+		DeclEnd++;
+	}
+	if (DeclEnd >= ScanLimit)
+	{
+		return;
+	}
+
+	FString Head = FileContent.Mid(DeclStart, DeclEnd - DeclStart).TrimStartAndEnd();
+
+	// The trailing identifier is the member name; what precedes it is
+	// the type (qualifiers included, verbatim)
+	int32 NameStart = Head.Len();
+	while (NameStart > 0 &&
+		(FChar::IsAlnum(Head[NameStart - 1]) || Head[NameStart - 1] == TEXT('_')))
+	{
+		NameStart--;
+	}
+	Member.Name = Head.Mid(NameStart);
+	if (Member.Name.IsEmpty() || FChar::IsDigit(Member.Name[0]))
+	{
+		return;
+	}
+
+	FString Type = Head.Left(NameStart).TrimStartAndEnd();
+	// Collapse internal runs of whitespace (multi-line declarations)
+	Type.ReplaceInline(TEXT("\r"), TEXT(" "));
+	Type.ReplaceInline(TEXT("\n"), TEXT(" "));
+	Type.ReplaceInline(TEXT("\t"), TEXT(" "));
+	while (Type.ReplaceInline(TEXT("  "), TEXT(" ")) > 0) {}
+	Member.Type = Type;
+
+	(bFunction ? OutClass.Functions : OutClass.Properties).Add(MoveTemp(Member));
+}
+
+void FProjectContextManager::ParseHeaderContent(const FString& FileContent, const FString& RelativePath, TArray<FUClassInfo>& OutClasses)
+{
+	// Single pass over the raw character buffer: identifier detection, macro
+	// matching, word-boundary checks and line counting all ride one cursor.
+	// No per-line splitting and no repeated whole-file substring searches -
+	// at monorepo scale the rebuild cost is the file read, not the scan.
+	const TCHAR* Buffer = *FileContent;
+	const int32 Len = FileContent.Len();
+	int32 CurrentClassIndex = INDEX_NONE;
+	int32 Line = 1;
+	int32 Pos = 0;
+
+	while (Pos < Len)
+	{
+		const TCHAR Ch = Buffer[Pos];
+		if (Ch == TEXT('\n'))
+		{
+			Line++;
+			Pos++;
+			continue;
+		}
+		if (!FChar::IsAlpha(Ch) && Ch != TEXT('_'))
+		{
+			Pos++;
+			continue;
+		}
+
+		// Consume the whole identifier once - word boundaries come for free
+		// and nothing is ever rescanned
+		const int32 IdentStart = Pos;
+		while (Pos < Len && (FChar::IsAlnum(Buffer[Pos]) || Buffer[Pos] == TEXT('_')))
+		{
+			Pos++;
+		}
+		const int32 IdentLen = Pos - IdentStart;
+
+		if (IdentLen == 6 && FCString::Strncmp(Buffer + IdentStart, TEXT("UCLASS"), 6) == 0)
+		{
+			int32 UnusedNextSearchPos;
+			const int32 CountBefore = OutClasses.Num();
+			ParseSingleUClass(FileContent, RelativePath, IdentStart, UnusedNextSearchPos, OutClasses);
+			if (OutClasses.Num() > CountBefore)
+			{
+				CurrentClassIndex = OutClasses.Num() - 1;
+				FUClassInfo& ClassInfo = OutClasses[CurrentClassIndex];
+				ClassInfo.LineNumber = Line;
+				int32 AfterParenPos;
+				ClassInfo.Specifiers = ExtractMacroSpecifiers(FileContent, Pos, AfterParenPos);
+			}
+		}
+		else if (IdentLen == 9 && CurrentClassIndex != INDEX_NONE)
+		{
+			const bool bFunction = FCString::Strncmp(Buffer + IdentStart, TEXT("UFUNCTION"), 9) == 0;
+			if (bFunction || FCString::Strncmp(Buffer + IdentStart, TEXT("UPROPERTY"), 9) == 0)
+			{
+				ParseReflectedMember(FileContent, IdentStart, 9, bFunction, Line, OutClasses[CurrentClassIndex]);
+			}
+		}
+	}
+}
+
+bool FProjectContextManager::ParseHeaderFile(const FString& RelativePath)
+{
+	FString FullPath = FPaths::Combine(CachedContext.ProjectPath, RelativePath);
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *FullPath))
+	{
+		UClassesByFile.Remove(RelativePath);
+		HeaderTimestamps.Remove(RelativePath);
+		return false;
+	}
+
+	HeaderTimestamps.Add(RelativePath, IFileManager::Get().GetTimeStamp(*FullPath));
+
+	TArray<FUClassInfo> FileClasses;
+	ParseHeaderContent(FileContent, RelativePath, FileClasses);
+
+	if (FileClasses.Num() > 0)
+	{
+		UClassesByFile.Add(RelativePath, MoveTemp(FileClasses));
+		return true;
+	}
+
+	UClassesByFile.Remove(RelativePath);
+	return false;
+}
+
 void FProjectContextManager::ParseUClasses()
 {
-	// Scan header files for UCLASS declarations
+	// Seed the header index: take unchanged files from the on-disk cache and
+	// read only the ones whose timestamps moved. Subsequent updates come
+	// through the directory watcher and only re-parse the files that
+	// actually changed.
+	UClassesByFile.Empty();
+	HeaderTimestamps.Empty();
+
+	TArray<FString> HeaderPaths;
 	for (const FString& RelativePath : CachedContext.SourceFiles)
 	{
-		if (!RelativePath.EndsWith(TEXT(".h")))
+		if (RelativePath.EndsWith(TEXT(".h")))
 		{
-			continue;
+			HeaderPaths.Add(RelativePath);
 		}
+	}
+
+	TMap<FString, FCachedHeaderEntry> DiskCache;
+	LoadHeaderCache(DiskCache);
+
+	// Validate every cached entry by file timestamp; a hit costs a stat, a
+	// miss goes to the stale list for re-parsing
+	const FString ProjectPath = CachedContext.ProjectPath;
+	TArray<FString> StaleHeaders;
+	int32 CacheHits = 0;
+	for (const FString& RelativePath : HeaderPaths)
+	{
+		const FString FullPath = FPaths::Combine(ProjectPath, RelativePath);
+		const FDateTime DiskStamp = IFileManager::Get().GetTimeStamp(*FullPath);
 
-		FString FullPath = FPaths::Combine(CachedContext.ProjectPath, RelativePath);
+		const FCachedHeaderEntry* Cached = DiskCache.Find(RelativePath);
+		if (Cached && Cached->Timestamp == DiskStamp)
+		{
+			HeaderTimestamps.Add(RelativePath, DiskStamp);
+			if (Cached->Classes.Num() > 0)
+			{
+				UClassesByFile.Add(RelativePath, Cached->Classes);
+			}
+			CacheHits++;
+		}
+		else
+		{
+			StaleHeaders.Add(RelativePath);
+		}
+	}
+
+	// Load and tokenize the stale headers across all cores; each slot
+	// collects its own results so the loop body needs no locking. File IO
+	// and string scanning both parallelize well here.
+	TArray<TArray<FUClassInfo>> PerFileClasses;
+	TArray<FDateTime> PerFileStamps;
+	PerFileClasses.SetNum(StaleHeaders.Num());
+	PerFileStamps.SetNum(StaleHeaders.Num());
+
+	ParallelFor(StaleHeaders.Num(), [&StaleHeaders, &PerFileClasses, &PerFileStamps, &ProjectPath](int32 Index)
+	{
+		FString FullPath = FPaths::Combine(ProjectPath, StaleHeaders[Index]);
+		PerFileStamps[Index] = IFileManager::Get().GetTimeStamp(*FullPath);
 		FString FileContent;
-		if (!FFileHelper::LoadFileToString(FileContent, *FullPath))
+		if (FFileHelper::LoadFileToString(FileContent, *FullPath))
+		{
+			ParseHeaderContent(FileContent, StaleHeaders[Index], PerFileClasses[Index]);
+		}
+	});
+
+	// Single-threaded merge into the per-file index
+	for (int32 Index = 0; Index < StaleHeaders.Num(); ++Index)
+	{
+		HeaderTimestamps.Add(StaleHeaders[Index], PerFileStamps[Index]);
+		if (PerFileClasses[Index].Num() > 0)
+		{
+			UClassesByFile.Add(StaleHeaders[Index], MoveTemp(PerFileClasses[Index]));
+		}
+	}
+
+	RebuildClassAggregates();
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Header index seeded: %d cached, %d re-parsed"),
+		CacheHits, StaleHeaders.Num());
+
+	// Persist for the next boot whenever anything had to be re-read or
+	// entries dropped out of the tree
+	if (StaleHeaders.Num() > 0 || DiskCache.Num() != HeaderPaths.Num())
+	{
+		SaveContextCache();
+	}
+}
+
+void FProjectContextManager::RebuildClassAggregates()
+{
+	CachedContext.UClasses.Empty();
+	CachedContext.CppClassCount = 0;
+
+	for (const auto& Pair : UClassesByFile)
+	{
+		CachedContext.UClasses.Append(Pair.Value);
+	}
+
+	CachedContext.CppClassCount = CachedContext.UClasses.Num();
+}
+
+void FProjectContextManager::StartWatching()
+{
+	if (DirectoryWatcherHandle.IsValid())
+	{
+		return; // Already watching
+	}
+
+	FString SourceDir = CachedContext.SourcePath;
+	if (!FPaths::DirectoryExists(SourceDir))
+	{
+		return;
+	}
+
+	FDirectoryWatcherModule& WatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher* Watcher = WatcherModule.Get())
+	{
+		Watcher->RegisterDirectoryChangedCallback_Handle(
+			SourceDir,
+			IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FProjectContextManager::OnSourceDirectoryChanged),
+			DirectoryWatcherHandle);
+		WatchedDirectory = SourceDir;
+
+		UE_LOG(LogUnrealClaude, Log, TEXT("Watching source directory for incremental context updates: %s"), *SourceDir);
+	}
+}
+
+void FProjectContextManager::StopWatching()
+{
+	if (!DirectoryWatcherHandle.IsValid())
+	{
+		return;
+	}
+
+	FDirectoryWatcherModule* WatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (WatcherModule)
+	{
+		if (IDirectoryWatcher* Watcher = WatcherModule->Get())
+		{
+			Watcher->UnregisterDirectoryChangedCallback_Handle(WatchedDirectory, DirectoryWatcherHandle);
+		}
+	}
+
+	DirectoryWatcherHandle.Reset();
+	WatchedDirectory.Empty();
+}
+
+void FProjectContextManager::OnSourceDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	FScopeLock Lock(&ContextLock);
+
+	bool bIndexChanged = false;
+
+	for (const FFileChangeData& Change : Changes)
+	{
+		const FString& FullPath = Change.Filename;
+		if (!FullPath.EndsWith(TEXT(".h")) && !FullPath.EndsWith(TEXT(".cpp")))
 		{
 			continue;
 		}
 
-		// Find all UCLASS declarations in this file
-		int32 SearchStart = 0;
-		while (true)
+		FString RelativePath = FullPath;
+		FPaths::MakePathRelativeTo(RelativePath, *CachedContext.ProjectPath);
+
+		switch (Change.Action)
 		{
-			int32 UClassPos = FileContent.Find(TEXT("UCLASS"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchStart);
-			if (UClassPos == INDEX_NONE)
+		case FFileChangeData::FCA_Added:
+			CachedContext.SourceFiles.AddUnique(RelativePath);
+			if (RelativePath.EndsWith(TEXT(".h")))
 			{
-				break;
+				ParseHeaderFile(RelativePath);
+			}
+			bIndexChanged = true;
+			break;
+
+		case FFileChangeData::FCA_Modified:
+			if (RelativePath.EndsWith(TEXT(".h")))
+			{
+				ParseHeaderFile(RelativePath);
+				bIndexChanged = true;
 			}
+			break;
 
-			ParseSingleUClass(FileContent, RelativePath, UClassPos, SearchStart);
+		case FFileChangeData::FCA_Removed:
+			CachedContext.SourceFiles.Remove(RelativePath);
+			UClassesByFile.Remove(RelativePath);
+			HeaderTimestamps.Remove(RelativePath);
+			bIndexChanged = true;
+			break;
+
+		default:
+			break;
 		}
 	}
+
+	if (bIndexChanged)
+	{
+		RebuildClassAggregates();
+		CachedContext.GatheredAt = FDateTime::Now();
+
+		// Keep the on-disk cache current so the next boot starts warm even
+		// if this session never does a full gather again
+		SaveContextCache();
+
+		UE_LOG(LogUnrealClaude, Verbose, TEXT("Project context updated incrementally (%d file changes)"), Changes.Num());
+	}
+}
+
+void FProjectContextManager::SaveContextCache() const
+{
+	SaveHeaderCache(HeaderTimestamps, UClassesByFile);
 }
 
 void FProjectContextManager::GatherLevelActors()
@@ -288,16 +899,26 @@ void FProjectContextManager::CountAssets()
 }
 
 FString FProjectContextManager::FormatContextForPrompt() const
+{
+	return FormatContextForPrompt(UnrealClaudeConstants::Context::DefaultContextTokenBudget, TArray<FString>());
+}
+
+FString FProjectContextManager::FormatContextForPrompt(int32 MaxTokens, const TArray<FString>& RelevanceHints) const
 {
 	FScopeLock Lock(&ContextLock);
 
-	if (!bHasContext)
+	if (!bHasContext || MaxTokens <= 0)
 	{
 		return TEXT("");
 	}
 
+	const int32 BudgetChars = MaxTokens * UnrealClaudeConstants::Context::ApproxCharsPerToken;
+
 	FString Context;
+	auto RemainingChars = [&Context, BudgetChars]() { return BudgetChars - Context.Len(); };
 
+	// Header + statistics always fit first; they are a few lines and anchor
+	// every other section
 	Context += TEXT("\n\n=== PROJECT CONTEXT ===\n\n");
 
 	// Project info
@@ -312,32 +933,75 @@ FString FProjectContextManager::FormatContextForPrompt() const
 	Context += FString::Printf(TEXT("Total Assets: %d\n"), CachedContext.AssetCount);
 	Context += FString::Printf(TEXT("Level Actors: %d\n\n"), CachedContext.LevelActors.Num());
 
-	// List UCLASS types (limit to avoid prompt bloat)
-	if (CachedContext.UClasses.Num() > 0)
+	// Split classes into hinted (mentioned in the conversation) and the rest;
+	// hinted ones are worth a line even on tight budgets
+	TArray<const FUClassInfo*> HintedClasses;
+	TArray<const FUClassInfo*> OtherClasses;
+	for (const FUClassInfo& ClassInfo : CachedContext.UClasses)
+	{
+		bool bHinted = false;
+		for (const FString& Hint : RelevanceHints)
+		{
+			if (Hint.Len() >= 3 &&
+				(ClassInfo.ClassName.Contains(Hint) || Hint.Contains(ClassInfo.ClassName)))
+			{
+				bHinted = true;
+				break;
+			}
+		}
+		(bHinted ? HintedClasses : OtherClasses).Add(&ClassInfo);
+	}
+
+	auto FormatClassLine = [](const FUClassInfo& ClassInfo)
+	{
+		return ClassInfo.ParentClass.IsEmpty()
+			? FString::Printf(TEXT("  - %s\n"), *ClassInfo.ClassName)
+			: FString::Printf(TEXT("  - %s : %s\n"), *ClassInfo.ClassName, *ClassInfo.ParentClass);
+	};
+
+	// List UCLASS types: hinted first, then the rest while budget remains
+	// (the non-hinted tail also respects the legacy display cap)
+	if (CachedContext.UClasses.Num() > 0 && RemainingChars() > 0)
 	{
 		Context += TEXT("Project C++ Classes:\n");
-		int32 MaxClasses = FMath::Min(CachedContext.UClasses.Num(), UnrealClaudeConstants::Context::MaxClassesToFormat);
-		for (int32 i = 0; i < MaxClasses; ++i)
+
+		int32 ShownClasses = 0;
+		for (const FUClassInfo* ClassInfo : HintedClasses)
+		{
+			FString Line = FormatClassLine(*ClassInfo);
+			if (Line.Len() > RemainingChars())
+			{
+				break;
+			}
+			Context += Line;
+			ShownClasses++;
+		}
+
+		for (const FUClassInfo* ClassInfo : OtherClasses)
 		{
-			const FUClassInfo& ClassInfo = CachedContext.UClasses[i];
-			if (!ClassInfo.ParentClass.IsEmpty())
+			if (ShownClasses >= UnrealClaudeConstants::Context::MaxClassesToFormat)
 			{
-				Context += FString::Printf(TEXT("  - %s : %s\n"), *ClassInfo.ClassName, *ClassInfo.ParentClass);
+				break;
 			}
-			else
+			FString Line = FormatClassLine(*ClassInfo);
+			if (Line.Len() > RemainingChars())
 			{
-				Context += FString::Printf(TEXT("  - %s\n"), *ClassInfo.ClassName);
+				break;
 			}
+			Context += Line;
+			ShownClasses++;
 		}
-		if (CachedContext.UClasses.Num() > MaxClasses)
+
+		if (CachedContext.UClasses.Num() > ShownClasses)
 		{
-			Context += FString::Printf(TEXT("  ... and %d more\n"), CachedContext.UClasses.Num() - MaxClasses);
+			Context += FString::Printf(TEXT("  ... and %d more\n"), CachedContext.UClasses.Num() - ShownClasses);
 		}
 		Context += TEXT("\n");
 	}
 
-	// List source files (abbreviated)
-	if (CachedContext.SourceFiles.Num() > 0)
+	// List source files (abbreviated); the directory grouping is only
+	// computed if there is budget left to print any of it
+	if (CachedContext.SourceFiles.Num() > 0 && RemainingChars() > 0)
 	{
 		Context += TEXT("Source Structure:\n");
 
@@ -352,18 +1016,21 @@ FString FProjectContextManager::FormatContextForPrompt() const
 		int32 DirCount = 0;
 		for (const auto& Pair : FilesByDir)
 		{
-			if (DirCount++ >= UnrealClaudeConstants::Context::MaxDirectoriesToShow)
+			FString Line = FString::Printf(TEXT("  %s/ (%d files)\n"), *Pair.Key, Pair.Value.Num());
+			if (DirCount >= UnrealClaudeConstants::Context::MaxDirectoriesToShow || Line.Len() > RemainingChars())
 			{
-				Context += FString::Printf(TEXT("  ... and %d more directories\n"), FilesByDir.Num() - UnrealClaudeConstants::Context::MaxDirectoriesToShow);
+				Context += FString::Printf(TEXT("  ... and %d more directories\n"), FilesByDir.Num() - DirCount);
 				break;
 			}
-			Context += FString::Printf(TEXT("  %s/ (%d files)\n"), *Pair.Key, Pair.Value.Num());
+			Context += Line;
+			DirCount++;
 		}
 		Context += TEXT("\n");
 	}
 
-	// List level actors (grouped by class, limited)
-	if (CachedContext.LevelActors.Num() > 0)
+	// List level actors (grouped by class); grouping and sorting are also
+	// skipped outright once the budget is spent
+	if (CachedContext.LevelActors.Num() > 0 && RemainingChars() > 0)
 	{
 		Context += TEXT("Level Actors (by type):\n");
 
@@ -386,12 +1053,14 @@ FString FProjectContextManager::FormatContextForPrompt() const
 		int32 Shown = 0;
 		for (const auto& Pair : SortedActors)
 		{
-			if (Shown++ >= 15) // Limit types shown
+			FString Line = FString::Printf(TEXT("  - %s: %d\n"), *Pair.Key, Pair.Value);
+			if (Shown >= UnrealClaudeConstants::Context::MaxAssetTypesToShow || Line.Len() > RemainingChars())
 			{
-				Context += FString::Printf(TEXT("  ... and %d more types\n"), SortedActors.Num() - 15);
+				Context += FString::Printf(TEXT("  ... and %d more types\n"), SortedActors.Num() - Shown);
 				break;
 			}
-			Context += FString::Printf(TEXT("  - %s: %d\n"), *Pair.Key, Pair.Value);
+			Context += Line;
+			Shown++;
 		}
 		Context += TEXT("\n");
 	}
@@ -420,6 +1089,21 @@ FString FProjectContextManager::GetContextSummary() const
 	);
 }
 
+bool FProjectContextManager::FindClassInfo(const FString& ClassName, FUClassInfo& OutInfo) const
+{
+	FScopeLock Lock(&ContextLock);
+
+	for (const FUClassInfo& Info : CachedContext.UClasses)
+	{
+		if (Info.ClassName.Equals(ClassName, ESearchCase::IgnoreCase))
+		{
+			OutInfo = Info;
+			return true;
+		}
+	}
+	return false;
+}
+
 FTimespan FProjectContextManager::GetTimeSinceRefresh() const
 {
 	FScopeLock Lock(&ContextLock);
@@ -4,6 +4,25 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * One reflected member (UFUNCTION or UPROPERTY) found in a header
+ */
+struct FUMemberInfo
+{
+	/** Member name */
+	FString Name;
+
+	/** Declared type: return type and qualifiers for functions, property
+	 *  type for properties (taken verbatim from the declaration) */
+	FString Type;
+
+	/** Raw specifier list from inside the reflection macro's parentheses */
+	FString Specifiers;
+
+	/** 1-based line number of the declaration */
+	int32 LineNumber = 0;
+};
+
 /**
  * Information about a UCLASS found in the project
  */
@@ -18,11 +37,24 @@ struct FUClassInfo
 	/** File path where the class is defined */
 	FString FilePath;
 
+	/** Raw specifier list from inside UCLASS(...) */
+	FString Specifiers;
+
+	/** 1-based line number of the UCLASS macro */
+	int32 LineNumber;
+
+	/** UFUNCTION declarations inside the class body */
+	TArray<FUMemberInfo> Functions;
+
+	/** UPROPERTY declarations inside the class body */
+	TArray<FUMemberInfo> Properties;
+
 	/** Whether it's a Blueprint class */
 	bool bIsBlueprint;
 
 	FUClassInfo()
-		: bIsBlueprint(false)
+		: LineNumber(0)
+		, bIsBlueprint(false)
 	{}
 };
 
@@ -94,11 +126,17 @@ struct UNREALCLAUDE_API FProjectContext
 
 /**
  * Manager for gathering and caching project context
+ *
+ * The header index persists across editor sessions in a versioned binary
+ * cache under Saved/UnrealClaude. On the first gather after boot, only
+ * headers whose file timestamps changed since they were cached are
+ * re-read; an unchanged project costs a directory walk and nothing more.
  */
 class UNREALCLAUDE_API FProjectContextManager
 {
 public:
 	static FProjectContextManager& Get();
+	~FProjectContextManager();
 
 	/** Gather project context (refresh if needed) */
 	const FProjectContext& GetContext(bool bForceRefresh = false);
@@ -106,9 +144,23 @@ public:
 	/** Force a context refresh */
 	void RefreshContext();
 
-	/** Format context for inclusion in system prompt */
+	/** Format context for inclusion in system prompt (default token budget) */
 	FString FormatContextForPrompt() const;
 
+	/**
+	 * Format context under a token budget, highest-value sections first.
+	 *
+	 * Classes matching a relevance hint (substring match either way, e.g.
+	 * class names mentioned recently in the conversation) are emitted before
+	 * anything else; the remaining sections - class list, source layout,
+	 * level actor summary - are only grouped and formatted while budget
+	 * remains, so a tight budget never pays for sections it cannot fit.
+	 *
+	 * @param MaxTokens Approximate token budget for the whole block
+	 * @param RelevanceHints Identifiers the conversation recently mentioned
+	 */
+	FString FormatContextForPrompt(int32 MaxTokens, const TArray<FString>& RelevanceHints) const;
+
 	/** Get a summary of the context */
 	FString GetContextSummary() const;
 
@@ -118,6 +170,16 @@ public:
 	/** Get time since last refresh */
 	FTimespan GetTimeSinceRefresh() const;
 
+	/**
+	 * Look up a class in the header index by name (case-insensitive).
+	 * @return true and a copy of its info (members included) when found
+	 */
+	bool FindClassInfo(const FString& ClassName, FUClassInfo& OutInfo) const;
+
+	/** Estimated bytes retained by the cached context and the header index
+	 *  (memory accounting gauge) */
+	uint64 GetEstimatedMemoryBytes() const;
+
 private:
 	FProjectContextManager();
 
@@ -127,8 +189,36 @@ private:
 	/** Parse UCLASS declarations from headers */
 	void ParseUClasses();
 
+	/** Parse one header into its UClassesByFile entry; returns true if any UCLASS was found */
+	bool ParseHeaderFile(const FString& RelativePath);
+
+	/** Single-pass scan of already-loaded header content for every UCLASS and
+	 *  its reflected members (thread-safe) */
+	static void ParseHeaderContent(const FString& FileContent, const FString& RelativePath, TArray<FUClassInfo>& OutClasses);
+
+	/** Rebuild CachedContext.UClasses/CppClassCount from the per-file index */
+	void RebuildClassAggregates();
+
+	/** Subscribe to Source-tree changes via the directory watcher */
+	void StartWatching();
+
+	/** Unsubscribe from directory watcher events */
+	void StopWatching();
+
+	/** Directory watcher callback: re-parse only the files that changed */
+	void OnSourceDirectoryChanged(const TArray<struct FFileChangeData>& Changes);
+
 	/** Parse a single UCLASS from file content starting at given position */
-	bool ParseSingleUClass(const FString& FileContent, const FString& RelativePath, int32 UClassPos, int32& OutNextSearchPos);
+	static bool ParseSingleUClass(const FString& FileContent, const FString& RelativePath, int32 UClassPos, int32& OutNextSearchPos, TArray<FUClassInfo>& OutClasses);
+
+	/** Record one UFUNCTION/UPROPERTY declaration (specifiers, name, type,
+	 *  line number) into the class; called by the single-pass scanner */
+	static void ParseReflectedMember(const FString& FileContent, int32 MacroPos, int32 MacroLen,
+		bool bFunction, int32 LineNumber, FUClassInfo& OutClass);
+
+	/** Read the text between a macro's parentheses starting at/after Pos;
+	 *  OutAfterParenPos lands just past the closing parenthesis */
+	static FString ExtractMacroSpecifiers(const FString& Content, int32 Pos, int32& OutAfterParenPos);
 
 	/** Skip whitespace characters and return new position */
 	static int32 SkipWhitespace(const FString& Content, int32 StartPos);
@@ -136,6 +226,9 @@ private:
 	/** Parse an identifier (alphanumeric + underscore) starting at position */
 	static FString ParseIdentifier(const FString& Content, int32 StartPos, int32& OutEndPos);
 
+	/** Persist the header index + parse-time stamps to the Saved/ cache file */
+	void SaveContextCache() const;
+
 	/** Gather current level actors */
 	void GatherLevelActors();
 
@@ -145,6 +238,20 @@ private:
 	/** Cached project context */
 	FProjectContext CachedContext;
 
+	/** UCLASS definitions per header, so a changed file only re-parses itself */
+	TMap<FString, TArray<FUClassInfo>> UClassesByFile;
+
+	/** File timestamp of every header at the time it was parsed, including
+	 *  headers with no UCLASS - that's what makes a cache hit on the next
+	 *  boot skip the read entirely. Serialized to the Saved/ cache. */
+	TMap<FString, FDateTime> HeaderTimestamps;
+
+	/** Handle for the Source-tree directory watcher subscription */
+	FDelegateHandle DirectoryWatcherHandle;
+
+	/** Directory registered with the watcher (needed to unregister) */
+	FString WatchedDirectory;
+
 	/** Whether context has been gathered */
 	bool bHasContext;
 
@@ -9,6 +9,7 @@
 
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "Editor.h"
@@ -28,6 +29,7 @@ FScriptExecutionManager& FScriptExecutionManager::Get()
 FScriptExecutionManager::FScriptExecutionManager()
 	: MaxHistorySize(100)
 	, ScriptCounter(0)
+	, bPersistentPythonContext(true)
 {
 	LoadHistory();
 
@@ -42,13 +44,14 @@ FScriptExecutionManager::FScriptExecutionManager()
 
 FScriptExecutionManager::~FScriptExecutionManager()
 {
-	SaveHistory();
+	// History records are appended durably as they happen; nothing to flush
 }
 
 FScriptExecutionResult FScriptExecutionManager::ExecuteScript(
 	EScriptType Type,
 	const FString& ScriptContent,
-	const FString& Description)
+	const FString& Description,
+	FScriptOutputSink OutputSink)
 {
 	// Parse description from header if not provided
 	FString FinalDescription = Description;
@@ -71,10 +74,10 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteScript(
 			Result = ExecuteCpp(ScriptContent, FinalDescription);
 			break;
 		case EScriptType::Python:
-			Result = ExecutePython(ScriptContent, FinalDescription);
+			Result = ExecutePython(ScriptContent, FinalDescription, OutputSink);
 			break;
 		case EScriptType::Console:
-			Result = ExecuteConsole(ScriptContent, FinalDescription);
+			Result = ExecuteConsole(ScriptContent, FinalDescription, OutputSink);
 			break;
 		case EScriptType::EditorUtility:
 			Result = ExecuteEditorUtility(ScriptContent, FinalDescription);
@@ -100,6 +103,28 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteCpp(
 	const FString& Description)
 {
 #if WITH_LIVE_CODING
+	// Identical source (modulo whitespace and header metadata) already went
+	// through Live Coding this session - replay its outcome instead of paying
+	// the compile round-trip again. This is what makes auto-retry cheap:
+	// a resubmission only recompiles on a substantive diff.
+	const FString SourceHash = HashNormalizedSource(ScriptContent);
+	if (const FCppCompileCacheEntry* Cached = CppCompileCache.Find(SourceHash))
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("C++ script matches cached compile (%s): %s"),
+			*SourceHash, Cached->Result.bSuccess ? TEXT("success") : TEXT("compiler error"));
+
+		FScriptHistoryEntry Entry;
+		Entry.ScriptType = EScriptType::Cpp;
+		Entry.Filename = FPaths::GetCleanFilename(Cached->FilePath);
+		Entry.Description = Description;
+		Entry.bSuccess = Cached->Result.bSuccess;
+		Entry.ResultMessage = TEXT("(cached) ") + Cached->Result.Message.Left(200);
+		Entry.FilePath = Cached->FilePath;
+		AddToHistory(Entry);
+
+		return Cached->Result;
+	}
+
 	// Generate script name and write to file
 	FString ScriptName = GenerateScriptName(EScriptType::Cpp, Description);
 	FString FilePath = WriteScriptFile(ScriptContent, EScriptType::Cpp, ScriptName);
@@ -113,9 +138,10 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteCpp(
 
 	// Trigger Live Coding compilation
 	FString ErrorLog;
+	bool bCompilerError = false;
 	FScriptExecutionResult Result;
 
-	if (TriggerLiveCodingCompile(ErrorLog))
+	if (TriggerLiveCodingCompile(ErrorLog, bCompilerError))
 	{
 		// Compilation succeeded
 		Result = FScriptExecutionResult::Success(
@@ -133,6 +159,8 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteCpp(
 		Entry.FilePath = FilePath;
 		AddToHistory(Entry);
 
+		CppCompileCache.Add(SourceHash, { Result, FilePath });
+
 		return Result;
 	}
 
@@ -155,6 +183,13 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteCpp(
 	Entry.FilePath = FilePath;
 	AddToHistory(Entry);
 
+	// Compiler errors are deterministic for identical source, so they cache
+	// too; environment failures (Live Coding off, timeout) must not stick
+	if (bCompilerError)
+	{
+		CppCompileCache.Add(SourceHash, { Result, FilePath });
+	}
+
 	return Result;
 #else
 	return FScriptExecutionResult::Error(TEXT("Live Coding not available - C++ scripts cannot be compiled"));
@@ -227,8 +262,9 @@ public:
 	}
 };
 
-bool FScriptExecutionManager::TriggerLiveCodingCompile(FString& OutErrorLog)
+bool FScriptExecutionManager::TriggerLiveCodingCompile(FString& OutErrorLog, bool& bOutCompilerError)
 {
+	bOutCompilerError = false;
 #if WITH_LIVE_CODING
 	ILiveCodingModule* LiveCoding = FModuleManager::GetModulePtr<ILiveCodingModule>("LiveCoding");
 	if (!LiveCoding)
@@ -274,6 +310,7 @@ bool FScriptExecutionManager::TriggerLiveCodingCompile(FString& OutErrorLog)
 	// Check for compilation errors captured from output log
 	if (OutputCapture.bHasErrors)
 	{
+		bOutCompilerError = true;
 		OutErrorLog = OutputCapture.GetErrorSummary();
 		UE_LOG(LogUnrealClaude, Error, TEXT("Live Coding compilation failed:\n%s"), *OutErrorLog);
 		return false;
@@ -287,9 +324,68 @@ bool FScriptExecutionManager::TriggerLiveCodingCompile(FString& OutErrorLog)
 #endif
 }
 
+FString FScriptExecutionManager::HashNormalizedSource(const FString& ScriptContent)
+{
+	TArray<FString> Lines;
+	ScriptContent.ParseIntoArrayLines(Lines, false);
+
+	FString Normalized;
+	Normalized.Reserve(ScriptContent.Len());
+	for (FString& Line : Lines)
+	{
+		Line.TrimStartAndEndInline();
+
+		// Header metadata changes per submission without changing the code
+		if (Line.Contains(TEXT("@UnrealClaude")) || Line.Contains(TEXT("@Name:")) ||
+			Line.Contains(TEXT("@Description:")) || Line.Contains(TEXT("@Created:")))
+		{
+			continue;
+		}
+
+		if (!Line.IsEmpty())
+		{
+			Normalized += Line;
+			Normalized += TEXT("\n");
+		}
+	}
+
+	FTCHARToUTF8 Utf8(*Normalized);
+	FMD5 Md5;
+	Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	uint8 Digest[16];
+	Md5.Final(Digest);
+	return BytesToHex(Digest, 16);
+}
+
+/**
+ * Output capture that also forwards every line to a streaming sink as it
+ * arrives, so long scripts surface progress before they finish
+ */
+class FStreamingOutputDevice : public FUnrealClaudeOutputDevice
+{
+public:
+	explicit FStreamingOutputDevice(const FScriptExecutionManager::FScriptOutputSink& InSink)
+		: Sink(InSink)
+	{
+	}
+
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+	{
+		FUnrealClaudeOutputDevice::Serialize(V, Verbosity, Category);
+		if (Sink)
+		{
+			Sink(FString(V) + TEXT("\n"));
+		}
+	}
+
+private:
+	FScriptExecutionManager::FScriptOutputSink Sink;
+};
+
 FScriptExecutionResult FScriptExecutionManager::ExecutePython(
 	const FString& ScriptContent,
-	const FString& Description)
+	const FString& Description,
+	const FScriptOutputSink& OutputSink)
 {
 	// Check if editor is available
 	if (!GEditor)
@@ -312,24 +408,51 @@ FScriptExecutionResult FScriptExecutionManager::ExecutePython(
 		return FScriptExecutionResult::Error(TEXT("Failed to write Python script file"));
 	}
 
-	// Execute via console command
-	FString Command = FString::Printf(TEXT("py \"%s\""), *FilePath);
+	// In persistent mode the script runs through a driver that executes it
+	// inside a long-lived namespace, so imports and helper definitions from
+	// earlier calls are already there instead of being re-paid every run
+	FString Command;
+	if (bPersistentPythonContext)
+	{
+		const FString DriverPath = EnsurePythonDriverScript();
+		if (!DriverPath.IsEmpty())
+		{
+			Command = FString::Printf(TEXT("py \"%s\" \"%s\""), *DriverPath, *FilePath);
+		}
+	}
+	if (Command.IsEmpty())
+	{
+		Command = FString::Printf(TEXT("py \"%s\""), *FilePath);
+	}
 
-	// Capture output using shared utility
-	FUnrealClaudeOutputDevice OutputDevice;
-	GEditor->Exec(World, *Command, OutputDevice);
+	// Capture output, forwarding each line to the sink while the script runs.
+	// The scoped log device catches the side effects that only reach the
+	// global log (Python tracebacks, subsystem warnings), so the result
+	// carries everything the execution produced without a get_output_log pass
+	FString LogOutput;
+	FStreamingOutputDevice OutputDevice(OutputSink);
+	{
+		FUnrealClaudeScopedLogCapture LogCapture(OutputSink);
+		GEditor->Exec(World, *Command, OutputDevice);
+		LogOutput = LogCapture.GetCaptured();
+	}
 
 	FString Output = OutputDevice.GetTrimmedOutput();
 
-	// Detect Python errors in output
-	bool bHasError = Output.Contains(TEXT("Traceback")) ||
-	                 Output.Contains(TEXT("Error:")) ||
-	                 Output.Contains(TEXT("SyntaxError")) ||
-	                 Output.Contains(TEXT("NameError")) ||
-	                 Output.Contains(TEXT("TypeError")) ||
-	                 Output.Contains(TEXT("ValueError")) ||
-	                 Output.Contains(TEXT("ImportError")) ||
-	                 Output.Contains(TEXT("AttributeError"));
+	// Detect Python errors in output. Tracebacks can surface only in the
+	// captured log (routed through LogPython), so both buffers are scanned
+	auto ContainsPythonError = [](const FString& Text)
+	{
+		return Text.Contains(TEXT("Traceback")) ||
+		       Text.Contains(TEXT("Error:")) ||
+		       Text.Contains(TEXT("SyntaxError")) ||
+		       Text.Contains(TEXT("NameError")) ||
+		       Text.Contains(TEXT("TypeError")) ||
+		       Text.Contains(TEXT("ValueError")) ||
+		       Text.Contains(TEXT("ImportError")) ||
+		       Text.Contains(TEXT("AttributeError"));
+	};
+	bool bHasError = ContainsPythonError(Output) || ContainsPythonError(LogOutput);
 
 	// Add to history
 	FScriptHistoryEntry Entry;
@@ -343,21 +466,90 @@ FScriptExecutionResult FScriptExecutionManager::ExecutePython(
 
 	if (bHasError)
 	{
-		return FScriptExecutionResult::Error(
+		FScriptExecutionResult ErrorResult = FScriptExecutionResult::Error(
 			TEXT("Python script execution failed"),
-			Output
+			Output.IsEmpty() ? LogOutput : Output
 		);
+		ErrorResult.LogOutput = LogOutput;
+		return ErrorResult;
 	}
 
-	return FScriptExecutionResult::Success(
+	FScriptExecutionResult Result = FScriptExecutionResult::Success(
 		TEXT("Python script executed"),
 		Output
 	);
+	Result.LogOutput = LogOutput;
+	return Result;
+}
+
+FString FScriptExecutionManager::EnsurePythonDriverScript()
+{
+	const FString DriverPath = FPaths::Combine(GetContentScriptDirectory(), TEXT("_persistent_context_driver.py"));
+
+	// Cleanup deletes the script directory wholesale, so existence is checked
+	// every call and the driver regenerates on demand
+	if (IFileManager::Get().FileExists(*DriverPath))
+	{
+		return DriverPath;
+	}
+
+	// The namespace lives in sys.modules, which survives across `py` console
+	// invocations inside the editor's embedded interpreter
+	static const TCHAR* DriverSource = TEXT(R"("""
+@UnrealClaude Script
+@Name: _persistent_context_driver
+@Description: Executes UnrealClaude Python scripts inside a persistent namespace
+"""
+import sys
+import types
+
+_NS_NAME = '_unrealclaude_persistent_ns'
+
+_ns = sys.modules.get(_NS_NAME)
+if _ns is None:
+	_ns = types.ModuleType(_NS_NAME)
+	sys.modules[_NS_NAME] = _ns
+
+_script_path = sys.argv[1]
+with open(_script_path, 'r', encoding='utf-8') as _f:
+	_source = _f.read()
+exec(compile(_source, _script_path, 'exec'), _ns.__dict__)
+)");
+
+	if (!FFileHelper::SaveStringToFile(DriverSource, *DriverPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to write Python driver script: %s"), *DriverPath);
+		return FString();
+	}
+
+	return DriverPath;
+}
+
+FScriptExecutionResult FScriptExecutionManager::ResetPythonContext()
+{
+	if (!GEditor)
+	{
+		return FScriptExecutionResult::Error(TEXT("Editor not available"));
+	}
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	if (!World)
+	{
+		return FScriptExecutionResult::Error(TEXT("No active world"));
+	}
+
+	// Dropping the module entry discards every cached import and helper
+	FUnrealClaudeOutputDevice OutputDevice;
+	GEditor->Exec(World, TEXT("py import sys; sys.modules.pop('_unrealclaude_persistent_ns', None)"), OutputDevice);
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Persistent Python context reset"));
+	return FScriptExecutionResult::Success(TEXT("Persistent Python context reset"));
 }
 
 FScriptExecutionResult FScriptExecutionManager::ExecuteConsole(
 	const FString& ScriptContent,
-	const FString& Description)
+	const FString& Description,
+	const FScriptOutputSink& OutputSink)
 {
 	if (!GEditor)
 	{
@@ -374,8 +566,10 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteConsole(
 	TArray<FString> Commands;
 	ScriptContent.ParseIntoArrayLines(Commands, true);
 
-	// Output capture using shared utility
+	// Output capture using shared utility; the scoped log device catches the
+	// side effects commands log instead of writing to their archive
 	FUnrealClaudeOutputDevice OutputDevice;
+	FUnrealClaudeScopedLogCapture LogCapture(OutputSink);
 	FString AllOutput;
 	int32 ExecutedCount = 0;
 
@@ -406,7 +600,12 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteConsole(
 
 		OutputDevice.Clear();
 		GEditor->Exec(World, *Command, OutputDevice);
-		AllOutput += FString::Printf(TEXT("> %s\n%s\n"), *Command, *OutputDevice.GetTrimmedOutput());
+		const FString CommandOutput = FString::Printf(TEXT("> %s\n%s\n"), *Command, *OutputDevice.GetTrimmedOutput());
+		AllOutput += CommandOutput;
+		if (OutputSink)
+		{
+			OutputSink(CommandOutput);
+		}
 		ExecutedCount++;
 	}
 
@@ -420,10 +619,12 @@ FScriptExecutionResult FScriptExecutionManager::ExecuteConsole(
 	AddToHistory(Entry);
 	ScriptCounter++;
 
-	return FScriptExecutionResult::Success(
+	FScriptExecutionResult Result = FScriptExecutionResult::Success(
 		FString::Printf(TEXT("Executed %d console commands"), ExecutedCount),
 		AllOutput
 	);
+	Result.LogOutput = LogCapture.GetCaptured();
+	return Result;
 }
 
 FScriptExecutionResult FScriptExecutionManager::ExecuteEditorUtility(
@@ -514,26 +715,50 @@ FString FScriptExecutionManager::GenerateScriptName(EScriptType Type, const FStr
 
 void FScriptExecutionManager::AddToHistory(const FScriptHistoryEntry& Entry)
 {
+	AppendHistoryRecord(Entry);
+
 	History.Add(Entry);
 
-	// Trim if exceeds max
+	// Only the in-memory tail is bounded; the on-disk store keeps everything
+	// until cleanup and is reached through the offset index
 	while (History.Num() > MaxHistorySize)
 	{
 		History.RemoveAt(0);
 	}
-
-	// Auto-save
-	SaveHistory();
 }
 
 TArray<FScriptHistoryEntry> FScriptExecutionManager::GetRecentScripts(int32 Count) const
 {
 	TArray<FScriptHistoryEntry> Recent;
-	int32 StartIdx = FMath::Max(0, History.Num() - Count);
 
-	for (int32 i = History.Num() - 1; i >= StartIdx; --i)
+	if (Count <= History.Num() || History.Num() == EntryOffsets.Num())
 	{
-		Recent.Add(History[i]);
+		// The request fits in the resident tail - no disk access
+		int32 StartIdx = FMath::Max(0, History.Num() - Count);
+		for (int32 i = History.Num() - 1; i >= StartIdx; --i)
+		{
+			Recent.Add(History[i]);
+		}
+		return Recent;
+	}
+
+	// Seek straight to the oldest requested record via the offset index and
+	// parse only the tail - the store is never replayed from the start
+	const int32 StartEntry = FMath::Max(0, EntryOffsets.Num() - Count);
+	TArray<FScriptHistoryEntry> Tail;
+	if (!ReadEntriesFromOffset(EntryOffsets[StartEntry], Tail))
+	{
+		// Store unreadable - fall back to whatever is resident
+		for (int32 i = History.Num() - 1; i >= 0; --i)
+		{
+			Recent.Add(History[i]);
+		}
+		return Recent;
+	}
+
+	for (int32 i = Tail.Num() - 1; i >= 0; --i)
+	{
+		Recent.Add(Tail[i]);
 	}
 
 	return Recent;
@@ -569,43 +794,223 @@ FString FScriptExecutionManager::FormatHistoryForContext(int32 Count) const
 void FScriptExecutionManager::ClearHistory()
 {
 	History.Empty();
-	SaveHistory();
+	EntryOffsets.Empty();
+
+	// Truncation is just deleting two files - no rewrite of surviving data
+	IFileManager::Get().Delete(*GetHistoryDataFilePath());
+	IFileManager::Get().Delete(*GetHistoryIndexFilePath());
+	IFileManager::Get().Delete(*GetHistoryFilePath());
 }
 
 bool FScriptExecutionManager::SaveHistory()
 {
-	FString HistoryPath = GetHistoryFilePath();
-	FString SaveDir = FPaths::GetPath(HistoryPath);
-
+	FString SaveDir = FPaths::GetPath(GetHistoryDataFilePath());
 	if (!IFileManager::Get().DirectoryExists(*SaveDir))
 	{
 		IFileManager::Get().MakeDirectory(*SaveDir, true);
 	}
 
-	TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	TUniquePtr<FArchive> DataWriter(IFileManager::Get().CreateFileWriter(*GetHistoryDataFilePath()));
+	TUniquePtr<FArchive> IndexWriter(IFileManager::Get().CreateFileWriter(*GetHistoryIndexFilePath()));
+	if (!DataWriter.IsValid() || !IndexWriter.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to open script history store for writing"));
+		return false;
+	}
 
-	TArray<TSharedPtr<FJsonValue>> ScriptsArray;
+	EntryOffsets.Reset(History.Num());
 	for (const FScriptHistoryEntry& Entry : History)
 	{
-		ScriptsArray.Add(MakeShared<FJsonValueObject>(Entry.ToJson()));
+		int64 Offset = DataWriter->Tell();
+		const FString Record = FJsonUtils::Stringify(Entry.ToJson()) + TEXT("\n");
+		FTCHARToUTF8 Utf8(*Record);
+		DataWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+		IndexWriter->Serialize(&Offset, sizeof(Offset));
+		EntryOffsets.Add(Offset);
 	}
 
-	RootObject->SetArrayField(TEXT("scripts"), ScriptsArray);
-	RootObject->SetStringField(TEXT("last_updated"), FDateTime::UtcNow().ToString(TEXT("%Y-%m-%dT%H:%M:%SZ")));
+	UE_LOG(LogUnrealClaude, Log, TEXT("Script history store rewritten: %d entries"), History.Num());
+	return true;
+}
 
-	FString JsonString = FJsonUtils::Stringify(RootObject, true);
+bool FScriptExecutionManager::LoadHistory()
+{
+	const FString DataPath = GetHistoryDataFilePath();
 
-	if (FFileHelper::SaveStringToFile(JsonString, *HistoryPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	if (!IFileManager::Get().FileExists(*DataPath))
 	{
-		UE_LOG(LogUnrealClaude, Log, TEXT("Script history saved: %d entries"), History.Num());
-		return true;
+		// First run with the indexed store - import the legacy log if present
+		return MigrateLegacyHistory();
 	}
 
-	UE_LOG(LogUnrealClaude, Error, TEXT("Failed to save script history to: %s"), *HistoryPath);
-	return false;
+	// The index is 8 bytes per record, so loading it whole stays cheap even
+	// for stores with tens of thousands of entries; record bodies are not read
+	EntryOffsets.Empty();
+	bool bIndexValid = false;
+	const int64 DataSize = IFileManager::Get().FileSize(*DataPath);
+
+	{
+		TUniquePtr<FArchive> IndexReader(IFileManager::Get().CreateFileReader(*GetHistoryIndexFilePath()));
+		if (IndexReader.IsValid())
+		{
+			const int64 IndexSize = IndexReader->TotalSize();
+			if (IndexSize % sizeof(int64) == 0)
+			{
+				EntryOffsets.SetNumUninitialized(IntCastChecked<int32>(IndexSize / sizeof(int64)));
+				IndexReader->Serialize(EntryOffsets.GetData(), IndexSize);
+
+				// Offsets must be strictly increasing and inside the data file
+				bIndexValid = true;
+				for (int32 i = 0; i < EntryOffsets.Num() && bIndexValid; ++i)
+				{
+					const int64 Prev = (i == 0) ? -1 : EntryOffsets[i - 1];
+					bIndexValid = EntryOffsets[i] > Prev && EntryOffsets[i] < DataSize;
+				}
+			}
+		}
+	}
+
+	if (!bIndexValid && !RebuildHistoryIndex())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to index script history data file"));
+		return false;
+	}
+
+	// Only the recent tail becomes resident; seek straight to it
+	History.Empty();
+	if (EntryOffsets.Num() > 0)
+	{
+		const int32 StartEntry = FMath::Max(0, EntryOffsets.Num() - MaxHistorySize);
+		ReadEntriesFromOffset(EntryOffsets[StartEntry], History);
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Loaded script history: %d entries in store, %d resident"),
+		EntryOffsets.Num(), History.Num());
+	return true;
 }
 
-bool FScriptExecutionManager::LoadHistory()
+bool FScriptExecutionManager::AppendHistoryRecord(const FScriptHistoryEntry& Entry)
+{
+	const FString DataPath = GetHistoryDataFilePath();
+	FString SaveDir = FPaths::GetPath(DataPath);
+	if (!IFileManager::Get().DirectoryExists(*SaveDir))
+	{
+		IFileManager::Get().MakeDirectory(*SaveDir, true);
+	}
+
+	TUniquePtr<FArchive> DataWriter(IFileManager::Get().CreateFileWriter(*DataPath, FILEWRITE_Append));
+	if (!DataWriter.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Error, TEXT("Failed to append to script history: %s"), *DataPath);
+		return false;
+	}
+
+	int64 Offset = DataWriter->Tell();
+	const FString Record = FJsonUtils::Stringify(Entry.ToJson()) + TEXT("\n");
+	FTCHARToUTF8 Utf8(*Record);
+	DataWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	DataWriter.Reset();
+
+	TUniquePtr<FArchive> IndexWriter(IFileManager::Get().CreateFileWriter(*GetHistoryIndexFilePath(), FILEWRITE_Append));
+	if (!IndexWriter.IsValid())
+	{
+		// Data record landed but the index write failed; the next load
+		// notices the mismatch and rebuilds the index from the data file
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to append script history index entry"));
+		EntryOffsets.Add(Offset);
+		return false;
+	}
+	IndexWriter->Serialize(&Offset, sizeof(Offset));
+
+	EntryOffsets.Add(Offset);
+	return true;
+}
+
+bool FScriptExecutionManager::RebuildHistoryIndex()
+{
+	EntryOffsets.Empty();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetHistoryDataFilePath()));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	// One sequential pass recording where each record line starts
+	const int64 Size = Reader->TotalSize();
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(Size);
+	Reader->Serialize(Bytes.GetData(), Size);
+	Reader.Reset();
+
+	int64 LineStart = 0;
+	for (int64 Pos = 0; Pos < Size; ++Pos)
+	{
+		if (Bytes[Pos] == '\n')
+		{
+			if (Pos > LineStart)
+			{
+				EntryOffsets.Add(LineStart);
+			}
+			LineStart = Pos + 1;
+		}
+	}
+	if (LineStart < Size)
+	{
+		EntryOffsets.Add(LineStart);
+	}
+
+	TUniquePtr<FArchive> IndexWriter(IFileManager::Get().CreateFileWriter(*GetHistoryIndexFilePath()));
+	if (IndexWriter.IsValid())
+	{
+		for (int64 Offset : EntryOffsets)
+		{
+			IndexWriter->Serialize(&Offset, sizeof(Offset));
+		}
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Rebuilt script history index: %d entries"), EntryOffsets.Num());
+	return true;
+}
+
+bool FScriptExecutionManager::ReadEntriesFromOffset(int64 Offset, TArray<FScriptHistoryEntry>& OutEntries) const
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetHistoryDataFilePath()));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	const int64 Size = Reader->TotalSize();
+	if (Offset < 0 || Offset >= Size)
+	{
+		return false;
+	}
+
+	const int64 BytesToRead = Size - Offset;
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(BytesToRead + 1);
+	Reader->Seek(Offset);
+	Reader->Serialize(Bytes.GetData(), BytesToRead);
+	Bytes[BytesToRead] = 0;
+
+	FString Content = FString(UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Bytes.GetData())));
+	TArray<FString> Lines;
+	Content.ParseIntoArrayLines(Lines, true);
+
+	for (const FString& Line : Lines)
+	{
+		TSharedPtr<FJsonObject> Record = FJsonUtils::Parse(Line);
+		if (Record.IsValid())
+		{
+			OutEntries.Add(FScriptHistoryEntry::FromJson(Record));
+		}
+	}
+
+	return true;
+}
+
+bool FScriptExecutionManager::MigrateLegacyHistory()
 {
 	FString HistoryPath = GetHistoryFilePath();
 
@@ -644,7 +1049,14 @@ bool FScriptExecutionManager::LoadHistory()
 		}
 	}
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("Loaded script history: %d entries"), History.Num());
+	// The legacy log was bounded by MaxHistorySize, so a full rewrite into
+	// the indexed store is lossless
+	if (SaveHistory())
+	{
+		IFileManager::Get().Delete(*HistoryPath);
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Migrated legacy script history: %d entries"), History.Num());
 	return true;
 }
 
@@ -693,6 +1105,9 @@ FString FScriptExecutionManager::CleanupAll()
 	int32 HistoryCount = History.Num();
 	ClearHistory();
 
+	// Cached compile outcomes reference the deleted files; drop them too
+	CppCompileCache.Empty();
+
 	return FString::Printf(TEXT("Cleanup complete: Deleted %d files, cleared %d history entries"), DeletedFiles, HistoryCount);
 }
 
@@ -701,6 +1116,16 @@ FString FScriptExecutionManager::GetHistoryFilePath() const
 	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("script_history.json"));
 }
 
+FString FScriptExecutionManager::GetHistoryDataFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("script_history.jsonl"));
+}
+
+FString FScriptExecutionManager::GetHistoryIndexFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("script_history.idx"));
+}
+
 FString FScriptExecutionManager::GetCppScriptDirectory() const
 {
 	// Source/[ProjectName]/Generated/UnrealClaude/
@@ -13,6 +13,10 @@
 #include "MCP/Tools/MCPTool_AssetReferencers.h"
 #include "Dom/JsonObject.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "MCP/MCPAssetGraphCache.h"
+#include "MCP/MCPFactoryPool.h"
+#include "Factories/BlueprintFactory.h"
+#include "Factories/MaterialInstanceConstantFactoryNew.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -512,4 +516,163 @@ bool FMCPTool_AssetSearch_ClassNameResolution::RunTest(const FString& Parameters
 	return true;
 }
 
+// ===== Asset Graph Cache Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPAssetGraphCache_RepeatLookupConsistent,
+	"UnrealClaude.MCP.AssetGraphCache.RepeatLookupConsistent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPAssetGraphCache_RepeatLookupConsistent::RunTest(const FString& Parameters)
+{
+	FMCPAssetGraphCache& Cache = FMCPAssetGraphCache::Get();
+	Cache.InvalidateAll();
+	TestEqual("Cache should be empty after InvalidateAll", Cache.GetCachedPackageCount(), 0);
+
+	// Pick any package from /Game; a project without content is a valid pass
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	TArray<FAssetData> GameAssets;
+	AssetRegistryModule.Get().GetAssetsByPath(TEXT("/Game"), GameAssets, true);
+	if (GameAssets.Num() == 0)
+	{
+		return true;
+	}
+
+	const FName PackageName = GameAssets[0].PackageName;
+
+	// First lookup walks the registry and populates the cache
+	TArray<FName> FirstResult;
+	Cache.GetDependencies(PackageName, false, FirstResult);
+	TestTrue("Package should be cached after first lookup", Cache.GetCachedPackageCount() > 0);
+
+	// Second lookup is served from cache and must match
+	TArray<FName> SecondResult;
+	Cache.GetDependencies(PackageName, false, SecondResult);
+	TestEqual("Cached result should match fresh result", SecondResult, FirstResult);
+
+	Cache.InvalidateAll();
+	TestEqual("InvalidateAll should drop cached packages", Cache.GetCachedPackageCount(), 0);
+
+	return true;
+}
+
+// ===== Factory Pool Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPFactoryPool_RecyclesInstances,
+	"UnrealClaude.MCP.FactoryPool.RecyclesInstances",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPFactoryPool_RecyclesInstances::RunTest(const FString& Parameters)
+{
+	FMCPFactoryPool& Pool = FMCPFactoryPool::Get();
+	Pool.ReleaseAll();
+
+	// Repeat fetches of the same factory class hand back the one warm instance
+	UBlueprintFactory* First = Pool.GetFactory<UBlueprintFactory>();
+	TestNotNull("Pool should create a factory on first fetch", First);
+	UBlueprintFactory* Second = Pool.GetFactory<UBlueprintFactory>();
+	TestTrue("Second fetch should recycle the pooled instance", First == Second);
+
+	// Distinct factory classes get distinct pooled instances
+	UMaterialInstanceConstantFactoryNew* MaterialFactory = Pool.GetFactory<UMaterialInstanceConstantFactoryNew>();
+	TestNotNull("Pool should create a material factory", MaterialFactory);
+	TestTrue("Factory classes should not share instances", (UFactory*)First != (UFactory*)MaterialFactory);
+
+	// After an explicit release the pool starts over with a fresh instance
+	Pool.ReleaseAll();
+	UBlueprintFactory* AfterRelease = Pool.GetFactory<UBlueprintFactory>();
+	TestNotNull("Pool should repopulate after release", AfterRelease);
+
+	Pool.ReleaseAll();
+	return true;
+}
+
+// ===== Asset Watch Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_AssetWatch_Lifecycle,
+	"UnrealClaude.MCP.Tools.AssetWatch.Lifecycle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_AssetWatch_Lifecycle::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("asset_watch"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	// Create a watch over /Game blueprints
+	TSharedRef<FJsonObject> CreateParams = MakeShared<FJsonObject>();
+	CreateParams->SetStringField(TEXT("action"), TEXT("create"));
+	CreateParams->SetStringField(TEXT("class_filter"), TEXT("Blueprint"));
+	FMCPToolResult CreateResult = Tool->Execute(CreateParams);
+	TestTrue("Create should succeed", CreateResult.bSuccess);
+	if (!CreateResult.bSuccess || !CreateResult.Data.IsValid()) return false;
+
+	FString WatchId;
+	TestTrue("Create should return watch_id",
+		CreateResult.Data->TryGetStringField(TEXT("watch_id"), WatchId) && !WatchId.IsEmpty());
+
+	// A fresh watch has no deltas
+	TSharedRef<FJsonObject> PollParams = MakeShared<FJsonObject>();
+	PollParams->SetStringField(TEXT("action"), TEXT("poll"));
+	PollParams->SetStringField(TEXT("watch_id"), WatchId);
+	FMCPToolResult PollResult = Tool->Execute(PollParams);
+	TestTrue("Poll should succeed", PollResult.bSuccess);
+	if (PollResult.Data.IsValid())
+	{
+		TestTrue("Poll should have 'added' array", PollResult.Data->HasField(TEXT("added")));
+		TestTrue("Poll should have 'removed' array", PollResult.Data->HasField(TEXT("removed")));
+		TestTrue("Poll should have 'overflowed' field", PollResult.Data->HasField(TEXT("overflowed")));
+		TestEqual("Fresh watch should have no added deltas",
+			PollResult.Data->GetArrayField(TEXT("added")).Num(), 0);
+	}
+
+	// Cancel removes the watch; a second cancel reports it unknown
+	TSharedRef<FJsonObject> CancelParams = MakeShared<FJsonObject>();
+	CancelParams->SetStringField(TEXT("action"), TEXT("cancel"));
+	CancelParams->SetStringField(TEXT("watch_id"), WatchId);
+	TestTrue("Cancel should succeed", Tool->Execute(CancelParams).bSuccess);
+	TestFalse("Second cancel should fail", Tool->Execute(CancelParams).bSuccess);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_AssetWatch_InvalidRequests,
+	"UnrealClaude.MCP.Tools.AssetWatch.InvalidRequests",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_AssetWatch_InvalidRequests::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("asset_watch"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	// Unknown action
+	TSharedRef<FJsonObject> BadAction = MakeShared<FJsonObject>();
+	BadAction->SetStringField(TEXT("action"), TEXT("subscribe"));
+	TestFalse("Unknown action should fail", Tool->Execute(BadAction).bSuccess);
+
+	// Poll of a made-up token
+	TSharedRef<FJsonObject> BadPoll = MakeShared<FJsonObject>();
+	BadPoll->SetStringField(TEXT("action"), TEXT("poll"));
+	BadPoll->SetStringField(TEXT("watch_id"), TEXT("not-a-watch"));
+	TestFalse("Unknown watch poll should fail", Tool->Execute(BadPoll).bSuccess);
+
+	// Poll without a watch_id
+	TSharedRef<FJsonObject> NoId = MakeShared<FJsonObject>();
+	NoId->SetStringField(TEXT("action"), TEXT("poll"));
+	TestFalse("Poll without watch_id should fail", Tool->Execute(NoId).bSuccess);
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
+
@@ -0,0 +1,154 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * Case-level parallel execution for automation tests.
+ *
+ * The automation framework runs each test serially on the game thread, so
+ * the only wall time the plugin controls is what a single test spends on
+ * its own cases. Suites built from many independent cases (validator
+ * sweeps, per-tool metadata checks, registry probes) register each case
+ * with a set and dispatch them across the task graph in one ParallelFor.
+ *
+ * Registering a case is its no-shared-state declaration: the body may only
+ * touch its own captures, its FMCPTestCaseContext, and structures that are
+ * internally thread-safe (the registry's locked maps, static pure
+ * validators). Cases that mutate engine state - worlds, the asset
+ * registry, live actors - stay as ordinary serial tests.
+ *
+ * Assertion results are buffered per case (FAutomationTestBase's error
+ * reporting is not thread-safe) and replayed onto the owning test on the
+ * calling thread after the dispatch, prefixed with the case name so a
+ * failure still points at one case.
+ */
+class FMCPTestCaseContext
+{
+public:
+	explicit FMCPTestCaseContext(const FString& InCaseName)
+		: CaseName(InCaseName)
+	{
+	}
+
+	void TestTrue(const FString& What, bool bValue)
+	{
+		if (!bValue)
+		{
+			Failures.Add(FString::Printf(TEXT("Expected '%s' to be true"), *What));
+		}
+	}
+
+	void TestFalse(const FString& What, bool bValue)
+	{
+		if (bValue)
+		{
+			Failures.Add(FString::Printf(TEXT("Expected '%s' to be false"), *What));
+		}
+	}
+
+	void TestNotNull(const FString& What, const void* Pointer)
+	{
+		if (Pointer == nullptr)
+		{
+			Failures.Add(FString::Printf(TEXT("Expected '%s' to be non-null"), *What));
+		}
+	}
+
+	void TestNull(const FString& What, const void* Pointer)
+	{
+		if (Pointer != nullptr)
+		{
+			Failures.Add(FString::Printf(TEXT("Expected '%s' to be null"), *What));
+		}
+	}
+
+	void TestEqual(const FString& What, const FString& Actual, const FString& Expected)
+	{
+		if (!Actual.Equals(Expected))
+		{
+			Failures.Add(FString::Printf(TEXT("Expected '%s' to be '%s', but it was '%s'"),
+				*What, *Expected, *Actual));
+		}
+	}
+
+	template <typename ValueType>
+	void TestEqual(const FString& What, const ValueType& Actual, const ValueType& Expected)
+	{
+		if (!(Actual == Expected))
+		{
+			Failures.Add(FString::Printf(TEXT("Expected '%s' to be '%s', but it was '%s'"),
+				*What, *LexToString(Expected), *LexToString(Actual)));
+		}
+	}
+
+	/**
+	 * Unique transient package path for cases that create objects, so the
+	 * same case running in another worker context (or another automation
+	 * worker instance sharing the project) never collides on a name
+	 */
+	FString MakeUniquePackagePath(const FString& Hint) const
+	{
+		return FString::Printf(TEXT("/Temp/UnrealClaudeTests/%s_%s"),
+			*Hint, *FGuid::NewGuid().ToString(EGuidFormats::Short));
+	}
+
+	const FString& GetCaseName() const { return CaseName; }
+	const TArray<FString>& GetFailures() const { return Failures; }
+
+private:
+	FString CaseName;
+
+	/** Written only by the case's own worker; replayed after the dispatch */
+	TArray<FString> Failures;
+};
+
+class FMCPParallelCaseSet
+{
+public:
+	/** Register one independent case; the body runs on an arbitrary worker */
+	void Add(const FString& Name, TFunction<void(FMCPTestCaseContext&)> Body)
+	{
+		Cases.Emplace(Name, MoveTemp(Body));
+	}
+
+	/**
+	 * Dispatch every case across the task graph, then replay buffered
+	 * failures onto the owning test.
+	 * @return true if no case recorded a failure
+	 */
+	bool RunAll(FAutomationTestBase& Test)
+	{
+		TArray<FMCPTestCaseContext> Contexts;
+		Contexts.Reserve(Cases.Num());
+		for (const TPair<FString, TFunction<void(FMCPTestCaseContext&)>>& Case : Cases)
+		{
+			Contexts.Emplace(Case.Key);
+		}
+
+		// Unbalanced: cases are tiny and uneven; per-item stealing beats
+		// pre-chunking when one case (e.g. a registry materialization) is
+		// much slower than the rest
+		ParallelFor(Cases.Num(), [this, &Contexts](int32 Index)
+		{
+			Cases[Index].Value(Contexts[Index]);
+		}, EParallelForFlags::Unbalanced);
+
+		bool bAllPassed = true;
+		for (const FMCPTestCaseContext& Context : Contexts)
+		{
+			for (const FString& Failure : Context.GetFailures())
+			{
+				Test.AddError(FString::Printf(TEXT("[%s] %s"), *Context.GetCaseName(), *Failure));
+				bAllPassed = false;
+			}
+		}
+		return bAllPassed;
+	}
+
+private:
+	TArray<TPair<FString, TFunction<void(FMCPTestCaseContext&)>>> Cases;
+};
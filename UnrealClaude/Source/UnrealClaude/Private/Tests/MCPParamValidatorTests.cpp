@@ -3,10 +3,16 @@
 /**
  * Unit tests for MCPParamValidator
  * Tests security-critical validation logic for MCP tool parameters
+ *
+ * The validators are pure static functions, so every input in a sweep is
+ * an independent case: each test registers its inputs with a parallel
+ * case set and dispatches them across the task graph instead of walking
+ * them serially on the game thread.
  */
 
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
+#include "MCPParallelTestHarness.h"
 #include "MCP/MCPParamValidator.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -21,16 +27,24 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateActorName_ValidNames::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Valid simple names
-	TestTrue("Simple name should be valid", FMCPParamValidator::ValidateActorName(TEXT("MyActor"), Error));
-	TestTrue("Name with numbers should be valid", FMCPParamValidator::ValidateActorName(TEXT("Actor123"), Error));
-	TestTrue("Name with underscore should be valid", FMCPParamValidator::ValidateActorName(TEXT("My_Actor"), Error));
-	TestTrue("Name with dash should be valid", FMCPParamValidator::ValidateActorName(TEXT("My-Actor"), Error));
-	TestTrue("Name with spaces should be valid", FMCPParamValidator::ValidateActorName(TEXT("My Actor"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Name; } ValidNames[] = {
+		{ TEXT("Simple name should be valid"), TEXT("MyActor") },
+		{ TEXT("Name with numbers should be valid"), TEXT("Actor123") },
+		{ TEXT("Name with underscore should be valid"), TEXT("My_Actor") },
+		{ TEXT("Name with dash should be valid"), TEXT("My-Actor") },
+		{ TEXT("Name with spaces should be valid"), TEXT("My Actor") },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : ValidNames)
+	{
+		Cases.Add(Entry.Name, [What = Entry.What, Name = Entry.Name](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			Context.TestTrue(What, FMCPParamValidator::ValidateActorName(Name, Error));
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -41,29 +55,41 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateActorName_InvalidNames::RunTest(const FString& Parameters)
 {
-	FString Error;
+	FMCPParallelCaseSet Cases;
 
-	// Empty name
-	TestFalse("Empty name should be invalid", FMCPParamValidator::ValidateActorName(TEXT(""), Error));
-	TestTrue("Error message for empty name", Error.Contains(TEXT("empty")));
+	Cases.Add(TEXT("EmptyName"), [](FMCPTestCaseContext& Context)
+	{
+		FString Error;
+		Context.TestFalse(TEXT("Empty name should be invalid"), FMCPParamValidator::ValidateActorName(TEXT(""), Error));
+		Context.TestTrue(TEXT("Error message for empty name"), Error.Contains(TEXT("empty")));
+	});
 
 	// Names with dangerous characters
-	TestFalse("Name with < should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor<Script>"), Error));
-	TestFalse("Name with > should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor>test"), Error));
-	TestFalse("Name with | should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor|test"), Error));
-	TestFalse("Name with & should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor&test"), Error));
-	TestFalse("Name with ; should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor;drop"), Error));
-	TestFalse("Name with ` should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor`cmd`"), Error));
-	TestFalse("Name with $ should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor$var"), Error));
-	TestFalse("Name with ( should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor(test)"), Error));
-	TestFalse("Name with { should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor{test}"), Error));
-	TestFalse("Name with [ should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor[0]"), Error));
-	TestFalse("Name with ! should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor!"), Error));
-	TestFalse("Name with * should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor*"), Error));
-	TestFalse("Name with ? should be invalid", FMCPParamValidator::ValidateActorName(TEXT("Actor?"), Error));
-	TestFalse("Name with ~ should be invalid", FMCPParamValidator::ValidateActorName(TEXT("~Actor"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Name; } InvalidNames[] = {
+		{ TEXT("Name with < should be invalid"), TEXT("Actor<Script>") },
+		{ TEXT("Name with > should be invalid"), TEXT("Actor>test") },
+		{ TEXT("Name with | should be invalid"), TEXT("Actor|test") },
+		{ TEXT("Name with & should be invalid"), TEXT("Actor&test") },
+		{ TEXT("Name with ; should be invalid"), TEXT("Actor;drop") },
+		{ TEXT("Name with ` should be invalid"), TEXT("Actor`cmd`") },
+		{ TEXT("Name with $ should be invalid"), TEXT("Actor$var") },
+		{ TEXT("Name with ( should be invalid"), TEXT("Actor(test)") },
+		{ TEXT("Name with { should be invalid"), TEXT("Actor{test}") },
+		{ TEXT("Name with [ should be invalid"), TEXT("Actor[0]") },
+		{ TEXT("Name with ! should be invalid"), TEXT("Actor!") },
+		{ TEXT("Name with * should be invalid"), TEXT("Actor*") },
+		{ TEXT("Name with ? should be invalid"), TEXT("Actor?") },
+		{ TEXT("Name with ~ should be invalid"), TEXT("~Actor") },
+	};
+	for (const auto& Entry : InvalidNames)
+	{
+		Cases.Add(Entry.Name, [What = Entry.What, Name = Entry.Name](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			Context.TestFalse(What, FMCPParamValidator::ValidateActorName(Name, Error));
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -99,24 +125,31 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateConsoleCommand_BlockedCommands::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Test blocked commands
-	TestFalse("quit should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("quit"), Error));
-	TestFalse("exit should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("exit"), Error));
-	TestFalse("crash should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("crash"), Error));
-	TestFalse("forcecrash should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("forcecrash"), Error));
-	TestFalse("shutdown should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("shutdown"), Error));
-
-	// Test case insensitivity
-	TestFalse("QUIT should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("QUIT"), Error));
-	TestFalse("Quit should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("Quit"), Error));
-
-	// Test prefix matching
-	TestFalse("gc.CollectGarbage should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("gc.CollectGarbage"), Error));
-	TestFalse("r.ScreenPercentage should be blocked", FMCPParamValidator::ValidateConsoleCommand(TEXT("r.ScreenPercentage 50"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Command; } Blocked[] = {
+		// Blocked commands
+		{ TEXT("quit should be blocked"), TEXT("quit") },
+		{ TEXT("exit should be blocked"), TEXT("exit") },
+		{ TEXT("crash should be blocked"), TEXT("crash") },
+		{ TEXT("forcecrash should be blocked"), TEXT("forcecrash") },
+		{ TEXT("shutdown should be blocked"), TEXT("shutdown") },
+		// Case insensitivity
+		{ TEXT("QUIT should be blocked"), TEXT("QUIT") },
+		{ TEXT("Quit should be blocked"), TEXT("Quit") },
+		// Prefix matching
+		{ TEXT("gc.CollectGarbage should be blocked"), TEXT("gc.CollectGarbage") },
+		{ TEXT("r.ScreenPercentage should be blocked"), TEXT("r.ScreenPercentage 50") },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : Blocked)
+	{
+		Cases.Add(Entry.Command, [What = Entry.What, Command = Entry.Command](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			Context.TestFalse(What, FMCPParamValidator::ValidateConsoleCommand(Command, Error));
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -127,25 +160,27 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateConsoleCommand_ChainAttempts::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Command chaining attempts
-	TestFalse("Semicolon chaining should be blocked",
-		FMCPParamValidator::ValidateConsoleCommand(TEXT("stat fps; quit"), Error));
-	TestFalse("Pipe chaining should be blocked",
-		FMCPParamValidator::ValidateConsoleCommand(TEXT("stat fps | quit"), Error));
-	TestFalse("AND chaining should be blocked",
-		FMCPParamValidator::ValidateConsoleCommand(TEXT("stat fps && quit"), Error));
-
-	// Shell escape attempts
-	TestFalse("Backtick escape should be blocked",
-		FMCPParamValidator::ValidateConsoleCommand(TEXT("stat `quit`"), Error));
-	TestFalse("$() escape should be blocked",
-		FMCPParamValidator::ValidateConsoleCommand(TEXT("stat $(quit)"), Error));
-	TestFalse("${} escape should be blocked",
-		FMCPParamValidator::ValidateConsoleCommand(TEXT("stat ${quit}"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Command; } Chains[] = {
+		// Command chaining attempts
+		{ TEXT("Semicolon chaining should be blocked"), TEXT("stat fps; quit") },
+		{ TEXT("Pipe chaining should be blocked"), TEXT("stat fps | quit") },
+		{ TEXT("AND chaining should be blocked"), TEXT("stat fps && quit") },
+		// Shell escape attempts
+		{ TEXT("Backtick escape should be blocked"), TEXT("stat `quit`") },
+		{ TEXT("$() escape should be blocked"), TEXT("stat $(quit)") },
+		{ TEXT("${} escape should be blocked"), TEXT("stat ${quit}") },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : Chains)
+	{
+		Cases.Add(Entry.Command, [What = Entry.What, Command = Entry.Command](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			Context.TestFalse(What, FMCPParamValidator::ValidateConsoleCommand(Command, Error));
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -156,15 +191,23 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateConsoleCommand_ValidCommands::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Valid safe commands
-	TestTrue("stat fps should be valid", FMCPParamValidator::ValidateConsoleCommand(TEXT("stat fps"), Error));
-	TestTrue("stat unit should be valid", FMCPParamValidator::ValidateConsoleCommand(TEXT("stat unit"), Error));
-	TestTrue("showlog should be valid", FMCPParamValidator::ValidateConsoleCommand(TEXT("showlog"), Error));
-	TestTrue("show collision should be valid", FMCPParamValidator::ValidateConsoleCommand(TEXT("show collision"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Command; } Valid[] = {
+		{ TEXT("stat fps should be valid"), TEXT("stat fps") },
+		{ TEXT("stat unit should be valid"), TEXT("stat unit") },
+		{ TEXT("showlog should be valid"), TEXT("showlog") },
+		{ TEXT("show collision should be valid"), TEXT("show collision") },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : Valid)
+	{
+		Cases.Add(Entry.Command, [What = Entry.What, Command = Entry.Command](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			Context.TestTrue(What, FMCPParamValidator::ValidateConsoleCommand(Command, Error));
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 // ===== Blueprint Path Validation Tests =====
@@ -177,23 +220,34 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateBlueprintPath_Security::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Block engine Blueprints
-	TestFalse("/Engine/ paths should be blocked",
-		FMCPParamValidator::ValidateBlueprintPath(TEXT("/Engine/EditorBlueprintResources/StandardMacros"), Error));
-	TestFalse("/Script/ paths should be blocked",
-		FMCPParamValidator::ValidateBlueprintPath(TEXT("/Script/Engine.Actor"), Error));
-
-	// Path traversal
-	TestFalse("Path traversal should be blocked",
-		FMCPParamValidator::ValidateBlueprintPath(TEXT("/Game/../Engine/SomeBP"), Error));
-
-	// Valid game paths
-	TestTrue("/Game/ paths should be valid",
-		FMCPParamValidator::ValidateBlueprintPath(TEXT("/Game/Blueprints/BP_MyActor"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Path; bool bExpectValid; } Paths[] = {
+		// Block engine Blueprints
+		{ TEXT("/Engine/ paths should be blocked"), TEXT("/Engine/EditorBlueprintResources/StandardMacros"), false },
+		{ TEXT("/Script/ paths should be blocked"), TEXT("/Script/Engine.Actor"), false },
+		// Path traversal
+		{ TEXT("Path traversal should be blocked"), TEXT("/Game/../Engine/SomeBP"), false },
+		// Valid game paths
+		{ TEXT("/Game/ paths should be valid"), TEXT("/Game/Blueprints/BP_MyActor"), true },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : Paths)
+	{
+		Cases.Add(Entry.Path, [Entry](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			const bool bValid = FMCPParamValidator::ValidateBlueprintPath(Entry.Path, Error);
+			if (Entry.bExpectValid)
+			{
+				Context.TestTrue(Entry.What, bValid);
+			}
+			else
+			{
+				Context.TestFalse(Entry.What, bValid);
+			}
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 // ===== Property Path Validation Tests =====
@@ -206,29 +260,37 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidatePropertyPath_Format::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Valid property paths
-	TestTrue("Simple property should be valid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT("MyProperty"), Error));
-	TestTrue("Nested property should be valid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT("Component.SubProperty"), Error));
-	TestTrue("Property with underscore should be valid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT("My_Property"), Error));
-
-	// Invalid property paths
-	TestFalse("Empty path should be invalid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT(""), Error));
-	TestFalse("Path traversal should be blocked",
-		FMCPParamValidator::ValidatePropertyPath(TEXT("..Parent.Prop"), Error));
-	TestFalse("Leading dot should be invalid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT(".Property"), Error));
-	TestFalse("Trailing dot should be invalid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT("Property."), Error));
-	TestFalse("Special characters should be invalid",
-		FMCPParamValidator::ValidatePropertyPath(TEXT("Property<T>"), Error));
-
-	return true;
+	struct { const TCHAR* What; const TCHAR* Path; bool bExpectValid; } Paths[] = {
+		// Valid property paths
+		{ TEXT("Simple property should be valid"), TEXT("MyProperty"), true },
+		{ TEXT("Nested property should be valid"), TEXT("Component.SubProperty"), true },
+		{ TEXT("Property with underscore should be valid"), TEXT("My_Property"), true },
+		// Invalid property paths
+		{ TEXT("Empty path should be invalid"), TEXT(""), false },
+		{ TEXT("Path traversal should be blocked"), TEXT("..Parent.Prop"), false },
+		{ TEXT("Leading dot should be invalid"), TEXT(".Property"), false },
+		{ TEXT("Trailing dot should be invalid"), TEXT("Property."), false },
+		{ TEXT("Special characters should be invalid"), TEXT("Property<T>"), false },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : Paths)
+	{
+		Cases.Add(Entry.What, [Entry](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			const bool bValid = FMCPParamValidator::ValidatePropertyPath(Entry.Path, Error);
+			if (Entry.bExpectValid)
+			{
+				Context.TestTrue(Entry.What, bValid);
+			}
+			else
+			{
+				Context.TestFalse(Entry.What, bValid);
+			}
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 // ===== Numeric Value Validation Tests =====
@@ -241,29 +303,44 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateNumericValue_EdgeCases::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Valid values
-	TestTrue("Zero should be valid",
-		FMCPParamValidator::ValidateNumericValue(0.0, TEXT("test"), Error));
-	TestTrue("Positive value should be valid",
-		FMCPParamValidator::ValidateNumericValue(100.0, TEXT("test"), Error));
-	TestTrue("Negative value should be valid",
-		FMCPParamValidator::ValidateNumericValue(-100.0, TEXT("test"), Error));
-
-	// Invalid values
-	TestFalse("NaN should be invalid",
-		FMCPParamValidator::ValidateNumericValue(std::numeric_limits<double>::quiet_NaN(), TEXT("test"), Error));
-	TestFalse("Positive infinity should be invalid",
-		FMCPParamValidator::ValidateNumericValue(std::numeric_limits<double>::infinity(), TEXT("test"), Error));
-	TestFalse("Negative infinity should be invalid",
-		FMCPParamValidator::ValidateNumericValue(-std::numeric_limits<double>::infinity(), TEXT("test"), Error));
+	struct { const TCHAR* What; double Value; bool bExpectValid; } Values[] = {
+		// Valid values
+		{ TEXT("Zero should be valid"), 0.0, true },
+		{ TEXT("Positive value should be valid"), 100.0, true },
+		{ TEXT("Negative value should be valid"), -100.0, true },
+		// Invalid values
+		{ TEXT("NaN should be invalid"), std::numeric_limits<double>::quiet_NaN(), false },
+		{ TEXT("Positive infinity should be invalid"), std::numeric_limits<double>::infinity(), false },
+		{ TEXT("Negative infinity should be invalid"), -std::numeric_limits<double>::infinity(), false },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : Values)
+	{
+		Cases.Add(Entry.What, [Entry](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			const bool bValid = FMCPParamValidator::ValidateNumericValue(Entry.Value, TEXT("test"), Error);
+			if (Entry.bExpectValid)
+			{
+				Context.TestTrue(Entry.What, bValid);
+			}
+			else
+			{
+				Context.TestFalse(Entry.What, bValid);
+			}
+		});
+	}
 
 	// Bounds checking with custom max
-	TestFalse("Value exceeding max should be invalid",
-		FMCPParamValidator::ValidateNumericValue(1e10, TEXT("test"), Error, 1e6));
+	Cases.Add(TEXT("CustomMax"), [](FMCPTestCaseContext& Context)
+	{
+		FString Error;
+		Context.TestFalse(TEXT("Value exceeding max should be invalid"),
+			FMCPParamValidator::ValidateNumericValue(1e10, TEXT("test"), Error, 1e6));
+	});
 
-	return true;
+	return Cases.RunAll(*this);
 }
 
 // ===== String Sanitization Tests =====
@@ -276,24 +353,33 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_SanitizeString_RemovesDangerousChars::RunTest(const FString& Parameters)
 {
-	// Test that dangerous characters are removed
-	FString Sanitized = FMCPParamValidator::SanitizeString(TEXT("Hello<script>World</script>"));
-	TestFalse("< should be removed", Sanitized.Contains(TEXT("<")));
-	TestFalse("> should be removed", Sanitized.Contains(TEXT(">")));
-	TestTrue("Normal text should remain", Sanitized.Contains(TEXT("Hello")));
-	TestTrue("Normal text should remain", Sanitized.Contains(TEXT("World")));
-
-	// Test shell escape removal
-	Sanitized = FMCPParamValidator::SanitizeString(TEXT("Hello`rm -rf`World"));
-	TestFalse("Backticks should be removed", Sanitized.Contains(TEXT("`")));
-
-	// Test dollar sign removal
-	Sanitized = FMCPParamValidator::SanitizeString(TEXT("Hello$(cmd)World"));
-	TestFalse("$ should be removed", Sanitized.Contains(TEXT("$")));
-	TestFalse("( should be removed", Sanitized.Contains(TEXT("(")));
-	TestFalse(") should be removed", Sanitized.Contains(TEXT(")")));
+	FMCPParallelCaseSet Cases;
 
-	return true;
+	Cases.Add(TEXT("ScriptTags"), [](FMCPTestCaseContext& Context)
+	{
+		// Test that dangerous characters are removed
+		const FString Sanitized = FMCPParamValidator::SanitizeString(TEXT("Hello<script>World</script>"));
+		Context.TestFalse(TEXT("< should be removed"), Sanitized.Contains(TEXT("<")));
+		Context.TestFalse(TEXT("> should be removed"), Sanitized.Contains(TEXT(">")));
+		Context.TestTrue(TEXT("Normal text should remain"), Sanitized.Contains(TEXT("Hello")));
+		Context.TestTrue(TEXT("Normal text should remain"), Sanitized.Contains(TEXT("World")));
+	});
+
+	Cases.Add(TEXT("ShellEscape"), [](FMCPTestCaseContext& Context)
+	{
+		const FString Sanitized = FMCPParamValidator::SanitizeString(TEXT("Hello`rm -rf`World"));
+		Context.TestFalse(TEXT("Backticks should be removed"), Sanitized.Contains(TEXT("`")));
+	});
+
+	Cases.Add(TEXT("DollarExpansion"), [](FMCPTestCaseContext& Context)
+	{
+		const FString Sanitized = FMCPParamValidator::SanitizeString(TEXT("Hello$(cmd)World"));
+		Context.TestFalse(TEXT("$ should be removed"), Sanitized.Contains(TEXT("$")));
+		Context.TestFalse(TEXT("( should be removed"), Sanitized.Contains(TEXT("(")));
+		Context.TestFalse(TEXT(") should be removed"), Sanitized.Contains(TEXT(")")));
+	});
+
+	return Cases.RunAll(*this);
 }
 
 // ===== Blueprint Variable/Function Name Tests =====
@@ -306,31 +392,76 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 
 bool FMCPParamValidator_ValidateBlueprintNames::RunTest(const FString& Parameters)
 {
-	FString Error;
-
-	// Valid variable names
-	TestTrue("Simple variable should be valid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT("MyVariable"), Error));
-	TestTrue("Variable with underscore should be valid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT("_MyVariable"), Error));
-	TestTrue("Variable with numbers should be valid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT("MyVariable123"), Error));
-
-	// Invalid variable names
-	TestFalse("Variable starting with number should be invalid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT("123Variable"), Error));
-	TestFalse("Variable with space should be invalid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT("My Variable"), Error));
-	TestFalse("Variable with special char should be invalid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT("My-Variable"), Error));
-	TestFalse("Empty variable name should be invalid",
-		FMCPParamValidator::ValidateBlueprintVariableName(TEXT(""), Error));
+	struct { const TCHAR* What; const TCHAR* Name; bool bExpectValid; } VariableNames[] = {
+		// Valid variable names
+		{ TEXT("Simple variable should be valid"), TEXT("MyVariable"), true },
+		{ TEXT("Variable with underscore should be valid"), TEXT("_MyVariable"), true },
+		{ TEXT("Variable with numbers should be valid"), TEXT("MyVariable123"), true },
+		// Invalid variable names
+		{ TEXT("Variable starting with number should be invalid"), TEXT("123Variable"), false },
+		{ TEXT("Variable with space should be invalid"), TEXT("My Variable"), false },
+		{ TEXT("Variable with special char should be invalid"), TEXT("My-Variable"), false },
+		{ TEXT("Empty variable name should be invalid"), TEXT(""), false },
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const auto& Entry : VariableNames)
+	{
+		Cases.Add(Entry.What, [Entry](FMCPTestCaseContext& Context)
+		{
+			FString Error;
+			const bool bValid = FMCPParamValidator::ValidateBlueprintVariableName(Entry.Name, Error);
+			if (Entry.bExpectValid)
+			{
+				Context.TestTrue(Entry.What, bValid);
+			}
+			else
+			{
+				Context.TestFalse(Entry.What, bValid);
+			}
+		});
+	}
 
 	// Same rules apply to function names
-	TestTrue("Simple function should be valid",
-		FMCPParamValidator::ValidateBlueprintFunctionName(TEXT("MyFunction"), Error));
-	TestFalse("Function starting with number should be invalid",
-		FMCPParamValidator::ValidateBlueprintFunctionName(TEXT("123Function"), Error));
+	Cases.Add(TEXT("FunctionNames"), [](FMCPTestCaseContext& Context)
+	{
+		FString Error;
+		Context.TestTrue(TEXT("Simple function should be valid"),
+			FMCPParamValidator::ValidateBlueprintFunctionName(TEXT("MyFunction"), Error));
+		Context.TestFalse(TEXT("Function starting with number should be invalid"),
+			FMCPParamValidator::ValidateBlueprintFunctionName(TEXT("123Function"), Error));
+	});
+
+	return Cases.RunAll(*this);
+}
+
+// ===== String View Input Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPParamValidator_StringViewInputs,
+	"UnrealClaude.MCP.ParamValidator.StringViewInputs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPParamValidator_StringViewInputs::RunTest(const FString& Parameters)
+{
+	// Validators accept views, so a slice of a larger buffer - which is not
+	// null-terminated at the slice boundary - must validate on its own
+	const FString Buffer = TEXT("ValidName;rest-of-buffer");
+	const FStringView Slice = FStringView(Buffer).Left(9);
+
+	FString Error;
+	TestTrue("Non-terminated slice should validate as actor name",
+		FMCPParamValidator::ValidateActorName(Slice, Error));
+	TestTrue("Non-terminated slice should validate as variable name",
+		FMCPParamValidator::ValidateBlueprintVariableName(Slice, Error));
+
+	// The semicolon beyond the slice must not leak into the validated range
+	const FStringView FullView(Buffer);
+	TestFalse("Full buffer with semicolon should fail as console command",
+		FMCPParamValidator::ValidateConsoleCommand(FullView, Error));
+	TestTrue("Slice without semicolon should pass as console command",
+		FMCPParamValidator::ValidateConsoleCommand(Slice, Error));
 
 	return true;
 }
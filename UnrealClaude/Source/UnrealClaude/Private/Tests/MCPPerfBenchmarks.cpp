@@ -0,0 +1,426 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Performance benchmarks for the MCP hot paths.
+ *
+ * Most of these are not correctness tests: each one times a representative
+ * workload and reports ms/op (or us/op) through the automation log, so tool
+ * latency can be tracked across plugin versions. They run under the Perf
+ * filter so normal product test passes stay fast.
+ *
+ * The allocation-budget section at the bottom is the exception: those tests
+ * count heap allocations per operation on the request hot paths and FAIL
+ * when a budget is exceeded, so churn regressions (per-element FString
+ * copies, JSON node rebuilds) get caught at test time instead of in agent
+ * sessions. They run under the Product filter because they gate.
+ *
+ * Workloads are self-contained - they exercise the plugin's own data
+ * structures (registry validation, task queue churn, JSON serialization,
+ * log ring buffer) rather than project content, so numbers are comparable
+ * between machines and maps.
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MCP/MCPToolRegistry.h"
+#include "MCP/MCPTaskQueue.h"
+#include "MCP/MCPLogRingBuffer.h"
+#include "JsonUtils.h"
+#include "Dom/JsonObject.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Time a callable over N iterations and return milliseconds per op */
+	template <typename FuncType>
+	double TimePerOpMs(int32 Iterations, FuncType&& Func)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Func(i);
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+	}
+}
+
+// ===== Registry validation / dispatch overhead =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPPerf_RegistryValidation,
+	"UnrealClaude.Perf.Registry.ValidationReject",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FMCPPerf_RegistryValidation::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	// Missing required 'operation' - rejected by the compiled param checks
+	// before any game thread dispatch, so this times the per-call fixed cost
+	// every request pays
+	TSharedRef<FJsonObject> BadParams = MakeShared<FJsonObject>();
+	BadParams->SetStringField(TEXT("blueprint_path"), TEXT("/Game/DoesNotMatter"));
+
+	const int32 Iterations = 10000;
+	const double MsPerOp = TimePerOpMs(Iterations, [&](int32)
+	{
+		Registry.ExecuteTool(TEXT("blueprint_query"), BadParams);
+	});
+
+	AddInfo(FString::Printf(TEXT("Registry validation reject: %.4f ms/op (%.1f us/op, %d iterations)"),
+		MsPerOp, MsPerOp * 1000.0, Iterations));
+
+	return true;
+}
+
+// ===== Task queue churn =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPPerf_TaskQueueChurn,
+	"UnrealClaude.Perf.TaskQueue.Churn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FMCPPerf_TaskQueueChurn::RunTest(const FString& Parameters)
+{
+	// Workers are deliberately not started (see the deadlock note in
+	// MCPTaskQueueTests.cpp); this times the submission, status-poll, and
+	// cancellation data paths that HTTP and game threads contend on,
+	// including the write-ahead journal append per submission.
+	FMCPToolRegistry Registry;
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.GetTaskQueue();
+	if (!Queue.IsValid())
+	{
+		AddError(TEXT("Task queue not available"));
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetNumberField(TEXT("lines"), 10);
+
+	const int32 TotalTasks = 1000;
+	const int32 BatchSize = 50; // Stay under the active-task capacity cap
+
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Batch = 0; Batch < TotalTasks / BatchSize; ++Batch)
+	{
+		TArray<FGuid> BatchIds;
+		BatchIds.Reserve(BatchSize);
+		for (int32 i = 0; i < BatchSize; ++i)
+		{
+			FGuid TaskId = Queue->SubmitTask(TEXT("get_output_log"), Params);
+			if (TaskId.IsValid())
+			{
+				BatchIds.Add(TaskId);
+			}
+		}
+
+		// Simulate the 20Hz status polling agents do between mutations
+		for (const FGuid& TaskId : BatchIds)
+		{
+			Queue->GetTask(TaskId);
+		}
+		Queue->GetAllTasks(false);
+
+		for (const FGuid& TaskId : BatchIds)
+		{
+			Queue->CancelTask(TaskId);
+		}
+	}
+	const double MsPerOp = (FPlatformTime::Seconds() - Start) * 1000.0 / TotalTasks;
+
+	AddInfo(FString::Printf(TEXT("Task queue churn (submit+poll+cancel): %.4f ms/task (%d tasks)"),
+		MsPerOp, TotalTasks));
+
+	return true;
+}
+
+// ===== JSON response serialization =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPPerf_JsonStringify,
+	"UnrealClaude.Perf.Json.Stringify",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FMCPPerf_JsonStringify::RunTest(const FString& Parameters)
+{
+	// Shaped like a get_level_actors response: 1000 actor entries with
+	// name/class/transform, the payload profile most tools produce
+	TSharedRef<FJsonObject> Payload = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		TSharedPtr<FJsonObject> Actor = MakeShared<FJsonObject>();
+		Actor->SetStringField(TEXT("name"), FString::Printf(TEXT("StaticMeshActor_%d"), i));
+		Actor->SetStringField(TEXT("class"), TEXT("StaticMeshActor"));
+
+		TSharedPtr<FJsonObject> Location = MakeShared<FJsonObject>();
+		Location->SetNumberField(TEXT("x"), i * 100.0);
+		Location->SetNumberField(TEXT("y"), i * 200.0);
+		Location->SetNumberField(TEXT("z"), 0.0);
+		Actor->SetObjectField(TEXT("location"), Location);
+
+		ActorsArray.Add(MakeShared<FJsonValueObject>(Actor));
+	}
+	Payload->SetArrayField(TEXT("actors"), ActorsArray);
+
+	const int32 Iterations = 100;
+	int32 OutputLength = 0;
+	const double MsPerOp = TimePerOpMs(Iterations, [&](int32)
+	{
+		OutputLength = FJsonUtils::Stringify(Payload).Len();
+	});
+
+	AddInfo(FString::Printf(TEXT("JSON stringify (1000-actor payload, %d chars): %.4f ms/op (%d iterations)"),
+		OutputLength, MsPerOp, Iterations));
+
+	return true;
+}
+
+// ===== Log ring buffer =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPPerf_LogRingBuffer,
+	"UnrealClaude.Perf.LogRingBuffer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FMCPPerf_LogRingBuffer::RunTest(const FString& Parameters)
+{
+	FMCPLogRingBuffer& RingBuffer = FMCPLogRingBuffer::Get();
+
+	// Write throughput: what every UE_LOG pays while the buffer is registered
+	const int32 WriteCount = 20000;
+	const double WriteMsPerOp = TimePerOpMs(WriteCount, [&](int32 i)
+	{
+		RingBuffer.Serialize(*FString::Printf(TEXT("Benchmark log line %d with some representative payload text"), i),
+			ELogVerbosity::Log, FName(TEXT("LogUnrealClaudePerf")));
+	});
+
+	// Cursor read: what a get_output_log poll pays
+	TArray<FMCPLogRingBuffer::FLogLine> Lines;
+	uint64 Cursor = 0;
+	const int32 ReadCount = 100;
+	const double ReadMsPerOp = TimePerOpMs(ReadCount, [&](int32)
+	{
+		Lines.Reset();
+		Cursor = RingBuffer.GetLinesSince(Cursor, Lines);
+	});
+
+	AddInfo(FString::Printf(TEXT("Log ring buffer: write %.1f us/line (%d lines), cursor read %.4f ms/poll"),
+		WriteMsPerOp * 1000.0, WriteCount, ReadMsPerOp));
+
+	return true;
+}
+
+// ===== Allocation budgets =====
+// Budgets are several times the counts measured when each test was added:
+// they catch reintroduced per-op churn, not single-allocation noise. When a
+// legitimate feature raises a count, re-measure (the actual count is logged)
+// and adjust the budget in the same change.
+
+namespace
+{
+	/**
+	 * Counts heap allocations made on the calling thread while in scope by
+	 * interposing a forwarding proxy in front of GMalloc. Other threads keep
+	 * allocating through the proxy unaffected but are not counted, so the
+	 * numbers stay deterministic while background workers are idle.
+	 */
+	class FScopedAllocCounter final : public FMalloc
+	{
+	public:
+		FScopedAllocCounter()
+			: Inner(GMalloc)
+			, ThreadId(FPlatformTLS::GetCurrentThreadId())
+		{
+			GMalloc = this;
+		}
+
+		virtual ~FScopedAllocCounter() override
+		{
+			GMalloc = Inner;
+		}
+
+		int64 GetCount() const { return Count; }
+
+		virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Record();
+			return Inner->Malloc(Size, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+		{
+			Record();
+			return Inner->TryMalloc(Size, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			Record();
+			return Inner->Realloc(Original, Size, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+		{
+			Record();
+			return Inner->TryRealloc(Original, Size, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override { return Inner->QuantizeSize(Size, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		void Record()
+		{
+			if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			{
+				++Count;
+			}
+		}
+
+		FMalloc* Inner;
+		uint32 ThreadId;
+		int64 Count = 0;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPAlloc_ValidationReject,
+	"UnrealClaude.Perf.Alloc.ValidationReject",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPAlloc_ValidationReject::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	TSharedRef<FJsonObject> BadParams = MakeShared<FJsonObject>();
+	BadParams->SetStringField(TEXT("blueprint_path"), TEXT("/Game/DoesNotMatter"));
+
+	// Warm-up materializes the tool and its compiled checks so one-time lazy
+	// init does not land in the counted window
+	Registry.ExecuteTool(TEXT("blueprint_query"), BadParams);
+
+	const int32 Iterations = 200;
+	int64 Allocs = 0;
+	{
+		FScopedAllocCounter Counter;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Registry.ExecuteTool(TEXT("blueprint_query"), BadParams);
+		}
+		Allocs = Counter.GetCount();
+	}
+
+	const int64 AllocsPerOp = Allocs / Iterations;
+	constexpr int64 Budget = 64;
+	AddInfo(FString::Printf(TEXT("Validation reject: %lld allocs/op (budget %lld)"), AllocsPerOp, Budget));
+	TestTrue(FString::Printf(TEXT("Validation reject should stay within %lld allocs/op (got %lld)"), Budget, AllocsPerOp),
+		AllocsPerOp <= Budget);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPAlloc_AssetSearchEmptyPage,
+	"UnrealClaude.Perf.Alloc.AssetSearchEmptyPage",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPAlloc_AssetSearchEmptyPage::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	// A path that matches nothing keeps the response shape fixed regardless
+	// of project content, so the count measures the request path itself:
+	// typed extraction, the registry filter build, the empty-page envelope
+	TSharedRef<FJsonObject> SearchParams = MakeShared<FJsonObject>();
+	SearchParams->SetStringField(TEXT("path_filter"), TEXT("/Game/__MCPAllocBudget__/"));
+	SearchParams->SetNumberField(TEXT("limit"), 10);
+
+	Registry.ExecuteTool(TEXT("asset_search"), SearchParams);
+
+	const int32 Iterations = 100;
+	int64 Allocs = 0;
+	{
+		FScopedAllocCounter Counter;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Registry.ExecuteTool(TEXT("asset_search"), SearchParams);
+		}
+		Allocs = Counter.GetCount();
+	}
+
+	const int64 AllocsPerOp = Allocs / Iterations;
+	constexpr int64 Budget = 256;
+	AddInfo(FString::Printf(TEXT("asset_search empty page: %lld allocs/op (budget %lld)"), AllocsPerOp, Budget));
+	TestTrue(FString::Printf(TEXT("asset_search empty page should stay within %lld allocs/op (got %lld)"), Budget, AllocsPerOp),
+		AllocsPerOp <= Budget);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPAlloc_TaskLifecycle,
+	"UnrealClaude.Perf.Alloc.TaskLifecycle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPAlloc_TaskLifecycle::RunTest(const FString& Parameters)
+{
+	// Workers deliberately not started, same as the churn benchmark above:
+	// this counts the submit (hash, validation, journal append), status poll
+	// and cancel paths without worker-thread allocations adding noise
+	FMCPToolRegistry Registry;
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.GetTaskQueue();
+	if (!Queue.IsValid())
+	{
+		AddError(TEXT("Task queue not available"));
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetNumberField(TEXT("lines"), 10);
+
+	// Warm-up cycle covers tool materialization and journal setup
+	{
+		FGuid WarmId = Queue->SubmitTask(TEXT("get_output_log"), Params);
+		Queue->GetTask(WarmId);
+		Queue->CancelTask(WarmId);
+	}
+
+	const int32 Cycles = 100;
+	int64 Allocs = 0;
+	{
+		FScopedAllocCounter Counter;
+		for (int32 i = 0; i < Cycles; ++i)
+		{
+			FGuid TaskId = Queue->SubmitTask(TEXT("get_output_log"), Params);
+			Queue->GetTask(TaskId);
+			Queue->CancelTask(TaskId);
+		}
+		Allocs = Counter.GetCount();
+	}
+
+	const int64 AllocsPerOp = Allocs / Cycles;
+	constexpr int64 Budget = 1024;
+	AddInfo(FString::Printf(TEXT("Task submit/poll/cancel: %lld allocs/cycle (budget %lld)"), AllocsPerOp, Budget));
+	TestTrue(FString::Printf(TEXT("Task lifecycle should stay within %lld allocs/cycle (got %lld)"), Budget, AllocsPerOp),
+		AllocsPerOp <= Budget);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
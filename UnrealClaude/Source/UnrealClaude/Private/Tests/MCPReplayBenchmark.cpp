@@ -0,0 +1,162 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Replay benchmark for recorded tool traffic.
+ *
+ * Re-executes a traffic recording (captured with the plugin's recording
+ * mode, Server category settings) against a fresh registry and reports
+ * per-tool timings through the automation log. Each run writes its
+ * timings next to the recording; the next run over the same recording
+ * compares against them and flags tools that got slower, so production
+ * traffic becomes a run-over-run regression benchmark.
+ *
+ * Replays execute exactly what was recorded - recordings of mutating
+ * sessions belong in a disposable copy of the project. Runs under the
+ * Perf filter with the other benchmarks, and passes with a note when no
+ * recording is present.
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MCP/MCPRequestRecorder.h"
+#include "MCP/MCPToolRegistry.h"
+#include "JsonUtils.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Newest recording in the recordings directory, or empty */
+	FString FindNewestRecording()
+	{
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(FMCPRequestRecorder::GetRecordingsDirectory() / TEXT("*.mcprec")), true, false);
+
+		FString Newest;
+		FDateTime NewestTime = FDateTime::MinValue();
+		for (const FString& File : Files)
+		{
+			const FString FullPath = FMCPRequestRecorder::GetRecordingsDirectory() / File;
+			const FDateTime Stamp = IFileManager::Get().GetTimeStamp(*FullPath);
+			if (Stamp > NewestTime)
+			{
+				NewestTime = Stamp;
+				Newest = FullPath;
+			}
+		}
+		return Newest;
+	}
+
+	/** Slowdown ratio against the previous run that gets flagged */
+	constexpr double RegressionThreshold = 1.25;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPPerf_ReplayRecording,
+	"UnrealClaude.Perf.Replay.Recording",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FMCPPerf_ReplayRecording::RunTest(const FString& Parameters)
+{
+	const FString RecordingPath = FindNewestRecording();
+	if (RecordingPath.IsEmpty())
+	{
+		AddInfo(TEXT("No traffic recording found; enable recording in the plugin settings to capture one"));
+		return true;
+	}
+
+	TArray<FMCPRecordedCall> Calls;
+	if (!FMCPRequestRecorder::LoadRecording(RecordingPath, Calls))
+	{
+		AddError(FString::Printf(TEXT("Failed to load recording %s"), *RecordingPath));
+		return false;
+	}
+	if (Calls.Num() == 0)
+	{
+		AddInfo(FString::Printf(TEXT("Recording %s holds no calls"), *RecordingPath));
+		return true;
+	}
+
+	AddInfo(FString::Printf(TEXT("Replaying %d call(s) from %s"), Calls.Num(), *FPaths::GetCleanFilename(RecordingPath)));
+
+	// Per-tool accumulation across the replay
+	struct FToolTiming
+	{
+		int32 Count = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+	};
+	TMap<FString, FToolTiming> Timings;
+
+	FMCPToolRegistry Registry;
+	for (const FMCPRecordedCall& Call : Calls)
+	{
+		TSharedPtr<FJsonObject> Params;
+		if (Call.RequestBody.Num() > 0)
+		{
+			Params = FJsonUtils::ParseUtf8(MakeArrayView(Call.RequestBody));
+		}
+		if (!Params.IsValid())
+		{
+			Params = MakeShared<FJsonObject>();
+		}
+
+		const double Start = FPlatformTime::Seconds();
+		Registry.ExecuteTool(Call.ToolName, Params.ToSharedRef());
+		const double ElapsedMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		FToolTiming& Timing = Timings.FindOrAdd(Call.ToolName);
+		++Timing.Count;
+		Timing.TotalMs += ElapsedMs;
+		Timing.MaxMs = FMath::Max(Timing.MaxMs, ElapsedMs);
+	}
+
+	// Compare against the previous replay of the same recording, then
+	// overwrite its timings with this run's
+	const FString TimingsPath = RecordingPath + TEXT(".replay.json");
+	TSharedPtr<FJsonObject> PreviousRun;
+	{
+		FString PreviousText;
+		if (FFileHelper::LoadFileToString(PreviousText, *TimingsPath))
+		{
+			PreviousRun = FJsonUtils::Parse(PreviousText);
+		}
+	}
+
+	TSharedPtr<FJsonObject> ThisRun = MakeShared<FJsonObject>();
+	for (const auto& Pair : Timings)
+	{
+		const double MeanMs = Pair.Value.TotalMs / Pair.Value.Count;
+		AddInfo(FString::Printf(TEXT("%s: %d call(s), mean %.2f ms, max %.2f ms"),
+			*Pair.Key, Pair.Value.Count, MeanMs, Pair.Value.MaxMs));
+
+		TSharedPtr<FJsonObject> ToolJson = MakeShared<FJsonObject>();
+		ToolJson->SetNumberField(TEXT("count"), Pair.Value.Count);
+		ToolJson->SetNumberField(TEXT("mean_ms"), MeanMs);
+		ToolJson->SetNumberField(TEXT("max_ms"), Pair.Value.MaxMs);
+		ThisRun->SetObjectField(Pair.Key, ToolJson);
+
+		if (PreviousRun.IsValid())
+		{
+			const TSharedPtr<FJsonObject>* PreviousTool = nullptr;
+			double PreviousMean = 0.0;
+			if (PreviousRun->TryGetObjectField(Pair.Key, PreviousTool) &&
+				(*PreviousTool)->TryGetNumberField(TEXT("mean_ms"), PreviousMean) &&
+				PreviousMean > 0.0 && MeanMs > PreviousMean * RegressionThreshold)
+			{
+				AddWarning(FString::Printf(TEXT("%s regressed: mean %.2f ms vs %.2f ms last replay"),
+					*Pair.Key, MeanMs, PreviousMean));
+			}
+		}
+	}
+
+	FFileHelper::SaveStringToFile(FJsonUtils::Stringify(ThisRun, true), *TimingsPath);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
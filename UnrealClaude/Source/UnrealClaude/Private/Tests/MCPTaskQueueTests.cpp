@@ -10,6 +10,7 @@
 #include "MCP/MCPToolRegistry.h"
 #include "MCP/MCPTaskQueue.h"
 #include "MCP/MCPAsyncTask.h"
+#include "MCP/MCPCancellation.h"
 #include "Dom/JsonObject.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -34,6 +35,7 @@ bool FMCPTaskQueue_Create::RunTest(const FString& Parameters)
 	TestEqual("Default max history size should be 100", Queue->Config.MaxHistorySize, 100);
 	TestEqual("Default timeout should be 120000ms", Queue->Config.DefaultTimeoutMs, 120000u);
 	TestEqual("Default result retention should be 300s", Queue->Config.ResultRetentionSeconds, 300);
+	TestTrue("Adaptive concurrency should default on", Queue->Config.bAdaptiveConcurrency);
 
 	return true;
 }
@@ -170,6 +172,43 @@ bool FMCPTaskQueue_SubmitInvalidTool::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTaskQueue_SubmitInvalidParams,
+	"UnrealClaude.MCP.TaskQueue.SubmitInvalidParams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTaskQueue_SubmitInvalidParams::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	Registry.StartTaskQueue();
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.GetTaskQueue();
+
+	// Missing the required 'operation' parameter - rejected at submission,
+	// with the validation error surfaced, instead of failing when the task runs
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	FString SubmitError;
+	FGuid TaskId = Queue->SubmitTask(TEXT("blueprint_query"), Params, 0,
+		EMCPTaskPriority::Normal, false, TArray<FGuid>(), &SubmitError);
+
+	TestFalse("Should reject invalid parameters at submission", TaskId.IsValid());
+	TestTrue("Submit error should name the missing parameter", SubmitError.Contains(TEXT("operation")));
+
+	// A valid submission carries the prevalidated flag so execution skips
+	// the compiled checks
+	TSharedPtr<FJsonObject> ValidParams = MakeShared<FJsonObject>();
+	FGuid ValidId = Queue->SubmitTask(TEXT("get_level_actors"), ValidParams);
+	TestTrue("Valid submission should succeed", ValidId.IsValid());
+	TSharedPtr<FMCPAsyncTask> Task = Queue->GetTask(ValidId);
+	if (Task.IsValid())
+	{
+		TestTrue("Task should be marked prevalidated", Task->bParamsPrevalidated);
+	}
+
+	Registry.StopTaskQueue();
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FMCPTaskQueue_SubmitWithTimeout,
 	"UnrealClaude.MCP.TaskQueue.SubmitWithTimeout",
@@ -449,6 +488,7 @@ bool FMCPAsyncTask_ToJsonWithResult::RunTest(const FString& Parameters)
 	Task.ToolName = TEXT("test_tool");
 	Task.Status.Store(EMCPTaskStatus::Completed);
 	Task.StartedTime = FDateTime::UtcNow() - FTimespan::FromSeconds(1);
+	Task.GameThreadEnteredTime = Task.StartedTime + FTimespan::FromMilliseconds(250);
 	Task.CompletedTime = FDateTime::UtcNow();
 	Task.Result = FMCPToolResult::Success(TEXT("Test completed"));
 
@@ -456,9 +496,17 @@ bool FMCPAsyncTask_ToJsonWithResult::RunTest(const FString& Parameters)
 
 	TestTrue("JSON should have completed_at", Json->HasField(TEXT("completed_at")));
 	TestTrue("JSON should have duration_ms", Json->HasField(TEXT("duration_ms")));
+	TestTrue("JSON should have game_thread_wait_ms", Json->HasField(TEXT("game_thread_wait_ms")));
 	TestTrue("JSON should have success field", Json->GetBoolField(TEXT("success")));
 	TestEqual("JSON message should match", Json->GetStringField(TEXT("message")), TEXT("Test completed"));
 
+	// Serialization timing is measured when the envelope is built, so it
+	// surfaces on polls made after that point
+	TestFalse("serialize_ms should be absent before the envelope is built", Json->HasField(TEXT("serialize_ms")));
+	Task.BuildSerializedResult();
+	Json = Task.ToJson(true);
+	TestTrue("JSON should have serialize_ms after BuildSerializedResult", Json->HasField(TEXT("serialize_ms")));
+
 	return true;
 }
 
@@ -497,6 +545,85 @@ bool FMCPAsyncTask_IsComplete::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ===== Task Dependency Tests =====
+// No queue start needed: submission, parking and the cancellation cascade
+// all happen on the submitting thread
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTaskQueue_DependentParksUntilPrerequisite,
+	"UnrealClaude.MCP.TaskQueue.DependentParksUntilPrerequisite",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTaskQueue_DependentParksUntilPrerequisite::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	// Don't start queue - tasks will stay pending
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.GetTaskQueue();
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	FGuid FirstId = Queue->SubmitTask(TEXT("get_level_actors"), Params);
+	TestTrue("Prerequisite task should submit", FirstId.IsValid());
+
+	FGuid SecondId = Queue->SubmitTask(TEXT("get_output_log"), Params, 0, EMCPTaskPriority::Normal, false, { FirstId });
+	TestTrue("Dependent task should submit", SecondId.IsValid());
+
+	TSharedPtr<FMCPAsyncTask> Second = Queue->GetTask(SecondId);
+	TestTrue("Dependent should be pending", Second->Status.Load() == EMCPTaskStatus::Pending);
+	TestEqual("Dependent should wait on one prerequisite", Second->PendingPrerequisites.Load(), 1);
+	TestEqual("Prerequisite IDs should be recorded", Second->PrerequisiteIds.Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTaskQueue_UnknownPrerequisiteRejected,
+	"UnrealClaude.MCP.TaskQueue.UnknownPrerequisiteRejected",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTaskQueue_UnknownPrerequisiteRejected::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.GetTaskQueue();
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	FGuid TaskId = Queue->SubmitTask(TEXT("get_level_actors"), Params, 0, EMCPTaskPriority::Normal, false, { FGuid::NewGuid() });
+
+	TestFalse("Submission with unknown prerequisite should be rejected", TaskId.IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTaskQueue_PrerequisiteFailureCascades,
+	"UnrealClaude.MCP.TaskQueue.PrerequisiteFailureCascades",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTaskQueue_PrerequisiteFailureCascades::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	// Don't start queue - tasks will stay pending
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.GetTaskQueue();
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	FGuid FirstId = Queue->SubmitTask(TEXT("get_level_actors"), Params);
+	FGuid SecondId = Queue->SubmitTask(TEXT("get_output_log"), Params, 0, EMCPTaskPriority::Normal, false, { FirstId });
+	FGuid ThirdId = Queue->SubmitTask(TEXT("get_script_history"), Params, 0, EMCPTaskPriority::Normal, false, { SecondId });
+
+	// Cancelling the root is an unsuccessful terminal state; the failure
+	// must cascade through the whole chain instead of parking it forever
+	Queue->CancelTask(FirstId);
+
+	TSharedPtr<FMCPAsyncTask> Second = Queue->GetTask(SecondId);
+	TSharedPtr<FMCPAsyncTask> Third = Queue->GetTask(ThirdId);
+	TestTrue("Direct dependent should have failed", Second->Status.Load() == EMCPTaskStatus::Failed);
+	TestTrue("Transitive dependent should have failed", Third->Status.Load() == EMCPTaskStatus::Failed);
+
+	return true;
+}
+
 // ===== Queue Capacity Tests =====
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -522,4 +649,41 @@ bool FMCPTaskQueue_ConfigOverride::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPCancellation_TokenObservesFlag,
+	"UnrealClaude.MCP.TaskQueue.CancellationToken",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPCancellation_TokenObservesFlag::RunTest(const FString& Parameters)
+{
+	const FString TaskId = FGuid::NewGuid().ToString();
+	FThreadSafeBool Flag(false);
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("_task_id"), TaskId);
+
+	// Unregistered task id resolves to an inert token
+	TestFalse("Token for unregistered task should be inert",
+		FMCPCancellationRegistry::Get().TokenFor(Params).IsCancelled());
+
+	FMCPCancellationRegistry::Get().Register(TaskId, &Flag);
+	FMCPCancellationToken Token = FMCPCancellationRegistry::Get().TokenFor(Params);
+	TestFalse("Token should not report cancelled before the flag flips", Token.IsCancelled());
+
+	Flag = true;
+	TestTrue("Token should observe the flag flipping", Token.IsCancelled());
+
+	FMCPCancellationRegistry::Get().Unregister(TaskId);
+	TestFalse("Token resolved after unregister should be inert",
+		FMCPCancellationRegistry::Get().TokenFor(Params).IsCancelled());
+
+	// Direct calls carry no _task_id and always get an inert token
+	TSharedRef<FJsonObject> DirectParams = MakeShared<FJsonObject>();
+	TestFalse("Direct-call token should be inert",
+		FMCPCancellationRegistry::Get().TokenFor(DirectParams).IsCancelled());
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
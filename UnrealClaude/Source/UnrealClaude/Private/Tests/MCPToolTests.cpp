@@ -7,8 +7,11 @@
 
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
+#include "MCPParallelTestHarness.h"
 #include "MCP/MCPToolRegistry.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPLogRingBuffer.h"
+#include "UnrealClaudeConstants.h"
 #include "MCP/Tools/MCPTool_SpawnActor.h"
 #include "MCP/Tools/MCPTool_DeleteActors.h"
 #include "MCP/Tools/MCPTool_MoveActor.h"
@@ -36,17 +39,24 @@ bool FMCPTool_SpawnActor_GetInfo::RunTest(const FString& Parameters)
 	TestTrue("Description should not be empty", !Info.Description.IsEmpty());
 	TestTrue("Should have parameters", Info.Parameters.Num() > 0);
 
-	// Check required parameters
+	// Check parameters; class is optional at the top level because bulk mode
+	// supplies it per spawn spec
 	bool bHasClassParam = false;
+	bool bHasActorsParam = false;
 	for (const FMCPToolParameter& Param : Info.Parameters)
 	{
 		if (Param.Name == TEXT("class"))
 		{
 			bHasClassParam = true;
-			TestTrue("class parameter should be required", Param.bRequired);
+		}
+		else if (Param.Name == TEXT("actors"))
+		{
+			bHasActorsParam = true;
+			TestFalse("actors parameter should be optional", Param.bRequired);
 		}
 	}
 	TestTrue("Should have 'class' parameter", bHasClassParam);
+	TestTrue("Should have 'actors' parameter for bulk mode", bHasActorsParam);
 
 	return true;
 }
@@ -103,17 +113,24 @@ bool FMCPTool_MoveActor_GetInfo::RunTest(const FString& Parameters)
 	TestTrue("Description should not be empty", !Info.Description.IsEmpty());
 	TestTrue("Should have parameters", Info.Parameters.Num() > 0);
 
-	// Check required parameters
+	// actor_name drives single mode, moves drives batch mode; neither can be
+	// required at the schema level since either one satisfies the tool
 	bool bHasActorNameParam = false;
+	bool bHasMovesParam = false;
 	for (const FMCPToolParameter& Param : Info.Parameters)
 	{
 		if (Param.Name == TEXT("actor_name"))
 		{
 			bHasActorNameParam = true;
-			TestTrue("actor_name parameter should be required", Param.bRequired);
+			TestFalse("actor_name parameter should be optional (batch mode uses moves)", Param.bRequired);
+		}
+		else if (Param.Name == TEXT("moves"))
+		{
+			bHasMovesParam = true;
 		}
 	}
 	TestTrue("Should have 'actor_name' parameter", bHasActorNameParam);
+	TestTrue("Should have 'moves' parameter", bHasMovesParam);
 
 	return true;
 }
@@ -393,25 +410,31 @@ bool FMCPToolRegistry_ToolsRegistered::RunTest(const FString& Parameters)
 {
 	FMCPToolRegistry Registry;
 
-	// Core tools should be registered
-	TestNotNull("spawn_actor should be registered", Registry.FindTool(TEXT("spawn_actor")));
-	TestNotNull("delete_actors should be registered", Registry.FindTool(TEXT("delete_actors")));
-	TestNotNull("move_actor should be registered", Registry.FindTool(TEXT("move_actor")));
-	TestNotNull("set_property should be registered", Registry.FindTool(TEXT("set_property")));
-	TestNotNull("get_level_actors should be registered", Registry.FindTool(TEXT("get_level_actors")));
-	TestNotNull("run_console_command should be registered", Registry.FindTool(TEXT("run_console_command")));
-	TestNotNull("get_output_log should be registered", Registry.FindTool(TEXT("get_output_log")));
-	TestNotNull("capture_viewport should be registered", Registry.FindTool(TEXT("capture_viewport")));
-	TestNotNull("execute_script should be registered", Registry.FindTool(TEXT("execute_script")));
-
-	// Blueprint tools should be registered
-	TestNotNull("blueprint_query should be registered", Registry.FindTool(TEXT("blueprint_query")));
-	TestNotNull("blueprint_modify should be registered", Registry.FindTool(TEXT("blueprint_modify")));
-
-	// Animation Blueprint tools should be registered
-	TestNotNull("anim_blueprint_modify should be registered", Registry.FindTool(TEXT("anim_blueprint_modify")));
-
-	return true;
+	// Each lookup is an independent case probed concurrently - this also
+	// exercises lazy tool materialization racing across workers, which is
+	// exactly what parallel HTTP handlers do to the registry in production
+	const TCHAR* ExpectedTools[] = {
+		// Core tools
+		TEXT("spawn_actor"), TEXT("delete_actors"), TEXT("move_actor"),
+		TEXT("set_property"), TEXT("get_level_actors"), TEXT("run_console_command"),
+		TEXT("get_output_log"), TEXT("capture_viewport"), TEXT("execute_script"),
+		// Blueprint tools
+		TEXT("blueprint_query"), TEXT("blueprint_modify"),
+		// Animation Blueprint tools
+		TEXT("anim_blueprint_modify"),
+	};
+
+	FMCPParallelCaseSet Cases;
+	for (const TCHAR* ToolName : ExpectedTools)
+	{
+		Cases.Add(ToolName, [&Registry, ToolName](FMCPTestCaseContext& Context)
+		{
+			Context.TestNotNull(
+				FString::Printf(TEXT("%s should be registered"), ToolName),
+				Registry.FindTool(ToolName));
+		});
+	}
+	return Cases.RunAll(*this);
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -861,6 +884,61 @@ bool FMCPTool_AssetSearch_DefaultPath::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_TypedParamTable,
+	"UnrealClaude.MCP.Tools.TypedParamTable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_TypedParamTable::RunTest(const FString& Parameters)
+{
+	// Schema generation and extraction must both come off the one table
+	struct FTestParams
+	{
+		FString Name;
+		int32 Count = 5;
+		bool bEnabled = false;
+	};
+	const auto Table = MakeMCPParamTable<FTestParams>(
+		MCPParamField(TEXT("name"), &FTestParams::Name, TEXT("A required string"), true),
+		MCPParamField(TEXT("count"), &FTestParams::Count, TEXT("An optional number"), false, TEXT("5")),
+		MCPParamField(TEXT("enabled"), &FTestParams::bEnabled, TEXT("An optional boolean")));
+
+	TArray<FMCPToolParameter> Schema = Table.BuildParameterList();
+	TestEqual("Schema should have one entry per field", Schema.Num(), 3);
+	if (Schema.Num() == 3)
+	{
+		TestEqual("String field type", Schema[0].Type, TEXT("string"));
+		TestTrue("Required flag carried into schema", Schema[0].bRequired);
+		TestEqual("Number field type", Schema[1].Type, TEXT("number"));
+		TestEqual("Default text carried into schema", Schema[1].DefaultValue, TEXT("5"));
+		TestEqual("Boolean field type", Schema[2].Type, TEXT("boolean"));
+	}
+
+	// Typed reads land in the struct; wrong-typed fields keep the defaults
+	TSharedRef<FJsonObject> Request = MakeShared<FJsonObject>();
+	Request->SetStringField(TEXT("name"), TEXT("Crate"));
+	Request->SetNumberField(TEXT("count"), 7);
+	Request->SetStringField(TEXT("enabled"), TEXT("not-a-bool"));
+
+	FTestParams Extracted;
+	TOptional<FMCPToolResult> Error;
+	TestTrue("Extraction should succeed", Table.Extract(Request, Extracted, Error));
+	TestEqual("String field extracted", Extracted.Name, TEXT("Crate"));
+	TestEqual("Number field extracted", Extracted.Count, 7);
+	TestFalse("Wrong-typed field keeps default", Extracted.bEnabled);
+
+	// Missing required string reports the standard error
+	TSharedRef<FJsonObject> Empty = MakeShared<FJsonObject>();
+	FTestParams Defaults;
+	TestFalse("Missing required should fail", Table.Extract(Empty, Defaults, Error));
+	TestTrue("Error should name the parameter",
+		Error.IsSet() && Error.GetValue().Message.Contains(TEXT("name")));
+	TestEqual("Optional fields keep struct defaults", Defaults.Count, 5);
+
+	return true;
+}
+
 // ===== Asset Dependencies Tool Tests =====
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -885,6 +963,8 @@ bool FMCPTool_AssetDependencies_GetInfo::RunTest(const FString& Parameters)
 	// Check for required parameters
 	bool bHasAssetPath = false;
 	bool bHasIncludeSoft = false;
+	bool bHasTransitive = false;
+	bool bHasMaxNodes = false;
 
 	for (const FMCPToolParameter& Param : Info.Parameters)
 	{
@@ -898,10 +978,21 @@ bool FMCPTool_AssetDependencies_GetInfo::RunTest(const FString& Parameters)
 			bHasIncludeSoft = true;
 			TestFalse("include_soft should be optional", Param.bRequired);
 		}
+		if (Param.Name == TEXT("transitive"))
+		{
+			bHasTransitive = true;
+			TestFalse("transitive should be optional", Param.bRequired);
+		}
+		if (Param.Name == TEXT("max_nodes"))
+		{
+			bHasMaxNodes = true;
+		}
 	}
 
 	TestTrue("Should have 'asset_path' parameter", bHasAssetPath);
 	TestTrue("Should have 'include_soft' parameter", bHasIncludeSoft);
+	TestTrue("Should have 'transitive' parameter", bHasTransitive);
+	TestTrue("Should have 'max_nodes' parameter", bHasMaxNodes);
 	TestTrue("Should be read-only", Info.Annotations.bReadOnlyHint);
 
 	return true;
@@ -1975,4 +2066,226 @@ bool FMCPToolRegistry_EnhancedInputRegistered::RunTest(const FString& Parameters
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPToolRegistry_CompiledParamChecks,
+	"UnrealClaude.MCP.Registry.CompiledParamChecks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPToolRegistry_CompiledParamChecks::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	// Missing required parameter is rejected by the precompiled checks
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		FMCPToolResult Result = Registry.ExecuteTool(TEXT("blueprint_query"), Params);
+		TestFalse("Missing operation should fail", Result.bSuccess);
+		TestTrue("Error should mention operation",
+			Result.Message.Contains(TEXT("operation")));
+	}
+
+	// Wrong-typed parameter is rejected before the tool runs
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetNumberField(TEXT("operation"), 42);
+		FMCPToolResult Result = Registry.ExecuteTool(TEXT("blueprint_query"), Params);
+		TestFalse("Numeric operation should fail", Result.bSuccess);
+		TestTrue("Error should mention the expected type",
+			Result.Message.Contains(TEXT("string")));
+	}
+
+	return true;
+}
+
+// ===== Blueprint Query Depth Tests =====
+
+// Depth gating is validated before any blueprint is loaded
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_BlueprintQuery_InvalidDepth,
+	"UnrealClaude.MCP.Tools.BlueprintQuery.InvalidDepth",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_BlueprintQuery_InvalidDepth::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("operation"), TEXT("get_graph"));
+	Params->SetStringField(TEXT("blueprint_path"), TEXT("/Game/DoesNotExist/BP_None"));
+	Params->SetStringField(TEXT("depth"), TEXT("everything"));
+	FMCPToolResult Result = Registry.ExecuteTool(TEXT("blueprint_query"), Params);
+	TestFalse("Unknown depth should fail", Result.bSuccess);
+
+	return true;
+}
+
+// ===== Output Log Filter Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPLogRingBuffer_StructuredFilter,
+	"UnrealClaude.MCP.LogRingBuffer.StructuredFilter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPLogRingBuffer_StructuredFilter::RunTest(const FString& Parameters)
+{
+	FMCPLogRingBuffer::FLogLine ErrorLine;
+	ErrorLine.Category = FName(TEXT("LogBlueprint"));
+	ErrorLine.Verbosity = ELogVerbosity::Error;
+
+	FMCPLogRingBuffer::FLogLine VerboseLine;
+	VerboseLine.Category = FName(TEXT("LogTemp"));
+	VerboseLine.Verbosity = ELogVerbosity::Verbose;
+
+	// Default filter keeps everything
+	FMCPLogRingBuffer::FLogFilter PassAll;
+	TestTrue("Default filter should keep error line", PassAll.Passes(ErrorLine));
+	TestTrue("Default filter should keep verbose line", PassAll.Passes(VerboseLine));
+
+	// Severity floor drops less severe lines
+	FMCPLogRingBuffer::FLogFilter WarningsAndWorse;
+	WarningsAndWorse.MinVerbosity = ELogVerbosity::Warning;
+	TestTrue("Warning floor should keep error line", WarningsAndWorse.Passes(ErrorLine));
+	TestFalse("Warning floor should drop verbose line", WarningsAndWorse.Passes(VerboseLine));
+
+	// Category set keeps only listed categories
+	FMCPLogRingBuffer::FLogFilter BlueprintOnly;
+	BlueprintOnly.Categories.Add(FName(TEXT("LogBlueprint")));
+	TestTrue("Category filter should keep matching line", BlueprintOnly.Passes(ErrorLine));
+	TestFalse("Category filter should drop other categories", BlueprintOnly.Passes(VerboseLine));
+
+	// Combined: both conditions must hold
+	BlueprintOnly.MinVerbosity = ELogVerbosity::Error;
+	TestTrue("Combined filter should keep blueprint error", BlueprintOnly.Passes(ErrorLine));
+	ErrorLine.Verbosity = ELogVerbosity::Log;
+	TestFalse("Combined filter should drop blueprint log line", BlueprintOnly.Passes(ErrorLine));
+
+	return true;
+}
+
+// The tool rejects an unknown verbosity name before touching the log
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_GetOutputLog_InvalidVerbosity,
+	"UnrealClaude.MCP.Tools.GetOutputLog.InvalidVerbosity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_GetOutputLog_InvalidVerbosity::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("get_output_log"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetNumberField(TEXT("cursor"), 0);
+	Params->SetStringField(TEXT("min_verbosity"), TEXT("Loudest"));
+	FMCPToolResult Result = Tool->Execute(Params);
+	TestFalse("Unknown verbosity should fail", Result.bSuccess);
+	TestTrue("Error should mention min_verbosity",
+		Result.Message.Contains(TEXT("min_verbosity")));
+
+	return true;
+}
+
+// ===== Move Actor Batch Tests =====
+
+// An empty batch is rejected before any transaction opens
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_MoveActor_EmptyBatch,
+	"UnrealClaude.MCP.Tools.MoveActor.EmptyBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_MoveActor_EmptyBatch::RunTest(const FString& Parameters)
+{
+	FMCPTool_MoveActor Tool;
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetArrayField(TEXT("moves"), TArray<TSharedPtr<FJsonValue>>());
+
+	FMCPToolResult Result = Tool.Execute(Params);
+	TestFalse("Empty moves array should fail", Result.bSuccess);
+	TestTrue("Error should mention moves", Result.Message.Contains(TEXT("moves")));
+
+	return true;
+}
+
+// ===== Viewport Sequence Capture Tests =====
+
+// Sequence parameters are validated before any viewport work starts
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_CaptureViewport_SequenceLimits,
+	"UnrealClaude.MCP.Tools.CaptureViewport.SequenceLimits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_CaptureViewport_SequenceLimits::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("capture_viewport"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	TSharedRef<FJsonObject> TooManyFrames = MakeShared<FJsonObject>();
+	TooManyFrames->SetNumberField(TEXT("frame_count"),
+		UnrealClaudeConstants::MCPServer::MaxViewportSequenceFrames + 1);
+	FMCPToolResult FrameResult = Tool->Execute(TooManyFrames);
+	TestFalse("Oversized frame_count should fail", FrameResult.bSuccess);
+	TestTrue("Error should mention frame_count", FrameResult.Message.Contains(TEXT("frame_count")));
+
+	TSharedRef<FJsonObject> TooFast = MakeShared<FJsonObject>();
+	TooFast->SetNumberField(TEXT("frame_count"), 5);
+	TooFast->SetNumberField(TEXT("interval_ms"),
+		UnrealClaudeConstants::MCPServer::MinViewportSequenceIntervalMs - 1);
+	FMCPToolResult IntervalResult = Tool->Execute(TooFast);
+	TestFalse("Sub-floor interval should fail", IntervalResult.bSuccess);
+	TestTrue("Error should mention interval_ms", IntervalResult.Message.Contains(TEXT("interval_ms")));
+
+	return true;
+}
+
+// ===== Edit Session Checkpoint Tests =====
+
+// Checkpoint and rollback only exist inside an open session
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_EditSession_CheckpointRequiresSession,
+	"UnrealClaude.MCP.Tools.EditSession.CheckpointRequiresSession",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_EditSession_CheckpointRequiresSession::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("edit_session"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	TSharedRef<FJsonObject> CheckpointParams = MakeShared<FJsonObject>();
+	CheckpointParams->SetStringField(TEXT("operation"), TEXT("checkpoint"));
+	FMCPToolResult CheckpointResult = Tool->Execute(CheckpointParams);
+	TestFalse("Checkpoint without a session should fail", CheckpointResult.bSuccess);
+
+	TSharedRef<FJsonObject> RollbackParams = MakeShared<FJsonObject>();
+	RollbackParams->SetStringField(TEXT("operation"), TEXT("rollback"));
+	FMCPToolResult RollbackResult = Tool->Execute(RollbackParams);
+	TestFalse("Rollback without a session should fail", RollbackResult.bSuccess);
+
+	// Status still answers and reports no checkpoints
+	TSharedRef<FJsonObject> StatusParams = MakeShared<FJsonObject>();
+	StatusParams->SetStringField(TEXT("operation"), TEXT("status"));
+	FMCPToolResult StatusResult = Tool->Execute(StatusParams);
+	TestTrue("Status should succeed", StatusResult.bSuccess);
+	if (StatusResult.Data.IsValid())
+	{
+		bool bActive = true;
+		StatusResult.Data->TryGetBoolField(TEXT("active"), bActive);
+		TestFalse("No session should be active", bActive);
+	}
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,8 +6,14 @@
 #include "ClaudeCodeRunner.h"
 #include "ClaudeSubsystem.h"
 #include "ScriptExecutionManager.h"
+#include "BlueprintLoader.h"
 #include "MCP/UnrealClaudeMCPServer.h"
+#include "MCP/MCPAssetGraphCache.h"
+#include "MCP/MCPFactoryPool.h"
+#include "MCP/MCPLogRingBuffer.h"
+#include "MCP/MCPMutationJournal.h"
 #include "ProjectContext.h"
+#include "UnrealClaudeSettings.h"
 
 #include "Framework/Docking/TabManager.h"
 #include "Framework/Notifications/NotificationManager.h"
@@ -20,9 +26,16 @@
 #include "WorkspaceMenuStructureModule.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HttpServerModule.h"
+#include "HAL/LowLevelMemTracker.h"
 
 DEFINE_LOG_CATEGORY(LogUnrealClaude);
 
+// One LLM tag for the whole plugin: when the editor runs with -llm, the
+// plugin's allocations show up as their own row in `stat llm` / Memory
+// Insights instead of dissolving into the engine totals. The gauges in
+// /mcp/status stay available without the tracker; this is the precise path.
+LLM_DEFINE_TAG(UnrealClaude);
+
 #define LOCTEXT_NAMESPACE "FUnrealClaudeModule"
 
 static const FName ClaudeTabName("ClaudeAssistant");
@@ -146,6 +159,20 @@ void FUnrealClaudeModule::StartupModule()
 	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
 	LevelEditorModule.GetGlobalLevelEditorActions()->Append(PluginCommands.ToSharedRef());
 
+	// Everything below registers no UI and is not needed for first paint -
+	// defer it onto the core ticker, which first fires once the editor main
+	// loop is running. Until the deferred pass completes, /mcp/status (and
+	// every other route) refuses connections, which is the readiness signal
+	// clients already poll for.
+	DeferredStartupHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FUnrealClaudeModule::RunDeferredStartup),
+		UnrealClaudeConstants::MCPServer::DeferredStartupDelaySeconds);
+}
+
+bool FUnrealClaudeModule::RunDeferredStartup(float /*DeltaTime*/)
+{
+	DeferredStartupHandle.Reset();
+
 	// Check Claude availability
 	if (FClaudeCodeRunner::IsClaudeAvailable())
 	{
@@ -159,20 +186,51 @@ void FUnrealClaudeModule::StartupModule()
 	// Start MCP Server
 	StartMCPServer();
 
+	// Push the user's tuning settings into the freshly started systems
+	// (worker pool size, admission limits, retention)
+	UUnrealClaudeSettings::Get().ApplyToRunningSystems();
+
+	// Capture log output into the ring buffer so get_output_log cursor
+	// polls only pay for new lines
+	FMCPLogRingBuffer::Get().Register();
+
+	// Build the reverse-reference index in the background so the referencers
+	// tool answers from memory once the registry's initial scan completes
+	FMCPAssetGraphCache::Get().StartReferencerIndexBuild();
+
 	// Initialize project context (async, will gather in background)
 	FProjectContextManager::Get().RefreshContext();
 
 	// Initialize script execution manager (creates script directories)
 	FScriptExecutionManager::Get();
+
+	return false; // one-shot
 }
 
 void FUnrealClaudeModule::ShutdownModule()
 {
 	UE_LOG(LogUnrealClaude, Log, TEXT("UnrealClaude module shutting down"));
 
+	// If the editor is closing before the deferred startup fired, cancel it
+	if (DeferredStartupHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DeferredStartupHandle);
+		DeferredStartupHandle.Reset();
+	}
+
 	// Stop MCP Server
 	StopMCPServer();
 
+	// Drop the Blueprint burst pins and pooled factories before the UObject
+	// system tears down so no strong references outlive module shutdown
+	FBlueprintLoader::ReleaseBurstPins();
+	FMCPFactoryPool::Get().ReleaseAll();
+
+	// Close the mutation journal so its last entries are on disk
+	FMCPMutationJournal::Get().Close();
+
+	FMCPLogRingBuffer::Get().Unregister();
+
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
 
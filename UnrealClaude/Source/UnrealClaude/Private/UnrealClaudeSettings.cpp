@@ -0,0 +1,92 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "UnrealClaudeSettings.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeModule.h"
+#include "MCP/UnrealClaudeMCPServer.h"
+#include "MCP/MCPToolRegistry.h"
+#include "MCP/MCPTaskQueue.h"
+#include "MCP/MCPAdmissionController.h"
+#include "Modules/ModuleManager.h"
+
+UUnrealClaudeSettings::UUnrealClaudeSettings()
+{
+	// Seed from the compiled-in defaults so a fresh machine behaves
+	// exactly as it did before this settings surface existed
+	FMCPTaskQueueConfig Defaults;
+	MaxConcurrentTasks = Defaults.MaxConcurrentTasks;
+	bAdaptiveConcurrency = Defaults.bAdaptiveConcurrency;
+	MaxTaskHistorySize = Defaults.MaxHistorySize;
+	ResultRetentionSeconds = Defaults.ResultRetentionSeconds;
+	DefaultTaskTimeoutMs = static_cast<int32>(Defaults.DefaultTimeoutMs);
+	DedupResultTTLSeconds = Defaults.DedupResultTTLSeconds;
+
+	AssetSearchCursorTTLSeconds = static_cast<int32>(UnrealClaudeConstants::MCPServer::AssetSearchCursorTTLSeconds);
+	MaxInFlightToolRequests = UnrealClaudeConstants::MCPServer::MaxInFlightToolRequests;
+	MaxQueuedBackgroundTasks = UnrealClaudeConstants::MCPServer::MaxQueuedBackgroundTasks;
+	KeepAliveIdleTimeoutSeconds = UnrealClaudeConstants::MCPServer::KeepAliveIdleTimeoutSeconds;
+	bEnableLocalPipeTransport = false;
+	bRecordToolTraffic = false;
+	ViewportJpegQuality = 70;
+}
+
+const UUnrealClaudeSettings& UUnrealClaudeSettings::Get()
+{
+	return *GetDefault<UUnrealClaudeSettings>();
+}
+
+#if WITH_EDITOR
+void UUnrealClaudeSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	SaveConfig();
+	ApplyToRunningSystems();
+}
+#endif
+
+void UUnrealClaudeSettings::ApplyToRunningSystems() const
+{
+	FMCPAdmissionController::Get().SetLimits(MaxInFlightToolRequests, MaxQueuedBackgroundTasks);
+
+	FUnrealClaudeModule* Module = FModuleManager::GetModulePtr<FUnrealClaudeModule>(TEXT("UnrealClaude"));
+	TSharedPtr<FUnrealClaudeMCPServer> Server = Module ? Module->GetMCPServer() : nullptr;
+	TSharedPtr<FMCPToolRegistry> Registry = Server.IsValid() ? Server->GetToolRegistry() : nullptr;
+	TSharedPtr<FMCPTaskQueue> Queue = Registry.IsValid() ? Registry->GetTaskQueue() : nullptr;
+	if (!Queue.IsValid())
+	{
+		return;
+	}
+
+	// Scalar config reads race worker maintenance benignly (plain ints,
+	// same soft-limit stance as the admission controller)
+	Queue->Config.MaxHistorySize = MaxTaskHistorySize;
+	Queue->Config.ResultRetentionSeconds = ResultRetentionSeconds;
+	Queue->Config.DefaultTimeoutMs = static_cast<uint32>(DefaultTaskTimeoutMs);
+	Queue->Config.DedupResultTTLSeconds = DedupResultTTLSeconds;
+
+	if (Queue->Config.MaxConcurrentTasks != MaxConcurrentTasks ||
+		Queue->Config.bAdaptiveConcurrency != bAdaptiveConcurrency)
+	{
+		Queue->Config.MaxConcurrentTasks = MaxConcurrentTasks;
+		Queue->Config.bAdaptiveConcurrency = bAdaptiveConcurrency;
+
+		// The pool is sized at Start(); resizing means restarting the
+		// workers, which is only safe with nothing queued or running -
+		// otherwise the change takes effect when the queue next restarts
+		int32 Pending = 0, Running = 0, Completed = 0;
+		Queue->GetStats(Pending, Running, Completed);
+		if (Pending == 0 && Running == 0)
+		{
+			Queue->Shutdown();
+			Queue->Start();
+			UE_LOG(LogUnrealClaude, Log, TEXT("Task queue worker pool resized to %d"), MaxConcurrentTasks);
+		}
+		else
+		{
+			UE_LOG(LogUnrealClaude, Log,
+				TEXT("Task queue busy (%d pending, %d running); worker pool resize to %d deferred until restart"),
+				Pending, Running, MaxConcurrentTasks);
+		}
+	}
+}
@@ -49,7 +49,7 @@ void SClaudeInputArea::Construct(const FArguments& InArgs)
 						.OnTextChanged(this, &SClaudeInputArea::HandleTextChanged)
 						.OnTextCommitted(this, &SClaudeInputArea::HandleTextCommitted)
 						.OnKeyDownHandler(this, &SClaudeInputArea::OnInputKeyDown)
-						.IsEnabled_Lambda([this]() { return !bIsWaiting.Get(); })
+						.IsEnabled_Lambda([this]() { return !bIsWaiting; })
 					]
 				]
 			]
@@ -71,7 +71,7 @@ void SClaudeInputArea::Construct(const FArguments& InArgs)
 					.Text(LOCTEXT("Paste", "Paste"))
 					.OnClicked(this, &SClaudeInputArea::HandlePasteClicked)
 					.ToolTipText(LOCTEXT("PasteTip", "Paste text from clipboard (supports large text)"))
-					.IsEnabled_Lambda([this]() { return !bIsWaiting.Get(); })
+					.IsEnabled_Lambda([this]() { return !bIsWaiting; })
 				]
 
 				// Send/Cancel button
@@ -79,7 +79,7 @@ void SClaudeInputArea::Construct(const FArguments& InArgs)
 				.AutoHeight()
 				[
 					SNew(SButton)
-					.Text_Lambda([this]() { return bIsWaiting.Get() ? LOCTEXT("Cancel", "Cancel") : LOCTEXT("Send", "Send"); })
+					.Text_Lambda([this]() { return bIsWaiting ? LOCTEXT("Cancel", "Cancel") : LOCTEXT("Send", "Send"); })
 					.OnClicked(this, &SClaudeInputArea::HandleSendCancelClicked)
 					.ButtonStyle(FAppStyle::Get(), "PrimaryButton")
 				]
@@ -173,7 +173,7 @@ FReply SClaudeInputArea::HandlePasteClicked()
 
 FReply SClaudeInputArea::HandleSendCancelClicked()
 {
-	if (bIsWaiting.Get())
+	if (bIsWaiting)
 	{
 		OnCancel.ExecuteIfBound();
 	}
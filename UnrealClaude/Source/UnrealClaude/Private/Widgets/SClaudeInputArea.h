@@ -21,7 +21,7 @@ public:
 	SLATE_BEGIN_ARGS(SClaudeInputArea)
 		: _bIsWaiting(false)
 	{}
-		SLATE_ATTRIBUTE(bool, bIsWaiting)
+		SLATE_ARGUMENT(bool, bIsWaiting)
 		SLATE_EVENT(FOnInputAction, OnSend)
 		SLATE_EVENT(FOnInputAction, OnCancel)
 		SLATE_EVENT(FOnTextChangedEvent, OnTextChanged)
@@ -38,6 +38,9 @@ public:
 	/** Clear the input */
 	void ClearText();
 
+	/** Push waiting state in on events; flips the Send button to Cancel */
+	void SetIsWaiting(bool bInIsWaiting) { bIsWaiting = bInIsWaiting; }
+
 private:
 	/** Handle key down in input box */
 	FReply OnInputKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent);
@@ -58,7 +61,7 @@ private:
 	TSharedPtr<SMultiLineEditableTextBox> InputTextBox;
 	FString CurrentInputText;
 
-	TAttribute<bool> bIsWaiting;
+	bool bIsWaiting = false;
 	FOnInputAction OnSend;
 	FOnInputAction OnCancel;
 	FOnTextChangedEvent OnTextChangedDelegate;
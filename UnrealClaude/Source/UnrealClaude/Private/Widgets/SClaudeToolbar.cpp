@@ -55,8 +55,12 @@ void SClaudeToolbar::Construct(const FArguments& InArgs)
 			.Padding(8.0f, 0.0f)
 			[
 				SNew(SCheckBox)
-				.IsChecked_Lambda([this]() { return bUE57ContextEnabled.Get() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
-				.OnCheckStateChanged_Lambda([this](ECheckBoxState NewState) { OnUE57ContextChanged.ExecuteIfBound(NewState == ECheckBoxState::Checked); })
+				.IsChecked_Lambda([this]() { return bUE57ContextEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([this](ECheckBoxState NewState)
+				{
+					bUE57ContextEnabled = (NewState == ECheckBoxState::Checked);
+					OnUE57ContextChanged.ExecuteIfBound(bUE57ContextEnabled);
+				})
 				.ToolTipText(LOCTEXT("UE57ContextTip", "Include Unreal Engine 5.7 context in prompts"))
 				[
 					SNew(STextBlock)
@@ -71,8 +75,12 @@ void SClaudeToolbar::Construct(const FArguments& InArgs)
 			.Padding(4.0f, 0.0f)
 			[
 				SNew(SCheckBox)
-				.IsChecked_Lambda([this]() { return bProjectContextEnabled.Get() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
-				.OnCheckStateChanged_Lambda([this](ECheckBoxState NewState) { OnProjectContextChanged.ExecuteIfBound(NewState == ECheckBoxState::Checked); })
+				.IsChecked_Lambda([this]() { return bProjectContextEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([this](ECheckBoxState NewState)
+				{
+					bProjectContextEnabled = (NewState == ECheckBoxState::Checked);
+					OnProjectContextChanged.ExecuteIfBound(bProjectContextEnabled);
+				})
 				.ToolTipText(LOCTEXT("ProjectContextTip", "Include project source files and level actors in prompts"))
 				[
 					SNew(STextBlock)
@@ -102,7 +110,7 @@ void SClaudeToolbar::Construct(const FArguments& InArgs)
 				.Text(LOCTEXT("RestoreContext", "Restore Context"))
 				.OnClicked_Lambda([this]() { OnRestoreSession.ExecuteIfBound(); return FReply::Handled(); })
 				.ToolTipText(LOCTEXT("RestoreContextTip", "Restore previous session context from disk"))
-				.IsEnabled_Lambda([this]() { return bRestoreEnabled.Get(); })
+				.IsEnabled_Lambda([this]() { return bRestoreEnabled; })
 			]
 
 			// New Session button
@@ -12,6 +12,10 @@ DECLARE_DELEGATE_OneParam(FOnCheckboxChanged, bool)
 /**
  * Toolbar widget for Claude Editor
  * Handles UE context toggles, session management buttons
+ *
+ * State is plain values pushed in on events rather than Slate attributes, so
+ * an idle toolbar does no per-frame calls back into the owning widget or
+ * subsystem.
  */
 class SClaudeToolbar : public SCompoundWidget
 {
@@ -21,9 +25,9 @@ public:
 		, _bProjectContextEnabled(true)
 		, _bRestoreEnabled(false)
 	{}
-		SLATE_ATTRIBUTE(bool, bUE57ContextEnabled)
-		SLATE_ATTRIBUTE(bool, bProjectContextEnabled)
-		SLATE_ATTRIBUTE(bool, bRestoreEnabled)
+		SLATE_ARGUMENT(bool, bUE57ContextEnabled)
+		SLATE_ARGUMENT(bool, bProjectContextEnabled)
+		SLATE_ARGUMENT(bool, bRestoreEnabled)
 		SLATE_EVENT(FOnCheckboxChanged, OnUE57ContextChanged)
 		SLATE_EVENT(FOnCheckboxChanged, OnProjectContextChanged)
 		SLATE_EVENT(FOnToolbarAction, OnRefreshContext)
@@ -35,10 +39,13 @@ public:
 
 	void Construct(const FArguments& InArgs);
 
+	/** Enable or disable the Restore Context button (e.g. when a saved session appears) */
+	void SetRestoreEnabled(bool bEnabled) { bRestoreEnabled = bEnabled; }
+
 private:
-	TAttribute<bool> bUE57ContextEnabled;
-	TAttribute<bool> bProjectContextEnabled;
-	TAttribute<bool> bRestoreEnabled;
+	bool bUE57ContextEnabled = true;
+	bool bProjectContextEnabled = true;
+	bool bRestoreEnabled = false;
 
 	FOnCheckboxChanged OnUE57ContextChanged;
 	FOnCheckboxChanged OnProjectContextChanged;
@@ -36,6 +36,9 @@ public:
 	/** Get the Claude CLI path */
 	static FString GetClaudePath();
 
+	/** Shut down the resident Claude process if one is alive */
+	void ShutdownResidentProcess();
+
 	// FRunnable interface
 	virtual bool Init() override;
 	virtual uint32 Run() override;
@@ -47,6 +50,32 @@ private:
 	void ExecuteProcess();
 	void CleanupHandles();
 
+	// ===== Resident process mode =====
+	// Keeps one Claude CLI session alive across requests so follow-up
+	// prompts skip process creation (and CLI cold start) entirely.
+	// Prompts go in as stream-json user messages on stdin; each turn ends
+	// when the CLI emits its stream-json result record.
+
+	/** Build arguments shared by one-shot and resident command lines */
+	FString BuildCommonArgs(const FClaudeRequestConfig& Config);
+
+	/** Execute the current request against the warm resident process */
+	void ExecuteResidentProcess();
+
+	/** Whether the resident child process is still running */
+	bool IsResidentProcessAlive();
+
+	/** Write UTF-8 text to the resident process stdin */
+	bool WriteToProcessStdIn(const FString& Text);
+
+	/** Non-blocking read of whatever stdout bytes are currently available */
+	bool ReadAvailableProcessOutput(FString& OutChunk);
+
+	/** Read stream-json lines until the turn's result record arrives,
+	 *  reporting assistant text deltas via OnProgressDelegate on the way;
+	 *  returns the final response text */
+	FString ReadResidentResponse();
+
 #if PLATFORM_WINDOWS || PLATFORM_MAC
 	/** Create pipes for process stdout/stderr capture */
 	bool CreateProcessPipes();
@@ -84,7 +113,10 @@ private:
 	// Last error code for detailed error reporting (Windows error code or errno on macOS)
 	uint32 LastProcessError = 0;
 
-	// Temp file paths for prompts (to avoid command line length limits)
-	FString SystemPromptFilePath;
-	FString PromptFilePath;
+	// Resident process state
+	/** Whether a warm resident process is currently alive */
+	bool bResidentProcessActive = false;
+
+	/** Partial stdout line carried over between resident turns */
+	FString ResidentOutputBuffer;
 };
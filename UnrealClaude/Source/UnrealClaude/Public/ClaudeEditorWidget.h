@@ -5,11 +5,48 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/Views/SListView.h"
 
 class SMultiLineEditableTextBox;
-class SScrollBox;
 class SVerticalBox;
+class STextBlock;
 class SClaudeInputArea;
+class SClaudeToolbar;
+
+/**
+ * One transcript entry. The transcript stores these instead of widgets so the
+ * list view can virtualize: only messages in view have live Slate widgets, and
+ * a row re-reads its item's text when regenerated (which is also how streaming
+ * updates reach the screen - mutate the item, no widget pointer needed).
+ *
+ * Text is stored rope-style as sealed paragraphs plus a live tail. Streamed
+ * chunks append to the tail; once the tail passes a size threshold, completed
+ * paragraphs seal behind it. Sealed paragraphs render as their own text
+ * blocks that never change, so per-chunk shaping cost stays bounded by the
+ * tail length no matter how large the full response grows.
+ */
+struct FChatMessageItem
+{
+	FChatMessageItem(const FString& InMessage, bool bInIsUser)
+		: Tail(InMessage)
+		, bIsUser(bInIsUser)
+	{
+	}
+
+	/** Append a streamed chunk, sealing completed paragraphs past the threshold */
+	void Append(const FString& Chunk);
+
+	/** Replace the whole message (drops any sealed paragraphs) */
+	void SetText(const FString& InMessage);
+
+	/** Paragraphs sealed behind the live tail; their widgets never re-shape */
+	TArray<FString> SealedParagraphs;
+
+	/** Live portion still receiving appends; bounded by the seal threshold */
+	FString Tail;
+
+	bool bIsUser;
+};
 
 /**
  * Chat message display widget
@@ -18,13 +55,27 @@ class SChatMessage : public SCompoundWidget
 {
 public:
 	SLATE_BEGIN_ARGS(SChatMessage)
-		: _IsUser(true)
 	{}
-		SLATE_ARGUMENT(FString, Message)
-		SLATE_ARGUMENT(bool, IsUser)
+		SLATE_ARGUMENT(TSharedPtr<FChatMessageItem>, Item)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
+
+	/** Picks up paragraphs the item sealed since the last frame */
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	/** Insert one static text block for a sealed paragraph, ahead of the tail */
+	void InsertSealedParagraph(const FString& Paragraph, int32 Index);
+
+	/** Item this row displays */
+	TSharedPtr<FChatMessageItem> Item;
+
+	/** Container holding sealed paragraph blocks followed by the live tail */
+	TSharedPtr<SVerticalBox> ParagraphBox;
+
+	/** How many of the item's sealed paragraphs have widgets already */
+	int32 NumSealedSynced = 0;
 };
 
 /**
@@ -84,20 +135,32 @@ private:
 	FSlateColor GetStatusColor() const;
 	
 private:
-	/** Chat message container */
-	TSharedPtr<SVerticalBox> ChatMessagesBox;
+	/** Transcript entries backing the virtualized list view */
+	TArray<TSharedPtr<FChatMessageItem>> ChatMessages;
 
-	/** Scroll box for chat */
-	TSharedPtr<SScrollBox> ChatScrollBox;
+	/** Virtualized transcript view; only visible rows have live widgets */
+	TSharedPtr<SListView<TSharedPtr<FChatMessageItem>>> ChatListView;
 
 	/** Input area widget */
 	TSharedPtr<SClaudeInputArea> InputArea;
 
+	/** Toolbar widget (restore button state pushed in on status events) */
+	TSharedPtr<SClaudeToolbar> Toolbar;
+
+	/** Status bar text block, updated on status events rather than per frame */
+	TSharedPtr<STextBlock> StatusTextBlock;
+
+	/** Subscription to the subsystem's status-changed broadcast */
+	FDelegateHandle StatusChangedHandle;
+
 	/** Current input text */
 	FString CurrentInputText;
-	
-	/** Is currently waiting for response */
+
+	/** Mirrors the subsystem's busy state; updated by status events */
 	bool bIsWaitingForResponse = false;
+
+	/** Claude CLI availability, checked once and on status events (not per frame) */
+	bool bClaudeAvailable = false;
 	
 	/** Last response for copying */
 	FString LastResponse;
@@ -105,8 +168,8 @@ private:
 	/** Accumulated streaming response */
 	FString StreamingResponse;
 
-	/** Current streaming message widget (for updating in place) */
-	TSharedPtr<STextBlock> StreamingTextBlock;
+	/** Transcript entry the current streaming response writes into */
+	TSharedPtr<FChatMessageItem> StreamingItem;
 
 	/** Include UE5.7 context in prompts */
 	bool bIncludeUE57Context = true;
@@ -131,4 +194,13 @@ private:
 
 	/** Generate MCP tool status message for greeting */
 	FString GenerateMCPStatusMessage() const;
+
+	/** Build a row widget for one transcript entry (called only for visible rows) */
+	TSharedRef<ITableRow> OnGenerateMessageRow(TSharedPtr<FChatMessageItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** Refresh the list view and keep it pinned to the newest message */
+	void ScrollChatToBottom();
+
+	/** Push subsystem status into the toolbar, input area and status bar */
+	void OnSubsystemStatusChanged();
 };
@@ -4,18 +4,46 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * Summary of one named session, read from the session index without
+ * loading any message bodies
+ */
+struct UNREALCLAUDE_API FClaudeSessionInfo
+{
+	/** Session name (sanitized, unique) */
+	FString Name;
+
+	/** Timestamp of the last exchange or switch (ISO 8601) */
+	FString LastUpdated;
+
+	/** Number of exchanges at the time the index was last updated */
+	int32 MessageCount = 0;
+};
+
 /**
  * Manages Claude conversation session persistence and history
  * Single responsibility: session storage and retrieval
+ *
+ * Supports multiple named sessions for parallel workstreams. Each session
+ * has its own snapshot + journal pair on disk; a small index file lists
+ * all sessions (name, timestamp, message count) so enumeration never
+ * parses message bodies. Switching stashes the outgoing history in a
+ * bounded LRU of resident sessions - switching back within the bound is
+ * instant, older sessions reload lazily from disk.
  */
 class UNREALCLAUDE_API FClaudeSessionManager
 {
 public:
 	FClaudeSessionManager();
+	~FClaudeSessionManager();
 
 	/** Get conversation history */
 	const TArray<TPair<FString, FString>>& GetHistory() const { return ConversationHistory; }
 
+	/** Estimated bytes retained by the active history and resident
+	 *  sessions (memory accounting gauge) */
+	uint64 GetEstimatedMemoryBytes() const;
+
 	/** Add a new exchange to history */
 	void AddExchange(const FString& Prompt, const FString& Response);
 
@@ -31,9 +59,40 @@ public:
 	/** Check if a previous session exists */
 	bool HasSavedSession() const;
 
-	/** Get session file path */
+	/** Get the legacy JSON snapshot path (still read for pre-existing
+	 *  sessions; compaction writes the binary snapshot) */
 	FString GetSessionFilePath() const;
 
+	/** Get session journal file path */
+	FString GetJournalFilePath() const;
+
+	/** Name of the session history currently in memory */
+	FString GetActiveSessionName() const { return ActiveSessionName; }
+
+	/**
+	 * Switch to the named session, creating it if it does not exist.
+	 * The outgoing session's history stays resident (LRU-bounded) so
+	 * switching back avoids a disk reload; its exchanges are already
+	 * durable in its journal.
+	 */
+	bool SwitchSession(const FString& Name);
+
+	/** Enumerate sessions from the index file - no message bodies are read */
+	TArray<FClaudeSessionInfo> ListSessions() const;
+
+	/**
+	 * Estimated token count of the whole in-memory history (character-count
+	 * based, same ratio the context budgeter uses)
+	 */
+	int32 GetEstimatedHistoryTokens() const;
+
+	/**
+	 * Replace the oldest NumToReplace exchanges with a single digest entry
+	 * and rewrite the snapshot so disk matches memory. Used by background
+	 * history summarization.
+	 */
+	bool CompactOldExchanges(int32 NumToReplace, const FString& DigestText);
+
 	/** Get max history size */
 	int32 GetMaxHistorySize() const { return MaxHistorySize; }
 
@@ -41,6 +100,67 @@ public:
 	void SetMaxHistorySize(int32 NewMax) { MaxHistorySize = FMath::Max(1, NewMax); }
 
 private:
+	/** Path of the binary snapshot ("<base>.ucsession") */
+	FString GetBinarySnapshotFilePath() const;
+
+	/**
+	 * Serialize the full history as the versioned binary snapshot:
+	 * length-prefixed records (LZ4-compressed above a size threshold) with
+	 * a trailing offset index, so loads can seek straight to the tail.
+	 */
+	bool WriteBinarySnapshot() const;
+
+	/**
+	 * Load up to MaxRecords exchanges from the tail of the binary snapshot.
+	 * Reads the trailing index plus only the records it needs, so restore
+	 * cost tracks the history cap, not the file size.
+	 * @return true if the snapshot existed and parsed (false falls back to
+	 *         the legacy JSON path)
+	 */
+	bool LoadBinarySnapshot(int32 MaxRecords);
+
+	/** Append one exchange record to the journal file (O(1) disk write) */
+	bool AppendToJournal(const FString& Prompt, const FString& Response);
+
+	/** Replay journal records on top of the loaded snapshot */
+	void ReplayJournal();
+
+	/** Fold the journal into a fresh full snapshot and delete it */
+	bool CompactJournal();
+
+	/** Character-based token estimate for one exchange */
+	static int32 EstimateExchangeTokens(const TPair<FString, FString>& Exchange);
+
+	/** Drop oldest exchanges while the history exceeds its token budget */
+	void TrimHistoryToTokenBudget();
+
+	/** Keep only session-name-safe characters (alnum, '-', '_') */
+	static FString SanitizeSessionName(const FString& Name);
+
+	/** File stem for a session ("session" for the default, "session_<name>" otherwise) */
+	static FString SessionFileBase(const FString& Name);
+
+	/** Path of the session index file */
+	FString GetIndexFilePath() const;
+
+	/** Refresh the active session's entry in the index file */
+	void UpdateSessionIndex() const;
+
+	/** Move the active history into the resident LRU and evict beyond the bound */
+	void StashActiveSession();
+
 	TArray<TPair<FString, FString>> ConversationHistory;
 	int32 MaxHistorySize;
+
+	/** Journal records written since the last compaction */
+	int32 JournalEntriesSinceCompaction;
+
+	/** Which named session ConversationHistory belongs to */
+	FString ActiveSessionName;
+
+	/** Histories of sessions switched away from, keyed by name */
+	TMap<FString, TArray<TPair<FString, FString>>> ResidentSessions;
+
+	/** LRU order for ResidentSessions, least recently used first */
+	TArray<FString> ResidentSessionOrder;
 };
@@ -9,6 +9,9 @@
 class FClaudeSessionManager;
 class FClaudeCodeRunner;
 
+/** Fired on the game thread when busy state or saved-session availability changes */
+DECLARE_MULTICAST_DELEGATE(FOnClaudeStatusChanged);
+
 /**
  * Options for sending a prompt to Claude
  * Reduces parameter count in SendPrompt method
@@ -21,9 +24,31 @@ struct UNREALCLAUDE_API FClaudePromptOptions
 	/** Include project-specific context in system prompt */
 	bool bIncludeProjectContext = true;
 
+	/** Include recent conversation history in the prompt (token-budgeted) */
+	bool bIncludeHistory = true;
+
 	/** Optional callback for streaming output progress */
 	FOnClaudeProgress OnProgress;
 
+	/**
+	 * Serve this prompt from the on-disk response cache when a fresh entry
+	 * exists, and store the response on success. Only for idempotent queries
+	 * ("describe this project", "what classes exist") - the cache key covers
+	 * the prompt, the context options, and the project context version, so
+	 * entries invalidate when the project context is re-gathered or after
+	 * Session::ResponseCacheTTLSeconds. Cached hits bypass the CLI entirely
+	 * and are not recorded in chat history.
+	 */
+	bool bAllowCachedResponse = false;
+
+	/**
+	 * Run on the background lane instead of the interactive one.
+	 * Background requests execute on their own pooled CLI process (bounded
+	 * concurrency), never touch the busy flag or chat history, and never
+	 * block - or wait for - the user's interactive prompt.
+	 */
+	bool bBackgroundPriority = false;
+
 	/** Default constructor with sensible defaults */
 	FClaudePromptOptions() = default;
 
@@ -65,8 +90,9 @@ public:
 	/** Get the default UE5.7 system prompt */
 	FString GetUE57SystemPrompt() const;
 
-	/** Get the project context prompt */
-	FString GetProjectContextPrompt() const;
+	/** Get the project context prompt, budgeted and biased toward identifiers
+	 *  the given text mentions (pass the outgoing prompt) */
+	FString GetProjectContextPrompt(const FString& PromptForHints = FString()) const;
 
 	/** Set custom system prompt additions */
 	void SetCustomSystemPrompt(const FString& InCustomPrompt);
@@ -77,6 +103,17 @@ public:
 	/** Clear conversation history */
 	void ClearHistory();
 
+	/** Delete every cached prompt response (explicit invalidation) */
+	void ClearResponseCache();
+
+	/**
+	 * Enable background history summarization: when the history's estimated
+	 * token count crosses Session::SummarizeTriggerTokens, older exchanges
+	 * are compacted into a digest entry by a background-lane request,
+	 * keeping recent exchanges verbatim. Off by default.
+	 */
+	void SetAutoSummarizeHistory(bool bEnabled) { bAutoSummarizeHistory = bEnabled; }
+
 	/** Cancel current request */
 	void CancelCurrentRequest();
 
@@ -95,13 +132,75 @@ public:
 	/** Get the runner interface (for testing/mocking) */
 	IClaudeRunner* GetRunner() const;
 
+	/** Whether a prompt is currently in flight */
+	bool IsBusy() const { return bBusy; }
+
+	/**
+	 * Status change notifications. UI subscribes here and refreshes on events
+	 * instead of polling the subsystem through per-frame Slate attributes.
+	 */
+	FOnClaudeStatusChanged OnStatusChanged;
+
 private:
 	FClaudeCodeSubsystem();
 
 	/** Build prompt with conversation history context */
 	FString BuildPromptWithHistory(const FString& NewPrompt) const;
 
+	/** Build the request config (prompt, context, tools) shared by both lanes */
+	FClaudeRequestConfig BuildRequestConfig(const FString& Prompt, const FClaudePromptOptions& Options) const;
+
+	/** Cache key for an idempotent prompt: hash of the prompt text, the
+	 *  context options and custom prompt, and the project context version */
+	FString BuildResponseCacheKey(const FString& Prompt, const FClaudePromptOptions& Options) const;
+
+	/** Look up a fresh cached response; expired entries are deleted on read */
+	bool TryGetCachedResponse(const FString& CacheKey, FString& OutResponse) const;
+
+	/** Persist a successful response under its cache key */
+	void StoreCachedResponse(const FString& CacheKey, const FString& Response) const;
+
+	/** Lease a background runner for the request, or queue it when the pool is full */
+	void DispatchBackgroundPrompt(const FString& Prompt, FOnClaudeResponse OnComplete, const FClaudePromptOptions& Options);
+
+	/** Release a finished background lease and start the next queued request */
+	void RetireBackgroundRunner(FClaudeCodeRunner* Finished);
+
+	/** Kick off a background digest of old exchanges when history is heavy */
+	void MaybeSummarizeHistory();
+
+	/** Update busy state and broadcast if it changed */
+	void SetBusy(bool bInBusy);
+
+	/** Whether a prompt is currently in flight */
+	bool bBusy = false;
+
+	/** Whether heavy histories are summarized in the background */
+	bool bAutoSummarizeHistory = false;
+
+	/** Guards against overlapping summarization passes */
+	bool bHistorySummarizationInFlight = false;
+
 	TUniquePtr<FClaudeCodeRunner> Runner;
 	TUniquePtr<FClaudeSessionManager> SessionManager;
 	FString CustomSystemPrompt;
+
+	// ===== Background lane =====
+	// One runner per in-flight background request, bounded by
+	// Process::MaxBackgroundRunners; all pool state is touched on the game
+	// thread only (dispatch and completion both run there), so no locking.
+
+	/** A request waiting for a free background lease (FIFO) */
+	struct FQueuedBackgroundRequest
+	{
+		FString Prompt;
+		FOnClaudeResponse OnComplete;
+		FClaudePromptOptions Options;
+	};
+
+	/** Background runners currently leased to in-flight requests */
+	TArray<TUniquePtr<FClaudeCodeRunner>> BackgroundRunners;
+
+	/** Background requests waiting for a free lease */
+	TArray<FQueuedBackgroundRequest> PendingBackgroundRequests;
 };
@@ -33,6 +33,10 @@ struct UNREALCLAUDE_API FClaudeRequestConfig
 
 	/** Allow Claude to use tools (Read, Write, Bash, etc.) */
 	TArray<FString> AllowedTools;
+
+	/** Keep a warm Claude process alive between requests (stream-json over
+	 *  stdin/stdout), skipping CLI cold start on follow-up prompts */
+	bool bUseResidentProcess = false;
 };
 
 /**
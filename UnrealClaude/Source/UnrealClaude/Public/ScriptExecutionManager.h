@@ -10,7 +10,7 @@
  * - Permission dialog flow
  * - Script compilation (C++ via Live Coding)
  * - Script execution (Python, Console, Editor Utility)
- * - Persistent history log
+ * - Indexed persistent history store (append-only records + offset index)
  * - Auto-retry on build failure
  */
 class UNREALCLAUDE_API FScriptExecutionManager
@@ -22,26 +22,38 @@ public:
 	FScriptExecutionManager();
 	~FScriptExecutionManager();
 
+	/** Receives script output chunks as they are produced (may be called many
+	 *  times during one execution, from the executing thread) */
+	using FScriptOutputSink = TFunction<void(const FString&)>;
+
 	/**
 	 * Execute a script with permission flow
 	 * @param Type - Script type (Cpp, Python, Console, EditorUtility)
 	 * @param ScriptContent - The script code (MUST include header comment with @Description)
 	 * @param Description - Brief description (used if not in header)
+	 * @param OutputSink - Optional sink receiving output incrementally while
+	 *                     the script runs (the result still carries it whole)
 	 * @return Execution result
 	 */
 	FScriptExecutionResult ExecuteScript(
 		EScriptType Type,
 		const FString& ScriptContent,
-		const FString& Description = TEXT("")
+		const FString& Description = TEXT(""),
+		FScriptOutputSink OutputSink = nullptr
 	);
 
 	/**
-	 * Get recent script history for Claude context
+	 * Get recent script history for Claude context. Served from the in-memory
+	 * tail when possible; older entries are read by seeking into the data
+	 * file via the offset index, never by replaying the whole log.
 	 * @param Count - Number of recent scripts to return
 	 * @return Array of history entries
 	 */
 	TArray<FScriptHistoryEntry> GetRecentScripts(int32 Count = 10) const;
 
+	/** Total entries in the persistent store (not just the in-memory tail) */
+	int32 GetTotalHistoryCount() const { return EntryOffsets.Num(); }
+
 	/**
 	 * Format recent scripts for Claude context prompt
 	 * @param Count - Number of recent scripts to include
@@ -49,13 +61,15 @@ public:
 	 */
 	FString FormatHistoryForContext(int32 Count = 10) const;
 
-	/** Clear all script history */
+	/** Clear all script history (memory and the on-disk store) */
 	void ClearHistory();
 
-	/** Save history to disk */
+	/** Rewrite the data and index files from in-memory history.
+	 *  Normal appends are durable on their own; this is for migration and reset */
 	bool SaveHistory();
 
-	/** Load history from disk */
+	/** Load the offset index and the recent tail of entries; migrates the
+	 *  legacy single-JSON history file on first run */
 	bool LoadHistory();
 
 	/**
@@ -64,7 +78,21 @@ public:
 	 */
 	FString CleanupAll();
 
-	/** Get path to script history JSON file */
+	/**
+	 * Whether Python scripts run inside the persistent execution context.
+	 * The context retains imported modules and defined helpers across calls,
+	 * so iterative workflows skip the per-call import cost.
+	 */
+	void SetPersistentPythonContext(bool bEnabled) { bPersistentPythonContext = bEnabled; }
+	bool IsPersistentPythonContextEnabled() const { return bPersistentPythonContext; }
+
+	/**
+	 * Discard the persistent Python context. The next persistent run starts
+	 * from a clean namespace and re-pays its imports once.
+	 */
+	FScriptExecutionResult ResetPythonContext();
+
+	/** Get path to the legacy single-JSON history file (migration source) */
 	FString GetHistoryFilePath() const;
 
 	/** Get directory for generated C++ scripts */
@@ -78,10 +106,10 @@ private:
 	FScriptExecutionResult ExecuteCpp(const FString& ScriptContent, const FString& Description);
 
 	/** Execute Python script */
-	FScriptExecutionResult ExecutePython(const FString& ScriptContent, const FString& Description);
+	FScriptExecutionResult ExecutePython(const FString& ScriptContent, const FString& Description, const FScriptOutputSink& OutputSink);
 
 	/** Execute console command(s) */
-	FScriptExecutionResult ExecuteConsole(const FString& ScriptContent, const FString& Description);
+	FScriptExecutionResult ExecuteConsole(const FString& ScriptContent, const FString& Description, const FScriptOutputSink& OutputSink);
 
 	/** Execute Editor Utility Blueprint */
 	FScriptExecutionResult ExecuteEditorUtility(const FString& ScriptContent, const FString& Description);
@@ -98,9 +126,19 @@ private:
 	/**
 	 * Trigger Live Coding compilation
 	 * @param OutErrorLog - Compilation error output
+	 * @param bOutCompilerError - True when the failure came from the compiler
+	 *                            itself (cacheable), not from the environment
+	 *                            (module missing, disabled, timeout)
 	 * @return true if compilation succeeded
 	 */
-	bool TriggerLiveCodingCompile(FString& OutErrorLog);
+	bool TriggerLiveCodingCompile(FString& OutErrorLog, bool& bOutCompilerError);
+
+	/**
+	 * Canonical form of script source for compile-cache keys: line endings,
+	 * trailing whitespace, blank lines, and header metadata (@Created varies
+	 * per submission) are stripped so only token-level edits change the hash
+	 */
+	static FString HashNormalizedSource(const FString& ScriptContent);
 
 	/**
 	 * Write script file to disk
@@ -124,12 +162,54 @@ private:
 	 */
 	void AddToHistory(const FScriptHistoryEntry& Entry);
 
-	/** Script execution history */
+	/** Path of the append-only history data file (one JSON record per line) */
+	FString GetHistoryDataFilePath() const;
+
+	/** Path of the offset index file (one int64 byte offset per record) */
+	FString GetHistoryIndexFilePath() const;
+
+	/** Append one record to the data file and its offset to the index (O(1)) */
+	bool AppendHistoryRecord(const FScriptHistoryEntry& Entry);
+
+	/** Rebuild the offset index by scanning the data file once (corruption recovery) */
+	bool RebuildHistoryIndex();
+
+	/** Read entries from the given data-file byte offset to end of file */
+	bool ReadEntriesFromOffset(int64 Offset, TArray<FScriptHistoryEntry>& OutEntries) const;
+
+	/** One-time import of the legacy single-JSON history file into the store */
+	bool MigrateLegacyHistory();
+
+	/** Write the persistent-context driver script if missing; returns its path */
+	FString EnsurePythonDriverScript();
+
+	/** In-memory tail of recent entries (bounded by MaxHistorySize);
+	 *  older entries stay on disk and are reached through the index */
 	TArray<FScriptHistoryEntry> History;
 
-	/** Maximum history entries to keep */
+	/** Byte offset of every record in the data file, oldest first */
+	TArray<int64> EntryOffsets;
+
+	/** Maximum history entries to keep in memory */
 	int32 MaxHistorySize;
 
 	/** Script counter for unique naming */
 	int32 ScriptCounter;
+
+	/** Whether Python scripts share the persistent execution context */
+	bool bPersistentPythonContext;
+
+	/** One remembered Live Coding round-trip for a C++ script source */
+	struct FCppCompileCacheEntry
+	{
+		/** The result the compile produced (success or compiler error) */
+		FScriptExecutionResult Result;
+
+		/** Where the source was written when it was compiled */
+		FString FilePath;
+	};
+
+	/** Live Coding outcomes keyed by normalized source hash. In-memory only:
+	 *  patches from this editor session are what the cache vouches for */
+	TMap<FString, FCppCompileCacheEntry> CppCompileCache;
 };
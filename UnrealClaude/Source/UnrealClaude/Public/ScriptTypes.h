@@ -255,6 +255,11 @@ struct FScriptExecutionResult
 	/** Error output if failed */
 	FString ErrorOutput;
 
+	/** Global log lines emitted while the script ran (side effects that never
+	 *  reach the Exec archive), captured by the scoped log device. Empty when
+	 *  the execution logged nothing */
+	FString LogOutput;
+
 	/** Number of retry attempts made */
 	int32 RetryCount;
 
@@ -16,11 +16,19 @@ namespace UnrealClaudeConstants
 		/** Buffer size for reading process output */
 		constexpr int32 OutputBufferSize = 4096;
 
+		/** Bytes requested per pipe read when draining child process stdout;
+		 *  larger chunks mean fewer syscalls on big responses */
+		constexpr int32 PipeReadChunkBytes = 64 * 1024;
+
 		/** Timeout in milliseconds when waiting for process */
 		constexpr int32 WaitTimeoutMs = 100;
 
 		/** Default timeout in seconds for Claude CLI execution */
 		constexpr float DefaultTimeoutSeconds = 300.0f;
+
+		/** Maximum concurrent background-lane Claude processes; requests
+		 *  beyond this queue FIFO until a lease frees up */
+		constexpr int32 MaxBackgroundRunners = 2;
 	}
 
 	// UI Dimensions
@@ -40,6 +48,13 @@ namespace UnrealClaudeConstants
 
 		/** Maximum script preview length in characters */
 		constexpr int32 MaxScriptPreviewLength = 2000;
+
+		/**
+		 * Once a streaming message's live tail exceeds this many characters,
+		 * completed paragraphs are sealed into static text blocks so each new
+		 * chunk only re-shapes the bounded tail, not the whole message
+		 */
+		constexpr int32 StreamingSealThresholdChars = 2048;
 	}
 
 	// Session Management
@@ -50,6 +65,41 @@ namespace UnrealClaudeConstants
 
 		/** Maximum number of history exchanges to include in prompt */
 		constexpr int32 MaxHistoryInPrompt = 10;
+
+		/** Journal entries accumulated before compacting into the snapshot */
+		constexpr int32 JournalCompactionThreshold = 25;
+
+		/** Lifetime of opt-in cached prompt responses on disk */
+		constexpr double ResponseCacheTTLSeconds = 24.0 * 60.0 * 60.0;
+
+		/** Inactive session histories kept resident after switching away;
+		 *  older ones are evicted LRU and reload from disk on next switch */
+		constexpr int32 MaxResidentSessions = 3;
+
+		/** Magic tag opening a binary session snapshot ('UCSS') */
+		constexpr uint32 SnapshotMagic = 0x55435353;
+
+		/** Current binary snapshot schema version; readers reject newer
+		 *  files instead of misparsing them */
+		constexpr uint32 SnapshotVersion = 1;
+
+		/** Record payloads at or above this many bytes are LZ4-compressed;
+		 *  smaller ones are stored raw (the header costs more than it saves) */
+		constexpr int32 SnapshotCompressMinBytes = 1024;
+
+		/** Estimated token budget for in-memory history; oldest exchanges
+		 *  are trimmed beyond this regardless of exchange count */
+		constexpr int32 MaxHistoryTokens = 8000;
+
+		/** Estimated token budget for history included in an outgoing prompt */
+		constexpr int32 MaxPromptHistoryTokens = 4000;
+
+		/** History token estimate that triggers background summarization
+		 *  when auto-summarize is enabled */
+		constexpr int32 SummarizeTriggerTokens = 6000;
+
+		/** Recent exchanges kept verbatim when older ones are summarized */
+		constexpr int32 SummarizeKeepRecentExchanges = 10;
 	}
 
 	// Project Context
@@ -72,6 +122,19 @@ namespace UnrealClaudeConstants
 
 		/** Maximum distance (in characters) to search for parent class after class name */
 		constexpr int32 MaxClassNameToInheritanceDistance = 50;
+
+		/** Rough characters-per-token ratio used to budget prompt context;
+		 *  prompts are ASCII-heavy so ~4 holds well enough for budgeting */
+		constexpr int32 ApproxCharsPerToken = 4;
+
+		/** Default token budget for the project context block */
+		constexpr int32 DefaultContextTokenBudget = 2000;
+
+		/** Magic word identifying the on-disk header-index cache file */
+		constexpr uint32 ContextCacheMagic = 0x55434358; // 'UCCX'
+
+		/** Cache format version; bump whenever the serialized layout changes */
+		constexpr int32 ContextCacheVersion = 2; // v2: class specifiers, line numbers, reflected members
 	}
 
 	// Animation Blueprint Diagram Generation
@@ -94,6 +157,24 @@ namespace UnrealClaudeConstants
 
 		/** Maximum state name length before truncation in diagrams */
 		constexpr int32 MaxStateNameDisplayLength = 12;
+
+		/** States per row when BuildStateMachine auto-places state nodes */
+		constexpr int32 StateGridColumns = 4;
+
+		/** Horizontal spacing of auto-placed state nodes */
+		constexpr int32 StateGridSpacingX = 400;
+
+		/** Vertical spacing of auto-placed state nodes */
+		constexpr int32 StateGridSpacingY = 250;
+
+		/** Laid-out ASCII diagrams cached per state machine (oldest evicted) */
+		constexpr int32 MaxCachedDiagrams = 32;
+
+		/** Condition abbreviations cached per transition node (cleared when full) */
+		constexpr int32 MaxCachedConditionAbbrevs = 512;
+
+		/** Anim blueprints with a live graph index (cleared when full) */
+		constexpr int32 MaxIndexedAnimBlueprints = 64;
 	}
 
 	// MCP Validation Limits
@@ -149,6 +230,32 @@ namespace UnrealClaudeConstants
 		constexpr int32 MaxHistoryQueryCount = 50;
 	}
 
+	// Blueprint Loading
+	namespace BlueprintLoading
+	{
+		/** Seconds without a Blueprint load before the burst pins are
+		 *  released and GC may reclaim the working set */
+		constexpr float BurstPinIdleReleaseSeconds = 30.0f;
+
+		/** Blueprints held strongly during a burst (oldest evicted first) */
+		constexpr int32 MaxBurstPinnedBlueprints = 64;
+	}
+
+	// Asset Factory Pool
+	namespace FactoryPool
+	{
+		/** Seconds without an asset creation before the pooled factories are
+		 *  released back to GC */
+		constexpr float IdleReleaseSeconds = 30.0f;
+	}
+
+	// Actor Spatial Index
+	namespace SpatialIndex
+	{
+		/** Edge length of one spatial grid cell in world units (~51m) */
+		constexpr double CellSize = 5120.0;
+	}
+
 	// MCP Server
 	namespace MCPServer
 	{
@@ -158,12 +265,190 @@ namespace UnrealClaudeConstants
 		/** Timeout for game thread execution in milliseconds */
 		constexpr uint32 GameThreadTimeoutMs = 30000;
 
+		/**
+		 * Per-frame game thread budget for cooperatively sliced tool
+		 * executions. Slices step until this much of the frame is spent,
+		 * then yield so the editor stays interactive during big mutations
+		 */
+		constexpr double GameThreadSliceBudgetMs = 5.0;
+
+		/**
+		 * While an edit session is open, each tool call pushes editor autosave
+		 * at least this far out. Dirty packages accumulate and are saved in
+		 * one batched save_modified pass instead of mid-session save storms
+		 */
+		constexpr float EditSessionAutoSaveDeferSeconds = 300.0f;
+
+		/**
+		 * Maximum checkpoints per edit session. Each checkpoint seals a
+		 * transaction segment into the undo buffer; a runaway agent taking
+		 * one per call would flood it.
+		 */
+		constexpr int32 MaxEditSessionCheckpoints = 32;
+
+		/**
+		 * Viewport sequence capture limits. The ring bounds readback memory
+		 * (slots * viewport size); the frame cap bounds the encoded batch a
+		 * single poll has to ship; the interval floor keeps the schedule from
+		 * outrunning the render thread.
+		 */
+		constexpr int32 MaxViewportSequenceFrames = 100;
+		constexpr int32 ViewportSequenceRingSlots = 4;
+		constexpr int32 MinViewportSequenceIntervalMs = 33;
+
+		/**
+		 * Transitive dependency traversal budgets. Closures on top-level
+		 * level packages run past 20k packages, so the walk is always
+		 * node-bounded: the default keeps a casual query cheap, the cap is
+		 * the most a caller can request explicitly.
+		 */
+		constexpr int32 DefaultTransitiveDependencyNodes = 5000;
+		constexpr int32 MaxTransitiveDependencyNodes = 50000;
+
+		/**
+		 * Minimum free physical memory required to honor a task's GC-deferral
+		 * request. Below this the deferral is skipped and GC runs normally -
+		 * the safety valve beats the predictable single pause.
+		 */
+		constexpr uint64 GCDeferralMinFreePhysicalMB = 1024;
+
+		/** Upper bound on the adaptively sized worker pool; beyond this,
+		 *  extra workers only add contention on the pending queues */
+		constexpr int32 AdaptiveWorkerMaxCount = 16;
+
+		/**
+		 * Smoothed frame time above which the game thread counts as busy.
+		 * While busy, Normal/Low priority game-thread-bound dispatches are
+		 * paced instead of stacking up behind the hitching frame.
+		 */
+		constexpr double GameThreadBusyFrameMs = 40.0;
+
+		/** Minimum spacing between game-thread-bound dispatches while the
+		 *  game thread is busy - throttled, never starved */
+		constexpr double BusyGameThreadDispatchIntervalMs = 250.0;
+
+		/** Default hold time for a /mcp/task/wait long-poll before it gives
+		 *  up and returns the task's current (non-terminal) status */
+		constexpr uint32 TaskWaitDefaultTimeoutMs = 30000;
+
+		/** Upper bound a client may request for a single wait hold */
+		constexpr uint32 TaskWaitMaxTimeoutMs = 120000;
+
 		/** Default output log lines to return */
 		constexpr int32 DefaultOutputLogLines = 100;
 
 		/** Maximum output log lines to return */
 		constexpr int32 MaxOutputLogLines = 1000;
 
+		/** Lines retained by the in-memory log ring buffer (cursor polling) */
+		constexpr int32 LogRingBufferCapacity = 4096;
+
+		/** In-memory blueprint_diff snapshots retained (oldest evicted first) */
+		constexpr int32 MaxBlueprintDiffSnapshots = 32;
+
+		/** Seconds a cached asset_search cursor result set stays valid */
+		constexpr double AssetSearchCursorTTLSeconds = 120.0;
+
+		/** Cached asset_search cursor result sets retained (oldest evicted first) */
+		constexpr int32 MaxAssetSearchCursors = 8;
+
+		/** Object paths accepted by one get_assets_metadata call */
+		constexpr int32 MaxAssetsMetadataBatch = 200;
+
+		/** Live asset_watch registrations retained */
+		constexpr int32 MaxAssetWatches = 16;
+
+		/** Seconds an asset_watch survives without being polled */
+		constexpr double AssetWatchTTLSeconds = 600.0;
+
+		/** Buffered deltas per watch before it reports overflow */
+		constexpr int32 MaxAssetWatchPendingDeltas = 1000;
+
+		/** Concurrent tool executions admitted; excess requests get 429 */
+		constexpr int32 MaxInFlightToolRequests = 8;
+
+		/** Pending background tasks beyond which new requests get 429 */
+		constexpr int32 MaxQueuedBackgroundTasks = 64;
+
+		/** Game-thread milliseconds MCP work may consume per one-second
+		 *  window before new requests are shed; keeps the editor responsive
+		 *  under a misbehaving agent hammering game-thread tools */
+		constexpr double GameThreadBudgetMsPerSecond = 250.0;
+
+		/** Retry-After value sent with 429 backpressure responses */
+		constexpr int32 BackpressureRetryAfterSeconds = 1;
+
+		/** Default mutation journal entries returned by get_mutation_journal */
+		constexpr int32 DefaultMutationJournalEntries = 50;
+
+		/** Maximum mutation journal entries returned in one query */
+		constexpr int32 MaxMutationJournalEntries = 500;
+
+		/** Spilled task result files retained on disk across sessions */
+		constexpr int32 MaxPersistedTaskResults = 200;
+
+		/** Default seconds a stress_test run generates load for */
+		constexpr int32 StressDefaultDurationSeconds = 10;
+
+		/** Longest stress_test run accepted */
+		constexpr int32 StressMaxDurationSeconds = 60;
+
+		/** Default stress_test submission rate (requests per second) */
+		constexpr double StressDefaultTargetRate = 20.0;
+
+		/** Highest stress_test submission rate accepted */
+		constexpr double StressMaxTargetRate = 200.0;
+
+		/** Seconds stress_test waits for in-flight tasks to finish after
+		 *  the last submission before reporting */
+		constexpr double StressDrainTimeoutSeconds = 10.0;
+
+		/** Response bodies at or above this size are gzip-compressed when the client accepts it */
+		constexpr int32 MinCompressedResponseBytes = 32 * 1024;
+
+		/** Idle seconds advertised in the Keep-Alive response header; default
+		 *  for the per-machine setting. Clients that honor the advertisement
+		 *  ride one warm connection across bulk sequential tool calls instead
+		 *  of paying TCP setup per request */
+		constexpr int32 KeepAliveIdleTimeoutSeconds = 60;
+
+		/** Named pipe path prefix for the local transport (Windows only);
+		 *  the server port is appended so side-by-side editors get distinct
+		 *  endpoints */
+		inline const TCHAR* LocalPipeBasePath = TEXT("\\\\.\\pipe\\UnrealClaudeMCP");
+
+		/** Largest frame accepted over the local pipe transport */
+		constexpr int32 MaxPipeFrameBytes = 64 * 1024 * 1024;
+
+		/** Serialized responses at or above this size have their JSON tree
+		 *  released on the thread pool instead of freed node-by-node on the
+		 *  handler thread */
+		constexpr int32 AsyncJsonReleaseMinBytes = 32 * 1024;
+
+		/** Seconds after StartupModule before the deferred startup pass
+		 *  (server start, index builds, context seeding) runs; the core
+		 *  ticker first fires once the editor main loop is interactive */
+		constexpr float DeferredStartupDelaySeconds = 1.0f;
+
+		/** Seconds after server start before the hot tool set is constructed
+		 *  and the tool manifest frozen; keeps tool construction entirely off
+		 *  the editor boot path while the editor becomes interactive */
+		constexpr float ToolPreWarmDelaySeconds = 5.0f;
+
+		/** Tools constructed ahead of first use by the deferred pre-warm -
+		 *  the set an agent session typically touches in its first few calls.
+		 *  The long tail stays as descriptors until actually invoked. */
+		inline const TArray<FString> HotTools = {
+			TEXT("blueprint_query"),
+			TEXT("asset_search"),
+			TEXT("get_level_actors"),
+			TEXT("run_console_command"),
+			TEXT("execute_script"),
+			TEXT("task_submit"),
+			TEXT("task_status"),
+			TEXT("task_result")
+		};
+
 		/** Expected MCP tools that should be registered at startup */
 		inline const TArray<FString> ExpectedTools = {
 			// Actor tools
@@ -179,14 +464,21 @@ namespace UnrealClaudeConstants
 			TEXT("execute_script"),
 			TEXT("cleanup_scripts"),
 			TEXT("get_script_history"),
+			TEXT("get_mutation_journal"),
 			// Blueprint tools
 			TEXT("blueprint_query"),
 			TEXT("blueprint_modify"),
+			TEXT("blueprint_diff"),
 			TEXT("anim_blueprint_modify"),
 			// Asset tools
 			TEXT("asset_search"),
 			TEXT("asset_dependencies"),
 			TEXT("asset_referencers"),
+			TEXT("get_assets_metadata"),
+			// Project index tools
+			TEXT("project_symbols"),
+			// Session tools
+			TEXT("edit_session"),
 			// Task queue tools
 			TEXT("task_submit"),
 			TEXT("task_status"),
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Containers/Ticker.h"
 #include "UnrealClaudeConstants.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogUnrealClaude, Log, All);
@@ -35,7 +36,17 @@ private:
 	void StartMCPServer();
 	void StopMCPServer();
 
+	/**
+	 * Everything StartupModule defers off the editor boot path: server
+	 * start, log capture, index builds, context seeding. Runs once from
+	 * the core ticker after the editor is interactive.
+	 */
+	bool RunDeferredStartup(float DeltaTime);
+
 	TSharedPtr<class FUICommandList> PluginCommands;
 	TSharedPtr<class SDockTab> ClaudeTab;
 	TSharedPtr<FUnrealClaudeMCPServer> MCPServer;
+
+	/** Pending deferred-startup ticker; reset once it fires */
+	FTSTicker::FDelegateHandle DeferredStartupHandle;
 };
@@ -0,0 +1,116 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "UnrealClaudeSettings.generated.h"
+
+/**
+ * Per-machine tuning surface for the plugin's performance knobs.
+ *
+ * The defaults in UnrealClaudeConstants.h are compiled in, which made
+ * per-machine tuning a recompile - an 8-core laptop and a 32-core
+ * workstation want different worker pool sizes and admission limits.
+ * These settings live in the per-user editor config (not the project
+ * config, so they are never committed) and appear under
+ * Editor Preferences > Plugins > UnrealClaude.
+ *
+ * Edits apply live to the running server and task queue via
+ * ApplyToRunningSystems(); no editor restart. The one exception is the
+ * worker pool size, which can only be resized while the queue is idle -
+ * a change made mid-load takes effect once the queue drains.
+ */
+UCLASS(config = EditorPerProjectUserSettings, meta = (DisplayName = "UnrealClaude"))
+class UNREALCLAUDE_API UUnrealClaudeSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UUnrealClaudeSettings();
+
+	/** The active settings (CDO-backed, loaded from the user's config) */
+	static const UUnrealClaudeSettings& Get();
+
+	//~ Begin UDeveloperSettings interface
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+	//~ End UDeveloperSettings interface
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/**
+	 * Push the current values into the live task queue, admission
+	 * controller and caches. Safe to call before the server exists
+	 * (module startup order); applies what is reachable.
+	 */
+	void ApplyToRunningSystems() const;
+
+	/** Worker threads in the async task pool. Size to the machine: more
+	 *  cores tolerate more concurrent tool executions. Resized live only
+	 *  while the queue is idle. */
+	UPROPERTY(EditAnywhere, config, Category = "Task Queue", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 MaxConcurrentTasks;
+
+	/** Scale the worker pool to this machine's cores (MaxConcurrentTasks
+	 *  becomes the floor) and pace game-thread-bound dispatches while the
+	 *  editor is hitching. Disable to pin the pool at exactly
+	 *  MaxConcurrentTasks with no dispatch pacing. */
+	UPROPERTY(EditAnywhere, config, Category = "Task Queue")
+	bool bAdaptiveConcurrency;
+
+	/** Completed tasks kept in history for task_list/task_status */
+	UPROPERTY(EditAnywhere, config, Category = "Task Queue", meta = (ClampMin = "10", ClampMax = "1000"))
+	int32 MaxTaskHistorySize;
+
+	/** Seconds a completed task's result is retained before cleanup */
+	UPROPERTY(EditAnywhere, config, Category = "Task Queue", meta = (ClampMin = "30", ClampMax = "3600"))
+	int32 ResultRetentionSeconds;
+
+	/** Default timeout for async tasks in milliseconds */
+	UPROPERTY(EditAnywhere, config, Category = "Task Queue", meta = (ClampMin = "1000", ClampMax = "600000"))
+	int32 DefaultTaskTimeoutMs;
+
+	/** Seconds a completed read-only result may be re-served to an
+	 *  identical resubmission before the work re-runs */
+	UPROPERTY(EditAnywhere, config, Category = "Caching", meta = (ClampMin = "0", ClampMax = "300"))
+	int32 DedupResultTTLSeconds;
+
+	/** Seconds a cached asset_search cursor result set stays valid */
+	UPROPERTY(EditAnywhere, config, Category = "Caching", meta = (ClampMin = "10", ClampMax = "600"))
+	int32 AssetSearchCursorTTLSeconds;
+
+	/** Concurrent tool executions admitted by the HTTP server; excess
+	 *  requests are shed with 429 */
+	UPROPERTY(EditAnywhere, config, Category = "Server", meta = (ClampMin = "1", ClampMax = "64"))
+	int32 MaxInFlightToolRequests;
+
+	/** Pending background tasks beyond which new requests are shed */
+	UPROPERTY(EditAnywhere, config, Category = "Server", meta = (ClampMin = "1", ClampMax = "512"))
+	int32 MaxQueuedBackgroundTasks;
+
+	/** Idle seconds a keep-alive connection is advertised to stay open.
+	 *  Sent on every response; clients that honor it reuse one warm
+	 *  connection for bulk sequential tool calls instead of paying TCP
+	 *  setup per request. Read live; no restart needed */
+	UPROPERTY(EditAnywhere, config, Category = "Server", meta = (ClampMin = "5", ClampMax = "600"))
+	int32 KeepAliveIdleTimeoutSeconds;
+
+	/** Serve tool execution over a local named pipe alongside HTTP
+	 *  (Windows only). Skips the TCP stack and localhost interception
+	 *  layers entirely. Applied when the server next starts */
+	UPROPERTY(EditAnywhere, config, Category = "Server")
+	bool bEnableLocalPipeTransport;
+
+	/** Record every tool request/response to a binary log under
+	 *  Saved/UnrealClaude/Recordings for offline replay benchmarking.
+	 *  Diagnostic mode - bodies are written as captured. Applied when
+	 *  the server next starts */
+	UPROPERTY(EditAnywhere, config, Category = "Server")
+	bool bRecordToolTraffic;
+
+	/** JPEG quality for capture_viewport output (lower = smaller payloads) */
+	UPROPERTY(EditAnywhere, config, Category = "Capture", meta = (ClampMin = "10", ClampMax = "100"))
+	int32 ViewportJpegQuality;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Misc/OutputDevice.h"
+#include "Misc/OutputDeviceRedirector.h"
 
 /**
  * Shared utility classes and functions for UnrealClaude plugin
@@ -39,6 +40,75 @@ public:
 	}
 };
 
+/**
+ * Scoped capture of everything the global log emits while it is alive.
+ *
+ * Registers with GLog on construction and unregisters on destruction, so the
+ * captured lines are exactly the ones logged during the scope. This is what
+ * makes output attribution exact: the Exec output device above only sees what
+ * a command writes to its archive, while side effects (spawn notifications,
+ * warnings from engine subsystems, Python tracebacks routed through
+ * LogPython) go to the global log - previously recoverable only by
+ * timestamp-matching against get_output_log, which is racy when executions
+ * overlap.
+ *
+ * Log devices are serialized from any thread, so appends are guarded. The
+ * plugin's own LogUnrealClaude bookkeeping lines are filtered out - they
+ * describe the execution, they are not part of what it produced.
+ */
+class FUnrealClaudeScopedLogCapture : public FOutputDevice
+{
+public:
+	/** Optional sink receiving each captured line as it arrives (same shape
+	 *  as FScriptExecutionManager::FScriptOutputSink) */
+	explicit FUnrealClaudeScopedLogCapture(TFunction<void(const FString&)> InSink = nullptr)
+		: Sink(MoveTemp(InSink))
+	{
+		if (GLog)
+		{
+			GLog->AddOutputDevice(this);
+		}
+	}
+
+	virtual ~FUnrealClaudeScopedLogCapture()
+	{
+		if (GLog)
+		{
+			GLog->RemoveOutputDevice(this);
+		}
+	}
+
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+	{
+		if (Verbosity == ELogVerbosity::SetColor || Category == TEXT("LogUnrealClaude"))
+		{
+			return;
+		}
+
+		const FString Line = FString::Printf(TEXT("[%s] %s\n"), *Category.ToString(), V);
+		{
+			FScopeLock Lock(&CapturedLock);
+			Captured += Line;
+		}
+		if (Sink)
+		{
+			Sink(Line);
+		}
+	}
+
+	/** Lines logged so far during this scope (trailing whitespace removed) */
+	FString GetCaptured() const
+	{
+		FScopeLock Lock(&CapturedLock);
+		return Captured.TrimEnd();
+	}
+
+private:
+	FString Captured;
+	mutable FCriticalSection CapturedLock;
+	TFunction<void(const FString&)> Sink;
+};
+
 /**
  * JSON parsing utilities for MCP tools
  * Provides safe extraction of transform data from JSON objects
@@ -39,6 +39,7 @@ public class UnrealClaude : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"DeveloperSettings",
 				"Json",
 				"JsonUtilities",
 				"HTTP",
@@ -53,6 +54,8 @@ public class UnrealClaude : ModuleRules
 				"GraphEditor",
 				"AssetRegistry",
 				"AssetTools",
+				// Incremental project context index
+				"DirectoryWatcher",
 				// Animation Blueprint manipulation
 				"AnimGraph",
 				"AnimGraphRuntime",